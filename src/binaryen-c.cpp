@@ -4598,6 +4598,221 @@ void BinaryenAddCustomSection(BinaryenModuleRef module,
   ((Module*)module)->userSections.push_back(customSection);
 }
 
+//
+// ========= Batched building =========
+//
+
+namespace {
+
+enum BuildOp : uint32_t {
+  BuildConst = 0,
+  BuildLocalGet,
+  BuildLocalSet,
+  BuildLocalTee,
+  BuildUnary,
+  BuildBinary,
+  BuildSelect,
+  BuildDrop,
+  BuildReturn,
+  BuildNop,
+  BuildUnreachable,
+  BuildBlock,
+  BuildIf,
+  BuildLoad,
+  BuildStore
+};
+
+} // anonymous namespace
+
+BinaryenBuildOp BinaryenBuildConst(void) { return BuildConst; }
+BinaryenBuildOp BinaryenBuildLocalGet(void) { return BuildLocalGet; }
+BinaryenBuildOp BinaryenBuildLocalSet(void) { return BuildLocalSet; }
+BinaryenBuildOp BinaryenBuildLocalTee(void) { return BuildLocalTee; }
+BinaryenBuildOp BinaryenBuildUnary(void) { return BuildUnary; }
+BinaryenBuildOp BinaryenBuildBinary(void) { return BuildBinary; }
+BinaryenBuildOp BinaryenBuildSelect(void) { return BuildSelect; }
+BinaryenBuildOp BinaryenBuildDrop(void) { return BuildDrop; }
+BinaryenBuildOp BinaryenBuildReturn(void) { return BuildReturn; }
+BinaryenBuildOp BinaryenBuildNop(void) { return BuildNop; }
+BinaryenBuildOp BinaryenBuildUnreachable(void) { return BuildUnreachable; }
+BinaryenBuildOp BinaryenBuildBlock(void) { return BuildBlock; }
+BinaryenBuildOp BinaryenBuildIf(void) { return BuildIf; }
+BinaryenBuildOp BinaryenBuildLoad(void) { return BuildLoad; }
+BinaryenBuildOp BinaryenBuildStore(void) { return BuildStore; }
+
+BinaryenExpressionRef
+BinaryenModuleBuildFromBuffer(BinaryenModuleRef module,
+                              const struct BinaryenBuildCommand* commands,
+                              BinaryenIndex numCommands) {
+  auto& wasm = *(Module*)module;
+  Builder builder(wasm);
+  std::vector<Expression*> stack;
+  auto pop = [&]() {
+    if (stack.empty()) {
+      Fatal() << "batched build command pops an empty stack.";
+    }
+    auto* ret = stack.back();
+    stack.pop_back();
+    return ret;
+  };
+  for (BinaryenIndex i = 0; i < numCommands; i++) {
+    auto& cmd = commands[i];
+    Expression* expr;
+    switch (BuildOp(cmd.op)) {
+      case BuildConst: {
+        Literal value;
+        switch (Type(cmd.type).getBasic()) {
+          case Type::i32:
+            value = Literal(cmd.value.i32);
+            break;
+          case Type::i64:
+            value = Literal(cmd.value.i64);
+            break;
+          case Type::f32:
+            value = Literal(cmd.value.f32);
+            break;
+          case Type::f64:
+            value = Literal(cmd.value.f64);
+            break;
+          default:
+            Fatal() << "invalid constant type in batched build.";
+        }
+        expr = builder.makeConst(value);
+        break;
+      }
+      case BuildLocalGet:
+        expr = builder.makeLocalGet(cmd.arg, Type(cmd.type));
+        break;
+      case BuildLocalSet:
+        expr = builder.makeLocalSet(cmd.arg, pop());
+        break;
+      case BuildLocalTee:
+        expr = builder.makeLocalTee(cmd.arg, pop(), Type(cmd.type));
+        break;
+      case BuildUnary:
+        expr = builder.makeUnary(UnaryOp(cmd.arg), pop());
+        break;
+      case BuildBinary: {
+        auto* right = pop();
+        auto* left = pop();
+        expr = builder.makeBinary(BinaryOp(cmd.arg), left, right);
+        break;
+      }
+      case BuildSelect: {
+        auto* ret = wasm.allocator.alloc<Select>();
+        ret->ifFalse = pop();
+        ret->ifTrue = pop();
+        ret->condition = pop();
+        if (cmd.type != BinaryenTypeAuto()) {
+          ret->finalize(Type(cmd.type));
+        } else {
+          ret->finalize();
+        }
+        expr = ret;
+        break;
+      }
+      case BuildDrop:
+        expr = builder.makeDrop(pop());
+        break;
+      case BuildReturn:
+        expr = builder.makeReturn(cmd.arg ? pop() : nullptr);
+        break;
+      case BuildNop:
+        expr = builder.makeNop();
+        break;
+      case BuildUnreachable:
+        expr = builder.makeUnreachable();
+        break;
+      case BuildBlock: {
+        auto* ret = wasm.allocator.alloc<Block>();
+        ret->list.resize(cmd.arg);
+        for (auto j = cmd.arg; j > 0; j--) {
+          ret->list[j - 1] = pop();
+        }
+        if (cmd.type != BinaryenTypeAuto()) {
+          ret->finalize(Type(cmd.type));
+        } else {
+          ret->finalize();
+        }
+        expr = ret;
+        break;
+      }
+      case BuildIf: {
+        if (cmd.arg != 2 && cmd.arg != 3) {
+          Fatal() << "invalid if child count in batched build.";
+        }
+        auto* ifFalse = cmd.arg == 3 ? pop() : nullptr;
+        auto* ifTrue = pop();
+        auto* condition = pop();
+        expr = builder.makeIf(condition, ifTrue, ifFalse);
+        break;
+      }
+      case BuildLoad: {
+        uint32_t bytes = cmd.arg & 0xff;
+        bool signed_ = cmd.arg & 0x100;
+        expr = builder.makeLoad(
+          bytes, signed_, cmd.value.i64, bytes, pop(), Type(cmd.type));
+        break;
+      }
+      case BuildStore: {
+        uint32_t bytes = cmd.arg & 0xff;
+        auto* value = pop();
+        auto* ptr = pop();
+        expr = builder.makeStore(
+          bytes, cmd.value.i64, bytes, ptr, value, Type(cmd.type));
+        break;
+      }
+      default:
+        Fatal() << "unknown batched build command " << cmd.op << ".";
+    }
+    stack.push_back(expr);
+  }
+  if (stack.size() != 1) {
+    Fatal() << "batched build ended with " << stack.size()
+            << " expressions on the stack instead of one.";
+  }
+  return static_cast<BinaryenExpressionRef>(stack.back());
+}
+
+//
+// ========= Concurrent building =========
+//
+
+void BinaryenModuleMergeContexts(BinaryenModuleRef target,
+                                 BinaryenModuleRef* contexts,
+                                 BinaryenIndex numContexts) {
+  auto& wasm = *(Module*)target;
+  for (BinaryenIndex i = 0; i < numContexts; i++) {
+    std::unique_ptr<Module> context((Module*)contexts[i]);
+    if (!context->tables.empty() || !context->elementSegments.empty() ||
+        !context->dataSegments.empty() || context->memory.exists) {
+      Fatal() << "build contexts may only contain functions, globals, tags, "
+                 "and exports.";
+    }
+    for (auto& curr : context->functions) {
+      wasm.addFunction(std::move(curr));
+    }
+    for (auto& curr : context->globals) {
+      wasm.addGlobal(std::move(curr));
+    }
+    for (auto& curr : context->tags) {
+      wasm.addTag(std::move(curr));
+    }
+    for (auto& curr : context->exports) {
+      wasm.addExport(std::move(curr));
+    }
+    context->functions.clear();
+    context->globals.clear();
+    context->tags.clear();
+    context->exports.clear();
+    context->updateMaps();
+    // The IR we moved still lives in the context's arena, and expressions
+    // keep references to that arena for later growth, so the context itself
+    // must stay alive as long as the target.
+    wasm.absorbedModules.push_back(std::move(context));
+  }
+}
+
 //
 // ========= Effect analyzer =========
 //
@@ -2755,6 +2755,104 @@ BINARYEN_API void BinaryenAddCustomSection(BinaryenModuleRef module,
                                            const char* contents,
                                            BinaryenIndex contentsSize);
 
+//
+// ========= Batched building =========
+//
+// Building a large module one expression per call pays FFI overhead on every
+// node. The batched builder instead consumes a whole buffer of compact
+// commands in a single call. Commands execute in order and communicate
+// through an implicit expression stack: each command pops the children it
+// needs (pushed by earlier commands) and pushes the expression it creates,
+// postorder, like the wasm binary format itself. Children are pushed in the
+// argument order of the corresponding Binaryen* creation function, so for
+// example a binary operation is built by pushing its left operand, then its
+// right operand, then executing BinaryenBuildBinary.
+//
+
+typedef uint32_t BinaryenBuildOp;
+
+// Pushes a constant; |type| selects the payload field of |value|.
+BINARYEN_API BinaryenBuildOp BinaryenBuildConst(void);
+// |arg| is the local index; |type| is the local's type.
+BINARYEN_API BinaryenBuildOp BinaryenBuildLocalGet(void);
+// |arg| is the local index; pops the value.
+BINARYEN_API BinaryenBuildOp BinaryenBuildLocalSet(void);
+// |arg| is the local index; |type| is the local's type; pops the value.
+BINARYEN_API BinaryenBuildOp BinaryenBuildLocalTee(void);
+// |arg| is the BinaryenOp; pops the operand.
+BINARYEN_API BinaryenBuildOp BinaryenBuildUnary(void);
+// |arg| is the BinaryenOp; pops the two operands.
+BINARYEN_API BinaryenBuildOp BinaryenBuildBinary(void);
+// Pops the condition, ifTrue and ifFalse; |type| as in BinaryenSelect.
+BINARYEN_API BinaryenBuildOp BinaryenBuildSelect(void);
+// Pops the value.
+BINARYEN_API BinaryenBuildOp BinaryenBuildDrop(void);
+// |arg| is the number of return values (0 or 1); pops that many.
+BINARYEN_API BinaryenBuildOp BinaryenBuildReturn(void);
+BINARYEN_API BinaryenBuildOp BinaryenBuildNop(void);
+BINARYEN_API BinaryenBuildOp BinaryenBuildUnreachable(void);
+// |arg| is the number of children, which are popped; |type| as in
+// BinaryenBlock. The block is unnamed.
+BINARYEN_API BinaryenBuildOp BinaryenBuildBlock(void);
+// |arg| is the number of children: 2 (condition, ifTrue) or 3 (condition,
+// ifTrue, ifFalse), which are popped.
+BINARYEN_API BinaryenBuildOp BinaryenBuildIf(void);
+// For loads and stores, the low byte of |arg| is the number of bytes
+// loaded/stored, bit 8 is set for signed loads, |value.i64| is the constant
+// offset, and the alignment is natural; |type| is the loaded/stored type.
+// Load pops the pointer; store pops the pointer and then the value.
+BINARYEN_API BinaryenBuildOp BinaryenBuildLoad(void);
+BINARYEN_API BinaryenBuildOp BinaryenBuildStore(void);
+
+struct BinaryenBuildCommand {
+  // What to build: one of the BinaryenBuild* ops above.
+  uint32_t op;
+  // An op-specific immediate: a BinaryenOp, a local index, a child count...
+  uint32_t arg;
+  // The type immediate, for the ops that take one.
+  BinaryenType type;
+  // The constant value, for BinaryenBuildConst (and the offset of loads and
+  // stores, in i64).
+  union {
+    int32_t i32;
+    int64_t i64;
+    float f32;
+    double f64;
+  } value;
+};
+
+// Executes the command buffer and returns the resulting expression, which is
+// the single expression left on the stack; aborts on a malformed buffer
+// (an unknown command, popping an empty stack, or more or less than one
+// expression remaining at the end).
+BINARYEN_API BinaryenExpressionRef
+BinaryenModuleBuildFromBuffer(BinaryenModuleRef module,
+                              const struct BinaryenBuildCommand* commands,
+                              BinaryenIndex numCommands);
+
+//
+// ========= Concurrent building =========
+//
+// A parallel producer can emit IR at full core count by giving each thread
+// its own build context and merging the results when all threads are done. A
+// context is an ordinary module, created with BinaryenModuleCreate and used
+// as a scratch area: each module has its own arena, so threads building into
+// different contexts never contend. BinaryenModuleMergeContexts then moves
+// every function, global, tag and export the contexts hold into the target
+// module. The move transfers ownership rather than copying the IR, so
+// merging is cheap no matter how much was built; names and types need no
+// special handling, as both are interned in process-wide thread-safe stores.
+//
+// The target takes ownership of the contexts, since the moved IR still lives
+// in their memory: after the merge the contexts must not be used or disposed.
+// Contexts may only contain functions, globals, tags and exports; anything
+// else (tables, segments, a memory) must be created on the target directly.
+//
+
+BINARYEN_API void BinaryenModuleMergeContexts(BinaryenModuleRef target,
+                                              BinaryenModuleRef* contexts,
+                                              BinaryenIndex numContexts);
+
 //
 // ========= Effect analyzer =========
 //
@@ -22,6 +22,8 @@
 #include <list>
 #include <stack>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ir/branch-utils.h"
 #include "ir/utils.h"
@@ -618,48 +620,63 @@ struct Optimizer : public RelooperRecursor {
   // and there is no phi or switch to worry us, just skip through.
   bool SkipEmptyBlocks() {
     bool Worked = false;
+    // The ultimate block a branch to each block can be forwarded to, past any
+    // chain of skippable empty blocks. Memoizing this means each chain is
+    // walked once, and not once per branch into it, which matters on huge
+    // CFGs with long chains of empty blocks.
+    std::unordered_map<Block*, Block*> SkipTargets;
+    auto GetSkipTarget = [&](Block* First) {
+      // Walk forward through skippable blocks, collecting the chain we pass
+      // through, until we reach a block we cannot skip, one whose target we
+      // have already computed, or a cycle.
+      std::vector<Block*> Chain;
+      std::unordered_set<Block*> OnChain;
+      auto* Curr = First;
+      while (1) {
+        auto Known = SkipTargets.find(Curr);
+        if (Known != SkipTargets.end()) {
+          Curr = Known->second;
+          break;
+        }
+        if (!OnChain.insert(Curr).second) {
+          // An infinite loop of empty blocks; branching to any of them is
+          // equivalent, so stop wherever we are.
+          break;
+        }
+        bool Skippable = false;
+        if (IsEmpty(Curr) && Curr->BranchesOut.size() == 1) {
+          auto iter = Curr->BranchesOut.begin();
+          Branch* NextBranch = iter->second;
+          assert(!NextBranch->Condition && !NextBranch->SwitchValues);
+          if (!NextBranch->Code) { // TODO: handle extra code too
+            // We can skip through!
+            Chain.push_back(Curr);
+            Curr = iter->first;
+            Skippable = true;
+          }
+        }
+        if (!Skippable) {
+          // This is a terminal block; remember that it resolves to itself.
+          Chain.push_back(Curr);
+          break;
+        }
+      }
+      for (auto* Passed : Chain) {
+        SkipTargets[Passed] = Curr;
+      }
+      return Curr;
+    };
     for (auto& CurrBlock : Parent->Blocks) {
       // Generate a new set of branches out TODO optimize
       BlockBranchMap NewBranchesOut;
       for (auto& iter : CurrBlock->BranchesOut) {
         auto* Next = iter.first;
         auto* NextBranch = iter.second;
-        auto* First = Next;
-        auto* Replacement = First;
-#if RELOOPER_OPTIMIZER_DEBUG
-        std::cout << " maybeskip from " << Block->Id << " to next=" << Next->Id
-                  << '\n';
-#endif
-        std::unordered_set<decltype(Replacement)> Seen;
-        while (1) {
-          if (IsEmpty(Next) && Next->BranchesOut.size() == 1) {
-            auto iter = Next->BranchesOut.begin();
-            Block* NextNext = iter->first;
-            Branch* NextNextBranch = iter->second;
-            assert(!NextNextBranch->Condition && !NextNextBranch->SwitchValues);
-            if (!NextNextBranch->Code) { // TODO: handle extra code too
-              // We can skip through!
-              Next = Replacement = NextNext;
-              // If we've already seen this, stop - it's an infinite loop of
-              // empty blocks we can skip through.
-              if (!Seen.emplace(Replacement).second) {
-                // Stop here. Note that if we started from X and ended up with X
-                // once more, then Replacement == First and so lower down we
-                // will not report that we did any work, avoiding an infinite
-                // loop due to always thinking there is more work to do.
-                break;
-              } else {
-                // Otherwise, keep going.
-                continue;
-              }
-            }
-          }
-          break;
-        }
-        if (Replacement != First) {
+        auto* Replacement = GetSkipTarget(Next);
+        if (Replacement != Next) {
 #if RELOOPER_OPTIMIZER_DEBUG
           std::cout << "  skip to replacement! " << CurrBlock->Id << " -> "
-                    << First->Id << " -> " << Replacement->Id << '\n';
+                    << Next->Id << " -> " << Replacement->Id << '\n';
 #endif
           Worked = true;
         }
@@ -738,7 +755,7 @@ struct Optimizer : public RelooperRecursor {
   bool MergeConsecutiveBlocks() {
     bool Worked = false;
     // First, count predecessors.
-    std::map<Block*, size_t> NumPredecessors;
+    std::unordered_map<Block*, size_t> NumPredecessors;
     for (auto& CurrBlock : Parent->Blocks) {
       for (auto& iter : CurrBlock->BranchesOut) {
         auto* NextBlock = iter.first;
@@ -747,29 +764,32 @@ struct Optimizer : public RelooperRecursor {
     }
     NumPredecessors[Entry]++;
     for (auto& CurrBlock : Parent->Blocks) {
-      if (CurrBlock->BranchesOut.size() == 1) {
+      // Keep merging while we have a single successor that we can absorb, so
+      // that an entire chain A -> B -> C -> .. is collapsed right here, and
+      // not one link per iteration of the outer fixed-point loop.
+      while (CurrBlock->BranchesOut.size() == 1) {
         auto iter = CurrBlock->BranchesOut.begin();
         auto* NextBlock = iter->first;
         auto* NextBranch = iter->second;
         assert(NumPredecessors[NextBlock] > 0);
-        if (NextBlock != CurrBlock.get() && NumPredecessors[NextBlock] == 1) {
-          // Good to merge!
-          wasm::Builder Builder(*Parent->Module);
-          // Merge in code on the branch as well, if any.
-          if (NextBranch->Code) {
-            CurrBlock->Code =
-              Builder.makeSequence(CurrBlock->Code, NextBranch->Code);
-          }
+        if (NextBlock == CurrBlock.get() || NumPredecessors[NextBlock] != 1) {
+          break;
+        }
+        // Good to merge!
+        wasm::Builder Builder(*Parent->Module);
+        // Merge in code on the branch as well, if any.
+        if (NextBranch->Code) {
           CurrBlock->Code =
-            Builder.makeSequence(CurrBlock->Code, NextBlock->Code);
-          // Use the next block's branching behavior
-          CurrBlock->BranchesOut.swap(NextBlock->BranchesOut);
-          NextBlock->BranchesOut.clear();
-          CurrBlock->SwitchCondition = NextBlock->SwitchCondition;
-          // The next block now has no predecessors.
-          NumPredecessors[NextBlock] = 0;
-          Worked = true;
+            Builder.makeSequence(CurrBlock->Code, NextBranch->Code);
         }
+        CurrBlock->Code = Builder.makeSequence(CurrBlock->Code, NextBlock->Code);
+        // Use the next block's branching behavior
+        CurrBlock->BranchesOut.swap(NextBlock->BranchesOut);
+        NextBlock->BranchesOut.clear();
+        CurrBlock->SwitchCondition = NextBlock->SwitchCondition;
+        // The next block now has no predecessors.
+        NumPredecessors[NextBlock] = 0;
+        Worked = true;
       }
     }
     return Worked;
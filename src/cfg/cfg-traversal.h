@@ -217,7 +217,8 @@ struct CFGWalker : public ControlFlowWalker<SubType, VisitorType> {
 
   static void doEndBranch(SubType* self, Expression** currp) {
     auto* curr = *currp;
-    auto branchTargets = BranchUtils::getUniqueTargets(curr);
+    auto branchTargets =
+      BranchUtils::getUniqueTargets<BranchUtils::SmallNameSet>(curr);
     // Add branches to the targets.
     for (auto target : branchTargets) {
       self->branches[self->findBreakTarget(target)].push_back(
@@ -0,0 +1,225 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// A compact, pass-independent CFG for a function: a flat array of basic
+// blocks in reverse postorder, where each block holds index spans into flat
+// arrays of expressions, successors, and predecessors. Unlike CFGWalker,
+// which interleaves CFG construction with a pass-specific traversal, this is
+// a plain data artifact: build it once and hand it to any number of analyses
+// that want block structure, without each of them re-walking the IR.
+//
+// The CFG refers to expressions by pointer and becomes stale when the
+// function is modified; rebuild it after changes.
+//
+
+#ifndef cfg_flat_cfg_h
+#define cfg_flat_cfg_h
+
+#include "cfg-traversal.h"
+#include "wasm.h"
+
+namespace wasm {
+
+struct FlatCFG {
+  struct BasicBlock {
+    // The block's expressions, in execution order: a span
+    // [exprStart, exprEnd) in |exprs|.
+    Index exprStart, exprEnd;
+    // Spans in |succs| and |preds| giving the indexes of the blocks that
+    // follow and precede this one.
+    Index succStart, succEnd;
+    Index predStart, predEnd;
+  };
+
+  // Blocks in reverse postorder; the entry block is blocks[0]. Blocks that
+  // turned out to be unreachable are still present (they simply have no
+  // path from the entry).
+  std::vector<BasicBlock> blocks;
+
+  // The backing arrays the per-block spans point into.
+  std::vector<Expression*> exprs;
+  std::vector<Index> succs;
+  std::vector<Index> preds;
+
+  // The index of the block whose end flows out of the function, or
+  // InvalidIndex if the function ends in a return or an unreachable.
+  static const Index InvalidIndex = Index(-1);
+  Index exit = InvalidIndex;
+
+  // The blocks in postorder, and each block's position in that order.
+  // Computed on first use and cached on the artifact; as with the CFG
+  // itself, it is rebuilt rather than invalidated when the function
+  // changes. Unreachable blocks do not appear in the order, and have
+  // InvalidIndex as their position.
+  const std::vector<Index>& getPostorder() {
+    if (postorder.empty() && !blocks.empty()) {
+      computePostorder();
+    }
+    return postorder;
+  }
+
+  const std::vector<Index>& getPostorderIndexes() {
+    getPostorder();
+    return postorderIndexes;
+  }
+
+  // Each block's immediate dominator, computed with the standard fast-
+  // intersect algorithm ("A Simple, Fast Dominance Algorithm", Cooper,
+  // Harvey and Kennedy) over the dense block indexes, and cached like the
+  // postorder. The entry and unreachable blocks have InvalidIndex.
+  const std::vector<Index>& getIDoms() {
+    if (iDoms.empty() && !blocks.empty()) {
+      computeIDoms();
+    }
+    return iDoms;
+  }
+
+  // Whether block |a| dominates block |b|, walking the idom chain. Every
+  // block dominates itself.
+  bool dominates(Index a, Index b) {
+    auto& idoms = getIDoms();
+    while (1) {
+      if (a == b) {
+        return true;
+      }
+      b = idoms[b];
+      if (b == InvalidIndex) {
+        return false;
+      }
+    }
+  }
+
+  FlatCFG(Function* func, Module* module) {
+    struct Builder
+      : public CFGWalker<Builder,
+                         UnifiedExpressionVisitor<Builder>,
+                         std::vector<Expression*>> {
+      void visitExpression(Expression* curr) {
+        if (currBasicBlock) {
+          currBasicBlock->contents.push_back(curr);
+        }
+      }
+    } builder;
+    builder.setModule(module);
+    builder.walkFunction(func);
+
+    std::unordered_map<Builder::BasicBlock*, Index> indexes;
+    for (Index i = 0; i < builder.basicBlocks.size(); i++) {
+      indexes[builder.basicBlocks[i].get()] = i;
+    }
+    blocks.resize(builder.basicBlocks.size());
+    for (Index i = 0; i < builder.basicBlocks.size(); i++) {
+      auto& source = *builder.basicBlocks[i];
+      auto& block = blocks[i];
+      block.exprStart = exprs.size();
+      exprs.insert(exprs.end(), source.contents.begin(),
+                   source.contents.end());
+      block.exprEnd = exprs.size();
+      block.succStart = succs.size();
+      for (auto* out : source.out) {
+        succs.push_back(indexes[out]);
+      }
+      block.succEnd = succs.size();
+      block.predStart = preds.size();
+      for (auto* in : source.in) {
+        preds.push_back(indexes[in]);
+      }
+      block.predEnd = preds.size();
+    }
+    if (builder.exit) {
+      exit = indexes[builder.exit];
+    }
+  }
+
+private:
+  std::vector<Index> postorder;
+  std::vector<Index> postorderIndexes;
+  std::vector<Index> iDoms;
+
+  void computePostorder() {
+    postorderIndexes.assign(blocks.size(), InvalidIndex);
+    // An iterative DFS from the entry; the second element notes how many
+    // successors have been visited so far.
+    std::vector<std::pair<Index, Index>> stack;
+    std::vector<bool> seen(blocks.size());
+    stack.push_back({0, 0});
+    seen[0] = true;
+    while (!stack.empty()) {
+      auto& [index, numVisited] = stack.back();
+      auto& block = blocks[index];
+      if (block.succStart + numVisited < block.succEnd) {
+        auto succ = succs[block.succStart + numVisited];
+        numVisited++;
+        if (!seen[succ]) {
+          seen[succ] = true;
+          stack.push_back({succ, 0});
+        }
+        continue;
+      }
+      postorderIndexes[index] = postorder.size();
+      postorder.push_back(index);
+      stack.pop_back();
+    }
+  }
+
+  void computeIDoms() {
+    getPostorder();
+    iDoms.assign(blocks.size(), InvalidIndex);
+    auto intersect = [&](Index a, Index b) {
+      while (a != b) {
+        while (postorderIndexes[a] < postorderIndexes[b]) {
+          a = iDoms[a];
+        }
+        while (postorderIndexes[b] < postorderIndexes[a]) {
+          b = iDoms[b];
+        }
+      }
+      return a;
+    };
+    // The entry is its own dominator while iterating, which the intersect
+    // relies on; it is reset to InvalidIndex at the end.
+    iDoms[0] = 0;
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      // Iterate in reverse postorder, skipping the entry.
+      for (auto i = postorder.size(); i >= 2; i--) {
+        auto index = postorder[i - 2];
+        Index newIDom = InvalidIndex;
+        auto& block = blocks[index];
+        for (auto p = block.predStart; p < block.predEnd; p++) {
+          auto pred = preds[p];
+          if (iDoms[pred] == InvalidIndex) {
+            // Not processed yet, or unreachable.
+            continue;
+          }
+          newIDom =
+            newIDom == InvalidIndex ? pred : intersect(newIDom, pred);
+        }
+        if (newIDom != iDoms[index]) {
+          iDoms[index] = newIDom;
+          changed = true;
+        }
+      }
+    }
+    iDoms[0] = InvalidIndex;
+  }
+};
+
+} // namespace wasm
+
+#endif // cfg_flat_cfg_h
@@ -23,7 +23,7 @@
 
 #include "cfg-traversal.h"
 #include "ir/utils.h"
-#include "support/sorted_vector.h"
+#include "support/index_set.h"
 #include "support/sparse_square_matrix.h"
 #include "wasm-builder.h"
 #include "wasm-traversal.h"
@@ -32,11 +32,11 @@
 namespace wasm {
 
 // A set of locals. This is optimized for comparisons,
-// mergings, and iteration on elements, assuming that there
-// may be a great many potential elements but actual sets
-// may be fairly small. Specifically, we use a sorted
-// vector.
-typedef SortedVector SetOfLocals;
+// mergings, and iteration on elements. Actual sets are
+// usually fairly small, and are stored as a sorted vector;
+// in functions with a great many locals they automatically
+// switch to a dense bitset (see IndexSet).
+typedef IndexSet SetOfLocals;
 
 // A liveness-relevant action. Supports a get, a set, or an
 // "other" which can be used for other purposes, to mark
@@ -25,6 +25,8 @@
 #ifndef wasm_dataflow_graph_h
 #define wasm_dataflow_graph_h
 
+#include <deque>
+
 #include "dataflow/node.h"
 #include "ir/abstract.h"
 #include "ir/iteration.h"
@@ -71,8 +73,18 @@ struct Graph : public UnifiedExpressionVisitor<Graph, Node*> {
   // The module we are working in.
   Module* module;
 
-  // All of our nodes
-  std::vector<std::unique_ptr<Node>> nodes;
+  // If set, the arena to allocate the scratch expressions we create for
+  // nodes in (constants, flipped comparisons, uses). A read-only user like
+  // Souperify can point this at a pass-scoped arena that is dropped when the
+  // analysis is done, so the module's arena is not permanently grown. Users
+  // that may splice the created expressions into the module's IR (like
+  // DataFlowOpts) must leave this unset to use the module's arena.
+  MixedArena* scratchAllocator = nullptr;
+
+  // All of our nodes, stored in a pool: a deque gives stable addresses, so
+  // nodes are allocated in large chunks rather than one heap allocation
+  // each, while Node* pointers remain valid as more are added.
+  std::deque<Node> nodes;
 
   // Tracking state during building
 
@@ -130,6 +142,13 @@ struct Graph : public UnifiedExpressionVisitor<Graph, Node*> {
     visit(func->body);
   }
 
+  // Get a builder that allocates in the proper arena for the expressions we
+  // create, see scratchAllocator.
+  Builder getBuilder() {
+    return scratchAllocator ? Builder(*module, *scratchAllocator)
+                            : Builder(*module);
+  }
+
   // Makes a Var node, representing a value that could be anything.
   Node* makeVar(wasm::Type type) {
     if (isRelevantType(type)) {
@@ -148,7 +167,7 @@ struct Graph : public UnifiedExpressionVisitor<Graph, Node*> {
       return iter->second;
     }
     // Create one for this literal.
-    Builder builder(*module);
+    auto builder = getBuilder();
     auto* c = builder.makeConst(value);
     auto* ret = addNode(Node::makeExpr(c, c));
     constantNodes[value] = ret;
@@ -157,15 +176,15 @@ struct Graph : public UnifiedExpressionVisitor<Graph, Node*> {
 
   Node* makeZero(wasm::Type type) { return makeConst(Literal::makeZero(type)); }
 
-  // Add a new node to our list of owned nodes.
-  Node* addNode(Node* node) {
-    nodes.push_back(std::unique_ptr<Node>(node));
-    return node;
+  // Add a new node to our pool of owned nodes.
+  Node* addNode(Node&& node) {
+    nodes.push_back(std::move(node));
+    return &nodes.back();
   }
 
   Node* makeZeroComp(Node* node, bool equal, Expression* origin) {
     assert(!node->isBad());
-    Builder builder(*module);
+    auto builder = getBuilder();
     auto type = node->getWasmType();
     if (!type.isConcrete()) {
       return &bad;
@@ -347,7 +366,7 @@ struct Graph : public UnifiedExpressionVisitor<Graph, Node*> {
         // the loop body, replace references to the Var with the
         // previous value (the value that is all we need instead of a phi).
         for (auto j = firstNodeFromLoop; j < nodes.size(); j++) {
-          for (auto*& value : nodes[j].get()->values) {
+          for (auto*& value : nodes[j].values) {
             if (value == var) {
               value = proper;
             }
@@ -524,7 +543,7 @@ struct Graph : public UnifiedExpressionVisitor<Graph, Node*> {
       case GeUInt32:
       case GeUInt64: {
         // These need to be flipped as Souper does not support redundant ops.
-        Builder builder(*module);
+        auto builder = getBuilder();
         BinaryOp opposite;
         switch (curr->op) {
           case GtSInt32:
@@ -768,7 +787,7 @@ struct Graph : public UnifiedExpressionVisitor<Graph, Node*> {
   // Creates an expression that uses a node. Generally, a node represents
   // a value in a local, so we create a local.get for it.
   Expression* makeUse(Node* node) {
-    Builder builder(*module);
+    auto builder = getBuilder();
     if (node->isPhi()) {
       // The index is the wasm local that we assign to when implementing
       // the phi; get from there.
@@ -786,7 +805,7 @@ struct Graph : public UnifiedExpressionVisitor<Graph, Node*> {
     } else if (node->isVar()) {
       // Nothing valid for us to read here. Emit a call, representing an unknown
       // variable value.
-      return Builder(*module).makeCall(FAKE_CALL, {}, node->wasmType);
+      return getBuilder().makeCall(FAKE_CALL, {}, node->wasmType);
     } else {
       WASM_UNREACHABLE("unexpected node type"); // TODO
     }
@@ -103,45 +103,40 @@ struct Node {
   // For Zext, this is the value we extend.
   std::vector<Node*> values;
 
-  // Constructors
-  static Node* makeVar(wasm::Type wasmType) {
-    Node* ret = new Node(Var);
-    ret->wasmType = wasmType;
+  // Constructors. These return nodes by value; Graph::addNode places them in
+  // its pool, which avoids a heap allocation per node.
+  static Node makeVar(wasm::Type wasmType) {
+    Node ret(Var);
+    ret.wasmType = wasmType;
     return ret;
   }
-  static Node* makeExpr(Expression* expr, Expression* origin) {
-    Node* ret = new Node(Expr);
-    ret->expr = expr;
-    ret->origin = origin;
+  static Node makeExpr(Expression* expr, Expression* origin) {
+    Node ret(Expr);
+    ret.expr = expr;
+    ret.origin = origin;
     return ret;
   }
-  static Node* makePhi(Node* block, Index index) {
-    Node* ret = new Node(Phi);
-    ret->addValue(block);
-    ret->index = index;
+  static Node makePhi(Node* block, Index index) {
+    Node ret(Phi);
+    ret.addValue(block);
+    ret.index = index;
     return ret;
   }
-  static Node* makeCond(Node* block, Index index, Node* node) {
-    Node* ret = new Node(Cond);
-    ret->addValue(block);
-    ret->index = index;
-    ret->addValue(node);
+  static Node makeCond(Node* block, Index index, Node* node) {
+    Node ret(Cond);
+    ret.addValue(block);
+    ret.index = index;
+    ret.addValue(node);
     return ret;
   }
-  static Node* makeBlock() {
-    Node* ret = new Node(Block);
-    return ret;
-  }
-  static Node* makeZext(Node* child, Expression* origin) {
-    Node* ret = new Node(Zext);
-    ret->addValue(child);
-    ret->origin = origin;
-    return ret;
-  }
-  static Node* makeBad() {
-    Node* ret = new Node(Bad);
+  static Node makeBlock() { return Node(Block); }
+  static Node makeZext(Node* child, Expression* origin) {
+    Node ret(Zext);
+    ret.addValue(child);
+    ret.origin = origin;
     return ret;
   }
+  static Node makeBad() { return Node(Bad); }
 
   // Helpers
 
@@ -41,8 +41,8 @@ class Users {
 public:
   void build(Graph& graph) {
     for (auto& node : graph.nodes) {
-      for (auto* value : node->values) {
-        users[value].insert(node.get());
+      for (auto* value : node.values) {
+        users[value].insert(&node);
       }
     }
   }
@@ -75,9 +75,9 @@ inline std::ostream& dump(Node* node, std::ostream& o, size_t indent = 0) {
 
 inline std::ostream& dump(Graph& graph, std::ostream& o) {
   for (auto& node : graph.nodes) {
-    o << "NODE " << node.get() << ": ";
-    dump(node.get(), o);
-    if (auto* set = graph.getSet(node.get())) {
+    o << "NODE " << &node << ": ";
+    dump(&node, o);
+    if (auto* set = graph.getSet(&node)) {
       o << "  and that is set to local " << set->index << '\n';
     }
   }
@@ -20,9 +20,14 @@
 #ifndef wasm_istring_h
 #define wasm_istring_h
 
+#include <array>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <assert.h>
 #include <stdint.h>
@@ -66,36 +71,76 @@ struct IString {
     set(s, reuse);
   }
 
-  void set(const char* s, bool reuse = true) {
-    typedef std::unordered_set<const char*, CStringHash, CStringEqual>
-      StringSet;
-    // one global store of strings per thread, we must not access this
-    // in parallel
+private:
+  typedef std::unordered_set<const char*, CStringHash, CStringEqual> StringSet;
+
+  // The global store of strings is sharded by the string's hash, so that
+  // threads creating new strings in parallel mostly take different locks.
+  static const size_t NumShards = 16;
+
+  struct Shard {
+    std::mutex mutex;
+    // The canonical set of strings in this shard; we allocate each string
+    // exactly once.
+    StringSet strings;
+    // Storage for the strings we had to copy (when reuse was not possible).
+    std::vector<std::unique_ptr<std::string>> allocated;
+  };
+
+  static Shard& getShard(size_t digest) {
+    static Shard shards[NumShards];
+    return shards[digest % NumShards];
+  }
+
+  // The local cache of interned strings on each thread, which lets us avoid
+  // taking any lock for strings this thread has already seen.
+  static StringSet& getLocalStrings() {
     thread_local static StringSet strings;
+    return strings;
+  }
 
-    auto existing = strings.find(s);
+  // Interns a string in the global store, allocating a copy if needed (when
+  // |reuse| is false). |digest| must be hash_c(s); it selects the shard, whose
+  // lock we take.
+  static const char* internGlobal(const char* s, bool reuse, size_t digest) {
+    auto& shard = getShard(digest);
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    auto globalExisting = shard.strings.find(s);
+    if (globalExisting != shard.strings.end()) {
+      return *globalExisting;
+    }
+    if (!reuse) {
+      shard.allocated.emplace_back(wasm::make_unique<std::string>(s));
+      s = shard.allocated.back()->c_str(); // we'll never modify it, so this
+                                           // is ok
+    }
+    shard.strings.insert(s);
+    return s;
+  }
 
-    if (existing == strings.end()) {
-      // if the string isn't already known, we must use a single global
-      // storage location, guarded by a mutex, so each string is allocated
-      // exactly once
-      static std::mutex mutex;
-      std::unique_lock<std::mutex> lock(mutex);
-      // a single global set contains the actual strings, so we allocate each
-      // one exactly once.
-      static StringSet globalStrings;
-      auto globalExisting = globalStrings.find(s);
-      if (globalExisting == globalStrings.end()) {
-        if (!reuse) {
-          static std::vector<std::unique_ptr<std::string>> allocated;
-          allocated.emplace_back(wasm::make_unique<std::string>(s));
-          s = allocated.back()->c_str(); // we'll never modify it, so this is ok
-        }
-        // insert into global set
-        globalStrings.insert(s);
-      } else {
-        s = *globalExisting;
+public:
+  // The number of interned strings and an estimate of the bytes they retain
+  // (the characters plus the store's entries), for memory reports. Takes
+  // each shard's lock.
+  static std::pair<size_t, size_t> getInternedMemory() {
+    size_t count = 0;
+    size_t bytes = 0;
+    for (size_t i = 0; i < NumShards; i++) {
+      auto& shard = getShard(i);
+      std::unique_lock<std::mutex> lock(shard.mutex);
+      count += shard.strings.size();
+      for (auto* str : shard.strings) {
+        bytes += strlen(str) + 1 + sizeof(const char*);
       }
+    }
+    return {count, bytes};
+  }
+
+  void set(const char* s, bool reuse = true) {
+    auto& strings = getLocalStrings();
+    auto existing = strings.find(s);
+    if (existing == strings.end()) {
+      s = internGlobal(s, reuse, hash_c(s));
       // add the string to our thread-local set
       strings.insert(s);
     } else {
@@ -105,6 +150,50 @@ struct IString {
     str = s;
   }
 
+  // Interns a batch of strings at once. The new strings are grouped by shard,
+  // so that each shard's lock is taken at most once for the entire batch
+  // rather than once per new string - useful when reading a large name
+  // section, say. The strings are copied as needed (as with reuse=false), and
+  // returned in the input order.
+  static std::vector<IString> internBatch(const std::vector<std::string>& in) {
+    std::vector<IString> out(in.size());
+    auto& strings = getLocalStrings();
+    // Find which strings this thread has not seen before, grouped by shard.
+    std::vector<size_t> digests(in.size());
+    std::array<std::vector<size_t>, NumShards> misses;
+    for (size_t i = 0; i < in.size(); i++) {
+      const char* s = in[i].c_str();
+      auto existing = strings.find(s);
+      if (existing != strings.end()) {
+        out[i].str = *existing;
+      } else {
+        digests[i] = hash_c(s);
+        misses[digests[i] % NumShards].push_back(i);
+      }
+    }
+    for (auto& group : misses) {
+      if (group.empty()) {
+        continue;
+      }
+      auto& shard = getShard(digests[group[0]]);
+      std::unique_lock<std::mutex> lock(shard.mutex);
+      for (auto i : group) {
+        const char* s = in[i].c_str();
+        auto globalExisting = shard.strings.find(s);
+        if (globalExisting != shard.strings.end()) {
+          s = *globalExisting;
+        } else {
+          shard.allocated.emplace_back(wasm::make_unique<std::string>(in[i]));
+          s = shard.allocated.back()->c_str();
+          shard.strings.insert(s);
+        }
+        out[i].str = s;
+        strings.insert(s);
+      }
+    }
+    return out;
+  }
+
   void set(const IString& s) { str = s.str; }
 
   void clear() { str = nullptr; }
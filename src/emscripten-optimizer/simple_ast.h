@@ -563,6 +563,9 @@ struct JSPrinter {
   ~JSPrinter() { free(buffer); }
 
   void printAst() {
+    // Allocate the buffer near its final size up front, which avoids most of
+    // the realloc (and copy) traffic while emitting a large module.
+    ensure(roughSize(ast));
     print(ast);
     ensure(1);
     buffer[used] = 0;
@@ -570,7 +573,35 @@ struct JSPrinter {
 
   // Utils
 
-  void ensure(int safety = 100) {
+  // A rough estimate of the printed size of a node. This does not need to be
+  // precise: an underestimate just means a few reallocs as we emit.
+  static size_t roughSize(Ref node) {
+    if (node->isString()) {
+      return strlen(node->getCString()) + 1;
+    }
+    if (node->isNumber()) {
+      return 24;
+    }
+    if (node->isAssign()) {
+      auto* assign = node->asAssign();
+      return roughSize(assign->target()) + roughSize(assign->value()) + 3;
+    }
+    if (node->isAssignName()) {
+      auto* assign = node->asAssignName();
+      return strlen(assign->target().c_str()) + roughSize(assign->value()) + 3;
+    }
+    if (node->isArray()) {
+      // The elements, plus separators, newlines and indentation.
+      size_t ret = 4;
+      for (size_t i = 0; i < node->size(); i++) {
+        ret += roughSize(node[i]) + 4;
+      }
+      return ret;
+    }
+    return 8;
+  }
+
+  void ensure(size_t safety = 100) {
     if (size >= used + safety) {
       return;
     }
@@ -601,14 +632,19 @@ struct JSPrinter {
     buffer[used++] = c;
   }
 
-  void emit(const char* s) {
+  void emit(const char* s, size_t len) {
     maybeSpace(*s);
-    int len = strlen(s);
     ensure(len + 1);
-    strncpy(buffer + used, s, len + 1);
+    memcpy(buffer + used, s, len);
     used += len;
   }
 
+  void emit(const char* s) { emit(s, strlen(s)); }
+
+  // String literals are extremely common, and their length is known at compile
+  // time, so avoid the strlen on them.
+  template<size_t N> void emit(const char (&s)[N]) { emit(s, N - 1); }
+
   void newline() {
     if (!pretty) {
       return;
@@ -19,30 +19,32 @@
 
 namespace wasm::ExpressionManipulator {
 
-Expression*
-flexibleCopy(Expression* original, Module& wasm, CustomCopier custom) {
-  // Perform the copy using a stack of tasks (avoiding recusion).
+// Perform the copy using a stack of tasks (avoiding recusion). Templated on
+// the copier so that the common case of a plain copy, with no custom hook,
+// compiles down to a simple loop with no indirect call per node.
+template<typename Copier>
+static Expression* doCopy(Expression* original, Module& wasm, Copier custom) {
   struct CopyTask {
     // The thing to copy.
     Expression* original;
     // The location of the pointer to write the copy to.
     Expression** destPointer;
   };
-  std::vector<CopyTask> tasks;
+  SmallVector<CopyTask, 10> tasks;
   Expression* ret;
   tasks.push_back({original, &ret});
   while (!tasks.empty()) {
     auto task = tasks.back();
     tasks.pop_back();
     // If the custom copier handled this one, we have nothing to do.
-    auto* copy = custom(task.original);
+    Expression* copy = custom(task.original);
     if (copy) {
       *task.destPointer = copy;
       continue;
     }
     // If the original is a null, just copy that. (This can happen for an
     // optional child.)
-    auto* original = task.original;
+    Expression* original = task.original;
     if (original == nullptr) {
       *task.destPointer = nullptr;
       continue;
@@ -110,6 +112,15 @@ flexibleCopy(Expression* original, Module& wasm, CustomCopier custom) {
   return ret;
 }
 
+Expression*
+flexibleCopy(Expression* original, Module& wasm, CustomCopier custom) {
+  return doCopy(original, wasm, custom);
+}
+
+Expression* copy(Expression* original, Module& wasm) {
+  return doCopy(original, wasm, [](Expression* curr) { return nullptr; });
+}
+
 // Splice an item into the middle of a block's list
 void spliceIntoBlock(Block* block, Index index, Expression* add) {
   block->list.insertAt(index, add);
@@ -39,10 +39,14 @@ struct Flower : public CFGWalker<Flower, Visitor<Flower>, Info> {
   LocalGraph::GetSetses& getSetses;
   LocalGraph::Locations& locations;
 
+  // If set, only track gets and sets of indexes passing the filter.
+  std::function<bool(Index)> filter;
+
   Flower(LocalGraph::GetSetses& getSetses,
          LocalGraph::Locations& locations,
-         Function* func)
-    : getSetses(getSetses), locations(locations) {
+         Function* func,
+         std::function<bool(Index)> filter)
+    : getSetses(getSetses), locations(locations), filter(std::move(filter)) {
     setFunction(func);
     // create the CFG by walking the IR
     CFGWalker<Flower, Visitor<Flower>, Info>::doWalkFunction(func);
@@ -60,6 +64,9 @@ struct Flower : public CFGWalker<Flower, Visitor<Flower>, Info> {
     if (!self->currBasicBlock) {
       return;
     }
+    if (self->filter && !self->filter(curr->index)) {
+      return;
+    }
     self->currBasicBlock->contents.actions.emplace_back(curr);
     self->locations[curr] = currp;
   }
@@ -70,6 +77,11 @@ struct Flower : public CFGWalker<Flower, Visitor<Flower>, Info> {
     if (!self->currBasicBlock) {
       return;
     }
+    // A filtered-out set need not be tracked: no tracked get flows to it, and
+    // stopping a flow at it is only relevant for its own (filtered) index.
+    if (self->filter && !self->filter(curr->index)) {
+      return;
+    }
     self->currBasicBlock->contents.actions.emplace_back(curr);
     self->currBasicBlock->contents.lastSets[curr->index] = curr;
     self->locations[curr] = currp;
@@ -227,8 +239,10 @@ struct Flower : public CFGWalker<Flower, Visitor<Flower>, Info> {
 
 // LocalGraph implementation
 
-LocalGraph::LocalGraph(Function* func) : func(func) {
-  LocalGraphInternal::Flower flower(getSetses, locations, func);
+LocalGraph::LocalGraph(Function* func, std::function<bool(Index)> filter)
+  : func(func) {
+  LocalGraphInternal::Flower flower(
+    getSetses, locations, func, std::move(filter));
 
 #ifdef LOCAL_GRAPH_DEBUG
   std::cout << "LocalGraph::dump\n";
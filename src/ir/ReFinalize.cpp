@@ -30,7 +30,8 @@ namespace {
 // target name, give it a value which is unreachable.
 template<typename T>
 void handleBranchForVisitBlock(T* curr, Name name, Module* module) {
-  if (BranchUtils::getUniqueTargets(curr).count(name)) {
+  if (BranchUtils::getUniqueTargets<BranchUtils::SmallNameSet>(curr).count(
+        name)) {
     assert(!curr->value);
     Builder builder(*module);
     curr->value = builder.makeUnreachable();
@@ -241,4 +242,37 @@ void ReFinalize::replaceUntaken(Expression* value, Expression* condition) {
   replaceCurrent(replacement);
 }
 
+void DeferredReFinalize::apply() {
+  if (dirty.empty()) {
+    return;
+  }
+  if (dirty.size() == 1) {
+    // No point spinning up threads for a single function.
+    ReFinalize().walkFunctionInModule(*dirty.begin(), &wasm);
+    dirty.clear();
+    return;
+  }
+  struct Applier : public WalkerPass<PostWalker<Applier>> {
+    bool isFunctionParallel() override { return true; }
+
+    bool modifiesBinaryenIR() override { return true; }
+
+    std::unordered_set<Function*>& dirty;
+
+    Applier(std::unordered_set<Function*>& dirty) : dirty(dirty) {}
+
+    Applier* create() override { return new Applier(dirty); }
+
+    void doWalkFunction(Function* func) {
+      if (dirty.count(func)) {
+        ReFinalize().walkFunctionInModule(func, getModule());
+      }
+    }
+  };
+  PassRunner runner(&wasm);
+  runner.setIsNested(true);
+  Applier(dirty).run(&runner, &wasm);
+  dirty.clear();
+}
+
 } // namespace wasm
@@ -18,6 +18,7 @@
 #define wasm_ir_branch_h
 
 #include "ir/iteration.h"
+#include "support/small_set.h"
 #include "wasm-traversal.h"
 #include "wasm.h"
 
@@ -134,8 +135,17 @@ template<typename T> void operateOnScopeNameDefs(Expression* expr, T func) {
 
 using NameSet = std::set<Name>;
 
-inline NameSet getUniqueTargets(Expression* expr) {
-  NameSet ret;
+// A fast set of names for when the number of branch targets is typically
+// small. Names are interned, so hashing and equality are pointer operations,
+// and the flexible storage avoids both the per-node allocations and the
+// strcmp-based ordering comparisons of a NameSet. Iteration order is not
+// deterministic past the fixed storage, however, so only use this for
+// membership queries and other order-insensitive operations; use NameSet
+// whenever the iteration order can affect the output.
+using SmallNameSet = SmallUnorderedSet<Name, 4>;
+
+template<typename SetT = NameSet> SetT getUniqueTargets(Expression* expr) {
+  SetT ret;
   operateOnScopeNameUses(expr, [&](Name& name) { ret.insert(name); });
   return ret;
 }
@@ -306,9 +316,27 @@ struct BranchSeeker
     if (!target.is()) {
       return false;
     }
-    BranchSeeker seeker(target);
-    seeker.walk(tree);
-    return seeker.found > 0;
+    // Walk manually rather than with a BranchSeeker, so that we can stop at
+    // the very first use we find. Name equality is a simple identity
+    // comparison, so the inner loop here is cheap. Note that, like count(),
+    // this looks for actual branches and not delegate or rethrow targets,
+    // which is why we check the uses that send types.
+    SmallVector<Expression*, 10> work;
+    work.push_back(tree);
+    while (!work.empty()) {
+      auto* curr = work.back();
+      work.pop_back();
+      bool found = false;
+      operateOnScopeNameUsesAndSentTypes(
+        curr, [&](Name& name, Type) { found = found || name == target; });
+      if (found) {
+        return true;
+      }
+      for (auto* child : ChildIterator(curr)) {
+        work.push_back(child);
+      }
+    }
+    return false;
   }
 
   static Index count(Expression* tree, Name target) {
@@ -325,10 +353,10 @@ struct BranchSeeker
 struct BranchAccumulator
   : public PostWalker<BranchAccumulator,
                       UnifiedExpressionVisitor<BranchAccumulator>> {
-  NameSet branches;
+  SmallNameSet branches;
 
   void visitExpression(Expression* curr) {
-    auto selfBranches = getUniqueTargets(curr);
+    auto selfBranches = getUniqueTargets<SmallNameSet>(curr);
     branches.insert(selfBranches.begin(), selfBranches.end());
   }
 };
@@ -341,16 +369,16 @@ struct BranchAccumulator
 // linearly increasing memory usage over time.
 class BranchSeekerCache {
   // Maps all the branches present in an expression and all its nested children.
-  std::unordered_map<Expression*, NameSet> branches;
+  std::unordered_map<Expression*, SmallNameSet> branches;
 
 public:
-  const NameSet& getBranches(Expression* curr) {
+  const SmallNameSet& getBranches(Expression* curr) {
     auto iter = branches.find(curr);
     if (iter != branches.end()) {
       return iter->second;
     }
-    NameSet currBranches;
-    auto add = [&](NameSet& moreBranches) {
+    SmallNameSet currBranches;
+    auto add = [&](SmallNameSet& moreBranches) {
       // Make sure to do a fast swap for the first set of branches to arrive.
       // This helps the case of the first child being a block with a very large
       // set of names.
@@ -378,7 +406,7 @@ public:
       }
     }
     // Finish with the parent's own branches.
-    auto selfBranches = getUniqueTargets(curr);
+    auto selfBranches = getUniqueTargets<SmallNameSet>(curr);
     add(selfBranches);
     return branches[curr] = std::move(currBranches);
   }
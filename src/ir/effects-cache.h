@@ -0,0 +1,138 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef wasm_ir_effects_cache_h
+#define wasm_ir_effects_cache_h
+
+#include "ir/effects.h"
+#include "ir/iteration.h"
+
+namespace wasm {
+
+// Caches the effects of expressions (including their children), so that
+// repeated analyses of the same unchanged expression become a hash lookup.
+// This matters in passes that analyze the same subtrees over and over as they
+// consider the nodes around them.
+//
+// The effects of a node are composed out of the cached effects of its
+// children plus a shallow visit of the node itself, rather than walking the
+// whole subtree again. With that, a cold query of a tree and all of its
+// subtrees does an amount of work linear in the tree size, rather than paying
+// for each node once per enclosing query.
+//
+// The user of the cache must call noteChange() after making any change to the
+// IR that a cached expression might observe. We cannot invalidate
+// automatically: there is no central point through which all IR mutation flows
+// (passes commonly write to the fields of a node directly, in addition to
+// using replaceCurrent etc.), so any automatic hook in the walkers would miss
+// changes. noteChange() invalidates the entire cache by bumping a generation
+// counter that entries are checked against, which is cheaper than eagerly
+// clearing the map. That is coarse, but a change to a child changes the
+// effects of all of its ancestors as well, and without parent links we could
+// not invalidate more precisely anyhow.
+class EffectsCache {
+public:
+  EffectsCache(const PassOptions& passOptions, Module& module)
+    : passOptions(passOptions), module(module) {}
+
+  // Gets the effects of an expression and its children, computing and caching
+  // them if they are not already cached.
+  const EffectAnalyzer& get(Expression* curr) {
+    if (auto* effects = find(curr)) {
+      return *effects;
+    }
+    // Compute the effects of each uncached node in the subtree, children
+    // before parents, so that each node can be composed out of its children.
+    // We iterate rather than recurse, as expressions can be deeply nested.
+    // The boolean tracks whether we already expanded a node's children.
+    std::vector<std::pair<Expression*, bool>> work;
+    work.push_back({curr, false});
+    while (!work.empty()) {
+      auto [node, childrenDone] = work.back();
+      if (childrenDone) {
+        work.pop_back();
+        compute(node);
+        continue;
+      }
+      if (find(node)) {
+        // Already cached (and fresh); nothing to do for this subtree.
+        work.pop_back();
+        continue;
+      }
+      work.back().second = true;
+      if (!node->is<Try>()) {
+        // (A try is not composed from its children, see compute().)
+        for (auto* child : ChildIterator(node)) {
+          work.push_back({child, false});
+        }
+      }
+    }
+    return *find(curr);
+  }
+
+  // Notes that the IR has changed, invalidating all cached effects.
+  void noteChange() { generation++; }
+
+private:
+  struct Entry {
+    size_t generation;
+    EffectAnalyzer effects;
+  };
+
+  const PassOptions& passOptions;
+  Module& module;
+  std::unordered_map<Expression*, Entry> cache;
+  size_t generation = 0;
+
+  // Returns the cached effects of an expression, or nullptr if they are not
+  // cached. A stale entry from before the last noteChange() is erased.
+  const EffectAnalyzer* find(Expression* curr) {
+    auto iter = cache.find(curr);
+    if (iter != cache.end()) {
+      if (iter->second.generation == generation) {
+        return &iter->second.effects;
+      }
+      cache.erase(iter);
+    }
+    return nullptr;
+  }
+
+  // Computes and caches the effects of a node whose children have already
+  // been cached by get().
+  void compute(Expression* curr) {
+    auto result = cache.emplace(
+      curr, Entry{generation, EffectAnalyzer(passOptions, module)});
+    auto& effects = result.first->second.effects;
+    if (curr->is<Try>()) {
+      // Exception scoping means a try cannot be composed out of its parts: a
+      // catch_all absorbs throws from the body, and a delegate's target is
+      // scoped to the enclosing tries. Do a full walk of the subtree instead,
+      // which handles all of that.
+      effects.walk(curr);
+      return;
+    }
+    for (auto* child : ChildIterator(curr)) {
+      auto* childEffects = find(child);
+      assert(childEffects);
+      effects.mergeIn(*childEffects);
+    }
+    effects.visitAfterChildren(curr);
+  }
+};
+
+} // namespace wasm
+
+#endif // wasm_ir_effects_cache_h
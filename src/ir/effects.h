@@ -31,7 +31,8 @@ public:
                  Module& module,
                  Expression* ast = nullptr)
     : ignoreImplicitTraps(passOptions.ignoreImplicitTraps),
-      trapsNeverHappen(passOptions.trapsNeverHappen), module(module),
+      trapsNeverHappen(passOptions.trapsNeverHappen),
+      funcEffectsMap(passOptions.funcEffectsMap), module(module),
       features(module.features) {
     if (ast) {
       walk(ast);
@@ -40,6 +41,7 @@ public:
 
   bool ignoreImplicitTraps;
   bool trapsNeverHappen;
+  std::shared_ptr<FuncEffectsMap> funcEffectsMap;
   Module& module;
   FeatureSet features;
 
@@ -57,6 +59,69 @@ public:
     post();
   }
 
+  // Visit an expression, without any children, preserving all state gathered
+  // so far. This allows composing the effects of an expression out of
+  // already-computed effects of its children: merge in each child, then visit
+  // the parent itself, which mirrors the order of a full post-order walk (in
+  // particular, a block or loop erases branches to its own name only after
+  // its children were processed). See EffectsCache.
+  void visitAfterChildren(Expression* ast) {
+    InternalAnalyzer(*this).visit(ast);
+    // Fold a possible implicit trap into our state, as post() does.
+    if (ignoreImplicitTraps) {
+      implicitTrap = false;
+    } else if (implicitTrap) {
+      trap = true;
+    }
+  }
+
+  // Walk an expression as walk() does, but check the given condition on the
+  // effects gathered so far after each node, and stop as soon as it holds.
+  // Returns whether it held. This is useful for boolean queries like "is
+  // there any effect at all in there?": most expressions that have an effect
+  // show one early in the walk, and analyzing the rest just to discard the
+  // details is wasteful. If the walk completes, the state here is identical
+  // to that of a full walk, and the condition is checked one last time on it.
+  template<typename Condition>
+  bool walkUntil(Expression* ast, Condition condition) {
+    pre();
+    // Run the exact tasks a full walk would, but one at a time, checking the
+    // condition after each.
+    InternalAnalyzer analyzer(*this);
+    analyzer.pushTask(InternalAnalyzer::scan, &ast);
+    while (analyzer.hasTasks()) {
+      auto task = analyzer.popTask();
+      task.func(&analyzer, task.currp);
+      // Fold a possible implicit trap into our state, as post() does.
+      if (ignoreImplicitTraps) {
+        implicitTrap = false;
+      } else if (implicitTrap) {
+        trap = true;
+      }
+      if (condition(*this)) {
+        // Branches and delegates to targets inside the expression only stop
+        // appearing external once the walk reaches their enclosing scope, so
+        // if the condition depends on them it may yet stop holding: keep
+        // walking in that case, and let the final state decide.
+        if (breakTargets.empty() && delegateTargets.empty()) {
+          return true;
+        }
+        auto savedBreaks = std::move(breakTargets);
+        auto savedDelegates = std::move(delegateTargets);
+        breakTargets.clear();
+        delegateTargets.clear();
+        bool holds = condition(*this);
+        breakTargets = std::move(savedBreaks);
+        delegateTargets = std::move(savedDelegates);
+        if (holds) {
+          return true;
+        }
+      }
+    }
+    post();
+    return condition(*this);
+  }
+
   // Core effect tracking
 
   // Definitely branches out of this expression, or does a return, etc.
@@ -262,7 +327,7 @@ public:
     return false;
   }
 
-  void mergeIn(EffectAnalyzer& other) {
+  void mergeIn(const EffectAnalyzer& other) {
     branchesOut = branchesOut || other.branchesOut;
     calls = calls || other.calls;
     readsMemory = readsMemory || other.readsMemory;
@@ -423,6 +488,25 @@ private:
         return;
       }
 
+      // If we know the target function's total effects, use those instead of
+      // assuming the worst.
+      if (parent.funcEffectsMap) {
+        auto iter = parent.funcEffectsMap->find(curr->target);
+        if (iter != parent.funcEffectsMap->end()) {
+          auto targetEffects = iter->second;
+          if (parent.tryDepth > 0) {
+            // A throw from the target is caught by the try we are in, just as
+            // it would be for a call we analyze directly.
+            targetEffects.throws_ = false;
+          }
+          parent.mergeIn(targetEffects);
+          if (curr->isReturn) {
+            parent.branchesOut = true;
+          }
+          return;
+        }
+      }
+
       parent.calls = true;
       // When EH is enabled, any call can throw.
       if (parent.features.hasExceptionHandling() && parent.tryDepth == 0) {
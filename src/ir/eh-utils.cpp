@@ -16,7 +16,6 @@
 
 #include "ir/eh-utils.h"
 #include "ir/branch-utils.h"
-#include "ir/find_all.h"
 #include "ir/type-updating.h"
 
 namespace wasm {
@@ -107,8 +106,9 @@ bool containsValidDanglingPop(Expression* catchBody) {
   return pop != nullptr && !isPopNested;
 }
 
-void handleBlockNestedPop(Try* try_, Function* func, Module& wasm) {
+bool handleBlockNestedPop(Try* try_, Function* func, Module& wasm) {
   Builder builder(wasm);
+  bool addedLocals = false;
   for (Index i = 0; i < try_->catchTags.size(); i++) {
     Name tagName = try_->catchTags[i];
     auto* tag = wasm.getTag(tagName);
@@ -145,21 +145,50 @@ void handleBlockNestedPop(Try* try_, Function* func, Module& wasm) {
       try_->catchBodies[i] =
         builder.makeSequence(builder.makeLocalSet(newLocal, pop), catchBody);
       *popPtr = builder.makeLocalGet(newLocal, pop->type);
+      addedLocals = true;
     }
   }
+  return addedLocals;
 }
 
 void handleBlockNestedPops(Function* func, Module& wasm) {
   if (!wasm.features.hasExceptionHandling()) {
     return;
   }
-  FindAll<Try> trys(func->body);
-  for (auto* try_ : trys.list) {
-    handleBlockNestedPop(try_, func, wasm);
+  // Find the trys with a simple manual walk whose scratch state persists
+  // across calls. This is called once per function after several passes, and
+  // the overwhelmingly common case is a function with no EH, which should get
+  // in and out of here without allocating.
+  thread_local static SmallVector<Expression*, 64> work;
+  thread_local static std::vector<Try*> trys;
+  work.clear();
+  trys.clear();
+  work.push_back(func->body);
+  while (!work.empty()) {
+    auto* curr = work.back();
+    work.pop_back();
+    if (auto* try_ = curr->dynCast<Try>()) {
+      trys.push_back(try_);
+    }
+    for (auto* child : ChildIterator(curr)) {
+      work.push_back(child);
+    }
+  }
+  if (trys.empty()) {
+    return;
+  }
+  bool addedLocals = false;
+  for (auto* try_ : trys) {
+    if (handleBlockNestedPop(try_, func, wasm)) {
+      addedLocals = true;
+    }
   }
   // Pops we handled can be of non-defaultable types, so we may have created
-  // non-nullable type locals. Fix them.
-  TypeUpdating::handleNonDefaultableLocals(func, wasm);
+  // non-nullable type locals. Fix them. If we added nothing there is nothing
+  // to fix.
+  if (addedLocals) {
+    TypeUpdating::handleNonDefaultableLocals(func, wasm);
+  }
 }
 
 Pop* findPop(Expression* expr) {
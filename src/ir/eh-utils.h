@@ -35,10 +35,13 @@ bool containsValidDanglingPop(Expression* catchBody);
 // Given a 'Try' expression, fixes up 'pop's nested in blocks, which are
 // currently not supported without block param types, by creating a new local,
 // putting a (local.set $new (pop type)) right after 'catch', and putting a
-// '(local.get $new)' where the 'pop' used to be.
-void handleBlockNestedPop(Try* try_, Function* func, Module& wasm);
+// '(local.get $new)' where the 'pop' used to be. Returns whether any local
+// was added.
+bool handleBlockNestedPop(Try* try_, Function* func, Module& wasm);
 
-// Calls handleBlockNestedPop for each 'Try's in a given function.
+// Calls handleBlockNestedPop for each 'Try's in a given function. This runs
+// after many passes, and most functions contain no EH at all, so the common
+// case returns without allocating anything.
 void handleBlockNestedPops(Function* func, Module& wasm);
 
 // Given a catch body, find the pop corresponding to the catch. There might be
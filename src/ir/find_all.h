@@ -17,6 +17,8 @@
 #ifndef wasm_ir_find_all_h
 #define wasm_ir_find_all_h
 
+#include <tuple>
+
 #include <wasm-traversal.h>
 
 namespace wasm {
@@ -44,6 +46,41 @@ template<typename T> struct FindAll {
   bool has() { return !list.empty(); }
 };
 
+// Find all instances of several node types in a single traversal. When more
+// than one type is wanted from the same expression, this avoids the repeated
+// walks that separate FindAlls would do. Results are read with list<T>():
+//
+//   FindAllOf<LocalGet, LocalSet> found(func->body);
+//   for (auto* get : found.list<LocalGet>()) { .. }
+//
+template<typename... Ts> struct FindAllOf {
+  std::tuple<std::vector<Ts*>...> lists;
+
+  FindAllOf(Expression* ast) {
+    struct Finder
+      : public PostWalker<Finder, UnifiedExpressionVisitor<Finder>> {
+      FindAllOf* parent;
+      void visitExpression(Expression* curr) {
+        (parent->note<Ts>(curr), ...);
+      }
+    };
+    Finder finder;
+    finder.parent = this;
+    finder.walk(ast);
+  }
+
+  template<typename T> std::vector<T*>& list() {
+    return std::get<std::vector<T*>>(lists);
+  }
+
+private:
+  template<typename T> void note(Expression* curr) {
+    if (curr->is<T>()) {
+      list<T>().push_back(curr->cast<T>());
+    }
+  }
+};
+
 // Find all pointers to instances of a certain node type
 
 struct PointerFinder
@@ -21,9 +21,58 @@
 #include "support/hash.h"
 #include "wasm.h"
 #include <functional>
+#include <unordered_set>
 
 namespace wasm {
 
+// An expression with a cached hash value.
+struct HashedExpression {
+  Expression* expr;
+  size_t digest;
+
+  HashedExpression(Expression* expr, size_t digest)
+    : expr(expr), digest(digest) {}
+
+  HashedExpression(const HashedExpression& other)
+    : expr(other.expr), digest(other.digest) {}
+};
+
+struct HEHasher {
+  size_t operator()(const HashedExpression hashed) const {
+    return hashed.digest;
+  }
+};
+
+// A full equality check for HashedExpressions. The hash is used as a speedup,
+// but if it matches we still verify the contents are identical.
+struct HEComparer {
+  bool operator()(const HashedExpression a, const HashedExpression b) const {
+    if (a.digest != b.digest) {
+      return false;
+    }
+    return ExpressionAnalyzer::equal(a.expr, b.expr);
+  }
+};
+
+// An intern table for expressions: structurally identical expressions map to
+// a single canonical representative, the first one interned. After interning,
+// an equality check between two canonical expressions is just a pointer
+// compare, which is useful for analyses that repeatedly compare the same
+// subtrees (like duplicated initializers across many globals). The interner
+// never modifies the IR. It caches hashes, so it must only be used while the
+// expressions involved are not being modified.
+struct ExpressionInterner {
+  // Returns the canonical expression for the given one, which is the first
+  // expression we saw that is structurally identical to it.
+  Expression* intern(Expression* expr) {
+    auto digest = ExpressionAnalyzer::hash(expr);
+    return canonicals.insert(HashedExpression(expr, digest)).first->expr;
+  }
+
+private:
+  std::unordered_set<HashedExpression, HEHasher, HEComparer> canonicals;
+};
+
 // A pass that hashes all functions
 
 struct FunctionHasher : public WalkerPass<PostWalker<FunctionHasher>> {
@@ -17,6 +17,8 @@
 #ifndef wasm_ir_local_graph_h
 #define wasm_ir_local_graph_h
 
+#include <functional>
+
 #include "support/small_set.h"
 #include "wasm.h"
 
@@ -33,8 +35,13 @@ namespace wasm {
 struct LocalGraph {
   // main API
 
-  // the constructor computes getSetses, the sets affecting each get
-  LocalGraph(Function* func);
+  // the constructor computes getSetses, the sets affecting each get. An
+  // optional filter restricts the graph to particular local indexes: gets
+  // and sets of other indexes are left out of the graph (and its locations)
+  // entirely. The cross-block flow is the dominant cost here and scales with
+  // the number of tracked accesses, so passes that only care about some
+  // locals should pass a filter rather than computing the full graph.
+  LocalGraph(Function* func, std::function<bool(Index)> filter = nullptr);
 
   // The local.sets relevant for an index or a get. The most common case is to
   // have a single set; after that, to be a phi of 2 items, so we use a small
@@ -53,14 +53,24 @@ bool flatten(Module& wasm) {
       return false;
     }
   }
+  // Compute the flattened size up front so we allocate the combined data
+  // exactly once, and free each segment's data as soon as it is copied in;
+  // repeatedly growing the combined data while keeping every source alive
+  // multiplies peak memory use on large modules.
+  Index totalSize = 0;
   for (auto& segment : dataSegments) {
     auto* offset = segment->offset->dynCast<Const>();
     Index start = offset->value.getInteger();
     Index end = start + segment->data.size();
-    if (end > data.size()) {
-      data.resize(end);
-    }
+    totalSize = std::max(totalSize, end);
+  }
+  data.resize(totalSize);
+  for (auto& segment : dataSegments) {
+    auto* offset = segment->offset->dynCast<Const>();
+    Index start = offset->value.getInteger();
     std::copy(segment->data.begin(), segment->data.end(), data.begin() + start);
+    segment->data.clear();
+    segment->data.shrink_to_fit();
   }
   dataSegments.resize(1);
   dataSegments[0]->offset->cast<Const>()->value = Literal(int32_t(0));
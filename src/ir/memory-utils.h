@@ -137,19 +137,32 @@ inline bool ensureLimitedSegments(Module& module) {
 
     auto combined = Builder::makeDataSegment();
     combined->offset = c;
+    // Compute the combined size up front so we allocate its data exactly
+    // once, rather than repeatedly growing (and copying) it.
+    size_t combinedSize = 0;
     for (Index j = i; j < dataSegments.size(); j++) {
       auto& segment = dataSegments[j];
       if (!isRelevant(*segment)) {
         continue;
       }
       auto offset = segment->offset->cast<Const>()->value.getInteger();
-      auto needed = offset + segment->data.size() - start;
-      if (combined->data.size() < needed) {
-        combined->data.resize(needed);
+      combinedSize =
+        std::max(combinedSize, size_t(offset - start) + segment->data.size());
+    }
+    combined->data.resize(combinedSize);
+    for (Index j = i; j < dataSegments.size(); j++) {
+      auto& segment = dataSegments[j];
+      if (!isRelevant(*segment)) {
+        continue;
       }
+      auto offset = segment->offset->cast<Const>()->value.getInteger();
       std::copy(segment->data.begin(),
                 segment->data.end(),
                 combined->data.begin() + (offset - start));
+      // Free each source's data as soon as it is copied in, so that peak
+      // memory is not the sum of both copies of everything.
+      segment->data.clear();
+      segment->data.shrink_to_fit();
     }
     mergedSegments.push_back(std::move(combined));
     break;
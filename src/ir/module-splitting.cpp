@@ -655,6 +655,58 @@ void ModuleSplitter::shareImportableItems() {
   }
 }
 
+// Rewrites indirect calls through table slots whose placeholders have been
+// patched with their real functions back into direct calls. The call targets
+// to match are the expressions Slot::makeExpr produces: a constant, the
+// segment's base global, or the base global plus a constant.
+struct CallDirector : public WalkerPass<PostWalker<CallDirector>> {
+  using ResolvedSlots = std::map<std::tuple<Name, Name, Index>, Name>;
+
+  bool isFunctionParallel() override { return true; }
+
+  Pass* create() override { return new CallDirector(resolvedSlots); }
+
+  CallDirector(const ResolvedSlots& resolvedSlots)
+    : resolvedSlots(resolvedSlots) {}
+
+  // Avoid visitRefFunc on element segment data
+  void walkElementSegment(ElementSegment* segment) {}
+
+  void visitCallIndirect(CallIndirect* curr) {
+    Name base = "";
+    Index index = 0;
+    if (auto* c = curr->target->dynCast<Const>()) {
+      index = c->value.geti32();
+    } else if (auto* get = curr->target->dynCast<GlobalGet>()) {
+      base = get->name;
+    } else if (auto* add = curr->target->dynCast<Binary>()) {
+      auto* get = add->left->dynCast<GlobalGet>();
+      auto* c = add->right->dynCast<Const>();
+      if (add->op != AddInt32 || !get || !c) {
+        return;
+      }
+      base = get->name;
+      index = c->value.geti32();
+    } else {
+      return;
+    }
+    auto it = resolvedSlots.find({curr->table, base, index});
+    if (it == resolvedSlots.end()) {
+      return;
+    }
+    auto* func = getModule()->getFunction(it->second);
+    if (func->type != curr->heapType) {
+      return;
+    }
+    replaceCurrent(Builder(*getModule())
+                     .makeCall(func->name, curr->operands, curr->type,
+                               curr->isReturn));
+  }
+
+private:
+  const ResolvedSlots& resolvedSlots;
+};
+
 } // anonymous namespace
 
 Results splitFunctions(Module& primary, const Config& config) {
@@ -662,4 +714,62 @@ Results splitFunctions(Module& primary, const Config& config) {
   return {std::move(split.secondaryPtr), std::move(split.placeholderMap)};
 }
 
+void mergeBack(Module& primary, Module& secondary, const Config& config) {
+  // Find the placeholder imports in the primary module.
+  std::set<Name> placeholders;
+  for (auto& func : primary.functions) {
+    if (func->imported() && func->module == config.placeholderNamespace) {
+      placeholders.insert(func->name);
+    }
+  }
+
+  // Move the secondary functions back into the primary module, replacing the
+  // trampolines of the same name that splitting created for exported
+  // secondary functions. Imported items in the secondary module are stand-ins
+  // for primary items of the same internal name, so the copied code links up
+  // with the originals without any renaming.
+  for (auto& func : secondary.functions) {
+    if (func->imported()) {
+      continue;
+    }
+    if (primary.getFunctionOrNull(func->name)) {
+      primary.removeFunction(func->name);
+    }
+    ModuleUtils::copyFunction(func.get(), primary);
+  }
+
+  // Apply the secondary module's active element segments to the primary
+  // module's table, as instantiating the secondary module would, replacing
+  // placeholder references with the real functions. Placeholders not covered
+  // by this secondary module's patches belong to other split modules and are
+  // kept.
+  CallDirector::ResolvedSlots patches;
+  forEachElement(secondary,
+                 [&](Name table, Name base, Index index, Name& elem) {
+                   patches[{table, base, index}] = elem;
+                 });
+  CallDirector::ResolvedSlots resolvedSlots;
+  std::set<Name> resolvedPlaceholders;
+  forEachElement(primary, [&](Name table, Name base, Index index, Name& elem) {
+    if (!placeholders.count(elem)) {
+      return;
+    }
+    auto patch = patches.find({table, base, index});
+    if (patch == patches.end()) {
+      return;
+    }
+    resolvedPlaceholders.insert(elem);
+    resolvedSlots[{table, base, index}] = patch->second;
+    elem = patch->second;
+  });
+  for (auto placeholder : resolvedPlaceholders) {
+    primary.removeFunction(placeholder);
+  }
+
+  // Turn the indirect calls the splitter introduced for the now-resident
+  // functions back into direct calls.
+  PassRunner runner(&primary);
+  CallDirector(resolvedSlots).run(&runner, &primary);
+}
+
 } // namespace wasm::ModuleSplitting
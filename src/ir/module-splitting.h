@@ -74,6 +74,18 @@ struct Results {
 // Returns the new secondary module and modifies the `primary` module in place.
 Results splitFunctions(Module& primary, const Config& config);
 
+// Undoes the indirection introduced by splitFunctions: moves the functions of
+// a secondary module back into the primary module, applies the secondary
+// module's table patches to replace the placeholder references, and turns the
+// indirect calls through the patched slots back into direct calls. This is
+// useful for producing a single optimized artifact once it is known that the
+// secondary module will be resident, recovering the overhead of the permanent
+// trampolines. It assumes the patched table slots are not overwritten at
+// runtime. Placeholders belonging to other secondary modules are left in
+// place, as are the exports created by splitting, which other split modules
+// may still need.
+void mergeBack(Module& primary, Module& secondary, const Config& config);
+
 } // namespace wasm::ModuleSplitting
 
 #endif // wasm_ir_module_splitting_h
@@ -14,9 +14,15 @@
  * limitations under the License.
  */
 
+#include <atomic>
+
+#include "ir/names.h"
 #include "module-utils.h"
+#include "support/hash.h"
 #include "support/insert_ordered.h"
+#include "support/threads.h"
 #include "support/topological_sort.h"
+#include "wasm-binary.h"
 
 namespace wasm::ModuleUtils {
 
@@ -107,21 +113,45 @@ Counts getHeapTypeCounts(Module& wasm) {
     counts.note(curr->type);
   }
 
-  // Collect info from functions in parallel.
-  ModuleUtils::ParallelFunctionAnalysis<Counts, Immutable, InsertOrderedMap>
-    analysis(wasm, [&](Function* func, Counts& counts) {
-      counts.note(func->type);
+  // Collect info from functions in parallel. Each worker accumulates counts
+  // for a contiguous range of functions, so we allocate one set of counts per
+  // worker rather than one per function, and merging the workers' counts in
+  // order of their ranges gives the same deterministic insertion order as a
+  // serial walk of the functions, regardless of thread scheduling.
+  auto numWorkers = ThreadPool::get()->size();
+  auto numFunctions = wasm.functions.size();
+  std::vector<Counts> workerCounts(numWorkers);
+  auto doWork = [&](size_t worker) {
+    auto& workerCount = workerCounts[worker];
+    auto begin = worker * numFunctions / numWorkers;
+    auto end = (worker + 1) * numFunctions / numWorkers;
+    for (auto i = begin; i < end; i++) {
+      auto* func = wasm.functions[i].get();
+      workerCount.note(func->type);
       for (auto type : func->vars) {
-        counts.note(type);
+        workerCount.note(type);
       }
       if (!func->imported()) {
-        CodeScanner(wasm, counts).walk(func->body);
+        CodeScanner(wasm, workerCount).walk(func->body);
       }
-    });
+    }
+  };
+  if (numWorkers == 1) {
+    doWork(0);
+  } else {
+    std::vector<std::function<ThreadWorkState()>> doWorkers;
+    for (size_t worker = 0; worker < numWorkers; worker++) {
+      doWorkers.push_back([&doWork, worker]() {
+        doWork(worker);
+        return ThreadWorkState::Finished;
+      });
+    }
+    ThreadPool::get()->work(doWorkers);
+  }
 
-  // Combine the function info with the module info.
-  for (auto& [_, functionCounts] : analysis.map) {
-    for (auto& [sig, count] : functionCounts) {
+  // Combine the worker info with the module info.
+  for (auto& workerCount : workerCounts) {
+    for (auto& [sig, count] : workerCount) {
       counts[sig] += count;
     }
   }
@@ -185,6 +215,42 @@ void setIndices(IndexedHeapTypes& indexedTypes) {
 
 } // anonymous namespace
 
+CallSiteIndex::CallSiteIndex(Module& wasm) {
+  struct Info {
+    std::vector<Call*> calls;
+    std::vector<CallRef*> callRefs;
+    std::vector<CallIndirect*> callIndirects;
+  };
+
+  ParallelFunctionAnalysis<Info> analysis(
+    wasm, [&](Function* func, Info& info) {
+      if (func->imported()) {
+        return;
+      }
+      FindAllOf<Call, CallRef, CallIndirect> found(func->body);
+      info.calls = std::move(found.list<Call>());
+      info.callRefs = std::move(found.list<CallRef>());
+      info.callIndirects = std::move(found.list<CallIndirect>());
+    });
+
+  // Merge in module function order, so that the contents of the index do not
+  // depend on how the parallel analysis was scheduled.
+  for (auto& func : wasm.functions) {
+    auto& info = analysis.map[func.get()];
+    for (auto* call : info.calls) {
+      calls[call->target].push_back(call);
+    }
+    for (auto* callRef : info.callRefs) {
+      if (callRef->target->type != Type::unreachable) {
+        callRefs[callRef->target->type.getHeapType()].push_back(callRef);
+      }
+    }
+    for (auto* callIndirect : info.callIndirects) {
+      callIndirects[callIndirect->heapType].push_back(callIndirect);
+    }
+  }
+}
+
 std::vector<HeapType> collectHeapTypes(Module& wasm) {
   Counts counts = getHeapTypeCounts(wasm);
   std::vector<HeapType> types;
@@ -195,22 +261,30 @@ std::vector<HeapType> collectHeapTypes(Module& wasm) {
   return types;
 }
 
-IndexedHeapTypes getOptimizedIndexedHeapTypes(Module& wasm) {
+static IndexedHeapTypes getIndexedHeapTypesInternal(Module& wasm,
+                                                     bool optimized) {
   TypeSystem system = getTypeSystem();
   Counts counts = getHeapTypeCounts(wasm);
 
   if (system == TypeSystem::Equirecursive) {
-    // Sort by frequency and then original insertion order.
-    std::vector<std::pair<HeapType, size_t>> sorted(counts.begin(),
-                                                    counts.end());
-    std::stable_sort(sorted.begin(), sorted.end(), [&](auto a, auto b) {
-      return a.second > b.second;
-    });
-
-    // Collect the results.
     IndexedHeapTypes indexedTypes;
-    for (Index i = 0; i < sorted.size(); ++i) {
-      indexedTypes.types.push_back(sorted[i].first);
+    if (optimized) {
+      // Sort by frequency and then original insertion order.
+      std::vector<std::pair<HeapType, size_t>> sorted(counts.begin(),
+                                                      counts.end());
+      std::stable_sort(sorted.begin(), sorted.end(), [&](auto a, auto b) {
+        return a.second > b.second;
+      });
+
+      // Collect the results.
+      for (Index i = 0; i < sorted.size(); ++i) {
+        indexedTypes.types.push_back(sorted[i].first);
+      }
+    } else {
+      // Use the collection order directly.
+      for (auto& [type, _] : counts) {
+        indexedTypes.types.push_back(type);
+      }
     }
 
     setIndices(indexedTypes);
@@ -252,7 +326,9 @@ IndexedHeapTypes getOptimizedIndexedHeapTypes(Module& wasm) {
     // Try to initialize a new info or get the existing info.
     auto& info = groupInfos.insert({group, {groupInfos.size()}}).first->second;
     // Update the reference count.
-    info.useCount += counts.at(type);
+    if (optimized) {
+      info.useCount += counts.at(type);
+    }
     // Collect predecessor groups.
     switch (system) {
       case TypeSystem::Isorecursive:
@@ -327,4 +403,369 @@ IndexedHeapTypes getOptimizedIndexedHeapTypes(Module& wasm) {
   return indexedTypes;
 }
 
+IndexedHeapTypes getOptimizedIndexedHeapTypes(Module& wasm) {
+  return getIndexedHeapTypesInternal(wasm, true);
+}
+
+IndexedHeapTypes getIndexedHeapTypes(Module& wasm) {
+  return getIndexedHeapTypesInternal(wasm, false);
+}
+
+namespace {
+
+// Reads a LEB32 at |pos|, advancing it. Only used to skip over sizes and
+// counts; payload bytes are never decoded.
+uint32_t readLEB(const std::vector<uint8_t>& binary, size_t& pos) {
+  uint32_t result = 0;
+  int shift = 0;
+  while (pos < binary.size()) {
+    auto byte = binary[pos++];
+    result |= uint32_t(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) {
+      break;
+    }
+    shift += 7;
+  }
+  return result;
+}
+
+} // anonymous namespace
+
+BinaryDigests computeBinaryDigests(const std::vector<uint8_t>& binary) {
+  BinaryDigests digests;
+
+  // Find the byte ranges to hash: one per section, and one per function body
+  // in the code section.
+  struct Range {
+    size_t begin;
+    size_t end;
+    uint64_t* out;
+  };
+  std::vector<Range> ranges;
+
+  // Skip the magic number and version.
+  const size_t HeaderSize = 8;
+  size_t pos = std::min(HeaderSize, binary.size());
+  std::vector<size_t> sectionBegins, sectionEnds;
+  while (pos < binary.size()) {
+    auto id = binary[pos++];
+    auto size = readLEB(binary, pos);
+    auto begin = pos;
+    auto end = std::min(begin + size_t(size), binary.size());
+    digests.sections.emplace_back(id, 0);
+    sectionBegins.push_back(begin);
+    sectionEnds.push_back(end);
+    if (id == BinaryConsts::Section::Code) {
+      auto bodyPos = begin;
+      auto count = readLEB(binary, bodyPos);
+      for (uint32_t i = 0; i < count && bodyPos < end; i++) {
+        auto bodySize = readLEB(binary, bodyPos);
+        auto bodyEnd = std::min(bodyPos + size_t(bodySize), end);
+        digests.functions.push_back(0);
+        ranges.push_back({bodyPos, bodyEnd, nullptr});
+        bodyPos = bodyEnd;
+      }
+    }
+    pos = end;
+  }
+  // The vectors no longer grow, so we can record the output locations.
+  for (size_t i = 0; i < digests.sections.size(); i++) {
+    ranges.push_back(
+      {sectionBegins[i], sectionEnds[i], &digests.sections[i].second});
+  }
+  size_t nextFunc = 0;
+  for (auto& range : ranges) {
+    if (!range.out) {
+      range.out = &digests.functions[nextFunc++];
+    }
+  }
+
+  // Hash the ranges in parallel.
+  std::atomic<size_t> nextRange;
+  nextRange.store(0);
+  size_t numRanges = ranges.size();
+  size_t numWorkers = ThreadPool::get()->size();
+  std::vector<std::function<ThreadWorkState()>> doWorkers;
+  for (size_t i = 0; i < numWorkers; i++) {
+    doWorkers.push_back([&]() {
+      auto index = nextRange.fetch_add(1);
+      if (index >= numRanges) {
+        return ThreadWorkState::Finished;
+      }
+      auto& range = ranges[index];
+      *range.out =
+        fastHash(binary.data() + range.begin, range.end - range.begin);
+      return index + 1 == numRanges ? ThreadWorkState::Finished
+                                    : ThreadWorkState::More;
+    });
+  }
+  ThreadPool::get()->work(doWorkers);
+
+  // The module digest covers the header and every section digest, so it
+  // changes iff some section's bytes do, without a second pass over the
+  // binary.
+  FastHasher hasher;
+  hasher.update(binary.data(), std::min(HeaderSize, binary.size()));
+  for (auto& [id, digest] : digests.sections) {
+    hasher.update(&id, sizeof(id));
+    hasher.update(&digest, sizeof(digest));
+  }
+  digests.module = hasher.finish();
+  return digests;
+}
+
+namespace {
+
+// Updates every by-name (and by-index, for data segments) reference in a
+// module's code after merge renaming, see mergeModules.
+struct MergeNameUpdater : public PostWalker<MergeNameUpdater> {
+  const std::map<Name, Name>& functions;
+  const std::map<Name, Name>& globals;
+  const std::map<Name, Name>& tags;
+  const std::map<Name, Name>& tables;
+  Index dataOffset;
+
+  MergeNameUpdater(const std::map<Name, Name>& functions,
+                   const std::map<Name, Name>& globals,
+                   const std::map<Name, Name>& tags,
+                   const std::map<Name, Name>& tables,
+                   Index dataOffset)
+    : functions(functions), globals(globals), tags(tags), tables(tables),
+      dataOffset(dataOffset) {}
+
+  static void maybeUpdate(const std::map<Name, Name>& map, Name& name) {
+    auto iter = map.find(name);
+    if (iter != map.end()) {
+      name = iter->second;
+    }
+  }
+
+  void visitCall(Call* curr) { maybeUpdate(functions, curr->target); }
+  void visitRefFunc(RefFunc* curr) { maybeUpdate(functions, curr->func); }
+  void visitGlobalGet(GlobalGet* curr) { maybeUpdate(globals, curr->name); }
+  void visitGlobalSet(GlobalSet* curr) { maybeUpdate(globals, curr->name); }
+  void visitThrow(Throw* curr) { maybeUpdate(tags, curr->tag); }
+  void visitTry(Try* curr) {
+    for (auto& tag : curr->catchTags) {
+      maybeUpdate(tags, tag);
+    }
+  }
+  void visitCallIndirect(CallIndirect* curr) {
+    maybeUpdate(tables, curr->table);
+  }
+  void visitTableGet(TableGet* curr) { maybeUpdate(tables, curr->table); }
+  void visitTableSet(TableSet* curr) { maybeUpdate(tables, curr->table); }
+  void visitTableSize(TableSize* curr) { maybeUpdate(tables, curr->table); }
+  void visitTableGrow(TableGrow* curr) { maybeUpdate(tables, curr->table); }
+  void visitMemoryInit(MemoryInit* curr) { curr->segment += dataOffset; }
+  void visitDataDrop(DataDrop* curr) { curr->segment += dataOffset; }
+};
+
+} // anonymous namespace
+
+void mergeModules(std::vector<std::unique_ptr<Module>>&& inputs,
+                  Module& out) {
+  Builder builder(out);
+  for (auto& in : inputs) {
+    // Compute renames for everything whose name collides with what the
+    // output already holds. A fresh name must be free in both modules, as
+    // the input's own items are about to arrive in the output as well.
+    std::map<Name, Name> functions, globals, tags, tables;
+    auto rename = [&](auto& items,
+                      std::map<Name, Name>& map,
+                      auto getOrNull) {
+      for (auto& item : items) {
+        if ((out.*getOrNull)(item->name)) {
+          map[item->name] = Names::getValidName(item->name, [&](Name test) {
+            return !(out.*getOrNull)(test) && !(in.get()->*getOrNull)(test);
+          });
+        }
+      }
+    };
+    rename(in->functions, functions, &Module::getFunctionOrNull);
+    rename(in->globals, globals, &Module::getGlobalOrNull);
+    rename(in->tags, tags, &Module::getTagOrNull);
+    rename(in->tables, tables, &Module::getTableOrNull);
+
+    // Data segments in the output precede the input's, so indices in
+    // memory.init and data.drop shift by the current count.
+    Index dataOffset = out.dataSegments.size();
+
+    // Apply the renames and the segment index offset to the input, in its
+    // item declarations, exports and start, and throughout its code.
+    auto applyNames = [&](auto& items, const std::map<Name, Name>& map) {
+      for (auto& item : items) {
+        MergeNameUpdater::maybeUpdate(map, item->name);
+      }
+    };
+    applyNames(in->functions, functions);
+    applyNames(in->globals, globals);
+    applyNames(in->tags, tags);
+    applyNames(in->tables, tables);
+    for (auto& segment : in->elementSegments) {
+      MergeNameUpdater::maybeUpdate(tables, segment->table);
+      if (out.getElementSegmentOrNull(segment->name)) {
+        segment->name = Names::getValidElementSegmentName(out, segment->name);
+      }
+    }
+    for (auto& segment : in->dataSegments) {
+      if (out.getDataSegmentOrNull(segment->name)) {
+        auto valid = Names::getValidName(segment->name, [&](Name test) {
+          return !out.getDataSegmentOrNull(test);
+        });
+        segment->name = valid;
+      }
+    }
+    for (auto& exp : in->exports) {
+      if (exp->kind == ExternalKind::Function) {
+        MergeNameUpdater::maybeUpdate(functions, exp->value);
+      } else if (exp->kind == ExternalKind::Global) {
+        MergeNameUpdater::maybeUpdate(globals, exp->value);
+      } else if (exp->kind == ExternalKind::Tag) {
+        MergeNameUpdater::maybeUpdate(tags, exp->value);
+      } else if (exp->kind == ExternalKind::Table) {
+        MergeNameUpdater::maybeUpdate(tables, exp->value);
+      }
+    }
+    MergeNameUpdater::maybeUpdate(functions, in->start);
+    if (!functions.empty() || !globals.empty() || !tags.empty() ||
+        !tables.empty() || dataOffset) {
+      MergeNameUpdater updater(functions, globals, tags, tables, dataOffset);
+      updater.setModule(in.get());
+      for (auto& func : in->functions) {
+        if (!func->imported()) {
+          updater.walk(func->body);
+        }
+      }
+      updater.walkModuleCode(in.get());
+    }
+
+    // Source map file indices shift like data segment indices do.
+    if (!in->debugInfoFileNames.empty()) {
+      auto fileOffset = out.debugInfoFileNames.size();
+      if (fileOffset) {
+        for (auto& func : in->functions) {
+          for (auto& [_, loc] : func->debugLocations) {
+            loc.fileIndex += fileOffset;
+          }
+        }
+      }
+      out.debugInfoFileNames.insert(out.debugInfoFileNames.end(),
+                                    in->debugInfoFileNames.begin(),
+                                    in->debugInfoFileNames.end());
+    }
+
+    // Move everything over. This transfers ownership rather than copying:
+    // the IR stays in the input's arena, which we keep alive below.
+    for (auto& curr : in->functions) {
+      out.addFunction(std::move(curr));
+    }
+    for (auto& curr : in->globals) {
+      out.addGlobal(std::move(curr));
+    }
+    for (auto& curr : in->tags) {
+      out.addTag(std::move(curr));
+    }
+    for (auto& curr : in->tables) {
+      out.addTable(std::move(curr));
+    }
+    for (auto& curr : in->elementSegments) {
+      out.addElementSegment(std::move(curr));
+    }
+    for (auto& curr : in->dataSegments) {
+      out.addDataSegment(std::move(curr));
+    }
+    for (auto& curr : in->exports) {
+      if (out.getExportOrNull(curr->name)) {
+        Fatal() << "mergeModules: duplicate export: " << curr->name;
+      }
+      out.addExport(std::move(curr));
+    }
+
+    // At most one module may define a memory; modules that import theirs
+    // all refer to the single merged one.
+    if (in->memory.exists) {
+      if (!out.memory.exists) {
+        out.memory = in->memory;
+      } else if (!in->memory.imported()) {
+        if (!out.memory.imported()) {
+          Fatal() << "mergeModules: more than one module defines a memory";
+        }
+        out.memory = in->memory;
+      }
+    }
+
+    // If several modules have start functions, chain them in merge order.
+    if (in->start.is()) {
+      if (!out.start.is()) {
+        out.start = in->start;
+      } else {
+        auto name = Names::getValidFunctionName(out, "merged.start");
+        auto* chained = new Function();
+        chained->name = name;
+        chained->type = HeapType(Signature(Type::none, Type::none));
+        chained->body = builder.makeBlock(
+          {builder.makeCall(out.start, {}, Type::none),
+           builder.makeCall(in->start, {}, Type::none)});
+        out.addFunction(chained);
+        out.start = name;
+      }
+    }
+
+    for (auto& section : in->userSections) {
+      out.userSections.push_back(std::move(section));
+    }
+    out.features = FeatureSet(out.features | in->features);
+    out.hasFeaturesSection = out.hasFeaturesSection || in->hasFeaturesSection;
+    for (auto& [type, names] : in->typeNames) {
+      out.typeNames.insert({type, names});
+    }
+
+    // The moved IR still lives in the input's arena, and zero-copy user
+    // sections may refer into its input binary, so the input - and anything
+    // it was itself keeping alive - must outlive the output.
+    in->functions.clear();
+    in->globals.clear();
+    in->tags.clear();
+    in->tables.clear();
+    in->elementSegments.clear();
+    in->dataSegments.clear();
+    in->exports.clear();
+    in->userSections.clear();
+    in->updateMaps();
+    for (auto& absorbed : in->absorbedModules) {
+      out.absorbedModules.push_back(std::move(absorbed));
+    }
+    in->absorbedModules.clear();
+    out.absorbedModules.push_back(std::move(in));
+  }
+  inputs.clear();
+}
+
+void printMemoryReport(Module& wasm, std::ostream& o) {
+  o << "memory report (estimated bytes retained, by subsystem):\n";
+  o << "  IR arena:       " << wasm.allocator.totalAllocatedBytes() << '\n';
+  size_t listBytes = wasm.functions.size() * sizeof(Function) +
+                     wasm.exports.size() * sizeof(Export) +
+                     wasm.globals.size() * sizeof(Global) +
+                     wasm.tags.size() * sizeof(Tag) +
+                     wasm.tables.size() * sizeof(Table) +
+                     wasm.elementSegments.size() * sizeof(ElementSegment) +
+                     wasm.dataSegments.size() * sizeof(DataSegment);
+  o << "  module lists:   " << listBytes << " (" << wasm.functions.size()
+    << " functions, " << wasm.exports.size() << " exports)\n";
+  size_t dataBytes = 0;
+  for (auto& segment : wasm.dataSegments) {
+    dataBytes += segment->data.size();
+  }
+  o << "  segment data:   " << dataBytes << '\n';
+  auto types = getTypeSystemMemory();
+  o << "  type store:     " << types.typeBytes << " (" << types.types
+    << " types)\n";
+  o << "  heap types:     " << types.heapTypeBytes << " (" << types.heapTypes
+    << " heap types)\n";
+  auto [names, nameBytes] = Name::getInternedMemory();
+  o << "  interned names: " << nameBytes << " (" << names << " strings)\n";
+}
+
 } // namespace wasm::ModuleUtils
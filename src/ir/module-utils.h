@@ -22,6 +22,7 @@
 #include "ir/manipulation.h"
 #include "ir/properties.h"
 #include "pass.h"
+#include "support/threads.h"
 #include "support/unique_deferring_queue.h"
 #include "wasm.h"
 
@@ -147,16 +148,84 @@ inline void copyModule(const Module& in, Module& out) {
   out.memory = in.memory;
   out.start = in.start;
   out.userSections = in.userSections;
+  // Zero-copy user sections refer into the input binary; share it so the
+  // copies remain valid.
+  out.inputBinary = in.inputBinary;
   out.debugInfoFileNames = in.debugInfoFileNames;
   out.features = in.features;
   out.typeNames = in.typeNames;
 }
 
+// Copies a module like copyModule, but shares function bodies with the
+// original instead of deep-copying them, which makes the clone O(functions)
+// rather than O(expressions). This helps when clones are made constantly and
+// most functions are never touched, as in reduction or A/B pass experiments.
+// Shared bodies still live in |in|'s arena, so |in| must outlive |out|, and
+// before modifying a function in |out| the caller must give it a private copy
+// with unshareFunction() below.
+inline void copyModuleSharingFunctionBodies(const Module& in, Module& out) {
+  for (auto& func : in.functions) {
+    auto ret = std::make_unique<Function>();
+    ret->name = func->name;
+    ret->type = func->type;
+    ret->vars = func->vars;
+    ret->localNames = func->localNames;
+    ret->localIndices = func->localIndices;
+    ret->debugLocations = func->debugLocations;
+    ret->body = func->body;
+    ret->module = func->module;
+    ret->base = func->base;
+    assert(!func->stackIR);
+    out.addFunction(std::move(ret));
+  }
+  for (auto& curr : in.exports) {
+    out.addExport(new Export(*curr));
+  }
+  for (auto& curr : in.globals) {
+    copyGlobal(curr.get(), out);
+  }
+  for (auto& curr : in.tags) {
+    copyTag(curr.get(), out);
+  }
+  for (auto& curr : in.elementSegments) {
+    copyElementSegment(curr.get(), out);
+  }
+  for (auto& curr : in.tables) {
+    copyTable(curr.get(), out);
+  }
+  for (auto& curr : in.dataSegments) {
+    copyDataSegment(curr.get(), out);
+  }
+  out.memory = in.memory;
+  out.start = in.start;
+  out.userSections = in.userSections;
+  out.inputBinary = in.inputBinary;
+  out.debugInfoFileNames = in.debugInfoFileNames;
+  out.features = in.features;
+  out.typeNames = in.typeNames;
+}
+
+// Replaces a body shared by copyModuleSharingFunctionBodies with a private
+// deep copy owned by |out|. Call this before modifying the function.
+inline void unshareFunction(Function* func, Module& out) {
+  func->body = ExpressionManipulator::copy(func->body, out);
+}
+
 inline void clearModule(Module& wasm) {
   wasm.~Module();
   new (&wasm) Module;
 }
 
+// Merges a list of modules into |out|, in order, consuming them. Items are
+// moved rather than copied - the consumed inputs are kept alive inside |out|
+// (see Module::absorbedModules) as their arenas still own the IR. Names that
+// collide are made unique, and data segment indices in memory.init/data.drop
+// are offset to match the merged segment list; types need no work as they are
+// interned process-wide. Imports are not resolved against other inputs'
+// exports - callers that want linking semantics must do that afterwards. At
+// most one module may define a memory.
+void mergeModules(std::vector<std::unique_ptr<Module>>&& inputs, Module& out);
+
 // Renaming
 
 // Rename functions along with all their uses.
@@ -380,6 +449,70 @@ struct ParallelFunctionAnalysis {
   }
 };
 
+// The module-code counterpart of ParallelFunctionAnalysis: performs an
+// operation on every root expression outside of function bodies - global
+// initializers and element segment offsets and contents, the same set that
+// walkModuleCode visits - in parallel, with an Info object for each root.
+// The determinism guarantees are the same as well: each root has its own
+// pre-allocated entry, so the results do not depend on how roots are
+// scheduled onto threads. Modules that keep their data in very many globals
+// would otherwise process all of this serially.
+template<typename T,
+         Mutability Mut = Immutable,
+         template<typename, typename> class MapT = DefaultMap>
+struct ParallelModuleCodeAnalysis {
+  Module& wasm;
+
+  typedef MapT<Expression*, T> Map;
+  Map map;
+
+  typedef std::function<void(Expression*, T&)> Func;
+
+  ParallelModuleCodeAnalysis(Module& wasm, Func work) : wasm(wasm) {
+    // Gather the roots, and fill in the map before the parallel phase so
+    // that each worker only ever touches its own entries.
+    std::vector<Expression*> roots;
+    auto note = [&](Expression* root) {
+      if (!map.count(root)) {
+        map[root];
+        roots.push_back(root);
+      }
+    };
+    for (auto& global : wasm.globals) {
+      if (!global->imported()) {
+        note(global->init);
+      }
+    }
+    for (auto& segment : wasm.elementSegments) {
+      if (segment->offset) {
+        note(segment->offset);
+      }
+      for (auto* item : segment->data) {
+        note(item);
+      }
+    }
+
+    // Each worker claims the next unprocessed root. The roots are typically
+    // small and uniform (constants, at most small initializer expressions),
+    // so a shared counter balances the load well.
+    auto numWorkers = std::max<size_t>(ThreadPool::get()->size(), 1);
+    std::atomic<size_t> nextRoot{0};
+    std::vector<std::function<ThreadWorkState()>> doWorkers;
+    for (size_t worker = 0; worker < numWorkers; worker++) {
+      doWorkers.push_back([&]() {
+        auto i = nextRoot.fetch_add(1);
+        if (i >= roots.size()) {
+          return ThreadWorkState::Finished;
+        }
+        auto* root = roots[i];
+        work(root, map.find(root)->second);
+        return ThreadWorkState::More;
+      });
+    }
+    ThreadPool::get()->work(doWorkers);
+  }
+};
+
 // Helper class for analyzing the call graph.
 //
 // Provides hooks for running some initial calculation on each function (which
@@ -481,6 +614,45 @@ template<typename T> struct CallGraphPropertyAnalysis {
   }
 };
 
+// An index of all the call sites in a module: direct calls grouped by the
+// called function, and call_refs and call_indirects grouped by their heap
+// type. This is built with a single parallel walk that collects all three
+// kinds of call at once, so that interprocedural passes can look up the sites
+// they care about rather than writing their own collection code.
+//
+// The index points directly into the IR, so it is only valid while the IR it
+// was built from is unchanged: it must be built and consumed within a single
+// pass. (A persistent index shared between passes would be left dangling by
+// any pass in between that rewrites calls.) A pass that adds call sites while
+// using the index can keep it current with note(); a pass that removes or
+// replaces call sites must rebuild it.
+struct CallSiteIndex {
+  // Direct calls, grouped by the name of the function they call. The calls of
+  // each function appear in module function order, then in post-order inside
+  // each function, so the contents do not depend on thread scheduling.
+  std::unordered_map<Name, std::vector<Call*>> calls;
+
+  // call_refs, grouped by the heap type of the called reference. Unreachable
+  // call_refs have no heap type and are not indexed.
+  std::unordered_map<HeapType, std::vector<CallRef*>> callRefs;
+
+  // call_indirects, grouped by their declared heap type.
+  std::unordered_map<HeapType, std::vector<CallIndirect*>> callIndirects;
+
+  CallSiteIndex(Module& wasm);
+
+  // Note call sites created while the index is in use.
+  void note(Call* curr) { calls[curr->target].push_back(curr); }
+  void note(CallRef* curr) {
+    if (curr->target->type != Type::unreachable) {
+      callRefs[curr->target->type.getHeapType()].push_back(curr);
+    }
+  }
+  void note(CallIndirect* curr) {
+    callIndirects[curr->heapType].push_back(curr);
+  }
+};
+
 // Helper function for collecting all the non-basic heap types used in the
 // module, i.e. the types that would appear in the type section.
 std::vector<HeapType> collectHeapTypes(Module& wasm);
@@ -495,6 +667,36 @@ struct IndexedHeapTypes {
 // frequency of use to minimize code size.
 IndexedHeapTypes getOptimizedIndexedHeapTypes(Module& wasm);
 
+// As above, but without the frequency sorting: types appear in collection
+// order (grouped topologically where the type system requires it). Cheaper
+// to compute, at a small code-size cost; used for fast intermediate output.
+IndexedHeapTypes getIndexedHeapTypes(Module& wasm);
+
+// Digests of a serialized module: each section, and each function body in the
+// code section, hashed over the raw bytes in parallel (see fastHash in
+// support/hash.h), plus a module digest derived from the header and the
+// section digests. Lets tools checksum a module and its parts without
+// writing the binary anywhere or shelling out to a hashing tool.
+struct BinaryDigests {
+  uint64_t module = 0;
+
+  // (section id, digest), in binary order.
+  std::vector<std::pair<uint8_t, uint64_t>> sections;
+
+  // The digests of the function bodies in the code section, in order.
+  std::vector<uint64_t> functions;
+};
+
+BinaryDigests computeBinaryDigests(const std::vector<uint8_t>& binary);
+
+// Prints an estimate of the memory retained by a module and the global
+// stores backing it - the IR arena, the module's lists, the type stores,
+// and the interned name store - by subsystem. The numbers are estimates
+// meant for capacity planning and chasing RSS regressions, not exact
+// accounting; see MixedArena::allocatedBytes and Store::getMemory for what
+// is counted.
+void printMemoryReport(Module& wasm, std::ostream& o);
+
 } // namespace wasm::ModuleUtils
 
 #endif // wasm_ir_module_h
@@ -15,6 +15,7 @@
  */
 
 #include <optional>
+#include <set>
 #include <variant>
 
 #include "ir/branch-utils.h"
@@ -75,6 +76,48 @@ void PossibleContents::combine(const PossibleContents& other) {
     return;
   }
 
+  // Both sides are concrete, and different. These are the non-trivial
+  // combinations, which can compute heap type bounds, and the flow analysis
+  // re-sends the same hot pairs of contents across busy links many times, so
+  // memoize recent results. The cache is thread-local to avoid contention
+  // during the parallel graph-building phase, and bounded so that a large
+  // module cannot grow it without limit.
+  using CombineKey = std::pair<PossibleContents, PossibleContents>;
+  struct CombineKeyHasher {
+    size_t hashContents(const PossibleContents& contents) const {
+      // Nulls compare equal regardless of their type, so they must also hash
+      // alike here. (That is safe, as the combinations below never depend on
+      // a null's own heap type.)
+      if (contents.isNull()) {
+        return 0;
+      }
+      return contents.hash();
+    }
+    size_t operator()(const CombineKey& key) const {
+      auto digest = hashContents(key.first);
+      hash_combine(digest, hashContents(key.second));
+      return digest;
+    }
+  };
+  static thread_local std::
+    unordered_map<CombineKey, PossibleContents, CombineKeyHasher>
+      cache;
+  if (cache.size() >= (1 << 16)) {
+    cache.clear();
+  }
+  auto [iter, inserted] = cache.try_emplace(CombineKey{*this, other});
+  if (inserted) {
+    iter->second = combineConcrete(*this, other);
+  }
+  value = iter->second.value;
+}
+
+PossibleContents
+PossibleContents::combineConcrete(const PossibleContents& a,
+                                  const PossibleContents& b) {
+  auto type = a.getType();
+  auto otherType = b.getType();
+
   if (!type.isRef() || !otherType.isRef()) {
     // At least one is not a reference. The only possibility left for a useful
     // combination here is if they have the same type (since we've already ruled
@@ -82,33 +125,29 @@ void PossibleContents::combine(const PossibleContents& other) {
     // neither is a reference and we can emit an exact type (since subtyping is
     // not relevant for non-references.
     if (type == otherType) {
-      value = ExactType(type);
-    } else {
-      value = Many();
+      return exactType(type);
     }
-    return;
+    return many();
   }
 
   // Special handling for references from here.
 
   // Nulls are always equal to each other, even if their types differ.
-  if (isNull() || other.isNull()) {
-    // Only one of them can be null here, since we already checked if *this ==
-    // other, which would have been true had both been null.
-    assert(!isNull() || !other.isNull());
+  if (a.isNull() || b.isNull()) {
+    // Only one of them can be null here, since the caller already checked if
+    // a == b, which would have been true had both been null.
+    assert(!a.isNull() || !b.isNull());
     // If only one is a null, but the other's type is known exactly, then the
     // combination is to add nullability (if the type is *not* known exactly,
     // like for a global, then we cannot do anything useful here).
-    if (!isNull() && hasExactType()) {
-      value = ExactType(Type(type.getHeapType(), Nullable));
-      return;
-    } else if (!other.isNull() && other.hasExactType()) {
-      value = ExactType(Type(otherType.getHeapType(), Nullable));
-      return;
+    if (!a.isNull() && a.hasExactType()) {
+      return exactType(Type(type.getHeapType(), Nullable));
+    } else if (!b.isNull() && b.hasExactType()) {
+      return exactType(Type(otherType.getHeapType(), Nullable));
     }
   }
 
-  if (hasExactType() && other.hasExactType() &&
+  if (a.hasExactType() && b.hasExactType() &&
       type.getHeapType() == otherType.getHeapType()) {
     // We know the types here exactly, and even the heap types match, but
     // there is some other difference that prevents them from being 100%
@@ -116,14 +155,13 @@ void PossibleContents::combine(const PossibleContents& other) {
     // Literal; or both might be ExactTypes and only one might be nullable).
     // In these cases we can emit a proper ExactType here, adding nullability
     // if we need to.
-    value = ExactType(Type(
+    return exactType(Type(
       type.getHeapType(),
       type.isNullable() || otherType.isNullable() ? Nullable : NonNullable));
-    return;
   }
 
   // Nothing else possible combines in an interesting way; emit a Many.
-  value = Many();
+  return many();
 }
 
 namespace {
@@ -944,7 +982,10 @@ struct InfoCollector
 struct Flower {
   Module& wasm;
 
-  Flower(Module& wasm);
+  // |seeds| optionally warm-starts the flow from a previous analysis; see
+  // ContentOracle::getReusableContents.
+  Flower(Module& wasm,
+         const std::unordered_map<Location, PossibleContents>* seeds = nullptr);
 
   // Each LocationIndex will have one LocationInfo that contains the relevant
   // information we need for each location.
@@ -1035,12 +1076,40 @@ private:
   // possible is helpful as anything reading them meanwhile (before we get to
   // their work item in the queue) will see the newer value, possibly avoiding
   // flowing an old value that would later be overwritten.
+  //
+  // In the normal build the queue is ordered by a priority computed from the
+  // graph (see |priorities| below), so that locations near the sources of the
+  // graph tend to be processed before the locations they feed into. That does
+  // not change the result - updateContents is careful to converge to the same
+  // fixed point in any order - but it greatly reduces how often a location is
+  // re-flowed with contents that a later update would have superseded anyhow.
 #ifdef POSSIBLE_CONTENTS_INSERT_ORDERED
   InsertOrderedSet<LocationIndex> workQueue;
 #else
-  std::unordered_set<LocationIndex> workQueue;
+  // Pairs of {priority, location index}, so that begin() is the item with the
+  // lowest priority key (ties are broken by the index, deterministically).
+  std::set<std::pair<LocationIndex, LocationIndex>> workQueue;
 #endif
 
+  // A priority key for each location that existed when the initial graph was
+  // built: its position in a reverse post-order traversal of that graph, which
+  // is a topological order between the strongly-connected components (within a
+  // component - a cycle - the relative order is arbitrary, but any order
+  // converges there anyhow). Locations allocated later, during the flow
+  // itself, are not present here and simply use their own (high) index as a
+  // late key; see getPriority.
+  //
+  // Note that we only prioritize, and do not evaluate components in parallel:
+  // the graph is not fixed during the flow (connectDuringFlow and readFromData
+  // add links and even locations as contents arrive), so a component that
+  // looks independent up front may gain edges later, making any parallel
+  // schedule unsound.
+  std::vector<LocationIndex> priorities;
+
+  LocationIndex getPriority(LocationIndex index) {
+    return index < priorities.size() ? priorities[index] : index;
+  }
+
   // All existing links in the graph. We keep this to know when a link we want
   // to add is new or not.
   std::unordered_set<IndexLink> links;
@@ -1110,7 +1179,9 @@ private:
 #endif
 };
 
-Flower::Flower(Module& wasm) : wasm(wasm) {
+Flower::Flower(Module& wasm,
+               const std::unordered_map<Location, PossibleContents>* seeds)
+  : wasm(wasm) {
 #ifdef POSSIBLE_CONTENTS_DEBUG
   std::cout << "parallel phase\n";
 #endif
@@ -1276,6 +1347,50 @@ Flower::Flower(Module& wasm) : wasm(wasm) {
   }
 #endif
 
+#ifdef POSSIBLE_CONTENTS_DEBUG
+  std::cout << "priorities phase\n";
+#endif
+
+  // Compute the priority keys used to order the work queue: a reverse
+  // post-order of the graph we just built. We cannot use
+  // support/topological_sort.h here as that assumes an acyclic graph, while
+  // this graph has cycles (e.g. a local written from a read of itself through
+  // some other locations); a plain DFS post-order handles cycles gracefully,
+  // and reversing it gives a topological order between the cycles.
+  priorities.resize(locations.size());
+  // 0 = unvisited, 1 = on the stack, 2 = finished.
+  std::vector<uint8_t> visitState(locations.size(), 0);
+  // DFS entries are {location, next target to visit there}.
+  std::vector<std::pair<LocationIndex, size_t>> dfsStack;
+  std::vector<LocationIndex> postOrder;
+  postOrder.reserve(locations.size());
+  for (LocationIndex root = 0; root < locations.size(); root++) {
+    if (visitState[root]) {
+      continue;
+    }
+    visitState[root] = 1;
+    dfsStack.push_back({root, 0});
+    while (!dfsStack.empty()) {
+      auto& [curr, targetPos] = dfsStack.back();
+      auto& currTargets = locations[curr].targets;
+      if (targetPos < currTargets.size()) {
+        auto target = currTargets[targetPos++];
+        if (!visitState[target]) {
+          visitState[target] = 1;
+          dfsStack.push_back({target, 0});
+        }
+      } else {
+        visitState[curr] = 2;
+        postOrder.push_back(curr);
+        dfsStack.pop_back();
+      }
+    }
+  }
+  assert(postOrder.size() == locations.size());
+  for (size_t i = 0; i < postOrder.size(); i++) {
+    priorities[postOrder[i]] = LocationIndex(postOrder.size() - 1 - i);
+  }
+
 #ifdef POSSIBLE_CONTENTS_DEBUG
   std::cout << "roots phase\n";
 #endif
@@ -1293,6 +1408,16 @@ Flower::Flower(Module& wasm) : wasm(wasm) {
     updateContents(location, value);
   }
 
+  // Apply any seeds from a previous analysis, as additional roots. Note that
+  // new locations may be allocated here, for seeded locations that nothing in
+  // the current graph refers to (say, for a function that was removed); those
+  // simply keep their seeded contents and flow nowhere.
+  if (seeds) {
+    for (const auto& [location, value] : *seeds) {
+      updateContents(location, value);
+    }
+  }
+
 #ifdef POSSIBLE_CONTENTS_DEBUG
   std::cout << "flow phase\n";
   size_t iters = 0;
@@ -1308,7 +1433,11 @@ Flower::Flower(Module& wasm) : wasm(wasm) {
 #endif
 
     auto iter = workQueue.begin();
+#ifdef POSSIBLE_CONTENTS_INSERT_ORDERED
     auto locationIndex = *iter;
+#else
+    auto locationIndex = iter->second;
+#endif
     workQueue.erase(iter);
 
     flowAfterUpdate(locationIndex);
@@ -1382,7 +1511,11 @@ bool Flower::updateContents(LocationIndex locationIndex,
 #endif
 
   // Add a work item if there isn't already.
+#ifdef POSSIBLE_CONTENTS_INSERT_ORDERED
   workQueue.insert(locationIndex);
+#else
+  workQueue.insert({getPriority(locationIndex), locationIndex});
+#endif
 
   return worthSendingMore;
 }
@@ -1750,11 +1883,26 @@ void Flower::dump(Location location) {
 
 } // anonymous namespace
 
-void ContentOracle::analyze() {
-  Flower flower(wasm);
+void ContentOracle::analyze(
+  const std::unordered_map<Location, PossibleContents>* seeds) {
+  Flower flower(wasm, seeds);
   for (LocationIndex i = 0; i < flower.locations.size(); i++) {
     locationContents[flower.getLocation(i)] = flower.getContents(i);
   }
 }
 
+std::unordered_map<Location, PossibleContents>
+ContentOracle::getReusableContents() {
+  std::unordered_map<Location, PossibleContents> reusable;
+  for (auto& [location, contents] : locationContents) {
+    // ExpressionLocations are keyed by Expression* and would dangle; every
+    // other location kind is keyed by stable data (names, types, functions).
+    // Empty contents would seed nothing, so skip them as well.
+    if (!std::get_if<ExpressionLocation>(&location) && !contents.isNone()) {
+      reusable[location] = contents;
+    }
+  }
+  return reusable;
+}
+
 } // namespace wasm
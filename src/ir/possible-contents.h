@@ -234,6 +234,12 @@ public:
     }
     o << ']';
   }
+
+private:
+  // The non-trivial combinations (both contents concrete, and different),
+  // called by combine(), which memoizes the results.
+  static PossibleContents combineConcrete(const PossibleContents& a,
+                                          const PossibleContents& b);
 };
 
 // The various *Location structs (ExpressionLocation, ResultLocation, etc.)
@@ -514,10 +520,22 @@ namespace wasm {
 class ContentOracle {
   Module& wasm;
 
-  void analyze();
+  void analyze(const std::unordered_map<Location, PossibleContents>* seeds);
 
 public:
-  ContentOracle(Module& wasm) : wasm(wasm) { analyze(); }
+  ContentOracle(Module& wasm) : wasm(wasm) { analyze(nullptr); }
+
+  // Construct an oracle that is warm-started from the reusable contents of a
+  // previous oracle (see getReusableContents). The seeds are added as extra
+  // roots, so the result is a sound overapproximation of a cold analysis:
+  // starting near the previous fixed point saves most of the iterations of the
+  // flow, at the cost of not noticing places where the contents shrank since
+  // the previous analysis.
+  ContentOracle(Module& wasm,
+                const std::unordered_map<Location, PossibleContents>& seeds)
+    : wasm(wasm) {
+    analyze(&seeds);
+  }
 
   // Get the contents possible at a location.
   PossibleContents getContents(Location location) {
@@ -529,6 +547,13 @@ public:
     return iter->second;
   }
 
+  // Get the subset of our contents that can be reused to warm-start a later
+  // analysis, that is, the contents at locations not keyed by a particular
+  // Expression* (which would dangle once any pass rewrites the IR). Locations
+  // keyed by a Function* are included; the caller must not use the result
+  // after functions have been removed from the module.
+  std::unordered_map<Location, PossibleContents> getReusableContents();
+
 private:
   std::unordered_map<Location, PossibleContents> locationContents;
 };
@@ -17,7 +17,10 @@
 #ifndef wasm_ir_struct_utils_h
 #define wasm_ir_struct_utils_h
 
+#include <atomic>
+
 #include "ir/subtypes.h"
+#include "support/threads.h"
 #include "wasm.h"
 
 namespace wasm {
@@ -84,7 +87,9 @@ struct StructValuesMap : public std::unordered_map<HeapType, StructValues<T>> {
 template<typename T>
 struct FunctionStructValuesMap
   : public std::unordered_map<Function*, StructValuesMap<T>> {
-  FunctionStructValuesMap(Module& wasm) {
+  Module& wasm;
+
+  FunctionStructValuesMap(Module& wasm) : wasm(wasm) {
     // Initialize the data for each function in preparation for parallel
     // computation.
     for (auto& func : wasm.functions) {
@@ -92,12 +97,67 @@ struct FunctionStructValuesMap
     }
   }
 
-  // Combine information across functions.
+  // Combine information across functions. Each (type, field) cell of the
+  // result is independent of the others, so first bucket the per-function
+  // info by type - iterating the entries in a fixed order, so that each
+  // bucket combines in a deterministic order - and then reduce the buckets
+  // in parallel.
   void combineInto(StructValuesMap<T>& combinedInfos) const {
-    for (auto& kv : *this) {
-      const StructValuesMap<T>& infos = kv.second;
-      infos.combineInto(combinedInfos);
+    std::vector<HeapType> bucketTypes;
+    std::vector<std::vector<const StructValues<T>*>> buckets;
+    std::unordered_map<HeapType, Index> bucketIndexes;
+    auto bucketEntry = [&](Function* func) {
+      auto iter = this->find(func);
+      if (iter == this->end()) {
+        return;
+      }
+      for (auto& [type, values] : iter->second) {
+        auto [indexIter, inserted] =
+          bucketIndexes.emplace(type, buckets.size());
+        if (inserted) {
+          bucketTypes.push_back(type);
+          buckets.emplace_back();
+        }
+        buckets[indexIter->second].push_back(&values);
+      }
+    };
+    // The entry for the null function holds the info for module-level code
+    // (like struct.news in global initializers), which must be combined just
+    // like any function's.
+    bucketEntry(nullptr);
+    for (auto& func : wasm.functions) {
+      bucketEntry(func.get());
     }
+
+    // Create all the outputs first, so that the workers write to disjoint,
+    // stable places.
+    std::vector<StructValues<T>*> outputs(buckets.size());
+    for (Index i = 0; i < buckets.size(); i++) {
+      outputs[i] = &combinedInfos[bucketTypes[i]];
+    }
+
+    std::atomic<size_t> nextBucket;
+    nextBucket.store(0);
+    size_t numBuckets = buckets.size();
+    size_t numWorkers = ThreadPool::get()->size();
+    std::vector<std::function<ThreadWorkState()>> doWorkers;
+    for (size_t worker = 0; worker < numWorkers; worker++) {
+      doWorkers.push_back([&]() {
+        auto index = nextBucket.fetch_add(1);
+        if (index >= numBuckets) {
+          return ThreadWorkState::Finished;
+        }
+        auto& combined = *outputs[index];
+        for (auto* values : buckets[index]) {
+          for (Index i = 0; i < combined.size(); i++) {
+            combined[i].combine((*values)[i]);
+          }
+        }
+        return index + 1 == numBuckets ? ThreadWorkState::Finished
+                                       : ThreadWorkState::More;
+      });
+    }
+    ThreadPool::get()->work(doWorkers);
   }
 };
 
@@ -238,22 +298,38 @@ private:
   void propagate(StructValuesMap<T>& combinedInfos,
                  bool toSubTypes,
                  bool toSuperTypes) {
-    UniqueDeferredQueue<HeapType> work;
-    for (auto& [type, _] : combinedInfos) {
-      work.push(type);
+    // Work on the dense type indices of SubTypes, keeping a pointer to the
+    // state of each type in a flat vector, so that the fixed-point loop below
+    // does no hash map lookups. (References into an unordered_map are stable
+    // across later insertions, so the pointers remain valid as entries are
+    // lazily created.)
+    auto& types = subTypes.types;
+    std::vector<StructValues<T>*> infoPtrs(types.size(), nullptr);
+    UniqueDeferredIndexQueue<Index> work;
+    for (auto& [type, infos] : combinedInfos) {
+      auto index = subTypes.getIndex(type);
+      infoPtrs[index] = &infos;
+      work.push(index);
     }
+    auto getInfos = [&](Index index) -> StructValues<T>& {
+      if (!infoPtrs[index]) {
+        infoPtrs[index] = &combinedInfos[types[index]];
+      }
+      return *infoPtrs[index];
+    };
     while (!work.empty()) {
-      auto type = work.pop();
-      auto& infos = combinedInfos[type];
+      auto index = work.pop();
+      auto& infos = getInfos(index);
 
       if (toSuperTypes) {
         // Propagate shared fields to the supertype.
-        if (auto superType = type.getSuperType()) {
-          auto& superInfos = combinedInfos[*superType];
-          auto& superFields = superType->getStruct().fields;
-          for (Index i = 0; i < superFields.size(); i++) {
+        auto superIndex = subTypes.getSuperIndex(index);
+        if (superIndex != SubTypes::InvalidIndex) {
+          auto& superInfos = getInfos(superIndex);
+          auto numSuperFields = types[superIndex].getStruct().fields.size();
+          for (Index i = 0; i < numSuperFields; i++) {
             if (superInfos[i].combine(infos[i])) {
-              work.push(*superType);
+              work.push(superIndex);
             }
           }
         }
@@ -261,12 +337,12 @@ private:
 
       if (toSubTypes) {
         // Propagate shared fields to the subtypes.
-        auto numFields = type.getStruct().fields.size();
-        for (auto subType : subTypes.getStrictSubTypes(type)) {
-          auto& subInfos = combinedInfos[subType];
+        auto numFields = types[index].getStruct().fields.size();
+        for (auto subIndex : subTypes.getStrictSubTypeIndexes(index)) {
+          auto& subInfos = getInfos(subIndex);
           for (Index i = 0; i < numFields; i++) {
             if (subInfos[i].combine(infos[i])) {
-              work.push(subType);
+              work.push(subIndex);
             }
           }
         }
@@ -31,24 +31,70 @@ struct SubTypes {
       Fatal() << "SubTypes requires explicit supers";
     }
     types = ModuleUtils::collectHeapTypes(wasm);
-    for (auto type : types) {
-      note(type);
+    typeIndices.reserve(types.size());
+    for (Index i = 0; i < types.size(); i++) {
+      typeIndices[types[i]] = i;
     }
+    // Compute the supertype and the strict subtypes of each type, over the
+    // dense indices.
+    superIndexes.resize(types.size(), InvalidIndex);
+    subTypeIndexes.resize(types.size());
+    for (Index i = 0; i < types.size(); i++) {
+      if (auto super = types[i].getSuperType()) {
+        auto superIndex = getIndex(*super);
+        superIndexes[i] = superIndex;
+        subTypeIndexes[superIndex].push_back(i);
+      }
+    }
+  }
+
+  // An index that is not the index of any type.
+  static constexpr Index InvalidIndex = Index(-1);
+
+  // Get the dense index of a type that was collected from the module. These
+  // indices allow callers to keep per-type state in flat vectors of size
+  // types.size(), rather than in hash maps keyed on the types themselves.
+  Index getIndex(HeapType type) const {
+    auto iter = typeIndices.find(type);
+    assert(iter != typeIndices.end());
+    return iter->second;
   }
 
-  const std::vector<HeapType>& getStrictSubTypes(HeapType type) {
-    return typeSubTypes[type];
+  // Get the indexes of the strict subtypes of the type at an index.
+  const std::vector<Index>& getStrictSubTypeIndexes(Index index) const {
+    return subTypeIndexes[index];
+  }
+
+  // Get the index of the immediate supertype of the type at an index, or
+  // InvalidIndex if it has none.
+  Index getSuperIndex(Index index) const { return superIndexes[index]; }
+
+  std::vector<HeapType> getStrictSubTypes(HeapType type) const {
+    std::vector<HeapType> ret;
+    auto iter = typeIndices.find(type);
+    if (iter != typeIndices.end()) {
+      for (auto index : subTypeIndexes[iter->second]) {
+        ret.push_back(types[index]);
+      }
+    }
+    return ret;
   }
 
   // Get all subtypes of a type, and their subtypes and so forth, recursively.
   std::vector<HeapType> getAllStrictSubTypes(HeapType type) {
-    std::vector<HeapType> ret, work;
-    work.push_back(type);
+    std::vector<HeapType> ret;
+    auto iter = typeIndices.find(type);
+    if (iter == typeIndices.end()) {
+      // The type was not collected from the module, so we know of no subtypes.
+      return ret;
+    }
+    std::vector<Index> work;
+    work.push_back(iter->second);
     while (!work.empty()) {
       auto curr = work.back();
       work.pop_back();
-      for (auto sub : getStrictSubTypes(curr)) {
-        ret.push_back(sub);
+      for (auto sub : subTypeIndexes[curr]) {
+        ret.push_back(types[sub]);
         work.push_back(sub);
       }
     }
@@ -63,19 +109,19 @@ struct SubTypes {
   }
 
   // All the types in the program. This is computed here anyhow, and can be
-  // useful for callers to iterate on, so it is public.
+  // useful for callers to iterate on, so it is public. getIndex() returns
+  // positions in this vector.
   std::vector<HeapType> types;
 
 private:
-  // Add a type to the graph.
-  void note(HeapType type) {
-    if (auto super = type.getSuperType()) {
-      typeSubTypes[*super].push_back(type);
-    }
-  }
+  // Maps a type to its dense index in |types|.
+  std::unordered_map<HeapType, Index> typeIndices;
+
+  // Maps a type index to the index of its immediate supertype, if it has one.
+  std::vector<Index> superIndexes;
 
-  // Maps a type to its subtypes.
-  std::unordered_map<HeapType, std::vector<HeapType>> typeSubTypes;
+  // Maps a type index to the indexes of its strict subtypes.
+  std::vector<std::vector<Index>> subTypeIndexes;
 };
 
 } // namespace wasm
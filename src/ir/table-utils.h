@@ -25,8 +25,20 @@
 
 namespace wasm::TableUtils {
 
+// A flat view of a table: the function name in each slot, the type of the
+// function in each slot (so that checking a call_indirect target is a pair
+// of array lookups rather than a function lookup per call site), and a
+// sub-index from each function type to the slots holding functions of that
+// type. The view is a snapshot of the table's segments; passes that edit
+// the table through the set() and append() methods below keep the view
+// consistent without reflattening it.
 struct FlatTable {
   std::vector<Name> names;
+  // The type of the function in each slot. Empty slots hold a placeholder
+  // (HeapType::func); they trap before any type is checked.
+  std::vector<HeapType> types;
+  // For each function type, the non-empty slots holding that type.
+  std::unordered_map<HeapType, std::vector<Index>> typedSlots;
   bool valid;
 
   FlatTable(Module& wasm, Table& table) {
@@ -47,7 +59,39 @@ struct FlatTable {
         ElementUtils::iterElementSegmentFunctionNames(
           segment, [&](Name entry, Index i) { names[start + i] = entry; });
       });
+    if (!valid) {
+      return;
+    }
+    types.reserve(names.size());
+    for (Index i = 0; i < names.size(); i++) {
+      auto name = names[i];
+      if (name.is()) {
+        auto type = wasm.getFunction(name)->type;
+        types.push_back(type);
+        typedSlots[type].push_back(i);
+      } else {
+        types.push_back(HeapType::func);
+      }
+    }
   }
+
+  // Updates a slot in the view, keeping the typed sub-index consistent. The
+  // caller is responsible for the matching element segment edit.
+  void set(Module& wasm, Index slot, Name name) {
+    assert(valid && slot < names.size());
+    if (names[slot].is()) {
+      auto& slots = typedSlots[types[slot]];
+      slots.erase(std::find(slots.begin(), slots.end(), slot));
+    }
+    names[slot] = name;
+    types[slot] = name.is() ? wasm.getFunction(name)->type : HeapType::func;
+    if (name.is()) {
+      typedSlots[types[slot]].push_back(slot);
+    }
+  }
+
+  // Appends to the table (see append() below) and to the view together.
+  Index append(Table& table, Name name, Module& wasm);
 };
 
 inline ElementSegment* getSingletonSegment(Table& table, Module& wasm) {
@@ -104,6 +148,16 @@ inline Index getOrAppend(Table& table, Name name, Module& wasm) {
   return append(table, name, wasm);
 }
 
+inline Index FlatTable::append(Table& table, Name name, Module& wasm) {
+  auto slot = TableUtils::append(table, name, wasm);
+  if (slot >= names.size()) {
+    names.resize(slot + 1);
+    types.resize(slot + 1, HeapType::func);
+  }
+  set(wasm, slot, name);
+  return slot;
+}
+
 // Functions that we take a reference to, but are not in a Table, but get an
 // "elem declare" mention in the text and binary formats.
 std::set<Name> getFunctionsNeedingElemDeclare(Module& wasm);
@@ -25,6 +25,41 @@ namespace wasm {
 
 GlobalTypeRewriter::GlobalTypeRewriter(Module& wasm) : wasm(wasm) {}
 
+void GlobalTypeRewriter::commit(const StagedUpdates& updates, Module& wasm) {
+  if (updates.empty()) {
+    return;
+  }
+
+  class Rewriter : public GlobalTypeRewriter {
+    const StagedUpdates& updates;
+
+  public:
+    Rewriter(Module& wasm, const StagedUpdates& updates)
+      : GlobalTypeRewriter(wasm), updates(updates) {
+      update();
+    }
+
+    void modifySignature(HeapType oldSignatureType, Signature& sig) override {
+      auto iter = updates.signatures.find(oldSignatureType);
+      if (iter != updates.signatures.end()) {
+        sig.params = getTempType(iter->second.params);
+        sig.results = getTempType(iter->second.results);
+      }
+    }
+
+    void modifyStruct(HeapType oldStructType, Struct& struct_) override {
+      auto iter = updates.structFields.find(oldStructType);
+      if (iter != updates.structFields.end()) {
+        auto& newTypes = iter->second;
+        assert(newTypes.size() == struct_.fields.size());
+        for (Index i = 0; i < newTypes.size(); i++) {
+          struct_.fields[i].type = getTempType(newTypes[i]);
+        }
+      }
+    }
+  } rewriter(wasm, updates);
+}
+
 void GlobalTypeRewriter::update() {
   indexedTypes = ModuleUtils::getOptimizedIndexedHeapTypes(wasm);
   if (indexedTypes.types.empty()) {
@@ -342,7 +377,8 @@ Expression* fixLocalGet(LocalGet* get, Module& wasm) {
 void updateParamTypes(Function* func,
                       const std::vector<Type>& newParamTypes,
                       Module& wasm,
-                      LocalUpdatingMode localUpdating) {
+                      LocalUpdatingMode localUpdating,
+                      DeferredReFinalize* deferredReFinalize) {
   // Before making this update, we must be careful if the param was "reused",
   // specifically, if it is assigned a less-specific type in the body then
   // we'd get a validation error when we refine it. To handle that, if a less-
@@ -430,12 +466,17 @@ void updateParamTypes(Function* func,
     }
   }
 
-  // Propagate the new get and set types outwards.
-  ReFinalize().walkFunctionInModule(func, &wasm);
+  if (deferredReFinalize && paramFixups.empty()) {
+    // The caller will propagate the new types later, in bulk.
+    deferredReFinalize->note(func);
+  } else {
+    // Propagate the new get and set types outwards.
+    ReFinalize().walkFunctionInModule(func, &wasm);
 
-  if (!paramFixups.empty()) {
-    // We have added locals, and must handle non-nullability of them.
-    TypeUpdating::handleNonDefaultableLocals(func, wasm);
+    if (!paramFixups.empty()) {
+      // We have added locals, and must handle non-nullability of them.
+      TypeUpdating::handleNonDefaultableLocals(func, wasm);
+    }
   }
 }
 
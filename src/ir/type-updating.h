@@ -23,6 +23,8 @@
 
 namespace wasm {
 
+class DeferredReFinalize;
+
 //
 // A class that tracks type dependencies between nodes, letting you update types
 // efficiently when removing and altering code incrementally.
@@ -353,30 +355,31 @@ public:
 
   using SignatureUpdates = std::unordered_map<HeapType, Signature>;
 
-  // Helper for the repeating pattern of just updating Signature types using a
-  // map of old heap type => new Signature.
-  static void updateSignatures(const SignatureUpdates& updates, Module& wasm) {
-    if (updates.empty()) {
-      return;
-    }
+  // A batch of type modifications that can be committed in a single rebuild.
+  // Each call to update() re-canonicalizes the entire type section, which
+  // dominates the cost on type-heavy modules, so a pass that knows about
+  // several kinds of changes should stage them all here and commit once
+  // rather than rebuild per batch.
+  struct StagedUpdates {
+    // Old signature heap type => new signature.
+    SignatureUpdates signatures;
 
-    class SignatureRewriter : public GlobalTypeRewriter {
-      const SignatureUpdates& updates;
+    // Old struct heap type => the new types of its fields, in order (with the
+    // same arity; fields that do not change just repeat their old type).
+    std::unordered_map<HeapType, std::vector<Type>> structFields;
 
-    public:
-      SignatureRewriter(Module& wasm, const SignatureUpdates& updates)
-        : GlobalTypeRewriter(wasm), updates(updates) {
-        update();
-      }
+    bool empty() const { return signatures.empty() && structFields.empty(); }
+  };
 
-      void modifySignature(HeapType oldSignatureType, Signature& sig) override {
-        auto iter = updates.find(oldSignatureType);
-        if (iter != updates.end()) {
-          sig.params = getTempType(iter->second.params);
-          sig.results = getTempType(iter->second.results);
-        }
-      }
-    } rewriter(wasm, updates);
+  // Commits all staged updates in one rebuild of the type section.
+  static void commit(const StagedUpdates& updates, Module& wasm);
+
+  // Helper for the repeating pattern of just updating Signature types using a
+  // map of old heap type => new Signature.
+  static void updateSignatures(const SignatureUpdates& updates, Module& wasm) {
+    StagedUpdates staged;
+    staged.signatures = updates;
+    commit(staged, wasm);
   }
 
 private:
@@ -421,10 +424,15 @@ Expression* fixLocalGet(LocalGet* get, Module& wasm);
 // later in the caller, which is the case if we are rewriting function types).
 enum LocalUpdatingMode { Update, DoNotUpdate };
 
+// If |deferredReFinalize| is provided then, when possible, instead of
+// refinalizing the function immediately (a serial whole-function walk at each
+// call site) we note it there, and the caller applies the queue once for all
+// modified functions.
 void updateParamTypes(Function* func,
                       const std::vector<Type>& newParamTypes,
                       Module& wasm,
-                      LocalUpdatingMode localUpdating = Update);
+                      LocalUpdatingMode localUpdating = Update,
+                      DeferredReFinalize* deferredReFinalize = nullptr);
 
 } // namespace TypeUpdating
 
@@ -116,7 +116,8 @@ struct ExpressionAnalyzer {
 // depends on the block. To avoid looking at the parent or something
 // else, just remove such un-taken branches.
 struct ReFinalize
-  : public WalkerPass<PostWalker<ReFinalize, OverriddenVisitor<ReFinalize>>> {
+  : public WalkerPass<
+      StaticPostWalker<ReFinalize, OverriddenVisitor<ReFinalize>>> {
   bool isFunctionParallel() override { return true; }
 
   Pass* create() override { return new ReFinalize; }
@@ -151,6 +152,30 @@ private:
   void replaceUntaken(Expression* value, Expression* condition);
 };
 
+// A deferred refinalization queue. Utilities that modify types in several
+// functions while on the main thread can note each dirty function here and
+// then call apply() once, which refinalizes all the noted functions using a
+// single function-parallel pass, instead of doing a serial whole-function
+// ReFinalize walk at each modification site.
+class DeferredReFinalize {
+public:
+  DeferredReFinalize(Module& wasm) : wasm(wasm) {}
+
+  // Note a function whose types need refinalization.
+  void note(Function* func) { dirty.insert(func); }
+
+  // Refinalize all the noted functions, and empty the queue.
+  void apply();
+
+  // Empty the queue without doing any work, for when the caller ends up
+  // refinalizing the entire module anyhow.
+  void clear() { dirty.clear(); }
+
+private:
+  Module& wasm;
+  std::unordered_set<Function*> dirty;
+};
+
 // Re-finalize a single node. This is slow, if you want to refinalize
 // an entire ast, use ReFinalize
 struct ReFinalizeNode : public OverriddenVisitor<ReFinalizeNode> {
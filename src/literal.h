@@ -82,7 +82,12 @@ public:
     : func(func), type(type, NonNullable) {}
   explicit Literal(std::shared_ptr<GCData> gcData, HeapType type);
   Literal(const Literal& other);
+  // Moving a literal steals any GC data rather than adjusting the shared
+  // refcount, which matters for interpreter performance. The moved-from
+  // literal keeps its type but must only be destroyed or assigned to.
+  Literal(Literal&& other);
   Literal& operator=(const Literal& other);
+  Literal& operator=(Literal&& other);
   ~Literal();
 
   bool isConcrete() const { return type.isConcrete(); }
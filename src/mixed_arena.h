@@ -17,6 +17,7 @@
 #ifndef wasm_mixed_arena_h
 #define wasm_mixed_arena_h
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <memory>
@@ -68,7 +69,11 @@ struct MixedArena {
   // but possibly more.
   std::vector<void*> chunks;
 
-  size_t index = 0; // in last chunk
+  size_t index = 0;    // in last chunk
+  size_t capacity = 0; // size of the last chunk (a multiple of CHUNK_SIZE)
+
+  // The total bytes in all our chunks, for profiling.
+  size_t allocatedBytes = 0;
 
   std::thread::id threadId;
 
@@ -120,22 +125,24 @@ struct MixedArena {
     }
     // First, move the current index in the last chunk to an aligned position.
     index = (index + align - 1) & (-align);
-    if (index + size > CHUNK_SIZE || chunks.size() == 0) {
-      // Allocate a new chunk.
+    if (index + size > capacity) {
+      // Allocate a new chunk. For a large allocation this is a multiple of
+      // CHUNK_SIZE, and we keep bump-allocating from its remainder, so
+      // nothing is wasted.
       auto numChunks = (size + CHUNK_SIZE - 1) / CHUNK_SIZE;
       assert(size <= numChunks * CHUNK_SIZE);
-      auto* allocation =
-        wasm::aligned_malloc(MAX_ALIGN, numChunks * CHUNK_SIZE);
+      capacity = numChunks * CHUNK_SIZE;
+      auto* allocation = wasm::aligned_malloc(MAX_ALIGN, capacity);
       if (!allocation) {
         abort();
       }
       chunks.push_back(allocation);
+      allocatedBytes += capacity;
       index = 0;
     }
     uint8_t* ret = static_cast<uint8_t*>(chunks.back());
     ret += index;
-    index += size; // TODO: if we allocated more than 1 chunk, reuse the
-                   // remainder, right now we allocate another next time
+    index += size;
     return static_cast<void*>(ret);
   }
 
@@ -148,11 +155,60 @@ struct MixedArena {
     return ret;
   }
 
+  // Attempt to extend an existing allocation in place, which succeeds if it
+  // is the most recent allocation in the current chunk and the chunk has
+  // room. This lets a growing vector extend its storage repeatedly with no
+  // copying and no wasted space, a common pattern for expression lists.
+  bool growInPlace(void* ptr, size_t oldSize, size_t newSize) {
+    // As in allocSpace, each thread allocates from its own arena in the
+    // chain, and only the allocating thread may touch the bump state. Find
+    // this thread's arena; if it has none, the allocation cannot be its
+    // tail.
+    auto myId = std::this_thread::get_id();
+    if (myId != threadId) {
+      for (MixedArena* curr = next.load(); curr; curr = curr->next.load()) {
+        if (curr->threadId == myId) {
+          return curr->growInPlace(ptr, oldSize, newSize);
+        }
+      }
+      return false;
+    }
+    if (chunks.empty()) {
+      return false;
+    }
+    auto* chunk = static_cast<uint8_t*>(chunks.back());
+    auto* bytes = static_cast<uint8_t*>(ptr);
+    if (bytes + oldSize != chunk + index) {
+      // Something else was allocated after this; we cannot extend it.
+      return false;
+    }
+    size_t newIndex = (bytes - chunk) + newSize;
+    if (newIndex > capacity) {
+      return false;
+    }
+    index = newIndex;
+    return true;
+  }
+
+  // The total bytes allocated in this arena, including the side arenas of
+  // other threads. Only meaningful while no other thread is allocating, e.g.
+  // between passes; used for profiling.
+  size_t totalAllocatedBytes() const {
+    size_t total = 0;
+    for (const MixedArena* curr = this; curr; curr = curr->next.load()) {
+      total += curr->allocatedBytes;
+    }
+    return total;
+  }
+
   void clear() {
     for (auto* chunk : chunks) {
       wasm::aligned_free(chunk);
     }
     chunks.clear();
+    index = 0;
+    capacity = 0;
+    allocatedBytes = 0;
   }
 
   ~MixedArena() {
@@ -262,12 +318,9 @@ public:
   void operator=(SubType& other) { set(other); }
 
   void swap(SubType& other) {
-    data = other.data;
-    usedElements = other.usedElements;
-    allocatedElements = other.allocatedElements;
-
-    other.data = nullptr;
-    other.usedElements = other.allocatedElements = 0;
+    std::swap(data, other.data);
+    std::swap(usedElements, other.usedElements);
+    std::swap(allocatedElements, other.allocatedElements);
   }
 
   // iteration
@@ -393,23 +446,100 @@ public:
 //       passed in when needed, would make this (and thus Blocks etc.
 //       smaller)
 
-template<typename T>
-class ArenaVector : public ArenaVectorBase<ArenaVector<T>, T> {
+// Storage for the first InlineSize elements of an ArenaVector, which lives
+// inside the vector itself, so that small vectors need no arena allocation
+// at all. The zero-size specialization adds no footprint, thanks to the
+// empty base optimization.
+template<typename T, size_t InlineSize> struct ArenaVectorInlineStorage {
+  T elements[InlineSize];
+};
+template<typename T> struct ArenaVectorInlineStorage<T, 0> {};
+
+template<typename T, size_t InlineSize = 0>
+class ArenaVector : public ArenaVectorBase<ArenaVector<T, InlineSize>, T>,
+                    private ArenaVectorInlineStorage<T, InlineSize> {
 private:
   MixedArena& allocator;
 
+  T* inlineData() {
+    if constexpr (InlineSize > 0) {
+      return this->elements;
+    } else {
+      return nullptr;
+    }
+  }
+
 public:
-  ArenaVector(MixedArena& allocator) : allocator(allocator) {}
+  ArenaVector(MixedArena& allocator) : allocator(allocator) {
+    if constexpr (InlineSize > 0) {
+      this->data = inlineData();
+      this->allocatedElements = InlineSize;
+    }
+  }
 
-  ArenaVector(ArenaVector<T>&& other) : allocator(other.allocator) {
+  ArenaVector(ArenaVector&& other) : allocator(other.allocator) {
+    if constexpr (InlineSize > 0) {
+      this->data = inlineData();
+      this->allocatedElements = InlineSize;
+    }
     *this = other;
   }
 
   void allocate(size_t size) {
+    if constexpr (InlineSize > 0) {
+      if (size <= InlineSize) {
+        this->data = inlineData();
+        this->allocatedElements = InlineSize;
+        return;
+      }
+    }
+    // If our storage is the tail of the arena we may be able to simply
+    // extend it in place, avoiding a copy (the caller copies the old
+    // contents over, which is then a no-op as the data does not move).
+    if (this->data && this->data != inlineData() &&
+        allocator.growInPlace(this->data,
+                              sizeof(T) * this->allocatedElements,
+                              sizeof(T) * size)) {
+      this->allocatedElements = size;
+      return;
+    }
     this->allocatedElements = size;
     this->data = static_cast<T*>(
       allocator.allocSpace(sizeof(T) * this->allocatedElements, alignof(T)));
   }
+
+  void swap(ArenaVector& other) {
+    if constexpr (InlineSize > 0) {
+      bool thisInline = this->data == inlineData();
+      bool otherInline = other.data == other.inlineData();
+      if (thisInline && otherInline) {
+        T tmp[InlineSize];
+        std::copy_n(this->data, this->usedElements, tmp);
+        std::copy_n(other.data, other.usedElements, this->data);
+        std::copy_n(tmp, this->usedElements, other.data);
+        std::swap(this->usedElements, other.usedElements);
+        return;
+      }
+      if (thisInline || otherInline) {
+        // Move the inline side's elements into the other's inline storage,
+        // and hand the arena storage over in the other direction.
+        auto* inlineSide = thisInline ? this : &other;
+        auto* arenaSide = thisInline ? &other : this;
+        std::copy_n(inlineSide->data,
+                    inlineSide->usedElements,
+                    arenaSide->inlineData());
+        inlineSide->data = arenaSide->data;
+        inlineSide->allocatedElements = arenaSide->allocatedElements;
+        arenaSide->data = arenaSide->inlineData();
+        arenaSide->allocatedElements = InlineSize;
+        std::swap(this->usedElements, other.usedElements);
+        return;
+      }
+    }
+    std::swap(this->data, other.data);
+    std::swap(this->usedElements, other.usedElements);
+    std::swap(this->allocatedElements, other.allocatedElements);
+  }
 };
 
 #endif // wasm_mixed_arena_h
@@ -18,6 +18,8 @@
 #define wasm_pass_h
 
 #include <functional>
+#include <memory>
+#include <unordered_map>
 
 #include "mixed_arena.h"
 #include "support/utilities.h"
@@ -28,6 +30,11 @@ namespace wasm {
 
 class Pass;
 
+// Effects of entire functions, computed by the generate-global-effects pass;
+// see ir/effects.h.
+class EffectAnalyzer;
+using FuncEffectsMap = std::unordered_map<Name, EffectAnalyzer>;
+
 //
 // Global registry of all passes in /passes/
 //
@@ -102,6 +109,13 @@ struct PassOptions {
   bool validate = true;
   // When validating validate globally and not just locally
   bool validateGlobally = false;
+  // Whether the input is already known to be valid, because a trusted
+  // producer validated it upstream. While our passes run this enables the
+  // relaxed finalization fast path: types handed to the finalize(type)
+  // variants are trusted to be final, skipping the re-scan that normally
+  // checks whether unreachability from children must propagate into the
+  // parent. See setTrustDeclaredTypes in wasm.h.
+  bool trustedInput = false;
   // 0, 1, 2 correspond to -O0, -O1, -O2, etc.
   int optimizeLevel = 0;
   // 0, 1, 2 correspond to -O0, -Os, -Oz
@@ -162,6 +176,35 @@ struct PassOptions {
   bool zeroFilledMemory = false;
   // Whether to try to preserve debug info through, which are special calls.
   bool debugInfo = false;
+  // The size (in expression nodes) above which a single function's body may
+  // be split into pieces that run on separate threads, for passes that
+  // support that (see Pass::isSubtreeParallel). This allows some parallelism
+  // even when one huge function dominates the module. 0 disables splitting.
+  Index subtreeParallelThreshold = 100000;
+  // Whether to detect structurally identical functions when a group of
+  // function-parallel passes runs, optimize a single representative of each
+  // group, and copy the optimized body into the others. This helps modules
+  // that link several variants of mostly-shared code. It assumes each pass's
+  // output depends only on the function's contents, which is true of the
+  // normal optimization pipeline but not of, say, instrumentation passes
+  // that assign each function a distinct ID - hence opt-in.
+  bool dedupeFunctionWork = false;
+  // The effects of each function, if the generate-global-effects pass has
+  // computed them. When present, EffectAnalyzer uses this for direct calls
+  // instead of assuming the worst, which unlocks optimizations like hoisting
+  // a call to a pure helper out of a loop. The map is shared by the copies of
+  // these options that nested runners make, and remains valid only while the
+  // code that was analyzed is: passes that may add new effects to a function
+  // (normal optimizations only remove them) must run discard-global-effects
+  // first.
+  std::shared_ptr<FuncEffectsMap> funcEffectsMap;
+  // Whether to profile the passes as they run: per-pass wall time, peak RSS
+  // growth, and IR arena growth, emitted as JSON to stderr when the top-level
+  // runner finishes. Useful for tracking down which pass regressed a
+  // pipeline. (Profiling runs each pass by itself so its cost can be
+  // attributed to it, so the usual fusing of consecutive function-parallel
+  // passes is disabled; total times are therefore slightly pessimistic.)
+  bool profilePasses = false;
   // Arbitrary string arguments from the commandline, which we forward to
   // passes.
   std::map<std::string, std::string> arguments;
@@ -209,6 +252,16 @@ struct PassRunner {
   std::vector<std::unique_ptr<Pass>> passes;
   PassOptions options;
 
+  // The profile of each pass in the last run, in execution order. Only filled
+  // in when profiling is enabled (see PassOptions::profilePasses).
+  struct PassProfile {
+    std::string name;
+    double seconds;
+    size_t peakRSSDelta;
+    size_t arenaDelta;
+  };
+  std::vector<PassProfile> profile;
+
   PassRunner(Module* wasm) : wasm(wasm), allocator(&wasm->allocator) {}
   PassRunner(Module* wasm, PassOptions options)
     : wasm(wasm), allocator(&wasm->allocator), options(options) {}
@@ -233,6 +286,21 @@ struct PassRunner {
     options.validateGlobally = validate;
   }
 
+  // When profiling, whether to print the profile to stderr when the run
+  // finishes. Disable this to consume |profile| programmatically instead.
+  void setPrintProfile(bool print) { printProfile = print; }
+
+  // Prints the profile of the last run as JSON.
+  void dumpProfile(std::ostream& o);
+
+  // Restrict function-parallel passes to the functions for which the filter
+  // returns true. Module-level passes are unaffected. This lets several
+  // processes each optimize a deterministic shard of a module's functions
+  // (see wasm-opt --shard); it is not meant for use within passes.
+  void setFunctionFilter(std::function<bool(Function*)> filter) {
+    funcFilter = std::move(filter);
+  }
+
   // Add a pass using its name.
   void add(std::string passName) {
     doAdd(PassRegistry::get()->createPass(passName));
@@ -308,6 +376,13 @@ private:
   // Whether this is a nested pass runner.
   bool isNested = false;
 
+  // Whether to print the profile to stderr when a profiled run finishes.
+  bool printProfile = true;
+
+  // If set, function-parallel passes only run on functions passing the
+  // filter.
+  std::function<bool(Function*)> funcFilter;
+
   // Whether the passes we have added so far to be run (but not necessarily run
   // yet) have removed DWARF.
   bool addedPassesRemovedDWARF = false;
@@ -319,6 +394,18 @@ private:
 
   void runPass(Pass* pass);
   void runPassOnFunction(Pass* pass, Function* func);
+  // Runs a fused stack of consecutive function-parallel passes on one
+  // function as a single task, so a worker applies the whole pipeline to a
+  // function while it is hot in cache, with no barriers in between.
+  void runPassStackOnFunction(const std::vector<Pass*>& stack, Function* func);
+
+  // Like runPassStackOnFunction, but runs only on the children [begin, end)
+  // of the function's body block, for subtree-parallel passes.
+  void runPassStackOnBlockRange(const std::vector<Pass*>& stack,
+                                Function* func,
+                                Block* block,
+                                Index begin,
+                                Index end);
 
   // After running a pass, handle any changes due to
   // how the pass is defined, such as clearing away any
@@ -369,6 +456,27 @@ public:
   // adding functions to the module.
   virtual bool isFunctionParallel() { return false; }
 
+  // Whether this function-parallel pass may also run on disjoint pieces of a
+  // single function, which lets the PassRunner split a huge function's body
+  // across threads (see PassOptions::subtreeParallelThreshold). This is only
+  // safe for passes whose work is entirely subtree-local: visiting a node may
+  // use and modify only that node's own subtree (plus read-only module and
+  // function state), and the pass must not depend on whole-function work in
+  // doWalkFunction, which is bypassed when running on pieces.
+  virtual bool isSubtreeParallel() { return false; }
+
+  // Run the pass on a contiguous range [begin, end) of the children of a
+  // block, which is the body of the given function. Only called for
+  // subtree-parallel passes.
+  virtual void runOnFunctionBlockRange(PassRunner* runner,
+                                       Module* module,
+                                       Function* function,
+                                       Block* block,
+                                       Index begin,
+                                       Index end) {
+    WASM_UNREACHABLE("unimplemented");
+  }
+
   // This method is used to create instances per function for a
   // function-parallel pass. You may need to override this if you subclass a
   // Walker, as otherwise this will create the parent class.
@@ -430,6 +538,21 @@ public:
     WalkerType::walkFunction(func);
   }
 
+  void runOnFunctionBlockRange(PassRunner* runner,
+                               Module* module,
+                               Function* func,
+                               Block* block,
+                               Index begin,
+                               Index end) override {
+    setPassRunner(runner);
+    WalkerType::setModule(module);
+    WalkerType::setFunction(func);
+    for (auto i = begin; i < end; i++) {
+      WalkerType::walk(block->list[i]);
+    }
+    WalkerType::setFunction(nullptr);
+  }
+
   void runOnModuleCode(PassRunner* runner, Module* module) {
     setPassRunner(runner);
     WalkerType::setModule(module);
@@ -300,6 +300,7 @@
 #include "cfg/liveness-traversal.h"
 #include "ir/effects.h"
 #include "ir/find_all.h"
+#include "ir/iteration.h"
 #include "ir/linear-execution.h"
 #include "ir/literal-utils.h"
 #include "ir/memory-utils.h"
@@ -723,56 +724,73 @@ public:
     return info.canChangeState && !info.isTopMostRuntime;
   }
 
-  bool canChangeState(Expression* curr, Function* func) {
-    // Look inside to see if we call any of the things we know can change the
-    // state.
-    // TODO: caching, this is O(N^2)
-    struct Walker : PostWalker<Walker> {
-      void visitCall(Call* curr) {
-        // We only implement these at the very end, but we know that they
-        // definitely change the state.
-        if (curr->target == ASYNCIFY_START_UNWIND ||
-            curr->target == ASYNCIFY_STOP_REWIND ||
-            curr->target == ASYNCIFY_GET_CALL_INDEX ||
-            curr->target == ASYNCIFY_CHECK_CALL_INDEX) {
-          canChangeState = true;
-          return;
-        }
-        if (curr->target == ASYNCIFY_STOP_UNWIND ||
-            curr->target == ASYNCIFY_START_REWIND) {
-          isBottomMostRuntime = true;
-          return;
+  // Computes, for every expression in a function, whether it can change the
+  // state. The flow instrumentation queries many overlapping subtrees, so we
+  // analyze the entire function once, bottom-up, rather than walking each
+  // queried subtree anew (which would be quadratic).
+  std::unordered_map<Expression*, bool> computeStateChanges(Function* func) {
+    // For each expression, whether it can change the state, and whether it
+    // contains a call into the bottom-most runtime (which can never change
+    // the state).
+    struct Info {
+      bool canChangeState = false;
+      bool isBottomMostRuntime = false;
+    };
+    struct Walker : PostWalker<Walker, UnifiedExpressionVisitor<Walker>> {
+      void visitExpression(Expression* curr) {
+        auto& info = infos[curr];
+        for (auto* child : ChildIterator(curr)) {
+          auto& childInfo = infos[child];
+          info.canChangeState |= childInfo.canChangeState;
+          info.isBottomMostRuntime |= childInfo.isBottomMostRuntime;
         }
-        // The target may not exist if it is one of our temporary intrinsics.
-        auto* target = module->getFunctionOrNull(curr->target);
-        if (target && (*map)[target].canChangeState) {
-          canChangeState = true;
+        if (auto* call = curr->dynCast<Call>()) {
+          // We only implement these at the very end, but we know that they
+          // definitely change the state.
+          if (call->target == ASYNCIFY_START_UNWIND ||
+              call->target == ASYNCIFY_STOP_REWIND ||
+              call->target == ASYNCIFY_GET_CALL_INDEX ||
+              call->target == ASYNCIFY_CHECK_CALL_INDEX) {
+            info.canChangeState = true;
+            return;
+          }
+          if (call->target == ASYNCIFY_STOP_UNWIND ||
+              call->target == ASYNCIFY_START_REWIND) {
+            info.isBottomMostRuntime = true;
+            return;
+          }
+          // The target may not exist if it is one of our temporary intrinsics.
+          auto* target = module->getFunctionOrNull(call->target);
+          if (target && (*map)[target].canChangeState) {
+            info.canChangeState = true;
+          }
+        } else if (curr->is<CallIndirect>()) {
+          // An indirect call is normally ignored if we are ignoring indirect
+          // calls. However, see the docs at the top: if the function we are
+          // inside was specifically added by the user (in the only-list or the
+          // add-list) then we instrument indirect calls from it (this allows
+          // specifically allowing some indirect calls but not others).
+          info.canChangeState = indirectCanChangeState;
         }
       }
-      void visitCallIndirect(CallIndirect* curr) { hasIndirectCall = true; }
+      std::unordered_map<Expression*, Info> infos;
       Module* module;
-      ModuleAnalyzer* analyzer;
       Map* map;
-      bool hasIndirectCall = false;
-      bool canChangeState = false;
-      bool isBottomMostRuntime = false;
+      bool indirectCanChangeState;
     };
     Walker walker;
     walker.module = &module;
-    walker.analyzer = this;
     walker.map = &map;
-    walker.walk(curr);
-    // An indirect call is normally ignored if we are ignoring indirect calls.
-    // However, see the docs at the top: if the function we are inside was
-    // specifically added by the user (in the only-list or the add-list) then we
-    // instrument indirect calls from it (this allows specifically allowing some
-    // indirect calls but not others).
-    if (walker.hasIndirectCall &&
-        (canIndirectChangeState || map[func].addedFromList)) {
-      walker.canChangeState = true;
+    walker.indirectCanChangeState =
+      canIndirectChangeState || map[func].addedFromList;
+    walker.walk(func->body);
+    std::unordered_map<Expression*, bool> ret;
+    ret.reserve(walker.infos.size());
+    for (auto& [curr, info] : walker.infos) {
+      // The bottom-most runtime can never change the state.
+      ret[curr] = info.canChangeState && !info.isBottomMostRuntime;
     }
-    // The bottom-most runtime can never change the state.
-    return walker.canChangeState && !walker.isBottomMostRuntime;
+    return ret;
   }
 
   FakeGlobalHelper fakeGlobals;
@@ -852,6 +870,9 @@ struct AsyncifyFlow : public Pass {
       }
       return;
     }
+    // Analyze the entire body up front, as we will query overlapping subtrees
+    // repeatedly while rewriting it.
+    stateChanges = analyzer->computeStateChanges(func);
     // Rewrite the function body.
     // Each function we enter will pop one from the stack, which is the index
     // of the next call to make.
@@ -881,6 +902,12 @@ private:
   // during rewind.
   Index callIndex = 0;
 
+  // Whether each expression in the current function can change the state; the
+  // result of ModuleAnalyzer::computeStateChanges.
+  std::unordered_map<Expression*, bool> stateChanges;
+
+  bool canChangeState(Expression* curr) { return stateChanges.at(curr); }
+
   Expression* process(Expression* curr) {
     // The IR is in flat form, which makes this much simpler: there are no
     // unnecessarily nested side effects or control flow, so we can add
@@ -943,7 +970,7 @@ private:
       auto* curr = item.curr;
       auto phase = item.phase;
 
-      if (phase == Work::Scan && !analyzer->canChangeState(curr, func)) {
+      if (phase == Work::Scan && !canChangeState(curr)) {
         results.push_back(makeMaybeSkip(curr));
         continue;
       }
@@ -959,7 +986,7 @@ private:
           // execution order.
           for (size_t i = list.size(); i > 0; i--) {
             auto* child = list[i - 1];
-            if (analyzer->canChangeState(child, func)) {
+            if (canChangeState(child)) {
               work.push_back(Work{child, Work::Scan});
             }
           }
@@ -1005,7 +1032,7 @@ private:
       } else if (auto* iff = curr->dynCast<If>()) {
         // The state change cannot be in the condition due to flat form, so it
         // must be in one of the children.
-        assert(!analyzer->canChangeState(iff->condition, func));
+        assert(!canChangeState(iff->condition));
         if (item.phase == Work::Scan) {
           work.push_back(Work{curr, Work::Finish});
           // Add ifTrue later so that we process it first.
@@ -1319,14 +1346,14 @@ private:
     struct RelevantLiveLocalsWalker
       : public LivenessWalker<RelevantLiveLocalsWalker,
                               Visitor<RelevantLiveLocalsWalker>> {
-      // Basic blocks that have a possible unwind/rewind in them.
-      std::set<BasicBlock*> relevantBasicBlocks;
+      // The calls at which we might unwind/rewind.
+      std::unordered_set<Expression*> relevantCalls;
 
       void visitCall(Call* curr) {
         if (!currBasicBlock) {
           return;
         }
-        // Note blocks where we might unwind/rewind, all of which have a
+        // Note positions where we might unwind/rewind, all of which have a
         // possible call to ASYNCIFY_CHECK_CALL_INDEX emitted right before the
         // actual call.
         // Note that each relevant original call was turned into a sequence of
@@ -1337,7 +1364,10 @@ private:
         // the call, and so anything that has its final use at the call is still
         // live here).
         if (curr->target == ASYNCIFY_CHECK_CALL_INDEX) {
-          relevantBasicBlocks.insert(currBasicBlock);
+          // Add an action marking this call's position among the gets and
+          // sets, so that we can compute the live locals right here.
+          currBasicBlock->contents.actions.emplace_back(getCurrentPointer());
+          relevantCalls.insert(curr);
         }
       }
     };
@@ -1346,12 +1376,26 @@ private:
     walker.setFunction(func);
     walker.walkFunctionInModule(func, getModule());
     // The relevant live locals are ones that are alive at an unwind/rewind
-    // location. TODO look more precisely inside basic blocks, as one might stop
-    // being live in the middle
-    for (auto* block : walker.liveBlocks) {
-      if (walker.relevantBasicBlocks.count(block)) {
-        for (auto local : block->contents.start) {
-          relevantLiveLocals.insert(local);
+    // location. Scan backwards through each block's actions to compute the
+    // precise live set at each relevant call, rather than conservatively using
+    // the live set at the start of the whole block (a local may stop being
+    // live before the call).
+    for (auto& block : walker.basicBlocks) {
+      if (!walker.liveBlocks.count(block.get())) {
+        continue;
+      }
+      auto live = block->contents.end;
+      auto& actions = block->contents.actions;
+      for (int i = int(actions.size()) - 1; i >= 0; i--) {
+        auto& action = actions[i];
+        if (action.isGet()) {
+          live.insert(action.index);
+        } else if (action.isSet()) {
+          live.erase(action.index);
+        } else if (walker.relevantCalls.count(*action.origin)) {
+          for (auto local : live) {
+            relevantLiveLocals.insert(local);
+          }
         }
       }
     }
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// A fused cleanup pass: vacuum plus merge-blocks. Pipelines often want to run
+// these two together, and each is cheap compared to the overhead around it -
+// dispatching over all the functions, and in debug builds validating after
+// each pass. Fusing them runs both on each function in a single parallel
+// dispatch, while the function is hot in cache, with a single validation at
+// the end.
+//
+// The two transformations remain sequential over the function: we vacuum
+// first, as removing unneeded code exposes more blocks to merge, and each
+// pass's visitors must see the other's finished output (interleaving them in
+// a single tree walk would change what they observe in post-order).
+//
+
+#include "pass.h"
+#include "passes.h"
+#include "wasm.h"
+
+namespace wasm {
+
+struct Cleanup : public Pass {
+  bool isFunctionParallel() override { return true; }
+
+  Pass* create() override { return new Cleanup; }
+
+  std::unique_ptr<Pass> vacuum;
+  std::unique_ptr<Pass> mergeBlocks;
+
+  Cleanup()
+    : vacuum(createVacuumPass()), mergeBlocks(createMergeBlocksPass()) {}
+
+  void run(PassRunner* runner, Module* module) override {
+    // Parallel pass running is implemented in the PassRunner.
+    PassRunner nestedRunner(module);
+    nestedRunner.setIsNested(true);
+    std::unique_ptr<Pass> copy;
+    copy.reset(create());
+    nestedRunner.add(std::move(copy));
+    nestedRunner.run();
+  }
+
+  void
+  runOnFunction(PassRunner* runner, Module* module, Function* func) override {
+    vacuum->runOnFunction(runner, module, func);
+    mergeBlocks->runOnFunction(runner, module, func);
+  }
+};
+
+Pass* createCleanupPass() { return new Cleanup(); }
+
+} // namespace wasm
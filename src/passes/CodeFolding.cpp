@@ -129,6 +129,31 @@ struct CodeFolding : public WalkerPass<ControlFlowWalker<CodeFolding>> {
   std::set<Expression*> modifieds;    // modified code should not be processed
                                       // again, wait for next pass
 
+  // Memoized hashes of expressions, used to quickly rule out unequal code
+  // before doing a full comparison. With many tails reaching the same target
+  // (like a switch with many arms) this avoids deep comparisons between
+  // each pair, which is effectively quadratic. Cleared at the end of each
+  // pass iteration, as folding rearranges the tree. (A hash may also be stale
+  // within an iteration if code near it was already folded, but that only
+  // makes the filter conservative - a full comparison always confirms actual
+  // equality - and such code is in modifieds anyhow.)
+  std::unordered_map<Expression*, size_t> hashes;
+
+  size_t getHash(Expression* expr) {
+    auto iter = hashes.find(expr);
+    if (iter != hashes.end()) {
+      return iter->second;
+    }
+    return hashes[expr] = ExpressionAnalyzer::hash(expr);
+  }
+
+  // Compares expressions for equality, filtering through their hashes first
+  // to quickly rule out the common unequal case.
+  bool areEqual(Expression* left, Expression* right) {
+    return getHash(left) == getHash(right) &&
+           ExpressionAnalyzer::equal(left, right);
+  }
+
   // walking
 
   void visitBreak(Break* curr) {
@@ -217,7 +242,7 @@ struct CodeFolding : public WalkerPass<ControlFlowWalker<CodeFolding>> {
       return;
     }
     // if both sides are identical, this is easy to fold
-    if (ExpressionAnalyzer::equal(curr->ifTrue, curr->ifFalse)) {
+    if (areEqual(curr->ifTrue, curr->ifFalse)) {
       Builder builder(*getModule());
       // remove if (4 bytes), remove one arm, add drop (1), add block (3),
       // so this must be a net savings
@@ -236,8 +261,7 @@ struct CodeFolding : public WalkerPass<ControlFlowWalker<CodeFolding>> {
       // a block and run the rest of the optimization mormally.
       auto maybeAddBlock = [this](Block* block, Expression*& other) -> Block* {
         // if other is a suffix of the block, wrap it in a block
-        if (block->list.empty() ||
-            !ExpressionAnalyzer::equal(other, block->list.back())) {
+        if (block->list.empty() || !areEqual(other, block->list.back())) {
           return nullptr;
         }
         // do it, assign to the out param `other`, and return the block
@@ -277,6 +301,7 @@ struct CodeFolding : public WalkerPass<ControlFlowWalker<CodeFolding>> {
       returnTails.clear();
       unoptimizables.clear();
       modifieds.clear();
+      hashes.clear();
       // if we did any work, types may need to be propagated
       if (anotherPass) {
         ReFinalize().walkFunctionInModule(func, getModule());
@@ -380,7 +405,7 @@ private:
       }
       auto* item = getMergeable(tails[0], num);
       for (auto& tail : tails) {
-        if (!ExpressionAnalyzer::equal(item, getMergeable(tail, num))) {
+        if (!areEqual(item, getMergeable(tail, num))) {
           // one of the lists has a different item
           stop = true;
           break;
@@ -603,20 +628,18 @@ private:
     if (next.size() >= 2) {
       // now we want to find a mergeable item - any item that is equal among a
       // subset
-      std::map<Expression*, size_t> hashes; // expression => hash value
       // hash value => expressions with that hash
       std::map<size_t, std::vector<Expression*>> hashed;
       for (auto& tail : next) {
         auto* item = getItem(tail, num);
-        auto hash = hashes[item] = ExpressionAnalyzer::hash(item);
-        hashed[hash].push_back(item);
+        hashed[getHash(item)].push_back(item);
       }
       // look at each hash value exactly once. we do this in a deterministic
       // order by iterating over a vector retaining insertion order.
       std::set<size_t> seen;
       for (auto& tail : next) {
         auto* item = getItem(tail, num);
-        auto digest = hashes[item];
+        auto digest = getHash(item);
         if (!seen.emplace(digest).second) {
           continue;
         }
@@ -636,7 +659,7 @@ private:
                            [&](Expression* item) {
                              if (item ==
                                    first || // don't bother comparing the first
-                                 ExpressionAnalyzer::equal(item, first)) {
+                                 areEqual(item, first)) {
                                // equal, keep it
                                return false;
                              } else {
@@ -654,8 +677,7 @@ private:
                                          explore.end(),
                                          [&](Tail& tail) {
                                            auto* item = getItem(tail, num);
-                                           return !ExpressionAnalyzer::equal(
-                                             item, correct);
+                                           return !areEqual(item, correct);
                                          }),
                           explore.end());
             // try to optimize this deeper tail. if we succeed, then stop here,
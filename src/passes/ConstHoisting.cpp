@@ -41,7 +41,11 @@ namespace wasm {
 // with fewer uses than this, it is never beneficial to hoist
 static const Index MIN_USES = 2;
 
-struct ConstHoisting : public WalkerPass<PostWalker<ConstHoisting>> {
+// We only need to see consts (visitFunction is called directly by the walker,
+// not through the scan), so a filtered walker avoids pushing a visit task for
+// every other node.
+struct ConstHoisting
+  : public WalkerPass<FilteredPostWalker<ConstHoisting, Expression::ConstId>> {
   bool isFunctionParallel() override { return true; }
 
   Pass* create() override { return new ConstHoisting; }
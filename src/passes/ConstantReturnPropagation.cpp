@@ -0,0 +1,187 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Find functions that always return the same constant value, and propagate
+// that value to their direct call sites: the call is kept for its other
+// effects (it may trap, or write to memory, etc.), and its value is replaced
+// by the constant. Later passes can then optimize using the constant, and
+// remove the call itself if it has no effects.
+//
+// This is a simple two-phase interprocedural analysis: first we summarize the
+// possible return values of each function, in parallel, then we rewrite call
+// sites, also in parallel. That makes it much cheaper than a full inference
+// over the entire program, while covering the common case of accessor-like
+// functions that return a constant.
+//
+
+#include "ir/branch-utils.h"
+#include "ir/module-utils.h"
+#include "ir/possible-constant.h"
+#include "ir/properties.h"
+#include "ir/utils.h"
+#include "pass.h"
+#include "wasm-builder.h"
+#include "wasm.h"
+
+namespace wasm {
+
+namespace {
+
+// The summary of a function: the possible values it can return.
+struct ReturnInfo {
+  PossibleConstantValues value;
+};
+
+// Rewrite calls to functions we found to return a constant.
+struct CallUpdater : public WalkerPass<PostWalker<CallUpdater>> {
+  bool isFunctionParallel() override { return true; }
+
+  Pass* create() override { return new CallUpdater(returnValues); }
+
+  CallUpdater(std::unordered_map<Name, PossibleConstantValues>& returnValues)
+    : returnValues(returnValues) {}
+
+  void visitCall(Call* curr) {
+    if (curr->isReturn || !curr->type.isConcrete()) {
+      // A return_call's value is not used in this function, and a call whose
+      // type is not concrete either has no value or is unreachable anyhow.
+      return;
+    }
+    auto iter = returnValues.find(curr->target);
+    if (iter == returnValues.end()) {
+      return;
+    }
+    // Keep the call for its other effects, and place the constant value
+    // after it.
+    Builder builder(*getModule());
+    auto* value = iter->second.makeExpression(*getModule());
+    replaceCurrent(builder.makeSequence(builder.makeDrop(curr), value));
+    changed = true;
+  }
+
+  void doWalkFunction(Function* func) {
+    WalkerPass<PostWalker<CallUpdater>>::doWalkFunction(func);
+
+    // If we changed anything, we need to update parent types, as the constant
+    // may have a more refined type than the call.
+    if (changed) {
+      ReFinalize().walkFunctionInModule(func, getModule());
+    }
+  }
+
+private:
+  std::unordered_map<Name, PossibleConstantValues>& returnValues;
+
+  bool changed = false;
+};
+
+struct ConstantReturnPropagation : public Pass {
+  void run(PassRunner* runner, Module* module) override {
+    // Phase one: summarize the possible return values of each function.
+    ModuleUtils::ParallelFunctionAnalysis<ReturnInfo> analysis(
+      *module, [&](Function* func, ReturnInfo& info) {
+        if (func->imported()) {
+          info.value.noteUnknown();
+          return;
+        }
+        auto results = func->getResults();
+        if (!results.isConcrete() || results.isTuple()) {
+          // Nothing to propagate from a function with no value. (Tuples could
+          // be handled, but are rare enough to not be worth it. TODO)
+          info.value.noteUnknown();
+          return;
+        }
+        noteExitValues(func, *module, runner->options, info.value);
+      });
+
+    // Keep only the functions that definitely return a single constant.
+    std::unordered_map<Name, PossibleConstantValues> returnValues;
+    for (auto& [func, info] : analysis.map) {
+      if (info.value.isConstant()) {
+        returnValues[func->name] = info.value;
+      }
+    }
+    if (returnValues.empty()) {
+      return;
+    }
+
+    // Phase two: rewrite call sites.
+    CallUpdater(returnValues).run(runner, module);
+  }
+
+  // Note every value that can flow out of a function: the value of each
+  // return, of each branch to the outermost block (if the body is one), and
+  // of the body itself if it flows a value out.
+  static void noteExitValues(Function* func,
+                             Module& wasm,
+                             const PassOptions& options,
+                             PossibleConstantValues& value) {
+    Name exitName;
+    if (auto* block = func->body->dynCast<Block>()) {
+      exitName = block->name;
+    }
+
+    struct Noter : public PostWalker<Noter, UnifiedExpressionVisitor<Noter>> {
+      Module& wasm;
+      const PassOptions& options;
+      PossibleConstantValues& value;
+      Name exitName;
+
+      Noter(Module& wasm,
+            const PassOptions& options,
+            PossibleConstantValues& value,
+            Name exitName)
+        : wasm(wasm), options(options), value(value), exitName(exitName) {}
+
+      void noteValue(Expression* curr) {
+        value.note(Properties::getFallthrough(curr, options, wasm), wasm);
+      }
+
+      void visitExpression(Expression* curr) {
+        if (auto* ret = curr->dynCast<Return>()) {
+          noteValue(ret->value);
+          return;
+        }
+        if (exitName.is()) {
+          // Note anything sent to the outermost block. An inner block may
+          // shadow that name, in which case we note a value that does not
+          // actually exit the function, but that can only make us more
+          // conservative, never wrong.
+          BranchUtils::operateOnScopeNameUsesAndSentValues(
+            curr, [&](Name name, Expression* sent) {
+              if (name == exitName && sent) {
+                noteValue(sent);
+              }
+            });
+        }
+      }
+    } noter(wasm, options, value, exitName);
+
+    noter.walk(func->body);
+    if (func->body->type != Type::unreachable) {
+      noter.noteValue(func->body);
+    }
+  }
+};
+
+} // anonymous namespace
+
+Pass* createConstantReturnPropagationPass() {
+  return new ConstantReturnPropagation();
+}
+
+} // namespace wasm
@@ -0,0 +1,130 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Instruments the build with execution counters at each function entry, loop
+// header, and return - the same sites that log-execution instruments, but
+// instead of calling out to an imported logger at each site (unusably slow
+// for production use), each site increments a 64-bit counter in memory
+// inline. That keeps the overhead low enough to gather block-frequency
+// profiles from production runs, which can then inform layout decisions.
+//
+// The counters are appended after the module's initial memory, and a single
+// export, "get_execution_count", reads a counter back out by its site id.
+// Site ids are assigned deterministically - functions in module order, sites
+// in post-order inside each function - so they are stable across builds of
+// the same code, and a profile from one build can be applied to another.
+//
+// The counter updates are not atomic; in a threaded build, increments may
+// occasionally be lost, which is acceptable for profiling.
+//
+
+#include "shared-constants.h"
+#include <pass.h>
+#include <wasm-builder.h>
+#include <wasm.h>
+
+namespace wasm {
+
+static Name GET_COUNT("get_execution_count");
+
+struct CountExecution : public WalkerPass<PostWalker<CountExecution>> {
+  void visitLoop(Loop* curr) { curr->body = makeCountIncrement(curr->body); }
+
+  void visitReturn(Return* curr) { replaceCurrent(makeCountIncrement(curr)); }
+
+  void visitFunction(Function* curr) {
+    if (curr->imported()) {
+      return;
+    }
+    curr->body = makeCountIncrement(curr->body);
+  }
+
+  void doWalkModule(Module* curr) {
+    // The counters live right after the initial memory, whose size we must
+    // note before we add any of them.
+    if (curr->memory.exists) {
+      base = curr->memory.initial * Memory::kPageSize;
+    }
+    super::doWalkModule(curr);
+  }
+
+  void visitModule(Module* curr) {
+    // Allocate room for the counters. Fresh pages are zero-initialized, so
+    // the counters need no explicit setup.
+    auto& memory = curr->memory;
+    memory.exists = true;
+    Address pages =
+      (numSites * 8 + Memory::kPageSize - 1) / Memory::kPageSize;
+    memory.initial = memory.initial + pages;
+    if (memory.hasMax() && memory.max < memory.initial) {
+      memory.max = memory.initial;
+    }
+
+    // Add the export that reads a counter back out, given a site id.
+    Builder builder(*curr);
+    auto getter =
+      Builder::makeFunction(GET_COUNT, Signature(Type::i32, Type::i64), {});
+    auto* scaled = builder.makeBinary(MulInt32,
+                                      builder.makeLocalGet(0, Type::i32),
+                                      builder.makeConst(int32_t(8)));
+    Expression* ptr;
+    if (memory.is64()) {
+      ptr = builder.makeBinary(AddInt64,
+                               builder.makeConst(int64_t(base)),
+                               builder.makeUnary(ExtendUInt32, scaled));
+    } else {
+      ptr =
+        builder.makeBinary(AddInt32, builder.makeConst(int32_t(base)), scaled);
+    }
+    getter->body = builder.makeLoad(8, false, 0, 8, ptr, Type::i64);
+    curr->addFunction(std::move(getter));
+    curr->addExport(
+      builder.makeExport(GET_COUNT, GET_COUNT, ExternalKind::Function));
+  }
+
+private:
+  // The address at which the counters begin.
+  uint64_t base = 0;
+
+  // The number of instrumented sites so far; the next site's id.
+  Index numSites = 0;
+
+  Expression* makeCountIncrement(Expression* curr) {
+    Builder builder(*getModule());
+    auto indexType = getModule()->memory.indexType;
+    uint64_t addr = base + uint64_t(numSites++) * 8;
+    auto makePtr = [&]() {
+      return builder.makeConst(Literal::makeFromInt64(addr, indexType));
+    };
+    return builder.makeSequence(
+      builder.makeStore(
+        8,
+        0,
+        8,
+        makePtr(),
+        builder.makeBinary(AddInt64,
+                           builder.makeLoad(8, false, 0, 8, makePtr(),
+                                            Type::i64),
+                           builder.makeConst(int64_t(1))),
+        Type::i64),
+      curr);
+  }
+};
+
+Pass* createCountExecutionPass() { return new CountExecution(); }
+
+} // namespace wasm
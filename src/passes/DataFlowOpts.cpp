@@ -56,7 +56,7 @@ struct DataFlowOpts : public WalkerPass<PostWalker<DataFlowOpts>> {
     // Propagate optimizations through the graph.
     std::unordered_set<DataFlow::Node*> optimized; // which nodes we optimized
     for (auto& node : graph.nodes) {
-      workLeft.insert(node.get()); // we should try to optimize each node
+      workLeft.insert(&node); // we should try to optimize each node
     }
     while (!workLeft.empty()) {
       // std::cout << "\n\ndump before work iter\n";
@@ -199,8 +199,10 @@ struct DAE : public Pass {
     }
     // Scan all the functions.
     scanner.run(runner, module);
-    // Combine all the info.
-    std::map<Name, std::vector<Call*>> allCalls;
+    // Combine all the info. (An unordered map suffices here: the loops below
+    // that use this iterate in the deterministic order of module->functions,
+    // not in map order.)
+    std::unordered_map<Name, std::vector<Call*>> allCalls;
     std::unordered_set<Name> tailCallees;
     for (auto& [_, info] : infoMap) {
       for (auto& [name, calls] : info.calls) {
@@ -217,28 +219,37 @@ struct DAE : public Pass {
     // If we refine return types then we will need to do more type updating
     // at the end.
     bool refinedReturnTypes = false;
+    // As we refine argument types in the loop below we queue up the functions
+    // that need refinalization, and do that once at the end, in parallel,
+    // rather than with a serial walk per function here.
+    DeferredReFinalize deferredReFinalize(*module);
     // We now have a mapping of all call sites for each function, and can look
     // for optimization opportunities.
-    for (auto& [name, calls] : allCalls) {
+    for (auto& func : module->functions) {
+      auto iter = allCalls.find(func->name);
+      if (iter == allCalls.end()) {
+        continue;
+      }
+      auto& calls = iter->second;
+      auto& info = infoMap[func->name];
       // We can only optimize if we see all the calls and can modify them.
-      if (infoMap[name].hasUnseenCalls) {
+      if (info.hasUnseenCalls) {
         continue;
       }
-      auto* func = module->getFunction(name);
       // Refine argument types before doing anything else. This does not
       // affect whether an argument is used or not, it just refines the type
       // where possible.
-      refineArgumentTypes(func, calls, module, infoMap[name]);
+      refineArgumentTypes(func.get(), calls, module, info, deferredReFinalize);
       // Refine return types as well.
-      if (refineReturnTypes(func, calls, module)) {
+      if (refineReturnTypes(func.get(), calls, module)) {
         refinedReturnTypes = true;
       }
       auto optimizedIndexes =
-        ParamUtils::applyConstantValues({func}, calls, {}, module);
+        ParamUtils::applyConstantValues({func.get()}, calls, {}, module);
       for (auto i : optimizedIndexes) {
         // Mark it as unused, which we know it now is (no point to re-scan just
         // for that).
-        infoMap[name].unusedParams.insert(i);
+        info.unusedParams.insert(i);
       }
     }
     if (refinedReturnTypes) {
@@ -246,24 +257,31 @@ struct DAE : public Pass {
       // parents, and so we must refinalize.
       // TODO: We could track in which functions we actually make changes.
       ReFinalize().run(runner, module);
+      // The whole-module walk covers everything we queued up.
+      deferredReFinalize.clear();
+    } else {
+      deferredReFinalize.apply();
     }
     // Track which functions we changed, and optimize them later if necessary.
     std::unordered_set<Function*> changed;
     // We now know which parameters are unused, and can potentially remove them.
-    for (auto& [name, calls] : allCalls) {
-      if (infoMap[name].hasUnseenCalls) {
+    for (auto& func : module->functions) {
+      auto iter = allCalls.find(func->name);
+      if (iter == allCalls.end()) {
         continue;
       }
-      auto* func = module->getFunction(name);
-      auto numParams = func->getNumParams();
-      if (numParams == 0) {
+      auto& info = infoMap[func->name];
+      if (info.hasUnseenCalls) {
+        continue;
+      }
+      if (func->getNumParams() == 0) {
         continue;
       }
       auto removedIndexes = ParamUtils::removeParameters(
-        {func}, infoMap[name].unusedParams, calls, {}, module, runner);
+        {func.get()}, info.unusedParams, iter->second, {}, module, runner);
       if (!removedIndexes.empty()) {
         // Success!
-        changed.insert(func);
+        changed.insert(func.get());
       }
     }
     // We can also tell which calls have all their return values dropped. Note
@@ -356,7 +374,8 @@ private:
   void refineArgumentTypes(Function* func,
                            const std::vector<Call*>& calls,
                            Module* module,
-                           const DAEFunctionInfo& info) {
+                           const DAEFunctionInfo& info,
+                           DeferredReFinalize& deferredReFinalize) {
     if (!module->features.hasGC()) {
       return;
     }
@@ -401,7 +420,11 @@ private:
     }
 
     // We can do this!
-    TypeUpdating::updateParamTypes(func, newParamTypes, *module);
+    TypeUpdating::updateParamTypes(func,
+                                   newParamTypes,
+                                   *module,
+                                   TypeUpdating::LocalUpdatingMode::Update,
+                                   &deferredReFinalize);
 
     // Update anything the lubs need to update.
     for (auto& lub : lubs) {
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Devirtualize call_ref: when the GUFA oracle shows that only one function
+// can be the target of a call_ref, turn it into a direct call. We handle a
+// target that is
+//
+//  * a literal function reference,
+//  * an immutable global initialized with one, or
+//  * an exact function type of which exactly one function in the module can
+//    ever be referenced (by ref.func anywhere, or by being exported, which
+//    lets the host pass its reference back in).
+//
+// The target expression is kept for its side effects, behind a
+// ref.as_non_null when it is nullable, so a null still traps as the call_ref
+// would have.
+//
+// Guard chains over several possible targets ("if target is A, call A
+// directly, else..") would need to compare function references at runtime,
+// but ref.eq is not defined on them, so multi-target sites are left alone.
+//
+
+#include "ir/eh-utils.h"
+#include "ir/find_all.h"
+#include "ir/localize.h"
+#include "ir/module-utils.h"
+#include "ir/possible-contents.h"
+#include "ir/utils.h"
+#include "pass.h"
+#include "wasm-builder.h"
+#include "wasm.h"
+
+namespace wasm {
+
+namespace {
+
+// For each function heap type, the functions of exactly that type whose
+// reference can exist at runtime.
+using ReferableFuncs = std::unordered_map<HeapType, std::vector<Name>>;
+
+struct Devirtualizer : public WalkerPass<PostWalker<Devirtualizer>> {
+  bool isFunctionParallel() override { return true; }
+
+  ContentOracle& oracle;
+  const ReferableFuncs& referable;
+
+  Devirtualizer(ContentOracle& oracle, const ReferableFuncs& referable)
+    : oracle(oracle), referable(referable) {}
+
+  Devirtualizer* create() override {
+    return new Devirtualizer(oracle, referable);
+  }
+
+  bool optimized = false;
+
+  void visitCallRef(CallRef* curr) {
+    if (curr->target->type == Type::unreachable) {
+      return;
+    }
+    if (curr->type == Type::unreachable && !curr->isReturn) {
+      // An operand is unreachable; the call never happens.
+      return;
+    }
+    if (curr->isReturn) {
+      // A return_call_ref is always unreachable, so check the children
+      // directly.
+      for (auto* operand : curr->operands) {
+        if (operand->type == Type::unreachable) {
+          return;
+        }
+      }
+    }
+
+    auto contents = oracle.getContents(ExpressionLocation{curr->target, 0});
+    Name target;
+    if (contents.isLiteral()) {
+      auto literal = contents.getLiteral();
+      if (literal.isNull()) {
+        // This can only trap; leave that for GUFA/DCE.
+        return;
+      }
+      target = literal.getFunc();
+    } else if (contents.isGlobal()) {
+      auto* global = getModule()->getGlobal(contents.getGlobal());
+      if (global->mutable_ || !global->init ||
+          !global->init->is<RefFunc>()) {
+        return;
+      }
+      target = global->init->cast<RefFunc>()->func;
+    } else if (contents.isExactType()) {
+      auto type = contents.getType();
+      if (!type.isFunction()) {
+        return;
+      }
+      auto iter = referable.find(type.getHeapType());
+      if (iter == referable.end() || iter->second.size() != 1) {
+        return;
+      }
+      target = iter->second[0];
+    } else {
+      return;
+    }
+
+    // We have a single possible target. Localize interacting children so
+    // that we can evaluate the operands, then the target - kept just for its
+    // side effects, and to preserve the trap on null - and then do a direct
+    // call.
+    Builder builder(*getModule());
+    ChildLocalizer localizer(
+      curr, getFunction(), getModule(), getPassOptions());
+    std::vector<Expression*> items;
+    for (auto* set : localizer.sets) {
+      items.push_back(set);
+    }
+    auto* targetValue = curr->target;
+    if (targetValue->type.isNullable()) {
+      targetValue = builder.makeRefAs(RefAsNonNull, targetValue);
+    }
+    items.push_back(builder.makeDrop(targetValue));
+    std::vector<Expression*> operands(curr->operands.begin(),
+                                      curr->operands.end());
+    items.push_back(
+      builder.makeCall(target, operands, curr->type, curr->isReturn));
+    replaceCurrent(builder.makeBlock(items));
+    optimized = true;
+  }
+
+  void visitFunction(Function* func) {
+    if (!optimized) {
+      return;
+    }
+    // Our new blocks may change types, and may wrap pops.
+    ReFinalize().walkFunctionInModule(func, getModule());
+    EHUtils::handleBlockNestedPops(func, *getModule());
+  }
+};
+
+struct Devirtualize : public Pass {
+  void run(PassRunner* runner, Module* module) override {
+    if (getTypeSystem() != TypeSystem::Nominal &&
+        getTypeSystem() != TypeSystem::Isorecursive) {
+      Fatal() << "Devirtualize requires nominal/hybrid typing";
+    }
+
+    // Find every function whose reference can exist at runtime: anything in
+    // a ref.func - in function bodies, global initializers, or element
+    // segments - and anything exported, as the host can send an exported
+    // function's reference back in.
+    ModuleUtils::ParallelFunctionAnalysis<std::vector<Name>> scan(
+      *module, [&](Function* func, std::vector<Name>& refs) {
+        if (func->imported()) {
+          return;
+        }
+        for (auto* refFunc : FindAll<RefFunc>(func->body).list) {
+          refs.push_back(refFunc->func);
+        }
+      });
+    std::unordered_set<Name> referenced;
+    for (auto& [_, refs] : scan.map) {
+      referenced.insert(refs.begin(), refs.end());
+    }
+    for (auto& global : module->globals) {
+      if (!global->imported()) {
+        for (auto* refFunc : FindAll<RefFunc>(global->init).list) {
+          referenced.insert(refFunc->func);
+        }
+      }
+    }
+    for (auto& segment : module->elementSegments) {
+      for (auto* item : segment->data) {
+        if (auto* refFunc = item->dynCast<RefFunc>()) {
+          referenced.insert(refFunc->func);
+        }
+      }
+    }
+    for (auto& exp : module->exports) {
+      if (exp->kind == ExternalKind::Function) {
+        referenced.insert(exp->value);
+      }
+    }
+    ReferableFuncs referable;
+    for (auto name : referenced) {
+      referable[module->getFunction(name)->type].push_back(name);
+    }
+
+    ContentOracle oracle(*module);
+    Devirtualizer(oracle, referable).run(runner, module);
+  }
+};
+
+} // anonymous namespace
+
+Pass* createDevirtualizePass() { return new Devirtualize(); }
+
+} // namespace wasm
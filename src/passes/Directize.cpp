@@ -112,8 +112,7 @@ private:
     if (!name.is()) {
       return CallUtils::Trap{};
     }
-    auto* func = getModule()->getFunction(name);
-    if (original->heapType != func->type) {
+    if (original->heapType != flatTable.types[index]) {
       return CallUtils::Trap{};
     }
     return CallUtils::Known{name};
@@ -209,10 +208,11 @@ struct Directize : public Pass {
         continue;
       }
 
-      // All conditions are valid, this is optimizable.
+      // All conditions are valid, this is optimizable. Move the table data
+      // into the map rather than copying it, as it can be very large.
       TableUtils::FlatTable flatTable(*module, *table);
       if (flatTable.valid) {
-        validTables.emplace(table->name, flatTable);
+        validTables.emplace(table->name, std::move(flatTable));
       }
     }
 
@@ -24,12 +24,55 @@
 #include "ir/hashed.h"
 #include "ir/module-utils.h"
 #include "ir/utils.h"
-#include "opt-utils.h"
 #include "pass.h"
 #include "wasm.h"
 
 namespace wasm {
 
+// Replaces uses of the removed duplicate functions, like
+// OptUtils::FunctionRefReplacer, but also re-hashes each function that it
+// changes. That way the hashes of all the unchanged functions - typically the
+// vast majority - stay valid across iterations and never need recomputing.
+struct FunctionReplacerAndRehasher
+  : public WalkerPass<PostWalker<FunctionReplacerAndRehasher>> {
+  bool isFunctionParallel() override { return true; }
+
+  FunctionReplacerAndRehasher(const std::map<Name, Name>& replacements,
+                              FunctionHasher::Map* hashes)
+    : replacements(replacements), hashes(hashes) {}
+
+  FunctionReplacerAndRehasher* create() override {
+    return new FunctionReplacerAndRehasher(replacements, hashes);
+  }
+
+  void maybeReplace(Name& name) {
+    auto iter = replacements.find(name);
+    if (iter != replacements.end()) {
+      name = iter->second;
+      changed = true;
+    }
+  }
+
+  void visitCall(Call* curr) { maybeReplace(curr->target); }
+
+  void visitRefFunc(RefFunc* curr) { maybeReplace(curr->func); }
+
+  void doWalkFunction(Function* func) {
+    changed = false;
+    PostWalker<FunctionReplacerAndRehasher>::doWalkFunction(func);
+    if (changed) {
+      // Each function has a pre-existing entry in the map, so writing our own
+      // entry here in parallel is safe.
+      hashes->at(func) = FunctionHasher::hashFunction(func);
+    }
+  }
+
+private:
+  const std::map<Name, Name>& replacements;
+  FunctionHasher::Map* hashes;
+  bool changed = false;
+};
+
 struct DuplicateFunctionElimination : public Pass {
   // FIXME Merge DWARF info
   bool invalidatesDWARF() override { return true; }
@@ -49,11 +92,13 @@ struct DuplicateFunctionElimination : public Pass {
     } else {
       limit = 1;
     }
+    // Hash all the functions. We do this just once: when we make replacements
+    // below we update the hashes of only the functions that changed, so that
+    // later iterations do not re-hash the entire module.
+    auto hashes = FunctionHasher::createMap(module);
+    FunctionHasher(&hashes).run(runner, module);
     while (limit > 0) {
       limit--;
-      // Hash all the functions
-      auto hashes = FunctionHasher::createMap(module);
-      FunctionHasher(&hashes).run(runner, module);
       // Find hash-equal groups
       std::map<uint32_t, std::vector<Function*>> hashGroups;
       ModuleUtils::iterDefinedFunctions(*module, [&](Function* func) {
@@ -90,10 +135,26 @@ struct DuplicateFunctionElimination : public Pass {
       }
       // perform replacements
       if (replacements.size() > 0) {
-        // remove the duplicates
+        // remove the duplicates, dropping their cached hashes first
+        for (auto name : duplicates) {
+          hashes.erase(module->getFunction(name));
+        }
         module->removeFunctions(
           [&](Function* func) { return duplicates.count(func->name) > 0; });
-        OptUtils::replaceFunctions(runner, *module, replacements);
+        // Update the references to the removed functions, re-hashing the
+        // functions we change as we go. This mirrors
+        // OptUtils::replaceFunctions, aside from keeping the hashes fresh.
+        FunctionReplacerAndRehasher replacer(replacements, &hashes);
+        replacer.run(runner, module);
+        replacer.runOnModuleCode(runner, module);
+        if (module->start.is()) {
+          replacer.maybeReplace(module->start);
+        }
+        for (auto& exp : module->exports) {
+          if (exp->kind == ExternalKind::Function) {
+            replacer.maybeReplace(exp->value);
+          }
+        }
       } else {
         break;
       }
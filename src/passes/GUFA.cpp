@@ -40,6 +40,9 @@
 //       them, and devirtualize to a call to B.
 //
 
+#include <atomic>
+#include <optional>
+
 #include "ir/drop.h"
 #include "ir/eh-utils.h"
 #include "ir/possible-contents.h"
@@ -60,11 +63,17 @@ struct GUFAOptimizer
   ContentOracle& oracle;
   bool optimizing;
 
-  GUFAOptimizer(ContentOracle& oracle, bool optimizing)
-    : oracle(oracle), optimizing(optimizing) {}
+  // Shared among the parallel copies of this pass, so that after the run the
+  // creator can see whether anything at all was optimized.
+  std::atomic<bool>& anyOptimized;
+
+  GUFAOptimizer(ContentOracle& oracle,
+                bool optimizing,
+                std::atomic<bool>& anyOptimized)
+    : oracle(oracle), optimizing(optimizing), anyOptimized(anyOptimized) {}
 
   GUFAOptimizer* create() override {
-    return new GUFAOptimizer(oracle, optimizing);
+    return new GUFAOptimizer(oracle, optimizing, anyOptimized);
   }
 
   bool optimized = false;
@@ -196,6 +205,8 @@ struct GUFAOptimizer
       return;
     }
 
+    anyOptimized = true;
+
     // Optimization may introduce more unreachables, which we need to
     // propagate.
     ReFinalize().walkFunctionInModule(func, getModule());
@@ -250,8 +261,36 @@ struct GUFAPass : public Pass {
   GUFAPass(bool optimizing) : optimizing(optimizing) {}
 
   void run(PassRunner* runner, Module* module) override {
-    ContentOracle oracle(*module);
-    GUFAOptimizer(oracle, optimizing).run(runner, module);
+    // Normally we analyze and optimize once, but the user can ask for
+    // multiple iterations, as each round of optimization can make the next
+    // analysis more precise. Iterations after the first reuse the previous
+    // oracle's stable contents (the ones not keyed by a particular
+    // Expression*, see getReusableContents) to warm-start the flow, which
+    // amortizes the analysis instead of recomputing it all from zero. (A
+    // fully incremental reflow - tracking exactly which locations other
+    // passes invalidated - is not possible, as most of the analysis is keyed
+    // by Expression pointers that dangle once the IR is rewritten.)
+    Index iterations = std::max(
+      1,
+      atoi(
+        runner->options.getArgumentOrDefault("gufa-iterations", "1").c_str()));
+    std::unordered_map<Location, PossibleContents> reusable;
+    for (Index i = 0; i < iterations; i++) {
+      std::optional<ContentOracle> oracle;
+      if (i == 0) {
+        oracle.emplace(*module);
+      } else {
+        oracle.emplace(*module, reusable);
+      }
+      std::atomic<bool> anyOptimized{false};
+      GUFAOptimizer(*oracle, optimizing, anyOptimized).run(runner, module);
+      if (!anyOptimized || i + 1 == iterations) {
+        // Nothing changed (so another analysis would find nothing new), or we
+        // are done anyhow.
+        break;
+      }
+      reusable = oracle->getReusableContents();
+    }
   }
 };
 
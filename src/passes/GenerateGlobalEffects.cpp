@@ -0,0 +1,131 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Computes the total effects of each function - what it does directly, plus
+// what everything it can call does - and stores that in the PassOptions for
+// EffectAnalyzer to use when it sees a direct call. With that, passes like
+// Vacuum and LoopInvariantCodeMotion no longer need to assume the worst
+// around calls to pure helpers.
+//
+// The summaries are built bottom-up over the call graph: a function's effects
+// can only be summarized if all the functions it calls have been summarized
+// already. Functions that are imported, do non-direct calls (CallIndirect or
+// CallRef), or call - even transitively - something in those categories get
+// no summary, and calls to them keep the worst-case assumption. Mutually
+// recursive functions also get no summary, which conveniently sidesteps
+// reasoning about whether the recursion terminates.
+//
+// The summaries remain valid only while the analyzed code is: a pass that may
+// add new effects to a function must be preceded by discard-global-effects.
+//
+
+#include "ir/effects.h"
+#include "ir/module-utils.h"
+#include "pass.h"
+#include "support/unique_deferring_queue.h"
+#include "wasm.h"
+
+namespace wasm {
+
+namespace {
+
+struct GenerateGlobalEffects : public Pass {
+  void run(PassRunner* runner, Module* module) override {
+    // Any older map refers to code that may have changed; start afresh.
+    runner->options.funcEffectsMap.reset();
+
+    // Build the call graph. We need no extra per-function info beyond what
+    // the analysis itself gathers.
+    struct Info
+      : public ModuleUtils::CallGraphPropertyAnalysis<Info>::FunctionInfo {
+      bool unknown = false;
+    };
+    ModuleUtils::CallGraphPropertyAnalysis<Info> analysis(
+      *module, [&](Function* func, Info& info) {
+        // We cannot see into an import at all.
+        info.unknown = func->imported();
+      });
+
+    // Mark everything that can reach unknown effects as unknown itself.
+    analysis.propagateBack([](const Info& info) { return info.unknown; },
+                           [](const Info& info) { return true; },
+                           [](Info& info, Function* reason) {
+                             info.unknown = true;
+                           },
+                           analysis.NonDirectCallsHaveProperty);
+
+    // Summarize bottom-up: a function is ready once all its callees have
+    // summaries. We grow the map as we go, and install it in a copy of the
+    // options, so that EffectAnalyzer resolves the calls we have already
+    // summarized while we analyze their callers. Functions in a recursive
+    // cycle never become ready, and are left without a summary.
+    auto map = std::make_shared<FuncEffectsMap>();
+    auto analysisOptions = runner->options;
+    analysisOptions.funcEffectsMap = map;
+
+    std::unordered_map<Function*, Index> remainingCallees;
+    UniqueDeferredQueue<Function*> ready;
+    for (auto& [func, info] : analysis.map) {
+      if (info.unknown) {
+        continue;
+      }
+      Index count = 0;
+      for (auto* target : info.callsTo) {
+        if (target != func) {
+          count++;
+        } else {
+          // A self-call is a cycle of length one.
+          info.unknown = true;
+        }
+      }
+      remainingCallees[func] = count;
+      if (count == 0 && !info.unknown) {
+        ready.push(func);
+      }
+    }
+    while (!ready.empty()) {
+      auto* func = ready.pop();
+      EffectAnalyzer effects(analysisOptions, *module, func->body);
+      // Effects on the function's own locals are not observable outside of
+      // it, so a caller must not inherit them.
+      effects.localsRead.clear();
+      effects.localsWritten.clear();
+      map->emplace(func->name, std::move(effects));
+      for (auto* caller : analysis.map[func].calledBy) {
+        if (!analysis.map[caller].unknown && --remainingCallees[caller] == 0) {
+          ready.push(caller);
+        }
+      }
+    }
+
+    runner->options.funcEffectsMap = map;
+  }
+};
+
+struct DiscardGlobalEffects : public Pass {
+  void run(PassRunner* runner, Module* module) override {
+    runner->options.funcEffectsMap.reset();
+  }
+};
+
+} // anonymous namespace
+
+Pass* createGenerateGlobalEffectsPass() { return new GenerateGlobalEffects(); }
+
+Pass* createDiscardGlobalEffectsPass() { return new DiscardGlobalEffects(); }
+
+} // namespace wasm
@@ -61,6 +61,11 @@ struct GlobalStructInference : public Pass {
   // them. If a global is not present here, it cannot be optimized.
   std::unordered_map<HeapType, std::vector<Name>> typeGlobals;
 
+  // The functions that contain a struct.get of an optimizable type. All other
+  // functions can be skipped entirely in the optimization phase. Typically
+  // only a few types end up optimizable, so this skips most functions.
+  std::unordered_set<Function*> relevantFuncs;
+
   void run(PassRunner* runner, Module* module) override {
     if (!module->features.hasGC()) {
       return;
@@ -75,8 +80,16 @@ struct GlobalStructInference : public Pass {
 
     using HeapTypes = std::unordered_set<HeapType>;
 
-    ModuleUtils::ParallelFunctionAnalysis<HeapTypes> analysis(
-      *module, [&](Function* func, HeapTypes& types) {
+    // While scanning for struct.news we also note which heap types each
+    // function reads with a struct.get, so that later we can skip functions
+    // that cannot possibly contain anything to optimize.
+    struct Scan {
+      HeapTypes news;
+      HeapTypes gets;
+    };
+
+    ModuleUtils::ParallelFunctionAnalysis<Scan> analysis(
+      *module, [&](Function* func, Scan& scan) {
         if (func->imported()) {
           return;
         }
@@ -84,7 +97,13 @@ struct GlobalStructInference : public Pass {
         for (auto* structNew : FindAll<StructNew>(func->body).list) {
           auto type = structNew->type;
           if (type.isRef()) {
-            types.insert(type.getHeapType());
+            scan.news.insert(type.getHeapType());
+          }
+        }
+        for (auto* structGet : FindAll<StructGet>(func->body).list) {
+          auto type = structGet->ref->type;
+          if (type.isRef()) {
+            scan.gets.insert(type.getHeapType());
           }
         }
       });
@@ -93,8 +112,8 @@ struct GlobalStructInference : public Pass {
     // we just collected and merge now.
     HeapTypes unoptimizable;
 
-    for (auto& [func, types] : analysis.map) {
-      for (auto type : types) {
+    for (auto& [func, scan] : analysis.map) {
+      for (auto type : scan.news) {
         unoptimizable.insert(type);
       }
     }
@@ -170,6 +189,20 @@ struct GlobalStructInference : public Pass {
       return;
     }
 
+    // Find the functions that read an optimizable type; only they need to be
+    // walked below.
+    for (auto& [func, scan] : analysis.map) {
+      for (auto type : scan.gets) {
+        if (typeGlobals.count(type)) {
+          relevantFuncs.insert(func);
+          break;
+        }
+      }
+    }
+    if (relevantFuncs.empty()) {
+      return;
+    }
+
     // Optimize based on the above.
     struct FunctionOptimizer
       : public WalkerPass<PostWalker<FunctionOptimizer>> {
@@ -179,6 +212,13 @@ struct GlobalStructInference : public Pass {
 
       FunctionOptimizer(GlobalStructInference& parent) : parent(parent) {}
 
+      void doWalkFunction(Function* func) {
+        // Only walk functions the scan found a relevant struct.get in.
+        if (parent.relevantFuncs.count(func)) {
+          PostWalker<FunctionOptimizer>::doWalkFunction(func);
+        }
+      }
+
       void visitStructGet(StructGet* curr) {
         auto type = curr->ref->type;
         if (type == Type::unreachable) {
@@ -150,6 +150,8 @@
 // This optimization focuses on such cases.
 //
 
+#include <optional>
+
 #include "ir/branch-utils.h"
 #include "ir/find_all.h"
 #include "ir/local-graph.h"
@@ -192,38 +194,77 @@ struct Heap2LocalOptimizer {
     // flow to.
     localGraph.computeSetInfluences();
 
-    // All the allocations in the function.
-    // TODO: Arrays (of constant size) as well.
-    FindAll<StructNew> allocations(func->body);
+    // All the allocations in the function: structs, and arrays whose size is
+    // a known constant.
+    std::vector<Expression*> allocations;
+    for (auto* structNew : FindAll<StructNew>(func->body).list) {
+      allocations.push_back(structNew);
+    }
+    for (auto* arrayNew : FindAll<ArrayNew>(func->body).list) {
+      allocations.push_back(arrayNew);
+    }
+    for (auto* arrayInit : FindAll<ArrayInit>(func->body).list) {
+      allocations.push_back(arrayInit);
+    }
 
-    for (auto* allocation : allocations.list) {
+    for (auto* allocation : allocations) {
       // The point of this optimization is to replace heap allocations with
       // locals, so we must be able to place the data in locals.
-      if (!canHandleAsLocals(allocation->type)) {
-        continue;
-      }
-
-      if (convertToLocals(allocation)) {
-        optimized = true;
+      if (auto localTypes = getLocalTypes(allocation)) {
+        if (convertToLocals(allocation, *localTypes)) {
+          optimized = true;
+        }
       }
     }
   }
 
-  bool canHandleAsLocals(Type type) {
-    if (type == Type::unreachable) {
-      return false;
+  // Arrays larger than this have too many elements to be worth placing in
+  // locals, as each element becomes a local, which would bloat the code (and
+  // such large arrays are typically indexed dynamically anyhow, which we
+  // cannot optimize).
+  static const Index MaximumArraySize = 20;
+
+  // Returns the types of the locals that would hold the allocation's data:
+  // the struct's field types, or the array's element type repeated for each
+  // element. Returns nothing if we cannot handle the allocation.
+  std::optional<std::vector<Type>> getLocalTypes(Expression* allocation) {
+    if (allocation->type == Type::unreachable) {
+      return std::nullopt;
     }
-    auto& fields = type.getHeapType().getStruct().fields;
-    for (auto field : fields) {
-      if (!TypeUpdating::canHandleAsLocal(field.type)) {
-        return false;
+    auto heapType = allocation->type.getHeapType();
+    if (heapType.isStruct()) {
+      std::vector<Type> types;
+      for (auto field : heapType.getStruct().fields) {
+        if (!TypeUpdating::canHandleAsLocal(field.type)) {
+          return std::nullopt;
+        }
+        if (field.isPacked()) {
+          // TODO: support packed fields by adding coercions/truncations.
+          return std::nullopt;
+        }
+        types.push_back(field.type);
       }
-      if (field.isPacked()) {
-        // TODO: support packed fields by adding coercions/truncations.
-        return false;
+      return types;
+    }
+    // An array. We must know how many elements it has.
+    Index size;
+    if (auto* arrayNew = allocation->dynCast<ArrayNew>()) {
+      auto* c = arrayNew->size->dynCast<Const>();
+      if (!c) {
+        return std::nullopt;
       }
+      size = c->value.geti32();
+    } else {
+      size = allocation->cast<ArrayInit>()->values.size();
     }
-    return true;
+    if (size > MaximumArraySize) {
+      return std::nullopt;
+    }
+    auto element = heapType.getArray().element;
+    if (!TypeUpdating::canHandleAsLocal(element.type) || element.isPacked()) {
+      return std::nullopt;
+    }
+    return std::vector<Type>(size, element.type);
   }
 
   // Handles the rewriting that we do to perform the optimization. We store the
@@ -233,14 +274,20 @@ struct Heap2LocalOptimizer {
   // TODO: Doing a single rewrite walk at the end would be more efficient, but
   //       it would need to be more complex.
   struct Rewriter : PostWalker<Rewriter> {
-    StructNew* allocation;
+    Expression* allocation;
     Function* func;
     Builder builder;
-    const FieldList& fields;
 
-    Rewriter(StructNew* allocation, Function* func, Module* module)
+    // The types of the locals that replace the allocation's data: the
+    // struct's field types, or the array's element type for each element.
+    const std::vector<Type>& localTypes;
+
+    Rewriter(Expression* allocation,
+             const std::vector<Type>& localTypes,
+             Function* func,
+             Module* module)
       : allocation(allocation), func(func), builder(*module),
-        fields(allocation->type.getHeapType().getStruct().fields) {}
+        localTypes(localTypes) {}
 
     // We must track all the local.sets that write the allocation, to verify
     // exclusivity.
@@ -251,13 +298,14 @@ struct Heap2LocalOptimizer {
     // can fix them up at the end, if the optimization ends up possible.
     std::unordered_set<Expression*> reached;
 
-    // Maps indexes in the struct to the local index that will replace them.
+    // Maps indexes in the struct or array to the local index that will
+    // replace them.
     std::vector<Index> localIndexes;
 
     void applyOptimization() {
-      // Allocate locals to store the allocation's fields in.
-      for (auto field : fields) {
-        localIndexes.push_back(builder.addVar(func, field.type));
+      // Allocate locals to store the allocation's data in.
+      for (auto type : localTypes) {
+        localIndexes.push_back(builder.addVar(func, type));
       }
 
       // Replace the things we need to using the visit* methods.
@@ -345,11 +393,49 @@ struct Heap2LocalOptimizer {
       if (curr != allocation) {
         return;
       }
+      replaceAllocation(curr->isWithDefault() ? nullptr : &curr->operands);
+    }
+
+    void visitArrayInit(ArrayInit* curr) {
+      if (curr != allocation) {
+        return;
+      }
+      replaceAllocation(&curr->values);
+    }
+
+    void visitArrayNew(ArrayNew* curr) {
+      if (curr != allocation) {
+        return;
+      }
+      if (curr->isWithDefault()) {
+        replaceAllocation(nullptr);
+        return;
+      }
+      // The same initial value is assigned to every element. Evaluate it once
+      // into a temp local, then copy it to each element's local. (The size is
+      // a constant, see getLocalTypes, so dropping it loses nothing.)
+      std::vector<Expression*> contents;
+      if (localTypes.empty()) {
+        // A zero-size array; just keep the initial value for its effects.
+        contents.push_back(builder.makeDrop(curr->init));
+      } else {
+        auto tempIndex = builder.addVar(func, localTypes[0]);
+        contents.push_back(builder.makeLocalSet(tempIndex, curr->init));
+        for (Index i = 0; i < localIndexes.size(); i++) {
+          contents.push_back(builder.makeLocalSet(
+            localIndexes[i], builder.makeLocalGet(tempIndex, localTypes[0])));
+        }
+      }
+      finishAllocationContents(contents);
+    }
 
+    // Replaces the allocation, assigning the given initial values to the new
+    // locals (or the types' default values, if given nothing).
+    void replaceAllocation(ExpressionList* operands) {
       // First, assign the initial values to the new locals.
       std::vector<Expression*> contents;
 
-      if (!allocation->isWithDefault()) {
+      if (operands) {
         // We must assign the initial values to temp indexes, then copy them
         // over all at once. If instead we did set them as we go, then we might
         // hit a problem like this:
@@ -374,21 +460,21 @@ struct Heap2LocalOptimizer {
         //  (local.set Y (local.get Y'))
         std::vector<Index> tempIndexes;
 
-        for (auto field : fields) {
-          tempIndexes.push_back(builder.addVar(func, field.type));
+        for (auto type : localTypes) {
+          tempIndexes.push_back(builder.addVar(func, type));
         }
 
         // Store the initial values into the temp locals.
         for (Index i = 0; i < tempIndexes.size(); i++) {
           contents.push_back(
-            builder.makeLocalSet(tempIndexes[i], allocation->operands[i]));
+            builder.makeLocalSet(tempIndexes[i], (*operands)[i]));
         }
 
         // Copy them to the normal ones.
         for (Index i = 0; i < tempIndexes.size(); i++) {
           contents.push_back(builder.makeLocalSet(
             localIndexes[i],
-            builder.makeLocalGet(tempIndexes[i], fields[i].type)));
+            builder.makeLocalGet(tempIndexes[i], localTypes[i])));
         }
 
         // TODO Check if the nondefault case does not increase code size in some
@@ -402,10 +488,14 @@ struct Heap2LocalOptimizer {
         for (Index i = 0; i < localIndexes.size(); i++) {
           contents.push_back(builder.makeLocalSet(
             localIndexes[i],
-            builder.makeConstantExpression(Literal::makeZero(fields[i].type))));
+            builder.makeConstantExpression(Literal::makeZero(localTypes[i]))));
         }
       }
 
+      finishAllocationContents(contents);
+    }
+
+    void finishAllocationContents(std::vector<Expression*>& contents) {
       // Replace the allocation with a null reference. This changes the type
       // from non-nullable to nullable, but as we optimize away the code that
       // the allocation reaches, we will handle that.
@@ -444,7 +534,48 @@ struct Heap2LocalOptimizer {
       replaceCurrent(
         builder.makeSequence(builder.makeDrop(curr->ref),
                              builder.makeLocalGet(localIndexes[curr->index],
-                                                  fields[curr->index].type)));
+                                                  localTypes[curr->index])));
+    }
+
+    // The index of an array.get or array.set. The analysis only lets us get
+    // here for constant indexes that are in bounds.
+    Index getIndex(Expression* index) {
+      return index->cast<Const>()->value.geti32();
+    }
+
+    void visitArraySet(ArraySet* curr) {
+      if (!reached.count(curr)) {
+        return;
+      }
+
+      // As with a struct.set, drop the ref and write to the local. The index
+      // is a constant, so dropping it loses nothing.
+      replaceCurrent(builder.makeSequence(
+        builder.makeDrop(curr->ref),
+        builder.makeLocalSet(localIndexes[getIndex(curr->index)],
+                             curr->value)));
+    }
+
+    void visitArrayGet(ArrayGet* curr) {
+      if (!reached.count(curr)) {
+        return;
+      }
+
+      auto index = getIndex(curr->index);
+      replaceCurrent(builder.makeSequence(
+        builder.makeDrop(curr->ref),
+        builder.makeLocalGet(localIndexes[index], localTypes[index])));
+    }
+
+    void visitArrayLen(ArrayLen* curr) {
+      if (!reached.count(curr)) {
+        return;
+      }
+
+      // We know exactly how many elements the allocation has.
+      replaceCurrent(
+        builder.makeSequence(builder.makeDrop(curr->ref),
+                             builder.makeConst(int32_t(localTypes.size()))));
     }
   };
 
@@ -473,8 +604,9 @@ struct Heap2LocalOptimizer {
 
   // Analyze an allocation to see if we can convert it from a heap allocation to
   // locals.
-  bool convertToLocals(StructNew* allocation) {
-    Rewriter rewriter(allocation, func, module);
+  bool convertToLocals(Expression* allocation,
+                       const std::vector<Type>& localTypes) {
+    Rewriter rewriter(allocation, localTypes, func, module);
 
     // A queue of flows from children to parents. When something is in the queue
     // here then it assumed that it is ok for the allocation to be at the child
@@ -505,7 +637,7 @@ struct Heap2LocalOptimizer {
         return false;
       }
 
-      switch (getParentChildInteraction(parent, child)) {
+      switch (getParentChildInteraction(parent, child, localTypes.size())) {
         case ParentChildInteraction::Escapes: {
           // If the parent may let us escape then we are done.
           return false;
@@ -568,7 +700,8 @@ struct Heap2LocalOptimizer {
   }
 
   ParentChildInteraction getParentChildInteraction(Expression* parent,
-                                                   Expression* child) {
+                                                   Expression* child,
+                                                   Index numLocals) {
     // If there is no parent then we are the body of the function, and that
     // means we escape by flowing to the caller.
     if (!parent) {
@@ -578,6 +711,10 @@ struct Heap2LocalOptimizer {
     struct Checker : public Visitor<Checker> {
       Expression* child;
 
+      // The number of elements or fields in the allocation, for checking that
+      // constant array indexes are in bounds.
+      Index numLocals;
+
       // Assume escaping (or some other problem we cannot analyze) unless we are
       // certain otherwise.
       bool escapes = true;
@@ -641,11 +778,37 @@ struct Heap2LocalOptimizer {
         escapes = false;
         fullyConsumes = true;
       }
+      void visitArraySet(ArraySet* curr) {
+        // As with a struct.set, the reference does not escape, but only if we
+        // can see which element is written, and that the write does not trap:
+        // otherwise we must keep the allocation (and its trap) as it is.
+        if (curr->ref == child && isConstantInBounds(curr->index)) {
+          escapes = false;
+          fullyConsumes = true;
+        }
+      }
+      void visitArrayGet(ArrayGet* curr) {
+        if (curr->ref == child && isConstantInBounds(curr->index)) {
+          escapes = false;
+          fullyConsumes = true;
+        }
+      }
+      void visitArrayLen(ArrayLen* curr) {
+        escapes = false;
+        fullyConsumes = true;
+      }
+
+      bool isConstantInBounds(Expression* index) {
+        auto* c = index->dynCast<Const>();
+        return c && uint32_t(c->value.geti32()) < numLocals;
+      }
+
+      // TODO I31 operations
 
-      // TODO Array and I31 operations
     } checker;
 
     checker.child = child;
+    checker.numLocals = numLocals;
     checker.visit(parent);
 
     if (checker.escapes) {
@@ -33,6 +33,7 @@
 #include "wasm-builder.h"
 #include "wasm.h"
 #include <algorithm>
+#include <optional>
 
 namespace wasm {
 
@@ -1159,6 +1160,118 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
       builder->makeBinary(OrInt32, shiftedInBits, shiftLow));
   }
 
+  // Check whether an already-lowered expression is a lowered i64 constant,
+  // that is, the block emitted by visitConst: a constant low word, with the
+  // high bits temp |high| set to a constant. Returns the 64-bit value if so.
+  // Such a block has no effects beyond setting |high|, which the caller owns,
+  // so the caller may drop it entirely and use the value directly.
+  std::optional<uint64_t> getLoweredI64Const(Expression* curr, Index high) {
+    auto* block = curr->dynCast<Block>();
+    if (!block || block->name.is() || block->list.size() != 2) {
+      return {};
+    }
+    auto* set = block->list[0]->dynCast<LocalSet>();
+    if (!set || set->index != high) {
+      return {};
+    }
+    auto* highConst = set->value->dynCast<Const>();
+    auto* lowConst = block->list[1]->dynCast<Const>();
+    if (!highConst || !lowConst) {
+      return {};
+    }
+    return (uint64_t(uint32_t(highConst->value.geti32())) << 32) |
+           uint32_t(lowConst->value.geti32());
+  }
+
+  // Lower a shift by a constant amount. As the amount is known statically we
+  // can emit the two result words directly, with no temp for the shift amount
+  // and no branch on whether it is a large shift (>= 32), which shrinks the
+  // output considerably compared to the generic lowering, in particular for
+  // wasm2js. |shift| must already be masked to [0, 63].
+  Block* lowerConstShift(BinaryOp op,
+                         Expression* left,
+                         TempVar&& leftLow,
+                         TempVar&& leftHigh,
+                         TempVar&& highBits,
+                         uint32_t shift) {
+    assert(shift < 64);
+    Block* result = builder->blockify(builder->makeLocalSet(leftLow, left));
+    auto lowGet = [&]() -> Expression* {
+      return builder->makeLocalGet(leftLow, Type::i32);
+    };
+    auto highGet = [&]() -> Expression* {
+      return builder->makeLocalGet(leftHigh, Type::i32);
+    };
+    Expression* low;
+    Expression* high;
+    if (shift == 0) {
+      // The result is just the input.
+      high = highGet();
+      low = lowGet();
+    } else if (shift >= 32) {
+      // Only bits from the other word remain, shifted by shift - 32.
+      uint32_t k = shift - 32;
+      auto kConst = [&]() { return builder->makeConst(int32_t(k)); };
+      switch (op) {
+        case ShlInt64:
+          high = k ? builder->makeBinary(ShlInt32, lowGet(), kConst())
+                   : lowGet();
+          low = builder->makeConst(int32_t(0));
+          break;
+        case ShrSInt64:
+          high = builder->makeBinary(
+            ShrSInt32, highGet(), builder->makeConst(int32_t(31)));
+          low = k ? builder->makeBinary(ShrSInt32, highGet(), kConst())
+                  : highGet();
+          break;
+        case ShrUInt64:
+          high = builder->makeConst(int32_t(0));
+          low = k ? builder->makeBinary(ShrUInt32, highGet(), kConst())
+                  : highGet();
+          break;
+        default:
+          WASM_UNREACHABLE("unexpected op");
+      }
+    } else {
+      // A small shift: each word combines both input words. As the shift and
+      // its complement are nonzero constants, no masking of shifted-in bits
+      // is needed.
+      auto shiftConst = [&]() { return builder->makeConst(int32_t(shift)); };
+      auto widthLessShift = [&]() {
+        return builder->makeConst(int32_t(32 - shift));
+      };
+      switch (op) {
+        case ShlInt64:
+          high = builder->makeBinary(
+            OrInt32,
+            builder->makeBinary(ShrUInt32, lowGet(), widthLessShift()),
+            builder->makeBinary(ShlInt32, highGet(), shiftConst()));
+          low = builder->makeBinary(ShlInt32, lowGet(), shiftConst());
+          break;
+        case ShrSInt64:
+          high = builder->makeBinary(ShrSInt32, highGet(), shiftConst());
+          low = builder->makeBinary(
+            OrInt32,
+            builder->makeBinary(ShrUInt32, lowGet(), shiftConst()),
+            builder->makeBinary(ShlInt32, highGet(), widthLessShift()));
+          break;
+        case ShrUInt64:
+          high = builder->makeBinary(ShrUInt32, highGet(), shiftConst());
+          low = builder->makeBinary(
+            OrInt32,
+            builder->makeBinary(ShrUInt32, lowGet(), shiftConst()),
+            builder->makeBinary(ShlInt32, highGet(), widthLessShift()));
+          break;
+        default:
+          WASM_UNREACHABLE("unexpected op");
+      }
+    }
+    result =
+      builder->blockify(result, builder->makeLocalSet(highBits, high), low);
+    setOutParam(result, std::move(highBits));
+    return result;
+  }
+
   Block* lowerShift(BinaryOp op,
                     Block* result,
                     TempVar&& leftLow,
@@ -1412,6 +1525,21 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
     TempVar leftHigh = fetchOutParam(curr->left);
     TempVar rightLow = getTemp();
     TempVar rightHigh = fetchOutParam(curr->right);
+    if (curr->op == ShlInt64 || curr->op == ShrSInt64 ||
+        curr->op == ShrUInt64) {
+      // Shifting by a constant amount is common, and can be emitted far more
+      // compactly than the generic shift lowering. Only the low 6 bits of the
+      // amount matter.
+      if (auto c = getLoweredI64Const(curr->right, rightHigh)) {
+        replaceCurrent(lowerConstShift(curr->op,
+                                       curr->left,
+                                       std::move(leftLow),
+                                       std::move(leftHigh),
+                                       std::move(rightHigh),
+                                       uint32_t(*c) & 63));
+        return;
+      }
+    }
     LocalSet* setRight = builder->makeLocalSet(rightLow, curr->right);
     LocalSet* setLeft = builder->makeLocalSet(leftLow, curr->left);
     Block* result = builder->blockify(setLeft, setRight);
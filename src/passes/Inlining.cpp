@@ -41,7 +41,7 @@
 #include "ir/utils.h"
 #include "parsing.h"
 #include "pass.h"
-#include "passes/opt-utils.h"
+#include "support/file.h"
 #include "wasm-builder.h"
 #include "wasm.h"
 
@@ -49,6 +49,11 @@ namespace wasm {
 
 namespace {
 
+// What a profile (see the inlining-profile pass argument) says about a
+// function: nothing (no profile was given), or that the function was executed
+// in the profiled run, or that it never was.
+enum class Hotness { NoProfile, Hot, Cold };
+
 // Useful into on a function, helping us decide if we can inline it
 struct FunctionInfo {
   std::atomic<Index> refs;
@@ -58,6 +63,7 @@ struct FunctionInfo {
   bool hasTryDelegate;
   bool usedGlobally; // in a table or export
   bool uninlineable;
+  Hotness hotness;
 
   FunctionInfo() { clear(); }
 
@@ -69,6 +75,7 @@ struct FunctionInfo {
     hasTryDelegate = false;
     usedGlobally = false;
     uninlineable = false;
+    hotness = Hotness::NoProfile;
   }
 
   // Provide an explicit = operator as the |refs| field lacks one by default.
@@ -80,6 +87,7 @@ struct FunctionInfo {
     hasTryDelegate = other.hasTryDelegate;
     usedGlobally = other.usedGlobally;
     uninlineable = other.uninlineable;
+    hotness = other.hotness;
     return *this;
   }
 
@@ -93,6 +101,11 @@ struct FunctionInfo {
     if (hasTryDelegate) {
       return false;
     }
+    // If a profile says this function never ran, inlining it can only grow the
+    // callers for no speedup, so don't.
+    if (hotness == Hotness::Cold) {
+      return false;
+    }
     // If it's small enough that we always want to inline such things, do so.
     if (size <= options.inlining.alwaysInlineMaxSize) {
       return true;
@@ -116,8 +129,13 @@ struct FunctionInfo {
     if (hasCalls) {
       return false;
     }
-    return options.optimizeLevel >= 3 && options.shrinkLevel == 0 &&
-           (!hasLoops || options.inlining.allowFunctionsWithLoops);
+    // A profile that says this function did run lets us inline as aggressively
+    // as -O3 does, even when we'd otherwise hold back for size: the size cost
+    // is paid only on paths that are actually hot.
+    auto aggressive =
+      (options.optimizeLevel >= 3 && options.shrinkLevel == 0) ||
+      hotness == Hotness::Hot;
+    return aggressive && (!hasLoops || options.inlining.allowFunctionsWithLoops);
   }
 };
 
@@ -384,6 +402,54 @@ doInlining(Module* module, Function* into, const InliningAction& action) {
   return block;
 }
 
+// Performs the inlining actions that were chosen for each function, in
+// parallel. This is safe because each task mutates only its own function: the
+// logic that chooses the actions (see Inlining::iteration) guarantees that no
+// function is both inlined into and inlined from in the same iteration, so
+// the bodies we copy from are not modified while we read them. When
+// |optimize| is set we also run the usual post-inlining optimizations on the
+// function, fused into the same task (while the function is still warm in the
+// cache) rather than as a separate module-wide phase afterwards.
+struct InliningExecutor : public WalkerPass<PostWalker<InliningExecutor>> {
+  bool isFunctionParallel() override { return true; }
+
+  using ChosenActions = std::unordered_map<Name, std::vector<InliningAction>>;
+
+  // The actions to perform for each function. Shared among the parallel
+  // copies of this pass, and only ever read during the run.
+  const ChosenActions& chosenActions;
+
+  bool optimize;
+
+  InliningExecutor(const ChosenActions& chosenActions, bool optimize)
+    : chosenActions(chosenActions), optimize(optimize) {}
+
+  InliningExecutor* create() override {
+    return new InliningExecutor(chosenActions, optimize);
+  }
+
+  void doWalkFunction(Function* func) {
+    auto iter = chosenActions.find(func->name);
+    if (iter == chosenActions.end()) {
+      return;
+    }
+    for (auto& action : iter->second) {
+      doInlining(getModule(), func, action);
+    }
+    // We may now have non-unique label names, fix that up.
+    wasm::UniqueNameMapper::uniquify(func->body);
+    if (optimize) {
+      PassRunner runner(getModule(), getPassOptions());
+      runner.setIsNested(true);
+      runner.setValidateGlobally(false); // not a full valid module
+      // this is especially useful after inlining
+      runner.add("precompute-propagate");
+      runner.addDefaultFunctionOptimizationPasses(); // do all the usual stuff
+      runner.runOnFunction(func);
+    }
+  }
+};
+
 //
 // Function splitting / partial inlining / inlining of conditions.
 //
@@ -450,6 +516,11 @@ doInlining(Module* module, Function* into, const InliningAction& action) {
 //
 // which is what we wanted.
 //
+// Besides inlining just the condition, we also handle a small fast path that
+// does some actual work before exiting - see pattern C below - in which case
+// the inlined part contains that work, and only the cold remainder is left
+// behind a call.
+//
 // To reduce the complexity of this feature, it is implemented almost entirely
 // in its own class, FunctionSplitter. The main inlining logic just calls out to
 // the splitter to check if a function is worth splitting, and to get the split
@@ -630,6 +701,60 @@ private:
       return true;
     }
 
+    // Pattern C: Check if the function begins with a small "fast path" that
+    // always exits,
+    //
+    //  if (simple) {
+    //    ..a little work..
+    //    return result;
+    //  }
+    //  ..lots and lots of other code..
+    //
+    // which is the shape of e.g. a bump allocator: a brief hot path guarding
+    // a large, cold fallback. Splitting here gives us
+    //
+    //  function foo$inlineable(x) {
+    //    if (simple) {
+    //      ..a little work..
+    //      return result;
+    //    }
+    //    foo$outlined(x);
+    //  }
+    //
+    // so that after inlining the common case runs without any call at all,
+    // while the cold code stays outlined. The if arm must be unreachable -
+    // it always returns or otherwise never falls through - so that the code
+    // after the if runs exactly when the condition is false, both before and
+    // after the split.
+    if (!iff->ifFalse && iff->ifTrue->type == Type::unreachable &&
+        Measurer::measure(iff->ifTrue) <=
+          options.inlining.flexibleInlineMaxSize &&
+        getItem(body, 1)) {
+      split.splittable = true;
+      if (!inlineableOut) {
+        return true;
+      }
+
+      split.inlineable = copyFunction(func, "inlineable-C");
+      auto* outlined = copyFunction(func, "outlined-C");
+
+      // The inlineable function keeps the fast path as it is, and calls the
+      // outlined function when it is not taken. The call provides the return
+      // value, if there is one, as the final value of the body.
+      split.inlineable->body = builder.makeBlock(
+        {getIf(split.inlineable->body),
+         builder.makeCall(outlined->name,
+                          getForwardedArgs(func, builder),
+                          func->getResults())});
+
+      // The outlined function no longer needs the initial if.
+      auto& outlinedList = outlined->body->cast<Block>()->list;
+      outlinedList.erase(outlinedList.begin());
+
+      *inlineableOut = split.inlineable;
+      return true;
+    }
+
     // Pattern B: Represents a function whose entire body looks like
     //
     //  if (A_1) {
@@ -790,17 +915,22 @@ private:
   // are willing to inline it in this optimization. This should basically take
   // almost no cost at all to compute.
   bool isSimple(Expression* curr) {
-    // For now, support local and global gets, and unary operations.
+    // For now, support local and global gets, constants, and unary and binary
+    // operations on them - enough for the comparisons that typically guard a
+    // fast path.
     // TODO: Generalize? Use costs.h?
     if (curr->type == Type::unreachable) {
       return false;
     }
-    if (curr->is<GlobalGet>() || curr->is<LocalGet>()) {
+    if (curr->is<GlobalGet>() || curr->is<LocalGet>() || curr->is<Const>()) {
       return true;
     }
     if (auto* unary = curr->dynCast<Unary>()) {
       return isSimple(unary->value);
     }
+    if (auto* binary = curr->dynCast<Binary>()) {
+      return isSimple(binary->left) && isSimple(binary->right);
+    }
     if (auto* is = curr->dynCast<RefIs>()) {
       return isSimple(is->value);
     }
@@ -830,6 +960,10 @@ struct Inlining : public Pass {
   // the information for each function. recomputed in each iteraction
   NameInfoMap infos;
 
+  // Profile-derived hotness for each defined function, if the
+  // inlining-profile pass argument provided a profile (see loadProfile).
+  std::unordered_map<Name, Hotness> profileHotness;
+
   std::unique_ptr<FunctionSplitter> functionSplitter;
 
   PassRunner* runner = nullptr;
@@ -839,6 +973,12 @@ struct Inlining : public Pass {
     runner = runner_;
     module = module_;
 
+    auto profileFile =
+      runner->options.getArgumentOrDefault("inlining-profile", "");
+    if (!profileFile.empty()) {
+      loadProfile(profileFile);
+    }
+
     // No point to do more iterations than the number of functions, as it means
     // we are infinitely recursing (which should be very rare in practice, but
     // it is possible that a recursive call can look like it is worth inlining).
@@ -911,6 +1051,40 @@ struct Inlining : public Pass {
     }
   }
 
+  // Read a profile in the format wasm-split emits (see "wasm-split profile
+  // format" in tools/wasm-split/instrumenter.cpp): an 8-byte module hash
+  // followed by a 4-byte timestamp per defined function, which is non-zero iff
+  // the function was called during the profiled run. We cannot verify the
+  // module hash here (it is a hash of the original binary, which earlier
+  // passes have typically transformed by now), so we only check that the
+  // number of functions matches.
+  void loadProfile(const std::string& file) {
+    auto data = read_file<std::vector<char>>(file, Flags::Binary);
+    size_t i = 0;
+    auto readi32 = [&]() {
+      if (i + 4 > data.size()) {
+        Fatal() << "Unexpected end of profile data in " << file;
+      }
+      uint32_t i32 = 0;
+      i32 |= uint32_t(uint8_t(data[i++]));
+      i32 |= uint32_t(uint8_t(data[i++])) << 8;
+      i32 |= uint32_t(uint8_t(data[i++])) << 16;
+      i32 |= uint32_t(uint8_t(data[i++])) << 24;
+      return i32;
+    };
+    // Skip the module hash.
+    readi32();
+    readi32();
+    ModuleUtils::iterDefinedFunctions(*module, [&](Function* func) {
+      profileHotness[func->name] =
+        readi32() > 0 ? Hotness::Hot : Hotness::Cold;
+    });
+    if (i != data.size()) {
+      Fatal() << "Profile " << file
+              << " does not match the module (wrong number of functions)";
+    }
+  }
+
   void prepare() {
     infos.clear();
     // fill in info, as we operate on it in parallel (each function to its own
@@ -932,6 +1106,11 @@ struct Inlining : public Pass {
     if (module->start.is()) {
       infos[module->start].usedGlobally = true;
     }
+    // Apply the profile, if any. Functions added since the profile was taken
+    // (e.g. split pieces from a previous iteration) simply have no hotness.
+    for (auto& [name, hotness] : profileHotness) {
+      infos[name].hotness = hotness;
+    }
 
     // When optimizing heavily for size, we may potentially split functions in
     // order to inline parts of them.
@@ -963,7 +1142,10 @@ struct Inlining : public Pass {
     }
     // find and plan inlinings
     Planner(&state).run(runner, module);
-    // perform inlinings TODO: parallelize
+    // Choose which of the planned inlinings to perform. The choosing itself is
+    // serial, as it is cheap bookkeeping that must be deterministic, while the
+    // actual inlining work is done in parallel afterwards.
+    InliningExecutor::ChosenActions chosenActions;
     std::unordered_map<Name, Index> inlinedUses; // how many uses we inlined
     // which functions were inlined into
     for (auto name : funcNames) {
@@ -999,23 +1181,24 @@ struct Inlining : public Pass {
         // not the original function itself; note how even if we do that then
         // we are still removing a call to the original function here, and so
         // we do not need to change anything else lower down - we still want to
-        // note that we got rid of one use of the original function).
+        // note that we got rid of one use of the original function). Splitting
+        // must happen here, serially, as it adds functions to the module.
         action.contents = getActuallyInlinedFunction(action.contents);
 
-        // Perform the inlining and update counts.
-        doInlining(module, func, action);
+        // Queue the inlining and update counts.
+        chosenActions[name].push_back(action);
         inlinedUses[inlinedName]++;
         inlinedInto.insert(func);
         assert(inlinedUses[inlinedName] <= infos[inlinedName].refs);
       }
     }
-    for (auto func : inlinedInto) {
-      // Anything we inlined into may now have non-unique label names, fix it
-      // up.
-      wasm::UniqueNameMapper::uniquify(func->body);
-    }
-    if (optimize && inlinedInto.size() > 0) {
-      OptUtils::optimizeAfterInlining(inlinedInto, module, runner);
+    // Perform the chosen inlinings, in parallel. This mutates only the
+    // functions we inline into, which the choosing above guarantees are
+    // disjoint from the functions whose bodies we copy from. The post-inline
+    // optimization (when we optimize) happens in the same parallel tasks,
+    // avoiding a separate module-wide phase.
+    if (!chosenActions.empty()) {
+      InliningExecutor(chosenActions, optimize).run(runner, module);
     }
     // remove functions that we no longer need after inlining
     module->removeFunctions([&](Function* func) {
@@ -1032,6 +1215,12 @@ struct Inlining : public Pass {
       return true;
     }
 
+    // A profile that says the function never ran rules out partial inlining
+    // as well.
+    if (infos[name].hotness == Hotness::Cold) {
+      return false;
+    }
+
     // Otherwise, check if we can at least inline part of it, if we are
     // interested in such things.
     if (functionSplitter &&
@@ -56,6 +56,22 @@
 // pointers (which are references), and we only log MVP wasm types (i.e., not
 // references).
 //
+// The instrument-memory-ring variant replaces the imported hooks with small
+// generated wasm functions that append compact records into a ring buffer
+// reserved after the module's initial memory, so that the host is called only
+// once per RING_RECORDS records (through a single "flush_records" import)
+// instead of several times per access. Each record is 16 bytes:
+//
+//   0: i32 site id (as in the import mode)
+//   4: i32 kind: an operation code (see RecordOp) in bits 0-7, a value type
+//      code (1=i32, 2=i64, 3=f32, 4=f64) in bits 8-15 and, for memory
+//      accesses, the access size in bytes in bits 16-31
+//   8: i64 payload: the effective address for *_ptr records, or the value as
+//      raw bits (floats reinterpreted, 32-bit values zero-extended) otherwise
+//
+// A "flush_ring" export flushes a partially-filled ring, which the embedder
+// should call when the program is done.
+//
 
 #include "asmjs/shared-constants.h"
 #include "shared-constants.h"
@@ -96,7 +112,30 @@ static Name array_set_index("array_set_index");
 
 // TODO: Add support for atomicRMW/cmpxchg
 
+static Name flush_records("flush_records");
+static Name flush_ring("flush_ring");
+
+// The operation codes used in ring-buffer records.
+enum RecordOp {
+  RecordLoadPtr = 1,
+  RecordStorePtr,
+  RecordLoadVal,
+  RecordStoreVal,
+  RecordStructGetVal,
+  RecordStructSetVal,
+  RecordArrayGetVal,
+  RecordArraySetVal,
+  RecordArrayGetIndex,
+  RecordArraySetIndex,
+};
+
+// The number of records in the ring buffer; the host is called once per this
+// many records.
+static const Index RING_RECORDS = 4096;
+
 struct InstrumentMemory : public WalkerPass<PostWalker<InstrumentMemory>> {
+  InstrumentMemory(bool ringBuffer) : ringBuffer(ringBuffer) {}
+
   void visitLoad(Load* curr) {
     id++;
     Builder builder(*getModule());
@@ -246,6 +285,11 @@ struct InstrumentMemory : public WalkerPass<PostWalker<InstrumentMemory>> {
   }
 
   void visitModule(Module* curr) {
+    if (ringBuffer) {
+      addRingBuffer(curr);
+      return;
+    }
+
     auto indexType = curr->memory.indexType;
 
     // Load.
@@ -290,7 +334,13 @@ struct InstrumentMemory : public WalkerPass<PostWalker<InstrumentMemory>> {
   }
 
 private:
-  Index id;
+  Index id = 0;
+
+  bool ringBuffer;
+
+  // The address of the ring buffer: an i32 count of filled records, then the
+  // records themselves at |base| + 16.
+  uint64_t base = 0;
 
   void addImport(Module* curr, Name name, Type params, Type results) {
     auto import = Builder::makeFunction(name, Signature(params, results), {});
@@ -298,8 +348,239 @@ private:
     import->base = name;
     curr->addFunction(std::move(import));
   }
+
+  // In ring-buffer mode the call targets are not imports but generated
+  // functions that append a record, flushing to the host when the ring fills.
+  void addRingBuffer(Module* curr) {
+    auto& memory = curr->memory;
+    auto indexType = memory.indexType;
+
+    // Reserve room for the ring after the initial memory.
+    base = memory.exists ? memory.initial * Memory::kPageSize : 0;
+    memory.exists = true;
+    uint64_t bytes = 16 + uint64_t(RING_RECORDS) * 16;
+    memory.initial =
+      memory.initial + (bytes + Memory::kPageSize - 1) / Memory::kPageSize;
+    if (memory.hasMax() && memory.max < memory.initial) {
+      memory.max = memory.initial;
+    }
+
+    // The single host call: flush_records(first record address, count).
+    addImport(curr, flush_records, {indexType, Type::i32}, Type::none);
+
+    // flush_ring flushes whatever is in the ring and resets it; the full ring
+    // calls it from the recorders, and it is exported for the embedder to
+    // call at program end.
+    {
+      Builder builder(*curr);
+      auto func = Builder::makeFunction(
+        flush_ring, Signature(Type::none, Type::none), {});
+      func->body = builder.makeBlock(
+        {builder.makeCall(flush_records,
+                          {builder.makeConstPtr(base + 16), makeCountGet(curr)},
+                          Type::none),
+         builder.makeStore(4,
+                           0,
+                           4,
+                           builder.makeConstPtr(base),
+                           builder.makeConst(int32_t(0)),
+                           Type::i32)});
+      curr->addFunction(std::move(func));
+      curr->addExport(
+        builder.makeExport(flush_ring, flush_ring, ExternalKind::Function));
+    }
+
+    // Load and store.
+    addPtrRecorder(curr, load_ptr, RecordLoadPtr);
+    addPtrRecorder(curr, store_ptr, RecordStorePtr);
+    addValRecorder(curr, load_val_i32, Type::i32, RecordLoadVal);
+    addValRecorder(curr, load_val_i64, Type::i64, RecordLoadVal);
+    addValRecorder(curr, load_val_f32, Type::f32, RecordLoadVal);
+    addValRecorder(curr, load_val_f64, Type::f64, RecordLoadVal);
+    addValRecorder(curr, store_val_i32, Type::i32, RecordStoreVal);
+    addValRecorder(curr, store_val_i64, Type::i64, RecordStoreVal);
+    addValRecorder(curr, store_val_f32, Type::f32, RecordStoreVal);
+    addValRecorder(curr, store_val_f64, Type::f64, RecordStoreVal);
+
+    if (curr->features.hasGC()) {
+      addValRecorder(curr, struct_get_val_i32, Type::i32, RecordStructGetVal);
+      addValRecorder(curr, struct_get_val_i64, Type::i64, RecordStructGetVal);
+      addValRecorder(curr, struct_get_val_f32, Type::f32, RecordStructGetVal);
+      addValRecorder(curr, struct_get_val_f64, Type::f64, RecordStructGetVal);
+      addValRecorder(curr, struct_set_val_i32, Type::i32, RecordStructSetVal);
+      addValRecorder(curr, struct_set_val_i64, Type::i64, RecordStructSetVal);
+      addValRecorder(curr, struct_set_val_f32, Type::f32, RecordStructSetVal);
+      addValRecorder(curr, struct_set_val_f64, Type::f64, RecordStructSetVal);
+      addValRecorder(curr, array_get_val_i32, Type::i32, RecordArrayGetVal);
+      addValRecorder(curr, array_get_val_i64, Type::i64, RecordArrayGetVal);
+      addValRecorder(curr, array_get_val_f32, Type::f32, RecordArrayGetVal);
+      addValRecorder(curr, array_get_val_f64, Type::f64, RecordArrayGetVal);
+      addValRecorder(curr, array_set_val_i32, Type::i32, RecordArraySetVal);
+      addValRecorder(curr, array_set_val_i64, Type::i64, RecordArraySetVal);
+      addValRecorder(curr, array_set_val_f32, Type::f32, RecordArraySetVal);
+      addValRecorder(curr, array_set_val_f64, Type::f64, RecordArraySetVal);
+      addValRecorder(curr, array_get_index, Type::i32, RecordArrayGetIndex);
+      addValRecorder(curr, array_set_index, Type::i32, RecordArraySetIndex);
+    }
+  }
+
+  // A load of the ring's record count.
+  Expression* makeCountGet(Module* curr) {
+    Builder builder(*curr);
+    return builder.makeLoad(
+      4, false, 0, 4, builder.makeConstPtr(base), Type::i32);
+  }
+
+  // The address of the next free record, in the memory's index type.
+  Expression* makeSlotGet(Module* curr) {
+    Builder builder(*curr);
+    if (curr->memory.is64()) {
+      return builder.makeBinary(
+        AddInt64,
+        builder.makeConstPtr(base + 16),
+        builder.makeBinary(MulInt64,
+                           builder.makeUnary(ExtendUInt32, makeCountGet(curr)),
+                           builder.makeConst(int64_t(16))));
+    }
+    return builder.makeBinary(
+      AddInt32,
+      builder.makeConstPtr(base + 16),
+      builder.makeBinary(
+        MulInt32, makeCountGet(curr), builder.makeConst(int32_t(16))));
+  }
+
+  // Bumps the record count, flushing when the ring is full.
+  Expression* makeCountBump(Module* curr) {
+    Builder builder(*curr);
+    auto* bump = builder.makeStore(
+      4,
+      0,
+      4,
+      builder.makeConstPtr(base),
+      builder.makeBinary(
+        AddInt32, makeCountGet(curr), builder.makeConst(int32_t(1))),
+      Type::i32);
+    auto* flush = builder.makeIf(
+      builder.makeBinary(EqInt32,
+                         makeCountGet(curr),
+                         builder.makeConst(int32_t(RING_RECORDS))),
+      builder.makeCall(flush_ring, {}, Type::none));
+    return builder.makeSequence(bump, flush);
+  }
+
+  // The value type codes used in a record's kind field.
+  int32_t typeCode(Type type) {
+    switch (type.getBasic()) {
+      case Type::i32:
+        return 1;
+      case Type::i64:
+        return 2;
+      case Type::f32:
+        return 3;
+      case Type::f64:
+        return 4;
+      default:
+        WASM_UNREACHABLE("bad type");
+    }
+  }
+
+  // A value as the raw bits of a record payload.
+  Expression* makePayloadBits(Module* curr, Expression* value) {
+    Builder builder(*curr);
+    auto type = value->type;
+    if (type == Type::i64) {
+      return value;
+    }
+    if (type == Type::f64) {
+      return builder.makeUnary(ReinterpretFloat64, value);
+    }
+    if (type == Type::f32) {
+      value = builder.makeUnary(ReinterpretFloat32, value);
+    }
+    return builder.makeUnary(ExtendUInt32, value);
+  }
+
+  // Makes a recorder with the same signature as a *_ptr import:
+  // (id, bytes, offset, address) => address. The payload is the effective
+  // address.
+  void addPtrRecorder(Module* curr, Name name, RecordOp op) {
+    Builder builder(*curr);
+    auto indexType = curr->memory.indexType;
+    auto func = Builder::makeFunction(
+      name,
+      Signature({Type::i32, Type::i32, indexType, indexType}, indexType),
+      {indexType});
+    Index slot = 4;
+    auto* effective = builder.makeBinary(
+      curr->memory.is64() ? AddInt64 : AddInt32,
+      builder.makeLocalGet(2, indexType),
+      builder.makeLocalGet(3, indexType));
+    auto* kind = builder.makeBinary(
+      OrInt32,
+      builder.makeConst(int32_t(op)),
+      builder.makeBinary(
+        OrInt32,
+        builder.makeConst(int32_t(typeCode(indexType) << 8)),
+        builder.makeBinary(ShlInt32,
+                           builder.makeLocalGet(1, Type::i32),
+                           builder.makeConst(int32_t(16)))));
+    func->body = builder.makeBlock(
+      {builder.makeLocalSet(slot, makeSlotGet(curr)),
+       builder.makeStore(4,
+                         0,
+                         4,
+                         builder.makeLocalGet(slot, indexType),
+                         builder.makeLocalGet(0, Type::i32),
+                         Type::i32),
+       builder.makeStore(
+         4, 4, 4, builder.makeLocalGet(slot, indexType), kind, Type::i32),
+       builder.makeStore(8,
+                         8,
+                         8,
+                         builder.makeLocalGet(slot, indexType),
+                         makePayloadBits(curr, effective),
+                         Type::i64),
+       makeCountBump(curr),
+       builder.makeLocalGet(3, indexType)},
+      indexType);
+    curr->addFunction(std::move(func));
+  }
+
+  // Makes a recorder with the same signature as a *_val import:
+  // (id, value) => value. The payload is the value's bits.
+  void addValRecorder(Module* curr, Name name, Type type, RecordOp op) {
+    Builder builder(*curr);
+    auto indexType = curr->memory.indexType;
+    auto func = Builder::makeFunction(
+      name, Signature({Type::i32, type}, type), {indexType});
+    Index slot = 2;
+    auto* kind =
+      builder.makeConst(int32_t(int32_t(op) | (typeCode(type) << 8)));
+    func->body = builder.makeBlock(
+      {builder.makeLocalSet(slot, makeSlotGet(curr)),
+       builder.makeStore(4,
+                         0,
+                         4,
+                         builder.makeLocalGet(slot, indexType),
+                         builder.makeLocalGet(0, Type::i32),
+                         Type::i32),
+       builder.makeStore(
+         4, 4, 4, builder.makeLocalGet(slot, indexType), kind, Type::i32),
+       builder.makeStore(8,
+                         8,
+                         8,
+                         builder.makeLocalGet(slot, indexType),
+                         makePayloadBits(curr, builder.makeLocalGet(1, type)),
+                         Type::i64),
+       makeCountBump(curr),
+       builder.makeLocalGet(1, type)},
+      type);
+    curr->addFunction(std::move(func));
+  }
 };
 
-Pass* createInstrumentMemoryPass() { return new InstrumentMemory(); }
+Pass* createInstrumentMemoryPass() { return new InstrumentMemory(false); }
+
+Pass* createInstrumentMemoryRingPass() { return new InstrumentMemory(true); }
 
 } // namespace wasm
@@ -118,6 +118,7 @@
 
 #include <ir/cost.h>
 #include <ir/effects.h>
+#include <ir/hashed.h>
 #include <ir/iteration.h>
 #include <ir/linear-execution.h>
 #include <ir/properties.h>
@@ -132,35 +133,6 @@ namespace wasm {
 
 namespace {
 
-// An expression with a cached hash value.
-struct HashedExpression {
-  Expression* expr;
-  size_t digest;
-
-  HashedExpression(Expression* expr, size_t digest)
-    : expr(expr), digest(digest) {}
-
-  HashedExpression(const HashedExpression& other)
-    : expr(other.expr), digest(other.digest) {}
-};
-
-struct HEHasher {
-  size_t operator()(const HashedExpression hashed) const {
-    return hashed.digest;
-  }
-};
-
-// A full equality check for HashedExpressions. The hash is used as a speedup,
-// but if it matches we still verify the contents are identical.
-struct HEComparer {
-  bool operator()(const HashedExpression a, const HashedExpression b) const {
-    if (a.digest != b.digest) {
-      return false;
-    }
-    return ExpressionAnalyzer::equal(a.expr, b.expr);
-  }
-};
-
 // Maps hashed expressions to the list of expressions that match. That is, all
 // expressions that are equivalent (same hash, and also compare equal) will
 // be in a vector for the corresponding entry in this map.
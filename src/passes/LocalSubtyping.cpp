@@ -51,9 +51,8 @@ struct LocalSubtyping : public WalkerPass<PostWalker<LocalSubtyping>> {
     // we cannot change that type, as if we change the local type to
     // non-nullable then we'd be accessing the default, which is not allowed.
     //
-    // TODO: Optimize this, as LocalGraph computes more than we need, and on
-    //       more locals than we need.
-    LocalGraph localGraph(func);
+    // Only vars can be refined, so restrict the graph to them.
+    LocalGraph localGraph(func, [func](Index i) { return func->isVar(i); });
 
     // For each local index, compute all the the sets and gets.
     std::vector<std::vector<LocalSet*>> setsForLocal(numLocals);
@@ -91,31 +90,55 @@ struct LocalSubtyping : public WalkerPass<PostWalker<LocalSubtyping>> {
     auto varBase = func->getVarIndexBase();
 
     // Keep iterating while we find things to change. There can be chains like
-    // X -> Y -> Z where one change enables more. Note that we are O(N^2) on
-    // that atm, but it is a rare pattern as general optimizations
-    // (SimplifyLocals and CoalesceLocals) break up such things; also, even if
-    // we tracked changes more carefully we'd have the case of nested tees
-    // where we could still be O(N^2), so we'd need something more complex here
-    // involving topological sorting. Leave that for if the need arises.
-
-    // TODO: handle cycles of X -> Y -> X etc.
+    // X -> Y -> Z where one change enables more. To avoid recomputing every
+    // LUB in every round, note which local each local depends on: Y depends
+    // on X if a set of Y contains a get or tee of X in its value, as then
+    // refining X's type may allow refining Y's. After the first round we only
+    // revisit the dependents of what actually changed, so the total LUB work
+    // is proportional to the dependency edges and not rounds times locals.
+    // (This also handles cycles like X -> Y -> X: types only ever refine
+    // downwards, so revisiting must reach a fixed point.)
+    std::vector<std::unordered_set<Index>> dependents(numLocals);
+    for (Index i = varBase; i < numLocals; i++) {
+      for (auto* set : setsForLocal[i]) {
+        FindAllOf<LocalGet, LocalSet> found(set->value);
+        for (auto* get : found.list<LocalGet>()) {
+          if (func->isVar(get->index)) {
+            dependents[get->index].insert(i);
+          }
+        }
+        for (auto* tee : found.list<LocalSet>()) {
+          if (func->isVar(tee->index)) {
+            dependents[tee->index].insert(i);
+          }
+        }
+      }
+    }
 
-    bool more;
     bool optimized = false;
 
-    do {
-      more = false;
+    // All vars are candidates in the first round.
+    std::vector<Index> candidates;
+    for (Index i = varBase; i < numLocals; i++) {
+      candidates.push_back(i);
+    }
 
-      // First, refinalize which will recompute least upper bounds on ifs and
-      // blocks, etc., potentially finding a more specific type. Note that
-      // that utility does not tell us if it changed anything, so we depend on
-      // the next step for knowing if there is more work to do.
-      ReFinalize().walkFunctionInModule(func, getModule());
+    // Refinalize before the first round, and again after each round that
+    // changed something: it recomputes least upper bounds on ifs and blocks,
+    // etc., potentially finding a more specific type. This must happen even
+    // when there are no candidate vars at all - refining those block and if
+    // types is an improvement by itself. Note that that utility does not tell
+    // us if it changed anything, so we depend on the scan below for knowing
+    // if there is more work to do.
+    ReFinalize().walkFunctionInModule(func, getModule());
 
-      // Second, find vars whose actual applied values allow a more specific
+    while (!candidates.empty()) {
+      // Find candidate vars whose actual applied values allow a more specific
       // type.
 
-      for (Index i = varBase; i < numLocals; i++) {
+      std::vector<Index> changed;
+
+      for (auto i : candidates) {
         auto oldType = func->getLocalType(i);
 
         // Find all the types assigned to the var, and compute the optimal LUB.
@@ -153,7 +176,7 @@ struct LocalSubtyping : public WalkerPass<PostWalker<LocalSubtyping>> {
           // We found a more specific type!
           assert(Type::isSubType(newType, oldType));
           func->vars[i - varBase] = newType;
-          more = true;
+          changed.push_back(i);
           optimized = true;
           lub.updateNulls();
 
@@ -172,16 +195,29 @@ struct LocalSubtyping : public WalkerPass<PostWalker<LocalSubtyping>> {
           }
         }
       }
-    } while (more);
+
+      // The next round need only revisit the dependents of what we just
+      // changed. Sort for determinism.
+      std::unordered_set<Index> next;
+      for (auto i : changed) {
+        next.insert(dependents[i].begin(), dependents[i].end());
+      }
+      candidates.assign(next.begin(), next.end());
+      std::sort(candidates.begin(), candidates.end());
+      if (!candidates.empty()) {
+        ReFinalize().walkFunctionInModule(func, getModule());
+      }
+    }
 
     // If we ever optimized, then we also need to do a final pass to update any
     // unreachable gets and tees. They are not seen or updated in the above
     // analysis, but must be fixed up for validation to work.
     if (optimized) {
-      for (auto* get : FindAll<LocalGet>(func->body).list) {
+      FindAllOf<LocalGet, LocalSet> found(func->body);
+      for (auto* get : found.list<LocalGet>()) {
         get->type = func->getLocalType(get->index);
       }
-      for (auto* set : FindAll<LocalSet>(func->body).list) {
+      for (auto* set : found.list<LocalSet>()) {
         auto newType = func->getLocalType(set->index);
         if (set->isTee()) {
           set->type = newType;
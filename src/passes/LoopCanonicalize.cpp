@@ -0,0 +1,115 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Canonicalizes loops into rotated (bottom-tested) form. A while-shaped
+// loop tests its exit condition at the top of each iteration,
+//
+//  (loop $in
+//    (br_if $out (condition))
+//    ..body..
+//    (br $in)
+//  )
+//
+// and we rotate it into a do-while shape, testing the condition once before
+// entering and then at the bottom of each iteration,
+//
+//  (br_if $out (condition))
+//  (loop $in
+//    ..body..
+//    (br_if $out (condition))
+//    (br $in)
+//  )
+//
+// The sequence of evaluations is identical - the entry check replaces the
+// first iteration's top-of-loop check - so this is valid even for conditions
+// with side effects, and the condition is only duplicated syntactically, not
+// dynamically. The win is shape: the loop body now begins with straight-line
+// code, which grows the unconditional prefix that LICM can move code out of,
+// and downstream engines JIT bottom-tested loops better.
+//
+
+#include "ir/effects.h"
+#include "ir/manipulation.h"
+#include "ir/utils.h"
+#include "pass.h"
+#include "wasm-builder.h"
+#include "wasm.h"
+
+namespace wasm {
+
+struct LoopCanonicalize : public WalkerPass<PostWalker<LoopCanonicalize>> {
+  bool isFunctionParallel() override { return true; }
+
+  Pass* create() override { return new LoopCanonicalize; }
+
+  bool rotated = false;
+
+  void visitLoop(Loop* curr) {
+    auto* block = curr->body->dynCast<Block>();
+    // We need at least the top check, some body, and the backedge.
+    if (!block || block->list.size() < 3) {
+      return;
+    }
+    auto* check = block->list[0]->dynCast<Break>();
+    if (!check || !check->condition || check->value) {
+      return;
+    }
+    // The check must exit the loop. At the top of the block it can only
+    // target an enclosing label, so ruling out the loop and the block
+    // themselves is enough.
+    if (check->name == curr->name ||
+        (block->name.is() && check->name == block->name)) {
+      return;
+    }
+    auto* backedge = block->list.back()->dynCast<Break>();
+    if (!backedge || backedge->condition || backedge->name != curr->name) {
+      return;
+    }
+    // The entry copy of the condition runs before the loop label exists, so
+    // the condition may not branch (and it may not pop from a containing
+    // catch body either).
+    EffectAnalyzer effects(getPassOptions(), *getModule(), check->condition);
+    if (effects.transfersControlFlow() || effects.danglingPop) {
+      return;
+    }
+    // Rotate: shift the body up and move the check to just before the
+    // backedge.
+    for (Index i = 0; i < block->list.size() - 2; i++) {
+      block->list[i] = block->list[i + 1];
+    }
+    block->list[block->list.size() - 2] = check;
+    // Guard entry into the loop with a copy of the check.
+    Builder builder(*getModule());
+    auto* guard = builder.makeBreak(
+      check->name,
+      nullptr,
+      ExpressionManipulator::copy(check->condition, *getModule()));
+    replaceCurrent(builder.makeSequence(guard, curr));
+    rotated = true;
+  }
+
+  void visitFunction(Function* curr) {
+    if (rotated) {
+      // Rotation can change the types of the loop and what encloses it.
+      ReFinalize().walkFunctionInModule(curr, getModule());
+    }
+  }
+};
+
+Pass* createLoopCanonicalizePass() { return new LoopCanonicalize(); }
+
+} // namespace wasm
@@ -45,10 +45,32 @@ struct LoopInvariantCodeMotion
 
   LocalGraph* localGraph;
 
+  // How many sets each local index has in the entire function, and whether
+  // any get of the index can read the value the local has before any set
+  // (the parameter or zero-init value). Together these tell us when a set
+  // may be executed earlier than it was without that being observable, which
+  // the speculative phase below needs.
+  std::vector<Index> funcSetsForIndex;
+  std::vector<bool> entryGetForIndex;
+
   void doWalkFunction(Function* func) {
     // Compute all local dependencies first.
     LocalGraph localGraphInstance(func);
     localGraph = &localGraphInstance;
+    auto numLocals = func->getNumLocals();
+    funcSetsForIndex.assign(numLocals, 0);
+    for (auto* set : FindAll<LocalSet>(func->body).list) {
+      funcSetsForIndex[set->index]++;
+    }
+    entryGetForIndex.assign(numLocals, false);
+    for (auto& [get, sets] : localGraph->getSetses) {
+      for (auto* set : sets) {
+        if (!set) {
+          entryGetForIndex[get->index] = true;
+          break;
+        }
+      }
+    }
     // Traverse the function.
     super::doWalkFunction(func);
   }
@@ -171,6 +193,46 @@ struct LoopInvariantCodeMotion
       // We did not move this item. Accumulate its effects.
       effectsSoFar.mergeIn(effects);
     }
+    // Second phase: find invariant code that only executes conditionally in
+    // the loop - inside an if arm, or a nested loop - which the linear scan
+    // above cannot reach. Moving such code out means executing it
+    // unconditionally (once, before the loop), so it must be safe to
+    // speculate, see canSpeculate. Iterate to a fixed point, as each move
+    // can make more code invariant: a set whose value reads a local that a
+    // just-moved set defines becomes movable itself.
+    struct Speculator : public PostWalker<Speculator> {
+      LoopInvariantCodeMotion& parent;
+      EffectAnalyzer& loopEffects;
+      LoopSets& loopSets;
+      std::vector<Expression*>& movedCode;
+      bool moved = false;
+
+      Speculator(LoopInvariantCodeMotion& parent,
+                 EffectAnalyzer& loopEffects,
+                 LoopSets& loopSets,
+                 std::vector<Expression*>& movedCode)
+        : parent(parent), loopEffects(loopEffects), loopSets(loopSets),
+          movedCode(movedCode) {
+        setModule(parent.getModule());
+      }
+
+      void visitLocalSet(LocalSet* curr) {
+        if (!parent.canSpeculate(curr, loopEffects, loopSets)) {
+          return;
+        }
+        movedCode.push_back(curr);
+        for (auto* set : FindAll<LocalSet>(curr).list) {
+          loopSets.erase(set);
+        }
+        replaceCurrent(Builder(*getModule()).makeNop());
+        moved = true;
+      }
+    };
+    Speculator speculator(*this, loopEffects, loopSets, movedCode);
+    do {
+      speculator.moved = false;
+      speculator.walk(loop->body);
+    } while (speculator.moved);
     // If we moved the code out, finish up by emitting it
     // outside of the loop.
     // Note that this works with nested loops - after moving outside
@@ -189,6 +251,48 @@ struct LoopInvariantCodeMotion
     }
   }
 
+  // Whether a set that might not execute on every iteration (or at all) can
+  // be moved out of the loop and executed unconditionally before it.
+  bool canSpeculate(LocalSet* curr,
+                    EffectAnalyzer& loopEffects,
+                    LoopSets& loopSets) {
+    if (!interestingToMove(curr)) {
+      return false;
+    }
+    // Executing the set early must be unobservable: it (and any set nested
+    // in its value) must be the only set of its index in the function, and
+    // nothing may read the value the local has before it. Then every get of
+    // the index already sees this set's value, which being invariant is the
+    // same when assigned before the loop.
+    for (auto* set : FindAll<LocalSet>(curr).list) {
+      if (funcSetsForIndex[set->index] != 1 || entryGetForIndex[set->index]) {
+        return false;
+      }
+    }
+    // Only the local write may remain as an effect. Anything else - a trap,
+    // a throw, a write to global state - could be observed on an execution
+    // that previously did not run this code. (A potentially-trapping load
+    // can only be hoisted here if traps never happen; in structured IR we
+    // have no cheap dominating condition with which to guard it.)
+    EffectAnalyzer effects(getPassOptions(), *getModule(), curr);
+    if (effects.writesGlobalState() || effects.throws() ||
+        effects.transfersControlFlow() || effects.danglingPop ||
+        (effects.trap && !effects.trapsNeverHappen)) {
+      return false;
+    }
+    // As in the main scan, a read of mutable global state cannot be moved
+    // out of a loop that writes that state, and the value must not depend on
+    // anything the loop still sets.
+    if (effects.readsMutableGlobalState() && loopEffects.writesGlobalState()) {
+      return false;
+    }
+    if (!effects.localsRead.empty() &&
+        hasGetDependingOnLoopSet(curr, loopSets)) {
+      return false;
+    }
+    return true;
+  }
+
   bool interestingToMove(Expression* curr) {
     // In theory we could consider blocks, but then heavy nesting of
     // switch patterns would be heavy, and almost always pointless.
@@ -28,12 +28,16 @@
 // as necessary.
 //
 
+#include <atomic>
+#include <cstring>
+
 #include "ir/manipulation.h"
 #include "ir/module-utils.h"
 #include "ir/names.h"
 #include "ir/utils.h"
 #include "pass.h"
 #include "support/space.h"
+#include "support/threads.h"
 #include "wasm-binary.h"
 #include "wasm-builder.h"
 #include "wasm.h"
@@ -143,6 +147,46 @@ void MemoryPacking::run(PassRunner* runner, Module* module) {
     dropUnusedSegments(segments, referrers);
   }
 
+  // Fill in the referrers map, as the parallel work below reads it and must
+  // not mutate it.
+  for (size_t origIndex = 0; origIndex < segments.size(); ++origIndex) {
+    referrers[origIndex];
+  }
+
+  // Scanning the segments for their zero and nonzero ranges is the expensive
+  // part of planning the packing, and each segment is independent, so work
+  // through them in parallel. Everything afterwards appends the new segments
+  // and replacements in order, and so remains serial.
+  std::vector<std::vector<Range>> segmentRanges(segments.size());
+  {
+    std::atomic<size_t> nextSegment{0};
+    auto numWorkers = ThreadPool::get()->size();
+    std::vector<std::function<ThreadWorkState()>> doWorkers;
+    for (size_t i = 0; i < numWorkers; i++) {
+      doWorkers.push_back([&]() {
+        auto origIndex = nextSegment.fetch_add(1);
+        if (origIndex >= segments.size()) {
+          return ThreadWorkState::Finished;
+        }
+        auto& segment = segments[origIndex];
+        // Use find() rather than operator[], as the latter is not safe to
+        // call concurrently even on existing keys.
+        auto& currReferrers = referrers.find(origIndex)->second;
+        auto& ranges = segmentRanges[origIndex];
+        if (canSplit(segment, currReferrers)) {
+          calculateRanges(segment, currReferrers, ranges);
+        } else {
+          // A single range covers the entire segment. Set isZero to false so
+          // the original memory.init will be used even if segment is all
+          // zeroes.
+          ranges.push_back({false, 0, segment->data.size()});
+        }
+        return ThreadWorkState::More;
+      });
+    }
+    ThreadPool::get()->work(doWorkers);
+  }
+
   // The new, split memory segments
   std::vector<std::unique_ptr<DataSegment>> packed;
 
@@ -151,16 +195,7 @@ void MemoryPacking::run(PassRunner* runner, Module* module) {
   for (size_t origIndex = 0; origIndex < segments.size(); ++origIndex) {
     auto& segment = segments[origIndex];
     auto& currReferrers = referrers[origIndex];
-
-    std::vector<Range> ranges;
-
-    if (canSplit(segment, currReferrers)) {
-      calculateRanges(segment, currReferrers, ranges);
-    } else {
-      // A single range covers the entire segment. Set isZero to false so the
-      // original memory.init will be used even if segment is all zeroes.
-      ranges.push_back({false, 0, segment->data.size()});
-    }
+    auto& ranges = segmentRanges[origIndex];
 
     Index firstNewIndex = packed.size();
     size_t segmentsRemaining = segments.size() - origIndex;
@@ -168,6 +203,11 @@ void MemoryPacking::run(PassRunner* runner, Module* module) {
       builder, segment.get(), ranges, packed, segmentsRemaining);
     createReplacements(
       module, ranges, currReferrers, replacements, firstNewIndex);
+    // Free the original's data eagerly, now that the packed copies have been
+    // made; keeping every original segment alive until the swap below would
+    // multiply peak memory use on large modules.
+    segment->data.clear();
+    segment->data.shrink_to_fit();
   }
 
   segments.swap(packed);
@@ -283,10 +323,25 @@ void MemoryPacking::calculateRanges(const std::unique_ptr<DataSegment>& segment,
     return;
   }
 
-  // Calculate initial zero and nonzero ranges
+  // Calculate initial zero and nonzero ranges. Scanning a word at a time is
+  // much faster than byte at a time on large segments; the byte loops below
+  // only run at word boundaries and range edges.
+  auto loadWord = [&](size_t i) {
+    uint64_t word;
+    memcpy(&word, data.data() + i, sizeof(word));
+    return word;
+  };
+  // Whether a word contains a zero byte, using the usual bit trick.
+  auto hasZeroByte = [](uint64_t word) {
+    return ((word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL) !=
+           0;
+  };
   size_t start = 0;
   while (start < data.size()) {
     size_t end = start;
+    while (end + 8 <= data.size() && loadWord(end) == 0) {
+      end += 8;
+    }
     while (end < data.size() && data[end] == 0) {
       end++;
     }
@@ -294,6 +349,9 @@ void MemoryPacking::calculateRanges(const std::unique_ptr<DataSegment>& segment,
       ranges.push_back({true, start, end});
       start = end;
     }
+    while (end + 8 <= data.size() && !hasZeroByte(loadWord(end))) {
+      end += 8;
+    }
     while (end < data.size() && data[end] != 0) {
       end++;
     }
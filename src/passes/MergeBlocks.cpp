@@ -400,7 +400,7 @@ void BreakValueDropper::visitBlock(Block* curr) {
 
 struct MergeBlocks
   : public WalkerPass<
-      PostWalker<MergeBlocks, UnifiedExpressionVisitor<MergeBlocks>>> {
+      StaticPostWalker<MergeBlocks, UnifiedExpressionVisitor<MergeBlocks>>> {
   bool isFunctionParallel() override { return true; }
 
   Pass* create() override { return new MergeBlocks; }
@@ -285,14 +285,26 @@ void MergeSimilarFunctions::collectEquivalentClasses(
   auto hashes = FunctionHasher::createMap(module);
   PassRunner runner(module);
 
+  // The hash ignores the things that can be parameterized away (constant
+  // values and callees), but must include everything that areInEquvalentClass
+  // will still require to match: otherwise a single bucket can contain many
+  // distinct classes, and the pairwise comparisons against each of those
+  // classes blow up on modules with masses of near-duplicates. Aligning the
+  // hash with the equivalence relation keeps buckets and classes nearly 1:1.
   std::function<bool(Expression*, size_t&)> ignoringConsts =
     [&](Expression* expr, size_t& digest) {
-      // Ignore const's immediate operands.
-      if (expr->is<Const>()) {
+      // Ignore const's immediate operands, but not their type - constants of
+      // different types cannot be merged by parameterization.
+      if (auto* c = expr->dynCast<Const>()) {
+        rehash(digest, c->value.type.getID());
         return true;
       }
-      // Ignore callee operands.
+      // Ignore callee operands, but hash the callee's signature - calls to
+      // differently-typed callees cannot be merged either.
       if (auto* call = expr->dynCast<Call>()) {
+        rehash(digest, call->type.getID());
+        rehash(digest, call->operands.size());
+        rehash(digest, module->getFunction(call->target)->type.getID());
         for (auto operand : call->operands) {
           rehash(digest,
                  ExpressionAnalyzer::flexibleHash(operand, ignoringConsts));
@@ -15,9 +15,11 @@
  */
 
 #include <algorithm>
+#include <array>
 #include <iomanip>
 #include <ir/module-utils.h>
 #include <pass.h>
+#include <sstream>
 #include <support/colors.h>
 #include <wasm-binary.h>
 #include <wasm.h>
@@ -218,8 +220,162 @@ struct Metrics
   }
 };
 
+// Prints a machine-readable JSON summary of the module: expression counts
+// gathered in parallel across functions into flat arrays indexed by
+// Expression::Id, a power-of-two histogram of function body sizes, and
+// statistics on locals and their types. Unlike the "metrics" pass above this
+// is meant for tooling (e.g. a dashboard tracking IR composition over time),
+// not for humans reading pass output, so it does not diff against previous
+// invocations or use colors.
+struct JSONMetrics : public Pass {
+  bool modifiesBinaryenIR() override { return false; }
+
+  struct Info {
+    // How many of each expression id we saw. A flat array, as the set of ids
+    // is small and dense, which keeps the parallel counting cheap.
+    std::array<size_t, Expression::NumExpressionIds> counts{};
+    // The name of each id we saw, so that we can print names later without
+    // needing an instance of the expression.
+    std::array<const char*, Expression::NumExpressionIds> names{};
+    // The total number of expressions, i.e., the function body size.
+    size_t size = 0;
+  };
+
+  void run(PassRunner* runner, Module* module) override {
+    struct Counter
+      : public PostWalker<Counter, UnifiedExpressionVisitor<Counter>> {
+      Info& info;
+      Counter(Info& info) : info(info) {}
+      void visitExpression(Expression* curr) {
+        info.counts[curr->_id]++;
+        if (!info.names[curr->_id]) {
+          info.names[curr->_id] = getExpressionName(curr);
+        }
+        info.size++;
+      }
+    };
+
+    ModuleUtils::ParallelFunctionAnalysis<Info> analysis(
+      *module, [&](Function* func, Info& info) {
+        if (func->imported()) {
+          return;
+        }
+        Counter counter(info);
+        counter.walk(func->body);
+      });
+
+    // Aggregate the per-function results. The merges are all commutative, so
+    // the (nondeterministic) map order does not affect the output.
+    Info total;
+    std::vector<size_t> histogram;
+    size_t maxSize = 0;
+    for (auto& [_, info] : analysis.map) {
+      for (Index i = 0; i < Expression::NumExpressionIds; i++) {
+        total.counts[i] += info.counts[i];
+        if (info.names[i]) {
+          total.names[i] = info.names[i];
+        }
+      }
+      total.size += info.size;
+      maxSize = std::max(maxSize, info.size);
+      // Bucket b counts the functions of size at most 2^b.
+      size_t bucket = 0;
+      while ((size_t(1) << bucket) < info.size) {
+        bucket++;
+      }
+      if (bucket >= histogram.size()) {
+        histogram.resize(bucket + 1);
+      }
+      histogram[bucket]++;
+    }
+
+    // Locals and their types, over all defined functions.
+    size_t numParams = 0;
+    size_t numVars = 0;
+    std::map<std::string, size_t> localTypes;
+    ModuleUtils::iterDefinedFunctions(*module, [&](Function* func) {
+      numParams += func->getNumParams();
+      numVars += func->getNumVars();
+      for (Index i = 0; i < func->getNumLocals(); i++) {
+        std::stringstream ss;
+        ss << func->getLocalType(i);
+        localTypes[ss.str()]++;
+      }
+    });
+
+    ImportInfo imports(*module);
+    size_t memoryData = 0;
+    for (auto& segment : module->dataSegments) {
+      memoryData += segment->data.size();
+    }
+    size_t tableData = 0;
+    for (auto& segment : module->elementSegments) {
+      tableData += segment->data.size();
+    }
+
+    std::ostream& o = std::cout;
+    o << "{\n";
+    o << "  \"module\": {\n";
+    o << "    \"imports\": " << imports.getNumImports() << ",\n";
+    o << "    \"funcs\": " << imports.getNumDefinedFunctions() << ",\n";
+    o << "    \"globals\": " << imports.getNumDefinedGlobals() << ",\n";
+    o << "    \"tags\": " << imports.getNumDefinedTags() << ",\n";
+    o << "    \"exports\": " << module->exports.size() << ",\n";
+    o << "    \"tables\": " << imports.getNumDefinedTables() << ",\n";
+    o << "    \"memoryData\": " << memoryData << ",\n";
+    o << "    \"tableData\": " << tableData << "\n";
+    o << "  },\n";
+    // The expression names contain no characters that need JSON escaping,
+    // and neither do printed types.
+    o << "  \"exprs\": {\n";
+    bool first = true;
+    for (Index i = 0; i < Expression::NumExpressionIds; i++) {
+      if (!total.counts[i]) {
+        continue;
+      }
+      if (!first) {
+        o << ",\n";
+      }
+      first = false;
+      o << "    \"" << total.names[i] << "\": " << total.counts[i];
+    }
+    o << "\n  },\n";
+    o << "  \"exprTotal\": " << total.size << ",\n";
+    o << "  \"functionSizes\": {\n";
+    o << "    \"total\": " << total.size << ",\n";
+    o << "    \"max\": " << maxSize << ",\n";
+    // histogram[b] is the number of functions of size in (2^(b-1), 2^b].
+    o << "    \"histogram\": [";
+    for (Index i = 0; i < histogram.size(); i++) {
+      if (i > 0) {
+        o << ", ";
+      }
+      o << histogram[i];
+    }
+    o << "]\n";
+    o << "  },\n";
+    o << "  \"locals\": {\n";
+    o << "    \"params\": " << numParams << ",\n";
+    o << "    \"vars\": " << numVars << ",\n";
+    o << "    \"types\": {\n";
+    first = true;
+    for (auto& [type, count] : localTypes) {
+      if (!first) {
+        o << ",\n";
+      }
+      first = false;
+      o << "      \"" << type << "\": " << count;
+    }
+    o << "\n    }\n";
+    o << "  }\n";
+    o << "}\n";
+  }
+};
+
 Pass* createMetricsPass() { return new Metrics(false); }
 
 Pass* createFunctionMetricsPass() { return new Metrics(true); }
 
+Pass* createJSONMetricsPass() { return new JSONMetrics(); }
+
 } // namespace wasm
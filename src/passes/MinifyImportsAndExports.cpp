@@ -33,6 +33,7 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
 #include <asmjs/shared-constants.h>
@@ -59,7 +60,8 @@ private:
   void run(PassRunner* runner, Module* module) override {
     // Minify the imported names.
     Names::MinifiedNameGenerator names;
-    std::map<Name, Name> oldToNew;
+    std::unordered_map<Name, Name> oldToNew;
+    // Ordered, so that the emitted mapping is deterministic.
     std::map<Name, Name> newToOld;
     auto process = [&](Name& name) {
       auto iter = oldToNew.find(name);
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Monomorphization: clone functions per "interesting" argument pattern at
+// their call sites, so that later passes can specialize the clones. A
+// pattern is interesting if some argument is a constant, or a reference
+// whose type is more refined than the parameter. All call sites with the
+// same target and pattern share one clone.
+//
+// The clone keeps the original signature. Constant arguments are applied by
+// prepending local.sets of the constants to the clone's body, which
+// Precompute then propagates (and DeadArgumentElimination can remove the now
+// unused parameters). Refined argument types are not applied here: each
+// pattern just gets its own clone, whose single pattern of callers then lets
+// signature-refining tighten the parameter types. So this pass is meant to
+// be followed by the usual optimization pipeline.
+//
+// Cloning costs code size, so there is a budget: clones are created for the
+// most frequent patterns first, until the total size of the cloned bodies
+// reaches the budget (in IR nodes, default 1000):
+//
+//   --monomorphize --pass-arg=monomorphize-budget@10000
+//
+
+#include "ir/find_all.h"
+#include "ir/module-utils.h"
+#include "ir/names.h"
+#include "ir/properties.h"
+#include "ir/utils.h"
+#include "pass.h"
+#include "wasm-builder.h"
+#include "wasm.h"
+
+namespace wasm {
+
+namespace {
+
+struct Monomorphize : public Pass {
+  void run(PassRunner* runner, Module* module) override {
+    Index budget = std::max(
+      0,
+      atoi(runner->options
+             .getArgumentOrDefault("monomorphize-budget", "1000")
+             .c_str()));
+
+    // Find the candidate calls in parallel. For each call we compute a key
+    // describing the pattern of interesting arguments; calls without any
+    // interesting argument get no key and are ignored.
+    struct Candidate {
+      Call* call;
+      std::string key;
+    };
+    ModuleUtils::ParallelFunctionAnalysis<std::vector<Candidate>> scan(
+      *module, [&](Function* func, std::vector<Candidate>& candidates) {
+        if (func->imported()) {
+          return;
+        }
+        for (auto* call : FindAll<Call>(func->body).list) {
+          auto* target = module->getFunction(call->target);
+          if (target->imported()) {
+            continue;
+          }
+          bool interesting = false;
+          bool unreachable = false;
+          std::stringstream key;
+          for (Index i = 0; i < call->operands.size(); i++) {
+            auto* operand = call->operands[i];
+            if (operand->type == Type::unreachable) {
+              unreachable = true;
+              break;
+            }
+            if (Properties::isConstantExpression(operand) &&
+                !operand->type.isTuple()) {
+              interesting = true;
+              key << " const " << Properties::getLiteral(operand);
+            } else if (operand->type.isRef() &&
+                       operand->type != target->getLocalType(i)) {
+              // A more refined type than the parameter's. Each type pattern
+              // gets its own clone; we do not apply the types ourselves.
+              interesting = true;
+              key << " type " << operand->type.getID();
+            } else {
+              key << " -";
+            }
+          }
+          if (interesting && !unreachable) {
+            candidates.push_back({call, key.str()});
+          }
+        }
+      });
+
+    // Group the calls by target and pattern, deterministically: iterate
+    // callers in module order, and keep groups in first-seen order.
+    struct Group {
+      Name target;
+      std::vector<Call*> calls;
+    };
+    std::vector<Group> groups;
+    std::unordered_map<std::string, Index> groupIndexes;
+    ModuleUtils::iterDefinedFunctions(*module, [&](Function* func) {
+      for (auto& candidate : scan.map[func]) {
+        auto key = candidate.call->target.str + candidate.key;
+        auto [iter, inserted] = groupIndexes.emplace(key, groups.size());
+        if (inserted) {
+          groups.push_back({candidate.call->target, {}});
+        }
+        groups[iter->second].calls.push_back(candidate.call);
+      }
+    });
+    if (groups.empty()) {
+      return;
+    }
+
+    // Most frequent patterns first, so the budget goes where it helps most.
+    // Keep the first-seen order among equals for determinism.
+    std::stable_sort(groups.begin(), groups.end(), [](auto& a, auto& b) {
+      return a.calls.size() > b.calls.size();
+    });
+
+    Builder builder(*module);
+    Index used = 0;
+    for (auto& group : groups) {
+      auto* target = module->getFunction(group.target);
+      auto size = Measurer::measure(target->body);
+      if (used + size > budget) {
+        // Smaller functions further down the list may still fit.
+        continue;
+      }
+      used += size;
+
+      auto* clone = ModuleUtils::copyFunction(
+        target,
+        *module,
+        Names::getValidFunctionName(*module,
+                                    std::string("byn-mono$") +
+                                      group.target.str));
+      // Apply the constant arguments by setting them at the top of the
+      // clone; the call still passes them too, which later opts clean up.
+      std::vector<Expression*> sets;
+      auto* example = group.calls[0];
+      for (Index i = 0; i < example->operands.size(); i++) {
+        auto* operand = example->operands[i];
+        if (Properties::isConstantExpression(operand) &&
+            !operand->type.isTuple()) {
+          auto* constant =
+            builder.makeConstantExpression(Properties::getLiteral(operand));
+          sets.push_back(builder.makeLocalSet(i, constant));
+        }
+      }
+      if (!sets.empty()) {
+        sets.push_back(clone->body);
+        clone->body = builder.makeBlock(sets);
+      }
+      for (auto* call : group.calls) {
+        call->target = clone->name;
+      }
+    }
+  }
+};
+
+} // anonymous namespace
+
+Pass* createMonomorphizePass() { return new Monomorphize(); }
+
+} // namespace wasm
@@ -49,6 +49,20 @@ public:
 
   // Tries to optimize, and returns whether we propagated a change.
   bool optimize() {
+    bool propagated = false;
+    // After a successful propagation the new pointer may be propagatable
+    // again, as in x + 4 + 8 (nested structs in C can cause this): the new
+    // get is registered in the graph when we propagate, so we can simply
+    // retry until nothing changes, handling the chain in this single walk.
+    while (optimizeOne()) {
+      propagated = true;
+    }
+    return propagated;
+  }
+
+private:
+  // A single optimization step, returning whether we propagated a change.
+  bool optimizeOne() {
     // The pointer itself may be a constant, if e.g. it was precomputed or
     // a get that we propagated.
     if (curr->ptr->template is<Const>()) {
@@ -105,7 +119,6 @@ public:
     return false;
   }
 
-private:
   P* parent;
   T* curr;
   Module* module;
@@ -213,7 +226,15 @@ private:
           index = parent->getHelperIndex(set);
         }
         curr->offset = result.total;
-        curr->ptr = Builder(*module).makeLocalGet(index, Type::i32);
+        auto* newGet = Builder(*module).makeLocalGet(index, Type::i32);
+        if (canReuseIndex) {
+          // The new get reaches the same sets as the one we copied the index
+          // from; register that so a chained add can be propagated through it
+          // in this same walk.
+          localGraph->getSetses[newGet] =
+            localGraph->getSetses[otherSide->cast<LocalGet>()];
+        }
+        curr->ptr = newGet;
         return true;
       }
     }
@@ -267,10 +288,12 @@ struct OptimizeAddedConstants
   void doWalkFunction(Function* func) {
     // This pass is only valid under the assumption of unused low memory.
     assert(getPassOptions().lowMemoryUnused);
-    // Multiple passes may be needed if we have x + 4 + 8 etc. (nested structs
-    // in C can cause this, but it's rare). Note that we only need that for the
-    // propagation case (as 4 + 8 would be optimized directly if it were
-    // adjacent).
+    // Chains like x + 4 + 8 are handled within a single walk (see
+    // MemoryAccessOptimizer::optimize), but removing the sets that
+    // propagation made unneeded can make further sets propagatable, which
+    // needs another walk with a fresh graph. Note that this is only relevant
+    // in the propagation case (as 4 + 8 would be optimized directly if it
+    // were adjacent).
     while (1) {
       propagated = false;
       helperIndexes.clear();
@@ -205,7 +205,7 @@ template<class Opt> struct Match::Internal::MatchSelf<PureMatcherKind<Opt>> {
 
 // Main pass class
 struct OptimizeInstructions
-  : public WalkerPass<PostWalker<OptimizeInstructions>> {
+  : public WalkerPass<StaticPostWalker<OptimizeInstructions>> {
   bool isFunctionParallel() override { return true; }
 
   Pass* create() override { return new OptimizeInstructions; }
@@ -254,7 +254,7 @@ struct OptimizeInstructions
   bool inReplaceCurrent = false;
 
   void replaceCurrent(Expression* rep) {
-    WalkerPass<PostWalker<OptimizeInstructions>>::replaceCurrent(rep);
+    WalkerPass<StaticPostWalker<OptimizeInstructions>>::replaceCurrent(rep);
     // We may be able to apply multiple patterns as one may open opportunities
     // for others. NB: patterns must not have cycles
 
@@ -309,209 +309,247 @@ struct OptimizeInstructions
       using namespace Match;
       using namespace Abstract;
       Builder builder(*getModule());
-      {
-        // try to get rid of (0 - ..), that is, a zero only used to negate an
-        // int. an add of a subtract can be flipped in order to remove it:
-        //   (ival.add
-        //     (ival.sub
-        //       (ival.const 0)
-        //       X
-        //     )
-        //     Y
-        //   )
-        // =>
-        //   (ival.sub
-        //     Y
-        //     X
-        //   )
-        // Note that this reorders X and Y, so we need to be careful about that.
-        Expression *x, *y;
-        Binary* sub;
-        if (matches(
-              curr,
-              binary(Add, binary(&sub, Sub, ival(0), any(&x)), any(&y))) &&
-            canReorder(x, y)) {
-          sub->left = y;
-          sub->right = x;
-          return replaceCurrent(sub);
-        }
-      }
-      {
-        // The flip case is even easier, as no reordering occurs:
-        //   (ival.add
-        //     Y
-        //     (ival.sub
-        //       (ival.const 0)
-        //       X
-        //     )
-        //   )
-        // =>
-        //   (ival.sub
-        //     Y
-        //     X
-        //   )
-        Expression* y;
-        Binary* sub;
-        if (matches(curr,
-                    binary(Add, any(&y), binary(&sub, Sub, ival(0), any())))) {
-          sub->left = y;
-          return replaceCurrent(sub);
-        }
-      }
-      {
-        // try de-morgan's AND law,
-        //  (eqz X) and (eqz Y) === eqz (X or Y)
-        // Note that the OR and XOR laws do not work here, as these
-        // are not booleans (we could check if they are, but a boolean
-        // would already optimize with the eqz anyhow, unless propagating).
-        // But for AND, the left is true iff X and Y are each all zero bits,
-        // and the right is true if the union of their bits is zero; same.
-        Unary* un;
-        Binary* bin;
-        Expression *x, *y;
-        if (matches(curr,
-                    binary(&bin,
-                           AndInt32,
-                           unary(&un, EqZInt32, any(&x)),
-                           unary(EqZInt32, any(&y))))) {
-          bin->op = OrInt32;
-          bin->left = x;
-          bin->right = y;
-          un->value = bin;
-          return replaceCurrent(un);
+      // Dispatch on the root opcode, so that each node only tests the
+      // patterns that can possibly apply to it instead of wading through the
+      // entire list (matches() does check the root op first, but dozens of
+      // such checks add up). Patterns keep their original relative order.
+      switch (curr->op) {
+        case AddInt32:
+        case AddInt64: {
+          {
+            // try to get rid of (0 - ..), that is, a zero only used to negate
+            // an int. an add of a subtract can be flipped in order to remove
+            // it:
+            //   (ival.add
+            //     (ival.sub
+            //       (ival.const 0)
+            //       X
+            //     )
+            //     Y
+            //   )
+            // =>
+            //   (ival.sub
+            //     Y
+            //     X
+            //   )
+            // Note that this reorders X and Y, so we need to be careful about
+            // that.
+            Expression *x, *y;
+            Binary* sub;
+            if (matches(
+                  curr,
+                  binary(Add, binary(&sub, Sub, ival(0), any(&x)), any(&y))) &&
+                canReorder(x, y)) {
+              sub->left = y;
+              sub->right = x;
+              return replaceCurrent(sub);
+            }
+          }
+          {
+            // The flip case is even easier, as no reordering occurs:
+            //   (ival.add
+            //     Y
+            //     (ival.sub
+            //       (ival.const 0)
+            //       X
+            //     )
+            //   )
+            // =>
+            //   (ival.sub
+            //     Y
+            //     X
+            //   )
+            Expression* y;
+            Binary* sub;
+            if (matches(
+                  curr,
+                  binary(Add, any(&y), binary(&sub, Sub, ival(0), any())))) {
+              sub->left = y;
+              return replaceCurrent(sub);
+            }
+          }
+          break;
         }
-      }
-      {
-        // x <<>> (C & (31 | 63))   ==>   x <<>> C'
-        // x <<>> (y & (31 | 63))   ==>   x <<>> y
-        // x <<>> (y & (32 | 64))   ==>   x
-        // where '<<>>':
-        //   '<<', '>>', '>>>'. 'rotl' or 'rotr'
-        BinaryOp op;
-        Const* c;
-        Expression *x, *y;
-
-        // x <<>> C
-        if (matches(curr, binary(&op, any(&x), ival(&c))) &&
-            Abstract::hasAnyShift(op)) {
-          // truncate RHS constant to effective size as:
-          // i32(x) <<>> const(C & 31))
-          // i64(x) <<>> const(C & 63))
-          c->value = c->value.and_(
-            Literal::makeFromInt32(c->type.getByteSize() * 8 - 1, c->type));
-          // x <<>> 0   ==>   x
-          if (c->value.isZero()) {
-            return replaceCurrent(x);
+        case AndInt32: {
+          // try de-morgan's AND law,
+          //  (eqz X) and (eqz Y) === eqz (X or Y)
+          // Note that the OR and XOR laws do not work here, as these
+          // are not booleans (we could check if they are, but a boolean
+          // would already optimize with the eqz anyhow, unless propagating).
+          // But for AND, the left is true iff X and Y are each all zero bits,
+          // and the right is true if the union of their bits is zero; same.
+          Unary* un;
+          Binary* bin;
+          Expression *x, *y;
+          if (matches(curr,
+                      binary(&bin,
+                             AndInt32,
+                             unary(&un, EqZInt32, any(&x)),
+                             unary(EqZInt32, any(&y))))) {
+            bin->op = OrInt32;
+            bin->left = x;
+            bin->right = y;
+            un->value = bin;
+            return replaceCurrent(un);
           }
+          break;
         }
-        if (matches(curr,
-                    binary(&op, any(&x), binary(And, any(&y), ival(&c)))) &&
-            Abstract::hasAnyShift(op)) {
-          // i32(x) <<>> (y & 31)   ==>   x <<>> y
-          // i64(x) <<>> (y & 63)   ==>   x <<>> y
-          if ((c->type == Type::i32 && (c->value.geti32() & 31) == 31) ||
-              (c->type == Type::i64 && (c->value.geti64() & 63LL) == 63LL)) {
-            curr->cast<Binary>()->right = y;
-            return replaceCurrent(curr);
+        case ShlInt32:
+        case ShrSInt32:
+        case ShrUInt32:
+        case RotLInt32:
+        case RotRInt32:
+        case ShlInt64:
+        case ShrSInt64:
+        case ShrUInt64:
+        case RotLInt64:
+        case RotRInt64: {
+          {
+            // x <<>> (C & (31 | 63))   ==>   x <<>> C'
+            // x <<>> (y & (31 | 63))   ==>   x <<>> y
+            // x <<>> (y & (32 | 64))   ==>   x
+            // where '<<>>':
+            //   '<<', '>>', '>>>'. 'rotl' or 'rotr'
+            Const* c;
+            Expression *x, *y;
+
+            // x <<>> C
+            if (matches(curr, binary(any(&x), ival(&c)))) {
+              // truncate RHS constant to effective size as:
+              // i32(x) <<>> const(C & 31))
+              // i64(x) <<>> const(C & 63))
+              c->value = c->value.and_(
+                Literal::makeFromInt32(c->type.getByteSize() * 8 - 1, c->type));
+              // x <<>> 0   ==>   x
+              if (c->value.isZero()) {
+                return replaceCurrent(x);
+              }
+            }
+            if (matches(curr,
+                        binary(any(&x), binary(And, any(&y), ival(&c))))) {
+              // i32(x) <<>> (y & 31)   ==>   x <<>> y
+              // i64(x) <<>> (y & 63)   ==>   x <<>> y
+              if ((c->type == Type::i32 && (c->value.geti32() & 31) == 31) ||
+                  (c->type == Type::i64 &&
+                   (c->value.geti64() & 63LL) == 63LL)) {
+                curr->cast<Binary>()->right = y;
+                return replaceCurrent(curr);
+              }
+              // i32(x) <<>> (y & C)   ==>   x,  where (C & 31) == 0
+              // i64(x) <<>> (y & C)   ==>   x,  where (C & 63) == 0
+              if (((c->type == Type::i32 && (c->value.geti32() & 31) == 0) ||
+                   (c->type == Type::i64 &&
+                    (c->value.geti64() & 63LL) == 0LL)) &&
+                  !effects(y).hasSideEffects()) {
+                return replaceCurrent(x);
+              }
+            }
           }
-          // i32(x) <<>> (y & C)   ==>   x,  where (C & 31) == 0
-          // i64(x) <<>> (y & C)   ==>   x,  where (C & 63) == 0
-          if (((c->type == Type::i32 && (c->value.geti32() & 31) == 0) ||
-               (c->type == Type::i64 && (c->value.geti64() & 63LL) == 0LL)) &&
-              !effects(y).hasSideEffects()) {
-            return replaceCurrent(x);
+          if (getModule()->features.hasSignExt()) {
+            Const *c1, *c2;
+            Expression* x;
+            // i64(x) << 56 >> 56   ==>   i64.extend8_s(x)
+            // i64(x) << 48 >> 48   ==>   i64.extend16_s(x)
+            // i64(x) << 32 >> 32   ==>   i64.extend32_s(x)
+            if (matches(curr,
+                        binary(ShrSInt64,
+                               binary(ShlInt64, any(&x), i64(&c1)),
+                               i64(&c2))) &&
+                Bits::getEffectiveShifts(c1) == Bits::getEffectiveShifts(c2)) {
+              switch (64 - Bits::getEffectiveShifts(c1)) {
+                case 8:
+                  return replaceCurrent(builder.makeUnary(ExtendS8Int64, x));
+                case 16:
+                  return replaceCurrent(builder.makeUnary(ExtendS16Int64, x));
+                case 32:
+                  return replaceCurrent(builder.makeUnary(ExtendS32Int64, x));
+                default:
+                  break;
+              }
+            }
+            // i32(x) << 24 >> 24   ==>   i32.extend8_s(x)
+            // i32(x) << 16 >> 16   ==>   i32.extend16_s(x)
+            if (matches(curr,
+                        binary(ShrSInt32,
+                               binary(ShlInt32, any(&x), i32(&c1)),
+                               i32(&c2))) &&
+                Bits::getEffectiveShifts(c1) == Bits::getEffectiveShifts(c2)) {
+              switch (32 - Bits::getEffectiveShifts(c1)) {
+                case 8:
+                  return replaceCurrent(builder.makeUnary(ExtendS8Int32, x));
+                case 16:
+                  return replaceCurrent(builder.makeUnary(ExtendS16Int32, x));
+                default:
+                  break;
+              }
+            }
           }
+          break;
         }
-      }
-      {
-        // -x * -y   ==>   x * y
-        //   where  x, y  are integers
-        Binary* bin;
-        Expression *x, *y;
-        if (matches(curr,
-                    binary(&bin,
-                           Mul,
-                           binary(Sub, ival(0), any(&x)),
-                           binary(Sub, ival(0), any(&y))))) {
-          bin->left = x;
-          bin->right = y;
-          return replaceCurrent(curr);
-        }
-      }
-      {
-        // -x * y   ==>   -(x * y)
-        // x * -y   ==>   -(x * y)
-        //   where  x, y  are integers
-        Expression *x, *y;
-        if ((matches(curr,
-                     binary(Mul, binary(Sub, ival(0), any(&x)), any(&y))) ||
-             matches(curr,
-                     binary(Mul, any(&x), binary(Sub, ival(0), any(&y))))) &&
-            !x->is<Const>() && !y->is<Const>()) {
-          Builder builder(*getModule());
-          return replaceCurrent(
-            builder.makeBinary(Abstract::getBinary(curr->type, Sub),
-                               builder.makeConst(Literal::makeZero(curr->type)),
-                               builder.makeBinary(curr->op, x, y)));
-        }
-      }
-      {
-        if (getModule()->features.hasSignExt()) {
-          Const *c1, *c2;
-          Expression* x;
-          // i64(x) << 56 >> 56   ==>   i64.extend8_s(x)
-          // i64(x) << 48 >> 48   ==>   i64.extend16_s(x)
-          // i64(x) << 32 >> 32   ==>   i64.extend32_s(x)
-          if (matches(curr,
-                      binary(ShrSInt64,
-                             binary(ShlInt64, any(&x), i64(&c1)),
-                             i64(&c2))) &&
-              Bits::getEffectiveShifts(c1) == Bits::getEffectiveShifts(c2)) {
-            switch (64 - Bits::getEffectiveShifts(c1)) {
-              case 8:
-                return replaceCurrent(builder.makeUnary(ExtendS8Int64, x));
-              case 16:
-                return replaceCurrent(builder.makeUnary(ExtendS16Int64, x));
-              case 32:
-                return replaceCurrent(builder.makeUnary(ExtendS32Int64, x));
-              default:
-                break;
+        case MulInt32:
+        case MulInt64: {
+          {
+            // -x * -y   ==>   x * y
+            //   where  x, y  are integers
+            Binary* bin;
+            Expression *x, *y;
+            if (matches(curr,
+                        binary(&bin,
+                               Mul,
+                               binary(Sub, ival(0), any(&x)),
+                               binary(Sub, ival(0), any(&y))))) {
+              bin->left = x;
+              bin->right = y;
+              return replaceCurrent(curr);
             }
           }
-          // i32(x) << 24 >> 24   ==>   i32.extend8_s(x)
-          // i32(x) << 16 >> 16   ==>   i32.extend16_s(x)
-          if (matches(curr,
-                      binary(ShrSInt32,
-                             binary(ShlInt32, any(&x), i32(&c1)),
-                             i32(&c2))) &&
-              Bits::getEffectiveShifts(c1) == Bits::getEffectiveShifts(c2)) {
-            switch (32 - Bits::getEffectiveShifts(c1)) {
-              case 8:
-                return replaceCurrent(builder.makeUnary(ExtendS8Int32, x));
-              case 16:
-                return replaceCurrent(builder.makeUnary(ExtendS16Int32, x));
-              default:
-                break;
+          {
+            // -x * y   ==>   -(x * y)
+            // x * -y   ==>   -(x * y)
+            //   where  x, y  are integers
+            Expression *x, *y;
+            if ((matches(curr,
+                         binary(Mul, binary(Sub, ival(0), any(&x)), any(&y))) ||
+                 matches(
+                   curr,
+                   binary(Mul, any(&x), binary(Sub, ival(0), any(&y))))) &&
+                !x->is<Const>() && !y->is<Const>()) {
+              return replaceCurrent(builder.makeBinary(
+                Abstract::getBinary(curr->type, Sub),
+                builder.makeConst(Literal::makeZero(curr->type)),
+                builder.makeBinary(curr->op, x, y)));
             }
           }
+          break;
         }
-      }
-      {
-        // unsigned(x) >= 0   =>   i32(1)
-        Const* c;
-        Expression* x;
-        if (matches(curr, binary(GeU, pure(&x), ival(&c))) &&
-            c->value.isZero()) {
-          c->value = Literal::makeOne(Type::i32);
-          c->type = Type::i32;
-          return replaceCurrent(c);
+        case GeUInt32:
+        case GeUInt64: {
+          // unsigned(x) >= 0   =>   i32(1)
+          Const* c;
+          Expression* x;
+          if (matches(curr, binary(GeU, pure(&x), ival(&c))) &&
+              c->value.isZero()) {
+            c->value = Literal::makeOne(Type::i32);
+            c->type = Type::i32;
+            return replaceCurrent(c);
+          }
+          break;
         }
-        // unsigned(x) < 0   =>   i32(0)
-        if (matches(curr, binary(LtU, pure(&x), ival(&c))) &&
-            c->value.isZero()) {
-          c->value = Literal::makeZero(Type::i32);
-          c->type = Type::i32;
-          return replaceCurrent(c);
+        case LtUInt32:
+        case LtUInt64: {
+          // unsigned(x) < 0   =>   i32(0)
+          Const* c;
+          Expression* x;
+          if (matches(curr, binary(LtU, pure(&x), ival(&c))) &&
+              c->value.isZero()) {
+            c->value = Literal::makeZero(Type::i32);
+            c->type = Type::i32;
+            return replaceCurrent(c);
+          }
+          break;
+        }
+        default: {
+          break;
         }
       }
     }
@@ -0,0 +1,214 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Outlines repeated code into shared functions: if an identical expression
+// tree appears in enough places, all the appearances are replaced with calls
+// to a single new function containing that code, trading a small call at each
+// appearance for all but one of the copies.
+//
+// This complements CodeFolding, which merges duplicate code only where control
+// flow already converges (if-else arms, block tails); outlining works across
+// arbitrary functions of the entire module. Like merge-similar-functions this
+// helps code size at some cost in speed, so it is not part of the default
+// optimization pipeline.
+//
+// We only outline expressions that do not use locals, do not branch or return
+// out, and contain no dangling pop, as such code can be moved into another
+// function without any fixups. (Code using locals could be outlined by adding
+// parameters, but that needs a more complex cost model; TODO.) Candidates are
+// found by hashing every (large enough) expression in the module; actual
+// equality is verified before we optimize, as digests can collide.
+//
+
+#include <unordered_map>
+
+#include "ir/effects.h"
+#include "ir/module-utils.h"
+#include "ir/names.h"
+#include "ir/utils.h"
+#include "pass.h"
+#include "wasm-builder.h"
+#include "wasm.h"
+
+namespace wasm {
+
+namespace {
+
+// Marks all expressions in a tree, so we can note entire removed trees.
+struct ExpressionMarker
+  : public PostWalker<ExpressionMarker,
+                      UnifiedExpressionVisitor<ExpressionMarker>> {
+  std::set<Expression*>& marked;
+
+  ExpressionMarker(std::set<Expression*>& marked, Expression* expr)
+    : marked(marked) {
+    walk(expr);
+  }
+
+  void visitExpression(Expression* expr) { marked.insert(expr); }
+};
+
+// A call instruction is a byte for the opcode plus a LEB for the target.
+static const Index CALL_COST = 3;
+
+// Declaring a new function costs a few bytes in the function and code
+// sections, beyond its body.
+static const Index FUNCTION_OVERHEAD = 5;
+
+// Ignore expressions smaller than this: with a call at each appearance they
+// can never be worth outlining.
+static const Index MIN_OUTLINE_SIZE = CALL_COST + 1;
+
+struct Outlining : public Pass {
+  void run(PassRunner* runner, Module* module) override {
+    // First, find the appearances of each digest, in parallel.
+    struct Info {
+      std::vector<std::pair<size_t, Expression**>> appearances;
+    };
+
+    ModuleUtils::ParallelFunctionAnalysis<Info> analysis(
+      *module, [&](Function* func, Info& info) {
+        if (func->imported()) {
+          return;
+        }
+
+        struct Collector
+          : public PostWalker<Collector, UnifiedExpressionVisitor<Collector>> {
+          Info& info;
+          Collector(Info& info) : info(info) {}
+
+          void visitExpression(Expression* curr) {
+            if (curr->type == Type::unreachable) {
+              return;
+            }
+            if (Measurer::measure(curr) < MIN_OUTLINE_SIZE) {
+              return;
+            }
+            info.appearances.emplace_back(ExpressionAnalyzer::hash(curr),
+                                          getCurrentPointer());
+          }
+        };
+        Collector collector(info);
+        collector.walkFunctionInModule(func, module);
+      });
+
+    // Group the appearances by digest, in a deterministic order (we cannot
+    // iterate on analysis.map directly, as it is keyed by pointers).
+    std::unordered_map<size_t, std::vector<Expression**>> digestAppearances;
+    std::vector<size_t> digestOrder;
+    for (auto& func : module->functions) {
+      for (auto& [digest, pointer] : analysis.map[func.get()].appearances) {
+        auto& appearances = digestAppearances[digest];
+        if (appearances.empty()) {
+          digestOrder.push_back(digest);
+        }
+        appearances.push_back(pointer);
+      }
+    }
+
+    // Partition each digest's appearances into groups of actually-equal
+    // expressions, with at least two appearances each - those are our
+    // candidates for outlining.
+    struct Candidate {
+      std::vector<Expression**> appearances;
+      Index size;
+    };
+    std::vector<Candidate> candidates;
+    for (auto digest : digestOrder) {
+      auto& appearances = digestAppearances[digest];
+      while (appearances.size() >= 2) {
+        auto* first = *appearances[0];
+        std::vector<Expression**> equal, others;
+        for (auto** pointer : appearances) {
+          if (pointer == appearances[0] ||
+              ExpressionAnalyzer::equal(*pointer, first)) {
+            equal.push_back(pointer);
+          } else {
+            others.push_back(pointer);
+          }
+        }
+        if (equal.size() >= 2) {
+          candidates.push_back({std::move(equal), Measurer::measure(first)});
+        }
+        appearances.swap(others);
+      }
+    }
+
+    // Larger candidates first: outlining a large expression removes the
+    // appearances of everything nested in its removed copies, so handling it
+    // first gets the most savings.
+    std::stable_sort(candidates.begin(),
+                     candidates.end(),
+                     [](const Candidate& a, const Candidate& b) {
+                       return a.size > b.size;
+                     });
+
+    // Expressions no longer in the tree, because an enclosing expression was
+    // already outlined; appearances inside them are no longer real.
+    std::set<Expression*> removed;
+
+    Builder builder(*module);
+    for (auto& candidate : candidates) {
+      auto& appearances = candidate.appearances;
+      appearances.erase(std::remove_if(appearances.begin(),
+                                       appearances.end(),
+                                       [&](Expression** pointer) {
+                                         return removed.count(*pointer) > 0;
+                                       }),
+                        appearances.end());
+      auto count = appearances.size();
+      if (count < 2) {
+        continue;
+      }
+      auto* example = *appearances[0];
+
+      // Check the code can be moved to another function as-is.
+      EffectAnalyzer effects(runner->options, *module, example);
+      if (effects.accessesLocal() || effects.branchesOut ||
+          effects.hasExternalBreakTargets() || effects.danglingPop) {
+        continue;
+      }
+
+      // See if this is worth it: we save all copies but the one we keep, and
+      // pay for a call at each appearance plus the new function.
+      auto saved = (count - 1) * candidate.size;
+      auto cost = count * CALL_COST + FUNCTION_OVERHEAD;
+      if (saved <= cost) {
+        continue;
+      }
+
+      // Worth it! Move the first appearance into a new function, and call it
+      // from everywhere.
+      auto name = Names::getValidFunctionName(*module, "outlined");
+      module->addFunction(Builder::makeFunction(
+        name, Signature(Type::none, example->type), {}, example));
+      for (auto** pointer : appearances) {
+        if (pointer != appearances[0]) {
+          // This copy is now gone; anything nested in it no longer appears.
+          ExpressionMarker marker(removed, *pointer);
+        }
+        *pointer = builder.makeCall(name, {}, example->type);
+      }
+    }
+  }
+};
+
+} // anonymous namespace
+
+Pass* createOutliningPass() { return new Outlining(); }
+
+} // namespace wasm
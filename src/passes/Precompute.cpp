@@ -196,9 +196,14 @@ public:
 
 struct Precompute
   : public WalkerPass<
-      PostWalker<Precompute, UnifiedExpressionVisitor<Precompute>>> {
+      StaticPostWalker<Precompute, UnifiedExpressionVisitor<Precompute>>> {
   bool isFunctionParallel() override { return true; }
 
+  // Without propagation, each node is precomputed purely from its own
+  // subtree, so huge functions can be split across threads. (With
+  // propagation we need the whole function's local graph, see below.)
+  bool isSubtreeParallel() override { return !propagate; }
+
   Pass* create() override { return new Precompute(propagate); }
 
   bool propagate = false;
@@ -208,6 +213,15 @@ struct Precompute
   GetValues getValues;
   HeapValues heapValues;
 
+  // Structural hashes of expressions we know cannot be precomputed. A failed
+  // attempt is not cheap - the runner throws on the first nonconstant node -
+  // and identical nonconstant subtrees (address computations and the like)
+  // recur many times in large functions, so remember the failures and skip
+  // the repeats. Only used when not propagating, since with propagation the
+  // outcome of a local.get depends on which particular get it is, not just
+  // on its structure.
+  std::unordered_set<size_t> nonconstantMemo;
+
   void doWalkFunction(Function* func) {
     // Walk the function and precompute things.
     super::doWalkFunction(func);
@@ -272,13 +286,26 @@ struct Precompute
     if (Properties::isConstantExpression(curr) || curr->is<Nop>()) {
       return;
     }
+    size_t memoHash = 0;
+    if (!propagate) {
+      memoHash = ExpressionAnalyzer::hash(curr);
+      if (nonconstantMemo.count(memoHash)) {
+        return;
+      }
+    }
     // try to evaluate this into a const
     Flow flow = precomputeExpression(curr);
     if (!canEmitConstantFor(flow.values)) {
+      if (!propagate) {
+        nonconstantMemo.insert(memoHash);
+      }
       return;
     }
     if (flow.breaking()) {
       if (flow.breakTo == NONCONSTANT_FLOW) {
+        if (!propagate) {
+          nonconstantMemo.insert(memoHash);
+        }
         return;
       }
       if (flow.breakTo == RETURN_FLOW) {
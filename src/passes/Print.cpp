@@ -18,11 +18,15 @@
 // Print out text in s-expression format
 //
 
+#include <atomic>
+#include <sstream>
+
 #include <ir/iteration.h>
 #include <ir/module-utils.h>
 #include <ir/table-utils.h>
 #include <pass.h>
 #include <pretty_printing.h>
+#include <support/threads.h>
 #include <wasm-stack.h>
 #include <wasm.h>
 
@@ -128,6 +132,24 @@ static bool maybePrintRefShorthand(std::ostream& o, Type type) {
   return false;
 }
 
+// A memo of the names printed for heap types, so that a type that appears
+// many times in a module - the common case - is only named structurally once
+// per printout, and later occurrences are a single bulk write of the cached
+// string. The memo is only active during a single module print (see
+// PrintSExpression::visitModule), as the names depend on module state that
+// passes may change between printouts.
+static thread_local std::unordered_map<HeapType, std::string>*
+  activeTypeNameMemo = nullptr;
+
+struct TypeNameMemoScope {
+  std::unordered_map<HeapType, std::string> memo;
+  std::unordered_map<HeapType, std::string>* prev;
+  TypeNameMemoScope() : prev(activeTypeNameMemo) {
+    activeTypeNameMemo = &memo;
+  }
+  ~TypeNameMemoScope() { activeTypeNameMemo = prev; }
+};
+
 // Helper for printing the name of a type. This output is guaranteed to not
 // contain spaces.
 struct TypeNamePrinter {
@@ -142,8 +164,12 @@ struct TypeNamePrinter {
   // The stream we are printing to.
   std::ostream& os;
 
-  TypeNamePrinter(std::ostream& os, Module* wasm = nullptr)
-    : wasm(wasm), os(os) {}
+  // Whether to use the active memo, if any. The nested printer that fills in
+  // a memo entry must bypass the memo itself.
+  bool useMemo;
+
+  TypeNamePrinter(std::ostream& os, Module* wasm = nullptr, bool useMemo = true)
+    : wasm(wasm), os(os), useMemo(useMemo) {}
 
   void print(Type type);
   void print(HeapType heapType);
@@ -201,6 +227,19 @@ void TypeNamePrinter::print(HeapType type) {
     os << type;
     return;
   }
+  // At the top level, use the memo if one is active: after the first
+  // occurrence the name is a single buffered write. (Nested occurrences are
+  // part of an enclosing name and are handled by the logic below.)
+  if (useMemo && currHeapTypeDepth == 0 && activeTypeNameMemo) {
+    auto [it, inserted] = activeTypeNameMemo->insert({type, {}});
+    if (inserted) {
+      std::stringstream ss;
+      TypeNamePrinter(ss, wasm, false).print(type);
+      it->second = ss.str();
+    }
+    os << it->second;
+    return;
+  }
   // If there is a name for this type in this module, use it.
   // FIXME: in theory there could be two types, one with a name, and one
   // without, and the one without gets an automatic name that matches the
@@ -3213,8 +3252,60 @@ struct PrintSExpression : public UnifiedExpressionVisitor<PrintSExpression> {
                           << dylinkSection->tail.size() << "\n";
     }
   }
+  // Print all the defined functions of a module. They are almost all of the
+  // output for a typical module, and each one is rendered independently (all
+  // the printing state is per-function), so render them into per-function
+  // buffers on the thread pool and emit the buffers in order. Rendering into
+  // an in-memory buffer also avoids per-token writes to a (possibly unbuffered)
+  // output stream, which is a significant cost for large modules.
+  void printDefinedFunctions(Module& wasm) {
+    std::vector<Function*> funcs;
+    ModuleUtils::iterDefinedFunctions(
+      wasm, [&](Function* func) { funcs.push_back(func); });
+    auto* pool = ThreadPool::get();
+    if (pool->size() == 1 || pool->isRunning() || funcs.size() <= 1) {
+      // Too little to parallelize, or we are inside another parallel operation
+      // (e.g. printing for debugging from a function-parallel pass).
+      for (auto* func : funcs) {
+        visitDefinedFunction(func);
+      }
+      return;
+    }
+    std::vector<std::string> buffers(funcs.size());
+    std::atomic<size_t> nextFunc{0};
+    size_t numWorkers = pool->size();
+    std::vector<std::function<ThreadWorkState()>> doWorkers;
+    for (size_t i = 0; i < numWorkers; i++) {
+      doWorkers.push_back([&]() {
+        auto index = nextFunc.fetch_add(1);
+        if (index >= funcs.size()) {
+          return ThreadWorkState::Finished;
+        }
+        std::stringstream ss;
+        PrintSExpression print(ss);
+        print.setMinify(minify);
+        print.setFull(full);
+        print.setStackIR(stackIR);
+        print.setDebugInfo(debugInfo);
+        print.currModule = currModule;
+        print.indent = indent;
+        print.visitDefinedFunction(funcs[index]);
+        buffers[index] = ss.str();
+        return index + 1 < funcs.size() ? ThreadWorkState::More
+                                        : ThreadWorkState::Finished;
+      });
+    }
+    pool->work(doWorkers);
+    for (auto& buffer : buffers) {
+      o << buffer;
+    }
+  }
+
   void visitModule(Module* curr) {
     currModule = curr;
+    // Heap type names repeat constantly in a module; memoize them for the
+    // duration of this printout.
+    TypeNameMemoScope typeNameMemo;
     o << '(';
     printMajor(o, "module");
     if (curr->name.is()) {
@@ -3302,18 +3393,18 @@ struct PrintSExpression : public UnifiedExpressionVisitor<PrintSExpression> {
       printName(curr->start, o) << ')';
       o << maybeNewLine;
     }
-    ModuleUtils::iterDefinedFunctions(
-      *curr, [&](Function* func) { visitFunction(func); });
+    printDefinedFunctions(*curr);
     if (curr->dylinkSection) {
       printDylinkSection(curr->dylinkSection);
     }
     for (auto& section : curr->userSections) {
       doIndent(o, indent);
-      o << ";; custom section \"" << section.name << "\", size "
-        << section.data.size();
+      auto* data = section.getData();
+      auto size = section.getSize();
+      o << ";; custom section \"" << section.name << "\", size " << size;
       bool isPrintable = true;
-      for (auto c : section.data) {
-        if (!isprint(static_cast<unsigned char>(c))) {
+      for (size_t i = 0; i < size; i++) {
+        if (!isprint(static_cast<unsigned char>(data[i]))) {
           isPrintable = false;
           break;
         }
@@ -3322,7 +3413,8 @@ struct PrintSExpression : public UnifiedExpressionVisitor<PrintSExpression> {
         o << ", contents: ";
         // std::quoted is not available in all the supported compilers yet.
         o << '"';
-        for (auto c : section.data) {
+        for (size_t i = 0; i < size; i++) {
+          auto c = data[i];
           if (c == '\\' || c == '"') {
             o << '\\';
           }
@@ -30,15 +30,21 @@
 // So far this tracks constant values, and for everything else it considers
 // them unique (so each local.set of a non-constant is a unique value, each
 // merge is a unique value, etc.; there is no sophisticated value numbering
-// here).
+// here during the flow). After the flow converges, the final optimization
+// sweep additionally value-numbers pure expression trees structurally, so
+// that e.g. a second set of (x + 1) is recognized as redundant if x has not
+// changed in between.
 //
 
+#include <optional>
+
 #include <cfg/cfg-traversal.h>
 #include <ir/literal-utils.h>
 #include <ir/numbering.h>
 #include <ir/properties.h>
 #include <ir/utils.h>
 #include <pass.h>
+#include <support/hash.h>
 #include <support/unique_deferring_queue.h>
 #include <wasm-builder.h>
 #include <wasm.h>
@@ -55,6 +61,8 @@ namespace {
 struct Info {
   LocalValues start, end; // the local values at the start and end of the block
   std::vector<Expression**> setps;
+  // the values we created for merges in this block, per local index
+  std::unordered_map<Index, Index> mergeValues;
 };
 
 struct RedundantSetElimination
@@ -106,10 +114,6 @@ struct RedundantSetElimination
   // Use a value numbering for the values of expressions.
   ValueNumbering valueNumbering;
 
-  // In additon to valueNumbering, each block has values for each merge.
-  std::unordered_map<BasicBlock*, std::unordered_map<Index, Index>>
-    blockMergeValues;
-
   // A value that indicates we haven't seen this location yet.
   Index unseenValue;
 
@@ -130,7 +134,7 @@ struct RedundantSetElimination
   }
 
   Index getBlockMergeValue(BasicBlock* block, Index index) {
-    auto& mergeValues = blockMergeValues[block];
+    auto& mergeValues = block->contents.mergeValues;
     auto iter = mergeValues.find(index);
     if (iter != mergeValues.end()) {
       return iter->second;
@@ -143,16 +147,12 @@ struct RedundantSetElimination
   }
 
   bool isBlockMergeValue(BasicBlock* block, Index index, Index value) {
-    auto iter = blockMergeValues.find(block);
-    if (iter == blockMergeValues.end()) {
-      return false;
-    }
-    auto& mergeValues = iter->second;
-    auto iter2 = mergeValues.find(index);
-    if (iter2 == mergeValues.end()) {
+    auto& mergeValues = block->contents.mergeValues;
+    auto iter = mergeValues.find(index);
+    if (iter == mergeValues.end()) {
       return false;
     }
-    return value == iter2->second;
+    return value == iter->second;
   }
 
   Index getValue(Expression* expr, LocalValues& currValues) {
@@ -167,6 +167,81 @@ struct RedundantSetElimination
     return value;
   }
 
+  // Hash-consed value numbers for pure expression trees, keyed on the
+  // expression's own (shallow) contents plus the value numbers of its
+  // children. Two separate computations then get the same number if they
+  // compute the same operation on the same values, even though they are
+  // different Expression objects.
+  //
+  // This may only be used after the flow has converged, in the optimization
+  // sweep. The flow's convergence proof (see the NB comment below) depends on
+  // each set's value receiving a fixed number once computed, whereas a consed
+  // number changes as its inputs' numbers change across flow iterations.
+  //
+  // Maps a digest to the values with that digest, as (representative
+  // expression, child values, assigned value number). We must compare
+  // contents and not just digests, as digests can collide.
+  std::unordered_map<size_t,
+                     std::vector<std::tuple<Expression*, LocalValues, Index>>>
+    consedValues;
+
+  // Computes a value number for a pure tree of unary/binary operations on
+  // local.gets and constants, or returns nothing if the expression is not of
+  // that form (in particular, anything with side effects or whose value is
+  // not determined by its operands, like a call or a load, must keep getting
+  // a unique number).
+  std::optional<Index> getConsedValue(Expression* expr,
+                                      LocalValues& currValues) {
+    if (auto* get = expr->dynCast<LocalGet>()) {
+      return currValues[get->index];
+    }
+    if (Properties::isConstantExpression(expr)) {
+      return getValue(Properties::getLiterals(expr));
+    }
+    LocalValues childValues;
+    auto noteChild = [&](Expression* child) {
+      if (auto value = getConsedValue(child, currValues)) {
+        childValues.push_back(*value);
+        return true;
+      }
+      return false;
+    };
+    if (auto* unary = expr->dynCast<Unary>()) {
+      if (!noteChild(unary->value)) {
+        return std::nullopt;
+      }
+    } else if (auto* binary = expr->dynCast<Binary>()) {
+      if (!noteChild(binary->left) || !noteChild(binary->right)) {
+        return std::nullopt;
+      }
+    } else {
+      return std::nullopt;
+    }
+    auto digest = ExpressionAnalyzer::shallowHash(expr);
+    for (auto childValue : childValues) {
+      rehash(digest, childValue);
+    }
+    auto& bucket = consedValues[digest];
+    for (auto& [other, otherChildValues, value] : bucket) {
+      if (ExpressionAnalyzer::shallowEqual(expr, other) &&
+          childValues == otherChildValues) {
+        return value;
+      }
+    }
+    auto value = getUniqueValue();
+    bucket.emplace_back(expr, std::move(childValues), value);
+    return value;
+  }
+
+  // As getValue, but also hash-conses pure expressions. Only valid once the
+  // flow has converged, see above.
+  Index getOptimizeValue(Expression* expr, LocalValues& currValues) {
+    if (auto value = getConsedValue(expr, currValues)) {
+      return *value;
+    }
+    return getValue(expr, currValues);
+  }
+
   // flowing
 
   void flowValues(Function* func) {
@@ -333,7 +408,7 @@ struct RedundantSetElimination
       for (auto** setp : setps) {
         auto* set = (*setp)->cast<LocalSet>();
         auto oldValue = currValues[set->index];
-        auto newValue = getValue(set->value, currValues);
+        auto newValue = getOptimizeValue(set->value, currValues);
         auto index = set->index;
         if (newValue == oldValue) {
           remove(setp);
@@ -49,6 +49,23 @@
 
 namespace wasm {
 
+// The parsed intrinsics module. Parsing the wat blob takes a nontrivial
+// amount of time, so do it once per process and reuse the result: the module
+// is only ever read from, as the functions and globals we need are copied out
+// of it into the module being optimized. (The module is intentionally leaked
+// to avoid static destruction order issues.)
+static Module& getIntrinsicsModule() {
+  static Module* intrinsicsModule = []() {
+    auto* module = new Module();
+    std::string input(IntrinsicsModuleWast);
+    SExpressionParser parser(const_cast<char*>(input.c_str()));
+    Element& root = *parser.root;
+    SExpressionWasmBuilder builder(*module, *root[0], IRProfile::Normal);
+    return module;
+  }();
+  return *intrinsicsModule;
+}
+
 struct RemoveNonJSOpsPass : public WalkerPass<PostWalker<RemoveNonJSOpsPass>> {
   std::unique_ptr<Builder> builder;
   std::unordered_set<Name> neededIntrinsics;
@@ -73,15 +90,9 @@ struct RemoveNonJSOpsPass : public WalkerPass<PostWalker<RemoveNonJSOpsPass>> {
       return;
     }
 
-    // Parse the wat blob we have at the end of this file.
-    //
-    // TODO: only do this once per invocation of wasm2asm
-    Module intrinsicsModule;
-    std::string input(IntrinsicsModuleWast);
-    SExpressionParser parser(const_cast<char*>(input.c_str()));
-    Element& root = *parser.root;
-    SExpressionWasmBuilder builder(
-      intrinsicsModule, *root[0], IRProfile::Normal);
+    // Get the parsed intrinsics module, which is shared for the whole
+    // process. We only copy functions and globals out of it.
+    auto& intrinsicsModule = getIntrinsicsModule();
 
     std::set<Name> neededFunctions;
 
@@ -114,6 +114,31 @@ static bool tooCostlyToRunUnconditionally(const PassOptions& passOptions,
   return CostAnalyzer(curr).cost >= TooCostlyToRunUnconditionally;
 }
 
+// Branch hints are keyed on the hinted expression, so when we replace a hinted
+// branch with an equivalent one we must move the hint over, flipping it if the
+// new branch inverts the condition.
+static void transferBranchHint(Function* func,
+                               Expression* from,
+                               Expression* to,
+                               bool flipped = false) {
+  auto iter = func->branchHints.find(from);
+  if (iter == func->branchHints.end()) {
+    return;
+  }
+  auto likely = iter->second;
+  func->branchHints.erase(iter);
+  func->branchHints[to] = flipped ? !likely : likely;
+}
+
+// As above, for a branch that keeps its identity but had its condition
+// inverted in place.
+static void flipBranchHint(Function* func, Expression* curr) {
+  auto iter = func->branchHints.find(curr);
+  if (iter != func->branchHints.end()) {
+    iter->second = !iter->second;
+  }
+}
+
 struct RemoveUnusedBrs : public WalkerPass<PostWalker<RemoveUnusedBrs>> {
   bool isFunctionParallel() override { return true; }
 
@@ -354,6 +379,7 @@ struct RemoveUnusedBrs : public WalkerPass<PostWalker<RemoveUnusedBrs>> {
               curr->condition, br->value, getPassOptions(), *getModule())) {
           if (!br->condition) {
             br->condition = curr->condition;
+            transferBranchHint(getFunction(), curr, br);
           } else {
             // In this case we can replace
             //   if (condition1) br_if (condition2)
@@ -569,6 +595,7 @@ struct RemoveUnusedBrs : public WalkerPass<PostWalker<RemoveUnusedBrs>> {
             // there is the br_if, and then the br to the top, so just flip them
             // and the condition
             brIf->condition = builder.makeUnary(EqZInt32, brIf->condition);
+            flipBranchHint(getFunction(), brIf);
             last->name = brIf->name;
             brIf->name = loop->name;
             return true;
@@ -591,6 +618,7 @@ struct RemoveUnusedBrs : public WalkerPass<PostWalker<RemoveUnusedBrs>> {
                 builder.makeIf(brIf->condition,
                                builder.makeBreak(brIf->name),
                                stealSlice(builder, block, i + 1, list.size()));
+              transferBranchHint(getFunction(), brIf, list[i]);
               block->finalize();
               return true;
             }
@@ -819,7 +847,8 @@ struct RemoveUnusedBrs : public WalkerPass<PostWalker<RemoveUnusedBrs>> {
       }
       void visitSwitch(Switch* curr) {
         if (!curr->value) {
-          auto names = BranchUtils::getUniqueTargets(curr);
+          auto names =
+            BranchUtils::getUniqueTargets<BranchUtils::SmallNameSet>(curr);
           for (auto name : names) {
             if (auto* target = findBreakTarget(name)->dynCast<Block>()) {
               branchesToBlock[target].push_back(curr);
@@ -917,6 +946,7 @@ struct RemoveUnusedBrs : public WalkerPass<PostWalker<RemoveUnusedBrs>> {
             // we are an if-else where the ifTrue is a break without a
             // condition, so we can do this
             ifTrueBreak->condition = iff->condition;
+            transferBranchHint(getFunction(), iff, ifTrueBreak);
             ifTrueBreak->finalize();
             list[i] = Builder(*getModule()).dropIfConcretelyTyped(ifTrueBreak);
             ExpressionManipulator::spliceIntoBlock(curr, i + 1, iff->ifFalse);
@@ -931,6 +961,7 @@ struct RemoveUnusedBrs : public WalkerPass<PostWalker<RemoveUnusedBrs>> {
                                 *getModule())) {
             ifFalseBreak->condition =
               Builder(*getModule()).makeUnary(EqZInt32, iff->condition);
+            transferBranchHint(getFunction(), iff, ifFalseBreak, true);
             ifFalseBreak->finalize();
             list[i] = Builder(*getModule()).dropIfConcretelyTyped(ifFalseBreak);
             ExpressionManipulator::spliceIntoBlock(curr, i + 1, iff->ifTrue);
@@ -981,7 +1012,8 @@ struct RemoveUnusedBrs : public WalkerPass<PostWalker<RemoveUnusedBrs>> {
       }
 
       void visitSwitch(Switch* curr) {
-        if (BranchUtils::getUniqueTargets(curr).size() == 1) {
+        if (BranchUtils::getUniqueTargets<BranchUtils::SmallNameSet>(curr)
+              .size() == 1) {
           // This switch has just one target no matter what; replace with a br
           // if we can (to do so, we must put the condition before a possible
           // value).
@@ -1046,8 +1078,10 @@ struct RemoveUnusedBrs : public WalkerPass<PostWalker<RemoveUnusedBrs>> {
               // no other breaks to that name, so we can do this
               if (!drop) {
                 assert(!br->value);
-                replaceCurrent(builder.makeIf(
-                  builder.makeUnary(EqZInt32, br->condition), curr));
+                auto* iff = builder.makeIf(
+                  builder.makeUnary(EqZInt32, br->condition), curr);
+                transferBranchHint(getFunction(), br, iff, true);
+                replaceCurrent(iff);
                 ExpressionManipulator::nop(br);
                 curr->finalize(curr->type);
               } else {
@@ -1059,8 +1093,9 @@ struct RemoveUnusedBrs : public WalkerPass<PostWalker<RemoveUnusedBrs>> {
                   if (EffectAnalyzer::canReorder(
                         passOptions, *getModule(), br->condition, br->value)) {
                     ExpressionManipulator::nop(list[0]);
-                    replaceCurrent(
-                      builder.makeIf(br->condition, br->value, curr));
+                    auto* iff = builder.makeIf(br->condition, br->value, curr);
+                    transferBranchHint(getFunction(), br, iff);
+                    replaceCurrent(iff);
                   }
                 } else {
                   // The value has side effects, so it must always execute. We
@@ -1217,6 +1252,7 @@ struct RemoveUnusedBrs : public WalkerPass<PostWalker<RemoveUnusedBrs>> {
                     builder.flip(iff);
                   }
                   br->condition = iff->condition;
+                  transferBranchHint(getFunction(), iff, br, flipCondition);
                   br->finalize();
                   set->value = two;
                   auto* block = builder.makeSequence(br, set);
@@ -1285,6 +1321,7 @@ struct RemoveUnusedBrs : public WalkerPass<PostWalker<RemoveUnusedBrs>> {
         LocalGet* get = iff->ifTrue->dynCast<LocalGet>();
         if (get && get->index == set->index) {
           builder.flip(iff);
+          flipBranchHint(getFunction(), iff);
         } else {
           get = iff->ifFalse->dynCast<LocalGet>();
           if (get && get->index != set->index) {
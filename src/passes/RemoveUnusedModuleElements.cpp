@@ -36,10 +36,111 @@ enum class ModuleElementKind { Function, Global, Tag, Table, ElementSegment };
 
 typedef std::pair<ModuleElementKind, Name> ModuleElement;
 
+// The outgoing references of one piece of code: everything it mentions that
+// may keep other module elements alive. These are computed for all functions
+// in parallel, up front, and the reachability fixpoint then runs over the
+// summaries only, without re-walking any function body.
+struct ReferenceSummary {
+  std::unordered_set<Name> calledFunctions;
+  std::unordered_set<Name> usedGlobals;
+  std::unordered_set<Name> usedTables;
+  std::unordered_set<Name> usedTags;
+  bool usesMemory = false;
+
+  // The signatures of CallRefs, and the RefFuncs, that appear here. These are
+  // kept separate as they only make functions reachable in combination, see
+  // uncalledRefFuncMap below.
+  std::unordered_set<HeapType> calledSignatures;
+  std::vector<std::pair<HeapType, Name>> refFuncs;
+};
+
+struct ReferenceCollector : public PostWalker<ReferenceCollector> {
+  ReferenceCollector(Module& wasm, ReferenceSummary& summary)
+    : wasm(wasm), summary(summary) {
+    setModule(&wasm);
+  }
+
+  void visitCall(Call* curr) {
+    summary.calledFunctions.insert(curr->target);
+
+    if (Intrinsics(wasm).isCallWithoutEffects(curr)) {
+      // A call-without-effects receives a function reference and calls it, the
+      // same as a CallRef. When we have a flag for non-closed-world, we should
+      // handle this automatically by the reference flowing out to an import,
+      // which is what binaryen intrinsics look like. For now, to support use
+      // cases of a closed world but that also use this intrinsic, handle the
+      // intrinsic specifically here. (Without that, the closed world assumption
+      // makes us ignore the function ref that flows to an import, so we are not
+      // aware that it is actually called.)
+      auto* target = curr->operands.back();
+      if (auto* refFunc = target->dynCast<RefFunc>()) {
+        // We can see exactly where this goes.
+        summary.calledFunctions.insert(refFunc->func);
+      } else if (target->type.isRef()) {
+        // All we can see is the type, so this acts as a CallRef of that.
+        summary.calledSignatures.insert(target->type.getHeapType());
+      }
+    }
+  }
+
+  void visitCallIndirect(CallIndirect* curr) {
+    summary.usedTables.insert(curr->table);
+  }
+
+  void visitCallRef(CallRef* curr) {
+    // Ignore unreachable code.
+    if (curr->target->type.isRef()) {
+      summary.calledSignatures.insert(curr->target->type.getHeapType());
+    }
+  }
+
+  void visitGlobalGet(GlobalGet* curr) {
+    summary.usedGlobals.insert(curr->name);
+  }
+  void visitGlobalSet(GlobalSet* curr) {
+    summary.usedGlobals.insert(curr->name);
+  }
+
+  void visitLoad(Load* curr) { summary.usesMemory = true; }
+  void visitStore(Store* curr) { summary.usesMemory = true; }
+  void visitAtomicCmpxchg(AtomicCmpxchg* curr) { summary.usesMemory = true; }
+  void visitAtomicRMW(AtomicRMW* curr) { summary.usesMemory = true; }
+  void visitAtomicWait(AtomicWait* curr) { summary.usesMemory = true; }
+  void visitAtomicNotify(AtomicNotify* curr) { summary.usesMemory = true; }
+  void visitAtomicFence(AtomicFence* curr) { summary.usesMemory = true; }
+  void visitMemoryInit(MemoryInit* curr) { summary.usesMemory = true; }
+  void visitDataDrop(DataDrop* curr) { summary.usesMemory = true; }
+  void visitMemoryCopy(MemoryCopy* curr) { summary.usesMemory = true; }
+  void visitMemoryFill(MemoryFill* curr) { summary.usesMemory = true; }
+  void visitMemorySize(MemorySize* curr) { summary.usesMemory = true; }
+  void visitMemoryGrow(MemoryGrow* curr) { summary.usesMemory = true; }
+  void visitRefFunc(RefFunc* curr) {
+    summary.refFuncs.emplace_back(curr->type.getHeapType(), curr->func);
+  }
+  void visitTableGet(TableGet* curr) { summary.usedTables.insert(curr->table); }
+  void visitTableSet(TableSet* curr) { summary.usedTables.insert(curr->table); }
+  void visitTableSize(TableSize* curr) {
+    summary.usedTables.insert(curr->table);
+  }
+  void visitTableGrow(TableGrow* curr) {
+    summary.usedTables.insert(curr->table);
+  }
+  void visitThrow(Throw* curr) { summary.usedTags.insert(curr->tag); }
+  void visitTry(Try* curr) {
+    for (auto tag : curr->catchTags) {
+      summary.usedTags.insert(tag);
+    }
+  }
+
+private:
+  Module& wasm;
+  ReferenceSummary& summary;
+};
+
 // Finds reachabilities
 // TODO: use Effects to determine if a memory is used
 
-struct ReachabilityAnalyzer : public PostWalker<ReachabilityAnalyzer> {
+struct ReachabilityAnalyzer {
   Module* module;
   std::vector<ModuleElement> queue;
   std::set<ModuleElement> reachable;
@@ -66,18 +167,26 @@ struct ReachabilityAnalyzer : public PostWalker<ReachabilityAnalyzer> {
   //       check for RefFuncs that flow out to exports or imports
   std::unordered_map<HeapType, std::unordered_set<Name>> uncalledRefFuncMap;
 
+  // The reference summary of each function, computed in parallel up front.
+  ModuleUtils::ParallelFunctionAnalysis<ReferenceSummary> summaries;
+
   ReachabilityAnalyzer(Module* module, const std::vector<ModuleElement>& roots)
-    : module(module) {
+    : module(module),
+      summaries(*module, [&](Function* func, ReferenceSummary& summary) {
+        if (!func->imported()) {
+          ReferenceCollector(*module, summary).walk(func->body);
+        }
+      }) {
     queue = roots;
     // Globals used in memory/table init expressions are also roots
     for (auto& segment : module->dataSegments) {
       if (!segment->isPassive) {
-        walk(segment->offset);
+        applyCode(segment->offset);
       }
     }
     for (auto& segment : module->elementSegments) {
       if (segment->table.is()) {
-        walk(segment->offset);
+        applyCode(segment->offset);
       }
     }
 
@@ -88,21 +197,21 @@ struct ReachabilityAnalyzer : public PostWalker<ReachabilityAnalyzer> {
       if (reachable.emplace(curr).second) {
         auto& [kind, value] = curr;
         if (kind == ModuleElementKind::Function) {
-          // if not an import, walk it
+          // if not an import, apply its summary
           auto* func = module->getFunction(value);
           if (!func->imported()) {
-            walk(func->body);
+            apply(summaries.map[func]);
           }
         } else if (kind == ModuleElementKind::Global) {
           // if not imported, it has an init expression we need to walk
           auto* global = module->getGlobal(value);
           if (!global->imported()) {
-            walk(global->init);
+            applyCode(global->init);
           }
         } else if (kind == ModuleElementKind::Table) {
           ModuleUtils::iterTableSegments(
             *module, curr.second, [&](ElementSegment* segment) {
-              walk(segment->offset);
+              applyCode(segment->offset);
             });
         }
       }
@@ -123,43 +232,39 @@ struct ReachabilityAnalyzer : public PostWalker<ReachabilityAnalyzer> {
     });
   }
 
-  void visitCall(Call* curr) {
-    maybeAdd(ModuleElement(ModuleElementKind::Function, curr->target));
-
-    if (Intrinsics(*module).isCallWithoutEffects(curr)) {
-      // A call-without-effects receives a function reference and calls it, the
-      // same as a CallRef. When we have a flag for non-closed-world, we should
-      // handle this automatically by the reference flowing out to an import,
-      // which is what binaryen intrinsics look like. For now, to support use
-      // cases of a closed world but that also use this intrinsic, handle the
-      // intrinsic specifically here. (Without that, the closed world assumption
-      // makes us ignore the function ref that flows to an import, so we are not
-      // aware that it is actually called.)
-      auto* target = curr->operands.back();
-      if (auto* refFunc = target->dynCast<RefFunc>()) {
-        // We can see exactly where this goes.
-        Call call(module->allocator);
-        call.target = refFunc->func;
-        visitCall(&call);
-      } else {
-        // All we can see is the type, so do a CallRef of that.
-        CallRef callRef(module->allocator);
-        callRef.target = target;
-        visitCallRef(&callRef);
-      }
+  // Merge everything a piece of code refers to into the reachability state,
+  // queueing newly-relevant elements.
+  void apply(const ReferenceSummary& summary) {
+    for (auto func : summary.calledFunctions) {
+      maybeAdd(ModuleElement(ModuleElementKind::Function, func));
     }
-  }
-
-  void visitCallIndirect(CallIndirect* curr) { maybeAddTable(curr->table); }
-
-  void visitCallRef(CallRef* curr) {
-    // Ignore unreachable code.
-    if (!curr->target->type.isRef()) {
-      return;
+    for (auto global : summary.usedGlobals) {
+      maybeAdd(ModuleElement(ModuleElementKind::Global, global));
+    }
+    for (auto table : summary.usedTables) {
+      maybeAddTable(table);
+    }
+    for (auto tag : summary.usedTags) {
+      maybeAdd(ModuleElement(ModuleElementKind::Tag, tag));
     }
+    usesMemory = usesMemory || summary.usesMemory;
+    for (auto type : summary.calledSignatures) {
+      noteCallRef(type);
+    }
+    for (auto& [type, func] : summary.refFuncs) {
+      noteRefFunc(type, func);
+    }
+  }
 
-    auto type = curr->target->type.getHeapType();
+  // Walk code that has no precomputed summary (global inits, segment offsets;
+  // these are tiny) and merge what it refers to.
+  void applyCode(Expression* curr) {
+    ReferenceSummary summary;
+    ReferenceCollector(*module, summary).walk(curr);
+    apply(summary);
+  }
 
+  void noteCallRef(HeapType type) {
     // Call all the functions of that signature. We can then forget about
     // them, as this signature will be marked as called.
     auto iter = uncalledRefFuncMap.find(type);
@@ -179,28 +284,7 @@ struct ReachabilityAnalyzer : public PostWalker<ReachabilityAnalyzer> {
     calledSignatures.insert(type);
   }
 
-  void visitGlobalGet(GlobalGet* curr) {
-    maybeAdd(ModuleElement(ModuleElementKind::Global, curr->name));
-  }
-  void visitGlobalSet(GlobalSet* curr) {
-    maybeAdd(ModuleElement(ModuleElementKind::Global, curr->name));
-  }
-
-  void visitLoad(Load* curr) { usesMemory = true; }
-  void visitStore(Store* curr) { usesMemory = true; }
-  void visitAtomicCmpxchg(AtomicCmpxchg* curr) { usesMemory = true; }
-  void visitAtomicRMW(AtomicRMW* curr) { usesMemory = true; }
-  void visitAtomicWait(AtomicWait* curr) { usesMemory = true; }
-  void visitAtomicNotify(AtomicNotify* curr) { usesMemory = true; }
-  void visitAtomicFence(AtomicFence* curr) { usesMemory = true; }
-  void visitMemoryInit(MemoryInit* curr) { usesMemory = true; }
-  void visitDataDrop(DataDrop* curr) { usesMemory = true; }
-  void visitMemoryCopy(MemoryCopy* curr) { usesMemory = true; }
-  void visitMemoryFill(MemoryFill* curr) { usesMemory = true; }
-  void visitMemorySize(MemorySize* curr) { usesMemory = true; }
-  void visitMemoryGrow(MemoryGrow* curr) { usesMemory = true; }
-  void visitRefFunc(RefFunc* curr) {
-    auto type = curr->type.getHeapType();
+  void noteRefFunc(HeapType type, Name func) {
     if (calledSignatures.count(type)) {
       // We must not have a type in both calledSignatures and
       // uncalledRefFuncMap: once it is called, we do not track RefFuncs for it
@@ -208,22 +292,10 @@ struct ReachabilityAnalyzer : public PostWalker<ReachabilityAnalyzer> {
       assert(uncalledRefFuncMap.count(type) == 0);
 
       // We've seen a RefFunc for this, so it is reachable.
-      maybeAdd(ModuleElement(ModuleElementKind::Function, curr->func));
+      maybeAdd(ModuleElement(ModuleElementKind::Function, func));
     } else {
       // We've never seen a CallRef for this, but might see one later.
-      uncalledRefFuncMap[type].insert(curr->func);
-    }
-  }
-  void visitTableGet(TableGet* curr) { maybeAddTable(curr->table); }
-  void visitTableSet(TableSet* curr) { maybeAddTable(curr->table); }
-  void visitTableSize(TableSize* curr) { maybeAddTable(curr->table); }
-  void visitTableGrow(TableGrow* curr) { maybeAddTable(curr->table); }
-  void visitThrow(Throw* curr) {
-    maybeAdd(ModuleElement(ModuleElementKind::Tag, curr->tag));
-  }
-  void visitTry(Try* curr) {
-    for (auto tag : curr->catchTags) {
-      maybeAdd(ModuleElement(ModuleElementKind::Tag, tag));
+      uncalledRefFuncMap[type].insert(func);
     }
   }
 };
@@ -27,15 +27,18 @@
 namespace wasm {
 
 struct RemoveUnusedNames
-  : public WalkerPass<PostWalker<RemoveUnusedNames,
-                                 UnifiedExpressionVisitor<RemoveUnusedNames>>> {
+  : public WalkerPass<
+      StaticPostWalker<RemoveUnusedNames,
+                       UnifiedExpressionVisitor<RemoveUnusedNames>>> {
   bool isFunctionParallel() override { return true; }
 
   Pass* create() override { return new RemoveUnusedNames; }
 
   // We maintain a list of branches that we saw in children, then when we reach
-  // a parent block, we know if it was branched to
-  std::map<Name, std::set<Expression*>> branchesSeen;
+  // a parent block, we know if it was branched to. Names compare and hash by
+  // identity, so an unordered map avoids any tree rebalancing in what is the
+  // hottest structure of this pass.
+  std::unordered_map<Name, std::unordered_set<Expression*>> branchesSeen;
 
   void visitExpression(Expression* curr) {
     BranchUtils::operateOnScopeNameUses(curr, [&](Name& name) {
@@ -26,11 +26,34 @@
 // order, the has some natural tendency one way or the other). TODO: investigate
 // similarity ordering here (see #4322)
 //
+// When given a wasm-split profile via
+//
+//   --reorder-functions-profile=file.prof
+//
+// the pass instead optimizes the code section layout for startup: functions
+// the profile saw executed are grouped into call-chain clusters (each function
+// is appended after its predominant static caller, as in C3 layout), and the
+// clusters are emitted in first-use order, so functions that call each other
+// land on the same or nearby memory pages. Functions the profile never saw
+// are placed at the end, sorted by use count as above.
+//
+// This file also contains reorder-functions-for-streaming, which schedules the
+// code section for engines that compile it in order while downloading: the
+// startup-critical functions are moved to the very front, and everything else
+// is deferred to the end without changing its relative order, so it can be
+// combined with a prior reorder-functions run. See that pass for details.
+//
 
+#include <fstream>
 #include <memory>
+#include <sstream>
 
 #include <ir/element-utils.h>
+#include <ir/find_all.h>
+#include <ir/module-utils.h>
+#include <ir/utils.h>
 #include <pass.h>
+#include <support/file.h>
 #include <wasm.h>
 
 namespace wasm {
@@ -56,7 +79,45 @@ private:
   NameCountMap* counts;
 };
 
+// Read a wasm-split profile: a module hash, then one first-use timestamp per
+// defined function, in module order (zero means never called). See
+// "wasm-split profile format" in tools/wasm-split/instrumenter.cpp. We do not
+// have the file the profile was recorded against, so the hash cannot be
+// verified here; a mismatched profile shows up as a size mismatch.
+static std::unordered_map<Name, uint32_t>
+readFirstUseProfile(Module* module, const std::string& profileFile) {
+  auto data = read_file<std::vector<char>>(profileFile, Flags::Binary);
+  size_t pos = 0;
+  auto readi32 = [&]() {
+    if (pos + 4 > data.size()) {
+      Fatal() << "Unexpected end of profile data in " << profileFile;
+    }
+    uint32_t i32 = 0;
+    i32 |= uint32_t(uint8_t(data[pos++]));
+    i32 |= uint32_t(uint8_t(data[pos++])) << 8;
+    i32 |= uint32_t(uint8_t(data[pos++])) << 16;
+    i32 |= uint32_t(uint8_t(data[pos++])) << 24;
+    return i32;
+  };
+  readi32();
+  readi32();
+  std::unordered_map<Name, uint32_t> firstUse;
+  ModuleUtils::iterDefinedFunctions(
+    *module, [&](Function* func) { firstUse[func->name] = readi32(); });
+  if (pos != data.size()) {
+    Fatal() << "Unexpected extra profile data in " << profileFile
+            << " (was it recorded against this module?)";
+  }
+  return firstUse;
+}
+
 struct ReorderFunctions : public Pass {
+  // When clustering, stop growing a cluster past this many expression nodes.
+  // The node count is a rough proxy for code size; the cap keeps each cluster
+  // within a handful of memory pages, so that clustering one very hot chain
+  // does not drag the entire module into a single "cluster".
+  static const Index MaxClusterSize = 1 << 14;
+
   void run(PassRunner* runner, Module* module) override {
     NameCountMap counts;
     // fill in info, as we operate on it in parallel (each function to its own
@@ -75,6 +136,12 @@ struct ReorderFunctions : public Pass {
     }
     ElementUtils::iterAllElementFunctionNames(
       module, [&](Name& name) { counts[name]++; });
+    auto profileFile = runner->options.getArgumentOrDefault(
+      "reorder-functions-profile", "");
+    if (!profileFile.empty()) {
+      clusterByProfile(module, counts, profileFile);
+      return;
+    }
     // sort
     std::sort(module->functions.begin(),
               module->functions.end(),
@@ -86,8 +153,249 @@ struct ReorderFunctions : public Pass {
                 return counts[a->name] > counts[b->name];
               });
   }
+
+  void clusterByProfile(Module* module,
+                        NameCountMap& counts,
+                        const std::string& profileFile) {
+    auto firstUse = readFirstUseProfile(module, profileFile);
+
+    // Count each function's static calls to each callee, in parallel. These
+    // are the edge weights for clustering.
+    using CalleeCounts = std::unordered_map<Name, Index>;
+    ModuleUtils::ParallelFunctionAnalysis<CalleeCounts> analysis(
+      *module, [&](Function* func, CalleeCounts& calleeCounts) {
+        if (func->imported()) {
+          return;
+        }
+        for (auto* call : FindAll<Call>(func->body).list) {
+          calleeCounts[call->target]++;
+        }
+      });
+
+    // For each callee, find the caller with the most call sites; that is the
+    // function we want it placed after. Iterate callers in module order so
+    // that ties break deterministically.
+    std::unordered_map<Name, Name> bestCaller;
+    std::unordered_map<Name, Index> bestCallerWeight;
+    for (auto& func : module->functions) {
+      if (func->imported()) {
+        continue;
+      }
+      for (auto& [callee, weight] : analysis.map[func.get()]) {
+        if (callee != func->name && weight > bestCallerWeight[callee]) {
+          bestCallerWeight[callee] = weight;
+          bestCaller[callee] = func->name;
+        }
+      }
+    }
+
+    // Place each called function in its own cluster to begin with.
+    struct Cluster {
+      std::vector<Function*> funcs;
+      // Total size of the cluster, in expression nodes.
+      Index size;
+      // The earliest first-use timestamp of any function in the cluster.
+      uint32_t firstUse;
+    };
+    std::vector<Cluster> clusters;
+    std::unordered_map<Name, Index> clusterOf;
+    std::vector<Function*> called;
+    for (auto& func : module->functions) {
+      if (func->imported() || !firstUse[func->name]) {
+        continue;
+      }
+      clusterOf[func->name] = clusters.size();
+      clusters.push_back({{func.get()},
+                          Measurer::measure(func->body),
+                          firstUse[func->name]});
+      called.push_back(func.get());
+    }
+
+    // Process functions hottest-first, that is, in order of first use, and
+    // append each one's cluster to its predominant caller's cluster. Merging
+    // in this order keeps the front of each cluster hotter than the back.
+    std::sort(called.begin(), called.end(), [&](Function* a, Function* b) {
+      if (firstUse[a->name] == firstUse[b->name]) {
+        return clusterOf[a->name] < clusterOf[b->name];
+      }
+      return firstUse[a->name] < firstUse[b->name];
+    });
+    for (auto* func : called) {
+      auto iter = bestCaller.find(func->name);
+      if (iter == bestCaller.end()) {
+        continue;
+      }
+      auto callerIter = clusterOf.find(iter->second);
+      if (callerIter == clusterOf.end()) {
+        // The predominant caller was never called itself (it may only appear
+        // to call us, behind a branch that never executed); leave the
+        // function where it is rather than moving it next to cold code.
+        continue;
+      }
+      auto into = callerIter->second;
+      auto from = clusterOf[func->name];
+      if (into == from ||
+          clusters[into].size + clusters[from].size > MaxClusterSize) {
+        continue;
+      }
+      for (auto* moved : clusters[from].funcs) {
+        clusters[into].funcs.push_back(moved);
+        clusterOf[moved->name] = into;
+      }
+      clusters[into].size += clusters[from].size;
+      clusters[into].firstUse =
+        std::min(clusters[into].firstUse, clusters[from].firstUse);
+      clusters[from].funcs.clear();
+    }
+
+    // Lay out the module: imports (which are not part of the code section,
+    // but benefit from small indexes as before), then the clusters in first-
+    // use order, then the never-called functions sorted by use count.
+    std::unordered_map<Name, Index> position;
+    Index next = 0;
+    for (auto& func : module->functions) {
+      if (func->imported()) {
+        position[func->name] = next++;
+      }
+    }
+    std::vector<Index> clusterOrder;
+    for (Index i = 0; i < clusters.size(); i++) {
+      if (!clusters[i].funcs.empty()) {
+        clusterOrder.push_back(i);
+      }
+    }
+    std::sort(clusterOrder.begin(), clusterOrder.end(), [&](Index a, Index b) {
+      if (clusters[a].firstUse == clusters[b].firstUse) {
+        return a < b;
+      }
+      return clusters[a].firstUse < clusters[b].firstUse;
+    });
+    for (auto i : clusterOrder) {
+      for (auto* func : clusters[i].funcs) {
+        position[func->name] = next++;
+      }
+    }
+    std::vector<Function*> cold;
+    for (auto& func : module->functions) {
+      if (!func->imported() && !firstUse[func->name]) {
+        cold.push_back(func.get());
+      }
+    }
+    std::sort(cold.begin(), cold.end(), [&](Function* a, Function* b) {
+      if (counts[a->name] == counts[b->name]) {
+        return strcmp(a->name.str, b->name.str) > 0;
+      }
+      return counts[a->name] > counts[b->name];
+    });
+    for (auto* func : cold) {
+      position[func->name] = next++;
+    }
+    std::sort(module->functions.begin(),
+              module->functions.end(),
+              [&](const std::unique_ptr<Function>& a,
+                  const std::unique_ptr<Function>& b) {
+                return position[a->name] < position[b->name];
+              });
+  }
+};
+
+// Schedules the code section for streaming compilation: engines compile it in
+// order while downloading, so moving the startup-critical functions to the
+// very front lets them finish compiling before the rest of the module has
+// even arrived. The startup set comes either from an explicit list,
+//
+//   --pass-arg=streaming-funcs@a,b,c     (or @filename, one name per line,
+//                                         like wasm-split's --keep-funcs)
+//
+// or from a wasm-split profile,
+//
+//   --pass-arg=reorder-functions-profile@file.prof
+//
+// in which case every function the profile saw executed is startup-critical
+// and is scheduled by its first use. The remaining functions are deferred to
+// the end of the code section without changing their relative order, so the
+// layout that an earlier reorder-functions run chose for them is kept.
+struct ReorderFunctionsForStreaming : public Pass {
+  void run(PassRunner* runner, Module* module) override {
+    // Map each startup-critical function to its schedule position, lower
+    // first. Names that do not exist in the module are simply ignored, so a
+    // list can be shared across related builds.
+    std::unordered_map<Name, uint32_t> order;
+    auto list =
+      runner->options.getArgumentOrDefault("streaming-funcs", "");
+    if (!list.empty()) {
+      uint32_t next = 1;
+      for (auto& name : parseNameList(list)) {
+        order.emplace(name, next++);
+      }
+    } else {
+      auto profileFile = runner->options.getArgument(
+        "reorder-functions-profile",
+        "reorder-functions-for-streaming requires a startup set, either "
+        "--pass-arg=streaming-funcs@a,b,c or "
+        "--pass-arg=reorder-functions-profile@file.prof");
+      for (auto& [name, timestamp] : readFirstUseProfile(module, profileFile)) {
+        if (timestamp) {
+          order[name] = timestamp;
+        }
+      }
+    }
+    // Imports stay at the front (they are not part of the code section), then
+    // the startup functions in schedule order, then everything else. The sort
+    // is stable so that ties and the deferred functions keep their order.
+    auto category = [&](const std::unique_ptr<Function>& func) {
+      if (func->imported()) {
+        return 0;
+      }
+      return order.count(func->name) ? 1 : 2;
+    };
+    std::stable_sort(module->functions.begin(),
+                     module->functions.end(),
+                     [&](const std::unique_ptr<Function>& a,
+                         const std::unique_ptr<Function>& b) {
+                       auto catA = category(a);
+                       auto catB = category(b);
+                       if (catA != catB) {
+                         return catA < catB;
+                       }
+                       if (catA == 1) {
+                         return order[a->name] < order[b->name];
+                       }
+                       return false;
+                     });
+  }
+
+private:
+  // Parse a comma-separated list of names, or, with a leading '@', a file
+  // with one name per line, as wasm-split's --keep-funcs does. Unlike there,
+  // the order of the list is meaningful here, so we keep it.
+  std::vector<Name> parseNameList(const std::string& listOrFile) {
+    std::vector<Name> names;
+    if (!listOrFile.empty() && listOrFile[0] == '@') {
+      auto filename = listOrFile.substr(1);
+      std::ifstream infile(filename);
+      if (!infile.is_open()) {
+        Fatal() << "Failed opening '" << filename << "'";
+      }
+      for (std::string line; std::getline(infile, line);) {
+        if (line.size() > 0) {
+          names.push_back(line);
+        }
+      }
+    } else {
+      std::istringstream stream(listOrFile);
+      for (std::string name; std::getline(stream, name, ',');) {
+        names.push_back(name);
+      }
+    }
+    return names;
+  }
 };
 
 Pass* createReorderFunctionsPass() { return new ReorderFunctions(); }
 
+Pass* createReorderFunctionsForStreamingPass() {
+  return new ReorderFunctionsForStreaming();
+}
+
 } // namespace wasm
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Re-lays out each function's expressions contiguously in memory, in
+// traversal order. After many passes have run, a function's nodes end up
+// scattered through the arena - each pass allocates replacements next to
+// whatever else its thread was doing at the time - and tree walks then spend
+// much of their time on cache misses while chasing child pointers. Copying
+// the body re-allocates every node in one dense, walk-ordered run.
+//
+// This is opt-in, as it trades arena memory for locality: the old nodes
+// cannot be freed (the arena only grows), so this is best run once, early in
+// a long pipeline that will walk each function many times.
+//
+
+#include "ir/manipulation.h"
+#include "pass.h"
+#include "wasm.h"
+
+namespace wasm {
+
+struct Repack : public Pass {
+  bool isFunctionParallel() override { return true; }
+
+  Pass* create() override { return new Repack; }
+
+  void run(PassRunner* runner, Module* module) override {
+    // Parallel pass running is implemented in the PassRunner.
+    PassRunner nestedRunner(module);
+    nestedRunner.setIsNested(true);
+    std::unique_ptr<Pass> copy;
+    copy.reset(create());
+    nestedRunner.add(std::move(copy));
+    nestedRunner.run();
+  }
+
+  void
+  runOnFunction(PassRunner* runner, Module* module, Function* func) override {
+    // Debug locations are keyed by expression pointer, and copying would
+    // detach them all; leave such functions as they are.
+    if (!func->debugLocations.empty()) {
+      return;
+    }
+    func->body = ExpressionManipulator::copy(func->body, *module);
+  }
+};
+
+Pass* createRepackPass() { return new Repack(); }
+
+} // namespace wasm
@@ -126,6 +126,11 @@ struct SSAify : public Pass {
 
   void computeGetsAndPhis(LocalGraph& graph) {
     FindAll<LocalGet> gets(func->body);
+    // Gets with identical reaching sets join at the same merge point, and can
+    // share a single merge local - without this, each such get materializes
+    // its own local and its own tees at every set, which can blow up the IR
+    // quadratically on merge-heavy functions.
+    std::map<std::pair<Index, std::vector<LocalSet*>>, Index> mergeLocals;
     for (auto* get : gets.list) {
       auto& sets = graph.getSetses[get];
       if (sets.size() == 0) {
@@ -152,8 +157,18 @@ struct SSAify : public Pass {
         continue;
       }
       // more than 1 set, need a phi: a new local written to at each of the sets
-      auto new_ = addLocal(get->type);
       auto old = get->index;
+      std::vector<LocalSet*> key(sets.begin(), sets.end());
+      std::sort(key.begin(), key.end());
+      auto [iter, inserted] =
+        mergeLocals.emplace(std::make_pair(old, std::move(key)), 0);
+      if (!inserted) {
+        // An identical merge was already materialized; use its local.
+        get->index = iter->second;
+        continue;
+      }
+      auto new_ = addLocal(get->type);
+      iter->second = new_;
       get->index = new_;
       Builder builder(*module);
       // write to the local in each of our sets
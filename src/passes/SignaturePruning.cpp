@@ -27,7 +27,6 @@
 // function, making the parameter's value unused, which means we can prune it.
 //
 
-#include "ir/find_all.h"
 #include "ir/intrinsics.h"
 #include "ir/lubs.h"
 #include "ir/module-utils.h"
@@ -86,11 +85,12 @@ struct SignaturePruning : public Pass {
           return;
         }
 
-        info.calls = std::move(FindAll<Call>(func->body).list);
-        info.callRefs = std::move(FindAll<CallRef>(func->body).list);
         info.usedParams = ParamUtils::getUsedParams(func);
       });
 
+    // Also collect all the call sites in the module, grouped by callee.
+    ModuleUtils::CallSiteIndex callSites(*module);
+
     // A map of types to all the information combined over all the functions
     // with that type.
     std::unordered_map<HeapType, Info> allInfo;
@@ -99,45 +99,53 @@ struct SignaturePruning : public Pass {
     std::unordered_map<HeapType, std::vector<Function*>> sigFuncs;
 
     // Combine all the information we gathered into that map.
-    for (auto& [func, info] : analysis.map) {
-      // For direct calls, add each call to the type of the function being
-      // called.
-      for (auto* call : info.calls) {
-        allInfo[module->getFunction(call->target)->type].calls.push_back(call);
-
-        // Intrinsics limit our ability to optimize in some cases. We will avoid
-        // modifying any type that is used by call.without.effects, to avoid
-        // the complexity of handling that. After intrinsics are lowered,
-        // this optimization will be able to run at full power anyhow.
-        if (Intrinsics(*module).isCallWithoutEffects(call)) {
-          // The last operand is the actual call target.
-          auto* target = call->operands.back();
-          if (target->type != Type::unreachable) {
-            allInfo[target->type.getHeapType()].optimizable = false;
+    for (auto& func : module->functions) {
+      auto& info = analysis.map[func.get()];
+
+      // Look up the info for this function's type once, and not once per item
+      // below. (A reference into the map remains valid as other entries are
+      // added.)
+      auto& funcTypeInfo = allInfo[func->type];
+
+      // For direct calls, add each call to this function to the type of the
+      // function.
+      if (auto iter = callSites.calls.find(func->name);
+          iter != callSites.calls.end()) {
+        for (auto* call : iter->second) {
+          funcTypeInfo.calls.push_back(call);
+
+          // Intrinsics limit our ability to optimize in some cases. We will
+          // avoid modifying any type that is used by call.without.effects, to
+          // avoid the complexity of handling that. After intrinsics are
+          // lowered, this optimization will be able to run at full power
+          // anyhow.
+          if (Intrinsics(*module).isCallWithoutEffects(call)) {
+            // The last operand is the actual call target.
+            auto* target = call->operands.back();
+            if (target->type != Type::unreachable) {
+              allInfo[target->type.getHeapType()].optimizable = false;
+            }
           }
         }
       }
 
-      // For indirect calls, add each call_ref to the type the call_ref uses.
-      for (auto* callRef : info.callRefs) {
-        auto calledType = callRef->target->type;
-        if (calledType != Type::unreachable) {
-          allInfo[calledType.getHeapType()].callRefs.push_back(callRef);
-        }
-      }
-
       // A parameter used in this function is used in the heap type - just one
       // function is enough to prevent the parameter from being removed.
-      auto& allUsedParams = allInfo[func->type].usedParams;
       for (auto index : info.usedParams) {
-        allUsedParams.insert(index);
+        funcTypeInfo.usedParams.insert(index);
       }
 
       if (!info.optimizable) {
-        allInfo[func->type].optimizable = false;
+        funcTypeInfo.optimizable = false;
       }
 
-      sigFuncs[func->type].push_back(func);
+      sigFuncs[func->type].push_back(func.get());
+    }
+
+    // For indirect calls, add each call_ref to the type the call_ref uses.
+    for (auto& [type, refs] : callSites.callRefs) {
+      auto& typeCallRefs = allInfo[type].callRefs;
+      typeCallRefs.insert(typeCallRefs.end(), refs.begin(), refs.end());
     }
 
     // Exported functions cannot be modified.
@@ -148,7 +156,11 @@ struct SignaturePruning : public Pass {
       }
     }
 
-    // Find parameters to prune.
+    // Find parameters to prune. We gather the candidates from all the types
+    // first and prune them in one batch, so that the call-site rewriting is
+    // a single parallel pass instead of one walk per removed parameter.
+    std::vector<ParamUtils::RemovalRequest> batch;
+    std::vector<HeapType> batchTypes;
     for (auto& [type, funcs] : sigFuncs) {
       auto sig = type.getSignature();
       auto& info = allInfo[type];
@@ -192,18 +204,31 @@ struct SignaturePruning : public Pass {
         }
       }
 
-      auto oldParams = sig.params;
-      auto removedIndexes = ParamUtils::removeParameters(
-        funcs, unusedParams, info.calls, info.callRefs, module, runner);
+      batch.push_back({funcs,
+                       std::move(unusedParams),
+                       std::move(info.calls),
+                       std::move(info.callRefs),
+                       {}});
+      batchTypes.push_back(type);
+    }
+
+    ParamUtils::removeParametersBatch(batch, module, runner);
+
+    for (Index i = 0; i < batch.size(); i++) {
+      auto type = batchTypes[i];
+      auto& request = batch[i];
+      auto& removedIndexes = request.removed;
       if (removedIndexes.empty()) {
         continue;
       }
 
       // Success! Update the types.
+      auto sig = type.getSignature();
+      auto oldParams = sig.params;
       std::vector<Type> newParams;
-      for (Index i = 0; i < numParams; i++) {
-        if (!removedIndexes.has(i)) {
-          newParams.push_back(oldParams[i]);
+      for (Index j = 0; j < oldParams.size(); j++) {
+        if (!removedIndexes.has(j)) {
+          newParams.push_back(oldParams[j]);
         }
       }
 
@@ -214,22 +239,22 @@ struct SignaturePruning : public Pass {
       // nominally different from those).
       newSignatures[type] = Signature(Type(newParams), sig.results);
 
-      // removeParameters() updates the type as it goes, but in this pass we
-      // need the type to match the other locations, nominally. That is, we need
-      // all the functions of a particular type to still have the same type
-      // after this operation, and that must be the exact same type at the
+      // removeParametersBatch() updates the type as it goes, but in this pass
+      // we need the type to match the other locations, nominally. That is, we
+      // need all the functions of a particular type to still have the same
+      // type after this operation, and that must be the exact same type at the
       // relevant call_refs and so forth. The TypeRewriter below will do the
       // right thing as it rewrites everything all at once, so we do not want
-      // the type to be modified by removeParameters(), and so we undo the type
+      // the type to be modified by the pruning, and so we undo the type change
       // it made.
       //
-      // Note that we cannot just ask removeParameters() to not update the type,
-      // as it adds a new local there, whose index depends on the type (which
+      // Note that we cannot just ask the pruning to not update the type, as it
+      // adds a new local there, whose index depends on the type (which
       // contains the # of parameters, and that determine where non-parameter
       // local indexes begin). Rather than have it update the type and then undo
       // that, which would add more complexity in that method, undo the change
       // here.
-      for (auto* func : funcs) {
+      for (auto* func : request.funcs) {
         func->type = type;
       }
     }
@@ -27,7 +27,6 @@
 //
 
 #include "ir/export-utils.h"
-#include "ir/find_all.h"
 #include "ir/lubs.h"
 #include "ir/module-utils.h"
 #include "ir/type-updating.h"
@@ -91,29 +90,29 @@ struct SignatureRefining : public Pass {
           info.canModify = false;
           return;
         }
-        info.calls = std::move(FindAll<Call>(func->body).list);
-        info.callRefs = std::move(FindAll<CallRef>(func->body).list);
         info.resultsLUB = LUB::getResultsLUB(func, *module);
       });
 
+    // Also collect all the call sites in the module, grouped by callee. (This
+    // must happen after the analysis above, as the analysis can modify the
+    // IR.)
+    ModuleUtils::CallSiteIndex callSites(*module);
+
     // A map of types to all the information combined over all the functions
     // with that type.
     std::unordered_map<HeapType, Info> allInfo;
 
     // Combine all the information we gathered into that map.
-    for (auto& [func, info] : analysis.map) {
-      // For direct calls, add each call to the type of the function being
-      // called.
-      for (auto* call : info.calls) {
-        allInfo[module->getFunction(call->target)->type].calls.push_back(call);
-      }
+    for (auto& func : module->functions) {
+      auto& info = analysis.map[func.get()];
 
-      // For indirect calls, add each call_ref to the type the call_ref uses.
-      for (auto* callRef : info.callRefs) {
-        auto calledType = callRef->target->type;
-        if (calledType != Type::unreachable) {
-          allInfo[calledType.getHeapType()].callRefs.push_back(callRef);
-        }
+      // For direct calls, add each call to this function to the type of the
+      // function.
+      if (auto iter = callSites.calls.find(func->name);
+          iter != callSites.calls.end()) {
+        auto& typeCalls = allInfo[func->type].calls;
+        typeCalls.insert(
+          typeCalls.end(), iter->second.begin(), iter->second.end());
       }
 
       // Add the function's return LUB to the one for the heap type of that
@@ -126,6 +125,12 @@ struct SignatureRefining : public Pass {
       }
     }
 
+    // For indirect calls, add each call_ref to the type the call_ref uses.
+    for (auto& [type, refs] : callSites.callRefs) {
+      auto& typeCallRefs = allInfo[type].callRefs;
+      typeCallRefs.insert(typeCallRefs.end(), refs.begin(), refs.end());
+    }
+
     // We cannot alter the signature of an exported function, as the outside may
     // notice us doing so. For example, if we turn a parameter from nullable
     // into non-nullable then callers sending a null will break. Put another
@@ -38,10 +38,14 @@
 // further optimization opportunities.
 //
 
-#include <atomic>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ir/effects.h"
 #include "ir/linear-execution.h"
+#include "ir/module-utils.h"
 #include "ir/properties.h"
 #include "ir/utils.h"
 #include "pass.h"
@@ -53,16 +57,19 @@ namespace wasm {
 namespace {
 
 struct GlobalInfo {
-  // Whether the global is imported and exported.
+  // Whether the global is imported and exported. Only set on the merged,
+  // module-level info.
   bool imported = false;
   bool exported = false;
 
-  // How many times the global is written and read.
-  std::atomic<Index> written{0};
-  std::atomic<Index> read{0};
+  // How many times the global is written and read. The counts are gathered
+  // per function, in parallel, and then merged serially, so plain fields
+  // suffice.
+  Index written = 0;
+  Index read = 0;
 
   // Whether the global is written a value different from its initial value.
-  std::atomic<bool> nonInitWritten{false};
+  bool nonInitWritten = false;
 
   // How many times the global is "read, but only to write", that is, is used in
   // something like this pattern:
@@ -87,20 +94,35 @@ struct GlobalInfo {
   // However, if sideEffect() were removed, then we read the global only to
   // write it - and nothing else - and so we can optimize away that global
   // entirely.
-  std::atomic<Index> readOnlyToWrite{0};
+  Index readOnlyToWrite = 0;
+
+  // Merges the counts of another (per-function) info into this one.
+  void merge(const GlobalInfo& other) {
+    written += other.written;
+    read += other.read;
+    nonInitWritten = nonInitWritten || other.nonInitWritten;
+    readOnlyToWrite += other.readOnlyToWrite;
+  }
 };
 
-using GlobalInfoMap = std::map<Name, GlobalInfo>;
-
-struct GlobalUseScanner : public WalkerPass<PostWalker<GlobalUseScanner>> {
-  bool isFunctionParallel() override { return true; }
-
-  GlobalUseScanner(GlobalInfoMap* infos) : infos(infos) {}
-
-  GlobalUseScanner* create() override { return new GlobalUseScanner(infos); }
+// The counts for the globals one function uses, keyed by the global's dense
+// index in the module. Most functions touch few globals, so this is sparse.
+using FunctionGlobalInfo = std::unordered_map<Index, GlobalInfo>;
+
+// Scans one function body, accumulating counts per global index. The pass
+// keeps the per-function results between its iterations, so that a later
+// iteration only re-scans functions that were modified meanwhile.
+struct GlobalUseScanner : public PostWalker<GlobalUseScanner> {
+  GlobalUseScanner(Module& wasm,
+                   PassOptions& passOptions,
+                   const std::unordered_map<Name, Index>& globalIndexes,
+                   FunctionGlobalInfo& infos)
+    : passOptions(passOptions), globalIndexes(globalIndexes), infos(infos) {
+    setModule(&wasm);
+  }
 
   void visitGlobalSet(GlobalSet* curr) {
-    (*infos)[curr->name].written++;
+    infos[globalIndexes.at(curr->name)].written++;
 
     // Check if there is a write of a value that may differ from the initial
     // one. If there is anything but identical constants in both the initial
@@ -110,11 +132,13 @@ struct GlobalUseScanner : public WalkerPass<PostWalker<GlobalUseScanner>> {
         !Properties::isConstantExpression(global->init) ||
         Properties::getLiterals(curr->value) !=
           Properties::getLiterals(global->init)) {
-      (*infos)[curr->name].nonInitWritten = true;
+      infos[globalIndexes.at(curr->name)].nonInitWritten = true;
     }
   }
 
-  void visitGlobalGet(GlobalGet* curr) { (*infos)[curr->name].read++; }
+  void visitGlobalGet(GlobalGet* curr) {
+    infos[globalIndexes.at(curr->name)].read++;
+  }
 
   void visitIf(If* curr) {
     // We are looking for
@@ -129,7 +153,7 @@ struct GlobalUseScanner : public WalkerPass<PostWalker<GlobalUseScanner>> {
     auto global = readsGlobalOnlyToWriteIt(curr->condition, curr->ifTrue);
     if (global.is()) {
       // This is exactly the pattern we sought!
-      (*infos)[global].readOnlyToWrite++;
+      infos[globalIndexes.at(global)].readOnlyToWrite++;
     }
   }
 
@@ -158,7 +182,7 @@ struct GlobalUseScanner : public WalkerPass<PostWalker<GlobalUseScanner>> {
     // See if writing a global is the only effect the code has. (Note that we
     // don't need to care about the case where the code has no effects at
     // all - other passes would handle that trivial situation.)
-    EffectAnalyzer codeEffects(getPassOptions(), *getModule(), code);
+    EffectAnalyzer codeEffects(passOptions, *getModule(), code);
     if (codeEffects.globalsWritten.size() != 1) {
       return Name();
     }
@@ -169,7 +193,7 @@ struct GlobalUseScanner : public WalkerPass<PostWalker<GlobalUseScanner>> {
     }
 
     // See if we read that global in the condition expression.
-    EffectAnalyzer conditionEffects(getPassOptions(), *getModule(), condition);
+    EffectAnalyzer conditionEffects(passOptions, *getModule(), condition);
     if (!conditionEffects.mutableGlobalsRead.count(writtenGlobal)) {
       return Name();
     }
@@ -252,7 +276,7 @@ struct GlobalUseScanner : public WalkerPass<PostWalker<GlobalUseScanner>> {
       }
     };
 
-    FlowScanner scanner(*this, writtenGlobal, getPassOptions(), *getModule());
+    FlowScanner scanner(*this, writtenGlobal, passOptions, *getModule());
     scanner.walk(condition);
     return scanner.ok ? writtenGlobal : Name();
   }
@@ -290,12 +314,27 @@ struct GlobalUseScanner : public WalkerPass<PostWalker<GlobalUseScanner>> {
     auto global = readsGlobalOnlyToWriteIt(iff->condition, list[1]);
     if (global.is()) {
       // This is exactly the pattern we sought!
-      (*infos)[global].readOnlyToWrite++;
+      infos[globalIndexes.at(global)].readOnlyToWrite++;
     }
   }
 
 private:
-  GlobalInfoMap* infos;
+  PassOptions& passOptions;
+  const std::unordered_map<Name, Index>& globalIndexes;
+  FunctionGlobalInfo& infos;
+};
+
+// Tracks functions that a parallel modification pass has changed, so that the
+// next analysis can re-scan only the functions whose global accesses may have
+// changed. Noted at most once per modified function, so a mutex is fine.
+struct DirtyFuncs {
+  std::mutex mutex;
+  std::unordered_set<Function*> funcs;
+
+  void note(Function* func) {
+    std::lock_guard<std::mutex> lock(mutex);
+    funcs.insert(func);
+  }
 };
 
 using NameNameMap = std::map<Name, Name>;
@@ -304,22 +343,31 @@ using NameSet = std::set<Name>;
 struct GlobalUseModifier : public WalkerPass<PostWalker<GlobalUseModifier>> {
   bool isFunctionParallel() override { return true; }
 
-  GlobalUseModifier(NameNameMap* copiedParentMap)
-    : copiedParentMap(copiedParentMap) {}
+  GlobalUseModifier(NameNameMap* copiedParentMap, DirtyFuncs* dirty)
+    : copiedParentMap(copiedParentMap), dirty(dirty) {}
 
   GlobalUseModifier* create() override {
-    return new GlobalUseModifier(copiedParentMap);
+    return new GlobalUseModifier(copiedParentMap, dirty);
   }
 
   void visitGlobalGet(GlobalGet* curr) {
     auto iter = copiedParentMap->find(curr->name);
     if (iter != copiedParentMap->end()) {
       curr->name = iter->second;
+      changed = true;
+    }
+  }
+
+  void visitFunction(Function* curr) {
+    if (changed) {
+      dirty->note(curr);
     }
   }
 
 private:
   NameNameMap* copiedParentMap;
+  DirtyFuncs* dirty;
+  bool changed = false;
 };
 
 struct ConstantGlobalApplier
@@ -328,11 +376,13 @@ struct ConstantGlobalApplier
                             UnifiedExpressionVisitor<ConstantGlobalApplier>>> {
   bool isFunctionParallel() override { return true; }
 
-  ConstantGlobalApplier(NameSet* constantGlobals, bool optimize)
-    : constantGlobals(constantGlobals), optimize(optimize) {}
+  ConstantGlobalApplier(NameSet* constantGlobals,
+                        bool optimize,
+                        DirtyFuncs* dirty)
+    : constantGlobals(constantGlobals), optimize(optimize), dirty(dirty) {}
 
   ConstantGlobalApplier* create() override {
-    return new ConstantGlobalApplier(constantGlobals, optimize);
+    return new ConstantGlobalApplier(constantGlobals, optimize, dirty);
   }
 
   void visitExpression(Expression* curr) {
@@ -376,17 +426,21 @@ struct ConstantGlobalApplier
   }
 
   void visitFunction(Function* curr) {
-    if (replaced && optimize) {
-      PassRunner runner(getModule(), getPassRunner()->options);
-      runner.setIsNested(true);
-      runner.addDefaultFunctionOptimizationPasses();
-      runner.runOnFunction(curr);
+    if (replaced) {
+      dirty->note(curr);
+      if (optimize) {
+        PassRunner runner(getModule(), getPassRunner()->options);
+        runner.setIsNested(true);
+        runner.addDefaultFunctionOptimizationPasses();
+        runner.runOnFunction(curr);
+      }
     }
   }
 
 private:
   NameSet* constantGlobals;
   bool optimize;
+  DirtyFuncs* dirty;
   bool replaced = false;
 
   // The globals currently constant in the linear trace.
@@ -394,13 +448,13 @@ private:
 };
 
 struct GlobalSetRemover : public WalkerPass<PostWalker<GlobalSetRemover>> {
-  GlobalSetRemover(const NameSet* toRemove, bool optimize)
-    : toRemove(toRemove), optimize(optimize) {}
+  GlobalSetRemover(const NameSet* toRemove, bool optimize, DirtyFuncs* dirty)
+    : toRemove(toRemove), optimize(optimize), dirty(dirty) {}
 
   bool isFunctionParallel() override { return true; }
 
   GlobalSetRemover* create() override {
-    return new GlobalSetRemover(toRemove, optimize);
+    return new GlobalSetRemover(toRemove, optimize, dirty);
   }
 
   void visitGlobalSet(GlobalSet* curr) {
@@ -411,17 +465,21 @@ struct GlobalSetRemover : public WalkerPass<PostWalker<GlobalSetRemover>> {
   }
 
   void visitFunction(Function* curr) {
-    if (removed && optimize) {
-      PassRunner runner(getModule(), getPassRunner()->options);
-      runner.setIsNested(true);
-      runner.addDefaultFunctionOptimizationPasses();
-      runner.runOnFunction(curr);
+    if (removed) {
+      dirty->note(curr);
+      if (optimize) {
+        PassRunner runner(getModule(), getPassRunner()->options);
+        runner.setIsNested(true);
+        runner.addDefaultFunctionOptimizationPasses();
+        runner.runOnFunction(curr);
+      }
     }
   }
 
 private:
   const NameSet* toRemove;
   bool optimize;
+  DirtyFuncs* dirty;
   bool removed = false;
 };
 
@@ -431,7 +489,17 @@ struct SimplifyGlobals : public Pass {
   PassRunner* runner;
   Module* module;
 
-  GlobalInfoMap map;
+  // Each global's dense index in the module, and the merged module-level info
+  // for each global, indexed by that.
+  std::unordered_map<Name, Index> globalIndexes;
+  std::vector<GlobalInfo> infos;
+
+  // The per-function counts, which we keep between iterations so that each
+  // iteration after the first only needs to re-scan dirty functions.
+  std::unordered_map<Function*, FunctionGlobalInfo> funcInfos;
+  DirtyFuncs dirty;
+  bool scannedYet = false;
+
   bool optimize;
 
   SimplifyGlobals(bool optimize = false) : optimize(optimize) {}
@@ -461,24 +529,58 @@ struct SimplifyGlobals : public Pass {
   }
 
   void analyze() {
-    map.clear();
+    if (globalIndexes.empty()) {
+      for (Index i = 0; i < module->globals.size(); i++) {
+        globalIndexes[module->globals[i]->name] = i;
+      }
+    }
 
-    // First, find out all the relevant info.
-    for (auto& global : module->globals) {
-      auto& info = map[global->name];
-      if (global->imported()) {
-        info.imported = true;
+    // Scan the functions in parallel. On the first iteration we scan them
+    // all; afterwards we only re-scan the ones that a modification phase
+    // dirtied, and reuse the kept counts for the rest.
+    ModuleUtils::ParallelFunctionAnalysis<std::optional<FunctionGlobalInfo>>
+      analysis(*module, [&](Function* func,
+                            std::optional<FunctionGlobalInfo>& counts) {
+        if (func->imported()) {
+          return;
+        }
+        if (scannedYet && !dirty.funcs.count(func)) {
+          return;
+        }
+        counts.emplace();
+        GlobalUseScanner(*module, runner->options, globalIndexes, *counts)
+          .walkFunction(func);
+      });
+    for (auto& [func, counts] : analysis.map) {
+      if (counts) {
+        funcInfos[func] = std::move(*counts);
+      }
+    }
+    scannedYet = true;
+    dirty.funcs.clear();
+
+    // Merge the per-function counts, and add the module-level information.
+    infos.assign(module->globals.size(), GlobalInfo{});
+    for (Index i = 0; i < module->globals.size(); i++) {
+      if (module->globals[i]->imported()) {
+        infos[i].imported = true;
       }
     }
     for (auto& ex : module->exports) {
       if (ex->kind == ExternalKind::Global) {
-        map[ex->value].exported = true;
+        infos[globalIndexes.at(ex->value)].exported = true;
+      }
+    }
+    for (auto& [_, counts] : funcInfos) {
+      for (auto& [index, info] : counts) {
+        infos[index].merge(info);
       }
     }
-    GlobalUseScanner(&map).run(runner, module);
+
     // We now know which are immutable in practice.
-    for (auto& global : module->globals) {
-      auto& info = map[global->name];
+    for (Index i = 0; i < module->globals.size(); i++) {
+      auto& global = module->globals[i];
+      auto& info = infos[i];
       if (global->mutable_ && !info.imported && !info.exported &&
           !info.written) {
         global->mutable_ = false;
@@ -496,8 +598,9 @@ struct SimplifyGlobals : public Pass {
     // need those writes. And, globals that are only read from in order to write
     // to themselves as well. First, find such globals.
     NameSet globalsNotNeedingSets;
-    for (auto& global : module->globals) {
-      auto& info = map[global->name];
+    for (Index i = 0; i < module->globals.size(); i++) {
+      auto& global = module->globals[i];
+      auto& info = infos[i];
 
       if (!info.written) {
         // No writes occur here, so there is nothing for us to remove.
@@ -564,7 +667,8 @@ struct SimplifyGlobals : public Pass {
     // then see that since the global has no writes, it is a constant, which
     // will lead to removal of gets, and after removing them, the global itself
     // will be removed as well.
-    GlobalSetRemover(&globalsNotNeedingSets, optimize).run(runner, module);
+    GlobalSetRemover(&globalsNotNeedingSets, optimize, &dirty)
+      .run(runner, module);
 
     return more;
   }
@@ -595,7 +699,7 @@ struct SimplifyGlobals : public Pass {
         }
       }
       // Apply to the gets.
-      GlobalUseModifier(&copiedParentMap).run(runner, module);
+      GlobalUseModifier(&copiedParentMap, &dirty).run(runner, module);
     }
   }
 
@@ -633,7 +737,8 @@ struct SimplifyGlobals : public Pass {
         constantGlobals.insert(global->name);
       }
     }
-    ConstantGlobalApplier(&constantGlobals, optimize).run(runner, module);
+    ConstantGlobalApplier(&constantGlobals, optimize, &dirty)
+      .run(runner, module);
   }
 };
 
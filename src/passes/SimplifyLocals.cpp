@@ -146,7 +146,8 @@ struct SimplifyLocals
       // Not one of the recognized instructions, so do not optimize here: mark
       // all the targets as unoptimizable.
       // TODO optimize BrOn, Switch, etc.
-      auto targets = BranchUtils::getUniqueTargets(curr);
+      auto targets =
+        BranchUtils::getUniqueTargets<BranchUtils::SmallNameSet>(curr);
       for (auto target : targets) {
         self->unoptimizableBlocks.insert(target);
       }
@@ -35,11 +35,14 @@
 //    directly, without the need for *-propagate techniques.
 //
 
+#include <sstream>
+
 #include "dataflow/graph.h"
 #include "dataflow/node.h"
 #include "dataflow/utils.h"
 #include "ir/flat.h"
 #include "ir/local-graph.h"
+#include "ir/module-utils.h"
 #include "ir/utils.h"
 #include "pass.h"
 #include "wasm-builder.h"
@@ -254,7 +257,7 @@ struct Trace {
              excludeAsChildren.find(node) != excludeAsChildren.end())) {
           auto type = node->getWasmType();
           assert(type.isConcrete());
-          auto* var = Node::makeVar(type);
+          auto* var = new Node(Node::makeVar(type));
           replacements[node] = std::unique_ptr<Node>(var);
           node = var;
           break;
@@ -409,18 +412,21 @@ struct Trace {
   }
 };
 
-// Emits a trace, which is basically a Souper LHS.
+// Emits a trace, which is basically a Souper LHS, to a given stream (so that
+// parallel harvesting can buffer per-function output).
 struct Printer {
   Graph& graph;
   Trace& trace;
+  std::ostream& o;
 
   // Each Node in a trace has an index, from 0.
   std::unordered_map<Node*, Index> indexing;
 
   bool printedHasExternalUses = false;
 
-  Printer(Graph& graph, Trace& trace) : graph(graph), trace(trace) {
-    std::cout << "\n; start LHS (in " << graph.func->name << ")\n";
+  Printer(Graph& graph, Trace& trace, std::ostream& o)
+    : graph(graph), trace(trace), o(o) {
+    o << "\n; start LHS (in " << graph.func->name << ")\n";
     // Index the nodes.
     for (auto* node : trace.nodes) {
       // pcs and blockpcs are not instructions and do not need to be indexed
@@ -439,7 +445,7 @@ struct Printer {
     }
 
     // Finish up
-    std::cout << "infer %" << indexing[trace.toInfer] << "\n\n";
+    o << "infer %" << indexing[trace.toInfer] << "\n\n";
   }
 
   Node* getMaybeReplaced(Node* node) {
@@ -457,44 +463,44 @@ struct Printer {
     assert(node);
     switch (node->type) {
       case Node::Type::Var: {
-        std::cout << "%" << indexing[node] << ":" << node->wasmType << " = var";
+        o << "%" << indexing[node] << ":" << node->wasmType << " = var";
         break; // nothing more to add
       }
       case Node::Type::Expr: {
         if (debug()) {
-          std::cout << "; ";
-          std::cout << *node->expr << '\n';
+          o << "; ";
+          o << *node->expr << '\n';
         }
-        std::cout << "%" << indexing[node] << " = ";
+        o << "%" << indexing[node] << " = ";
         printExpression(node);
         break;
       }
       case Node::Type::Phi: {
         auto* block = node->getValue(0);
         auto size = block->values.size();
-        std::cout << "%" << indexing[node] << " = phi %" << indexing[block];
+        o << "%" << indexing[node] << " = phi %" << indexing[block];
         for (Index i = 1; i < size + 1; i++) {
-          std::cout << ", ";
+          o << ", ";
           printInternal(node->getValue(i));
         }
         break;
       }
       case Node::Type::Cond: {
-        std::cout << "blockpc %" << indexing[node->getValue(0)] << ' '
+        o << "blockpc %" << indexing[node->getValue(0)] << ' '
                   << node->index << ' ';
         printInternal(node->getValue(1));
-        std::cout << " 1:i1";
+        o << " 1:i1";
         break;
       }
       case Node::Type::Block: {
-        std::cout << "%" << indexing[node] << " = block "
+        o << "%" << indexing[node] << " = block "
                   << node->values.size();
         break;
       }
       case Node::Type::Zext: {
         auto* child = node->getValue(0);
-        std::cout << "%" << indexing[node] << ':' << child->getWasmType();
-        std::cout << " = zext ";
+        o << "%" << indexing[node] << ':' << child->getWasmType();
+        o << " = zext ";
         printInternal(child);
         break;
       }
@@ -507,18 +513,18 @@ struct Printer {
     if (node->isExpr() || node->isPhi()) {
       if (node->origin != trace.toInfer->origin &&
           trace.hasExternalUses.count(node) > 0) {
-        std::cout << " (hasExternalUses)";
+        o << " (hasExternalUses)";
         printedHasExternalUses = true;
       }
     }
-    std::cout << '\n';
+    o << '\n';
     if (debug() && (node->isExpr() || node->isPhi())) {
       warnOnSuspiciousValues(node);
     }
   }
 
   void print(Literal value) {
-    std::cout << value.getInteger() << ':' << value.type;
+    o << value.getInteger() << ':' << value.type;
   }
 
   void printInternal(Node* node) {
@@ -527,7 +533,7 @@ struct Printer {
     if (node->isConst()) {
       print(node->expr->cast<Const>()->value);
     } else {
-      std::cout << "%" << indexing[node];
+      o << "%" << indexing[node];
     }
   }
 
@@ -543,123 +549,123 @@ struct Printer {
       switch (unary->op) {
         case ClzInt32:
         case ClzInt64:
-          std::cout << "ctlz";
+          o << "ctlz";
           break;
         case CtzInt32:
         case CtzInt64:
-          std::cout << "cttz";
+          o << "cttz";
           break;
         case PopcntInt32:
         case PopcntInt64:
-          std::cout << "ctpop";
+          o << "ctpop";
           break;
         default:
           WASM_UNREACHABLE("invalid op");
       }
-      std::cout << ' ';
+      o << ' ';
       auto* value = node->getValue(0);
       printInternal(value);
     } else if (auto* binary = curr->dynCast<Binary>()) {
       switch (binary->op) {
         case AddInt32:
         case AddInt64:
-          std::cout << "add";
+          o << "add";
           break;
         case SubInt32:
         case SubInt64:
-          std::cout << "sub";
+          o << "sub";
           break;
         case MulInt32:
         case MulInt64:
-          std::cout << "mul";
+          o << "mul";
           break;
         case DivSInt32:
         case DivSInt64:
-          std::cout << "sdiv";
+          o << "sdiv";
           break;
         case DivUInt32:
         case DivUInt64:
-          std::cout << "udiv";
+          o << "udiv";
           break;
         case RemSInt32:
         case RemSInt64:
-          std::cout << "srem";
+          o << "srem";
           break;
         case RemUInt32:
         case RemUInt64:
-          std::cout << "urem";
+          o << "urem";
           break;
         case AndInt32:
         case AndInt64:
-          std::cout << "and";
+          o << "and";
           break;
         case OrInt32:
         case OrInt64:
-          std::cout << "or";
+          o << "or";
           break;
         case XorInt32:
         case XorInt64:
-          std::cout << "xor";
+          o << "xor";
           break;
         case ShlInt32:
         case ShlInt64:
-          std::cout << "shl";
+          o << "shl";
           break;
         case ShrUInt32:
         case ShrUInt64:
-          std::cout << "lshr";
+          o << "lshr";
           break;
         case ShrSInt32:
         case ShrSInt64:
-          std::cout << "ashr";
+          o << "ashr";
           break;
         case RotLInt32:
         case RotLInt64:
-          std::cout << "rotl";
+          o << "rotl";
           break;
         case RotRInt32:
         case RotRInt64:
-          std::cout << "rotr";
+          o << "rotr";
           break;
         case EqInt32:
         case EqInt64:
-          std::cout << "eq";
+          o << "eq";
           break;
         case NeInt32:
         case NeInt64:
-          std::cout << "ne";
+          o << "ne";
           break;
         case LtSInt32:
         case LtSInt64:
-          std::cout << "slt";
+          o << "slt";
           break;
         case LtUInt32:
         case LtUInt64:
-          std::cout << "ult";
+          o << "ult";
           break;
         case LeSInt32:
         case LeSInt64:
-          std::cout << "sle";
+          o << "sle";
           break;
         case LeUInt32:
         case LeUInt64:
-          std::cout << "ule";
+          o << "ule";
           break;
         default:
           WASM_UNREACHABLE("invalid op");
       }
-      std::cout << ' ';
+      o << ' ';
       auto* left = node->getValue(0);
       printInternal(left);
-      std::cout << ", ";
+      o << ", ";
       auto* right = node->getValue(1);
       printInternal(right);
     } else if (curr->is<Select>()) {
-      std::cout << "select ";
+      o << "select ";
       printInternal(node->getValue(0));
-      std::cout << ", ";
+      o << ", ";
       printInternal(node->getValue(1));
-      std::cout << ", ";
+      o << ", ";
       printInternal(node->getValue(2));
     } else {
       WASM_UNREACHABLE("unexecpted node type");
@@ -667,9 +673,9 @@ struct Printer {
   }
 
   void printPathCondition(Node* condition) {
-    std::cout << "pc ";
+    o << "pc ";
     printInternal(condition);
-    std::cout << " 1:i1\n";
+    o << " 1:i1\n";
   }
 
   // Checks if a value looks suspiciously optimizable.
@@ -685,12 +691,12 @@ struct Printer {
       }
     }
     if (allInputsIdentical(node)) {
-      std::cout << "^^ suspicious identical inputs! missing optimization in "
+      o << "^^ suspicious identical inputs! missing optimization in "
                 << graph.func->name << "? ^^\n";
       return;
     }
     if (!node->isPhi() && allInputsConstant(node)) {
-      std::cout << "^^ suspicious constant inputs! missing optimization in "
+      o << "^^ suspicious constant inputs! missing optimization in "
                 << graph.func->name << "? ^^\n";
       return;
     }
@@ -699,22 +705,23 @@ struct Printer {
 
 } // namespace DataFlow
 
-struct Souperify : public WalkerPass<PostWalker<Souperify>> {
-  // Not parallel, for now - could parallelize and combine outputs at the end.
-  // If Souper is thread-safe, we could also run it in parallel.
-
+struct Souperify : public Pass {
   bool singleUseOnly;
 
   Souperify(bool singleUseOnly) : singleUseOnly(singleUseOnly) {}
 
-  void doWalkFunction(Function* func) {
-    std::cout << "\n; function: " << func->name << '\n';
+  void harvestFunction(Function* func, Module* module, std::ostream& o) {
+    o << "\n; function: " << func->name << '\n';
     Flat::verifyFlatness(func);
-    // Build the data-flow IR.
+    // Build the data-flow IR. We only read the wasm here, so the scratch
+    // expressions the graph creates can live in a local arena that we drop
+    // when we are done with this function.
+    MixedArena scratchArena;
     DataFlow::Graph graph;
-    graph.build(func, getModule());
+    graph.scratchAllocator = &scratchArena;
+    graph.build(func, module);
     if (debug() >= 2) {
-      dump(graph, std::cout);
+      dump(graph, o);
     }
     // Build the local graph data structure.
     LocalGraph localGraph(func);
@@ -722,15 +729,15 @@ struct Souperify : public WalkerPass<PostWalker<Souperify>> {
     // If we only want single-use nodes, exclude all the others.
     std::unordered_set<DataFlow::Node*> excludeAsChildren;
     if (singleUseOnly) {
-      for (auto& nodePtr : graph.nodes) {
-        auto* node = nodePtr.get();
+      for (auto& graphNode : graph.nodes) {
+        auto* node = &graphNode;
         if (node->origin) {
           // TODO: work for identical origins could be saved
           auto uses =
             DataFlow::UseFinder().getUses(node->origin, graph, localGraph);
           if (debug() >= 2) {
-            std::cout << "following node has " << uses.size() << " uses\n";
-            dump(node, std::cout);
+            o << "following node has " << uses.size() << " uses\n";
+            dump(node, o);
           }
           if (uses.size() > 1) {
             excludeAsChildren.insert(node);
@@ -739,13 +746,13 @@ struct Souperify : public WalkerPass<PostWalker<Souperify>> {
       }
     }
     // Emit possible traces.
-    for (auto& nodePtr : graph.nodes) {
-      auto* node = nodePtr.get();
+    for (auto& graphNode : graph.nodes) {
+      auto* node = &graphNode;
       // Trace
       if (DataFlow::Trace::isTraceable(node)) {
         DataFlow::Trace trace(graph, node, excludeAsChildren, localGraph);
         if (!trace.isBad()) {
-          DataFlow::Printer printer(graph, trace);
+          DataFlow::Printer printer(graph, trace, o);
           if (singleUseOnly) {
             assert(!printer.printedHasExternalUses);
           }
@@ -753,6 +760,31 @@ struct Souperify : public WalkerPass<PostWalker<Souperify>> {
       }
     }
   }
+
+  void run(PassRunner* runner, Module* module) override {
+    if (debug()) {
+      // The debug logging in the tracing and use-finding stages goes
+      // straight to stdout, so harvest serially to keep it readable.
+      ModuleUtils::iterDefinedFunctions(*module, [&](Function* func) {
+        harvestFunction(func, module, std::cout);
+      });
+      return;
+    }
+    // Harvest in parallel, buffering each function's candidates, and emit
+    // them in module order afterwards: the output is byte-identical to a
+    // serial run, and the iostream work no longer serializes the pass.
+    ModuleUtils::ParallelFunctionAnalysis<std::string> analysis(
+      *module, [&](Function* func, std::string& out) {
+        if (func->imported()) {
+          return;
+        }
+        std::ostringstream buffer;
+        harvestFunction(func, module, buffer);
+        out = buffer.str();
+      });
+    ModuleUtils::iterDefinedFunctions(
+      *module, [&](Function* func) { std::cout << analysis.map[func]; });
+  }
 };
 
 Pass* createSouperifyPass() { return new Souperify(false); }
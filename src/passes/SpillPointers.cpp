@@ -76,36 +76,28 @@ struct SpillPointers
   void spillPointers() {
     pointerType = getModule()->memory.indexType;
 
-    // we only care about possible pointers
     auto* func = getFunction();
-    PointerMap pointerMap;
-    for (Index i = 0; i < func->getNumLocals(); i++) {
-      if (func->getLocalType(i) == pointerType) {
-        auto offset = pointerMap.size() * pointerType.getByteSize();
-        pointerMap[i] = offset;
-      }
-    }
-    // find calls and spill around them
-    bool spilled = false;
-    Index spillLocal = -1;
+    auto numLocals = func->getNumLocals();
+
+    // First, find the calls with pointers live across them, and which
+    // pointer locals interfere - are live across the same call - so that
+    // non-interfering ones can share a spill slot later.
+    struct CallSpill {
+      // position of the call in its block's action list
+      Index action;
+      Expression** origin;
+      std::vector<Index> toSpill;
+    };
+    std::vector<std::pair<BasicBlock*, std::vector<CallSpill>>> blockSpills;
+    std::set<Index> spilledLocals;
+    std::vector<bool> interferes(numLocals * numLocals, false);
     for (auto& curr : basicBlocks) {
       if (liveBlocks.count(curr.get()) == 0) {
         continue; // ignore dead blocks
       }
       auto& liveness = curr->contents;
       auto& actions = liveness.actions;
-      Index lastCall = -1;
-      for (Index i = 0; i < actions.size(); i++) {
-        auto& action = liveness.actions[i];
-        if (action.isOther()) {
-          lastCall = i;
-        }
-      }
-      if (lastCall == Index(-1)) {
-        continue; // nothing to see here
-      }
-      // scan through the block, spilling around the calls
-      // TODO: we can filter on pointerMap everywhere
+      std::vector<CallSpill> spills;
       SetOfLocals live = liveness.end;
       for (int i = int(actions.size()) - 1; i >= 0; i--) {
         auto& action = actions[i];
@@ -116,36 +108,114 @@ struct SpillPointers
         } else if (action.isOther()) {
           std::vector<Index> toSpill;
           for (auto index : live) {
-            if (pointerMap.count(index) > 0) {
+            if (func->getLocalType(index) == pointerType) {
               toSpill.push_back(index);
             }
           }
           if (!toSpill.empty()) {
-            // we now have a call + the information about which locals
-            // should be spilled
-            if (!spilled) {
-              // prepare stack support: get a pointer to stack space big enough
-              // for all our data
-              spillLocal = Builder::addVar(func, pointerType);
-              spilled = true;
+            for (auto index : toSpill) {
+              spilledLocals.insert(index);
+              for (auto other : toSpill) {
+                if (other != index) {
+                  interferes[index * numLocals + other] = true;
+                }
+              }
             }
-            // the origin was seen at walk, but the thing may have moved
-            auto* pointer = actualPointers[action.origin];
-            spillPointersAroundCall(
-              pointer, toSpill, spillLocal, pointerMap, func, getModule());
+            spills.push_back({Index(i), action.origin, std::move(toSpill)});
           }
         } else {
           WASM_UNREACHABLE("unexpected action");
         }
       }
+      if (!spills.empty()) {
+        // we scanned backwards; emission below works forwards
+        std::reverse(spills.begin(), spills.end());
+        blockSpills.emplace_back(curr.get(), std::move(spills));
+      }
     }
-    if (spilled) {
-      // get the stack space, and set the local to it
-      ABI::getStackSpace(spillLocal,
-                         func,
-                         pointerType.getByteSize() * pointerMap.size(),
-                         *getModule());
+    if (blockSpills.empty()) {
+      return; // nothing to see here
+    }
+
+    // Assign slots, sharing them between locals that do not interfere:
+    // greedily give each spilled local the lowest slot no local it
+    // interferes with already has.
+    PointerMap pointerMap;
+    Index numSlots = 0;
+    std::unordered_map<Index, Index> slotOf;
+    for (auto index : spilledLocals) {
+      Index slot = 0;
+      while (true) {
+        bool taken = false;
+        for (auto& [other, otherSlot] : slotOf) {
+          if (otherSlot == slot && interferes[index * numLocals + other]) {
+            taken = true;
+            break;
+          }
+        }
+        if (!taken) {
+          break;
+        }
+        slot++;
+      }
+      slotOf[index] = slot;
+      numSlots = std::max(numSlots, slot + 1);
+      pointerMap[index] = slot * pointerType.getByteSize();
+    }
+
+    // prepare stack support: get a pointer to stack space big enough
+    // for all our data
+    Index spillLocal = Builder::addVar(func, pointerType);
+
+    // Emit the spills, walking each block forwards so that we can skip a
+    // spill whose slot already holds the local's current value: one stored
+    // at an earlier call in the block, with no set of the local (and no
+    // other local spilled to the shared slot) in between.
+    for (auto& [block, spills] : blockSpills) {
+      auto& actions = block->contents.actions;
+      // the local whose current value each slot holds, so far in this block
+      std::unordered_map<Index, Index> slotHolds;
+      Index nextAction = 0;
+      for (auto& spill : spills) {
+        // a set changes the local's value, invalidating what was stored
+        for (; nextAction < spill.action; nextAction++) {
+          auto& action = actions[nextAction];
+          if (action.isSet()) {
+            for (auto it = slotHolds.begin(); it != slotHolds.end();) {
+              if (it->second == action.index) {
+                it = slotHolds.erase(it);
+              } else {
+                ++it;
+              }
+            }
+          }
+        }
+        // the origin was seen at walk, but the thing may have moved
+        auto* pointer = actualPointers[spill.origin];
+        if ((*pointer)->type == Type::unreachable) {
+          continue; // the call is never reached anyhow, ignore
+        }
+        std::vector<Index> toSpill;
+        for (auto index : spill.toSpill) {
+          auto slot = slotOf[index];
+          auto iter = slotHolds.find(slot);
+          if (iter != slotHolds.end() && iter->second == index) {
+            continue; // the slot is already up to date
+          }
+          slotHolds[slot] = index;
+          toSpill.push_back(index);
+        }
+        if (!toSpill.empty()) {
+          spillPointersAroundCall(
+            pointer, toSpill, spillLocal, pointerMap, func, getModule());
+        }
+      }
     }
+    // get the stack space, and set the local to it
+    ABI::getStackSpace(spillLocal,
+                       func,
+                       pointerType.getByteSize() * numSlots,
+                       *getModule());
   }
 
   void spillPointersAroundCall(Expression** origin,
@@ -50,25 +50,19 @@ Pass* createGenerateStackIRPass() { return new GenerateStackIR(); }
 class StackIROptimizer {
   Function* func;
   PassOptions& passOptions;
+  Module& module;
   StackIR& insts;
   FeatureSet features;
 
 public:
-  StackIROptimizer(Function* func,
-                   PassOptions& passOptions,
-                   FeatureSet features)
-    : func(func), passOptions(passOptions), insts(*func->stackIR.get()),
-      features(features) {
+  StackIROptimizer(Function* func, PassOptions& passOptions, Module& module)
+    : func(func), passOptions(passOptions), module(module),
+      insts(*func->stackIR.get()), features(module.features) {
     assert(func->stackIR);
   }
 
   void run() {
     dce();
-    // FIXME: local2Stack is currently rather slow (due to localGraph),
-    //        so for now run it only when really optimizing
-    if (passOptions.optimizeLevel >= 3 || passOptions.shrinkLevel >= 1) {
-      local2Stack();
-    }
     // Removing unneeded blocks is dangerous with GC, as if we do this:
     //
     //   (call
@@ -101,9 +95,17 @@ public:
     // However, that is not valid as an non-nullable reference cannot be set to
     // a local. TODO: double check that this is still true now that we don't
     // have RTTs.
+    // We remove the blocks before scheduling locals below, so that it can
+    // optimize across the boundaries of the blocks we remove here.
     if (!features.hasGC()) {
       removeUnneededBlocks();
     }
+    // FIXME: local2Stack is currently rather slow (due to localGraph),
+    //        so for now run it only when really optimizing
+    if (passOptions.optimizeLevel >= 3 || passOptions.shrinkLevel >= 1) {
+      local2Stack();
+    }
+    fuseTees();
     dce();
   }
 
@@ -209,7 +211,17 @@ private:
       // This is something we should handle, look into it.
       if (inst->type.isConcrete()) {
         bool optimized = false;
-        if (auto* get = inst->origin->dynCast<LocalGet>()) {
+        if (auto* set = inst->origin->dynCast<LocalSet>()) {
+          // This is a tee. If the local is never read then the tee does
+          // nothing but leave its value on the stack, which is where the
+          // value already is - it can simply be removed.
+          if (func->getLocalType(set->index).isSingle() &&
+              localGraph.setInfluences[set].empty()) {
+            insts[i] = nullptr;
+          }
+          // Either way a regular value is now on the stack, which the code
+          // below pushes.
+        } else if (auto* get = inst->origin->dynCast<LocalGet>()) {
           // This is a potential optimization opportunity! See if we
           // can reach the set.
           if (values.size() > 0) {
@@ -260,12 +272,67 @@ private:
           values.push_back(null);
         }
       } else if (inst->origin->is<LocalSet>() && inst->type == Type::none) {
-        // This set is potentially optimizable later, add to stack.
-        values.push_back(i);
+        auto* set = inst->origin->cast<LocalSet>();
+        if (func->getLocalType(set->index).isSingle() &&
+            localGraph.setInfluences[set].empty()) {
+          // The local is never read, so the value is simply dead - drop it,
+          // which is smaller than setting the local.
+          insts[i] = makeBasicInst(Builder(module).makeDrop(set->value));
+        } else {
+          // This set is potentially optimizable later, add to stack.
+          values.push_back(i);
+        }
       }
     }
   }
 
+  // Fuse a local.set that is immediately followed by a local.get of the same
+  // local into a local.tee, which is two bytes smaller. local2Stack removes
+  // such pairs entirely when the set has no other uses; this handles the
+  // pairs that remain because the local is also read elsewhere.
+  void fuseTees() {
+    const Index null = -1;
+    Index last = null; // the index of the last instruction we saw
+    for (Index i = 0; i < insts.size(); i++) {
+      auto* inst = insts[i];
+      if (!inst) {
+        continue;
+      }
+      if (last != null && inst->op == StackInst::Basic) {
+        if (auto* get = inst->origin->dynCast<LocalGet>()) {
+          auto* lastInst = insts[last];
+          if (lastInst->op == StackInst::Basic &&
+              lastInst->type == Type::none && get->type.isSingle()) {
+            if (auto* set = lastInst->origin->dynCast<LocalSet>()) {
+              if (set->index == get->index) {
+                insts[last] = makeBasicInst(
+                  Builder(module).makeLocalTee(set->index, set->value,
+                                               get->type));
+                insts[i] = nullptr;
+                // Leave |last| pointing at the tee: if yet another get of the
+                // same local follows, it reads the local, not the stack, so
+                // there is nothing more to fuse here.
+                continue;
+              }
+            }
+          }
+        }
+      }
+      last = i;
+    }
+  }
+
+  // Makes a Stack IR instruction for a non-control-flow origin expression
+  // that is not part of the function's Binaryen IR (the origins of the other
+  // instructions remain owned by the Binaryen IR tree).
+  StackInst* makeBasicInst(Expression* origin) {
+    auto* inst = module.allocator.alloc<StackInst>();
+    inst->op = StackInst::Basic;
+    inst->origin = origin;
+    inst->type = origin->type;
+    return inst;
+  }
+
   // There may be unnecessary blocks we can remove: blocks
   // without branches to them are always ok to remove.
   // TODO: a branch to a block in an if body can become
@@ -378,10 +445,36 @@ struct OptimizeStackIR : public WalkerPass<PostWalker<OptimizeStackIR>> {
     if (!func->stackIR) {
       return;
     }
-    StackIROptimizer(func, getPassOptions(), getModule()->features).run();
+    StackIROptimizer(func, getPassOptions(), *getModule()).run();
   }
 };
 
 Pass* createOptimizeStackIRPass() { return new OptimizeStackIR(); }
 
+// Generate and optimize in a single walk of each function. This does the work
+// of generate-stack-ir + optimize-stack-ir with one pass dispatch instead of
+// two, which is useful in pipelines that only run stack-level optimizations
+// (where pass overhead is a larger fraction of the total time).
+
+struct GenerateAndOptimizeStackIR
+  : public WalkerPass<PostWalker<GenerateAndOptimizeStackIR>> {
+  bool isFunctionParallel() override { return true; }
+
+  Pass* create() override { return new GenerateAndOptimizeStackIR; }
+
+  bool modifiesBinaryenIR() override { return false; }
+
+  void doWalkFunction(Function* func) {
+    StackIRGenerator stackIRGen(*getModule(), func);
+    stackIRGen.write();
+    func->stackIR = make_unique<StackIR>();
+    func->stackIR->swap(stackIRGen.getStackIR());
+    StackIROptimizer(func, getPassOptions(), *getModule()).run();
+  }
+};
+
+Pass* createGenerateAndOptimizeStackIRPass() {
+  return new GenerateAndOptimizeStackIR();
+}
+
 } // namespace wasm
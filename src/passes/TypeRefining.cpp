@@ -124,14 +124,16 @@ struct TypeRefining : public Pass {
     // through all the types downward from supertypes to subtypes, ensuring the
     // subtypes are suitable.
     auto& subTypes = propagator.subTypes;
-    UniqueDeferredQueue<HeapType> work;
-    for (auto type : subTypes.types) {
-      if (type.isStruct() && !type.getSuperType()) {
-        work.push(type);
+    UniqueDeferredIndexQueue<Index> work;
+    for (Index i = 0; i < subTypes.types.size(); i++) {
+      if (subTypes.types[i].isStruct() &&
+          subTypes.getSuperIndex(i) == SubTypes::InvalidIndex) {
+        work.push(i);
       }
     }
     while (!work.empty()) {
-      auto type = work.pop();
+      auto index = work.pop();
+      auto type = subTypes.types[index];
 
       // First, find fields that have nothing written to them at all, and set
       // their value to their old type. We must pick some type for the field,
@@ -195,8 +197,8 @@ struct TypeRefining : public Pass {
         }
       }
 
-      for (auto subType : subTypes.getStrictSubTypes(type)) {
-        work.push(subType);
+      for (auto subIndex : subTypes.getStrictSubTypeIndexes(index)) {
+        work.push(subIndex);
       }
     }
 
@@ -255,29 +257,32 @@ struct TypeRefining : public Pass {
   }
 
   void updateTypes(Module& wasm, PassRunner* runner) {
-    class TypeRewriter : public GlobalTypeRewriter {
-      TypeRefining& parent;
-
-    public:
-      TypeRewriter(Module& wasm, TypeRefining& parent)
-        : GlobalTypeRewriter(wasm), parent(parent) {}
-
-      void modifyStruct(HeapType oldStructType, Struct& struct_) override {
-        const auto& oldFields = oldStructType.getStruct().fields;
-        auto& newFields = struct_.fields;
-
-        for (Index i = 0; i < newFields.size(); i++) {
-          auto oldType = oldFields[i].type;
-          if (!oldType.isRef()) {
-            continue;
-          }
-          auto newType = parent.finalInfos[oldStructType][i].getBestPossible();
-          newFields[i].type = getTempType(newType);
+    // Stage the new field types and commit them in a single rebuild.
+    GlobalTypeRewriter::StagedUpdates updates;
+    for (auto& [type, infos] : finalInfos) {
+      if (!type.isStruct()) {
+        continue;
+      }
+      auto& fields = type.getStruct().fields;
+      std::vector<Type> newTypes;
+      bool changed = false;
+      for (Index i = 0; i < fields.size(); i++) {
+        auto oldType = fields[i].type;
+        if (!oldType.isRef()) {
+          newTypes.push_back(oldType);
+          continue;
+        }
+        auto newType = infos[i].getBestPossible();
+        newTypes.push_back(newType);
+        if (newType != oldType) {
+          changed = true;
         }
       }
-    };
-
-    TypeRewriter(wasm, *this).update();
+      if (changed) {
+        updates.structFields[type] = std::move(newTypes);
+      }
+    }
+    GlobalTypeRewriter::commit(updates, wasm);
 
     ReFinalize().run(runner, &wasm);
   }
@@ -50,6 +50,17 @@ struct Vacuum : public WalkerPass<ExpressionStackWalker<Vacuum>> {
     walk(func->body);
   }
 
+  // Checks whether an expression has effects that prevent us from removing
+  // it, stopping the walk of its subtree as early as possible. Most of our
+  // queries are of subtrees we look at once and then modify, so there is
+  // little to gain from caching full analyses, but much from exiting early.
+  bool hasUnremovableEffects(Expression* curr) {
+    return EffectAnalyzer(getPassOptions(), *getModule())
+      .walkUntil(curr, [](const EffectAnalyzer& effects) {
+        return effects.hasUnremovableSideEffects();
+      });
+  }
+
   // Returns nullptr if curr is dead, curr if it must stay as is, or one of its
   // children if it can be replaced. Takes into account:
   //
@@ -110,8 +121,7 @@ struct Vacuum : public WalkerPass<ExpressionStackWalker<Vacuum>> {
       // get rid of it. However, the children may have side effects.
       SmallVector<Expression*, 1> childrenWithEffects;
       for (auto* child : ChildIterator(curr)) {
-        if (EffectAnalyzer(getPassOptions(), *getModule(), child)
-              .hasUnremovableSideEffects()) {
+        if (hasUnremovableEffects(child)) {
           childrenWithEffects.push_back(child);
         }
       }
@@ -290,9 +300,7 @@ struct Vacuum : public WalkerPass<ExpressionStackWalker<Vacuum>> {
     //
     // Note that we check the type here to avoid removing unreachable code - we
     // leave that for DCE.
-    if (curr->type == Type::none &&
-        !EffectAnalyzer(getPassOptions(), *getModule(), curr)
-           .hasUnremovableSideEffects()) {
+    if (curr->type == Type::none && !hasUnremovableEffects(curr)) {
       ExpressionManipulator::nop(curr);
       return;
     }
@@ -377,8 +385,7 @@ struct Vacuum : public WalkerPass<ExpressionStackWalker<Vacuum>> {
       ExpressionManipulator::nop(curr->body);
     }
     if (curr->getResults() == Type::none &&
-        !EffectAnalyzer(getPassOptions(), *getModule(), curr->body)
-           .hasUnremovableSideEffects()) {
+        !hasUnremovableEffects(curr->body)) {
       ExpressionManipulator::nop(curr->body);
     }
   }
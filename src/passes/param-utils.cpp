@@ -18,6 +18,7 @@
 #include "ir/local-graph.h"
 #include "ir/possible-constant.h"
 #include "ir/type-updating.h"
+#include "param-utils.h"
 #include "support/sorted_vector.h"
 #include "wasm.h"
 
@@ -184,6 +185,180 @@ SortedVector removeParameters(const std::vector<Function*>& funcs,
   return removed;
 }
 
+void removeParametersBatch(std::vector<RemovalRequest>& batch,
+                           Module* module,
+                           PassRunner* runner) {
+  // First, decide which of the requested indexes we can in fact remove. The
+  // conditions are the same as in removeParameter(), but we check each call
+  // site once for all the indexes, not once per index.
+  for (auto& request : batch) {
+    if (request.indexes.empty()) {
+      continue;
+    }
+    assert(request.funcs.size() > 0);
+    auto* first = request.funcs[0];
+#ifndef NDEBUG
+    for (auto* func : request.funcs) {
+      assert(func->type == first->type);
+    }
+#endif
+    SortedVector removable;
+    for (auto i : request.indexes) {
+      // The type must be valid for us to handle as a local (since we replace
+      // the parameter with a local).
+      if (TypeUpdating::canHandleAsLocal(first->getLocalType(i))) {
+        removable.insert(i);
+      }
+    }
+    // An index is only removable if none of the calls passes it a value with
+    // side effects that we cannot remove.
+    auto checkEffects = [&](ExpressionList& operands) {
+      SortedVector bad;
+      for (auto i : removable) {
+        if (EffectAnalyzer(runner->options, *module, operands[i])
+              .hasUnremovableSideEffects()) {
+          bad.insert(i);
+        }
+      }
+      for (auto i : bad) {
+        removable.erase(i);
+      }
+    };
+    for (auto* call : request.calls) {
+      if (removable.empty()) {
+        break;
+      }
+      checkEffects(call->operands);
+    }
+    for (auto* call : request.callRefs) {
+      if (removable.empty()) {
+        break;
+      }
+      checkEffects(call->operands);
+    }
+    request.removed = std::move(removable);
+  }
+
+  // Apply the cheap, serial parts: update each function's type and add a
+  // local for each removed parameter, recording how every old local index
+  // maps to a new one. The layout matches what repeated removeParameter()
+  // calls produce: the new locals appear at the end of the local list, in
+  // order from the highest removed parameter to the lowest.
+  std::unordered_map<Function*, std::vector<Index>> localRemaps;
+  std::unordered_map<Expression*, const SortedVector*> operandRemovals;
+  for (auto& request : batch) {
+    if (request.removed.empty()) {
+      continue;
+    }
+    auto* first = request.funcs[0];
+    auto paramsType = first->getParams();
+    Index oldNumParams = paramsType.size();
+    Index numRemoved = request.removed.size();
+    std::vector<Type> params(paramsType.begin(), paramsType.end());
+    // The types of the removed parameters, highest index first.
+    std::vector<Type> removedTypes;
+    for (auto it = request.removed.rbegin(); it != request.removed.rend();
+         ++it) {
+      removedTypes.push_back(params[*it]);
+      params.erase(params.begin() + *it);
+    }
+    for (auto* func : request.funcs) {
+      auto oldNumLocals = func->getNumLocals();
+      func->setParams(Type(params));
+
+      // It's cumbersome to adjust local names - TODO don't clear them?
+      Builder::clearLocalNames(func);
+
+      std::vector<Index> newIndexes;
+      for (auto type : removedTypes) {
+        newIndexes.push_back(Builder::addVar(func, type));
+      }
+      if (func->imported()) {
+        continue;
+      }
+      auto& remap = localRemaps[func];
+      remap.resize(oldNumLocals);
+      Index removedSoFar = 0;
+      for (Index i = 0; i < oldNumLocals; i++) {
+        if (i < oldNumParams && request.removed.has(i)) {
+          // A removed parameter uses the new local we just added for it.
+          remap[i] = newIndexes[numRemoved - 1 - removedSoFar];
+          removedSoFar++;
+        } else {
+          // Everything else shifts down past the removed parameters below
+          // it.
+          remap[i] = i - removedSoFar;
+        }
+      }
+    }
+    for (auto* call : request.calls) {
+      operandRemovals[call] = &request.removed;
+    }
+    for (auto* call : request.callRefs) {
+      operandRemovals[call] = &request.removed;
+    }
+  }
+  if (localRemaps.empty() && operandRemovals.empty()) {
+    return;
+  }
+
+  // Now do all the work that requires walking code - updating local indexes
+  // in the pruned functions, and removing the arguments from the calls that
+  // reach them - in a single function-parallel pass over the module.
+  struct BatchUpdater : public WalkerPass<PostWalker<BatchUpdater>> {
+    bool isFunctionParallel() override { return true; }
+
+    // Shared and read-only during the parallel phase.
+    std::unordered_map<Function*, std::vector<Index>>& localRemaps;
+    std::unordered_map<Expression*, const SortedVector*>& operandRemovals;
+
+    BatchUpdater(
+      std::unordered_map<Function*, std::vector<Index>>& localRemaps,
+      std::unordered_map<Expression*, const SortedVector*>& operandRemovals)
+      : localRemaps(localRemaps), operandRemovals(operandRemovals) {}
+
+    Pass* create() override {
+      return new BatchUpdater(localRemaps, operandRemovals);
+    }
+
+    // The remap for the current function, if it had parameters removed.
+    const std::vector<Index>* remap = nullptr;
+
+    void doWalkFunction(Function* func) {
+      auto iter = localRemaps.find(func);
+      remap = iter != localRemaps.end() ? &iter->second : nullptr;
+      super::doWalkFunction(func);
+      if (remap) {
+        TypeUpdating::handleNonDefaultableLocals(func, *getModule());
+      }
+    }
+
+    void visitLocalGet(LocalGet* curr) { updateIndex(curr->index); }
+    void visitLocalSet(LocalSet* curr) { updateIndex(curr->index); }
+    void updateIndex(Index& index) {
+      if (remap) {
+        index = (*remap)[index];
+      }
+    }
+
+    void visitCall(Call* curr) { removeOperands(curr, curr->operands); }
+    void visitCallRef(CallRef* curr) { removeOperands(curr, curr->operands); }
+    void removeOperands(Expression* curr, ExpressionList& operands) {
+      auto iter = operandRemovals.find(curr);
+      if (iter == operandRemovals.end()) {
+        return;
+      }
+      // Erase from the highest index down so the lower ones remain valid.
+      auto& removed = *iter->second;
+      for (auto it = removed.rbegin(); it != removed.rend(); ++it) {
+        operands.erase(operands.begin() + *it);
+      }
+    }
+  };
+
+  BatchUpdater(localRemaps, operandRemovals).run(runner, module);
+}
+
 SortedVector applyConstantValues(const std::vector<Function*>& funcs,
                                  const std::vector<Call*>& calls,
                                  const std::vector<CallRef*>& callRefs,
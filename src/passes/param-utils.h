@@ -80,6 +80,29 @@ SortedVector removeParameters(const std::vector<Function*>& funcs,
                               Module* module,
                               PassRunner* runner);
 
+// One entry in a batch of parameter removals: a set of functions that all
+// have the same heap type, the indexes to try to remove, and the calls and
+// call_refs that reach those functions, in the same form as the arguments to
+// removeParameters().
+struct RemovalRequest {
+  std::vector<Function*> funcs;
+  SortedVector indexes;
+  std::vector<Call*> calls;
+  std::vector<CallRef*> callRefs;
+  // Filled in by removeParametersBatch(): the indexes actually removed.
+  SortedVector removed;
+};
+
+// The same as calling removeParameters() on each entry in turn, but all of
+// the function bodies and call sites are rewritten in a single function-
+// parallel pass, rather than one walk per removed parameter per entry. This
+// matters when many heap types each lose several parameters, as in
+// SignaturePruning on an interface-heavy module. Fills in |removed| on each
+// entry.
+void removeParametersBatch(std::vector<RemovalRequest>& batch,
+                           Module* module,
+                           PassRunner* runner);
+
 // Given a set of functions and the calls and call_refs that reach them, find
 // which parameters are passed the same constant value in all the calls. For
 // each such parameter, apply it inside the function, that is, do a local.set of
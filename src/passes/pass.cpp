@@ -21,11 +21,15 @@
 #include <unistd.h>
 #endif
 
+#include "ir/function-utils.h"
 #include "ir/hashed.h"
+#include "ir/manipulation.h"
 #include "ir/module-utils.h"
+#include "ir/utils.h"
 #include "pass.h"
 #include "passes/passes.h"
 #include "support/colors.h"
+#include "support/utilities.h"
 #include "wasm-debug.h"
 #include "wasm-io.h"
 #include "wasm-validator.h"
@@ -100,6 +104,10 @@ void PassRegistry::registerPasses() {
                "removes arguments to calls in an lto-like manner, and "
                "optimizes where we removed",
                createDAEOptimizingPass);
+  registerPass("cleanup",
+               "removes obviously unneeded code and merges blocks (fused "
+               "vacuum + merge-blocks)",
+               createCleanupPass);
   registerPass("coalesce-locals",
                "reduce # of locals by coalescing",
                createCoalesceLocalsPass);
@@ -114,9 +122,16 @@ void PassRegistry::registerPasses() {
   registerPass("const-hoisting",
                "hoist repeated constants to a local",
                createConstHoistingPass);
+  registerPass("count-execution",
+               "instrument the build with execution counters at each "
+               "function entry, loop header, and return",
+               createCountExecutionPass);
   registerPass("cfp",
                "propagate constant struct field values",
                createConstantFieldPropagationPass);
+  registerPass("crp",
+               "propagate constant return values to call sites",
+               createConstantReturnPropagationPass);
   registerPass(
     "dce", "removes unreachable code", createDeadCodeEliminationPass);
   registerPass("dealign",
@@ -125,6 +140,10 @@ void PassRegistry::registerPasses() {
   registerPass("denan",
                "instrument the wasm to convert NaNs into 0 at runtime",
                createDeNaNPass);
+  registerPass("devirtualize",
+               "turns call_refs with a single possible target into direct "
+               "calls",
+               createDevirtualizePass);
   registerPass(
     "directize", "turns indirect calls into direct ones", createDirectizePass);
   registerPass(
@@ -164,8 +183,18 @@ void PassRegistry::registerPasses() {
     "functions with i64 in their signature (which cannot be invoked "
     "via the wasm table without JavaScript BigInt support).",
     createGenerateI64DynCallsPass);
+  registerPass("generate-global-effects",
+               "generate global effect info (helps later passes)",
+               createGenerateGlobalEffectsPass);
+  registerPass("discard-global-effects",
+               "discard global effect info (run this when a pass may add "
+               "effects and the info is out of date)",
+               createDiscardGlobalEffectsPass);
   registerPass(
     "generate-stack-ir", "generate Stack IR", createGenerateStackIRPass);
+  registerPass("generate-and-optimize-stack-ir",
+               "generate and optimize Stack IR in a single pass",
+               createGenerateAndOptimizeStackIRPass);
   registerPass(
     "global-refining", "refine the types of globals", createGlobalRefiningPass);
   registerPass(
@@ -223,11 +252,19 @@ void PassRegistry::registerPasses() {
     "instrument-memory",
     "instrument the build with code to intercept all loads and stores",
     createInstrumentMemoryPass);
+  registerPass(
+    "instrument-memory-ring",
+    "like instrument-memory, but record into an in-memory ring buffer that "
+    "is flushed to the host in batches",
+    createInstrumentMemoryRingPass);
   registerPass(
     "licm", "loop invariant code motion", createLoopInvariantCodeMotionPass);
   registerPass("limit-segments",
                "attempt to merge segments to fit within web limits",
                createLimitSegmentsPass);
+  registerPass("loop-canonicalize",
+               "canonicalize loops into rotated (bottom-tested) form",
+               createLoopCanonicalizePass);
   registerPass("memory64-lowering",
                "lower loads and stores to a 64-bit memory to instead use a "
                "32-bit one",
@@ -243,6 +280,9 @@ void PassRegistry::registerPasses() {
   registerPass(
     "merge-locals", "merges locals when beneficial", createMergeLocalsPass);
   registerPass("metrics", "reports metrics", createMetricsPass);
+  registerPass("metrics-json",
+               "reports detailed metrics as JSON",
+               createJSONMetricsPass);
   registerPass("minify-imports",
                "minifies import names (only those, and not export names), and "
                "emits a mapping to the minified ones",
@@ -262,6 +302,10 @@ void PassRegistry::registerPasses() {
   registerPass("mod-asyncify-never-unwind",
                "apply the assumption that asyncify never unwinds",
                createModAsyncifyNeverUnwindPass);
+  registerPass("monomorphize",
+               "clone functions for the argument patterns of their call "
+               "sites, so later passes can specialize the clones",
+               createMonomorphizePass);
   registerPass("nm", "name list", createNameListPass);
   registerPass("name-types", "(re)name all heap types", createNameTypesPass);
   registerPass("once-reduction",
@@ -279,6 +323,9 @@ void PassRegistry::registerPasses() {
                createOptimizeInstructionsPass);
   registerPass(
     "optimize-stack-ir", "optimize Stack IR", createOptimizeStackIRPass);
+  registerPass("outlining",
+               "outline repeated code into shared functions",
+               createOutliningPass);
   registerPass("pick-load-signs",
                "pick load signs based on their uses",
                createPickLoadSignsPass);
@@ -346,9 +393,17 @@ void PassRegistry::registerPasses() {
   registerPass("reorder-functions",
                "sorts functions by access frequency",
                createReorderFunctionsPass);
+  registerPass("reorder-functions-for-streaming",
+               "moves startup-critical functions to the front of the code "
+               "section for streaming compilation",
+               createReorderFunctionsForStreamingPass);
   registerPass("reorder-locals",
                "sorts locals by access frequency",
                createReorderLocalsPass);
+  registerPass("repack",
+               "re-lays out each function's IR contiguously in memory, "
+               "improving the locality of later tree walks",
+               createRepackPass);
   registerPass("rereloop",
                "re-optimize control flow using the relooper algorithm",
                createReReloopPass);
@@ -635,6 +690,13 @@ void PassRunner::run() {
   assert(!ran);
   ran = true;
 
+  // In trusted mode, enable the relaxed finalization fast path while our
+  // passes run. The outermost runner owns the (process-wide) setting; nested
+  // runners share our options and leave it alone.
+  if (options.trustedInput && !isNested) {
+    setTrustDeclaredTypes(true);
+  }
+
   static const int passDebug = getPassDebug();
   // Emit logging information when asked for. At passDebug level 1+ we log
   // the main passes, while in 2 we also log nested ones. Note that for
@@ -673,8 +735,11 @@ void PassRunner::run() {
       auto before = std::chrono::steady_clock::now();
       if (pass->isFunctionParallel()) {
         // function-parallel passes should get a new instance per function
-        ModuleUtils::iterDefinedFunctions(
-          *wasm, [&](Function* func) { runPassOnFunction(pass.get(), func); });
+        ModuleUtils::iterDefinedFunctions(*wasm, [&](Function* func) {
+          if (!funcFilter || funcFilter(func)) {
+            runPassOnFunction(pass.get(), func);
+          }
+        });
       } else {
         runPass(pass.get());
       }
@@ -685,7 +750,52 @@ void PassRunner::run() {
       if (options.validate && !isNested) {
         // validate, ignoring the time
         std::cerr << "[PassRunner]   (validating)\n";
-        if (!WasmValidator().validate(*wasm, validationFlags)) {
+        bool valid;
+        if (pass->isFunctionParallel()) {
+          // A function-parallel pass can only have changed the functions it
+          // ran on, so revalidate just those; the global structure is
+          // unchanged and is checked by the final validation at the end.
+          auto localFlags = validationFlags & ~WasmValidator::Globally;
+          std::vector<Function*> funcs;
+          ModuleUtils::iterDefinedFunctions(*wasm, [&](Function* func) {
+            if (!funcFilter || funcFilter(func)) {
+              funcs.push_back(func);
+            }
+          });
+          // Validate the functions in parallel, quietly; if something is
+          // invalid, revalidate serially below to report the errors in a
+          // deterministic order.
+          std::atomic<bool> allValid;
+          allValid.store(true);
+          std::atomic<size_t> nextFunc;
+          nextFunc.store(0);
+          size_t numWorkers = ThreadPool::get()->size();
+          std::vector<std::function<ThreadWorkState()>> doWorkers;
+          for (size_t i = 0; i < numWorkers; i++) {
+            doWorkers.push_back([&]() {
+              auto index = nextFunc.fetch_add(1);
+              if (index >= funcs.size()) {
+                return ThreadWorkState::Finished;
+              }
+              if (!WasmValidator().validate(
+                    funcs[index], *wasm, localFlags | WasmValidator::Quiet)) {
+                allValid.store(false);
+              }
+              return index + 1 == funcs.size() ? ThreadWorkState::Finished
+                                               : ThreadWorkState::More;
+            });
+          }
+          ThreadPool::get()->work(doWorkers);
+          valid = allValid.load();
+          if (!valid) {
+            for (auto* func : funcs) {
+              WasmValidator().validate(func, *wasm, localFlags);
+            }
+          }
+        } else {
+          valid = WasmValidator().validate(*wasm, validationFlags);
+        }
+        if (!valid) {
           std::cout << *wasm << '\n';
           if (passDebug >= 2) {
             Fatal() << "Last pass (" << pass->name
@@ -717,48 +827,221 @@ void PassRunner::run() {
     // better to run as many passes as possible on a single function before
     // moving to the next
     std::vector<Pass*> stack;
+    // The duplicate-function grouping (see below) survives across
+    // consecutive stacks of function-parallel passes: a parallel stack
+    // leaves each duplicate identical to its representative (the optimized
+    // result is copied over), so the grouping computed once remains correct
+    // until a non-parallel pass runs and may change functions independently.
+    std::unordered_map<Function*, Function*> cachedCopyResultFrom;
+    bool dedupeGroupsValid = false;
     auto flush = [&]() {
       if (stack.size() > 0) {
         // run the stack of passes on all the functions, in parallel
         size_t num = ThreadPool::get()->size();
+        // A task is normally a whole function. When every pass in the stack
+        // is subtree-parallel, a function far above the threshold is instead
+        // split into ranges of its body's children, so that several threads
+        // can work on it at once - otherwise one huge function leaves all
+        // but one worker idle.
+        struct Task {
+          Function* func;
+          // When block is non-null, run only on its children [begin, end).
+          Block* block = nullptr;
+          Index begin = 0;
+          Index end = 0;
+          Index cost = 0;
+        };
+        std::vector<Task> tasks;
+        bool splittable = num > 1 && options.subtreeParallelThreshold > 0;
+        for (auto* pass : stack) {
+          splittable = splittable && pass->isSubtreeParallel();
+        }
+        bool modifiesIR = false;
+        for (auto* pass : stack) {
+          modifiesIR = modifiesIR || pass->modifiesBinaryenIR();
+        }
+        // With many structurally identical functions - common when several
+        // variants of a codebase are linked into one module - running the
+        // same deterministic passes on each one does the same work N times.
+        // When enabled, optimize a single representative of each group of
+        // identical functions, and copy the result into the others. This is
+        // opt-in as it assumes every pass in the stack is a pure function of
+        // the body, which holds for the normal optimization pipeline but not
+        // for e.g. instrumentation that gives each function a distinct ID.
+        std::unordered_map<Function*, Function*> copyResultFrom;
+        if (options.dedupeFunctionWork && modifiesIR && !options.debugInfo) {
+          if (dedupeGroupsValid) {
+            copyResultFrom = cachedCopyResultFrom;
+          } else {
+            auto hashes = FunctionHasher::createMap(wasm);
+            FunctionHasher(&hashes).run(this, wasm);
+            std::unordered_map<size_t, std::vector<Function*>> hashGroups;
+            for (auto& f : wasm->functions) {
+              auto* func = f.get();
+              if (func->imported() || (funcFilter && !funcFilter(func))) {
+                continue;
+              }
+              hashGroups[hashes[func]].push_back(func);
+            }
+            for (auto& [_, group] : hashGroups) {
+              for (Index i = 1; i < group.size(); i++) {
+                if (FunctionUtils::equal(group[0], group[i])) {
+                  copyResultFrom[group[i]] = group[0];
+                }
+              }
+            }
+            cachedCopyResultFrom = copyResultFrom;
+            dedupeGroupsValid = true;
+          }
+        }
+        for (auto& f : wasm->functions) {
+          auto* func = f.get();
+          if (func->imported() || (funcFilter && !funcFilter(func))) {
+            continue;
+          }
+          if (copyResultFrom.count(func)) {
+            // A duplicate; its representative is optimized instead, and we
+            // copy the result over afterwards.
+            continue;
+          }
+          Index cost = num > 1 ? Measurer::measure(func->body) : 0;
+          Block* body = nullptr;
+          if (splittable && cost >= options.subtreeParallelThreshold) {
+            body = func->body->dynCast<Block>();
+          }
+          if (body && body->list.size() >= 2) {
+            // Split the children into chunks of roughly even cost, aiming
+            // for several chunks per worker so the pool can balance them.
+            // Several chunks of one function run concurrently, so clear the
+            // function's Stack IR here rather than racing to do so there.
+            if (modifiesIR) {
+              func->stackIR.reset(nullptr);
+            }
+            Index chunkMin = std::max(cost / Index(num * 4), Index(1));
+            Index begin = 0;
+            Index chunkCost = 0;
+            for (Index i = 0; i < body->list.size(); i++) {
+              chunkCost += Measurer::measure(body->list[i]);
+              if (chunkCost >= chunkMin || i + 1 == body->list.size()) {
+                tasks.push_back({func, body, begin, i + 1, chunkCost});
+                begin = i + 1;
+                chunkCost = 0;
+              }
+            }
+          } else {
+            tasks.push_back({func, nullptr, 0, 0, cost});
+          }
+        }
+        // Hand out the largest tasks first. The workers share a single
+        // queue, so this does not change what runs, only the order; but with
+        // a skewed size distribution it avoids the case where a huge task
+        // is picked up last and one worker grinds on it alone while the
+        // others sit idle.
+        if (num > 1) {
+          std::stable_sort(
+            tasks.begin(), tasks.end(), [](const Task& a, const Task& b) {
+              return a.cost > b.cost;
+            });
+        }
         std::vector<std::function<ThreadWorkState()>> doWorkers;
-        std::atomic<size_t> nextFunction;
-        nextFunction.store(0);
-        size_t numFunctions = wasm->functions.size();
+        std::atomic<size_t> nextTask;
+        nextTask.store(0);
+        size_t numTasks = tasks.size();
         for (size_t i = 0; i < num; i++) {
           doWorkers.push_back([&]() {
-            auto index = nextFunction.fetch_add(1);
+            auto index = nextTask.fetch_add(1);
             // get the next task, if there is one
-            if (index >= numFunctions) {
+            if (index >= numTasks) {
               return ThreadWorkState::Finished; // nothing left
             }
-            Function* func = this->wasm->functions[index].get();
-            if (!func->imported()) {
+            auto& task = tasks[index];
+            if (task.block) {
+              runPassStackOnBlockRange(
+                stack, task.func, task.block, task.begin, task.end);
+            } else {
               // do the current task: run all passes on this function
-              for (auto* pass : stack) {
-                runPassOnFunction(pass, func);
-              }
+              runPassStackOnFunction(stack, task.func);
             }
-            if (index + 1 == numFunctions) {
+            if (index + 1 == numTasks) {
               return ThreadWorkState::Finished; // we did the last one
             }
             return ThreadWorkState::More;
           });
         }
         ThreadPool::get()->work(doWorkers);
+        // Copy the optimized representatives into their duplicates. Copying
+        // a body is far cheaper than optimizing it, so even done serially
+        // this is a large win.
+        for (auto& [dup, rep] : copyResultFrom) {
+          dup->body = ExpressionManipulator::copy(rep->body, *wasm);
+          dup->vars = rep->vars;
+          dup->localNames = rep->localNames;
+          dup->localIndices = rep->localIndices;
+          dup->stackIR.reset(nullptr);
+        }
       }
       stack.clear();
     };
+    // When profiling, each pass runs by itself (we flush after every one), so
+    // that its cost can be attributed to it. The work of nested runners that
+    // a pass spawns is naturally attributed to that pass; nested runners do
+    // not emit profiles of their own.
+    const bool profiling = options.profilePasses && !isNested;
+    if (profiling) {
+      profile.clear();
+    }
+    auto profileOne = [&](Pass* pass, auto runIt) {
+      auto arenaBefore = wasm->allocator.totalAllocatedBytes();
+      auto rssBefore = getPeakRSS();
+      auto before = std::chrono::steady_clock::now();
+      runIt();
+      auto after = std::chrono::steady_clock::now();
+      profile.push_back(
+        {pass->name,
+         std::chrono::duration<double>(after - before).count(),
+         getPeakRSS() - rssBefore,
+         wasm->allocator.totalAllocatedBytes() - arenaBefore});
+    };
     for (auto& pass : passes) {
       if (pass->isFunctionParallel()) {
         stack.push_back(pass.get());
+        if (profiling) {
+          profileOne(pass.get(), flush);
+        }
       } else {
         flush();
-        runPass(pass.get());
+        if (profiling) {
+          profileOne(pass.get(), [&]() { runPass(pass.get()); });
+        } else {
+          runPass(pass.get());
+        }
+        // The pass may have changed any function, including making former
+        // duplicates diverge, so the grouping must be recomputed.
+        dedupeGroupsValid = false;
       }
     }
     flush();
+    if (profiling && printProfile) {
+      dumpProfile(std::cerr);
+    }
+  }
+
+  if (options.trustedInput && !isNested) {
+    setTrustDeclaredTypes(false);
+  }
+}
+
+void PassRunner::dumpProfile(std::ostream& o) {
+  // Emit the profile as JSON, one entry per pass in execution order.
+  o << "[\n";
+  for (size_t i = 0; i < profile.size(); i++) {
+    auto& entry = profile[i];
+    o << "  {\"pass\": \"" << entry.name << "\", \"seconds\": " << entry.seconds
+      << ", \"peak_rss_delta\": " << entry.peakRSSDelta
+      << ", \"arena_bytes_delta\": " << entry.arenaDelta << '}'
+      << (i + 1 < profile.size() ? "," : "") << '\n';
   }
+  o << "]\n";
 }
 
 void PassRunner::runOnFunction(Function* func) {
@@ -905,6 +1188,46 @@ void PassRunner::runPassOnFunction(Pass* pass, Function* func) {
   }
 }
 
+void PassRunner::runPassStackOnFunction(const std::vector<Pass*>& stack,
+                                        Function* func) {
+  for (auto* pass : stack) {
+    assert(pass->isFunctionParallel());
+    // function-parallel passes get a new instance per function
+    auto instance = std::unique_ptr<Pass>(pass->create());
+    std::unique_ptr<AfterEffectFunctionChecker> checker;
+    if (getPassDebug()) {
+      checker = std::unique_ptr<AfterEffectFunctionChecker>(
+        new AfterEffectFunctionChecker(func));
+    }
+    instance->runOnFunction(this, wasm, func);
+    // If Binaryen IR was modified, Stack IR must be cleared - it would be
+    // out of sync in a potentially dangerous way. This must happen per pass
+    // and not once for the whole stack, as a later pass in the stack may
+    // create Stack IR, which must not be discarded.
+    if (pass->modifiesBinaryenIR()) {
+      func->stackIR.reset(nullptr);
+    }
+    if (getPassDebug()) {
+      checker->check();
+    }
+  }
+}
+
+void PassRunner::runPassStackOnBlockRange(const std::vector<Pass*>& stack,
+                                          Function* func,
+                                          Block* block,
+                                          Index begin,
+                                          Index end) {
+  for (auto* pass : stack) {
+    assert(pass->isFunctionParallel() && pass->isSubtreeParallel());
+    // as with whole functions, each piece gets a new instance
+    auto instance = std::unique_ptr<Pass>(pass->create());
+    instance->runOnFunctionBlockRange(this, wasm, func, block, begin, end);
+  }
+  // Note that we do not clear Stack IR here: other pieces of this function
+  // may be running concurrently, so the caller cleared it up front instead.
+}
+
 void PassRunner::handleAfterEffects(Pass* pass, Function* func) {
   if (pass->modifiesBinaryenIR()) {
     // If Binaryen IR is modified, Stack IR must be cleared - it would
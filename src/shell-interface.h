@@ -92,6 +92,22 @@ struct ShellExternalInterface : ModuleRunner::ExternalInterface {
         return loaded;
       }
     }
+    // Bulk operations over ranges the caller has checked to be in bounds.
+    void fill(size_t address, uint8_t value, size_t size) {
+      if (size > 0) {
+        std::memset(&memory[address], value, size);
+      }
+    }
+    void copy(size_t dest, size_t source, size_t size) {
+      if (size > 0) {
+        std::memmove(&memory[dest], &memory[source], size);
+      }
+    }
+    void write(size_t address, const char* source, size_t size) {
+      if (size > 0) {
+        std::memcpy(&memory[address], source, size);
+      }
+    }
   } memory;
 
   std::unordered_map<Name, std::vector<Literal>> tables;
@@ -223,6 +239,17 @@ struct ShellExternalInterface : ModuleRunner::ExternalInterface {
     memory.set<std::array<uint8_t, 16>>(addr, value);
   }
 
+  void memorySet(Address destAddr, uint8_t value, Address size) override {
+    memory.fill(destAddr, value, size);
+  }
+  void memoryCopy(Address destAddr, Address sourceAddr, Address size) override {
+    memory.copy(destAddr, sourceAddr, size);
+  }
+  void memoryWrite(Address destAddr, const char* source,
+                   Address size) override {
+    memory.write(destAddr, source, size);
+  }
+
   Index tableSize(Name tableName) override {
     return (Index)tables[tableName].size();
   }
@@ -22,6 +22,13 @@
 #include <iostream>
 #include <limits>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #define DEBUG_TYPE "file"
 
 std::vector<char> wasm::read_stdin() {
@@ -88,6 +95,48 @@ T wasm::read_file(const std::string& filename, Flags::BinaryOption binary) {
   return input;
 }
 
+wasm::MappedFile::MappedFile(const std::string& filename) {
+#ifndef _WIN32
+  if (filename.size() && filename != "-") {
+    BYN_TRACE("Mapping '" << filename << "'...\n");
+    auto fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+      std::cerr << "Failed opening '" << filename << "'" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+      auto* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (addr != MAP_FAILED) {
+        data = static_cast<const char*>(addr);
+        size = st.st_size;
+        mapped = true;
+      }
+    }
+    close(fd);
+    if (mapped) {
+      return;
+    }
+    // Not a mappable regular file (a pipe, perhaps); fall through and read.
+  }
+#endif
+  if (filename.size() && filename != "-") {
+    fallback = read_file<std::vector<char>>(filename, Flags::Binary);
+  } else {
+    fallback = read_stdin();
+  }
+  data = fallback.data();
+  size = fallback.size();
+}
+
+wasm::MappedFile::~MappedFile() {
+#ifndef _WIN32
+  if (mapped) {
+    munmap(const_cast<char*>(data), size);
+  }
+#endif
+}
+
 std::string wasm::read_possible_response_file(const std::string& input) {
   if (input.size() == 0 || input[0] != '@') {
     return input;
@@ -48,6 +48,48 @@ extern template std::vector<char> read_file<>(const std::string&,
 // is not a response file, return it as is.
 std::string read_possible_response_file(const std::string&);
 
+// A non-owning view of a range of bytes. This decouples consumers like the
+// binary reader from how the bytes are held: a std::vector from read_file, or
+// memory mapped by a MappedFile.
+struct BufferView {
+  BufferView() = default;
+  BufferView(const char* data, size_t size) : data_(data), size_(size) {}
+  BufferView(const std::vector<char>& vec)
+    : data_(vec.data()), size_(vec.size()) {}
+
+  const char* data() const { return data_; }
+  size_t size() const { return size_; }
+  const char& operator[](size_t i) const { return data_[i]; }
+
+private:
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+// A read-only memory mapping of an entire file. Where mapping is not
+// supported (or for stdin), the contents are read into memory instead, which
+// keeps callers simple: either way the bytes are reachable through get().
+// Mapping avoids a copy of the file and lets the pages be shared and evicted
+// by the OS, which matters for very large inputs.
+class MappedFile {
+public:
+  // An empty filename or "-" will read stdin instead.
+  explicit MappedFile(const std::string& filename);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  BufferView get() const { return BufferView(data, size); }
+
+private:
+  const char* data = nullptr;
+  size_t size = 0;
+  // Whether data is a mapping (to be unmapped) or fallback storage below.
+  bool mapped = false;
+  std::vector<char> fallback;
+};
+
 class Output {
 public:
   // An empty filename or "-" will open stdout instead.
@@ -17,6 +17,8 @@
 #ifndef wasm_support_hash_h
 #define wasm_support_hash_h
 
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <stdint.h>
 
@@ -48,6 +50,98 @@ template<typename T> inline void rehash(std::size_t& digest, const T& value) {
   hash_combine(digest, hash(value));
 }
 
+// A fast non-cryptographic 64-bit hash over bulk bytes, for digesting
+// serialized modules and similar large buffers where rehash() (which mixes a
+// word at a time through std::hash) is too slow. The mixing step folds a
+// 128-bit product, as in xxh3/wyhash, and the main loop runs two independent
+// lanes so the multiplies pipeline. Streaming: the digest of a buffer does
+// not depend on how it is split across update() calls.
+class FastHasher {
+public:
+  FastHasher(uint64_t seed = 0) : h1(seed ^ Prime1), h2(seed ^ Prime2) {}
+
+  void update(const void* data, size_t size) {
+    auto* p = static_cast<const unsigned char*>(data);
+    total += size;
+    // Top up a partial block from a previous update, if any.
+    if (buffered) {
+      auto take = std::min(size, BlockSize - buffered);
+      memcpy(buffer + buffered, p, take);
+      buffered += take;
+      p += take;
+      size -= take;
+      if (buffered < BlockSize) {
+        return;
+      }
+      consumeBlock(buffer);
+      buffered = 0;
+    }
+    while (size >= BlockSize) {
+      consumeBlock(p);
+      p += BlockSize;
+      size -= BlockSize;
+    }
+    memcpy(buffer, p, size);
+    buffered = size;
+  }
+
+  uint64_t finish() {
+    auto h = mix(h1 ^ h2, Prime1);
+    size_t i = 0;
+    if (buffered >= 8) {
+      uint64_t a;
+      memcpy(&a, buffer, 8);
+      h = mix(a ^ h, Prime2);
+      i = 8;
+    }
+    uint64_t tail = 0;
+    for (; i < buffered; i++) {
+      tail = (tail << 8) | buffer[i];
+    }
+    h = mix(h ^ tail, Prime1);
+    return mix(h ^ total, Prime2);
+  }
+
+private:
+  static const size_t BlockSize = 16;
+  static const uint64_t Prime1 = 0x9e3779b97f4a7c15ull;
+  static const uint64_t Prime2 = 0xff51afd7ed558ccdull;
+
+  uint64_t h1, h2;
+  uint64_t total = 0;
+  unsigned char buffer[BlockSize];
+  size_t buffered = 0;
+
+  static uint64_t mix(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+    __uint128_t m = __uint128_t(a) * b;
+    return uint64_t(m) ^ uint64_t(m >> 64);
+#else
+    // Portable fallback: combine the partial 32x32 products, approximating
+    // the xor of the 128-bit product's halves.
+    uint64_t lo = (a & 0xffffffff) * (b & 0xffffffff);
+    uint64_t hi = (a >> 32) * (b >> 32);
+    uint64_t mid = (a >> 32) * (b & 0xffffffff) + (a & 0xffffffff) * (b >> 32);
+    return lo ^ hi ^ (mid << 32) ^ (mid >> 32);
+#endif
+  }
+
+  void consumeBlock(const unsigned char* p) {
+    uint64_t a, b;
+    memcpy(&a, p, 8);
+    memcpy(&b, p + 8, 8);
+    h1 = mix(a ^ h1, Prime1);
+    h2 = mix(b ^ h2, Prime2);
+  }
+};
+
+// One-shot convenience form of FastHasher.
+inline uint64_t fastHash(const void* data, size_t size, uint64_t seed = 0) {
+  FastHasher hasher(seed);
+  hasher.update(data, size);
+  return hasher.finish();
+}
+
 } // namespace wasm
 
 namespace std {
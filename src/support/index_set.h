@@ -0,0 +1,250 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// A set of indexes, which is usually small. While small it is stored as a
+// sorted vector, which is compact and fast to compare, merge, and iterate.
+// Once the set grows past a limit - which in practice only happens in
+// functions with a great many locals - it switches to a dense bitset of
+// uint64_t words, where insertion and lookup are O(1) and merging is
+// word-parallel. This keeps liveness computation reasonable on generated
+// code with tens of thousands of locals, without pessimizing the common
+// case of small sets.
+//
+
+#ifndef wasm_support_index_set_h
+#define wasm_support_index_set_h
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "support/bits.h"
+#include "support/sorted_vector.h"
+
+namespace wasm {
+
+struct IndexSet {
+  // The number of elements above which we switch to the dense representation.
+  static const size_t SparseLimit = 128;
+
+private:
+  // Exactly one representation is active at a time: if |words| is non-empty
+  // we are dense, otherwise sparse. As in SmallSet, erasing elements from a
+  // dense set does not switch back until the set becomes empty, to avoid
+  // thrashing between representations.
+  SortedVector sparse;
+  std::vector<uint64_t> words;
+
+  // The number of elements, when dense (so that size() is O(1) either way).
+  size_t denseCount = 0;
+
+  bool isDense() const { return !words.empty(); }
+
+  void setBit(Index x) {
+    size_t word = x >> 6;
+    if (word >= words.size()) {
+      words.resize(word + 1);
+    }
+    uint64_t bit = uint64_t(1) << (x & 63);
+    if (!(words[word] & bit)) {
+      words[word] |= bit;
+      denseCount++;
+    }
+  }
+
+  void densify() {
+    assert(!sparse.empty());
+    words.resize((sparse.back() >> 6) + 1);
+    for (auto x : sparse) {
+      words[x >> 6] |= uint64_t(1) << (x & 63);
+    }
+    denseCount = sparse.size();
+    sparse.clear();
+  }
+
+  // Finds the first set bit at or after position |i|, or one past the last
+  // possible bit if there is none (which is what end() uses).
+  size_t scanForBit(size_t i) const {
+    size_t word = i >> 6;
+    if (word < words.size()) {
+      if (auto w = words[word] >> (i & 63)) {
+        return i + Bits::countTrailingZeroes(w);
+      }
+      for (word++; word < words.size(); word++) {
+        if (words[word]) {
+          return (word << 6) + Bits::countTrailingZeroes(words[word]);
+        }
+      }
+    }
+    return words.size() << 6;
+  }
+
+public:
+  IndexSet() = default;
+
+  void insert(Index x) {
+    if (!isDense()) {
+      sparse.insert(x);
+      if (sparse.size() > SparseLimit) {
+        densify();
+      }
+      return;
+    }
+    setBit(x);
+  }
+
+  bool erase(Index x) {
+    if (!isDense()) {
+      return sparse.erase(x);
+    }
+    size_t word = x >> 6;
+    if (word >= words.size()) {
+      return false;
+    }
+    uint64_t bit = uint64_t(1) << (x & 63);
+    if (!(words[word] & bit)) {
+      return false;
+    }
+    words[word] &= ~bit;
+    if (--denseCount == 0) {
+      // The set is empty; return to the sparse representation.
+      words.clear();
+    }
+    return true;
+  }
+
+  bool has(Index x) const {
+    if (!isDense()) {
+      return sparse.has(x);
+    }
+    size_t word = x >> 6;
+    return word < words.size() && ((words[word] >> (x & 63)) & 1);
+  }
+
+  size_t size() const { return isDense() ? denseCount : sparse.size(); }
+
+  bool empty() const { return size() == 0; }
+
+  // Returns the union of this set and another, without modifying either.
+  IndexSet merge(const IndexSet& other) const {
+    IndexSet ret;
+    if (!isDense() && !other.isDense()) {
+      ret.sparse = sparse.merge(other.sparse);
+      if (ret.sparse.size() > SparseLimit) {
+        ret.densify();
+      }
+      return ret;
+    }
+    // At least one side is dense, so the result is as well.
+    const IndexSet* dense = isDense() ? this : &other;
+    const IndexSet* mixed = isDense() ? &other : this;
+    ret.words = dense->words;
+    ret.denseCount = dense->denseCount;
+    if (mixed->isDense()) {
+      // Union the words in parallel, then recount.
+      if (mixed->words.size() > ret.words.size()) {
+        ret.words.resize(mixed->words.size());
+      }
+      for (size_t i = 0; i < mixed->words.size(); i++) {
+        ret.words[i] |= mixed->words[i];
+      }
+      ret.denseCount = 0;
+      for (auto w : ret.words) {
+        ret.denseCount += Bits::popCount(w);
+      }
+    } else {
+      for (auto x : mixed->sparse) {
+        ret.setBit(x);
+      }
+    }
+    return ret;
+  }
+
+  bool operator==(const IndexSet& other) const {
+    if (size() != other.size()) {
+      return false;
+    }
+    if (!isDense() && !other.isDense()) {
+      return sparse == other.sparse;
+    }
+    if (isDense() && other.isDense()) {
+      // Equal sets may differ in trailing zero words, if elements near the
+      // end were erased from one of them.
+      auto common = std::min(words.size(), other.words.size());
+      for (size_t i = 0; i < common; i++) {
+        if (words[i] != other.words[i]) {
+          return false;
+        }
+      }
+      auto& longer = words.size() > common ? words : other.words;
+      for (size_t i = common; i < longer.size(); i++) {
+        if (longer[i]) {
+          return false;
+        }
+      }
+      return true;
+    }
+    // One of each: as the sizes match, it is enough to check containment of
+    // the sparse elements in the dense set.
+    const IndexSet* sparseSide = isDense() ? &other : this;
+    const IndexSet* denseSide = isDense() ? this : &other;
+    for (auto x : sparseSide->sparse) {
+      if (!denseSide->has(x)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool operator!=(const IndexSet& other) const { return !(*this == other); }
+
+  // Iteration, in increasing index order in both representations. |i| is a
+  // position in the sorted vector when sparse, and a bit position when dense.
+  struct Iterator {
+    const IndexSet* parent;
+    size_t i;
+
+    Iterator(const IndexSet* parent, size_t i) : parent(parent), i(i) {}
+
+    bool operator==(const Iterator& other) const { return i == other.i; }
+    bool operator!=(const Iterator& other) const { return i != other.i; }
+
+    Index operator*() const {
+      return parent->isDense() ? Index(i) : parent->sparse[i];
+    }
+
+    Iterator& operator++() {
+      i++;
+      if (parent->isDense()) {
+        i = parent->scanForBit(i);
+      }
+      return *this;
+    }
+  };
+
+  Iterator begin() const {
+    return Iterator(this, isDense() ? scanForBit(0) : 0);
+  }
+  Iterator end() const {
+    return Iterator(this, isDense() ? (words.size() << 6) : sparse.size());
+  }
+};
+
+} // namespace wasm
+
+#endif // wasm_support_index_set_h
@@ -90,6 +90,19 @@ public:
     }
   }
 
+  template<typename InputIt> void insert(InputIt first, InputIt last) {
+    while (first != last) {
+      insert(*first);
+      ++first;
+    }
+  }
+
+  void swap(SmallSetBase<T, N, FlexibleSet>& other) {
+    std::swap(usedFixed, other.usedFixed);
+    std::swap(fixed, other.fixed);
+    flexible.swap(other.flexible);
+  }
+
   void erase(const T& x) {
     if (usingFixed()) {
       for (size_t i = 0; i < usedFixed; i++) {
@@ -25,6 +25,7 @@
 #include <array>
 #include <cassert>
 #include <iterator>
+#include <utility>
 #include <vector>
 
 namespace wasm {
@@ -68,6 +69,14 @@ public:
     }
   }
 
+  void push_back(T&& x) {
+    if (usedFixed < N) {
+      fixed[usedFixed++] = std::move(x);
+    } else {
+      flexible.push_back(std::move(x));
+    }
+  }
+
   template<typename... ArgTypes> void emplace_back(ArgTypes&&... Args) {
     if (usedFixed < N) {
       new (&fixed[usedFixed++]) T(std::forward<ArgTypes>(Args)...);
@@ -16,6 +16,10 @@
 
 #include <assert.h>
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
 #include <algorithm>
 #include <iostream>
 #include <string>
@@ -45,9 +49,31 @@ static std::mutex debug;
 
 namespace wasm {
 
+// Pin the current thread to a single CPU, so that it stays on one NUMA node
+// and the arena chunks it first touches (see mixed_arena.h) remain local to
+// that node. This is opt-in via BINARYEN_NUMA=1, as pinning can hurt on
+// oversubscribed machines.
+static void maybePinThread(size_t index) {
+#ifdef __linux__
+  auto* env = getenv("BINARYEN_NUMA");
+  if (!env || !atoi(env)) {
+    return;
+  }
+  auto numCPUs = std::max(1U, std::thread::hardware_concurrency());
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(index % numCPUs, &set);
+  // Best-effort: ignore failures, e.g. from a restricted cpuset.
+  sched_setaffinity(0, sizeof(set), &set);
+#else
+  WASM_UNUSED(index);
+#endif
+}
+
 // Thread
 
-Thread::Thread(ThreadPool* parent) : parent(parent) {
+Thread::Thread(ThreadPool* parent, size_t index)
+  : parent(parent), index(index) {
   assert(!parent->isRunning());
   thread = make_unique<std::thread>(mainLoop, this);
 }
@@ -76,6 +102,7 @@ void Thread::work(std::function<ThreadWorkState()> doWork_) {
 
 void Thread::mainLoop(void* self_) {
   auto* self = static_cast<Thread*>(self_);
+  maybePinThread(self->index);
   while (1) {
     DEBUG_THREAD("checking for work\n");
     {
@@ -124,7 +151,7 @@ void ThreadPool::initialize(size_t num) {
   resetThreadsAreReady();
   for (size_t i = 0; i < num; i++) {
     try {
-      threads.emplace_back(make_unique<Thread>(this));
+      threads.emplace_back(make_unique<Thread>(this, i));
     } catch (std::system_error&) {
       // failed to create a thread - don't use multithreading, as if num cores
       // == 1
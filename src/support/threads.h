@@ -47,6 +47,8 @@ class ThreadPool;
 
 class Thread {
   ThreadPool* parent;
+  // Our index among the helper threads in the pool.
+  size_t index;
   std::unique_ptr<std::thread> thread;
   std::mutex mutex;
   std::condition_variable condition;
@@ -54,7 +56,7 @@ class Thread {
   std::function<ThreadWorkState()> doWork = nullptr;
 
 public:
-  Thread(ThreadPool* parent);
+  Thread(ThreadPool* parent, size_t index);
   ~Thread();
 
   // Start to do work, calling doWork() until
@@ -24,9 +24,11 @@
 #define wasm_support_unique_deferring_queue_h
 
 #include <cassert>
+#include <cstdint>
 #include <queue>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace wasm {
 
@@ -67,6 +69,84 @@ template<typename T> struct UniqueDeferredQueue {
   }
 };
 
+// As UniqueDeferredQueue, but specialized for items that are small dense
+// indexes (e.g. type or basic block indexes). The storage is a flat ring
+// buffer instead of a std::queue of deque chunks, and the duplicate counts
+// live in a dense epoch-stamped array instead of a hash map, so the hot
+// push/pop path does no allocation or hashing. clear() is O(1): bumping the
+// epoch invalidates all stamps at once.
+template<typename T> struct UniqueDeferredIndexQueue {
+  // The ring buffer. The capacity is always a power of 2; head and tail are
+  // absolute positions, masked on access, so tail - head is the size.
+  std::vector<T> ring;
+  size_t head = 0;
+  size_t tail = 0;
+
+  // How many times each index appears in the ring, as in
+  // UniqueDeferredQueue::count. A count is only valid if its stamp matches
+  // the current epoch; anything else reads as zero.
+  std::vector<uint32_t> counts;
+  std::vector<uint32_t> stamps;
+  uint32_t epoch = 1;
+
+  size_t size() { return tail - head; }
+  bool empty() { return size() == 0; }
+
+  void push(T item) {
+    auto index = size_t(item);
+    if (index >= counts.size()) {
+      counts.resize(index + 1);
+      stamps.resize(index + 1);
+    }
+    if (stamps[index] != epoch) {
+      stamps[index] = epoch;
+      counts[index] = 0;
+    }
+    counts[index]++;
+    if (tail - head == ring.size()) {
+      grow();
+    }
+    ring[tail & (ring.size() - 1)] = item;
+    tail++;
+  }
+
+  T pop() {
+    while (1) {
+      assert(!empty());
+      T item = ring[head & (ring.size() - 1)];
+      head++;
+      if (--counts[size_t(item)] == 0) {
+        return item;
+      }
+      // skip this one, keep going
+    }
+  }
+
+  void clear() {
+    head = tail = 0;
+    epoch++;
+    if (epoch == 0) {
+      // The epoch wrapped around, so old stamps could be mistaken for current
+      // ones; clear them for real, and start over.
+      std::fill(stamps.begin(), stamps.end(), 0);
+      epoch = 1;
+    }
+  }
+
+private:
+  void grow() {
+    const size_t InitialCapacity = 16;
+    std::vector<T> grown(ring.empty() ? InitialCapacity : ring.size() * 2);
+    auto count = tail - head;
+    for (size_t i = 0; i < count; i++) {
+      grown[i] = ring[(head + i) & (ring.size() - 1)];
+    }
+    ring.swap(grown);
+    head = 0;
+    tail = count;
+  }
+};
+
 // As UniqueDeferredQueue, but once an item has been processed through the queue
 // (that is, popped) it will be ignored from then on in later pushes.
 template<typename T>
@@ -20,6 +20,10 @@
 #include <cstdlib>
 #include <iostream>
 
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
 #if __has_feature(address_sanitizer) || defined(__SANITIZE_ADDRESS__)
 #include "sanitizer/common_interface_defs.h"
 #endif
@@ -42,3 +46,20 @@ wasm::handle_unreachable(const char* msg, const char* file, unsigned line) {
 #endif
   abort();
 }
+
+size_t wasm::getPeakRSS() {
+#ifdef _WIN32
+  return 0;
+#else
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#ifdef __APPLE__
+  // ru_maxrss is in bytes on macOS, and in kilobytes elsewhere.
+  return size_t(usage.ru_maxrss);
+#else
+  return size_t(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
@@ -81,6 +81,10 @@ public:
                                      const char* file = nullptr,
                                      unsigned line = 0);
 
+// The peak resident set size of the process so far, in bytes, or 0 where we
+// have no way to measure it. Used for profiling.
+size_t getPeakRSS();
+
 // If control flow reaches the point of the WASM_UNREACHABLE(), the program is
 // undefined.
 #ifndef NDEBUG
@@ -0,0 +1,238 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Microbenchmarks for core data structures and algorithms: LEB coding, type
+// interning, effect analysis, local flow analysis, and IR traversal. Run
+// against a corpus .wasm file so the numbers reflect real code shapes, e.g.
+//
+//   binaryen-bench corpus.wasm
+//
+// This is meant for measuring the impact of changes to the core, and for
+// bisecting performance regressions; the absolute numbers depend on the
+// machine and the corpus, so only compare runs of the same corpus on the
+// same machine.
+//
+
+#include <chrono>
+
+#include "ir/effects.h"
+#include "ir/local-graph.h"
+#include "support/colors.h"
+#include "wasm-binary.h"
+#include "wasm-io.h"
+#include "wasm-traversal.h"
+#include "wasm-type.h"
+
+#include "tool-options.h"
+
+using namespace wasm;
+
+namespace {
+
+// A simple deterministic PRNG (xorshift64), so that every run benchmarks the
+// same values.
+struct DeterministicRandom {
+  uint64_t state = 0x2545F4914F6CDD1Dull;
+
+  uint64_t next() {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+  }
+};
+
+// Runs a benchmark body |reps| times and reports the total and per-rep time.
+// The body returns a checksum, which we print, both to prevent the work from
+// being optimized out and to allow a quick sanity check that two builds being
+// compared actually did the same work.
+template<typename F>
+void bench(const std::string& name, size_t reps, F body) {
+  // One untimed warmup rep, to fault in memory and warm up caches.
+  uint64_t checksum = body();
+  auto before = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < reps; i++) {
+    checksum += body();
+  }
+  auto after = std::chrono::steady_clock::now();
+  double seconds = std::chrono::duration<double>(after - before).count();
+  std::cout << name << ": " << (seconds * 1e3) << " ms total, "
+            << (seconds * 1e3 / reps) << " ms/rep over " << reps
+            << " reps [checksum " << checksum << "]\n";
+}
+
+uint64_t benchLEBEncoding(std::vector<uint8_t>& buffer,
+                          const std::vector<uint64_t>& values) {
+  buffer.clear();
+  for (auto value : values) {
+    U32LEB(uint32_t(value)).write(&buffer);
+    S32LEB(int32_t(value)).write(&buffer);
+    U64LEB(value).write(&buffer);
+    S64LEB(int64_t(value)).write(&buffer);
+  }
+  return buffer.size();
+}
+
+uint64_t benchLEBDecoding(const std::vector<uint8_t>& buffer, size_t count) {
+  size_t pos = 0;
+  auto get = [&]() { return buffer[pos++]; };
+  auto getSigned = [&]() { return int8_t(buffer[pos++]); };
+  uint64_t checksum = 0;
+  for (size_t i = 0; i < count; i++) {
+    checksum += U32LEB().read(get).value;
+    checksum += uint64_t(S32LEB().read(getSigned).value);
+    checksum += U64LEB().read(get).value;
+    checksum += uint64_t(S64LEB().read(getSigned).value);
+  }
+  return checksum;
+}
+
+uint64_t benchTypeInterning(size_t count) {
+  // Build tuple types out of a small pool of element types. After the first
+  // rep these all exist in the global type store, so this measures the
+  // canonicalization lookup, which is the hot path when parsing and
+  // optimizing (genuinely new types are rare in comparison).
+  Type pool[] = {Type::i32, Type::i64, Type::f32, Type::f64};
+  DeterministicRandom random;
+  uint64_t checksum = 0;
+  for (size_t i = 0; i < count; i++) {
+    auto bits = random.next();
+    Type tuple(
+      {pool[bits & 3], pool[(bits >> 2) & 3], pool[(bits >> 4) & 3]});
+    checksum += tuple.getID();
+  }
+  return checksum;
+}
+
+uint64_t benchEffectAnalyzer(Module& wasm, const PassOptions& passOptions) {
+  uint64_t checksum = 0;
+  for (auto& func : wasm.functions) {
+    if (func->imported()) {
+      continue;
+    }
+    EffectAnalyzer effects(passOptions, wasm, func->body);
+    checksum += effects.hasSideEffects() + 2 * effects.calls +
+                4 * effects.readsMemory + 8 * effects.writesMemory;
+  }
+  return checksum;
+}
+
+uint64_t benchLocalGraph(Module& wasm) {
+  uint64_t checksum = 0;
+  for (auto& func : wasm.functions) {
+    if (func->imported()) {
+      continue;
+    }
+    LocalGraph graph(func.get());
+    checksum += graph.getSetses.size();
+  }
+  return checksum;
+}
+
+uint64_t benchWalker(Module& wasm) {
+  struct Counter : PostWalker<Counter, UnifiedExpressionVisitor<Counter>> {
+    uint64_t count = 0;
+    void visitExpression(Expression* curr) { count++; }
+  };
+  uint64_t checksum = 0;
+  for (auto& func : wasm.functions) {
+    if (func->imported()) {
+      continue;
+    }
+    Counter counter;
+    counter.walk(func->body);
+    checksum += counter.count;
+  }
+  return checksum;
+}
+
+} // anonymous namespace
+
+int main(int argc, const char* argv[]) {
+  size_t reps = 10;
+  size_t lebCount = 1000000;
+
+  const std::string BenchOption = "binaryen-bench options";
+
+  ToolOptions options(
+    "binaryen-bench",
+    "Run microbenchmarks of core data structures against a corpus .wasm "
+    "file");
+  options
+    .add("--reps",
+         "-r",
+         "Number of timed repetitions of each benchmark (default 10)",
+         BenchOption,
+         Options::Arguments::One,
+         [&reps](Options* o, const std::string& argument) {
+           reps = std::max(1, atoi(argument.c_str()));
+         })
+    .add_positional("INFILE",
+                    Options::Arguments::One,
+                    [](Options* o, const std::string& argument) {
+                      o->extra["infile"] = argument;
+                    });
+  options.parse(argc, argv);
+
+  Module wasm;
+  options.applyFeatures(wasm);
+  try {
+    ModuleReader().read(options.extra["infile"], wasm);
+  } catch (ParseException& p) {
+    p.dump(std::cerr);
+    std::cerr << '\n';
+    Fatal() << "error in parsing input";
+  }
+
+  // LEB coding, on pseudo-random values. Small values dominate in real
+  // binaries (immediates, indexes), so bias towards them: a third of the
+  // values fit in a single LEB byte.
+  std::vector<uint64_t> lebValues;
+  lebValues.reserve(lebCount);
+  DeterministicRandom random;
+  for (size_t i = 0; i < lebCount; i++) {
+    auto value = random.next();
+    switch (i % 3) {
+      case 0:
+        value &= 63;
+        break;
+      case 1:
+        value &= 0xffffff;
+        break;
+      default:
+        break;
+    }
+    lebValues.push_back(value);
+  }
+  std::vector<uint8_t> lebBuffer;
+  bench("leb-encode", reps, [&]() {
+    return benchLEBEncoding(lebBuffer, lebValues);
+  });
+  bench("leb-decode", reps, [&]() {
+    return benchLEBDecoding(lebBuffer, lebValues.size());
+  });
+
+  bench("type-interning", reps, [&]() { return benchTypeInterning(lebCount); });
+
+  bench("effect-analyzer", reps, [&]() {
+    return benchEffectAnalyzer(wasm, options.passOptions);
+  });
+
+  bench("local-graph", reps, [&]() { return benchLocalGraph(wasm); });
+
+  bench("walker", reps, [&]() { return benchWalker(wasm); });
+}
@@ -18,7 +18,11 @@
 // Shared execution result checking code
 //
 
+#include <atomic>
+#include <thread>
+
 #include "shell-interface.h"
+#include "support/threads.h"
 #include "wasm.h"
 
 namespace wasm {
@@ -29,6 +33,10 @@ typedef std::vector<Literal> Loggings;
 struct LoggingExternalInterface : public ShellExternalInterface {
   Loggings& loggings;
 
+  // Whether to print the loggings as they happen. The loggings are recorded
+  // either way, for later comparison.
+  bool verbose;
+
   struct State {
     // Legalization for JS emits get/setTempRet0 calls ("temp ret 0" means a
     // temporary return value of 32 bits; "0" is the only important value for
@@ -37,11 +45,14 @@ struct LoggingExternalInterface : public ShellExternalInterface {
     uint32_t tempRet0 = 0;
   } state;
 
-  LoggingExternalInterface(Loggings& loggings) : loggings(loggings) {}
+  LoggingExternalInterface(Loggings& loggings, bool verbose = true)
+    : loggings(loggings), verbose(verbose) {}
 
   Literals callImport(Function* import, Literals& arguments) override {
     if (import->module == "fuzzing-support") {
-      std::cout << "[LoggingExternalInterface logging";
+      if (verbose) {
+        std::cout << "[LoggingExternalInterface logging";
+      }
       loggings.push_back(Literal()); // buffer with a None between calls
       for (auto argument : arguments) {
         if (argument.type == Type::i64) {
@@ -50,24 +61,31 @@ struct LoggingExternalInterface : public ShellExternalInterface {
           // into).
           auto low = Literal(int32_t(argument.getInteger()));
           auto high = Literal(int32_t(argument.getInteger() >> int32_t(32)));
-          std::cout << ' ' << low;
+          if (verbose) {
+            std::cout << ' ' << low << ' ' << high;
+          }
           loggings.push_back(low);
-          std::cout << ' ' << high;
           loggings.push_back(high);
         } else {
-          std::cout << ' ' << argument;
+          if (verbose) {
+            std::cout << ' ' << argument;
+          }
           loggings.push_back(argument);
         }
       }
-      std::cout << "]\n";
+      if (verbose) {
+        std::cout << "]\n";
+      }
       return {};
     } else if (import->module == ENV) {
       if (import->base == "log_execution") {
-        std::cout << "[LoggingExternalInterface log-execution";
-        for (auto argument : arguments) {
-          std::cout << ' ' << argument;
+        if (verbose) {
+          std::cout << "[LoggingExternalInterface log-execution";
+          for (auto argument : arguments) {
+            std::cout << ' ' << argument;
+          }
+          std::cout << "]\n";
         }
-        std::cout << "]\n";
         return {};
       } else if (import->base == "setTempRet0") {
         state.tempRet0 = arguments[0].geti32();
@@ -93,10 +111,26 @@ struct ExecutionResults {
   std::map<Name, FunctionResult> results;
   Loggings loggings;
 
-  // If set, we should ignore this and not compare it to anything.
-  bool ignore = false;
+  // If set, we should ignore this and not compare it to anything. Atomic, as
+  // in parallel mode several export workers may hit a host limit at once.
+  std::atomic<bool> ignore{false};
   // If set, we don't compare whether a trap has occurred or not.
   bool ignoreTrap = false;
+  // Whether to narrate execution on stdout. The in-process fuzzing loop
+  // (wasm-opt --fuzz-loop) disables this, as it compares results structurally
+  // and runs many modules at once, possibly on several threads.
+  bool verbose = true;
+  // Whether to evaluate each export in its own isolated instance, on worker
+  // threads. This changes what executions observe - exports no longer see
+  // state left behind by earlier exports - so both sides of a comparison must
+  // use the same mode. Implies non-verbose execution.
+  bool parallelExports = false;
+  // If nonzero, a budget on the number of expressions each export may
+  // execute. An export that runs out is treated like any other host limit
+  // (the comparison is ignored), which keeps the budget deterministic, unlike
+  // a wall-clock timeout: optimizations are expected to change how much an
+  // export executes, but the same code always stops at the same point.
+  Index exportFuel = 0;
 
   ExecutionResults(const PassOptions& options)
     : ignoreTrap(options.ignoreImplicitTraps || options.trapsNeverHappen) {}
@@ -104,7 +138,11 @@ struct ExecutionResults {
 
   // get results of execution
   void get(Module& wasm) {
-    LoggingExternalInterface interface(loggings);
+    if (parallelExports) {
+      getParallel(wasm);
+      return;
+    }
+    LoggingExternalInterface interface(loggings, verbose);
     try {
       ModuleRunner instance(wasm, &interface);
       // execute all exported methods (that are therefore preserved through
@@ -113,11 +151,17 @@ struct ExecutionResults {
         if (exp->kind != ExternalKind::Function) {
           continue;
         }
-        std::cout << "[fuzz-exec] calling " << exp->name << "\n";
+        if (verbose) {
+          std::cout << "[fuzz-exec] calling " << exp->name << "\n";
+        }
         auto* func = wasm.getFunction(exp->value);
+        if (exportFuel) {
+          instance.setMaxFuel(exportFuel);
+        }
         FunctionResult ret = run(func, wasm, instance);
         results[exp->name] = ret;
-        if (auto* values = std::get_if<Literals>(&ret)) {
+        auto* values = std::get_if<Literals>(&ret);
+        if (verbose && values) {
           // ignore the result if we hit an unreachable and returned no value
           if (values->size() > 0) {
             std::cout << "[fuzz-exec] note result: " << exp->name << " => ";
@@ -138,9 +182,69 @@ struct ExecutionResults {
     }
   }
 
+  // Evaluates each export in its own isolated instance, claiming exports from
+  // a shared counter on a small pool of threads. The merged results are
+  // deterministic - workers fill per-export slots, which are combined in
+  // export order - but differ from the serial mode above, where exports
+  // observe the state earlier exports left behind in the shared instance.
+  void getParallel(Module& wasm) {
+    // Workers must not narrate interleaved output.
+    verbose = false;
+    std::vector<Export*> functionExports;
+    for (auto& exp : wasm.exports) {
+      if (exp->kind == ExternalKind::Function) {
+        functionExports.push_back(exp.get());
+      }
+    }
+    std::vector<FunctionResult> exportResults(functionExports.size());
+    std::vector<Loggings> exportLoggings(functionExports.size());
+    std::atomic<size_t> nextExport(0);
+    auto worker = [&]() {
+      while (1) {
+        auto i = nextExport.fetch_add(1);
+        if (i >= functionExports.size()) {
+          return;
+        }
+        LoggingExternalInterface interface(exportLoggings[i], false);
+        try {
+          ModuleRunner instance(wasm, &interface);
+          if (exportFuel) {
+            instance.setMaxFuel(exportFuel);
+          }
+          auto* func = wasm.getFunction(functionExports[i]->value);
+          exportResults[i] = run(func, wasm, instance);
+        } catch (const TrapException&) {
+          // may throw in instance creation (init of offsets)
+        }
+      }
+    };
+    auto numThreads =
+      std::min(functionExports.size(), ThreadPool::getNumCores());
+    if (numThreads <= 1) {
+      worker();
+    } else {
+      std::vector<std::unique_ptr<std::thread>> threads;
+      for (size_t t = 0; t < numThreads; t++) {
+        threads.emplace_back(std::make_unique<std::thread>(worker));
+      }
+      for (auto& thread : threads) {
+        thread->join();
+      }
+    }
+    for (size_t i = 0; i < functionExports.size(); i++) {
+      results[functionExports[i]->name] = exportResults[i];
+      for (auto& logging : exportLoggings[i]) {
+        loggings.push_back(logging);
+      }
+    }
+  }
+
   // get current results and check them against previous ones
   void check(Module& wasm) {
     ExecutionResults optimizedResults(ignoreTrap);
+    optimizedResults.verbose = verbose;
+    optimizedResults.parallelExports = parallelExports;
+    optimizedResults.exportFuel = exportFuel;
     optimizedResults.get(wasm);
     if (optimizedResults != *this) {
       std::cout << "[fuzz-exec] optimization passes changed results\n";
@@ -190,9 +294,60 @@ struct ExecutionResults {
     return true;
   }
 
+  // Hashes a result with the same tolerance as areEqual below: nulls hash
+  // alike regardless of type, and other references hash only their type.
+  size_t hashResult(const Literal& a) {
+    if (a.isNone()) {
+      // the None separators between loggings
+      return 0;
+    }
+    if (a.isNull()) {
+      return 1;
+    }
+    auto digest = wasm::hash(a.type);
+    if (!a.type.isRef()) {
+      rehash(digest, a);
+    }
+    return digest;
+  }
+
+  // Computes a digest of all results and loggings. Equal digests let the
+  // comparison below exit early, skipping the per-literal comparison chains
+  // in the common, passing case; unequal digests fall through to the full
+  // comparison, so a hash collision can at most hide a mismatch, never
+  // invent one.
+  size_t hash() {
+    auto digest = wasm::hash(results.size());
+    for (auto& [name, result] : results) {
+      rehash(digest, name);
+      rehash(digest, result.index());
+      if (auto* values = std::get_if<Literals>(&result)) {
+        rehash(digest, values->size());
+        for (auto& value : *values) {
+          hash_combine(digest, hashResult(value));
+        }
+      }
+    }
+    rehash(digest, loggings.size());
+    for (auto& value : loggings) {
+      hash_combine(digest, hashResult(value));
+    }
+    return digest;
+  }
+
   bool operator==(ExecutionResults& other) {
     if (ignore || other.ignore) {
-      std::cout << "ignoring comparison of ExecutionResults!\n";
+      if (verbose) {
+        std::cout << "ignoring comparison of ExecutionResults!\n";
+      }
+      return true;
+    }
+    // Fast path: identical digests mean identical results, modulo hash
+    // collisions, which can only cause a missed mismatch and are vanishingly
+    // rare. On a mismatch we fall through for the full comparison, which also
+    // prints what differs. Only taken when not verbose, as the full
+    // comparison also narrates each export it compares.
+    if (!verbose && hash() == other.hash()) {
       return true;
     }
     for (auto& [name, _] : other.results) {
@@ -200,7 +355,9 @@ struct ExecutionResults {
         std::cout << "[fuzz-exec] missing " << name << '\n';
         return false;
       }
-      std::cout << "[fuzz-exec] comparing " << name << '\n';
+      if (verbose) {
+        std::cout << "[fuzz-exec] comparing " << name << '\n';
+      }
       if (results[name].index() != other.results[name].index()) {
         if (ignoreTrap) {
           if (!std::get_if<Trap>(&results[name]) &&
@@ -232,7 +389,7 @@ struct ExecutionResults {
   bool operator!=(ExecutionResults& other) { return !((*this) == other); }
 
   FunctionResult run(Function* func, Module& wasm) {
-    LoggingExternalInterface interface(loggings);
+    LoggingExternalInterface interface(loggings, verbose);
     try {
       ModuleRunner instance(wasm, &interface);
       return run(func, wasm, instance);
@@ -253,8 +410,10 @@ struct ExecutionResults {
       for (const auto& param : func->getParams()) {
         // zeros in arguments TODO: more?
         if (!param.isDefaultable()) {
-          std::cout << "[trap fuzzer can only send defaultable parameters to "
-                       "exports]\n";
+          if (verbose) {
+            std::cout << "[trap fuzzer can only send defaultable parameters "
+                         "to exports]\n";
+          }
           return Trap{};
         }
         arguments.push_back(Literal::makeZero(param));
@@ -263,7 +422,9 @@ struct ExecutionResults {
     } catch (const TrapException&) {
       return Trap{};
     } catch (const WasmException& e) {
-      std::cout << "[exception thrown: " << e << "]" << std::endl;
+      if (verbose) {
+        std::cout << "[exception thrown: " << e << "]" << std::endl;
+      }
       return Exception{};
     } catch (const HostLimitException&) {
       // This should be ignored and not compared with, as optimizations can
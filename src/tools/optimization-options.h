@@ -17,6 +17,9 @@
 #ifndef wasm_tools_optimization_options_h
 #define wasm_tools_optimization_options_h
 
+#include <chrono>
+#include <fstream>
+
 #include "tool-options.h"
 
 //
@@ -32,6 +35,23 @@ struct OptimizationOptions : public ToolOptions {
 
   std::vector<std::string> passes;
 
+  // If set, function-parallel passes only run on the functions passing the
+  // filter; see PassRunner::setFunctionFilter. Used by wasm-opt --shard.
+  std::function<bool(Function*)> functionFilter;
+
+  // If set, a machine-readable report of where the time went - the major
+  // phases the tool ran (read, validate, optimize, write), each pass, and
+  // peak memory - is written to this file as JSON when the tool calls
+  // emitTimings(). See --emit-timings.
+  std::string emitTimingsFile;
+
+  // The phases timed so far, in first-seen order, with repeats summed (e.g.
+  // each iteration of wasm-opt --converge adds to "optimize").
+  std::vector<std::pair<std::string, double>> phaseTimings;
+
+  // The per-pass profiles of every runPasses() call so far.
+  std::vector<PassRunner::PassProfile> passProfile;
+
   constexpr static const char* OptimizationOptionsCategory =
     "Optimization options";
 
@@ -151,6 +171,41 @@ struct OptimizationOptions : public ToolOptions {
            [&](Options* o, const std::string& arguments) {
              passOptions.debugInfo = true;
            })
+      .add("--subtree-parallel-threshold",
+           "-spt",
+           "Size (in expression nodes) above which a single function may be "
+           "split across threads, for passes that support that (default " +
+             std::to_string(PassOptions().subtreeParallelThreshold) +
+             "; 0 disables splitting)",
+           OptimizationOptionsCategory,
+           Options::Arguments::One,
+           [this](Options* o, const std::string& argument) {
+             passOptions.subtreeParallelThreshold =
+               static_cast<Index>(atoi(argument.c_str()));
+           })
+      .add("--emit-timings",
+           "-et",
+           "Emit a JSON report of where the time went (per phase and per "
+           "pass) and of peak memory to the given file when the tool "
+           "finishes (see --profile-passes for the per-pass costs)",
+           OptimizationOptionsCategory,
+           Options::Arguments::One,
+           [this](Options* o, const std::string& argument) {
+             emitTimingsFile = argument;
+             // We need the per-pass profile, but report it in the file
+             // rather than on stderr.
+             passOptions.profilePasses = true;
+           })
+      .add("--profile-passes",
+           "-pp",
+           "Report the wall time, peak RSS growth, and IR arena growth of "
+           "each pass, as JSON on stderr (this disables fusing of "
+           "function-parallel passes, so total times may be pessimistic)",
+           OptimizationOptionsCategory,
+           Options::Arguments::Zero,
+           [this](Options* o, const std::string& arguments) {
+             passOptions.profilePasses = true;
+           })
       .add("--always-inline-max-function-size",
            "-aimfs",
            "Max size of functions that are always inlined (default " +
@@ -295,6 +350,12 @@ struct OptimizationOptions : public ToolOptions {
     if (debug) {
       passRunner.setDebug(true);
     }
+    if (functionFilter) {
+      passRunner.setFunctionFilter(functionFilter);
+    }
+    if (emitTimingsFile.size()) {
+      passRunner.setPrintProfile(false);
+    }
     for (auto& pass : passes) {
       if (pass == DEFAULT_OPT_PASSES) {
         passRunner.addDefaultOptimizationPasses();
@@ -302,7 +363,51 @@ struct OptimizationOptions : public ToolOptions {
         passRunner.add(pass);
       }
     }
-    passRunner.run();
+    timePhase("optimize", [&]() { passRunner.run(); });
+    for (auto& entry : passRunner.profile) {
+      passProfile.push_back(entry);
+    }
+  }
+
+  // Runs |body| and records its wall time under the phase |name|.
+  template<typename F> void timePhase(const char* name, F body) {
+    auto before = std::chrono::steady_clock::now();
+    body();
+    auto after = std::chrono::steady_clock::now();
+    auto seconds = std::chrono::duration<double>(after - before).count();
+    for (auto& [phase, total] : phaseTimings) {
+      if (phase == name) {
+        total += seconds;
+        return;
+      }
+    }
+    phaseTimings.emplace_back(name, seconds);
+  }
+
+  // Writes the JSON timing report, if one was requested. Call this once,
+  // when the tool is done.
+  void emitTimings() {
+    if (emitTimingsFile.empty()) {
+      return;
+    }
+    std::ofstream o(emitTimingsFile);
+    if (!o.is_open()) {
+      Fatal() << "could not open '" << emitTimingsFile << "' for writing";
+    }
+    o << "{\n  \"phases\": {";
+    for (size_t i = 0; i < phaseTimings.size(); i++) {
+      auto& [phase, seconds] = phaseTimings[i];
+      o << (i ? ", " : "") << '"' << phase << "\": " << seconds;
+    }
+    o << "},\n  \"passes\": [";
+    for (size_t i = 0; i < passProfile.size(); i++) {
+      auto& entry = passProfile[i];
+      o << (i ? ",\n    " : "\n    ") << "{\"pass\": \"" << entry.name
+        << "\", \"seconds\": " << entry.seconds
+        << ", \"peak_rss_delta\": " << entry.peakRSSDelta
+        << ", \"arena_bytes_delta\": " << entry.arenaDelta << '}';
+    }
+    o << "\n  ],\n  \"peak_rss\": " << getPeakRSS() << "\n}\n";
   }
 };
 
@@ -103,6 +103,25 @@ struct ToolOptions : public Options {
            [this](Options* o, const std::string& argument) {
              passOptions.validate = false;
            })
+      .add("--trusted-input",
+           "",
+           "The input was already validated upstream, so relaxed, less "
+           "defensive finalization may be used while optimizing",
+           ToolOptionsCategory,
+           Options::Arguments::Zero,
+           [this](Options* o, const std::string& argument) {
+             passOptions.trustedInput = true;
+           })
+      .add("--dedupe-function-work",
+           "",
+           "Optimize one representative of each group of identical functions "
+           "and copy the result to the rest. Only valid when the passes being "
+           "run depend on nothing but each function's contents",
+           ToolOptionsCategory,
+           Options::Arguments::Zero,
+           [this](Options* o, const std::string& argument) {
+             passOptions.dedupeFunctionWork = true;
+           })
       .add("--pass-arg",
            "-pa",
            "An argument passed along to optimization passes being run. Must be "
@@ -125,6 +125,14 @@ int main(int argc, const char* argv[]) {
     Fatal() << "error in parsing input";
   }
 
+  // Everything has been copied into the module (names are interned, segment
+  // contents are decoded), and the s-expression tree was freed when the parser
+  // went out of scope above, so the input text can be released now rather than
+  // staying resident while we validate and write - it can be by far the
+  // largest allocation for big text inputs.
+  input.clear();
+  input.shrink_to_fit();
+
   if (options.extra["validate"] != "none") {
     if (options.debug) {
       std::cerr << "Validating..." << std::endl;
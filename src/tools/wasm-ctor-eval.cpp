@@ -141,6 +141,13 @@ std::unique_ptr<Module> buildEnvModule(Module& wasm) {
 // that there are not arguments passed to main, etc.
 static bool ignoreExternalInput = false;
 
+// Optional budgets on evaluation (0 means no limit). When one runs out the
+// interpreter reports a host limit, which we treat like any other failure to
+// eval: we stop there and keep the remaining ctors as runtime calls, instead
+// of spinning forever on a misbehaving ctor.
+static Index evalFuel = 0;
+static double evalSeconds = 0;
+
 struct CtorEvalExternalInterface : EvallingModuleRunner::ExternalInterface {
   Module* wasm;
   EvallingModuleRunner* instance;
@@ -149,6 +156,15 @@ struct CtorEvalExternalInterface : EvallingModuleRunner::ExternalInterface {
   // A representation of the contents of wasm memory as we execute.
   std::vector<char> memory;
 
+  // The size of the chunks in which we track whether memory has been written.
+  // We apply memory contents to the module after every successful chunk of
+  // evalling, and almost all of a large memory is unchanged from one apply to
+  // the next, so we copy over only the chunks written since the last apply.
+  static const size_t DirtyChunkSize = 16 * 1024;
+
+  // Which chunks of |memory| have been written since the last apply.
+  std::vector<bool> dirtyChunks;
+
   CtorEvalExternalInterface(
     std::map<Name, std::shared_ptr<EvallingModuleRunner>> linkedInstances_ =
       {}) {
@@ -358,6 +374,32 @@ struct CtorEvalExternalInterface : EvallingModuleRunner::ExternalInterface {
     doStore<int64_t>(addr, value);
   }
 
+  // Bulk operations can work on our flat memory buffer directly, and mark an
+  // entire range dirty at once.
+  void memorySet(Address destAddr, uint8_t value, Address size) override {
+    if (size > 0) {
+      memset(getMemory(destAddr, size), value, size);
+      markDirty(destAddr, size);
+    }
+  }
+  void memoryCopy(Address destAddr, Address sourceAddr, Address size) override {
+    if (size > 0) {
+      // Ensure both ranges exist before forming any pointer into the buffer,
+      // as growing it invalidates them.
+      getMemory(sourceAddr, size);
+      auto* dest = getMemory(destAddr, size);
+      memmove(dest, &memory[sourceAddr], size);
+      markDirty(destAddr, size);
+    }
+  }
+  void memoryWrite(Address destAddr, const char* source,
+                   Address size) override {
+    if (size > 0) {
+      memcpy(getMemory(destAddr, size), source, size);
+      markDirty(destAddr, size);
+    }
+  }
+
   bool growMemory(Address /*oldSize*/, Address /*newSize*/) override {
     throw FailToEvalException("grow memory");
   }
@@ -395,9 +437,30 @@ private:
     return (T*)(&memory[address]);
   }
 
+  // As above, but for a range of bytes.
+  char* getMemory(Address address, size_t size) {
+    auto max = address + size;
+    if (max > memory.size()) {
+      memory.resize(max);
+    }
+    return &memory[address];
+  }
+
   template<typename T> void doStore(Address address, T value) {
     // do a memcpy to avoid undefined behavior if unaligned
     memcpy(getMemory<T>(address), &value, sizeof(T));
+    markDirty(address, sizeof(T));
+  }
+
+  void markDirty(Address address, size_t size) {
+    size_t first = address / DirtyChunkSize;
+    size_t last = (address + size - 1) / DirtyChunkSize;
+    if (last >= dirtyChunks.size()) {
+      dirtyChunks.resize(last + 1);
+    }
+    for (size_t i = first; i <= last; i++) {
+      dirtyChunks[i] = true;
+    }
   }
 
   template<typename T> T doLoad(Address address) {
@@ -437,8 +500,23 @@ private:
     assert(segment->offset->cast<Const>()->value.getInteger() == 0);
 
     // Copy the current memory contents after execution into the Module's
-    // memory.
-    segment->data = memory;
+    // memory. The segment mirrors |memory| as of the last apply, so we only
+    // need to copy the chunks that have been written since then. (If memory
+    // was merely extended, the new region is zero-filled in both places, so
+    // resizing suffices for any bytes not explicitly stored to.)
+    auto& data = segment->data;
+    if (data.size() < memory.size()) {
+      data.resize(memory.size());
+    }
+    for (size_t i = 0; i < dirtyChunks.size(); i++) {
+      if (dirtyChunks[i]) {
+        size_t start = i * DirtyChunkSize;
+        size_t end = std::min(start + DirtyChunkSize, memory.size());
+        std::copy(
+          memory.begin() + start, memory.begin() + end, data.begin() + start);
+        dirtyChunks[i] = false;
+      }
+    }
   }
 
   // Serializing GC data requires more work than linear memory, because
@@ -800,6 +878,16 @@ void evalCtors(Module& wasm,
   try {
     // create an instance for evalling
     EvallingModuleRunner instance(wasm, &interface, linkedInstances);
+    // apply the evaluation budgets, if any, to the entire run
+    if (evalFuel) {
+      instance.setMaxFuel(evalFuel);
+    }
+    if (evalSeconds) {
+      instance.setDeadline(std::chrono::steady_clock::now() +
+                           std::chrono::duration_cast<
+                             std::chrono::steady_clock::duration>(
+                             std::chrono::duration<double>(evalSeconds)));
+    }
     // go one by one, in order, until we fail
     // TODO: if we knew priorities, we could reorder?
     for (auto& ctor : ctors) {
@@ -911,6 +999,24 @@ int main(int argc, const char* argv[]) {
       [&](Options* o, const std::string& argument) {
         keptExports = String::Split(argument, ",");
       })
+    .add("--eval-fuel",
+         "-ef",
+         "A budget on the number of expressions the evaluation may execute "
+         "in total; when it runs out we stop evalling there, deterministically",
+         WasmCtorEvalOption,
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           evalFuel = Index(std::stoul(argument));
+         })
+    .add("--eval-time-limit",
+         "-etl",
+         "A wall-clock budget on the evaluation, in seconds (fractions are "
+         "allowed); when it runs out we stop evalling there",
+         WasmCtorEvalOption,
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           evalSeconds = std::stod(argument);
+         })
     .add("--ignore-external-input",
          "-ipi",
          "Assumes no env vars are to be read, stdin is empty, etc.",
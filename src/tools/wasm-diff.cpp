@@ -0,0 +1,267 @@
+/*
+ * Copyright 2022 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// wasm-diff: Compares two modules structurally, reporting added, removed and
+// changed items plus size deltas, without disassembling to text. Function
+// bodies are compared by their hashes, computed in parallel, so even very
+// large modules diff in seconds. (A hash collision could in principle hide a
+// change, but as this is a reporting tool that tradeoff is worth the speed.)
+//
+
+#include "ir/module-utils.h"
+#include "ir/utils.h"
+#include "support/colors.h"
+#include "support/hash.h"
+#include "wasm-io.h"
+#include "wasm.h"
+
+#include "tool-options.h"
+
+using namespace wasm;
+
+namespace {
+
+// Maps each function name to a digest of everything that defines it: its
+// type, and its body (or import location). Computed in parallel.
+using FunctionHashes = std::map<Name, size_t>;
+
+FunctionHashes computeFunctionHashes(Module& wasm) {
+  ModuleUtils::ParallelFunctionAnalysis<size_t> analysis(
+    wasm, [](Function* func, size_t& digest) {
+      digest = hash(func->type.getID());
+      if (func->imported()) {
+        rehash(digest, std::hash<Name>{}(func->module));
+        rehash(digest, std::hash<Name>{}(func->base));
+      } else {
+        rehash(digest, ExpressionAnalyzer::hash(func->body));
+      }
+    });
+  FunctionHashes ret;
+  for (auto& func : wasm.functions) {
+    ret[func->name] = analysis.map[func.get()];
+  }
+  return ret;
+}
+
+// Maps each function name to the size of its body, in IR nodes, a reasonable
+// proxy for binary size that avoids writing the binary out.
+using FunctionSizes = std::map<Name, Index>;
+
+FunctionSizes computeFunctionSizes(Module& wasm) {
+  ModuleUtils::ParallelFunctionAnalysis<Index> analysis(
+    wasm, [](Function* func, Index& size) {
+      size = func->imported() ? 0 : Measurer::measure(func->body);
+    });
+  FunctionSizes ret;
+  for (auto& func : wasm.functions) {
+    ret[func->name] = analysis.map[func.get()];
+  }
+  return ret;
+}
+
+struct Diff {
+  Module& before;
+  Module& after;
+
+  bool quiet;
+
+  // Whether we found any difference at all.
+  bool different = false;
+
+  Diff(Module& before, Module& after, bool quiet)
+    : before(before), after(after), quiet(quiet) {}
+
+  void noteRemoved(const char* what, Name name) {
+    different = true;
+    if (!quiet) {
+      std::cout << "- removed " << what << ' ' << name << '\n';
+    }
+  }
+
+  void noteAdded(const char* what, Name name) {
+    different = true;
+    if (!quiet) {
+      std::cout << "+ added " << what << ' ' << name << '\n';
+    }
+  }
+
+  void noteChanged(const char* what, Name name, std::string extra = "") {
+    different = true;
+    if (!quiet) {
+      std::cout << "~ changed " << what << ' ' << name << extra << '\n';
+    }
+  }
+
+  void compareFunctions() {
+    auto beforeHashes = computeFunctionHashes(before);
+    auto afterHashes = computeFunctionHashes(after);
+    auto beforeSizes = computeFunctionSizes(before);
+    auto afterSizes = computeFunctionSizes(after);
+
+    Index numRemoved = 0, numAdded = 0, numChanged = 0;
+    Index beforeTotal = 0, afterTotal = 0;
+    for (auto& [name, size] : beforeSizes) {
+      beforeTotal += size;
+    }
+    for (auto& [name, size] : afterSizes) {
+      afterTotal += size;
+    }
+
+    for (auto& [name, digest] : beforeHashes) {
+      auto iter = afterHashes.find(name);
+      if (iter == afterHashes.end()) {
+        noteRemoved("function", name);
+        numRemoved++;
+      } else if (iter->second != digest) {
+        std::stringstream extra;
+        extra << " (size " << beforeSizes[name] << " -> " << afterSizes[name]
+              << ')';
+        noteChanged("function", name, extra.str());
+        numChanged++;
+      }
+    }
+    for (auto& [name, digest] : afterHashes) {
+      if (!beforeHashes.count(name)) {
+        noteAdded("function", name);
+        numAdded++;
+      }
+    }
+
+    std::cout << "functions: " << beforeHashes.size() << " -> "
+              << afterHashes.size() << " (" << numAdded << " added, "
+              << numRemoved << " removed, " << numChanged << " changed)\n";
+    std::cout << "code size: " << beforeTotal << " -> " << afterTotal
+              << " IR nodes ("
+              << (int64_t(afterTotal) - int64_t(beforeTotal)) << ")\n";
+  }
+
+  void compareGlobals() {
+    for (auto& global : before.globals) {
+      auto* other = after.getGlobalOrNull(global->name);
+      if (!other) {
+        noteRemoved("global", global->name);
+      } else if (global->type != other->type ||
+                 global->mutable_ != other->mutable_ ||
+                 global->imported() != other->imported() ||
+                 (!global->imported() &&
+                  !ExpressionAnalyzer::equal(global->init, other->init))) {
+        noteChanged("global", global->name);
+      }
+    }
+    for (auto& global : after.globals) {
+      if (!before.getGlobalOrNull(global->name)) {
+        noteAdded("global", global->name);
+      }
+    }
+  }
+
+  void compareExports() {
+    for (auto& exp : before.exports) {
+      auto* other = after.getExportOrNull(exp->name);
+      if (!other) {
+        noteRemoved("export", exp->name);
+      } else if (exp->kind != other->kind || exp->value != other->value) {
+        noteChanged("export", exp->name);
+      }
+    }
+    for (auto& exp : after.exports) {
+      if (!before.getExportOrNull(exp->name)) {
+        noteAdded("export", exp->name);
+      }
+    }
+  }
+
+  void compareData() {
+    // Segments have no usable names across builds in general, so just compare
+    // the total contents.
+    Index beforeTotal = 0, afterTotal = 0;
+    for (auto& segment : before.dataSegments) {
+      beforeTotal += segment->data.size();
+    }
+    for (auto& segment : after.dataSegments) {
+      afterTotal += segment->data.size();
+    }
+    if (before.dataSegments.size() != after.dataSegments.size() ||
+        beforeTotal != afterTotal) {
+      different = true;
+    }
+    std::cout << "data: " << before.dataSegments.size() << " -> "
+              << after.dataSegments.size() << " segments, " << beforeTotal
+              << " -> " << afterTotal << " bytes ("
+              << (int64_t(afterTotal) - int64_t(beforeTotal)) << ")\n";
+  }
+
+  // Returns whether the modules differ.
+  bool run() {
+    compareFunctions();
+    compareGlobals();
+    compareExports();
+    compareData();
+    return different;
+  }
+};
+
+} // anonymous namespace
+
+int main(int argc, const char* argv[]) {
+  bool quiet = false;
+  std::vector<std::string> files;
+
+  const std::string WasmDiffOption = "wasm-diff options";
+
+  ToolOptions options(
+    "wasm-diff",
+    "Compare two wasm modules structurally, reporting added, removed and "
+    "changed items and size deltas. Returns 0 if the modules are "
+    "structurally identical, 1 otherwise.");
+  options
+    .add("--quiet",
+         "-q",
+         "Only print the summary lines, not each changed item",
+         WasmDiffOption,
+         Options::Arguments::Zero,
+         [&](Options* o, const std::string& argument) { quiet = true; })
+    .add_positional("INFILE_BEFORE INFILE_AFTER",
+                    Options::Arguments::N,
+                    [&](Options* o, const std::string& argument) {
+                      files.push_back(argument);
+                    });
+  options.parse(argc, argv);
+
+  if (files.size() != 2) {
+    Fatal() << "wasm-diff requires exactly two input files";
+  }
+
+  Colors::setEnabled(false);
+
+  Module before, after;
+  auto read = [&](Module& wasm, const std::string& file) {
+    options.applyFeatures(wasm);
+    ModuleReader reader;
+    try {
+      reader.read(file, wasm);
+    } catch (ParseException& p) {
+      p.dump(std::cerr);
+      Fatal() << "error in parsing input: " << file;
+    }
+  };
+  read(before, files[0]);
+  read(after, files[1]);
+
+  Diff diff(before, after, quiet);
+  return diff.run() ? 1 : 0;
+}
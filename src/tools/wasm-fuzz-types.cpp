@@ -14,9 +14,13 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <mutex>
 #include <optional>
 #include <random>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <variant>
 
 #include "support/command-line.h"
@@ -59,7 +63,13 @@ void Fuzzer::run(uint64_t seed) {
   // TODO: Reset the global type state to avoid monotonically increasing
   // memory use.
   RandEngine getRand(seed);
-  std::cout << "Running with seed " << seed << "\n";
+  {
+    // Compose the line first so that parallel workers do not interleave
+    // within it; the seed must remain greppable to reproduce a failure.
+    std::ostringstream ss;
+    ss << "Running with seed " << seed << "\n";
+    std::cout << ss.str();
+  }
 
   // 4kb of random bytes should be enough for anyone!
   std::vector<char> bytes(4096);
@@ -483,6 +493,20 @@ int main(int argc, const char* argv[]) {
                 seed = uint64_t(std::stoull(arg));
               });
 
+  size_t numWorkers = 1;
+  options.add("--parallel",
+              "",
+              "Number of worker threads running independent workloads "
+              "(default 1). Only used in continuous mode, not with --seed",
+              WasmFuzzTypesOption,
+              Options::Arguments::One,
+              [&](Options*, const std::string& arg) {
+                numWorkers = std::stoull(arg);
+                if (numWorkers == 0) {
+                  numWorkers = std::thread::hardware_concurrency();
+                }
+              });
+
   bool verbose = false;
   options.add("--verbose",
               "-v",
@@ -520,17 +544,42 @@ int main(int argc, const char* argv[]) {
 
   setTypeSystem(system);
 
-  Fuzzer fuzzer{verbose};
   if (seed) {
     // Run just a single workload with the given seed.
+    Fuzzer fuzzer{verbose};
     fuzzer.run(*seed);
-  } else {
-    // Continuously run workloads with new randomly generated seeds.
-    size_t i = 0;
-    RandEngine nextSeed(getSeed());
+    return 0;
+  }
+
+  // Continuously run workloads with new randomly generated seeds. The global
+  // type stores are shared and safe to use from multiple threads, so workers
+  // need no state of their own beyond their Fuzzer.
+  std::mutex seedMutex;
+  RandEngine nextSeed(getSeed());
+  std::atomic<size_t> iteration{0};
+  auto work = [&]() {
+    Fuzzer fuzzer{verbose};
     while (true) {
-      std::cout << "Iteration " << ++i << "\n";
-      fuzzer.run(nextSeed());
+      uint64_t currSeed;
+      {
+        std::lock_guard<std::mutex> lock(seedMutex);
+        currSeed = nextSeed();
+      }
+      std::ostringstream ss;
+      ss << "Iteration " << ++iteration << "\n";
+      std::cout << ss.str();
+      fuzzer.run(currSeed);
+    }
+  };
+  if (numWorkers <= 1) {
+    work();
+  } else {
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < numWorkers; ++i) {
+      workers.emplace_back(work);
+    }
+    for (auto& worker : workers) {
+      worker.join();
     }
   }
   return 0;
@@ -44,16 +44,59 @@ using namespace wasm;
 
 struct DCENode {
   Name name;
-  std::vector<Name> reaches; // the other nodes this one can reach
+  std::vector<Index> reaches; // the indices of the nodes this one can reach
   DCENode() = default;
   DCENode(Name name) : name(name) {}
 };
 
 // A meta DCE graph with wasm integration
 struct MetaDCEGraph {
-  std::unordered_map<Name, DCENode> nodes;
+  // The nodes, indexed densely. Edges refer to nodes by index, so that the
+  // reachability walk touches compact integer arrays rather than hashing
+  // names, which matters on very large graphs.
+  std::vector<DCENode> nodes;
+  std::unordered_map<Name, Index> nodeIndices;
+
   std::unordered_set<Name> roots;
 
+  // Returns the index of the node with the given name, creating the node if
+  // it does not yet exist. Must not be called from parallel code, as it may
+  // alter the graph.
+  Index getNodeIndex(Name name) {
+    auto [iter, inserted] = nodeIndices.emplace(name, nodes.size());
+    if (inserted) {
+      nodes.push_back(DCENode(name));
+    }
+    return iter->second;
+  }
+
+  DCENode& getNode(Name name) { return nodes[getNodeIndex(name)]; }
+
+  // Like getNodeIndex, but the node must already exist. This is safe to call
+  // from parallel code, as it does not alter the graph.
+  Index getExistingNodeIndex(Name name) const {
+    auto iter = nodeIndices.find(name);
+    assert(iter != nodeIndices.end());
+    return iter->second;
+  }
+
+  // Adds an edge between two nodes, creating them if needed.
+  void addEdge(Name from, Name to) {
+    // Compute the target index first, as creating it may reallocate the node
+    // vector.
+    auto toIndex = getNodeIndex(to);
+    nodes[getNodeIndex(from)].reaches.push_back(toIndex);
+  }
+
+  // As addEdge, but both nodes must already exist. This is safe to call from
+  // parallel code so long as each thread adds edges from nodes that no other
+  // thread touches (as the parallel scanner does: each function's node is
+  // written by the single thread scanning that function).
+  void addExistingEdge(Name from, Name to) {
+    nodes[getExistingNodeIndex(from)].reaches.push_back(
+      getExistingNodeIndex(to));
+  }
+
   // export exported name => DCE name
   std::unordered_map<Name, Name> exportToDCENode;
   std::unordered_map<Name, Name> functionToDCENode; // function name => DCE name
@@ -118,19 +161,19 @@ struct MetaDCEGraph {
       auto dceName = getName("func", func->name.str);
       DCENodeToFunction[dceName] = func->name;
       functionToDCENode[func->name] = dceName;
-      nodes[dceName] = DCENode(dceName);
+      getNodeIndex(dceName);
     });
     ModuleUtils::iterDefinedGlobals(wasm, [&](Global* global) {
       auto dceName = getName("global", global->name.str);
       DCENodeToGlobal[dceName] = global->name;
       globalToDCENode[global->name] = dceName;
-      nodes[dceName] = DCENode(dceName);
+      getNodeIndex(dceName);
     });
     ModuleUtils::iterDefinedTags(wasm, [&](Tag* tag) {
       auto dceName = getName("tag", tag->name.str);
       DCENodeToTag[dceName] = tag->name;
       tagToDCENode[tag->name] = dceName;
-      nodes[dceName] = DCENode(dceName);
+      getNodeIndex(dceName);
     });
     // only process function, global, and tag imports - the table and memory are
     // always there
@@ -139,6 +182,7 @@ struct MetaDCEGraph {
       if (importIdToDCENode.find(id) == importIdToDCENode.end()) {
         auto dceName = getName("importId", import->name.str);
         importIdToDCENode[id] = dceName;
+        getNodeIndex(dceName);
       }
     });
     ModuleUtils::iterImportedGlobals(wasm, [&](Global* import) {
@@ -146,6 +190,7 @@ struct MetaDCEGraph {
       if (importIdToDCENode.find(id) == importIdToDCENode.end()) {
         auto dceName = getName("importId", import->name.str);
         importIdToDCENode[id] = dceName;
+        getNodeIndex(dceName);
       }
     });
     ModuleUtils::iterImportedTags(wasm, [&](Tag* import) {
@@ -153,6 +198,7 @@ struct MetaDCEGraph {
       if (importIdToDCENode.find(id) == importIdToDCENode.end()) {
         auto dceName = getName("importId", import->name.str);
         importIdToDCENode[id] = dceName;
+        getNodeIndex(dceName);
       }
     });
     for (auto& exp : wasm.exports) {
@@ -160,29 +206,27 @@ struct MetaDCEGraph {
         auto dceName = getName("export", exp->name.str);
         DCENodeToExport[dceName] = exp->name;
         exportToDCENode[exp->name] = dceName;
-        nodes[dceName] = DCENode(dceName);
+        getNodeIndex(dceName);
       }
       // we can also link the export to the thing being exported
-      auto& node = nodes[exportToDCENode[exp->name]];
+      auto dceName = exportToDCENode[exp->name];
       if (exp->kind == ExternalKind::Function) {
         if (!wasm.getFunction(exp->value)->imported()) {
-          node.reaches.push_back(functionToDCENode[exp->value]);
+          addEdge(dceName, functionToDCENode[exp->value]);
         } else {
-          node.reaches.push_back(
-            importIdToDCENode[getFunctionImportId(exp->value)]);
+          addEdge(dceName, importIdToDCENode[getFunctionImportId(exp->value)]);
         }
       } else if (exp->kind == ExternalKind::Global) {
         if (!wasm.getGlobal(exp->value)->imported()) {
-          node.reaches.push_back(globalToDCENode[exp->value]);
+          addEdge(dceName, globalToDCENode[exp->value]);
         } else {
-          node.reaches.push_back(
-            importIdToDCENode[getGlobalImportId(exp->value)]);
+          addEdge(dceName, importIdToDCENode[getGlobalImportId(exp->value)]);
         }
       } else if (exp->kind == ExternalKind::Tag) {
         if (!wasm.getTag(exp->value)->imported()) {
-          node.reaches.push_back(tagToDCENode[exp->value]);
+          addEdge(dceName, tagToDCENode[exp->value]);
         } else {
-          node.reaches.push_back(importIdToDCENode[getTagImportId(exp->value)]);
+          addEdge(dceName, importIdToDCENode[getTagImportId(exp->value)]);
         }
       }
     }
@@ -210,7 +254,7 @@ struct MetaDCEGraph {
           dceName = parent->importIdToDCENode[parent->getGlobalImportId(name)];
         }
         if (!parentDceName.isNull()) {
-          parent->nodes[parentDceName].reaches.push_back(dceName);
+          parent->addEdge(parentDceName, dceName);
         }
       }
     };
@@ -247,15 +291,16 @@ struct MetaDCEGraph {
       Scanner* create() override { return new Scanner(parent); }
 
       void visitCall(Call* curr) {
+        assert(parent->functionToDCENode.count(getFunction()->name) > 0);
+        auto parentDceName = parent->functionToDCENode[getFunction()->name];
         if (!getModule()->getFunction(curr->target)->imported()) {
-          parent->nodes[parent->functionToDCENode[getFunction()->name]]
-            .reaches.push_back(parent->functionToDCENode[curr->target]);
+          parent->addExistingEdge(parentDceName,
+                                  parent->functionToDCENode[curr->target]);
         } else {
-          assert(parent->functionToDCENode.count(getFunction()->name) > 0);
-          parent->nodes[parent->functionToDCENode[getFunction()->name]]
-            .reaches.push_back(
-              parent
-                ->importIdToDCENode[parent->getFunctionImportId(curr->target)]);
+          parent->addExistingEdge(
+            parentDceName,
+            parent
+              ->importIdToDCENode[parent->getFunctionImportId(curr->target)]);
         }
       }
       void visitGlobalGet(GlobalGet* curr) { handleGlobal(curr->name); }
@@ -282,8 +327,8 @@ struct MetaDCEGraph {
           // it's an import.
           dceName = parent->importIdToDCENode[parent->getGlobalImportId(name)];
         }
-        parent->nodes[parent->functionToDCENode[getFunction()->name]]
-          .reaches.push_back(dceName);
+        parent->addExistingEdge(parent->functionToDCENode[getFunction()->name],
+                                dceName);
       }
 
       void handleTag(Name name) {
@@ -293,8 +338,8 @@ struct MetaDCEGraph {
         } else {
           dceName = parent->importIdToDCENode[parent->getTagImportId(name)];
         }
-        parent->nodes[parent->functionToDCENode[getFunction()->name]]
-          .reaches.push_back(dceName);
+        parent->addExistingEdge(parent->functionToDCENode[getFunction()->name],
+                                dceName);
       }
     };
 
@@ -308,7 +353,7 @@ private:
     while (1) {
       auto curr =
         Name(prefix1 + '$' + prefix2 + '$' + std::to_string(nameIndex++));
-      if (nodes.find(curr) == nodes.end()) {
+      if (nodeIndices.find(curr) == nodeIndices.end()) {
         return curr;
       }
     }
@@ -316,36 +361,49 @@ private:
 
   Index nameIndex = 0;
 
-  std::unordered_set<Name> reached;
+  // Which nodes have been found to be reached, indexed like |nodes|.
+  std::vector<bool> reached;
 
 public:
   // Perform the DCE: simple marking from the roots
   void deadCodeElimination() {
-    std::vector<Name> queue;
+    std::vector<Index> queue;
     for (auto root : roots) {
-      reached.insert(root);
-      queue.push_back(root);
+      queue.push_back(getNodeIndex(root));
+    }
+    reached.clear();
+    reached.resize(nodes.size());
+    for (auto index : queue) {
+      reached[index] = true;
     }
     while (queue.size() > 0) {
-      auto name = queue.back();
+      auto index = queue.back();
       queue.pop_back();
-      auto& node = nodes[name];
-      for (auto target : node.reaches) {
-        if (reached.emplace(target).second) {
+      for (auto target : nodes[index].reaches) {
+        if (!reached[target]) {
+          reached[target] = true;
           queue.push_back(target);
         }
       }
     }
   }
 
+  // Checks if a node is reached. Only valid after deadCodeElimination().
+  bool isReached(Name name) {
+    auto iter = nodeIndices.find(name);
+    if (iter == nodeIndices.end()) {
+      return false;
+    }
+    return reached[iter->second];
+  }
+
   // Apply to the wasm
   void apply() {
     // Remove the unused exports
     std::vector<Name> toRemove;
     for (auto& exp : wasm.exports) {
       auto name = exp->name;
-      auto dceName = exportToDCENode[name];
-      if (reached.find(dceName) == reached.end()) {
+      if (!isReached(exportToDCENode[name])) {
         toRemove.push_back(name);
       }
     }
@@ -364,9 +422,9 @@ public:
   // removed, including on the outside
   void printAllUnused() {
     std::set<std::string> unused;
-    for (auto& [name, _] : nodes) {
-      if (reached.find(name) == reached.end()) {
-        unused.insert(name.str);
+    for (Index i = 0; i < nodes.size(); i++) {
+      if (!reached[i]) {
+        unused.insert(nodes[i].name.str);
       }
     }
     for (auto& name : unused) {
@@ -384,7 +442,8 @@ public:
     for (auto& [id, dceName] : importIdToDCENode) {
       importMap[dceName] = id;
     }
-    for (auto& [name, node] : nodes) {
+    for (auto& node : nodes) {
+      auto name = node.name;
       std::cout << "node: " << name << '\n';
       if (importMap.find(name) != importMap.end()) {
         std::cout << "  is import " << importMap[name] << '\n';
@@ -403,7 +462,7 @@ public:
         std::cout << "  is tag " << DCENodeToTag[name] << '\n';
       }
       for (auto target : node.reaches) {
-        std::cout << "  reaches: " << target << '\n';
+        std::cout << "  reaches: " << nodes[target].name << '\n';
       }
     }
     std::cout << "=============\n";
@@ -570,7 +629,8 @@ int main(int argc, const char* argv[]) {
       Fatal()
         << "nodes in input graph must have a name. see --help for the form";
     }
-    DCENode node(ref[NAME]->getIString());
+    Name nodeName = ref[NAME]->getIString();
+    graph.getNodeIndex(nodeName);
     if (ref->has(REACHES)) {
       json::Ref reaches = ref[REACHES];
       if (!reaches->isArray()) {
@@ -583,7 +643,7 @@ int main(int argc, const char* argv[]) {
           Fatal()
             << "node.reaches items must be strings. see --help for the form";
         }
-        node.reaches.push_back(name->getIString());
+        graph.addEdge(nodeName, name->getIString());
       }
     }
     if (ref->has(ROOT)) {
@@ -592,7 +652,7 @@ int main(int argc, const char* argv[]) {
         Fatal()
           << "node.root, if it exists, must be true. see --help for the form";
       }
-      graph.roots.insert(node.name);
+      graph.roots.insert(nodeName);
     }
     if (ref->has(EXPORT)) {
       json::Ref exp = ref[EXPORT];
@@ -600,8 +660,8 @@ int main(int argc, const char* argv[]) {
         Fatal() << "node.export, if it exists, must be a string. see --help "
                    "for the form";
       }
-      graph.exportToDCENode[exp->getIString()] = node.name;
-      graph.DCENodeToExport[node.name] = exp->getIString();
+      graph.exportToDCENode[exp->getIString()] = nodeName;
+      graph.DCENodeToExport[nodeName] = exp->getIString();
     }
     if (ref->has(IMPORT)) {
       json::Ref imp = ref[IMPORT];
@@ -611,10 +671,8 @@ int main(int argc, const char* argv[]) {
                    "strings. see --help for the form";
       }
       auto id = graph.getImportId(imp[0]->getIString(), imp[1]->getIString());
-      graph.importIdToDCENode[id] = node.name;
+      graph.importIdToDCENode[id] = nodeName;
     }
-    // TODO: optimize this copy with a clever move
-    graph.nodes[node.name] = node;
   }
 
   // The external graph is now populated. Scan the module
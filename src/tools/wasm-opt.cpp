@@ -19,10 +19,19 @@
 // then writes it.
 //
 
+#include <atomic>
+#include <iomanip>
 #include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
 
 #include "execution-results.h"
 #include "fuzzing.h"
+#include "ir/find_all.h"
+#include "ir/module-utils.h"
 #include "js-wrapper.h"
 #include "optimization-options.h"
 #include "pass.h"
@@ -34,6 +43,7 @@
 #include "wasm-binary.h"
 #include "wasm-interpreter.h"
 #include "wasm-io.h"
+#include "wasm-module-building.h"
 #include "wasm-s-parser.h"
 #include "wasm-validator.h"
 #include "wasm2c-wrapper.h"
@@ -59,6 +69,293 @@ static std::string runCommand(std::string command) {
 #endif
 }
 
+// The in-process fuzzing loop (--fuzz-loop). Generates one module per seed,
+// runs the passes under test and the interpreter oracle on each, and only
+// materializes files for failing seeds, keeping process startup and module
+// writes out of the inner loop. Seeds are claimed by a small pool of threads;
+// each iteration is self-contained (its own Module, interpreter instances,
+// and results), so the only shared state is the seed counter and the failure
+// report. Returns the number of failures.
+static size_t runFuzzLoop(OptimizationOptions& options,
+                          size_t numSeeds,
+                          bool fuzzMemory,
+                          bool fuzzOOB,
+                          Index exportFuel) {
+  // The input file provides base content which every seed perturbs, playing
+  // the same role as the input of a single -ttf invocation.
+  auto base =
+    read_file<std::vector<char>>(options.extra["infile"], Flags::Binary);
+  std::atomic<size_t> nextSeed(0);
+  std::atomic<size_t> numFailures(0);
+  std::mutex reportMutex;
+  auto deriveInput = [&](size_t seed) {
+    auto input = base;
+    if (input.empty()) {
+      input.resize(4096);
+    }
+    std::mt19937_64 prng(seed);
+    for (auto& byte : input) {
+      byte ^= char(prng());
+    }
+    return input;
+  };
+  auto buildModule = [&](Module& wasm, std::vector<char>&& input) {
+    options.applyFeatures(wasm);
+    TranslateToFuzzReader reader(wasm, std::move(input));
+    reader.setAllowMemory(fuzzMemory);
+    reader.setAllowOOB(fuzzOOB);
+    reader.build();
+  };
+  // Run the passes under test. We do not use options.runPasses() here, as it
+  // records timings and pass profiles into shared vectors, which would race
+  // between workers.
+  auto runPasses = [&](Module& wasm) {
+    PassRunner passRunner(&wasm, options.passOptions);
+    for (auto& pass : options.passes) {
+      if (pass == OptimizationOptions::DEFAULT_OPT_PASSES) {
+        passRunner.addDefaultOptimizationPasses();
+      } else {
+        passRunner.add(pass);
+      }
+    }
+    passRunner.run();
+  };
+  auto quietFlags =
+    WasmValidator::Flags(WasmValidator::Globally | WasmValidator::Quiet);
+  auto worker = [&]() {
+    while (1) {
+      auto seed = nextSeed.fetch_add(1);
+      if (seed >= numSeeds) {
+        return;
+      }
+      Module wasm;
+      buildModule(wasm, deriveInput(seed));
+      std::string problem;
+      ExecutionResults before(options.passOptions);
+      before.verbose = false;
+      before.exportFuel = exportFuel;
+      if (options.passOptions.validate &&
+          !WasmValidator().validate(wasm, quietFlags)) {
+        problem = "invalid module after translate-to-fuzz";
+      } else {
+        before.get(wasm);
+        runPasses(wasm);
+        if (options.passOptions.validate &&
+            !WasmValidator().validate(wasm, quietFlags)) {
+          problem = "invalid module after passes";
+        } else {
+          ExecutionResults after(options.passOptions);
+          after.verbose = false;
+          after.exportFuel = exportFuel;
+          after.get(wasm);
+          if (before != after) {
+            problem = "passes changed execution results";
+          }
+        }
+      }
+      if (problem.empty()) {
+        continue;
+      }
+      numFailures.fetch_add(1);
+      // Materialize the fuzz input, so the failure can be replayed with a
+      // plain -ttf invocation of that file, and the unoptimized module, which
+      // we regenerate (the fuzzer is deterministic for a given input).
+      auto prefix = "fuzz-fail-" + std::to_string(seed);
+      auto input = deriveInput(seed);
+      {
+        std::ofstream inputFile(prefix + ".input", std::ofstream::binary);
+        inputFile.write(input.data(), input.size());
+      }
+      Module original;
+      buildModule(original, std::move(input));
+      ModuleWriter writer;
+      writer.setBinary(true);
+      writer.write(original, prefix + ".wasm");
+      std::lock_guard<std::mutex> lock(reportMutex);
+      std::cerr << "[fuzz-loop] seed " << seed << ": " << problem << " (see "
+                << prefix << ".input and " << prefix << ".wasm)\n";
+    }
+  };
+  auto numThreads = std::min(numSeeds, ThreadPool::getNumCores());
+  if (numThreads <= 1) {
+    worker();
+  } else {
+    // Note that workers run whole iterations; function-parallel passes inside
+    // an iteration still use the global thread pool, which serializes its
+    // users, so pass running does not oversubscribe the machine.
+    std::vector<std::unique_ptr<std::thread>> threads;
+    for (size_t i = 0; i < numThreads; i++) {
+      threads.emplace_back(std::make_unique<std::thread>(worker));
+    }
+    for (auto& thread : threads) {
+      thread->join();
+    }
+  }
+  std::cout << "[fuzz-loop] tested " << numSeeds << " seeds, "
+            << numFailures.load() << " failure(s)\n";
+  return numFailures.load();
+}
+
+// Reads, optimizes, and writes a single module for the batch and daemon
+// modes below, with the passes and options fixed at startup. Returns an
+// empty string on success, and otherwise a description of the problem. We
+// do not use options.runPasses() here, as it records timings and pass
+// profiles into shared vectors, which would race between batch workers.
+static std::string optimizeModuleFile(OptimizationOptions& options,
+                                      const std::string& input,
+                                      const std::string& output,
+                                      bool emitBinary,
+                                      bool fastEmit) {
+  auto quietFlags =
+    WasmValidator::Flags(WasmValidator::Globally | WasmValidator::Quiet);
+  Module wasm;
+  options.applyFeatures(wasm);
+  try {
+    ModuleReader reader;
+    reader.setProfile(options.profile);
+    reader.read(input, wasm);
+  } catch (ParseException&) {
+    return "error parsing input";
+  } catch (std::bad_alloc&) {
+    return "error building module, std::bad_alloc";
+  }
+  if (options.passOptions.validate &&
+      !WasmValidator().validate(wasm, quietFlags)) {
+    return "error validating input";
+  }
+  if (options.runningPasses()) {
+    PassRunner passRunner(&wasm, options.passOptions);
+    for (auto& pass : options.passes) {
+      if (pass == OptimizationOptions::DEFAULT_OPT_PASSES) {
+        passRunner.addDefaultOptimizationPasses();
+      } else {
+        passRunner.add(pass);
+      }
+    }
+    passRunner.run();
+    if (options.passOptions.validate &&
+        !WasmValidator().validate(wasm, quietFlags)) {
+      return "error after opts";
+    }
+  }
+  ModuleWriter writer;
+  writer.setBinary(emitBinary);
+  writer.setDebugInfo(options.passOptions.debugInfo);
+  writer.setFast(fastEmit);
+  writer.write(wasm, output);
+  return "";
+}
+
+// The batch mode (--batch): read, optimize, and write many modules in one
+// process, so that process startup, pass registration, and thread-pool
+// spinup are paid once rather than per module. Modules are claimed by a
+// small pool of threads; each job is self-contained (its own Module and
+// PassRunner), and a failing module is reported and counted without
+// stopping the others. Returns the number of failures.
+static size_t runBatch(OptimizationOptions& options,
+                       const std::string& listFile,
+                       bool emitBinary,
+                       bool fastEmit) {
+  // Each non-empty, non-# line of the list file names an input module,
+  // optionally followed by an output path; without one the module is
+  // rewritten in place.
+  struct Job {
+    std::string input, output;
+  };
+  std::vector<Job> jobs;
+  auto list = read_file<std::string>(listFile, Flags::Text);
+  std::istringstream lines(list);
+  std::string line;
+  while (std::getline(lines, line)) {
+    std::istringstream parts(line);
+    Job job;
+    if (!(parts >> job.input) || job.input[0] == '#') {
+      continue;
+    }
+    parts >> job.output;
+    if (job.output.empty()) {
+      job.output = job.input;
+    }
+    jobs.push_back(job);
+  }
+  std::atomic<size_t> nextJob(0);
+  std::atomic<size_t> numFailures(0);
+  std::mutex reportMutex;
+  auto worker = [&]() {
+    while (1) {
+      auto index = nextJob.fetch_add(1);
+      if (index >= jobs.size()) {
+        return;
+      }
+      auto& job = jobs[index];
+      auto problem =
+        optimizeModuleFile(
+          options, job.input, job.output, emitBinary, fastEmit);
+      if (problem.empty()) {
+        continue;
+      }
+      numFailures.fetch_add(1);
+      std::lock_guard<std::mutex> lock(reportMutex);
+      std::cerr << "[batch] " << job.input << ": " << problem << '\n';
+    }
+  };
+  auto numThreads = std::min(jobs.size(), ThreadPool::getNumCores());
+  if (numThreads <= 1) {
+    worker();
+  } else {
+    // As in the fuzz loop above, workers claim whole modules; function-
+    // parallel passes inside a job still use the global thread pool, which
+    // serializes its users, so pass running does not oversubscribe the
+    // machine.
+    std::vector<std::unique_ptr<std::thread>> threads;
+    for (size_t i = 0; i < numThreads; i++) {
+      threads.emplace_back(std::make_unique<std::thread>(worker));
+    }
+    for (auto& thread : threads) {
+      thread->join();
+    }
+  }
+  if (!options.quiet) {
+    std::cerr << "[batch] processed " << jobs.size() << " module(s), "
+              << numFailures.load() << " failure(s)\n";
+  }
+  return numFailures.load();
+}
+
+// The daemon mode (--daemon): a long-lived server for build-system
+// integration, which keeps the process - and with it the interned type
+// stores, the registered passes, and the warm thread pool - alive across
+// jobs. The protocol is plain stdio: each request is one line in the batch
+// format, "input [output]" (default: rewrite in place), and each reply is
+// one line, "ok <input>" or "error <input>: <problem>", flushed so a build
+// system can wait for it. The daemon exits at EOF. Returns the number of
+// failures.
+static size_t
+runDaemon(OptimizationOptions& options, bool emitBinary, bool fastEmit) {
+  size_t numFailures = 0;
+  std::string line;
+  while (std::getline(std::cin, line)) {
+    std::istringstream parts(line);
+    std::string input, output;
+    if (!(parts >> input) || input[0] == '#') {
+      continue;
+    }
+    parts >> output;
+    if (output.empty()) {
+      output = input;
+    }
+    auto problem =
+      optimizeModuleFile(options, input, output, emitBinary, fastEmit);
+    if (problem.empty()) {
+      std::cout << "ok " << input << std::endl;
+    } else {
+      numFailures++;
+      std::cout << "error " << input << ": " << problem << std::endl;
+    }
+  }
+  return numFailures;
+}
+
 static bool willRemoveDebugInfo(const std::vector<std::string>& passes) {
   for (auto& pass : passes) {
     if (PassRunner::passRemovesDebugInfo(pass)) {
@@ -75,7 +372,10 @@ static bool willRemoveDebugInfo(const std::vector<std::string>& passes) {
 int main(int argc, const char* argv[]) {
   Name entry;
   bool emitBinary = true;
+  bool fastEmit = false;
   bool converge = false;
+  bool optimizeWhileReading = false;
+  bool incrementalOptimized = false;
   bool fuzzExecBefore = false;
   bool fuzzExecAfter = false;
   std::string extraFuzzCommand;
@@ -84,12 +384,24 @@ int main(int argc, const char* argv[]) {
   bool fuzzPasses = false;
   bool fuzzMemory = true;
   bool fuzzOOB = true;
+  size_t fuzzLoop = 0;
+  bool parallelFuzzExec = false;
+  Index fuzzExecFuel = 0;
   std::string emitJSWrapper;
   std::string emitSpecWrapper;
   std::string emitWasm2CWrapper;
   std::string inputSourceMapFilename;
   std::string outputSourceMapFilename;
   std::string outputSourceMapUrl;
+  std::string shardSpec;
+  std::string funcsChangedFile;
+  bool genHash = false;
+  bool genFuncHashes = false;
+  bool memoryReport = false;
+  std::string binaryIndexFile;
+  std::string emitBinaryIndexFile;
+  std::string batchFile;
+  bool daemon = false;
 
   const std::string WasmOptOption = "wasm-opt options";
 
@@ -110,12 +422,75 @@ int main(int argc, const char* argv[]) {
          WasmOptOption,
          Options::Arguments::Zero,
          [&](Options* o, const std::string& argument) { emitBinary = false; })
+    .add("--fast-emit",
+         "",
+         "Write the output binary faster at a small size cost: size fields "
+         "are emitted at their full fixed width and type indices are not "
+         "sorted by frequency. Useful for intermediate binaries that will "
+         "be read again rather than shipped",
+         WasmOptOption,
+         Options::Arguments::Zero,
+         [&](Options* o, const std::string& argument) { fastEmit = true; })
     .add("--converge",
          "-c",
          "Run passes to convergence, continuing while binary size decreases",
          WasmOptOption,
          Options::Arguments::Zero,
          [&](Options* o, const std::string& arguments) { converge = true; })
+    .add("--binary-index",
+         "",
+         "Use a sidecar index file (see --emit-binary-index) when reading "
+         "the input binary, to seek directly to function bodies instead of "
+         "scanning the code section. An index that does not match the input "
+         "is ignored",
+         WasmOptOption,
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           binaryIndexFile = argument;
+         })
+    .add("--emit-binary-index",
+         "",
+         "Write a sidecar index of the input binary to the given file, for "
+         "later reads of the same binary to use via --binary-index",
+         WasmOptOption,
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           emitBinaryIndexFile = argument;
+         })
+    .add("--batch",
+         "",
+         "Process many modules in one process: each non-empty, non-# line "
+         "of the given file names an input module, optionally followed by "
+         "an output path (default: rewrite in place). All modules run the "
+         "same passes and options; modules are scheduled across cores. No "
+         "INFILE is read in this mode",
+         WasmOptOption,
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           batchFile = argument;
+         })
+    .add("--daemon",
+         "",
+         "Serve optimization jobs over stdio until EOF, one request per "
+         "line in the --batch format (\"input [output]\"), replying \"ok "
+         "<input>\" or \"error <input>: <problem>\" per job. Keeps type "
+         "interning, pass registration, and the thread pool warm across "
+         "jobs for build-system integration. No INFILE is read in this "
+         "mode",
+         WasmOptOption,
+         Options::Arguments::Zero,
+         [&](Options* o, const std::string& argument) { daemon = true; })
+    .add("--optimize-while-reading",
+         "",
+         "Optimize function bodies in parallel while the binary is being "
+         "read. Only takes effect when the passes to run are exactly the "
+         "default pipeline (-O and friends); the global pre-passes of that "
+         "pipeline cannot run in this mode, so output may differ slightly",
+         WasmOptOption,
+         Options::Arguments::Zero,
+         [&](Options* o, const std::string& arguments) {
+           optimizeWhileReading = true;
+         })
     .add(
       "--fuzz-exec-before",
       "-feh",
@@ -132,6 +507,28 @@ int main(int argc, const char* argv[]) {
          [&](Options* o, const std::string& arguments) {
            fuzzExecBefore = fuzzExecAfter = true;
          })
+    .add("--parallel-fuzz-exec",
+         "",
+         "Execute each exported function in its own isolated instance, on "
+         "worker threads, in --fuzz-exec* modes. Exports then no longer "
+         "observe state left behind by earlier exports, and execution is not "
+         "narrated on stdout",
+         WasmOptOption,
+         Options::Arguments::Zero,
+         [&](Options* o, const std::string& arguments) {
+           parallelFuzzExec = true;
+         })
+    .add("--fuzz-exec-fuel",
+         "",
+         "A budget on the number of expressions each export may execute in "
+         "--fuzz-exec* and --fuzz-loop modes. An export that runs out is "
+         "treated like hitting a host limit, so the comparison is skipped "
+         "deterministically rather than timing out",
+         WasmOptOption,
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           fuzzExecFuel = Index(std::stoul(argument));
+         })
     .add("--extra-fuzz-command",
          "-efc",
          "An extra command to run on the output before and after optimizing. "
@@ -165,6 +562,17 @@ int main(int argc, const char* argv[]) {
          WasmOptOption,
          Options::Arguments::Zero,
          [&](Options* o, const std::string& arguments) { fuzzPasses = true; })
+    .add("--fuzz-loop",
+         "",
+         "Fuzz N seeds in-process in translate-to-fuzz (-ttf) mode: generate "
+         "a module per seed, run the passes and the interpreter oracle on "
+         "each, and only write files for failing seeds. The input file is "
+         "base content that every seed perturbs",
+         WasmOptOption,
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           fuzzLoop = std::stoul(argument);
+         })
     .add("--no-fuzz-memory",
          "",
          "don't emit memory ops when fuzzing",
@@ -228,6 +636,57 @@ int main(int argc, const char* argv[]) {
          [&outputSourceMapUrl](Options* o, const std::string& argument) {
            outputSourceMapUrl = argument;
          })
+    .add("--shard",
+         "",
+         "Run function-parallel passes on shard N of M only (format N/M). "
+         "Functions are partitioned deterministically by their order in the "
+         "input, so M invocations, one per shard, together cover every "
+         "function exactly once; each emits a complete module from which a "
+         "merger can take that shard's functions",
+         WasmOptOption,
+         Options::Arguments::One,
+         [&shardSpec](Options* o, const std::string& argument) {
+           shardSpec = argument;
+         })
+    .add("--funcs-changed",
+         "",
+         "File listing the functions, one name per line, that changed since "
+         "a previous build of the same module. Function-parallel passes then "
+         "only run on those functions, their direct callers (which module-"
+         "level passes like inlining may rewrite), and functions added while "
+         "optimizing; module-level passes run normally. Functions outside "
+         "that set keep their previous, already-optimized bodies",
+         WasmOptOption,
+         Options::Arguments::One,
+         [&funcsChangedFile](Options* o, const std::string& argument) {
+           funcsChangedFile = argument;
+         })
+    .add("--gen-hash",
+         "",
+         "Print a digest of the final module and of each of its sections, "
+         "computed in parallel from the serialized binary without writing "
+         "it anywhere",
+         WasmOptOption,
+         Options::Arguments::Zero,
+         [&genHash](Options*, const std::string&) { genHash = true; })
+    .add("--gen-func-hashes",
+         "",
+         "Like --gen-hash, but also print a digest of every function body "
+         "in the code section",
+         WasmOptOption,
+         Options::Arguments::Zero,
+         [&genFuncHashes](Options*, const std::string&) {
+           genFuncHashes = true;
+         })
+    .add("--memory-report",
+         "",
+         "Print an estimate of the memory retained by the module and the "
+         "stores backing it, by subsystem, after processing",
+         WasmOptOption,
+         Options::Arguments::Zero,
+         [&memoryReport](Options*, const std::string&) {
+           memoryReport = true;
+         })
     .add("--new-wat-parser",
          "",
          "Use the experimental new WAT parser",
@@ -241,6 +700,35 @@ int main(int argc, const char* argv[]) {
                     });
   options.parse(argc, argv);
 
+  if (fuzzLoop) {
+    if (!translateToFuzz) {
+      Fatal() << "--fuzz-loop requires --translate-to-fuzz";
+    }
+    if (fuzzPasses) {
+      Fatal() << "--fuzz-passes cannot be used with --fuzz-loop, as the "
+                 "passes to run must be fixed across iterations";
+    }
+    return runFuzzLoop(options, fuzzLoop, fuzzMemory, fuzzOOB, fuzzExecFuel) >
+               0
+             ? 1
+             : 0;
+  }
+
+  if (batchFile.size() || daemon) {
+    if (translateToFuzz || fuzzExecBefore || fuzzExecAfter ||
+        extraFuzzCommand.size()) {
+      Fatal() << "--batch and --daemon only read, optimize, and write "
+                 "modules";
+    }
+    if (batchFile.size() && daemon) {
+      Fatal() << "--batch and --daemon cannot be combined";
+    }
+    auto failures =
+      daemon ? runDaemon(options, emitBinary, fastEmit)
+             : runBatch(options, batchFile, emitBinary, fastEmit);
+    return failures > 0 ? 1 : 0;
+  }
+
   Module wasm;
   options.applyFeatures(wasm);
 
@@ -270,8 +758,29 @@ int main(int argc, const char* argv[]) {
     reader.setDWARF(options.passOptions.debugInfo &&
                     !willRemoveDebugInfo(options.passes));
     reader.setProfile(options.profile);
+    if (binaryIndexFile.size()) {
+      reader.setBinaryIndexFile(binaryIndexFile);
+    }
+    // When requested, and the situation allows it, read the binary lazily so
+    // that function bodies can be decoded on the main thread while worker
+    // threads optimize the ones already decoded, hiding most of the parse
+    // time behind optimization. This is only possible when the passes to run
+    // are exactly the default pipeline, and when nothing needs to see the
+    // unoptimized module first.
+    bool incremental =
+      optimizeWhileReading && !translateToFuzz && !fuzzExecBefore &&
+      extraFuzzCommand.empty() && emitJSWrapper.empty() &&
+      emitSpecWrapper.empty() && emitWasm2CWrapper.empty() &&
+      shardSpec.empty() && !options.passOptions.profilePasses &&
+      options.passes.size() == 1 &&
+      options.passes[0] == OptimizationOptions::DEFAULT_OPT_PASSES;
+    if (incremental) {
+      reader.setLazyFunctionBodies(true);
+    }
     try {
-      reader.read(inputFile, wasm, inputSourceMapFilename);
+      options.timePhase("read", [&]() {
+        reader.read(inputFile, wasm, inputSourceMapFilename);
+      });
     } catch (ParseException& p) {
       p.dump(std::cerr);
       std::cerr << '\n';
@@ -285,9 +794,56 @@ int main(int argc, const char* argv[]) {
                  "request for silly amounts of memory)";
     }
 
+    if (emitBinaryIndexFile.size()) {
+      if (reader.isBinaryFile(inputFile)) {
+        // Index the input as it is on disk, so that later reads of that same
+        // file can use the index.
+        MappedFile mapped(inputFile);
+        BinaryIndex::build(mapped.get()).write(emitBinaryIndexFile);
+      } else {
+        std::cerr << "warning: not emitting a binary index, as the input is "
+                     "not a wasm binary\n";
+      }
+    }
+
+    // The lazy read may not have engaged (e.g. on text input), in which case
+    // there is no handle and we optimize normally, later.
+    if (auto lazyBodies = reader.takeLazyFunctionBodies()) {
+      BYN_TRACE("optimizing while reading...\n");
+      options.timePhase("optimize", [&]() {
+        Index numDefined = 0;
+        ModuleUtils::iterDefinedFunctions(
+          wasm, [&](Function* func) { numDefined++; });
+        OptimizingIncrementalModuleBuilder builder(
+          &wasm,
+          numDefined,
+          options.passOptions,
+          [](PassRunner& passRunner) {},
+          options.debug,
+          options.passOptions.validateGlobally);
+        try {
+          ModuleUtils::iterDefinedFunctions(wasm, [&](Function* func) {
+            lazyBodies->materialize(func);
+            builder.addExisting(func);
+          });
+        } catch (ParseException& p) {
+          p.dump(std::cerr);
+          std::cerr << '\n';
+          Fatal() << "error parsing wasm";
+        }
+        builder.finish();
+        builder.optimizeGlobally();
+      });
+      incrementalOptimized = true;
+    }
+
     if (options.passOptions.validate) {
-      if (!WasmValidator().validate(wasm)) {
-        exitOnInvalidWasm("error validating input");
+      bool valid;
+      options.timePhase("validate",
+                        [&]() { valid = WasmValidator().validate(wasm); });
+      if (!valid) {
+        exitOnInvalidWasm(incrementalOptimized ? "error after opts"
+                                               : "error validating input");
       }
     }
   }
@@ -315,6 +871,8 @@ int main(int argc, const char* argv[]) {
   }
 
   ExecutionResults results(options.passOptions);
+  results.parallelExports = parallelFuzzExec;
+  results.exportFuel = fuzzExecFuel;
   if (fuzzExecBefore) {
     results.get(wasm);
   }
@@ -338,6 +896,93 @@ int main(int argc, const char* argv[]) {
     outfile.close();
   }
 
+  if (shardSpec.size()) {
+    uint32_t shard = 0, numShards = 0;
+    auto sep = shardSpec.find('/');
+    bool valid = sep != std::string::npos && sep > 0 &&
+                 sep + 1 < shardSpec.size();
+    if (valid) {
+      try {
+        shard = std::stoul(shardSpec.substr(0, sep));
+        numShards = std::stoul(shardSpec.substr(sep + 1));
+      } catch (std::logic_error&) {
+        valid = false;
+      }
+    }
+    if (!valid || numShards == 0 || shard >= numShards) {
+      Fatal() << "invalid --shard '" << shardSpec
+              << "': expected N/M with 0 <= N < M";
+    }
+    // Partition by the order of defined functions in the input, which is the
+    // same in every invocation on the same module.
+    std::unordered_map<Name, Index> definedIndexes;
+    ModuleUtils::iterDefinedFunctions(wasm, [&](Function* func) {
+      auto index = Index(definedIndexes.size());
+      definedIndexes[func->name] = index;
+    });
+    options.functionFilter =
+      [shard, numShards, definedIndexes = std::move(definedIndexes)](
+        Function* func) {
+        auto it = definedIndexes.find(func->name);
+        // A function we did not see in the input was added by a pass while
+        // optimizing this shard, so it belongs to this shard.
+        return it == definedIndexes.end() || it->second % numShards == shard;
+      };
+  }
+
+  if (funcsChangedFile.size()) {
+    if (shardSpec.size()) {
+      Fatal() << "--funcs-changed cannot be combined with --shard";
+    }
+    auto input(read_file<std::string>(funcsChangedFile, Flags::Text));
+    std::unordered_set<Name> changed;
+    std::istringstream lines(input);
+    std::string line;
+    while (std::getline(lines, line)) {
+      while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) {
+        line.pop_back();
+      }
+      if (!line.empty()) {
+        changed.insert(Name(line));
+      }
+    }
+    // The blast radius: a module-level pass like inlining may rewrite the
+    // direct callers of a changed function, so function-parallel passes must
+    // be allowed to clean those up as well. We do not need to go further:
+    // this filter only affects how optimized unvisited functions end up, not
+    // correctness, as module-level passes see the whole module regardless.
+    ModuleUtils::ParallelFunctionAnalysis<std::unordered_set<Name>> callees(
+      wasm, [&](Function* func, std::unordered_set<Name>& targets) {
+        if (func->imported()) {
+          return;
+        }
+        for (auto* call : FindAll<Call>(func->body).list) {
+          targets.insert(call->target);
+        }
+      });
+    auto allowed = changed;
+    for (auto& [func, targets] : callees.map) {
+      for (auto target : targets) {
+        if (changed.count(target)) {
+          allowed.insert(func->name);
+          break;
+        }
+      }
+    }
+    // Functions not yet present were added by a pass while optimizing, and
+    // so have not been optimized before; always visit them.
+    std::unordered_set<Name> original;
+    for (auto& func : wasm.functions) {
+      original.insert(func->name);
+    }
+    options.functionFilter =
+      [allowed = std::move(allowed),
+       original = std::move(original)](Function* func) {
+        return allowed.count(func->name) > 0 ||
+               original.count(func->name) == 0;
+      };
+  }
+
   std::string firstOutput;
 
   if (extraFuzzCommand.size() > 0 && options.extra.count("output") > 0) {
@@ -359,13 +1004,19 @@ int main(int argc, const char* argv[]) {
     auto runPasses = [&]() {
       options.runPasses(wasm);
       if (options.passOptions.validate) {
-        bool valid = WasmValidator().validate(wasm);
+        bool valid;
+        options.timePhase("validate",
+                          [&]() { valid = WasmValidator().validate(wasm); });
         if (!valid) {
           exitOnInvalidWasm("error after opts");
         }
       }
     };
-    runPasses();
+    // If we already optimized while reading the input, the work (and the
+    // validation after it) has been done.
+    if (!incrementalOptimized) {
+      runPasses();
+    }
     if (converge) {
       // Keep on running passes to convergence, defined as binary
       // size no longer decreasing.
@@ -392,10 +1043,41 @@ int main(int argc, const char* argv[]) {
     results.check(wasm);
   }
 
+  if (genHash || genFuncHashes) {
+    // Serialize to memory and digest that, rather than paying for an extra
+    // file write and an external hashing tool.
+    BufferWithRandomAccess buffer;
+    WasmBinaryWriter binaryWriter(&wasm, buffer);
+    binaryWriter.setNamesSection(options.passOptions.debugInfo);
+    binaryWriter.write();
+    auto digests = ModuleUtils::computeBinaryDigests(buffer);
+    auto printHex = [](uint64_t digest) {
+      std::cout << std::hex << std::setw(16) << std::setfill('0') << digest
+                << std::dec << std::setfill(' ') << '\n';
+    };
+    std::cout << "module hash: ";
+    printHex(digests.module);
+    for (auto& [id, digest] : digests.sections) {
+      std::cout << "section " << unsigned(id) << " hash: ";
+      printHex(digest);
+    }
+    if (genFuncHashes) {
+      for (Index i = 0; i < digests.functions.size(); i++) {
+        std::cout << "func " << i << " hash: ";
+        printHex(digests.functions[i]);
+      }
+    }
+  }
+
+  if (memoryReport) {
+    ModuleUtils::printMemoryReport(wasm, std::cerr);
+  }
+
   if (options.extra.count("output") == 0) {
     if (!options.quiet) {
       std::cerr << "warning: no output file specified, not emitting output\n";
     }
+    options.emitTimings();
     return 0;
   }
 
@@ -403,11 +1085,13 @@ int main(int argc, const char* argv[]) {
   ModuleWriter writer;
   writer.setBinary(emitBinary);
   writer.setDebugInfo(options.passOptions.debugInfo);
+  writer.setFast(fastEmit);
   if (outputSourceMapFilename.size()) {
     writer.setSourceMapFilename(outputSourceMapFilename);
     writer.setSourceMapUrl(outputSourceMapUrl);
   }
-  writer.write(wasm, options.extra["output"]);
+  options.timePhase("write",
+                    [&]() { writer.write(wasm, options.extra["output"]); });
 
   if (extraFuzzCommand.size() > 0) {
     auto secondOutput = runCommand(extraFuzzCommand);
@@ -416,5 +1100,6 @@ int main(int argc, const char* argv[]) {
       Fatal() << "extra fuzz command output differs\n";
     }
   }
+  options.emitTimings();
   return 0;
 }
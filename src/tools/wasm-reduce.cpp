@@ -70,6 +70,9 @@ std::string GetLastErrorStdStr() {
   }
   return std::string();
 }
+#else
+#include <sys/wait.h>
+#include <unistd.h>
 #endif
 using namespace wasm;
 
@@ -80,6 +83,54 @@ static size_t timeout = 2;
 // default of enabling all features should work in most cases.
 static std::string extraFlags = "-all";
 
+// If set, we run the oracle in-process instead of spawning a command: the
+// test file is parsed, validated, and this pass pipeline is run on it, all in
+// a forked child whose exit status (including death by a signal) is the
+// result. See --oracle-passes.
+static std::string oraclePasses;
+
+// State the in-process oracle needs, set up in main().
+static std::string oracleTestFile;
+static ToolOptions* oracleToolOptions = nullptr;
+
+#ifndef _WIN32
+// The body of the in-process oracle, run inside a forked child. If a module
+// is provided it is used directly (it is our own copy-on-write copy of the
+// parent's memory); otherwise the test file is parsed. Returns the exit code
+// for the child: 0 if everything went well, nonzero for a parse or validation
+// error, and a crash in a pass simply crashes us, which the parent observes
+// as death by a signal - exactly like a crash in a spawned wasm-opt.
+static int runInProcessOracle(Module* module) {
+  Module parsed;
+  if (!module) {
+    ModuleReader reader;
+    try {
+      reader.read(oracleTestFile, parsed);
+    } catch (ParseException&) {
+      return 1;
+    }
+    // As in Reducer::loadWorking, if there is no features section, assume we
+    // may need all features, then apply the user's feature flags.
+    if (!parsed.hasFeaturesSection) {
+      parsed.features = FeatureSet::All;
+    }
+    oracleToolOptions->applyFeatures(parsed);
+    module = &parsed;
+  }
+  if (!WasmValidator().validate(*module)) {
+    return 2;
+  }
+  PassRunner runner(module, oracleToolOptions->passOptions);
+  std::stringstream names(oraclePasses);
+  std::string name;
+  while (names >> name) {
+    runner.add(name);
+  }
+  runner.run();
+  return 0;
+}
+#endif // _WIN32
+
 struct ProgramResult {
   int code;
   std::string output;
@@ -197,8 +248,56 @@ struct ProgramResult {
     timer.stop();
     time = timer.getTotal() / 2;
   }
+
+  // Runs the in-process oracle (see --oracle-passes) in a forked child, so
+  // that a crash or hang in a pass only takes down the child, and fills in
+  // the result from its exit status. Output is left empty: in this mode
+  // results are compared by exit code alone.
+  void getFromInProcessOracle(Module* module) {
+    Timer timer;
+    timer.start();
+    output.clear();
+    pid_t pid = fork();
+    if (pid == 0) {
+      // We are the child. Limit our running time, as the "timeout" command
+      // does for spawned commands, then run the oracle. Use _exit to avoid
+      // running atexit handlers in this copy of the parent.
+      alarm(timeout);
+      _exit(runInProcessOracle(module));
+    }
+    if (pid < 0) {
+      Fatal() << "fork failed";
+    }
+    int status;
+    if (waitpid(pid, &status, 0) != pid) {
+      Fatal() << "waitpid failed";
+    }
+    if (WIFEXITED(status)) {
+      code = WEXITSTATUS(status);
+    } else {
+      // The child died from a signal (a crash in a pass, or the alarm going
+      // off). Report it the way a shell would.
+      code = 128 + WTERMSIG(status);
+    }
+    timer.stop();
+    time = timer.getTotal();
+  }
 #endif // _WIN32
 
+  // Runs the interestingness oracle: the given external command or, if
+  // --oracle-passes was provided, the in-process pipeline. A module may be
+  // provided when the caller already has the candidate in memory, which lets
+  // the in-process oracle skip even the parsing of the test file.
+  void getFromOracle(std::string command, Module* module = nullptr) {
+#ifndef _WIN32
+    if (!oraclePasses.empty()) {
+      getFromInProcessOracle(module);
+      return;
+    }
+#endif
+    getFromExecution(command);
+  }
+
   bool operator==(ProgramResult& other) {
     return code == other.code && output == other.output;
   }
@@ -228,6 +327,19 @@ ProgramResult expected;
 // case we may try again but much later.
 static std::unordered_set<Name> functionsWeTriedToRemove;
 
+// Hashes of candidate states (the bytes written to the test file) that we have
+// already run the command on and seen fail to keep the interesting behavior.
+// The command must be deterministic anyhow for reduction to be meaningful, so
+// when later reductions revisit a byte-identical state we can skip running the
+// command on it again.
+static std::unordered_set<size_t> statesSeenToFail;
+
+// Hashes the contents of the file at |name|, identifying a candidate state.
+static size_t hashFile(const std::string& name) {
+  auto contents = read_file<std::vector<char>>(name, Flags::Binary);
+  return hash(std::string_view(contents.data(), contents.size()));
+}
+
 struct Reducer
   : public WalkerPass<PostWalker<Reducer, UnifiedExpressionVisitor<Reducer>>> {
   std::string command, test, working;
@@ -308,13 +420,22 @@ struct Reducer
           auto newSize = file_size(test);
           if (newSize < oldSize) {
             // the pass didn't fail, and the size looks smaller, so promising
-            // see if it is still has the property we are preserving
-            if (ProgramResult(command) == expected) {
+            // see if it is still has the property we are preserving, unless
+            // we have already seen this very state fail
+            auto digest = hashFile(test);
+            if (statesSeenToFail.count(digest)) {
+              continue;
+            }
+            ProgramResult result;
+            result.getFromOracle(command);
+            if (result == expected) {
               std::cerr << "|    command \"" << currCommand
                         << "\" succeeded, reduced size to " << newSize << '\n';
               copy_file(test, working);
               more = true;
               oldSize = newSize;
+            } else {
+              statesSeenToFail.insert(digest);
             }
           }
         }
@@ -400,9 +521,21 @@ struct Reducer
     // than the previous - each destructive reduction removes logical code,
     // and so is strictly better, even if the wasm binary format happens to
     // encode things slightly less efficiently.
-    // test it
-    out.getFromExecution(command);
-    return out == expected;
+    // test it, unless we have already seen this very state fail, in which
+    // case we can skip running the command (note that |out| is then not
+    // filled in; no caller inspects it after a failure that can hit the
+    // cache, as the cache only ever contains states that were reached by a
+    // failed reduction attempt)
+    auto digest = hashFile(test);
+    if (statesSeenToFail.count(digest)) {
+      return false;
+    }
+    out.getFromOracle(command, getModule());
+    if (out == expected) {
+      return true;
+    }
+    statesSeenToFail.insert(digest);
+    return false;
   }
 
   size_t decisionCounter = 0;
@@ -1050,17 +1183,35 @@ struct Reducer
   }
 
   // Try to actually remove functions. If they are somehow referred to, we will
-  // get a validation error and undo it.
+  // get a validation error and undo it. We journal every change we make so
+  // that undoing is done in place, rather than by reloading and re-parsing
+  // the entire working file (failed attempts here are very common, and on
+  // large modules the reload used to dominate).
   bool tryToRemoveFunctions(std::vector<Name> names) {
-    for (auto name : names) {
-      module->removeFunction(name);
+    // Move the functions out of the module rather than destroying them,
+    // remembering their positions so that a failed attempt can restore the
+    // original order exactly.
+    std::unordered_set<Name> nameSet(names.begin(), names.end());
+    std::vector<std::pair<Index, std::unique_ptr<Function>>> removedFuncs;
+    auto& funcs = module->functions;
+    for (Index i = 0; i < funcs.size(); i++) {
+      if (nameSet.count(funcs[i]->name)) {
+        removedFuncs.emplace_back(i, std::move(funcs[i]));
+      }
     }
+    funcs.erase(
+      std::remove_if(funcs.begin(), funcs.end(), [](auto& f) { return !f; }),
+      funcs.end());
+    module->updateMaps();
 
-    // remove all references to them
+    // remove all references to them, journaling each replacement
     struct FunctionReferenceRemover
       : public PostWalker<FunctionReferenceRemover> {
       std::unordered_set<Name> names;
       std::vector<Name> exportsToRemove;
+      // the locations we replaced, and what was there before
+      std::vector<std::pair<Expression**, Expression*>> journal;
+      std::vector<Export> removedExports;
 
       FunctionReferenceRemover(std::vector<Name>& vec) {
         for (auto name : vec) {
@@ -1069,11 +1220,13 @@ struct Reducer
       }
       void visitCall(Call* curr) {
         if (names.count(curr->target)) {
+          journal.emplace_back(getCurrentPointer(), curr);
           replaceCurrent(Builder(*getModule()).replaceWithIdenticalType(curr));
         }
       }
       void visitRefFunc(RefFunc* curr) {
         if (names.count(curr->func)) {
+          journal.emplace_back(getCurrentPointer(), curr);
           replaceCurrent(Builder(*getModule()).replaceWithIdenticalType(curr));
         }
       }
@@ -1085,6 +1238,7 @@ struct Reducer
       void doWalkModule(Module* module) {
         PostWalker<FunctionReferenceRemover>::doWalkModule(module);
         for (auto name : exportsToRemove) {
+          removedExports.push_back(*module->getExport(name));
           module->removeExport(name);
         }
       }
@@ -1098,7 +1252,19 @@ struct Reducer
       std::cerr << "|        removed " << names.size() << " functions\n";
       return true;
     } else {
-      loadWorking(); // restore it from orbit
+      // Undo everything, in place. The journaled locations are all in
+      // functions we did not remove, so they are still valid.
+      for (auto& [location, original] : referenceRemover.journal) {
+        *location = original;
+      }
+      for (auto& exp : referenceRemover.removedExports) {
+        module->addExport(new Export(exp));
+      }
+      // Inserting in ascending index order restores the original positions.
+      for (auto& [index, func] : removedFuncs) {
+        funcs.insert(funcs.begin() + index, std::move(func));
+      }
+      module->updateMaps();
       return false;
     }
   }
@@ -1206,6 +1372,20 @@ int main(int argc, const char* argv[]) {
          WasmReduceOption,
          Options::Arguments::One,
          [&](Options* o, const std::string& argument) { command = argument; })
+    .add("--oracle-passes",
+         "-op",
+         "Instead of a command, use a space-separated list of wasm-opt passes "
+         "as the oracle, run in-process in a forked child (POSIX only). This "
+         "avoids process startup per probe, which can speed up reduction "
+         "greatly for oracles of the form \"wasm-opt crashes in pass X\". In "
+         "this mode results are compared by exit status alone (a crash in a "
+         "pass appears as death by a signal, a validation error as a nonzero "
+         "exit).",
+         WasmReduceOption,
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           oraclePasses = argument;
+         })
     .add("--test",
          "-t",
          "Test file (this will be written to to test, the given command should "
@@ -1304,6 +1484,16 @@ int main(int argc, const char* argv[]) {
   if (working.size() == 0) {
     Fatal() << "working file not provided\n";
   }
+  if (command.size() > 0 && oraclePasses.size() > 0) {
+    Fatal() << "--command and --oracle-passes are mutually exclusive\n";
+  }
+#ifdef _WIN32
+  if (oraclePasses.size() > 0) {
+    Fatal() << "--oracle-passes requires fork(), which Windows lacks\n";
+  }
+#endif
+  oracleTestFile = test;
+  oracleToolOptions = &options;
 
   if (!binary) {
     Colors::setEnabled(false);
@@ -1320,7 +1510,7 @@ int main(int argc, const char* argv[]) {
 
   // get the expected output
   copy_file(input, test);
-  expected.getFromExecution(command);
+  expected.getFromOracle(command);
 
   std::cerr << "|expected result:\n" << expected << '\n';
   std::cerr << "|!! Make sure the above is what you expect! !!\n\n";
@@ -1348,14 +1538,16 @@ int main(int argc, const char* argv[]) {
       std::ofstream dst(test, std::ios::binary);
       dst << "waka waka\n";
     }
-    ProgramResult resultOnInvalid(command);
+    ProgramResult resultOnInvalid;
+    resultOnInvalid.getFromOracle(command);
     if (resultOnInvalid == expected) {
       // Try it on a valid input.
       Module emptyModule;
       ModuleWriter writer;
       writer.setBinary(true);
       writer.write(emptyModule, test);
-      ProgramResult resultOnValid(command);
+      ProgramResult resultOnValid;
+      resultOnValid.getFromOracle(command);
       if (resultOnValid == expected) {
         Fatal()
           << "running the command on the given input gives the same result as "
@@ -1379,7 +1571,8 @@ int main(int argc, const char* argv[]) {
     if (readWrite.failed()) {
       stopIfNotForced("failed to read and write the binary", readWrite);
     } else {
-      ProgramResult result(command);
+      ProgramResult result;
+      result.getFromOracle(command);
       if (result != expected) {
         stopIfNotForced("running command on the canonicalized module should "
                         "give the same results",
@@ -103,20 +103,77 @@ void Instrumenter::instrumentFuncs() {
       break;
     }
     case WasmSplitOptions::StorageKind::InMemory: {
-      if (!wasm->features.hasAtomics()) {
-        Fatal() << "error: --in-memory requires atomics to be enabled";
-      }
       // (i32.atomic.store8 offset=funcidx (i32.const 0) (i32.const 1))
+      //
+      // With atomics the store is atomic, so that it is safe to profile a
+      // threaded application. Without atomics the module cannot be
+      // multithreaded anyway, and a plain store avoids requiring the feature.
+      bool atomic = wasm->features.hasAtomics();
       Index funcIdx = 0;
       ModuleUtils::iterDefinedFunctions(*wasm, [&](Function* func) {
-        func->body = builder.makeSequence(
-          builder.makeAtomicStore(1,
-                                  funcIdx,
+        Expression* store;
+        if (atomic) {
+          store = builder.makeAtomicStore(1,
+                                          funcIdx,
+                                          builder.makeConstPtr(0),
+                                          builder.makeConst(uint32_t(1)),
+                                          Type::i32);
+        } else {
+          store = builder.makeStore(1,
+                                    funcIdx,
+                                    1,
+                                    builder.makeConstPtr(0),
+                                    builder.makeConst(uint32_t(1)),
+                                    Type::i32);
+        }
+        func->body =
+          builder.makeSequence(store, func->body, func->body->type);
+        ++funcIdx;
+      });
+      break;
+    }
+    case WasmSplitOptions::StorageKind::InMemoryCounters: {
+      // (i32.store offset=4*funcidx (i32.const 0)
+      //   (i32.add
+      //     (i32.load offset=4*funcidx (i32.const 0))
+      //     (i32.const 1)
+      //   )
+      // )
+      //
+      // or an atomic rmw add when atomics are available. Unlike the one-time
+      // timestamps of the other modes, this is a counter that is updated
+      // unconditionally, so the hot path has no branch at all.
+      bool atomic = wasm->features.hasAtomics();
+      Index funcIdx = 0;
+      ModuleUtils::iterDefinedFunctions(*wasm, [&](Function* func) {
+        uint32_t offset = funcIdx * 4;
+        Expression* update;
+        if (atomic) {
+          update = builder.makeDrop(
+            builder.makeAtomicRMW(RMWAdd,
+                                  4,
+                                  offset,
                                   builder.makeConstPtr(0),
                                   builder.makeConst(uint32_t(1)),
-                                  Type::i32),
-          func->body,
-          func->body->type);
+                                  Type::i32));
+        } else {
+          update = builder.makeStore(
+            4,
+            offset,
+            4,
+            builder.makeConstPtr(0),
+            builder.makeBinary(AddInt32,
+                               builder.makeLoad(4,
+                                                false,
+                                                offset,
+                                                4,
+                                                builder.makeConstPtr(0),
+                                                Type::i32),
+                               builder.makeConst(uint32_t(1))),
+            Type::i32);
+        }
+        func->body =
+          builder.makeSequence(update, func->body, func->body->type);
         ++funcIdx;
       });
       break;
@@ -138,6 +195,10 @@ void Instrumenter::instrumentFuncs() {
 // are non-zero for functions that were called during the instrumented run and 0
 // otherwise. Functions with smaller non-zero timestamps were called earlier in
 // the instrumented run than funtions with larger timestamps.
+//
+// In the in-memory-counters storage mode the recorded values are call counts
+// rather than timestamps: zero still means the function was never called, but
+// the values carry no ordering information.
 
 void Instrumenter::addProfileExport() {
   // Create and export a function to dump the profile into a given memory
@@ -188,12 +249,31 @@ void Instrumenter::addProfileExport() {
       }
       break;
     }
-    case WasmSplitOptions::StorageKind::InMemory: {
+    case WasmSplitOptions::StorageKind::InMemory:
+    case WasmSplitOptions::StorageKind::InMemoryCounters: {
       Index funcIdxVar =
         Builder::addVar(writeProfile.get(), "funcIdx", Type::i32);
       auto getFuncIdx = [&]() {
         return builder.makeLocalGet(funcIdxVar, Type::i32);
       };
+      // The value recorded for the current function: the one-byte flag, or
+      // the four-byte counter, depending on the storage kind.
+      auto getValue = [&]() -> Expression* {
+        if (options.storageKind == WasmSplitOptions::StorageKind::InMemory) {
+          if (wasm->features.hasAtomics()) {
+            return builder.makeAtomicLoad(1, 0, getFuncIdx(), Type::i32);
+          }
+          return builder.makeLoad(1, false, 0, 1, getFuncIdx(), Type::i32);
+        }
+        return builder.makeLoad(
+          4,
+          false,
+          0,
+          4,
+          builder.makeBinary(
+            MulInt32, getFuncIdx(), builder.makeConst(uint32_t(4))),
+          Type::i32);
+      };
       // (block $outer
       //   (loop $l
       //     (br_if $outer (i32.eq (local.get $fucIdx) (i32.const numFuncs))
@@ -232,7 +312,7 @@ void Instrumenter::addProfileExport() {
                   getAddr(),
                   builder.makeBinary(
                     MulInt32, getFuncIdx(), builder.makeConst(uint32_t(4)))),
-                builder.makeAtomicLoad(1, 0, getFuncIdx(), Type::i32),
+                getValue(),
                 Type::i32),
               builder.makeLocalSet(
                 funcIdxVar,
@@ -61,6 +61,12 @@ std::ostream& operator<<(std::ostream& o, WasmSplitOptions::Mode& mode) {
     case WasmSplitOptions::Mode::Split:
       o << "split";
       break;
+    case WasmSplitOptions::Mode::MultiSplit:
+      o << "multi-split";
+      break;
+    case WasmSplitOptions::Mode::MergeBack:
+      o << "merge-back";
+      break;
     case WasmSplitOptions::Mode::Instrument:
       o << "instrument";
       break;
@@ -92,6 +98,50 @@ WasmSplitOptions::WasmSplitOptions()
          WasmSplitOption,
          Options::Arguments::Zero,
          [&](Options* o, const std::string& arugment) { mode = Mode::Split; })
+    .add("--multi-split",
+         "",
+         "Split an input module into an arbitrary number of output modules "
+         "in a single pass, according to a manifest file. This is much "
+         "faster than running --split once per output module, since the "
+         "input is parsed and analyzed only once.",
+         WasmSplitOption,
+         Options::Arguments::Zero,
+         [&](Options* o, const std::string& argument) {
+           mode = Mode::MultiSplit;
+         })
+    .add("--manifest",
+         "",
+         "File describing the functions to be split into each module. Each "
+         "section starts with the name of an output module followed by a "
+         "colon, and then lists the functions to split into that module, "
+         "one per line.",
+         WasmSplitOption,
+         {Mode::MultiSplit},
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           manifestFile = argument;
+         })
+    .add("--out-prefix",
+         "",
+         "A prefix to prepend to the names of the output modules from the "
+         "manifest to form their output file paths.",
+         WasmSplitOption,
+         {Mode::MultiSplit},
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) { outPrefix = argument; })
+    .add("--merge-back",
+         "",
+         "Merge one or more previously split out modules back into a primary "
+         "module, turning the indirect calls through the split out functions' "
+         "table slots back into direct calls. The first input is the primary "
+         "module and the remaining inputs are the secondary modules. This "
+         "produces a single artifact without the overhead of the permanent "
+         "trampolines, for use once the secondary code is known to be needed.",
+         WasmSplitOption,
+         Options::Arguments::Zero,
+         [&](Options* o, const std::string& argument) {
+           mode = Mode::MergeBack;
+         })
     .add(
       "--instrument",
       "",
@@ -188,7 +238,7 @@ WasmSplitOptions::WasmSplitOptions()
          "The namespace from which to import objects from the primary "
          "module into the secondary module.",
          WasmSplitOption,
-         {Mode::Split},
+         {Mode::Split, Mode::MultiSplit},
          Options::Arguments::One,
          [&](Options* o, const std::string& argument) {
            importNamespace = argument;
@@ -198,7 +248,7 @@ WasmSplitOptions::WasmSplitOptions()
          "The namespace from which to import placeholder functions into "
          "the primary module.",
          WasmSplitOption,
-         {Mode::Split},
+         {Mode::Split, Mode::MultiSplit, Mode::MergeBack},
          Options::Arguments::One,
          [&](Options* o, const std::string& argument) {
            placeholderNamespace = argument;
@@ -218,7 +268,7 @@ WasmSplitOptions::WasmSplitOptions()
       "An identifying prefix to prepend to new export names created "
       "by module splitting.",
       WasmSplitOption,
-      {Mode::Split},
+      {Mode::Split, Mode::MultiSplit},
       Options::Arguments::One,
       [&](Options* o, const std::string& argument) { exportPrefix = argument; })
     .add("--profile-export",
@@ -245,6 +295,22 @@ WasmSplitOptions::WasmSplitOptions()
       [&](Options* o, const std::string& argument) {
         storageKind = StorageKind::InMemory;
       })
+    .add(
+      "--in-memory-counters",
+      "",
+      "Store profile information as one call counter per function in memory "
+      "(starting at address 0 and taking four bytes per function) rather "
+      "than globals. The counter is updated unconditionally at each function "
+      "entry, with no branch on the hot path, so this mode distorts the "
+      "timing of hot functions the least. Users are responsible for ensuring "
+      "that the module does not use the initial memory region for anything "
+      "else.",
+      WasmSplitOption,
+      {Mode::Instrument},
+      Options::Arguments::Zero,
+      [&](Options* o, const std::string& argument) {
+        storageKind = StorageKind::InMemoryCounters;
+      })
     .add(
       "--emit-module-names",
       "",
@@ -253,7 +319,7 @@ WasmSplitOptions::WasmSplitOptions()
       "removed once simpler ways of naming modules are widely available. See "
       "https://bugs.chromium.org/p/v8/issues/detail?id=11808.",
       WasmSplitOption,
-      {Mode::Split, Mode::Instrument},
+      {Mode::Split, Mode::MultiSplit, Mode::Instrument},
       Options::Arguments::Zero,
       [&](Options* o, const std::string& arguments) { emitModuleNames = true; })
     .add("--initial-table",
@@ -272,23 +338,25 @@ WasmSplitOptions::WasmSplitOptions()
          "-S",
          "Emit text instead of binary for the output file or files.",
          WasmSplitOption,
-         {Mode::Split, Mode::Instrument},
+         {Mode::Split, Mode::MultiSplit, Mode::MergeBack, Mode::Instrument},
          Options::Arguments::Zero,
          [&](Options* o, const std::string& argument) { emitBinary = false; })
     .add("--debuginfo",
          "-g",
          "Emit names section in wasm binary (or full debuginfo in wast)",
          WasmSplitOption,
-         {Mode::Split, Mode::Instrument},
+         {Mode::Split, Mode::MultiSplit, Mode::MergeBack, Mode::Instrument},
          Options::Arguments::Zero,
          [&](Options* o, const std::string& arguments) {
            passOptions.debugInfo = true;
          })
     .add("--output",
          "-o",
-         "Output file.",
+         "Output file. In multi-split mode, this is the output file for the "
+         "primary module.",
          WasmSplitOption,
-         {Mode::Instrument, Mode::MergeProfiles},
+         {Mode::MultiSplit, Mode::MergeBack, Mode::Instrument,
+          Mode::MergeProfiles},
          Options::Arguments::One,
          [&](Options* o, const std::string& argument) { output = argument; })
     .add("--unescape",
@@ -373,11 +441,17 @@ bool WasmSplitOptions::validate() {
   }
   switch (mode) {
     case Mode::Split:
+    case Mode::MultiSplit:
     case Mode::Instrument:
       if (inputFiles.size() > 1) {
         fail("Cannot have more than one input file.");
       }
       break;
+    case Mode::MergeBack:
+      if (inputFiles.size() < 2) {
+        fail("Must have a primary module and at least one secondary module.");
+      }
+      break;
     case Mode::MergeProfiles:
       // Any number >= 1 allowed.
       break;
@@ -409,6 +483,19 @@ bool WasmSplitOptions::validate() {
     }
   }
 
+  if (mode == Mode::MultiSplit) {
+    if (manifestFile.empty()) {
+      fail("--manifest is required in multi-split mode.");
+    }
+    if (output.empty()) {
+      fail("--output is required in multi-split mode.");
+    }
+  }
+
+  if (mode == Mode::MergeBack && output.empty()) {
+    fail("--output is required in merge-back mode.");
+  }
+
   return valid;
 }
 
@@ -26,6 +26,8 @@ const std::string DEFAULT_PROFILE_EXPORT("__write_profile");
 struct WasmSplitOptions : ToolOptions {
   enum class Mode : unsigned {
     Split,
+    MultiSplit,
+    MergeBack,
     Instrument,
     MergeProfiles,
     PrintProfile,
@@ -35,8 +37,11 @@ struct WasmSplitOptions : ToolOptions {
     static_cast<unsigned>(Mode::PrintProfile) + 1;
 
   enum class StorageKind : unsigned {
-    InGlobals, // Store profile data in WebAssembly Globals
-    InMemory,  // Store profile data in memory, accessible from all threads
+    InGlobals,        // Store profile data in WebAssembly Globals
+    InMemory,         // Store profile data in memory, accessible from all
+                      // threads
+    InMemoryCounters, // Store a call counter per function in memory, updated
+                      // unconditionally at each entry
   };
   StorageKind storageKind = StorageKind::InGlobals;
 
@@ -53,6 +58,11 @@ struct WasmSplitOptions : ToolOptions {
   std::string profileFile;
   std::string profileExport = DEFAULT_PROFILE_EXPORT;
 
+  // The file describing the contents of each output module in multi-split
+  // mode, and the prefix to prepend to their names to form output paths.
+  std::string manifestFile;
+  std::string outPrefix;
+
   std::set<Name> keepFuncs;
   std::set<Name> splitFuncs;
 
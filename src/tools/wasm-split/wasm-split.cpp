@@ -14,8 +14,8 @@
  * limitations under the License.
  */
 
-// wasm-split: Split a module in two or instrument a module to inform future
-// splitting.
+// wasm-split: Split a module in two (or, with a manifest, into arbitrarily
+// many modules) or instrument a module to inform future splitting.
 
 #include <fstream>
 
@@ -24,6 +24,7 @@
 #include "support/file.h"
 #include "support/name.h"
 #include "support/path.h"
+#include "support/threads.h"
 #include "support/utilities.h"
 #include "wasm-binary.h"
 #include "wasm-builder.h"
@@ -37,12 +38,14 @@ using namespace wasm;
 
 namespace {
 
-void parseInput(Module& wasm, const WasmSplitOptions& options) {
+void parseInput(Module& wasm,
+                const WasmSplitOptions& options,
+                const std::string& filename) {
   options.applyFeatures(wasm);
   ModuleReader reader;
   reader.setProfile(options.profile);
   try {
-    reader.read(options.inputFiles[0], wasm);
+    reader.read(filename, wasm);
   } catch (ParseException& p) {
     p.dump(std::cerr);
     std::cerr << '\n';
@@ -102,7 +105,7 @@ void writeModule(Module& wasm,
 
 void instrumentModule(const WasmSplitOptions& options) {
   Module wasm;
-  parseInput(wasm, options);
+  parseInput(wasm, options, options.inputFiles[0]);
 
   // Check that the profile export name is not already taken
   if (wasm.getExportOrNull(options.profileExport) != nullptr) {
@@ -125,8 +128,11 @@ struct ProfileData {
 };
 
 // See "wasm-split profile format" in instrumenter.cpp for more information.
+// The file is mapped rather than copied; when merging, the profiles can
+// number in the thousands.
 ProfileData readProfile(const std::string& file) {
-  auto profileData = read_file<std::vector<char>>(file, Flags::Binary);
+  MappedFile mapping(file);
+  auto profileData = mapping.get();
   size_t i = 0;
   auto readi32 = [&]() {
     if (i + 4 > profileData.size()) {
@@ -198,7 +204,7 @@ void writePlaceholderMap(const std::map<size_t, Name> placeholderMap,
 
 void splitModule(const WasmSplitOptions& options) {
   Module wasm;
-  parseInput(wasm, options);
+  parseInput(wasm, options, options.inputFiles[0]);
 
   std::set<Name> keepFuncs;
 
@@ -329,6 +335,147 @@ void splitModule(const WasmSplitOptions& options) {
   writeModule(*secondary, options.secondaryOutput, options);
 }
 
+void multiSplitModule(const WasmSplitOptions& options) {
+  Module wasm;
+  parseInput(wasm, options, options.inputFiles[0]);
+
+  // Parse the manifest: an ordered list of the output modules with the
+  // functions that will be split into each of them.
+  std::ifstream manifest(options.manifestFile);
+  if (!manifest.is_open()) {
+    Fatal() << "File not found: " << options.manifestFile;
+  }
+  std::vector<std::pair<std::string, std::set<Name>>> splitModules;
+  std::unordered_map<Name, std::string> funcModules;
+  std::string line;
+  while (std::getline(manifest, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    if (line.back() == ':') {
+      splitModules.push_back({line.substr(0, line.size() - 1), {}});
+      continue;
+    }
+    if (splitModules.empty()) {
+      Fatal() << "Manifest must begin with the name of an output module "
+              << "followed by a colon";
+    }
+    Name func = line;
+    auto [it, inserted] = funcModules.insert({func, splitModules.back().first});
+    if (!inserted && it->second != splitModules.back().first) {
+      Fatal() << "error: function " << func << " cannot be split into both "
+              << it->second << " and " << splitModules.back().first;
+    }
+    if (!options.quiet && wasm.getFunctionOrNull(func) == nullptr) {
+      std::cerr << "warning: function " << func << " does not exist\n";
+    }
+    splitModules.back().second.insert(func);
+  }
+  if (!options.quiet && splitModules.empty()) {
+    std::cerr << "warning: no modules to split out\n";
+  }
+
+  ModuleSplitting::Config config;
+  if (options.importNamespace.size()) {
+    config.importNamespace = options.importNamespace;
+  }
+  if (options.placeholderNamespace.size()) {
+    config.placeholderNamespace = options.placeholderNamespace;
+  }
+  if (options.exportPrefix.size()) {
+    config.newExportPrefix = options.exportPrefix;
+  }
+  config.minimizeNewExportNames = !options.passOptions.debugInfo;
+
+  // Split out each module in turn. Each split keeps everything currently in
+  // the primary module except the functions of the current output module, so
+  // the table and trampoline setup is built up incrementally in a single
+  // pass over the input, rather than re-parsing and re-analyzing the full
+  // module once per output as repeated two-way splits would.
+  std::vector<std::unique_ptr<Module>> secondaries;
+  for (auto& [name, funcs] : splitModules) {
+    config.primaryFuncs.clear();
+    for (auto& func : wasm.functions) {
+      config.primaryFuncs.insert(func->name);
+    }
+    for (auto func : funcs) {
+      config.primaryFuncs.erase(func);
+    }
+    auto splitResults = ModuleSplitting::splitFunctions(wasm, config);
+    if (options.emitModuleNames) {
+      splitResults.secondary->name =
+        Path::getBaseName(options.outPrefix + name);
+    }
+    secondaries.push_back(std::move(splitResults.secondary));
+  }
+  if (options.emitModuleNames && !wasm.name) {
+    wasm.name = Path::getBaseName(options.output);
+  }
+
+  // Write out the primary module and all the split modules. With many output
+  // modules the writing is a significant part of the total work, so do it in
+  // parallel.
+  auto writeOutput = [&](size_t i) {
+    if (i == 0) {
+      writeModule(wasm, options.output, options);
+    } else {
+      writeModule(*secondaries[i - 1],
+                  options.outPrefix + splitModules[i - 1].first,
+                  options);
+    }
+  };
+  size_t numOutputs = secondaries.size() + 1;
+  auto numWorkers = ThreadPool::get()->size();
+  if (numWorkers == 1 || numOutputs == 1) {
+    for (size_t i = 0; i < numOutputs; ++i) {
+      writeOutput(i);
+    }
+    return;
+  }
+  std::atomic<size_t> nextOutput{0};
+  std::vector<std::function<ThreadWorkState()>> doWorkers;
+  for (size_t worker = 0; worker < numWorkers; ++worker) {
+    doWorkers.push_back([&]() {
+      auto i = nextOutput.fetch_add(1);
+      if (i >= numOutputs) {
+        return ThreadWorkState::Finished;
+      }
+      writeOutput(i);
+      if (i + 1 == numOutputs) {
+        return ThreadWorkState::Finished;
+      }
+      return ThreadWorkState::More;
+    });
+  }
+  ThreadPool::get()->work(doWorkers);
+}
+
+void mergeBackModules(const WasmSplitOptions& options) {
+  Module wasm;
+  parseInput(wasm, options, options.inputFiles[0]);
+
+  ModuleSplitting::Config config;
+  if (options.importNamespace.size()) {
+    config.importNamespace = options.importNamespace;
+  }
+  if (options.placeholderNamespace.size()) {
+    config.placeholderNamespace = options.placeholderNamespace;
+  }
+
+  // Merge each secondary module back into the primary module in turn.
+  for (size_t i = 1; i < options.inputFiles.size(); ++i) {
+    Module secondary;
+    parseInput(secondary, options, options.inputFiles[i]);
+    ModuleSplitting::mergeBack(wasm, secondary, config);
+  }
+
+  if (options.passOptions.validate && !WasmValidator().validate(wasm)) {
+    Fatal() << "error validating merged module";
+  }
+
+  writeModule(wasm, options.output, options);
+}
+
 void mergeProfiles(const WasmSplitOptions& options) {
   // Read the initial profile. We will merge other profiles into this one.
   ProfileData data = readProfile(options.inputFiles[0]);
@@ -347,27 +494,67 @@ void mergeProfiles(const WasmSplitOptions& options) {
     }
   }
 
-  // Read all the other profiles, taking the minimum nonzero timestamp for each
-  // function.
-  for (size_t i = 1; i < options.inputFiles.size(); ++i) {
-    ProfileData newData = readProfile(options.inputFiles[i]);
-    if (newData.hash != data.hash) {
-      Fatal() << "Checksum in profile " << options.inputFiles[i]
-              << " does not match hash in profile " << options.inputFiles[0];
-    }
-    if (newData.timestamps.size() != data.timestamps.size()) {
-      Fatal() << "Profile " << options.inputFiles[i]
-              << " incompatible with profile " << options.inputFiles[0];
+  // Read the other profiles in parallel, taking the minimum nonzero
+  // timestamp for each function. Each worker merges a subset of the profiles
+  // into an accumulator of its own, and the accumulators are then merged the
+  // same way below; with thousands of profiles, reading them is what
+  // dominates, not the final merge.
+  struct Accumulator {
+    std::vector<size_t> timestamps;
+    std::vector<size_t> numProfiles;
+  };
+  auto numWorkers = ThreadPool::get()->size();
+  std::vector<Accumulator> accumulators(numWorkers);
+  for (auto& acc : accumulators) {
+    acc.timestamps.resize(data.timestamps.size());
+    if (options.verbose) {
+      acc.numProfiles.resize(data.timestamps.size());
     }
+  }
+  std::atomic<size_t> nextProfile{1};
+  std::vector<std::function<ThreadWorkState()>> doWorkers;
+  for (size_t worker = 0; worker < numWorkers; worker++) {
+    auto* acc = &accumulators[worker];
+    doWorkers.push_back([&, acc]() {
+      auto i = nextProfile.fetch_add(1);
+      if (i >= options.inputFiles.size()) {
+        return ThreadWorkState::Finished;
+      }
+      ProfileData newData = readProfile(options.inputFiles[i]);
+      if (newData.hash != data.hash) {
+        Fatal() << "Checksum in profile " << options.inputFiles[i]
+                << " does not match hash in profile " << options.inputFiles[0];
+      }
+      if (newData.timestamps.size() != data.timestamps.size()) {
+        Fatal() << "Profile " << options.inputFiles[i]
+                << " incompatible with profile " << options.inputFiles[0];
+      }
+      for (size_t t = 0; t < newData.timestamps.size(); ++t) {
+        if (acc->timestamps[t] && newData.timestamps[t]) {
+          acc->timestamps[t] =
+            std::min(acc->timestamps[t], newData.timestamps[t]);
+        } else if (newData.timestamps[t]) {
+          acc->timestamps[t] = newData.timestamps[t];
+        }
+        if (!acc->numProfiles.empty() && newData.timestamps[t]) {
+          ++acc->numProfiles[t];
+        }
+      }
+      return ThreadWorkState::More;
+    });
+  }
+  ThreadPool::get()->work(doWorkers);
+
+  // Merge the accumulators into the initial profile.
+  for (auto& acc : accumulators) {
     for (size_t t = 0; t < data.timestamps.size(); ++t) {
-      if (data.timestamps[t] && newData.timestamps[t]) {
-        data.timestamps[t] =
-          std::min(data.timestamps[t], newData.timestamps[t]);
-      } else if (newData.timestamps[t]) {
-        data.timestamps[t] = newData.timestamps[t];
+      if (data.timestamps[t] && acc.timestamps[t]) {
+        data.timestamps[t] = std::min(data.timestamps[t], acc.timestamps[t]);
+      } else if (acc.timestamps[t]) {
+        data.timestamps[t] = acc.timestamps[t];
       }
-      if (options.verbose && newData.timestamps[t]) {
-        ++numProfiles[t];
+      if (options.verbose) {
+        numProfiles[t] += acc.numProfiles[t];
       }
     }
   }
@@ -429,7 +616,7 @@ void printReadableProfile(const WasmSplitOptions& options) {
   checkExists(wasmFile);
 
   Module wasm;
-  parseInput(wasm, options);
+  parseInput(wasm, options, options.inputFiles[0]);
 
   std::set<Name> keepFuncs;
   std::set<Name> splitFuncs;
@@ -469,6 +656,12 @@ int main(int argc, const char* argv[]) {
     case WasmSplitOptions::Mode::Split:
       splitModule(options);
       break;
+    case WasmSplitOptions::Mode::MultiSplit:
+      multiSplitModule(options);
+      break;
+    case WasmSplitOptions::Mode::MergeBack:
+      mergeBackModules(options);
+      break;
     case WasmSplitOptions::Mode::Instrument:
       instrumentModule(options);
       break;
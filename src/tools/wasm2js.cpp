@@ -18,6 +18,8 @@
 // wasm2js console tool
 //
 
+#include <string_view>
+
 #include "wasm2js.h"
 #include "optimization-options.h"
 #include "pass.h"
@@ -62,7 +64,9 @@ static void optimizeWasm(Module& wasm, PassOptions options) {
 template<typename T> static void printJS(Ref ast, T& output) {
   JSPrinter jser(true, true, ast);
   jser.printAst();
-  output << jser.buffer << '\n';
+  // The printer tracks how much it emitted, so we can write it all out in one
+  // go, without an extra scan for the null terminator.
+  output << std::string_view(jser.buffer, jser.used) << '\n';
 }
 
 // Traversals
@@ -589,7 +593,7 @@ private:
   void emitFunction(Ref func) {
     JSPrinter jser(true, true, func);
     jser.printAst();
-    out << jser.buffer << std::endl;
+    out << std::string_view(jser.buffer, jser.used) << std::endl;
   }
 };
 
@@ -22,13 +22,18 @@
 #define wasm_wasm_binary_h
 
 #include <cassert>
+#include <mutex>
+#include <optional>
 #include <ostream>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ir/import-utils.h"
 #include "ir/module-utils.h"
 #include "parsing.h"
 #include "support/debug.h"
+#include "support/file.h"
 #include "wasm-builder.h"
 #include "wasm-traversal.h"
 #include "wasm-validator.h"
@@ -69,6 +74,13 @@ template<typename T, typename MiniT> struct LEB {
   }
 
   void write(std::vector<uint8_t>* out) {
+    // Fast path: a single byte, the overwhelmingly common case.
+    if (std::is_signed<T>::value
+          ? (value >= -64 && value < 64)
+          : typename std::make_unsigned<T>::type(value) < 128) {
+      out->push_back(uint8_t(value) & 127);
+      return;
+    }
     T temp = value;
     bool more;
     do {
@@ -101,7 +113,8 @@ template<typename T, typename MiniT> struct LEB {
     return offset;
   }
 
-  LEB<T, MiniT>& read(std::function<MiniT()> get) {
+  // Templated on the getter to avoid std::function overhead per byte.
+  template<typename F> LEB<T, MiniT>& read(F get) {
     value = 0;
     T shift = 0;
     MiniT byte;
@@ -417,6 +430,8 @@ extern const char* Dylink0;
 extern const char* Linking;
 extern const char* Producers;
 extern const char* TargetFeatures;
+extern const char* BranchHint;
+extern const char* Checksums;
 
 extern const char* AtomicsFeature;
 extern const char* BulkMemoryFeature;
@@ -1248,6 +1263,20 @@ public:
     prepare();
   }
 
+private:
+  // Makes a per-worker writer for parallel body encoding, copying the
+  // prepared state from the parent rather than recomputing it (which also
+  // guarantees identical type indices, and hence identical bytes).
+  WasmBinaryWriter(Module* input,
+                   BufferWithRandomAccess& o,
+                   const WasmBinaryWriter& parent)
+    : wasm(input), o(o), indexes(parent.indexes),
+      indexedTypes(parent.indexedTypes), debugInfo(parent.debugInfo) {
+    importInfo = wasm::make_unique<ImportInfo>(*wasm);
+  }
+
+public:
+
   // locations in the output binary for the various parts of the module
   struct TableOfContents {
     struct Entry {
@@ -1271,6 +1300,48 @@ public:
   }
   void setSymbolMap(std::string set) { symbolMap = set; }
 
+  // Set a streaming sink. When one is set, finished sections are flushed to
+  // it as they are completed, so the whole module is never resident in the
+  // buffer at once; the output is byte-identical to the buffered path. In
+  // fast mode, when the sink is also seekable, function bodies in the code
+  // section (usually by far the largest section) are flushed one by one, with
+  // a padded section size backpatched through a seek at the end - fast mode
+  // already keeps padded size LEBs elsewhere. Ignored when writing a source
+  // map, which records absolute buffer offsets.
+  void setSink(std::ostream* sink_) { sink = sink_; }
+
+  // Flush the buffer to the sink, if one is set (and no source map is being
+  // written). Only valid at points where the buffer holds complete,
+  // backpatched output.
+  void flushToSink();
+
+  // Emit a trailing "checksums" user section: a digest of each section's
+  // payload (see fastHash in support/hash.h), computed from the bytes as
+  // each section is finished, so verifiers need not re-read the artifact.
+  // The digests match what ModuleUtils::computeBinaryDigests produces for
+  // the sections preceding the manifest.
+  void setEmitChecksums(bool emitChecksums_) {
+    emitChecksums = emitChecksums_;
+  }
+
+  // Encode function bodies on the thread pool. Each worker serializes bodies
+  // into a buffer of its own, and the slices are concatenated in function
+  // order afterward, so the output is byte-identical to a sequential write.
+  // Ignored when writing a source map or DWARF, which track offsets in the
+  // single output buffer.
+  void setParallelBodies(bool parallelBodies_) {
+    parallelBodies = parallelBodies_;
+  }
+
+  // Trade a little code size for faster writing: skip the type-frequency
+  // sorting when assigning type indices, and emit size LEBs at their full
+  // fixed width so finished bytes never need to be shifted backwards. The
+  // output is a valid module, just slightly larger; useful for intermediate
+  // binaries that will be read again rather than shipped. Ignored when
+  // writing a source map or DWARF, which expect minimal LEBs when tracking
+  // offsets.
+  void setFast(bool fast_) { fast = fast_; }
+
   void write();
   void writeHeader();
   int32_t writeU32LEBPlaceholder();
@@ -1278,6 +1349,9 @@ public:
     Address initial, Address maximum, bool hasMaximum, bool shared, bool is64);
   template<typename T> int32_t startSection(T code);
   void finishSection(int32_t start);
+  // Like finishSection, but does not flush to the sink; used for subsections,
+  // which finish while their enclosing section is still in progress.
+  void patchSectionSize(int32_t start);
   int32_t startSubsection(BinaryConsts::UserSections::Subsection code);
   void finishSubsection(int32_t start);
   void writeStart();
@@ -1287,7 +1361,28 @@ public:
 
   void writeFunctionSignatures();
   void writeExpression(Expression* curr);
+  // The location of one function's code entry in the buffer: its size field,
+  // and the offset and length of its contents (locals and body).
+  struct CodeEntry {
+    size_t sizePos;
+    size_t contentsOffset;
+    size_t size;
+  };
+
   void writeFunctions();
+  // Writes one function's code entry (size field, locals, body) into the
+  // buffer, backpatching its size, and returns its location.
+  CodeEntry writeFunction(Function* func, bool DWARF);
+  // Writes the branch hinting proposal's custom section, which must precede
+  // the code section even though it records instruction offsets within it.
+  // We therefore emit fixed-width placeholders for the offsets and hint
+  // values here, and backpatch them as the hinted instructions are written;
+  // see noteBranchHint. Streaming and parallel body encoding are disabled
+  // when hints are present, as backpatching needs the single buffer.
+  void writeBranchHints();
+  // Writes all function code entries on the thread pool; see
+  // setParallelBodies.
+  void writeFunctionsParallel(bool stream);
   void writeStrings();
   void writeGlobals();
   void writeExports();
@@ -1310,6 +1405,7 @@ public:
   void writeLateUserSections();
   void writeUserSection(const UserSection& section);
   void writeFeaturesSection();
+  void writeChecksumsSection();
   void writeDylinkSection();
   void writeLegacyDylinkSection();
 
@@ -1321,6 +1417,12 @@ public:
   void writeDebugLocationEnd(Expression* curr, Function* func);
   void writeExtraDebugLocation(Expression* curr, Function* func, size_t id);
 
+  // Called as a conditional branch instruction is about to be emitted at
+  // codePos in the buffer. If the function has a branch hint for it, this
+  // backpatches the next placeholder in the branch hints section; see
+  // writeBranchHints.
+  void noteBranchHint(Function* func, Expression* curr, size_t codePos);
+
   // helpers
   void writeInlineString(const char* name);
   void writeEscapedName(const char* name);
@@ -1367,6 +1469,19 @@ private:
   std::string sourceMapUrl;
   std::string symbolMap;
 
+  bool parallelBodies = false;
+  bool fast = false;
+  bool emitChecksums = false;
+  // (section id, digest of the section payload), in binary order.
+  std::vector<std::pair<uint8_t, uint64_t>> sectionChecksums;
+
+  // Streaming output state, see setSink().
+  std::ostream* sink = nullptr;
+  bool sinkSeekable = false;
+  // How many bytes have been flushed to the sink; the absolute file offset of
+  // buffer position p is flushedBytes + p.
+  size_t flushedBytes = 0;
+
   MixedArena allocator;
 
   // storage of source map locations until the section is placed at its final
@@ -1386,6 +1501,22 @@ private:
   // the function is written out.
   std::vector<Expression*> binaryLocationTrackedExpressionsForFunc;
 
+  // Backpatching state for the branch hints section: for each hinted
+  // function, the hinted expressions that are present in its body, and the
+  // buffer positions of their offset and value placeholders, consumed in
+  // emission order (which is offset order, as required by the section). See
+  // writeBranchHints.
+  struct BranchHintSlots {
+    std::unordered_set<Expression*> expressions;
+    std::vector<size_t> offsetPositions;
+    std::vector<size_t> valuePositions;
+    size_t used = 0;
+  };
+  std::unordered_map<Function*, BranchHintSlots> branchHintSlots;
+  // Where the current function's locals begin in the buffer, the base that
+  // branch hint offsets are relative to.
+  size_t currFunctionBodyStart = 0;
+
   // Maps function names to their mapped locals. This is used when we emit the
   // local names section: we map the locals when writing the function, save that
   // info here, and then use it when writing the names.
@@ -1397,15 +1528,30 @@ private:
   void prepare();
 };
 
+class LazyFunctionBodies;
+class BinaryIndex;
+
 class WasmBinaryBuilder {
+  friend class LazyFunctionBodies;
+
   Module& wasm;
   MixedArena& allocator;
-  const std::vector<char>& input;
+  // The binary being read. A non-owning view, so that the caller can keep the
+  // bytes in whatever form is convenient (a vector, or a memory-mapped file).
+  BufferView input;
   std::istream* sourceMap;
+  // The entire source map, read into memory up front: parsing scans it a
+  // character at a time, which is far too slow to do through the stream.
+  std::string sourceMapContents;
+  size_t sourceMapPos = 0;
   std::pair<uint32_t, Function::DebugLocation> nextDebugLocation;
   bool debugInfo = true;
   bool DWARF = false;
   bool skipFunctionBodies = false;
+  bool parallelBodies = false;
+  LazyFunctionBodies* lazyBodies = nullptr;
+  std::optional<std::set<BinaryConsts::Section>> onlySections;
+  const BinaryIndex* binaryIndex = nullptr;
 
   size_t pos = 0;
   Index startIndex = -1;
@@ -1418,15 +1564,43 @@ class WasmBinaryBuilder {
   std::vector<HeapType> types;
 
 public:
-  WasmBinaryBuilder(Module& wasm,
-                    FeatureSet features,
-                    const std::vector<char>& input);
+  WasmBinaryBuilder(Module& wasm, FeatureSet features, BufferView input);
 
   void setDebugInfo(bool value) { debugInfo = value; }
   void setDWARF(bool value) { DWARF = value; }
   void setSkipFunctionBodies(bool skipFunctionBodies_) {
     skipFunctionBodies = skipFunctionBodies_;
   }
+  // Decode function bodies on the thread pool. The code section records each
+  // body's size, so we can slice it into per-function byte ranges and parse
+  // them independently, which greatly speeds up reading of large modules. This
+  // is not usable when reading DWARF or a source map, as those interleave
+  // per-instruction state with the decoding.
+  void setParallelBodies(bool parallelBodies_) {
+    parallelBodies = parallelBodies_;
+  }
+  // Leave function bodies unparsed, recording their byte ranges in the given
+  // object so they can be built on demand later. See LazyFunctionBodies.
+  void setLazyBodies(LazyFunctionBodies* lazyBodies_) {
+    lazyBodies = lazyBodies_;
+  }
+  // Use a sidecar index while reading, so that the code section need not be
+  // scanned to find the function bodies; see BinaryIndex. The caller must
+  // have checked that the index matches the input, and must keep it alive for
+  // the duration of the read.
+  void setBinaryIndex(const BinaryIndex* binaryIndex_) {
+    binaryIndex = binaryIndex_;
+  }
+  // Read only the given sections, seeking past all the others using their size
+  // headers. User (custom) sections are kept iff Section::User is included
+  // (whether the names section is then parsed still depends on setDebugInfo).
+  // The caller must request a coherent subset: for example, the code section
+  // cannot be read without the type, import and function sections, and the
+  // DataCount section must not be read without the data section. Skipped
+  // sections are simply absent from the resulting module.
+  void setOnlySections(std::set<BinaryConsts::Section> sections) {
+    onlySections = std::move(sections);
+  }
   void read();
   void readUserSection(size_t payloadLen);
 
@@ -1459,6 +1633,9 @@ public:
   HeapType getIndexedHeapType();
 
   Type getConcreteType();
+  // Reads an inline string as raw bytes, without interning it as a Name; used
+  // by readNames to intern whole batches of names at once.
+  std::string getInlineStringContents();
   Name getInlineString();
   void verifyInt8(int8_t x);
   void verifyInt16(int16_t x);
@@ -1502,6 +1679,11 @@ public:
 
   // we store functions here before wasm.addFunction after we know their names
   std::vector<Function*> functions;
+  // Functions created during reading with a body shared with a byte-identical
+  // function (duplicate, representative). The shared trees are split into
+  // separate copies once name backpatching has resolved them; nothing outside
+  // the reader ever sees a shared body.
+  std::vector<std::pair<Function*, Function*>> sharedBodyFunctions;
   // we store function imports here before wasm.addFunctionImport after we know
   // their names
   std::vector<Function*> functionImports;
@@ -1540,7 +1722,36 @@ public:
   // Throws a parsing error if we are not in a function context
   void requireFunctionContext(const char* error);
 
+  // The byte range of one function body in the code section. sizePos is where
+  // the size field begins, and bodyPos is just after it, where the locals and
+  // instructions begin; the body occupies [bodyPos, bodyPos + size).
+  struct FunctionBodyRange {
+    size_t sizePos;
+    size_t bodyPos;
+    size_t size;
+  };
+
   void readFunctions();
+  // Reads a single function definition, with pos placed just after the
+  // function's size field (at sizePos), and returns it. Leaves pos at the end
+  // of the function.
+  Function* readFunctionDefinition(Index index, size_t sizePos, size_t size);
+  // Reads the locals and body of func, with pos placed at the start of the
+  // locals (just after the size field).
+  void readFunctionBody(Function* func, Index index, size_t size);
+  // Reads all function definitions on the thread pool, given the byte ranges
+  // of their bodies, which were found by scanning the code section.
+  // |duplicateOf| gives, for each function, the index of the earlier function
+  // with a byte-identical body, or NoDuplicateBody; duplicates are not
+  // decoded but share their representative's body.
+  void readFunctionsParallel(std::vector<FunctionBodyRange>& ranges,
+                             const std::vector<Index>& duplicateOf);
+  static const Index NoDuplicateBody = Index(-1);
+  // Makes a Function sharing the body of |rep|, noting it for the later
+  // split in splitSharedBodies().
+  Function* makeSharedBodyDuplicate(Index index, Function* rep);
+  // Gives each duplicate its own copy of the (now fully backpatched) body.
+  void splitSharedBodies();
   void readVars();
 
   std::map<Export*, Index> exportIndices;
@@ -1626,10 +1837,26 @@ public:
   void readFeatures(size_t);
   void readDylink(size_t);
   void readDylink0(size_t);
+  void readBranchHints(size_t payloadLen);
+
+  // Branch hints parsed from the branch hinting proposal's custom section
+  // (which precedes the code section): for each function index, the offset of
+  // each hinted instruction within the function body, and whether it is
+  // likely. Applied to the If, conditional Break, and BrOn expressions as the
+  // bodies are parsed.
+  std::unordered_map<Index, std::unordered_map<size_t, bool>> branchHints;
+  // While reading one function body, the hints for that function (or null),
+  // and where the body (its locals) begins, the base hint offsets are
+  // relative to.
+  const std::unordered_map<size_t, bool>* currBranchHints = nullptr;
+  size_t currBodyStart = 0;
 
   // Debug information reading helpers
   void setDebugLocations(std::istream* sourceMap_) { sourceMap = sourceMap_; }
   std::unordered_map<std::string, Index> debugInfoFileIndices;
+  int peekSourceMapChar();
+  int getSourceMapChar();
+  int32_t readBase64VLQ();
   void readNextDebugLocation();
   void readSourceMapHeader();
 
@@ -1714,6 +1941,14 @@ public:
   bool maybeVisitStringIterMove(Expression*& out, uint32_t code);
   bool maybeVisitStringSliceWTF(Expression*& out, uint32_t code);
   bool maybeVisitStringSliceIter(Expression*& out, uint32_t code);
+  // One of the maybeVisit* methods above that decode a prefixed opcode.
+  using PrefixedVisitor = bool (WasmBinaryBuilder::*)(Expression*&, uint32_t);
+  // Dispatch a prefixed opcode directly to the method that decodes it, using
+  // a dense table indexed by opcode, rather than trying each method in turn.
+  // Returns false if the opcode has no decoder.
+  bool dispatchMisc(Expression*& out, uint32_t code);
+  bool dispatchSIMD(Expression*& out, uint32_t code);
+  bool dispatchGC(Expression*& out, uint32_t code);
   void visitSelect(Select* curr, uint8_t code);
   void visitReturn(Return* curr);
   void visitMemorySize(MemorySize* curr);
@@ -1746,6 +1981,101 @@ private:
   bool hasDWARFSections();
 };
 
+// Retains the input binary and enough reader context to build function bodies
+// that a lazy read left unparsed. In lazy mode the reader creates each
+// Function with its final name and type but a null body, and records the
+// body's byte range here; materialize() then builds a body on first demand.
+// Tools that mostly walk the module skeleton (exports, segments, the call
+// graph of a few functions) thus never pay to decode bodies they do not
+// touch. All bodies that survive into output must be materialized before the
+// module is validated, optimized, or written.
+class LazyFunctionBodies {
+public:
+  LazyFunctionBodies(Module& wasm, std::vector<char>&& input);
+  LazyFunctionBodies(Module& wasm, std::shared_ptr<MappedFile> input);
+  ~LazyFunctionBodies();
+
+  // The input binary, which we own so that lazy bodies can refer into it.
+  BufferView getInput() const { return input; }
+
+  // Called by ModuleReader when the initial (body-less) read is done, to
+  // copy the context the materializing builder needs.
+  void finishReading(WasmBinaryBuilder& parser);
+
+  // Whether func still has an unparsed body.
+  bool isLazy(Function* func);
+
+  // Build the body of func, if it has not been built yet. Safe to call from
+  // multiple threads.
+  void materialize(Function* func);
+
+  // Build every body that has not been built yet.
+  void materializeAll();
+
+private:
+  friend class WasmBinaryBuilder;
+
+  Module& wasm;
+  // The input storage, in whichever form we were handed, and a view of it.
+  std::vector<char> ownedInput;
+  std::shared_ptr<MappedFile> mappedInput;
+  BufferView input;
+  std::unique_ptr<WasmBinaryBuilder> builder;
+  struct LazyBody {
+    WasmBinaryBuilder::FunctionBodyRange range;
+    // The index of the function among the defined (non-imported) functions.
+    Index index;
+  };
+  std::unordered_map<Function*, LazyBody> ranges;
+  std::mutex mutex;
+
+  void materializeLocked(Function* func);
+};
+
+// A sidecar index for a wasm binary, for tools that repeatedly open the same
+// (often very large) module. It records the byte range of every function body
+// in the code section, so that a reader can seek directly to any body without
+// scanning the code section at all; combined with lazy function bodies this
+// makes the startup latency of per-function tooling independent of the code
+// section size.
+//
+// An index must be validated against the module before use: we store the
+// module size, the location of the code section payload, and a digest of
+// every byte outside that payload, and matches() checks all of them plus the
+// bounds of the recorded ranges. If the module changed, readers simply fall
+// back to scanning, so a stale index costs nothing. (The code payload itself
+// is not digested - skipping it is the very work the index saves - so an edit
+// that changes only body bytes while preserving every size and everything
+// outside the payload goes undetected; the ranges are still bounds-checked,
+// leaving us no worse off than when reading a corrupted binary.)
+class BinaryIndex {
+public:
+  // The byte ranges of the defined functions' bodies, in order.
+  std::vector<WasmBinaryBuilder::FunctionBodyRange> ranges;
+
+  // Build an index for a module by scanning its section headers.
+  static BinaryIndex build(BufferView module);
+
+  // Whether this index describes the given module.
+  bool matches(BufferView module) const;
+
+  // Write the index to a sidecar file, and read one back. Reading throws a
+  // ParseException on a malformed or unsupported index file.
+  void write(const std::string& filename) const;
+  static BinaryIndex read(const std::string& filename);
+
+private:
+  size_t moduleSize = 0;
+  // The range of the code section payload in the module.
+  size_t codePos = 0;
+  size_t codeSize = 0;
+  // Digest of all the module's bytes outside the code section payload.
+  uint64_t digest = 0;
+
+  static uint64_t
+  computeDigest(BufferView module, size_t codePos, size_t codeSize);
+};
+
 } // namespace wasm
 
 #undef DEBUG_TYPE
@@ -37,8 +37,18 @@ struct NameType {
 class Builder {
   Module& wasm;
 
+  // The arena we allocate expressions in. Normally this is the module's
+  // arena, which is what is needed for any expression that may end up in the
+  // module's IR. Read-only analyses that build scratch expressions which are
+  // guaranteed to never be spliced into the IR can use a separate arena that
+  // they drop when they are done, so that the module's arena (which is only
+  // freed when the module dies) is not permanently grown by temporaries.
+  MixedArena& allocator;
+
 public:
-  Builder(Module& wasm) : wasm(wasm) {}
+  Builder(Module& wasm) : wasm(wasm), allocator(wasm.allocator) {}
+  Builder(Module& wasm, MixedArena& allocator)
+    : wasm(wasm), allocator(allocator) {}
 
   // make* functions create an expression instance.
 
@@ -152,9 +162,9 @@ public:
 
   // IR nodes
 
-  Nop* makeNop() { return wasm.allocator.alloc<Nop>(); }
+  Nop* makeNop() { return allocator.alloc<Nop>(); }
   Block* makeBlock(Expression* first = nullptr) {
-    auto* ret = wasm.allocator.alloc<Block>();
+    auto* ret = allocator.alloc<Block>();
     if (first) {
       ret->list.push_back(first);
       ret->finalize();
@@ -168,38 +178,38 @@ public:
     return ret;
   }
   Block* makeBlock(const std::vector<Expression*>& items) {
-    auto* ret = wasm.allocator.alloc<Block>();
+    auto* ret = allocator.alloc<Block>();
     ret->list.set(items);
     ret->finalize();
     return ret;
   }
   Block* makeBlock(const std::vector<Expression*>& items, Type type) {
-    auto* ret = wasm.allocator.alloc<Block>();
+    auto* ret = allocator.alloc<Block>();
     ret->list.set(items);
     ret->finalize(type);
     return ret;
   }
   Block* makeBlock(const ExpressionList& items) {
-    auto* ret = wasm.allocator.alloc<Block>();
+    auto* ret = allocator.alloc<Block>();
     ret->list.set(items);
     ret->finalize();
     return ret;
   }
   Block* makeBlock(const ExpressionList& items, Type type) {
-    auto* ret = wasm.allocator.alloc<Block>();
+    auto* ret = allocator.alloc<Block>();
     ret->list.set(items);
     ret->finalize(type);
     return ret;
   }
   Block* makeBlock(Name name, const ExpressionList& items) {
-    auto* ret = wasm.allocator.alloc<Block>();
+    auto* ret = allocator.alloc<Block>();
     ret->name = name;
     ret->list.set(items);
     ret->finalize();
     return ret;
   }
   Block* makeBlock(Name name, const ExpressionList& items, Type type) {
-    auto* ret = wasm.allocator.alloc<Block>();
+    auto* ret = allocator.alloc<Block>();
     ret->name = name;
     ret->list.set(items);
     ret->finalize(type);
@@ -208,7 +218,7 @@ public:
   If* makeIf(Expression* condition,
              Expression* ifTrue,
              Expression* ifFalse = nullptr) {
-    auto* ret = wasm.allocator.alloc<If>();
+    auto* ret = allocator.alloc<If>();
     ret->condition = condition;
     ret->ifTrue = ifTrue;
     ret->ifFalse = ifFalse;
@@ -219,7 +229,7 @@ public:
              Expression* ifTrue,
              Expression* ifFalse,
              Type type) {
-    auto* ret = wasm.allocator.alloc<If>();
+    auto* ret = allocator.alloc<If>();
     ret->condition = condition;
     ret->ifTrue = ifTrue;
     ret->ifFalse = ifFalse;
@@ -227,14 +237,14 @@ public:
     return ret;
   }
   Loop* makeLoop(Name name, Expression* body) {
-    auto* ret = wasm.allocator.alloc<Loop>();
+    auto* ret = allocator.alloc<Loop>();
     ret->name = name;
     ret->body = body;
     ret->finalize();
     return ret;
   }
   Loop* makeLoop(Name name, Expression* body, Type type) {
-    auto* ret = wasm.allocator.alloc<Loop>();
+    auto* ret = allocator.alloc<Loop>();
     ret->name = name;
     ret->body = body;
     ret->finalize(type);
@@ -243,7 +253,7 @@ public:
   Break* makeBreak(Name name,
                    Expression* value = nullptr,
                    Expression* condition = nullptr) {
-    auto* ret = wasm.allocator.alloc<Break>();
+    auto* ret = allocator.alloc<Break>();
     ret->name = name;
     ret->value = value;
     ret->condition = condition;
@@ -255,7 +265,7 @@ public:
                      Name default_,
                      Expression* condition,
                      Expression* value = nullptr) {
-    auto* ret = wasm.allocator.alloc<Switch>();
+    auto* ret = allocator.alloc<Switch>();
     ret->targets.set(list);
     ret->default_ = default_;
     ret->value = value;
@@ -266,7 +276,7 @@ public:
                  const std::vector<Expression*>& args,
                  Type type,
                  bool isReturn = false) {
-    auto* call = wasm.allocator.alloc<Call>();
+    auto* call = allocator.alloc<Call>();
     // not all functions may exist yet, so type must be provided
     call->type = type;
     call->target = target;
@@ -276,7 +286,7 @@ public:
   }
   template<typename T>
   Call* makeCall(Name target, const T& args, Type type, bool isReturn = false) {
-    auto* call = wasm.allocator.alloc<Call>();
+    auto* call = allocator.alloc<Call>();
     // not all functions may exist yet, so type must be provided
     call->type = type;
     call->target = target;
@@ -292,7 +302,7 @@ public:
                                  HeapType heapType,
                                  bool isReturn = false) {
     assert(heapType.isSignature());
-    auto* call = wasm.allocator.alloc<CallIndirect>();
+    auto* call = allocator.alloc<CallIndirect>();
     call->table = table;
     call->heapType = heapType;
     call->type = heapType.getSignature().results;
@@ -307,7 +317,7 @@ public:
                        const T& args,
                        Type type,
                        bool isReturn = false) {
-    auto* call = wasm.allocator.alloc<CallRef>();
+    auto* call = allocator.alloc<CallRef>();
     call->type = type;
     call->target = target;
     call->operands.set(args);
@@ -316,13 +326,13 @@ public:
     return call;
   }
   LocalGet* makeLocalGet(Index index, Type type) {
-    auto* ret = wasm.allocator.alloc<LocalGet>();
+    auto* ret = allocator.alloc<LocalGet>();
     ret->index = index;
     ret->type = type;
     return ret;
   }
   LocalSet* makeLocalSet(Index index, Expression* value) {
-    auto* ret = wasm.allocator.alloc<LocalSet>();
+    auto* ret = allocator.alloc<LocalSet>();
     ret->index = index;
     ret->value = value;
     ret->makeSet();
@@ -330,20 +340,20 @@ public:
     return ret;
   }
   LocalSet* makeLocalTee(Index index, Expression* value, Type type) {
-    auto* ret = wasm.allocator.alloc<LocalSet>();
+    auto* ret = allocator.alloc<LocalSet>();
     ret->index = index;
     ret->value = value;
     ret->makeTee(type);
     return ret;
   }
   GlobalGet* makeGlobalGet(Name name, Type type) {
-    auto* ret = wasm.allocator.alloc<GlobalGet>();
+    auto* ret = allocator.alloc<GlobalGet>();
     ret->name = name;
     ret->type = type;
     return ret;
   }
   GlobalSet* makeGlobalSet(Name name, Expression* value) {
-    auto* ret = wasm.allocator.alloc<GlobalSet>();
+    auto* ret = allocator.alloc<GlobalSet>();
     ret->name = name;
     ret->value = value;
     ret->finalize();
@@ -355,7 +365,7 @@ public:
                  unsigned align,
                  Expression* ptr,
                  Type type) {
-    auto* ret = wasm.allocator.alloc<Load>();
+    auto* ret = allocator.alloc<Load>();
     ret->isAtomic = false;
     ret->bytes = bytes;
     ret->signed_ = signed_;
@@ -376,7 +386,7 @@ public:
                              Expression* timeout,
                              Type expectedType,
                              Address offset) {
-    auto* wait = wasm.allocator.alloc<AtomicWait>();
+    auto* wait = allocator.alloc<AtomicWait>();
     wait->offset = offset;
     wait->ptr = ptr;
     wait->expected = expected;
@@ -387,21 +397,21 @@ public:
   }
   AtomicNotify*
   makeAtomicNotify(Expression* ptr, Expression* notifyCount, Address offset) {
-    auto* notify = wasm.allocator.alloc<AtomicNotify>();
+    auto* notify = allocator.alloc<AtomicNotify>();
     notify->offset = offset;
     notify->ptr = ptr;
     notify->notifyCount = notifyCount;
     notify->finalize();
     return notify;
   }
-  AtomicFence* makeAtomicFence() { return wasm.allocator.alloc<AtomicFence>(); }
+  AtomicFence* makeAtomicFence() { return allocator.alloc<AtomicFence>(); }
   Store* makeStore(unsigned bytes,
                    uint32_t offset,
                    unsigned align,
                    Expression* ptr,
                    Expression* value,
                    Type type) {
-    auto* ret = wasm.allocator.alloc<Store>();
+    auto* ret = allocator.alloc<Store>();
     ret->isAtomic = false;
     ret->bytes = bytes;
     ret->offset = offset;
@@ -428,7 +438,7 @@ public:
                            Expression* ptr,
                            Expression* value,
                            Type type) {
-    auto* ret = wasm.allocator.alloc<AtomicRMW>();
+    auto* ret = allocator.alloc<AtomicRMW>();
     ret->op = op;
     ret->bytes = bytes;
     ret->offset = offset;
@@ -444,7 +454,7 @@ public:
                                    Expression* expected,
                                    Expression* replacement,
                                    Type type) {
-    auto* ret = wasm.allocator.alloc<AtomicCmpxchg>();
+    auto* ret = allocator.alloc<AtomicCmpxchg>();
     ret->bytes = bytes;
     ret->offset = offset;
     ret->ptr = ptr;
@@ -456,7 +466,7 @@ public:
   }
   SIMDExtract*
   makeSIMDExtract(SIMDExtractOp op, Expression* vec, uint8_t index) {
-    auto* ret = wasm.allocator.alloc<SIMDExtract>();
+    auto* ret = allocator.alloc<SIMDExtract>();
     ret->op = op;
     ret->vec = vec;
     ret->index = index;
@@ -467,7 +477,7 @@ public:
                                Expression* vec,
                                uint8_t index,
                                Expression* value) {
-    auto* ret = wasm.allocator.alloc<SIMDReplace>();
+    auto* ret = allocator.alloc<SIMDReplace>();
     ret->op = op;
     ret->vec = vec;
     ret->index = index;
@@ -478,7 +488,7 @@ public:
   SIMDShuffle* makeSIMDShuffle(Expression* left,
                                Expression* right,
                                const std::array<uint8_t, 16>& mask) {
-    auto* ret = wasm.allocator.alloc<SIMDShuffle>();
+    auto* ret = allocator.alloc<SIMDShuffle>();
     ret->left = left;
     ret->right = right;
     ret->mask = mask;
@@ -489,7 +499,7 @@ public:
                                Expression* a,
                                Expression* b,
                                Expression* c) {
-    auto* ret = wasm.allocator.alloc<SIMDTernary>();
+    auto* ret = allocator.alloc<SIMDTernary>();
     ret->op = op;
     ret->a = a;
     ret->b = b;
@@ -498,7 +508,7 @@ public:
     return ret;
   }
   SIMDShift* makeSIMDShift(SIMDShiftOp op, Expression* vec, Expression* shift) {
-    auto* ret = wasm.allocator.alloc<SIMDShift>();
+    auto* ret = allocator.alloc<SIMDShift>();
     ret->op = op;
     ret->vec = vec;
     ret->shift = shift;
@@ -507,7 +517,7 @@ public:
   }
   SIMDLoad*
   makeSIMDLoad(SIMDLoadOp op, Address offset, Address align, Expression* ptr) {
-    auto* ret = wasm.allocator.alloc<SIMDLoad>();
+    auto* ret = allocator.alloc<SIMDLoad>();
     ret->op = op;
     ret->offset = offset;
     ret->align = align;
@@ -521,7 +531,7 @@ public:
                                            uint8_t index,
                                            Expression* ptr,
                                            Expression* vec) {
-    auto* ret = wasm.allocator.alloc<SIMDLoadStoreLane>();
+    auto* ret = allocator.alloc<SIMDLoadStoreLane>();
     ret->op = op;
     ret->offset = offset;
     ret->align = align;
@@ -535,7 +545,7 @@ public:
                              Expression* dest,
                              Expression* offset,
                              Expression* size) {
-    auto* ret = wasm.allocator.alloc<MemoryInit>();
+    auto* ret = allocator.alloc<MemoryInit>();
     ret->segment = segment;
     ret->dest = dest;
     ret->offset = offset;
@@ -544,14 +554,14 @@ public:
     return ret;
   }
   DataDrop* makeDataDrop(uint32_t segment) {
-    auto* ret = wasm.allocator.alloc<DataDrop>();
+    auto* ret = allocator.alloc<DataDrop>();
     ret->segment = segment;
     ret->finalize();
     return ret;
   }
   MemoryCopy*
   makeMemoryCopy(Expression* dest, Expression* source, Expression* size) {
-    auto* ret = wasm.allocator.alloc<MemoryCopy>();
+    auto* ret = allocator.alloc<MemoryCopy>();
     ret->dest = dest;
     ret->source = source;
     ret->size = size;
@@ -560,7 +570,7 @@ public:
   }
   MemoryFill*
   makeMemoryFill(Expression* dest, Expression* value, Expression* size) {
-    auto* ret = wasm.allocator.alloc<MemoryFill>();
+    auto* ret = allocator.alloc<MemoryFill>();
     ret->dest = dest;
     ret->value = value;
     ret->size = size;
@@ -569,14 +579,14 @@ public:
   }
   Const* makeConst(Literal value) {
     assert(value.type.isNumber());
-    auto* ret = wasm.allocator.alloc<Const>();
+    auto* ret = allocator.alloc<Const>();
     ret->value = value;
     ret->type = value.type;
     return ret;
   }
   template<typename T> Const* makeConst(T x) { return makeConst(Literal(x)); }
   Unary* makeUnary(UnaryOp op, Expression* value) {
-    auto* ret = wasm.allocator.alloc<Unary>();
+    auto* ret = allocator.alloc<Unary>();
     ret->op = op;
     ret->value = value;
     ret->finalize();
@@ -586,7 +596,7 @@ public:
     return makeConst(Literal::makeFromInt64(val, wasm.memory.indexType));
   }
   Binary* makeBinary(BinaryOp op, Expression* left, Expression* right) {
-    auto* ret = wasm.allocator.alloc<Binary>();
+    auto* ret = allocator.alloc<Binary>();
     ret->op = op;
     ret->left = left;
     ret->right = right;
@@ -595,7 +605,7 @@ public:
   }
   Select*
   makeSelect(Expression* condition, Expression* ifTrue, Expression* ifFalse) {
-    auto* ret = wasm.allocator.alloc<Select>();
+    auto* ret = allocator.alloc<Select>();
     ret->condition = condition;
     ret->ifTrue = ifTrue;
     ret->ifFalse = ifFalse;
@@ -606,7 +616,7 @@ public:
                      Expression* ifTrue,
                      Expression* ifFalse,
                      Type type) {
-    auto* ret = wasm.allocator.alloc<Select>();
+    auto* ret = allocator.alloc<Select>();
     ret->condition = condition;
     ret->ifTrue = ifTrue;
     ret->ifFalse = ifFalse;
@@ -614,12 +624,12 @@ public:
     return ret;
   }
   Return* makeReturn(Expression* value = nullptr) {
-    auto* ret = wasm.allocator.alloc<Return>();
+    auto* ret = allocator.alloc<Return>();
     ret->value = value;
     return ret;
   }
   MemorySize* makeMemorySize() {
-    auto* ret = wasm.allocator.alloc<MemorySize>();
+    auto* ret = allocator.alloc<MemorySize>();
     if (wasm.memory.is64()) {
       ret->make64();
     }
@@ -627,7 +637,7 @@ public:
     return ret;
   }
   MemoryGrow* makeMemoryGrow(Expression* delta) {
-    auto* ret = wasm.allocator.alloc<MemoryGrow>();
+    auto* ret = allocator.alloc<MemoryGrow>();
     if (wasm.memory.is64()) {
       ret->make64();
     }
@@ -636,37 +646,37 @@ public:
     return ret;
   }
   RefNull* makeRefNull(HeapType type) {
-    auto* ret = wasm.allocator.alloc<RefNull>();
+    auto* ret = allocator.alloc<RefNull>();
     ret->finalize(Type(type, Nullable));
     return ret;
   }
   RefNull* makeRefNull(Type type) {
-    auto* ret = wasm.allocator.alloc<RefNull>();
+    auto* ret = allocator.alloc<RefNull>();
     ret->finalize(type);
     return ret;
   }
   RefIs* makeRefIs(RefIsOp op, Expression* value) {
-    auto* ret = wasm.allocator.alloc<RefIs>();
+    auto* ret = allocator.alloc<RefIs>();
     ret->op = op;
     ret->value = value;
     ret->finalize();
     return ret;
   }
   RefFunc* makeRefFunc(Name func, HeapType heapType) {
-    auto* ret = wasm.allocator.alloc<RefFunc>();
+    auto* ret = allocator.alloc<RefFunc>();
     ret->func = func;
     ret->finalize(Type(heapType, NonNullable));
     return ret;
   }
   RefEq* makeRefEq(Expression* left, Expression* right) {
-    auto* ret = wasm.allocator.alloc<RefEq>();
+    auto* ret = allocator.alloc<RefEq>();
     ret->left = left;
     ret->right = right;
     ret->finalize();
     return ret;
   }
   TableGet* makeTableGet(Name table, Expression* index, Type type) {
-    auto* ret = wasm.allocator.alloc<TableGet>();
+    auto* ret = allocator.alloc<TableGet>();
     ret->table = table;
     ret->index = index;
     ret->type = type;
@@ -674,7 +684,7 @@ public:
     return ret;
   }
   TableSet* makeTableSet(Name table, Expression* index, Expression* value) {
-    auto* ret = wasm.allocator.alloc<TableSet>();
+    auto* ret = allocator.alloc<TableSet>();
     ret->table = table;
     ret->index = index;
     ret->value = value;
@@ -682,13 +692,13 @@ public:
     return ret;
   }
   TableSize* makeTableSize(Name table) {
-    auto* ret = wasm.allocator.alloc<TableSize>();
+    auto* ret = allocator.alloc<TableSize>();
     ret->table = table;
     ret->finalize();
     return ret;
   }
   TableGrow* makeTableGrow(Name table, Expression* value, Expression* delta) {
-    auto* ret = wasm.allocator.alloc<TableGrow>();
+    auto* ret = allocator.alloc<TableGrow>();
     ret->table = table;
     ret->value = value;
     ret->delta = delta;
@@ -704,7 +714,7 @@ private:
                Name delegateTarget,
                Type type,
                bool hasType) { // differentiate whether a type was passed in
-    auto* ret = wasm.allocator.alloc<Try>();
+    auto* ret = allocator.alloc<Try>();
     ret->name = name;
     ret->body = body;
     ret->catchTags.set(catchTags);
@@ -760,53 +770,53 @@ public:
     return makeThrow(tag->name, args);
   }
   Throw* makeThrow(Name tag, const std::vector<Expression*>& args) {
-    auto* ret = wasm.allocator.alloc<Throw>();
+    auto* ret = allocator.alloc<Throw>();
     ret->tag = tag;
     ret->operands.set(args);
     ret->finalize();
     return ret;
   }
   Rethrow* makeRethrow(Name target) {
-    auto* ret = wasm.allocator.alloc<Rethrow>();
+    auto* ret = allocator.alloc<Rethrow>();
     ret->target = target;
     ret->finalize();
     return ret;
   }
-  Unreachable* makeUnreachable() { return wasm.allocator.alloc<Unreachable>(); }
+  Unreachable* makeUnreachable() { return allocator.alloc<Unreachable>(); }
   Pop* makePop(Type type) {
-    auto* ret = wasm.allocator.alloc<Pop>();
+    auto* ret = allocator.alloc<Pop>();
     ret->type = type;
     ret->finalize();
     return ret;
   }
   template<typename ListType> TupleMake* makeTupleMake(ListType&& operands) {
-    auto* ret = wasm.allocator.alloc<TupleMake>();
+    auto* ret = allocator.alloc<TupleMake>();
     ret->operands.set(operands);
     ret->finalize();
     return ret;
   }
   TupleExtract* makeTupleExtract(Expression* tuple, Index index) {
-    auto* ret = wasm.allocator.alloc<TupleExtract>();
+    auto* ret = allocator.alloc<TupleExtract>();
     ret->tuple = tuple;
     ret->index = index;
     ret->finalize();
     return ret;
   }
   I31New* makeI31New(Expression* value) {
-    auto* ret = wasm.allocator.alloc<I31New>();
+    auto* ret = allocator.alloc<I31New>();
     ret->value = value;
     ret->finalize();
     return ret;
   }
   I31Get* makeI31Get(Expression* i31, bool signed_) {
-    auto* ret = wasm.allocator.alloc<I31Get>();
+    auto* ret = allocator.alloc<I31Get>();
     ret->i31 = i31;
     ret->signed_ = signed_;
     ret->finalize();
     return ret;
   }
   RefTest* makeRefTest(Expression* ref, HeapType intendedType) {
-    auto* ret = wasm.allocator.alloc<RefTest>();
+    auto* ret = allocator.alloc<RefTest>();
     ret->ref = ref;
     ret->intendedType = intendedType;
     ret->finalize();
@@ -814,7 +824,7 @@ public:
   }
   RefCast*
   makeRefCast(Expression* ref, HeapType intendedType, RefCast::Safety safety) {
-    auto* ret = wasm.allocator.alloc<RefCast>();
+    auto* ret = allocator.alloc<RefCast>();
     ret->ref = ref;
     ret->intendedType = intendedType;
     ret->safety = safety;
@@ -822,7 +832,7 @@ public:
     return ret;
   }
   BrOn* makeBrOn(BrOnOp op, Name name, Expression* ref) {
-    auto* ret = wasm.allocator.alloc<BrOn>();
+    auto* ret = allocator.alloc<BrOn>();
     ret->op = op;
     ret->name = name;
     ret->ref = ref;
@@ -830,7 +840,7 @@ public:
     return ret;
   }
   BrOn* makeBrOn(BrOnOp op, Name name, Expression* ref, HeapType intendedType) {
-    auto* ret = wasm.allocator.alloc<BrOn>();
+    auto* ret = allocator.alloc<BrOn>();
     ret->op = op;
     ret->name = name;
     ret->ref = ref;
@@ -839,7 +849,7 @@ public:
     return ret;
   }
   template<typename T> StructNew* makeStructNew(HeapType type, const T& args) {
-    auto* ret = wasm.allocator.alloc<StructNew>();
+    auto* ret = allocator.alloc<StructNew>();
     ret->operands.set(args);
     ret->type = Type(type, NonNullable);
     ret->finalize();
@@ -847,7 +857,7 @@ public:
   }
   StructGet*
   makeStructGet(Index index, Expression* ref, Type type, bool signed_ = false) {
-    auto* ret = wasm.allocator.alloc<StructGet>();
+    auto* ret = allocator.alloc<StructGet>();
     ret->index = index;
     ret->ref = ref;
     ret->type = type;
@@ -856,7 +866,7 @@ public:
     return ret;
   }
   StructSet* makeStructSet(Index index, Expression* ref, Expression* value) {
-    auto* ret = wasm.allocator.alloc<StructSet>();
+    auto* ret = allocator.alloc<StructSet>();
     ret->index = index;
     ret->ref = ref;
     ret->value = value;
@@ -865,7 +875,7 @@ public:
   }
   ArrayNew*
   makeArrayNew(HeapType type, Expression* size, Expression* init = nullptr) {
-    auto* ret = wasm.allocator.alloc<ArrayNew>();
+    auto* ret = allocator.alloc<ArrayNew>();
     ret->size = size;
     ret->init = init;
     ret->type = Type(type, NonNullable);
@@ -874,7 +884,7 @@ public:
   }
   ArrayInit* makeArrayInit(HeapType type,
                            const std::vector<Expression*>& values) {
-    auto* ret = wasm.allocator.alloc<ArrayInit>();
+    auto* ret = allocator.alloc<ArrayInit>();
     ret->values.set(values);
     ret->type = Type(type, NonNullable);
     ret->finalize();
@@ -882,7 +892,7 @@ public:
   }
   ArrayGet*
   makeArrayGet(Expression* ref, Expression* index, bool signed_ = false) {
-    auto* ret = wasm.allocator.alloc<ArrayGet>();
+    auto* ret = allocator.alloc<ArrayGet>();
     ret->ref = ref;
     ret->index = index;
     ret->signed_ = signed_;
@@ -891,7 +901,7 @@ public:
   }
   ArraySet*
   makeArraySet(Expression* ref, Expression* index, Expression* value) {
-    auto* ret = wasm.allocator.alloc<ArraySet>();
+    auto* ret = allocator.alloc<ArraySet>();
     ret->ref = ref;
     ret->index = index;
     ret->value = value;
@@ -899,7 +909,7 @@ public:
     return ret;
   }
   ArrayLen* makeArrayLen(Expression* ref) {
-    auto* ret = wasm.allocator.alloc<ArrayLen>();
+    auto* ret = allocator.alloc<ArrayLen>();
     ret->ref = ref;
     ret->finalize();
     return ret;
@@ -909,7 +919,7 @@ public:
                            Expression* srcRef,
                            Expression* srcIndex,
                            Expression* length) {
-    auto* ret = wasm.allocator.alloc<ArrayCopy>();
+    auto* ret = allocator.alloc<ArrayCopy>();
     ret->destRef = destRef;
     ret->destIndex = destIndex;
     ret->srcRef = srcRef;
@@ -919,7 +929,7 @@ public:
     return ret;
   }
   RefAs* makeRefAs(RefAsOp op, Expression* value) {
-    auto* ret = wasm.allocator.alloc<RefAs>();
+    auto* ret = allocator.alloc<RefAs>();
     ret->op = op;
     ret->value = value;
     ret->finalize();
@@ -927,7 +937,7 @@ public:
   }
   StringNew*
   makeStringNew(StringNewOp op, Expression* ptr, Expression* length) {
-    auto* ret = wasm.allocator.alloc<StringNew>();
+    auto* ret = allocator.alloc<StringNew>();
     ret->op = op;
     ret->ptr = ptr;
     ret->length = length;
@@ -938,7 +948,7 @@ public:
                            Expression* ptr,
                            Expression* start,
                            Expression* end) {
-    auto* ret = wasm.allocator.alloc<StringNew>();
+    auto* ret = allocator.alloc<StringNew>();
     ret->op = op;
     ret->ptr = ptr;
     ret->start = start;
@@ -947,13 +957,13 @@ public:
     return ret;
   }
   StringConst* makeStringConst(Name string) {
-    auto* ret = wasm.allocator.alloc<StringConst>();
+    auto* ret = allocator.alloc<StringConst>();
     ret->string = string;
     ret->finalize();
     return ret;
   }
   StringMeasure* makeStringMeasure(StringMeasureOp op, Expression* ref) {
-    auto* ret = wasm.allocator.alloc<StringMeasure>();
+    auto* ret = allocator.alloc<StringMeasure>();
     ret->op = op;
     ret->ref = ref;
     ret->finalize();
@@ -963,7 +973,7 @@ public:
                                  Expression* ref,
                                  Expression* ptr,
                                  Expression* start = nullptr) {
-    auto* ret = wasm.allocator.alloc<StringEncode>();
+    auto* ret = allocator.alloc<StringEncode>();
     ret->op = op;
     ret->ref = ref;
     ret->ptr = ptr;
@@ -972,21 +982,21 @@ public:
     return ret;
   }
   StringConcat* makeStringConcat(Expression* left, Expression* right) {
-    auto* ret = wasm.allocator.alloc<StringConcat>();
+    auto* ret = allocator.alloc<StringConcat>();
     ret->left = left;
     ret->right = right;
     ret->finalize();
     return ret;
   }
   StringEq* makeStringEq(Expression* left, Expression* right) {
-    auto* ret = wasm.allocator.alloc<StringEq>();
+    auto* ret = allocator.alloc<StringEq>();
     ret->left = left;
     ret->right = right;
     ret->finalize();
     return ret;
   }
   StringAs* makeStringAs(StringAsOp op, Expression* ref) {
-    auto* ret = wasm.allocator.alloc<StringAs>();
+    auto* ret = allocator.alloc<StringAs>();
     ret->op = op;
     ret->ref = ref;
     ret->finalize();
@@ -994,7 +1004,7 @@ public:
   }
   StringWTF8Advance*
   makeStringWTF8Advance(Expression* ref, Expression* pos, Expression* bytes) {
-    auto* ret = wasm.allocator.alloc<StringWTF8Advance>();
+    auto* ret = allocator.alloc<StringWTF8Advance>();
     ret->ref = ref;
     ret->pos = pos;
     ret->bytes = bytes;
@@ -1002,21 +1012,21 @@ public:
     return ret;
   }
   StringWTF16Get* makeStringWTF16Get(Expression* ref, Expression* pos) {
-    auto* ret = wasm.allocator.alloc<StringWTF16Get>();
+    auto* ret = allocator.alloc<StringWTF16Get>();
     ret->ref = ref;
     ret->pos = pos;
     ret->finalize();
     return ret;
   }
   StringIterNext* makeStringIterNext(Expression* ref) {
-    auto* ret = wasm.allocator.alloc<StringIterNext>();
+    auto* ret = allocator.alloc<StringIterNext>();
     ret->ref = ref;
     ret->finalize();
     return ret;
   }
   StringIterMove*
   makeStringIterMove(StringIterMoveOp op, Expression* ref, Expression* num) {
-    auto* ret = wasm.allocator.alloc<StringIterMove>();
+    auto* ret = allocator.alloc<StringIterMove>();
     ret->op = op;
     ret->ref = ref;
     ret->num = num;
@@ -1027,7 +1037,7 @@ public:
                                      Expression* ref,
                                      Expression* start,
                                      Expression* end) {
-    auto* ret = wasm.allocator.alloc<StringSliceWTF>();
+    auto* ret = allocator.alloc<StringSliceWTF>();
     ret->op = op;
     ret->ref = ref;
     ret->start = start;
@@ -1036,7 +1046,7 @@ public:
     return ret;
   }
   StringSliceIter* makeStringSliceIter(Expression* ref, Expression* num) {
-    auto* ret = wasm.allocator.alloc<StringSliceIter>();
+    auto* ret = allocator.alloc<StringSliceIter>();
     ret->ref = ref;
     ret->num = num;
     ret->finalize();
@@ -1046,7 +1056,7 @@ public:
   // Additional helpers
 
   Drop* makeDrop(Expression* value) {
-    auto* ret = wasm.allocator.alloc<Drop>();
+    auto* ret = allocator.alloc<Drop>();
     ret->value = value;
     ret->finalize();
     return ret;
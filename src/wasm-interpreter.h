@@ -23,6 +23,8 @@
 #ifndef wasm_wasm_interpreter_h
 #define wasm_wasm_interpreter_h
 
+#include <array>
+#include <chrono>
 #include <cmath>
 #include <limits.h>
 #include <sstream>
@@ -32,6 +34,7 @@
 #include "ir/module-utils.h"
 #include "support/bits.h"
 #include "support/safe_integer.h"
+#include "support/small_vector.h"
 #include "wasm-builder.h"
 #include "wasm-traversal.h"
 #include "wasm.h"
@@ -55,11 +58,19 @@ extern Name WASM, RETURN_FLOW, NONCONSTANT_FLOW;
 class Flow {
 public:
   Flow() : values() {}
-  Flow(Literal value) : values{value} { assert(value.type.isConcrete()); }
+  // Takes the value by value so that both lvalues and temporaries arrive
+  // here, and then moves it into place, avoiding a copy (which is
+  // significant when the value holds GC data, due to the refcounting).
+  Flow(Literal value) : values() {
+    assert(value.type.isConcrete());
+    values.push_back(std::move(value));
+  }
   Flow(Literals& values) : values(values) {}
   Flow(Literals&& values) : values(std::move(values)) {}
   Flow(Name breakTo) : values(), breakTo(breakTo) {}
-  Flow(Name breakTo, Literal value) : values{value}, breakTo(breakTo) {}
+  Flow(Name breakTo, Literal value) : values(), breakTo(breakTo) {
+    values.push_back(std::move(value));
+  }
 
   Literals values;
   Name breakTo; // if non-null, a break is going on
@@ -148,6 +159,216 @@ public:
 #define NOTE_EVAL2(p0, p1)
 #endif // WASM_INTERPRETER_DEBUG
 
+// Almost all binary operations cannot trap and map 1:1 onto a method on
+// Literal, so they can be dispatched through a table indexed by opcode, which
+// is one load and one indirect call in the hot constant-folding loops (e.g.
+// in Precompute). Returns nullptr for the few opcodes that need more than a
+// single method call - the trapping integer divisions and remainders, and
+// composite ops - which visitBinary handles itself.
+using BinaryLiteralOp = Literal (Literal::*)(const Literal&) const;
+
+inline BinaryLiteralOp getBinaryLiteralOp(BinaryOp op) {
+  static const std::array<BinaryLiteralOp, InvalidBinary> table = [] {
+    std::array<BinaryLiteralOp, InvalidBinary> ret{};
+    ret[AddInt32] = &Literal::add;
+    ret[AddInt64] = &Literal::add;
+    ret[AddFloat32] = &Literal::add;
+    ret[AddFloat64] = &Literal::add;
+    ret[SubInt32] = &Literal::sub;
+    ret[SubInt64] = &Literal::sub;
+    ret[SubFloat32] = &Literal::sub;
+    ret[SubFloat64] = &Literal::sub;
+    ret[MulInt32] = &Literal::mul;
+    ret[MulInt64] = &Literal::mul;
+    ret[MulFloat32] = &Literal::mul;
+    ret[MulFloat64] = &Literal::mul;
+    ret[DivFloat32] = &Literal::div;
+    ret[DivFloat64] = &Literal::div;
+    ret[AndInt32] = &Literal::and_;
+    ret[AndInt64] = &Literal::and_;
+    ret[OrInt32] = &Literal::or_;
+    ret[OrInt64] = &Literal::or_;
+    ret[XorInt32] = &Literal::xor_;
+    ret[XorInt64] = &Literal::xor_;
+    ret[ShlInt32] = &Literal::shl;
+    ret[ShlInt64] = &Literal::shl;
+    ret[ShrUInt32] = &Literal::shrU;
+    ret[ShrUInt64] = &Literal::shrU;
+    ret[ShrSInt32] = &Literal::shrS;
+    ret[ShrSInt64] = &Literal::shrS;
+    ret[RotLInt32] = &Literal::rotL;
+    ret[RotLInt64] = &Literal::rotL;
+    ret[RotRInt32] = &Literal::rotR;
+    ret[RotRInt64] = &Literal::rotR;
+    ret[EqInt32] = &Literal::eq;
+    ret[EqInt64] = &Literal::eq;
+    ret[EqFloat32] = &Literal::eq;
+    ret[EqFloat64] = &Literal::eq;
+    ret[NeInt32] = &Literal::ne;
+    ret[NeInt64] = &Literal::ne;
+    ret[NeFloat32] = &Literal::ne;
+    ret[NeFloat64] = &Literal::ne;
+    ret[LtSInt32] = &Literal::ltS;
+    ret[LtSInt64] = &Literal::ltS;
+    ret[LtUInt32] = &Literal::ltU;
+    ret[LtUInt64] = &Literal::ltU;
+    ret[LeSInt32] = &Literal::leS;
+    ret[LeSInt64] = &Literal::leS;
+    ret[LeUInt32] = &Literal::leU;
+    ret[LeUInt64] = &Literal::leU;
+    ret[GtSInt32] = &Literal::gtS;
+    ret[GtSInt64] = &Literal::gtS;
+    ret[GtUInt32] = &Literal::gtU;
+    ret[GtUInt64] = &Literal::gtU;
+    ret[GeSInt32] = &Literal::geS;
+    ret[GeSInt64] = &Literal::geS;
+    ret[GeUInt32] = &Literal::geU;
+    ret[GeUInt64] = &Literal::geU;
+    ret[LtFloat32] = &Literal::lt;
+    ret[LtFloat64] = &Literal::lt;
+    ret[LeFloat32] = &Literal::le;
+    ret[LeFloat64] = &Literal::le;
+    ret[GtFloat32] = &Literal::gt;
+    ret[GtFloat64] = &Literal::gt;
+    ret[GeFloat32] = &Literal::ge;
+    ret[GeFloat64] = &Literal::ge;
+    ret[CopySignFloat32] = &Literal::copysign;
+    ret[CopySignFloat64] = &Literal::copysign;
+    ret[MinFloat32] = &Literal::min;
+    ret[MinFloat64] = &Literal::min;
+    ret[MaxFloat32] = &Literal::max;
+    ret[MaxFloat64] = &Literal::max;
+    ret[EqVecI8x16] = &Literal::eqI8x16;
+    ret[NeVecI8x16] = &Literal::neI8x16;
+    ret[LtSVecI8x16] = &Literal::ltSI8x16;
+    ret[LtUVecI8x16] = &Literal::ltUI8x16;
+    ret[GtSVecI8x16] = &Literal::gtSI8x16;
+    ret[GtUVecI8x16] = &Literal::gtUI8x16;
+    ret[LeSVecI8x16] = &Literal::leSI8x16;
+    ret[LeUVecI8x16] = &Literal::leUI8x16;
+    ret[GeSVecI8x16] = &Literal::geSI8x16;
+    ret[GeUVecI8x16] = &Literal::geUI8x16;
+    ret[EqVecI16x8] = &Literal::eqI16x8;
+    ret[NeVecI16x8] = &Literal::neI16x8;
+    ret[LtSVecI16x8] = &Literal::ltSI16x8;
+    ret[LtUVecI16x8] = &Literal::ltUI16x8;
+    ret[GtSVecI16x8] = &Literal::gtSI16x8;
+    ret[GtUVecI16x8] = &Literal::gtUI16x8;
+    ret[LeSVecI16x8] = &Literal::leSI16x8;
+    ret[LeUVecI16x8] = &Literal::leUI16x8;
+    ret[GeSVecI16x8] = &Literal::geSI16x8;
+    ret[GeUVecI16x8] = &Literal::geUI16x8;
+    ret[EqVecI32x4] = &Literal::eqI32x4;
+    ret[NeVecI32x4] = &Literal::neI32x4;
+    ret[LtSVecI32x4] = &Literal::ltSI32x4;
+    ret[LtUVecI32x4] = &Literal::ltUI32x4;
+    ret[GtSVecI32x4] = &Literal::gtSI32x4;
+    ret[GtUVecI32x4] = &Literal::gtUI32x4;
+    ret[LeSVecI32x4] = &Literal::leSI32x4;
+    ret[LeUVecI32x4] = &Literal::leUI32x4;
+    ret[GeSVecI32x4] = &Literal::geSI32x4;
+    ret[GeUVecI32x4] = &Literal::geUI32x4;
+    ret[EqVecI64x2] = &Literal::eqI64x2;
+    ret[NeVecI64x2] = &Literal::neI64x2;
+    ret[LtSVecI64x2] = &Literal::ltSI64x2;
+    ret[GtSVecI64x2] = &Literal::gtSI64x2;
+    ret[LeSVecI64x2] = &Literal::leSI64x2;
+    ret[GeSVecI64x2] = &Literal::geSI64x2;
+    ret[EqVecF32x4] = &Literal::eqF32x4;
+    ret[NeVecF32x4] = &Literal::neF32x4;
+    ret[LtVecF32x4] = &Literal::ltF32x4;
+    ret[GtVecF32x4] = &Literal::gtF32x4;
+    ret[LeVecF32x4] = &Literal::leF32x4;
+    ret[GeVecF32x4] = &Literal::geF32x4;
+    ret[EqVecF64x2] = &Literal::eqF64x2;
+    ret[NeVecF64x2] = &Literal::neF64x2;
+    ret[LtVecF64x2] = &Literal::ltF64x2;
+    ret[GtVecF64x2] = &Literal::gtF64x2;
+    ret[LeVecF64x2] = &Literal::leF64x2;
+    ret[GeVecF64x2] = &Literal::geF64x2;
+    ret[AndVec128] = &Literal::andV128;
+    ret[OrVec128] = &Literal::orV128;
+    ret[XorVec128] = &Literal::xorV128;
+    ret[AddVecI8x16] = &Literal::addI8x16;
+    ret[AddSatSVecI8x16] = &Literal::addSaturateSI8x16;
+    ret[AddSatUVecI8x16] = &Literal::addSaturateUI8x16;
+    ret[SubVecI8x16] = &Literal::subI8x16;
+    ret[SubSatSVecI8x16] = &Literal::subSaturateSI8x16;
+    ret[SubSatUVecI8x16] = &Literal::subSaturateUI8x16;
+    ret[MinSVecI8x16] = &Literal::minSI8x16;
+    ret[MinUVecI8x16] = &Literal::minUI8x16;
+    ret[MaxSVecI8x16] = &Literal::maxSI8x16;
+    ret[MaxUVecI8x16] = &Literal::maxUI8x16;
+    ret[AvgrUVecI8x16] = &Literal::avgrUI8x16;
+    ret[AddVecI16x8] = &Literal::addI16x8;
+    ret[AddSatSVecI16x8] = &Literal::addSaturateSI16x8;
+    ret[AddSatUVecI16x8] = &Literal::addSaturateUI16x8;
+    ret[SubVecI16x8] = &Literal::subI16x8;
+    ret[SubSatSVecI16x8] = &Literal::subSaturateSI16x8;
+    ret[SubSatUVecI16x8] = &Literal::subSaturateUI16x8;
+    ret[MulVecI16x8] = &Literal::mulI16x8;
+    ret[MinSVecI16x8] = &Literal::minSI16x8;
+    ret[MinUVecI16x8] = &Literal::minUI16x8;
+    ret[MaxSVecI16x8] = &Literal::maxSI16x8;
+    ret[MaxUVecI16x8] = &Literal::maxUI16x8;
+    ret[AvgrUVecI16x8] = &Literal::avgrUI16x8;
+    ret[Q15MulrSatSVecI16x8] = &Literal::q15MulrSatSI16x8;
+    ret[RelaxedQ15MulrSVecI16x8] = &Literal::q15MulrSatSI16x8;
+    ret[ExtMulLowSVecI16x8] = &Literal::extMulLowSI16x8;
+    ret[ExtMulHighSVecI16x8] = &Literal::extMulHighSI16x8;
+    ret[ExtMulLowUVecI16x8] = &Literal::extMulLowUI16x8;
+    ret[ExtMulHighUVecI16x8] = &Literal::extMulHighUI16x8;
+    ret[AddVecI32x4] = &Literal::addI32x4;
+    ret[SubVecI32x4] = &Literal::subI32x4;
+    ret[MulVecI32x4] = &Literal::mulI32x4;
+    ret[MinSVecI32x4] = &Literal::minSI32x4;
+    ret[MinUVecI32x4] = &Literal::minUI32x4;
+    ret[MaxSVecI32x4] = &Literal::maxSI32x4;
+    ret[MaxUVecI32x4] = &Literal::maxUI32x4;
+    ret[DotSVecI16x8ToVecI32x4] = &Literal::dotSI16x8toI32x4;
+    ret[ExtMulLowSVecI32x4] = &Literal::extMulLowSI32x4;
+    ret[ExtMulHighSVecI32x4] = &Literal::extMulHighSI32x4;
+    ret[ExtMulLowUVecI32x4] = &Literal::extMulLowUI32x4;
+    ret[ExtMulHighUVecI32x4] = &Literal::extMulHighUI32x4;
+    ret[AddVecI64x2] = &Literal::addI64x2;
+    ret[SubVecI64x2] = &Literal::subI64x2;
+    ret[MulVecI64x2] = &Literal::mulI64x2;
+    ret[ExtMulLowSVecI64x2] = &Literal::extMulLowSI64x2;
+    ret[ExtMulHighSVecI64x2] = &Literal::extMulHighSI64x2;
+    ret[ExtMulLowUVecI64x2] = &Literal::extMulLowUI64x2;
+    ret[ExtMulHighUVecI64x2] = &Literal::extMulHighUI64x2;
+    ret[AddVecF32x4] = &Literal::addF32x4;
+    ret[SubVecF32x4] = &Literal::subF32x4;
+    ret[MulVecF32x4] = &Literal::mulF32x4;
+    ret[DivVecF32x4] = &Literal::divF32x4;
+    ret[MinVecF32x4] = &Literal::minF32x4;
+    ret[RelaxedMinVecF32x4] = &Literal::minF32x4;
+    ret[MaxVecF32x4] = &Literal::maxF32x4;
+    ret[RelaxedMaxVecF32x4] = &Literal::maxF32x4;
+    ret[PMinVecF32x4] = &Literal::pminF32x4;
+    ret[PMaxVecF32x4] = &Literal::pmaxF32x4;
+    ret[AddVecF64x2] = &Literal::addF64x2;
+    ret[SubVecF64x2] = &Literal::subF64x2;
+    ret[MulVecF64x2] = &Literal::mulF64x2;
+    ret[DivVecF64x2] = &Literal::divF64x2;
+    ret[MinVecF64x2] = &Literal::minF64x2;
+    ret[RelaxedMinVecF64x2] = &Literal::minF64x2;
+    ret[MaxVecF64x2] = &Literal::maxF64x2;
+    ret[RelaxedMaxVecF64x2] = &Literal::maxF64x2;
+    ret[PMinVecF64x2] = &Literal::pminF64x2;
+    ret[PMaxVecF64x2] = &Literal::pmaxF64x2;
+    ret[NarrowSVecI16x8ToVecI8x16] = &Literal::narrowSToI8x16;
+    ret[NarrowUVecI16x8ToVecI8x16] = &Literal::narrowUToI8x16;
+    ret[NarrowSVecI32x4ToVecI16x8] = &Literal::narrowSToI16x8;
+    ret[NarrowUVecI32x4ToVecI16x8] = &Literal::narrowUToI16x8;
+    ret[SwizzleVecI8x16] = &Literal::swizzleI8x16;
+    ret[RelaxedSwizzleVecI8x16] = &Literal::swizzleI8x16;
+    ret[DotI8x16I7x16SToVecI16x8] = &Literal::dotSI8x16toI16x8;
+    return ret;
+  }();
+  return table[op];
+}
+
 // Execute an expression
 template<typename SubType>
 class ExpressionRunner : public OverriddenVisitor<SubType, Flow> {
@@ -165,6 +386,42 @@ protected:
   // Maximum iterations before giving up on a loop.
   Index maxLoopIterations;
 
+  // Maximum number of expressions to execute before giving up (see
+  // setMaxFuel), and an optional wall-clock deadline (see setDeadline). The
+  // hot path in visit() only increments a counter and compares it against
+  // nextBudgetCheck; the budgets themselves are inspected in checkBudgets(),
+  // at most every BudgetCheckInterval visits - except that fuel exhaustion is
+  // always caught on the exact visit it happens, so fuel stays deterministic.
+  uint64_t maxFuel = NO_LIMIT;
+  uint64_t fuelUsed = 0;
+  uint64_t nextBudgetCheck = NO_BUDGET_CHECK;
+  std::chrono::steady_clock::time_point deadline;
+  bool hasDeadline = false;
+
+  static const uint64_t BudgetCheckInterval = 1024;
+  static const uint64_t NO_BUDGET_CHECK = uint64_t(-1);
+
+  void scheduleBudgetCheck() {
+    if (maxFuel == NO_LIMIT && !hasDeadline) {
+      nextBudgetCheck = NO_BUDGET_CHECK;
+      return;
+    }
+    nextBudgetCheck = fuelUsed + BudgetCheckInterval;
+    if (maxFuel != NO_LIMIT) {
+      nextBudgetCheck = std::min(nextBudgetCheck, maxFuel + 1);
+    }
+  }
+
+  void checkBudgets() {
+    if (maxFuel != NO_LIMIT && fuelUsed > maxFuel) {
+      hostLimit("interpreter fuel limit");
+    }
+    if (hasDeadline && std::chrono::steady_clock::now() >= deadline) {
+      hostLimit("interpreter deadline");
+    }
+    scheduleBudgetCheck();
+  }
+
   Flow generateArguments(const ExpressionList& operands, Literals& arguments) {
     NOTE_ENTER_("generateArguments");
     arguments.reserve(operands.size());
@@ -190,25 +447,50 @@ public:
   }
   virtual ~ExpressionRunner() = default;
 
+  // Sets a budget on the number of expressions to execute before giving up
+  // with a host limit, and resets the amount used so far. This is a
+  // deterministic alternative to a wall-clock timeout: unlike time, the same
+  // code always runs out of fuel at the same point. NO_LIMIT disables the
+  // budget.
+  void setMaxFuel(Index maxFuel_) {
+    maxFuel = maxFuel_;
+    fuelUsed = 0;
+    scheduleBudgetCheck();
+  }
+
+  // Sets a wall-clock deadline after which execution gives up with a host
+  // limit. The clock is only consulted every BudgetCheckInterval visits, so
+  // this is cheap, but unlike fuel it is nondeterministic: it suits tools
+  // that fall back gracefully when evaluation fails, like wasm-ctor-eval,
+  // rather than comparisons that must be reproducible.
+  void setDeadline(std::chrono::steady_clock::time_point deadline_) {
+    deadline = deadline_;
+    hasDeadline = true;
+    scheduleBudgetCheck();
+  }
+
   Flow visit(Expression* curr) {
     depth++;
     if (maxDepth != NO_LIMIT && depth > maxDepth) {
       hostLimit("interpreter recursion limit");
     }
+    if (++fuelUsed >= nextBudgetCheck) {
+      checkBudgets();
+    }
     auto ret = OverriddenVisitor<SubType, Flow>::visit(curr);
+#ifndef NDEBUG
     if (!ret.breaking()) {
       Type type = ret.getType();
       if (type.isConcrete() || curr->type.isConcrete()) {
-#if 1 // def WASM_INTERPRETER_DEBUG
         if (!Type::isSubType(type, curr->type)) {
           std::cerr << "expected " << curr->type << ", seeing " << type
                     << " from\n"
                     << *curr << '\n';
         }
-#endif
         assert(Type::isSubType(type, curr->type));
       }
     }
+#endif
     depth--;
     return ret;
   }
@@ -220,7 +502,7 @@ public:
     NOTE_ENTER("Block");
     // special-case Block, because Block nesting (in their first element) can be
     // incredibly deep
-    std::vector<Block*> stack;
+    SmallVector<Block*, 10> stack;
     stack.push_back(curr);
     while (curr->list.size() > 0 && curr->list[0]->is<Block>()) {
       curr = curr->list[0]->cast<Block>();
@@ -602,22 +884,13 @@ public:
                                          : true);
     assert(curr->right->type.isConcrete() ? right.type == curr->right->type
                                           : true);
+    // Almost all the operations are dispatched through the table; see
+    // getBinaryLiteralOp. Only the opcodes that need more than a single
+    // method call on Literal are handled in the switch below.
+    if (auto method = getBinaryLiteralOp(curr->op)) {
+      return (left.*method)(right);
+    }
     switch (curr->op) {
-      case AddInt32:
-      case AddInt64:
-      case AddFloat32:
-      case AddFloat64:
-        return left.add(right);
-      case SubInt32:
-      case SubInt64:
-      case SubFloat32:
-      case SubFloat64:
-        return left.sub(right);
-      case MulInt32:
-      case MulInt64:
-      case MulFloat32:
-      case MulFloat64:
-        return left.mul(right);
       case DivSInt32: {
         if (right.getInteger() == 0) {
           trap("i32.div_s by 0");
@@ -680,350 +953,11 @@ public:
         }
         return left.remU(right);
       }
-      case DivFloat32:
-      case DivFloat64:
-        return left.div(right);
-      case AndInt32:
-      case AndInt64:
-        return left.and_(right);
-      case OrInt32:
-      case OrInt64:
-        return left.or_(right);
-      case XorInt32:
-      case XorInt64:
-        return left.xor_(right);
-      case ShlInt32:
-      case ShlInt64:
-        return left.shl(right);
-      case ShrUInt32:
-      case ShrUInt64:
-        return left.shrU(right);
-      case ShrSInt32:
-      case ShrSInt64:
-        return left.shrS(right);
-      case RotLInt32:
-      case RotLInt64:
-        return left.rotL(right);
-      case RotRInt32:
-      case RotRInt64:
-        return left.rotR(right);
-
-      case EqInt32:
-      case EqInt64:
-      case EqFloat32:
-      case EqFloat64:
-        return left.eq(right);
-      case NeInt32:
-      case NeInt64:
-      case NeFloat32:
-      case NeFloat64:
-        return left.ne(right);
-      case LtSInt32:
-      case LtSInt64:
-        return left.ltS(right);
-      case LtUInt32:
-      case LtUInt64:
-        return left.ltU(right);
-      case LeSInt32:
-      case LeSInt64:
-        return left.leS(right);
-      case LeUInt32:
-      case LeUInt64:
-        return left.leU(right);
-      case GtSInt32:
-      case GtSInt64:
-        return left.gtS(right);
-      case GtUInt32:
-      case GtUInt64:
-        return left.gtU(right);
-      case GeSInt32:
-      case GeSInt64:
-        return left.geS(right);
-      case GeUInt32:
-      case GeUInt64:
-        return left.geU(right);
-      case LtFloat32:
-      case LtFloat64:
-        return left.lt(right);
-      case LeFloat32:
-      case LeFloat64:
-        return left.le(right);
-      case GtFloat32:
-      case GtFloat64:
-        return left.gt(right);
-      case GeFloat32:
-      case GeFloat64:
-        return left.ge(right);
-
-      case CopySignFloat32:
-      case CopySignFloat64:
-        return left.copysign(right);
-      case MinFloat32:
-      case MinFloat64:
-        return left.min(right);
-      case MaxFloat32:
-      case MaxFloat64:
-        return left.max(right);
-
-      case EqVecI8x16:
-        return left.eqI8x16(right);
-      case NeVecI8x16:
-        return left.neI8x16(right);
-      case LtSVecI8x16:
-        return left.ltSI8x16(right);
-      case LtUVecI8x16:
-        return left.ltUI8x16(right);
-      case GtSVecI8x16:
-        return left.gtSI8x16(right);
-      case GtUVecI8x16:
-        return left.gtUI8x16(right);
-      case LeSVecI8x16:
-        return left.leSI8x16(right);
-      case LeUVecI8x16:
-        return left.leUI8x16(right);
-      case GeSVecI8x16:
-        return left.geSI8x16(right);
-      case GeUVecI8x16:
-        return left.geUI8x16(right);
-      case EqVecI16x8:
-        return left.eqI16x8(right);
-      case NeVecI16x8:
-        return left.neI16x8(right);
-      case LtSVecI16x8:
-        return left.ltSI16x8(right);
-      case LtUVecI16x8:
-        return left.ltUI16x8(right);
-      case GtSVecI16x8:
-        return left.gtSI16x8(right);
-      case GtUVecI16x8:
-        return left.gtUI16x8(right);
-      case LeSVecI16x8:
-        return left.leSI16x8(right);
-      case LeUVecI16x8:
-        return left.leUI16x8(right);
-      case GeSVecI16x8:
-        return left.geSI16x8(right);
-      case GeUVecI16x8:
-        return left.geUI16x8(right);
-      case EqVecI32x4:
-        return left.eqI32x4(right);
-      case NeVecI32x4:
-        return left.neI32x4(right);
-      case LtSVecI32x4:
-        return left.ltSI32x4(right);
-      case LtUVecI32x4:
-        return left.ltUI32x4(right);
-      case GtSVecI32x4:
-        return left.gtSI32x4(right);
-      case GtUVecI32x4:
-        return left.gtUI32x4(right);
-      case LeSVecI32x4:
-        return left.leSI32x4(right);
-      case LeUVecI32x4:
-        return left.leUI32x4(right);
-      case GeSVecI32x4:
-        return left.geSI32x4(right);
-      case GeUVecI32x4:
-        return left.geUI32x4(right);
-      case EqVecI64x2:
-        return left.eqI64x2(right);
-      case NeVecI64x2:
-        return left.neI64x2(right);
-      case LtSVecI64x2:
-        return left.ltSI64x2(right);
-      case GtSVecI64x2:
-        return left.gtSI64x2(right);
-      case LeSVecI64x2:
-        return left.leSI64x2(right);
-      case GeSVecI64x2:
-        return left.geSI64x2(right);
-      case EqVecF32x4:
-        return left.eqF32x4(right);
-      case NeVecF32x4:
-        return left.neF32x4(right);
-      case LtVecF32x4:
-        return left.ltF32x4(right);
-      case GtVecF32x4:
-        return left.gtF32x4(right);
-      case LeVecF32x4:
-        return left.leF32x4(right);
-      case GeVecF32x4:
-        return left.geF32x4(right);
-      case EqVecF64x2:
-        return left.eqF64x2(right);
-      case NeVecF64x2:
-        return left.neF64x2(right);
-      case LtVecF64x2:
-        return left.ltF64x2(right);
-      case GtVecF64x2:
-        return left.gtF64x2(right);
-      case LeVecF64x2:
-        return left.leF64x2(right);
-      case GeVecF64x2:
-        return left.geF64x2(right);
-
-      case AndVec128:
-        return left.andV128(right);
-      case OrVec128:
-        return left.orV128(right);
-      case XorVec128:
-        return left.xorV128(right);
       case AndNotVec128:
         return left.andV128(right.notV128());
-
-      case AddVecI8x16:
-        return left.addI8x16(right);
-      case AddSatSVecI8x16:
-        return left.addSaturateSI8x16(right);
-      case AddSatUVecI8x16:
-        return left.addSaturateUI8x16(right);
-      case SubVecI8x16:
-        return left.subI8x16(right);
-      case SubSatSVecI8x16:
-        return left.subSaturateSI8x16(right);
-      case SubSatUVecI8x16:
-        return left.subSaturateUI8x16(right);
-      case MinSVecI8x16:
-        return left.minSI8x16(right);
-      case MinUVecI8x16:
-        return left.minUI8x16(right);
-      case MaxSVecI8x16:
-        return left.maxSI8x16(right);
-      case MaxUVecI8x16:
-        return left.maxUI8x16(right);
-      case AvgrUVecI8x16:
-        return left.avgrUI8x16(right);
-      case AddVecI16x8:
-        return left.addI16x8(right);
-      case AddSatSVecI16x8:
-        return left.addSaturateSI16x8(right);
-      case AddSatUVecI16x8:
-        return left.addSaturateUI16x8(right);
-      case SubVecI16x8:
-        return left.subI16x8(right);
-      case SubSatSVecI16x8:
-        return left.subSaturateSI16x8(right);
-      case SubSatUVecI16x8:
-        return left.subSaturateUI16x8(right);
-      case MulVecI16x8:
-        return left.mulI16x8(right);
-      case MinSVecI16x8:
-        return left.minSI16x8(right);
-      case MinUVecI16x8:
-        return left.minUI16x8(right);
-      case MaxSVecI16x8:
-        return left.maxSI16x8(right);
-      case MaxUVecI16x8:
-        return left.maxUI16x8(right);
-      case AvgrUVecI16x8:
-        return left.avgrUI16x8(right);
-      case Q15MulrSatSVecI16x8:
-      case RelaxedQ15MulrSVecI16x8:
-        return left.q15MulrSatSI16x8(right);
-      case ExtMulLowSVecI16x8:
-        return left.extMulLowSI16x8(right);
-      case ExtMulHighSVecI16x8:
-        return left.extMulHighSI16x8(right);
-      case ExtMulLowUVecI16x8:
-        return left.extMulLowUI16x8(right);
-      case ExtMulHighUVecI16x8:
-        return left.extMulHighUI16x8(right);
-      case AddVecI32x4:
-        return left.addI32x4(right);
-      case SubVecI32x4:
-        return left.subI32x4(right);
-      case MulVecI32x4:
-        return left.mulI32x4(right);
-      case MinSVecI32x4:
-        return left.minSI32x4(right);
-      case MinUVecI32x4:
-        return left.minUI32x4(right);
-      case MaxSVecI32x4:
-        return left.maxSI32x4(right);
-      case MaxUVecI32x4:
-        return left.maxUI32x4(right);
-      case DotSVecI16x8ToVecI32x4:
-        return left.dotSI16x8toI32x4(right);
-      case ExtMulLowSVecI32x4:
-        return left.extMulLowSI32x4(right);
-      case ExtMulHighSVecI32x4:
-        return left.extMulHighSI32x4(right);
-      case ExtMulLowUVecI32x4:
-        return left.extMulLowUI32x4(right);
-      case ExtMulHighUVecI32x4:
-        return left.extMulHighUI32x4(right);
-      case AddVecI64x2:
-        return left.addI64x2(right);
-      case SubVecI64x2:
-        return left.subI64x2(right);
-      case MulVecI64x2:
-        return left.mulI64x2(right);
-      case ExtMulLowSVecI64x2:
-        return left.extMulLowSI64x2(right);
-      case ExtMulHighSVecI64x2:
-        return left.extMulHighSI64x2(right);
-      case ExtMulLowUVecI64x2:
-        return left.extMulLowUI64x2(right);
-      case ExtMulHighUVecI64x2:
-        return left.extMulHighUI64x2(right);
-
-      case AddVecF32x4:
-        return left.addF32x4(right);
-      case SubVecF32x4:
-        return left.subF32x4(right);
-      case MulVecF32x4:
-        return left.mulF32x4(right);
-      case DivVecF32x4:
-        return left.divF32x4(right);
-      case MinVecF32x4:
-      case RelaxedMinVecF32x4:
-        return left.minF32x4(right);
-      case MaxVecF32x4:
-      case RelaxedMaxVecF32x4:
-        return left.maxF32x4(right);
-      case PMinVecF32x4:
-        return left.pminF32x4(right);
-      case PMaxVecF32x4:
-        return left.pmaxF32x4(right);
-      case AddVecF64x2:
-        return left.addF64x2(right);
-      case SubVecF64x2:
-        return left.subF64x2(right);
-      case MulVecF64x2:
-        return left.mulF64x2(right);
-      case DivVecF64x2:
-        return left.divF64x2(right);
-      case MinVecF64x2:
-      case RelaxedMinVecF64x2:
-        return left.minF64x2(right);
-      case MaxVecF64x2:
-      case RelaxedMaxVecF64x2:
-        return left.maxF64x2(right);
-      case PMinVecF64x2:
-        return left.pminF64x2(right);
-      case PMaxVecF64x2:
-        return left.pmaxF64x2(right);
-
-      case NarrowSVecI16x8ToVecI8x16:
-        return left.narrowSToI8x16(right);
-      case NarrowUVecI16x8ToVecI8x16:
-        return left.narrowUToI8x16(right);
-      case NarrowSVecI32x4ToVecI16x8:
-        return left.narrowSToI16x8(right);
-      case NarrowUVecI32x4ToVecI16x8:
-        return left.narrowUToI16x8(right);
-
-      case SwizzleVecI8x16:
-      case RelaxedSwizzleVecI8x16:
-        return left.swizzleI8x16(right);
-
-      case DotI8x16I7x16SToVecI16x8:
-        return left.dotSI8x16toI16x8(right);
-
-      case InvalidBinary:
+      default:
         WASM_UNREACHABLE("invalid binary op");
     }
-    WASM_UNREACHABLE("invalid op");
   }
   Flow visitSIMDExtract(SIMDExtract* curr) {
     NOTE_ENTER("SIMDExtract");
@@ -2412,6 +2346,35 @@ public:
       WASM_UNREACHABLE("unimp");
     }
 
+    // Bulk memory operations. The caller has already checked that the entire
+    // range is in bounds, so an interface with a flat memory representation
+    // can override these with memset/memmove-style implementations. The
+    // defaults fall back to the byte-level accessors above.
+    virtual void memorySet(Address destAddr, uint8_t value, Address size) {
+      for (uint64_t i = 0; i < size; i++) {
+        store8(destAddr + i, value);
+      }
+    }
+    virtual void
+    memoryCopy(Address destAddr, Address sourceAddr, Address size) {
+      // Copy in the direction that is safe for overlapping ranges.
+      if (destAddr <= sourceAddr) {
+        for (uint64_t i = 0; i < size; i++) {
+          store8(destAddr + i, load8s(sourceAddr + i));
+        }
+      } else {
+        for (uint64_t i = size; i > 0; i--) {
+          store8(destAddr + i - 1, load8s(sourceAddr + i - 1));
+        }
+      }
+    }
+    virtual void memoryWrite(Address destAddr, const char* source,
+                             Address size) {
+      for (uint64_t i = 0; i < size; i++) {
+        store8(destAddr + i, source[i]);
+      }
+    }
+
     virtual Index tableSize(Name tableName) = 0;
 
     virtual void tableStore(Name tableName, Index index, const Literal& entry) {
@@ -2667,7 +2630,166 @@ protected:
     return inst->globals[global->name];
   }
 
+  // The number of iterations after which visitLoop tries to recognize a hot
+  // loop as a bulk-executable fill, see tryFillLoop.
+  static const Index FillLoopThreshold = 50;
+
+  // Tries to recognize a memset-style fill loop,
+  //
+  //  (loop $l
+  //    (store offset=o (local.get $p) (X))        ;; X a const or other local
+  //    (local.set $p (i32.add (local.get $p) (i32.const step)))
+  //    (br_if $l (i32.ne|i32.lt_u (local.get $p) (Y)))  ;; Y likewise
+  //  )
+  //
+  // and if it matches, executes all remaining iterations in bulk, without
+  // re-interpreting the body each time. Generated initialization code is full
+  // of such loops, and evaluating a large module (e.g. in ctor-eval) can
+  // spend almost all of its time in them. This must be observably identical
+  // to normal interpretation, so we only do it when we can prove up front
+  // that the loop terminates without the pointer wrapping around, and that
+  // every store is in bounds; otherwise we return false and the caller keeps
+  // interpreting, which handles any trap at precisely the right iteration.
+  bool tryFillLoop(Loop* curr) {
+    auto* block = curr->body->dynCast<Block>();
+    if (!block || block->name.is() || block->list.size() != 3) {
+      return false;
+    }
+    auto* store = block->list[0]->dynCast<Store>();
+    auto* set = block->list[1]->dynCast<LocalSet>();
+    auto* br = block->list[2]->dynCast<Break>();
+    if (!store || !set || !br) {
+      return false;
+    }
+    // The store must write either a constant or a local that is not the
+    // pointer (as the pointer changes each iteration), at the pointer.
+    if (store->isAtomic) {
+      return false;
+    }
+    auto* ptrGet = store->ptr->dynCast<LocalGet>();
+    if (!ptrGet || ptrGet->type != Type::i32) {
+      return false;
+    }
+    Index ptrLocal = ptrGet->index;
+    Literal value;
+    if (auto* c = store->value->dynCast<Const>()) {
+      value = c->value;
+    } else if (auto* get = store->value->dynCast<LocalGet>()) {
+      if (get->index == ptrLocal) {
+        return false;
+      }
+      value = scope->locals[get->index][0];
+    } else {
+      return false;
+    }
+    // The pointer must be bumped by a constant amount.
+    if (set->isTee() || set->index != ptrLocal) {
+      return false;
+    }
+    auto* add = set->value->dynCast<Binary>();
+    if (!add || add->op != AddInt32) {
+      return false;
+    }
+    auto* addGet = add->left->dynCast<LocalGet>();
+    auto* addConst = add->right->dynCast<Const>();
+    if (!addGet || addGet->index != ptrLocal || !addConst) {
+      return false;
+    }
+    uint64_t step = uint32_t(addConst->value.geti32());
+    if (step == 0) {
+      return false;
+    }
+    // The branch must continue the loop while the pointer has not reached a
+    // limit that does not change during the loop.
+    if (br->name != curr->name || br->value || !br->condition) {
+      return false;
+    }
+    auto* cond = br->condition->dynCast<Binary>();
+    if (!cond || (cond->op != NeInt32 && cond->op != LtUInt32)) {
+      return false;
+    }
+    auto* condGet = cond->left->dynCast<LocalGet>();
+    if (!condGet || condGet->index != ptrLocal) {
+      return false;
+    }
+    uint64_t limit;
+    if (auto* c = cond->right->dynCast<Const>()) {
+      limit = uint32_t(c->value.geti32());
+    } else if (auto* get = cond->right->dynCast<LocalGet>()) {
+      if (get->index == ptrLocal) {
+        return false;
+      }
+      limit = uint32_t(scope->locals[get->index][0].geti32());
+    } else {
+      return false;
+    }
+    // We are called at the start of an iteration: the body always runs once
+    // more, and then keeps looping while the condition holds. Compute how
+    // many more iterations that is.
+    uint64_t ptr = uint32_t(scope->locals[ptrLocal][0].geti32());
+    uint64_t iterations;
+    if (cond->op == NeInt32) {
+      // Only handle a pointer that walks up to the limit and lands on it
+      // exactly; anything else wraps around, or never stops.
+      if (ptr >= limit || (limit - ptr) % step != 0) {
+        return false;
+      }
+      iterations = (limit - ptr) / step;
+    } else if (ptr >= limit) {
+      iterations = 1;
+    } else {
+      iterations = (limit - ptr + step - 1) / step;
+    }
+    // After the final bump the pointer must not have wrapped around, as a
+    // wrapped pointer could satisfy the comparison once more.
+    uint64_t finalPtr = ptr + iterations * step;
+    if (iterations == 0 || finalPtr > uint64_t(uint32_t(-1))) {
+      return false;
+    }
+    // Every store must be in bounds. The addresses only increase, so it is
+    // enough to check the last one.
+    auto* inst = getMemoryInstance();
+    uint64_t memorySizeBytes = uint64_t(inst->memorySize) * Memory::kPageSize;
+    uint64_t highest =
+      uint64_t(store->offset) + (finalPtr - step) + store->bytes;
+    if (highest > memorySizeBytes) {
+      return false;
+    }
+    for (uint64_t i = 0; i < iterations; i++) {
+      inst->externalInterface->store(store, store->offset + ptr + i * step,
+                                     value);
+    }
+    scope->locals[ptrLocal][0] = Literal(int32_t(finalPtr));
+    return true;
+  }
+
 public:
+  Flow visitLoop(Loop* curr) {
+    NOTE_ENTER("Loop");
+    Index loopCount = 0;
+    while (1) {
+      Flow flow = self()->visit(curr->body);
+      if (flow.breaking()) {
+        if (flow.breakTo == curr->name) {
+          if (this->maxLoopIterations != this->NO_LIMIT &&
+              ++loopCount >= this->maxLoopIterations) {
+            return Flow(NONCONSTANT_FLOW);
+          }
+          // Once a loop has shown itself to be hot, see if we can execute
+          // the rest of it in bulk. (When there is a limit on iterations we
+          // must count each one, so do not do this then.)
+          if (this->maxLoopIterations == this->NO_LIMIT &&
+              ++loopCount == FillLoopThreshold && tryFillLoop(curr)) {
+            return Flow();
+          }
+          continue;
+        }
+      }
+      // loop does not loop automatically, only continue achieves that
+      return flow;
+    }
+  }
+
   Flow visitCall(Call* curr) {
     NOTE_ENTER("Call");
     NOTE_NAME(curr->target);
@@ -3284,12 +3406,10 @@ public:
     if (destVal + sizeVal > inst->memorySize * Memory::kPageSize) {
       trap("out of bounds memory access in memory.init");
     }
-    for (size_t i = 0; i < sizeVal; ++i) {
-      Literal addr(destVal + i);
-      inst->externalInterface->store8(
-        inst->getFinalAddressWithoutOffset(addr, 1),
-        segment->data[offsetVal + i]);
-    }
+    // The entire range was checked above, so the interface can write it in
+    // bulk.
+    inst->externalInterface->memoryWrite(
+      destVal, segment->data.data() + offsetVal, sizeVal);
     return {};
   }
   Flow visitDataDrop(DataDrop* curr) {
@@ -3327,21 +3447,9 @@ public:
       trap("out of bounds segment access in memory.copy");
     }
 
-    int64_t start = 0;
-    int64_t end = sizeVal;
-    int step = 1;
-    // Reverse direction if source is below dest
-    if (sourceVal < destVal) {
-      start = int64_t(sizeVal) - 1;
-      end = -1;
-      step = -1;
-    }
-    for (int64_t i = start; i != end; i += step) {
-      inst->externalInterface->store8(
-        inst->getFinalAddressWithoutOffset(Literal(destVal + i), 1),
-        inst->externalInterface->load8s(
-          inst->getFinalAddressWithoutOffset(Literal(sourceVal + i), 1)));
-    }
+    // The entire ranges were checked above, so the interface can copy them in
+    // bulk (it handles any overlap itself).
+    inst->externalInterface->memoryCopy(destVal, sourceVal, sizeVal);
     return {};
   }
   Flow visitMemoryFill(MemoryFill* curr) {
@@ -3372,10 +3480,9 @@ public:
       trap("out of bounds memory access in memory.fill");
     }
     uint8_t val(value.getSingleValue().geti32());
-    for (size_t i = 0; i < sizeVal; ++i) {
-      inst->externalInterface->store8(
-        inst->getFinalAddressWithoutOffset(Literal(destVal + i), 1), val);
-    }
+    // The entire range was checked above, so the interface can fill it in
+    // bulk.
+    inst->externalInterface->memorySet(destVal, val, sizeVal);
     return {};
   }
   Flow visitTry(Try* curr) {
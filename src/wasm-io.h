@@ -21,8 +21,12 @@
 #ifndef wasm_wasm_io_h
 #define wasm_wasm_io_h
 
+#include <optional>
+#include <set>
+
 #include "parsing.h"
 #include "support/file.h"
+#include "wasm-binary.h"
 #include "wasm.h"
 
 namespace wasm {
@@ -31,6 +35,8 @@ namespace wasm {
 // removing the old one.
 extern bool useNewWATParser;
 
+class LazyFunctionBodies;
+
 class ModuleIOBase {
 protected:
   bool debugInfo;
@@ -44,7 +50,10 @@ class ModuleReader : public ModuleIOBase {
 public:
   // Reading defaults to loading the names section. Name section info is used in
   // various internal ways that we do not opt-in to currently.
-  ModuleReader() { setDebugInfo(true); }
+  // Out of line because of the unique_ptr to the then-incomplete
+  // LazyFunctionBodies.
+  ModuleReader();
+  ~ModuleReader();
 
   // If DWARF support is enabled, we track the locations of all IR nodes in
   // the binary, so that we can update DWARF sections later when writing.
@@ -57,6 +66,38 @@ public:
     skipFunctionBodies = skipFunctionBodies_;
   }
 
+  // Decode function bodies on the thread pool. Ignored when reading DWARF or
+  // a source map, which require sequential decoding.
+  void setParallelBodies(bool parallelBodies_) {
+    parallelBodies = parallelBodies_;
+  }
+
+  // Leave binary function bodies unparsed, to be built on demand. After the
+  // read, takeLazyFunctionBodies() returns the handle that materializes them,
+  // which the caller must keep alive for as long as it may touch lazy bodies.
+  // Ignored when reading text, DWARF, or a source map.
+  void setLazyFunctionBodies(bool lazyFunctionBodies_) {
+    lazyFunctionBodies = lazyFunctionBodies_;
+  }
+  std::unique_ptr<LazyFunctionBodies> takeLazyFunctionBodies();
+
+  // Use a sidecar index file when reading a binary, so that function bodies
+  // can be found without scanning the code section; see BinaryIndex. An index
+  // that does not match the module is ignored, with a warning. Ignored when
+  // reading text.
+  void setBinaryIndexFile(std::string binaryIndexFile_) {
+    binaryIndexFile = binaryIndexFile_;
+  }
+
+  // Read only the given sections of a binary, seeking past all the others
+  // using their size headers. This makes inspection jobs that only need a few
+  // small sections (exports, names, etc.) fast even on very large modules.
+  // The sections must form a coherent subset; see
+  // WasmBinaryBuilder::setOnlySections. Ignored when reading text.
+  void setOnlySections(std::set<BinaryConsts::Section> sections) {
+    onlySections = std::move(sections);
+  }
+
   // read text
   void readText(std::string filename, Module& wasm);
   // read binary
@@ -77,8 +118,24 @@ private:
 
   bool skipFunctionBodies = false;
 
+  bool parallelBodies = false;
+
+  bool lazyFunctionBodies = false;
+
+  std::optional<std::set<BinaryConsts::Section>> onlySections;
+
+  std::string binaryIndexFile;
+
+  std::unique_ptr<LazyFunctionBodies> lazyBodies;
+
   void readStdin(Module& wasm, std::string sourceMapFilename);
 
+  bool useLazyBodies(const std::string& sourceMapFilename) const;
+
+  void readBinaryView(BufferView data,
+                      Module& wasm,
+                      std::string sourceMapFilename);
+
   void readBinaryData(std::vector<char>& input,
                       Module& wasm,
                       std::string sourceMapFilename);
@@ -90,6 +147,9 @@ class ModuleWriter : public ModuleIOBase {
   // TODO: Remove `emitModuleName`. See the comment in wasm-binary.h
   bool emitModuleName = false;
 
+  bool parallelBodies = false;
+  bool fast = false;
+
   std::string symbolMap;
   std::string sourceMapFilename;
   std::string sourceMapUrl;
@@ -108,6 +168,13 @@ public:
     sourceMapUrl = sourceMapUrl_;
   }
   void setEmitModuleName(bool set) { emitModuleName = set; }
+  // Encode the code section on the thread pool; see
+  // WasmBinaryWriter::setParallelBodies.
+  void setParallelBodies(bool parallelBodies_) {
+    parallelBodies = parallelBodies_;
+  }
+  // Emit a slightly larger binary, faster; see WasmBinaryWriter::setFast.
+  void setFast(bool fast_) { fast = fast_; }
 
   // write text
   void writeText(Module& wasm, Output& output);
@@ -17,6 +17,14 @@
 #ifndef wasm_wasm_module_building_h
 #define wasm_wasm_module_building_h
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include "pass.h"
 #include <support/threads.h>
 #include <wasm.h>
@@ -55,7 +63,9 @@ static std::mutex debug;
 //
 // Usage: Create an instance, passing it the module and the total
 //        number of functions. Then call addFunction as you have
-//        new functions to add (this also adds it to the module). Finally,
+//        new functions to add (this also adds it to the module), or
+//        addExisting for functions that are already in the module (e.g.
+//        because a binary reader created them as it decoded). Finally,
 //        call finish() when all functions have been added.
 //
 // This avoids locking by using atomics. We allocate an array of nullptrs
@@ -161,6 +171,13 @@ public:
   // Add a function to the module, and to be optimized
   void addFunction(Function* func) {
     wasm->addFunction(func);
+    addExisting(func);
+  }
+
+  // Queue a function that is already in the module for optimization. This
+  // lets optimization overlap with whatever produces the functions, such as
+  // decoding their bodies from a binary.
+  void addExisting(Function* func) {
     if (!useWorkers()) {
       return; // we optimize at the end in that case
     }
@@ -196,10 +213,17 @@ public:
     // threads were transient
   }
 
+  // Run the global post-passes, see the note above about pre-passes.
+  void optimizeGlobally() {
+    PassRunner passRunner(wasm, passOptions);
+    passRunner.addDefaultGlobalOptimizationPostPasses();
+    passRunner.run();
+  }
+
 private:
   void createWorker() {
     DEBUG_THREAD("create a worker");
-    threads.emplace_back(make_unique<std::thread>(workerMain, this));
+    threads.emplace_back(std::make_unique<std::thread>(workerMain, this));
   }
 
   void notifyWorker() {
@@ -247,12 +271,6 @@ private:
     availableFuncs++;
   }
 
-  void optimizeGlobally() {
-    PassRunner passRunner(wasm, passOptions);
-    passRunner.addDefaultGlobalOptimizationPostPasses();
-    passRunner.run();
-  }
-
   // worker code
 
   void optimizeFunction(Function* func) {
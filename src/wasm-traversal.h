@@ -166,7 +166,7 @@ struct Walker : public VisitorType {
   // Walk starting
 
   void walkGlobal(Global* global) {
-    walk(global->init);
+    static_cast<SubType*>(this)->walk(global->init);
     static_cast<SubType*>(this)->visitGlobal(global);
   }
 
@@ -189,14 +189,17 @@ struct Walker : public VisitorType {
   }
 
   // override this to provide custom functionality
-  void doWalkFunction(Function* func) { walk(func->body); }
+  void doWalkFunction(Function* func) {
+    static_cast<SubType*>(this)->walk(func->body);
+  }
 
   void walkElementSegment(ElementSegment* segment) {
+    SubType* self = static_cast<SubType*>(this);
     if (segment->table.is()) {
-      walk(segment->offset);
+      self->walk(segment->offset);
     }
     for (auto* expr : segment->data) {
-      walk(expr);
+      self->walk(expr);
     }
     static_cast<SubType*>(this)->visitElementSegment(segment);
   }
@@ -207,7 +210,7 @@ struct Walker : public VisitorType {
 
   void walkDataSegment(DataSegment* segment) {
     if (!segment->isPassive) {
-      walk(segment->offset);
+      static_cast<SubType*>(this)->walk(segment->offset);
     }
     static_cast<SubType*>(this)->visitDataSegment(segment);
   }
@@ -310,6 +313,7 @@ struct Walker : public VisitorType {
     stack.pop_back();
     return ret;
   }
+  bool hasTasks() { return stack.size() > 0; }
 
   void walk(Expression*& root) {
     assert(stack.size() == 0);
@@ -338,10 +342,18 @@ struct Walker : public VisitorType {
 
   void setFunction(Function* func) { currFunction = func; }
 
-private:
+protected:
   // the address of the current node, used to replace it
   Expression** replacep = nullptr;
-  SmallVector<Task, 10> stack;      // stack of tasks
+
+private:
+  // The stack of tasks. Scanning a node pushes a task for each of its
+  // children at once, so the peak size is larger than just the nesting depth;
+  // a generous inline capacity keeps walks of typical functions entirely free
+  // of heap allocation. (The heap-allocated part, once grown, is retained
+  // across the many functions one walker instance processes, so even huge
+  // functions cause at most a few allocations per instance.)
+  SmallVector<Task, 64> stack;
   Function* currFunction = nullptr; // current function being processed
   Module* currModule = nullptr;     // current module being processed
 };
@@ -386,9 +398,133 @@ struct PostWalker : public Walker<SubType, VisitorType> {
   }
 };
 
+// As PostWalker, but only nodes of the given expression classes are visited,
+// e.g. FilteredPostWalker<MyPass, Expression::ConstId>. The entire tree is
+// still scanned in order to find them - there is no way to know whether a
+// subtree contains an interesting node without looking at it - but no visit
+// task is pushed for any other node, which removes most of the per-node task
+// overhead in passes that only care about one or two expression classes. The
+// filter is applied at compile time; the unneeded pushTask calls simply
+// vanish from the generated scan function.
+template<typename SubType, Expression::Id... VisitIds>
+struct FilteredPostWalker : public PostWalker<SubType> {
+
+  static void scan(SubType* self, Expression** currp) {
+    Expression* curr = *currp;
+
+#define DELEGATE_ID curr->_id
+
+#define DELEGATE_START(id)                                                     \
+  if (((Expression::id##Id == VisitIds) || ...)) {                             \
+    self->pushTask(SubType::doVisit##id, currp);                               \
+  }                                                                            \
+  auto* cast = curr->cast<id>();                                               \
+  WASM_UNUSED(cast);
+
+#define DELEGATE_GET_FIELD(id, field) cast->field
+
+#define DELEGATE_FIELD_CHILD(id, field)                                        \
+  self->pushTask(SubType::scan, &cast->field);
+
+#define DELEGATE_FIELD_OPTIONAL_CHILD(id, field)                               \
+  self->maybePushTask(SubType::scan, &cast->field);
+
+#define DELEGATE_FIELD_INT(id, field)
+#define DELEGATE_FIELD_INT_ARRAY(id, field)
+#define DELEGATE_FIELD_LITERAL(id, field)
+#define DELEGATE_FIELD_NAME(id, field)
+#define DELEGATE_FIELD_NAME_VECTOR(id, field)
+#define DELEGATE_FIELD_SCOPE_NAME_DEF(id, field)
+#define DELEGATE_FIELD_SCOPE_NAME_USE(id, field)
+#define DELEGATE_FIELD_SCOPE_NAME_USE_VECTOR(id, field)
+#define DELEGATE_FIELD_TYPE(id, field)
+#define DELEGATE_FIELD_HEAPTYPE(id, field)
+#define DELEGATE_FIELD_ADDRESS(id, field)
+
+#include "wasm-delegations-fields.def"
+  }
+};
+
+// As PostWalker, but with the task queue's indirect calls compiled away:
+// each queued task notes only whether its node is to be scanned or visited,
+// scanning is inlined into the walk loop, and visiting dispatches through
+// the visitor's switch on the expression id. With the concrete visitor type
+// known at compile time end-to-end, the compiler can inline the visit*
+// methods into the loop, where the function pointers PostWalker queues
+// defeat both inlining and branch prediction. Only the plain post-order
+// traversal is supported; subclasses that queue custom tasks must stay on
+// PostWalker.
+template<typename SubType, typename VisitorType = Visitor<SubType>>
+struct StaticPostWalker : public Walker<SubType, VisitorType> {
+
+  void walk(Expression*& root) {
+    SubType* self = static_cast<SubType*>(this);
+    assert(work.empty());
+    work.push_back({&root, false});
+    while (!work.empty()) {
+      auto task = work.back();
+      work.pop_back();
+      Expression* curr = *task.currp;
+      assert(curr);
+      if (task.visiting) {
+        this->replacep = task.currp;
+        self->visit(curr);
+        continue;
+      }
+      // Scanning: queue this node's visit, then its children, which, being
+      // queued later, are processed first. As in PostWalker, the delegations
+      // list children in reverse order of execution, so popping handles them
+      // in execution order.
+      work.push_back({task.currp, true});
+
+#define DELEGATE_ID curr->_id
+
+#define DELEGATE_START(id)                                                     \
+  auto* cast = curr->cast<id>();                                               \
+  WASM_UNUSED(cast);
+
+#define DELEGATE_GET_FIELD(id, field) cast->field
+
+#define DELEGATE_FIELD_CHILD(id, field) work.push_back({&cast->field, false});
+
+#define DELEGATE_FIELD_OPTIONAL_CHILD(id, field)                               \
+  if (cast->field) {                                                           \
+    work.push_back({&cast->field, false});                                     \
+  }
+
+#define DELEGATE_FIELD_INT(id, field)
+#define DELEGATE_FIELD_INT_ARRAY(id, field)
+#define DELEGATE_FIELD_LITERAL(id, field)
+#define DELEGATE_FIELD_NAME(id, field)
+#define DELEGATE_FIELD_NAME_VECTOR(id, field)
+#define DELEGATE_FIELD_SCOPE_NAME_DEF(id, field)
+#define DELEGATE_FIELD_SCOPE_NAME_USE(id, field)
+#define DELEGATE_FIELD_SCOPE_NAME_USE_VECTOR(id, field)
+#define DELEGATE_FIELD_TYPE(id, field)
+#define DELEGATE_FIELD_HEAPTYPE(id, field)
+#define DELEGATE_FIELD_ADDRESS(id, field)
+
+#include "wasm-delegations-fields.def"
+    }
+  }
+
+private:
+  struct Task {
+    Expression** currp;
+    // Whether the node is to be visited; if not, it is to be scanned.
+    bool visiting;
+  };
+
+  // As with Walker's task stack, a generous inline capacity keeps walks of
+  // typical functions entirely free of heap allocation.
+  SmallVector<Task, 64> work;
+};
+
 // Stacks of expressions tend to be limited in size (although, sometimes
-// super-nested blocks exist for br_table).
-typedef SmallVector<Expression*, 10> ExpressionStack;
+// super-nested blocks exist for br_table). These hold one entry per level of
+// nesting, so a moderate inline capacity makes almost all walks avoid heap
+// allocation entirely.
+typedef SmallVector<Expression*, 32> ExpressionStack;
 
 // Traversal with a control-flow stack.
 
@@ -56,6 +56,17 @@ TypeSystem getTypeSystem();
 // for tests.
 void destroyAllTypesForTestingPurposesOnly();
 
+// The memory retained by the global type stores, for memory reports. The
+// byte counts are estimates: they cover the canonical type infos and the
+// store's entries for them, not the allocator overhead around them.
+struct TypeSystemMemory {
+  size_t types = 0;
+  size_t typeBytes = 0;
+  size_t heapTypes = 0;
+  size_t heapTypeBytes = 0;
+};
+TypeSystemMemory getTypeSystemMemory();
+
 // The types defined in this file. All of them are small and typically passed by
 // value except for `Tuple` and `Struct`, which may own an unbounded amount of
 // data.
@@ -57,6 +57,12 @@ struct WasmValidator {
   typedef uint32_t Flags;
 
   bool validate(Module& module, Flags flags = Globally);
+
+  // Validate a single function. This does none of the global-structure
+  // checks, so it is suitable for incrementally revalidating just the
+  // functions a pass has touched; a full validate() must still run once at
+  // the end.
+  bool validate(Function* func, Module& module, Flags flags = Minimal);
 };
 
 } // namespace wasm
@@ -34,6 +34,7 @@
 
 #include "literal.h"
 #include "mixed_arena.h"
+#include "support/file.h"
 #include "support/index.h"
 #include "support/name.h"
 #include "wasm-features.h"
@@ -784,10 +785,21 @@ public:
 
 const char* getExpressionName(Expression* curr);
 
+// Whether the finalize(type) variants may trust the type they are given to
+// be final, skipping the re-scan that normally checks whether unreachability
+// from children must propagate into the parent. The pass runner enables this
+// for trusted pipelines (see PassOptions::trustedInput). This is a
+// process-wide setting; only toggle it while no other thread is building IR.
+void setTrustDeclaredTypes(bool trust);
+bool getTrustDeclaredTypes();
+
 Literal getLiteralFromConstExpression(Expression* curr);
 Literals getLiteralsFromConstExpression(Expression* curr);
 
-typedef ArenaVector<Expression*> ExpressionList;
+// Child lists store their first couple of elements inline, as most lists -
+// block children, call operands - are very short, and this avoids an arena
+// allocation for them entirely.
+typedef ArenaVector<Expression*, 2> ExpressionList;
 
 template<Expression::Id SID> class SpecificExpression : public Expression {
 public:
@@ -1934,6 +1946,14 @@ public:
   std::set<DebugLocation> prologLocation;
   std::set<DebugLocation> epilogLocation;
 
+  // Branch hints, from the branch hinting proposal's custom section: maps a
+  // hinted conditional branch (an If, a conditional Break, or a BrOn) to
+  // whether the branch is expected to be taken. A pass that replaces a hinted
+  // expression with an equivalent one should move the entry over (flipping
+  // the hint if it inverts the condition); entries whose expressions are no
+  // longer in the function are ignored when writing.
+  std::unordered_map<Expression*, bool> branchHints;
+
   // General debugging info support: track instructions and the function itself.
   std::unordered_map<Expression*, BinaryLocations::Span> expressionLocations;
   std::unordered_map<Expression*, BinaryLocations::DelimiterLocations>
@@ -2079,7 +2099,24 @@ public:
 class UserSection {
 public:
   std::string name;
+  // The payload, when we own it. When the section was read zero-copy this is
+  // empty and |view| refers into the input binary, which Module::inputBinary
+  // keeps alive; use getData()/getSize() to read the payload either way.
   std::vector<char> data;
+  BufferView view;
+
+  const char* getData() const {
+    return view.data() ? view.data() : data.data();
+  }
+  size_t getSize() const { return view.data() ? view.size() : data.size(); }
+
+  // Copies a viewed payload into |data|, for code that must own or mutate it.
+  void ensureOwnedData() {
+    if (view.data()) {
+      data.assign(view.data(), view.data() + view.size());
+      view = BufferView();
+    }
+  }
 };
 
 // The optional "dylink" section is used in dynamic linking.
@@ -2108,6 +2145,16 @@ public:
 
   std::vector<UserSection> userSections;
 
+  // The input binary this module was read from, when parts of the module
+  // (zero-copy user sections) refer into it rather than owning their bytes.
+  // Shared so that module copies remain valid.
+  std::shared_ptr<MappedFile> inputBinary;
+
+  // Other modules that this module must keep alive, because IR was moved out
+  // of them into here and still uses their arenas (see
+  // BinaryenModuleMergeContexts in the C API).
+  std::vector<std::unique_ptr<Module>> absorbedModules;
+
   // Optional user section IR representation.
   std::unique_ptr<DylinkSection> dylinkSection;
 
@@ -2140,6 +2187,9 @@ private:
   std::unordered_map<Name, Global*> globalsMap;
   std::unordered_map<Name, Tag*> tagsMap;
 
+  // Whether the module is frozen for concurrent read-only use, see freeze().
+  bool frozen = false;
+
 public:
   Module() = default;
 
@@ -2192,6 +2242,17 @@ public:
 
   void updateMaps();
 
+  // Prepares the module for concurrent read-only use: rebuilds all of the
+  // lookup maps, so that they are complete, and marks the module as frozen,
+  // after which adding or removing a module element asserts. Multiple
+  // analyses may then query the module in parallel, as no lookup will mutate
+  // it. (Note that this only guards the module's own structures; analyses
+  // must still not modify the contents of existing elements, like function
+  // bodies.) Call unfreeze() before modifying the module again.
+  void freeze();
+  void unfreeze();
+  bool isFrozen() const { return frozen; }
+
   void clearDebugInfo();
 };
 
@@ -119,6 +119,16 @@ Literal::Literal(const Literal& other) : type(other.type) {
   }
 }
 
+Literal::Literal(Literal&& other) : type(other.type) {
+  if (!type.isBasic() && other.isData()) {
+    new (&gcData) std::shared_ptr<GCData>(std::move(other.gcData));
+    return;
+  }
+  // All the other payloads are trivially copyable, so we can just copy the
+  // union's bytes.
+  memcpy(&v128, &other.v128, sizeof(v128));
+}
+
 Literal::~Literal() {
   // Early exit for the common case; basic types need no special handling.
   if (type.isBasic()) {
@@ -137,6 +147,14 @@ Literal& Literal::operator=(const Literal& other) {
   return *this;
 }
 
+Literal& Literal::operator=(Literal&& other) {
+  if (this != &other) {
+    this->~Literal();
+    new (this) auto(std::move(other));
+  }
+  return *this;
+}
+
 template<typename LaneT, int Lanes>
 static void extractBytes(uint8_t (&dest)[16], const LaneArray<Lanes>& lanes) {
   std::array<uint8_t, 16> bytes;
@@ -1668,10 +1686,68 @@ static Literal unary(const Literal& val) {
   return Literal(lanes);
 }
 
+// Going through a LaneArray, as the helpers above do, builds a Literal per
+// lane, which is costly on the hottest interpreter SIMD paths (fuzzing and
+// the spec tests execute these operations in great numbers). For lanewise
+// operations whose semantics are plain wraparound integer arithmetic or
+// bitwise logic we instead operate on raw lane values, which avoids those
+// temporaries and leaves the compiler simple loops that it can vectorize
+// with whatever SIMD the host has. Lanes are encoded in little-endian order
+// regardless of the host, as in getLanes and extractBytes above. Only
+// unsigned lane types are used, keeping the wraparound well-defined.
+template<typename LaneT, size_t Lanes>
+static void getRawLanes(const Literal& val, LaneT (&lanes)[Lanes]) {
+  assert(val.type == Type::v128);
+  const size_t laneWidth = 16 / Lanes;
+  const uint8_t* bytes = val.getv128Ptr();
+  for (size_t i = 0; i < Lanes; ++i) {
+    LaneT lane(0);
+    for (size_t offset = 0; offset < laneWidth; ++offset) {
+      lane |= LaneT(LaneT(bytes[i * laneWidth + offset]) << (8 * offset));
+    }
+    lanes[i] = lane;
+  }
+}
+
+template<typename LaneT, size_t Lanes>
+static Literal makeRawLanes(const LaneT (&lanes)[Lanes]) {
+  uint8_t bytes[16];
+  const size_t laneWidth = 16 / Lanes;
+  for (size_t i = 0; i < Lanes; ++i) {
+    for (size_t offset = 0; offset < laneWidth; ++offset) {
+      bytes[i * laneWidth + offset] = uint8_t(lanes[i] >> (8 * offset));
+    }
+  }
+  return Literal(bytes);
+}
+
+template<typename LaneT, typename Op>
+static Literal unaryRaw(const Literal& val, Op op) {
+  constexpr size_t Lanes = 16 / sizeof(LaneT);
+  LaneT lanes[Lanes];
+  getRawLanes(val, lanes);
+  for (size_t i = 0; i < Lanes; ++i) {
+    lanes[i] = op(lanes[i]);
+  }
+  return makeRawLanes(lanes);
+}
+
+template<typename LaneT, typename Op>
+static Literal binaryRaw(const Literal& left, const Literal& right, Op op) {
+  constexpr size_t Lanes = 16 / sizeof(LaneT);
+  LaneT leftLanes[Lanes];
+  LaneT rightLanes[Lanes];
+  getRawLanes(left, leftLanes);
+  getRawLanes(right, rightLanes);
+  for (size_t i = 0; i < Lanes; ++i) {
+    leftLanes[i] = op(leftLanes[i], rightLanes[i]);
+  }
+  return makeRawLanes(leftLanes);
+}
+
 Literal Literal::notV128() const {
-  std::array<uint8_t, 16> ones;
-  ones.fill(0xff);
-  return xorV128(Literal(ones.data()));
+  return unaryRaw<uint8_t>(*this,
+                           [](uint8_t lane) { return uint8_t(~lane); });
 }
 Literal Literal::absI8x16() const {
   return unary<16, &Literal::getLanesSI8x16, &Literal::abs>(*this);
@@ -1686,19 +1762,21 @@ Literal Literal::absI64x2() const {
   return unary<2, &Literal::getLanesI64x2, &Literal::abs>(*this);
 }
 Literal Literal::negI8x16() const {
-  return unary<16, &Literal::getLanesUI8x16, &Literal::neg>(*this);
+  return unaryRaw<uint8_t>(*this,
+                           [](uint8_t lane) { return uint8_t(-lane); });
 }
 Literal Literal::popcntI8x16() const {
   return unary<16, &Literal::getLanesUI8x16, &Literal::popCount>(*this);
 }
 Literal Literal::negI16x8() const {
-  return unary<8, &Literal::getLanesUI16x8, &Literal::neg>(*this);
+  return unaryRaw<uint16_t>(*this,
+                            [](uint16_t lane) { return uint16_t(-lane); });
 }
 Literal Literal::negI32x4() const {
-  return unary<4, &Literal::getLanesI32x4, &Literal::neg>(*this);
+  return unaryRaw<uint32_t>(*this, [](uint32_t lane) { return -lane; });
 }
 Literal Literal::negI64x2() const {
-  return unary<2, &Literal::getLanesI64x2, &Literal::neg>(*this);
+  return unaryRaw<uint64_t>(*this, [](uint64_t lane) { return -lane; });
 }
 Literal Literal::absF32x4() const {
   return unary<4, &Literal::getLanesF32x4, &Literal::abs>(*this);
@@ -2081,16 +2159,20 @@ static Literal binary(const Literal& val, const Literal& other) {
 }
 
 Literal Literal::andV128(const Literal& other) const {
-  return binary<4, &Literal::getLanesI32x4, &Literal::and_>(*this, other);
+  return binaryRaw<uint8_t>(
+    *this, other, [](uint8_t a, uint8_t b) { return uint8_t(a & b); });
 }
 Literal Literal::orV128(const Literal& other) const {
-  return binary<4, &Literal::getLanesI32x4, &Literal::or_>(*this, other);
+  return binaryRaw<uint8_t>(
+    *this, other, [](uint8_t a, uint8_t b) { return uint8_t(a | b); });
 }
 Literal Literal::xorV128(const Literal& other) const {
-  return binary<4, &Literal::getLanesI32x4, &Literal::xor_>(*this, other);
+  return binaryRaw<uint8_t>(
+    *this, other, [](uint8_t a, uint8_t b) { return uint8_t(a ^ b); });
 }
 Literal Literal::addI8x16(const Literal& other) const {
-  return binary<16, &Literal::getLanesUI8x16, &Literal::add>(*this, other);
+  return binaryRaw<uint8_t>(
+    *this, other, [](uint8_t a, uint8_t b) { return uint8_t(a + b); });
 }
 Literal Literal::addSaturateSI8x16(const Literal& other) const {
   return binary<16, &Literal::getLanesUI8x16, &Literal::addSatSI8>(*this,
@@ -2101,7 +2183,8 @@ Literal Literal::addSaturateUI8x16(const Literal& other) const {
                                                                    other);
 }
 Literal Literal::subI8x16(const Literal& other) const {
-  return binary<16, &Literal::getLanesUI8x16, &Literal::sub>(*this, other);
+  return binaryRaw<uint8_t>(
+    *this, other, [](uint8_t a, uint8_t b) { return uint8_t(a - b); });
 }
 Literal Literal::subSaturateSI8x16(const Literal& other) const {
   return binary<16, &Literal::getLanesUI8x16, &Literal::subSatSI8>(*this,
@@ -2127,7 +2210,8 @@ Literal Literal::avgrUI8x16(const Literal& other) const {
   return binary<16, &Literal::getLanesUI8x16, &Literal::avgrUInt>(*this, other);
 }
 Literal Literal::addI16x8(const Literal& other) const {
-  return binary<8, &Literal::getLanesUI16x8, &Literal::add>(*this, other);
+  return binaryRaw<uint16_t>(
+    *this, other, [](uint16_t a, uint16_t b) { return uint16_t(a + b); });
 }
 Literal Literal::addSaturateSI16x8(const Literal& other) const {
   return binary<8, &Literal::getLanesUI16x8, &Literal::addSatSI16>(*this,
@@ -2138,7 +2222,8 @@ Literal Literal::addSaturateUI16x8(const Literal& other) const {
                                                                    other);
 }
 Literal Literal::subI16x8(const Literal& other) const {
-  return binary<8, &Literal::getLanesUI16x8, &Literal::sub>(*this, other);
+  return binaryRaw<uint16_t>(
+    *this, other, [](uint16_t a, uint16_t b) { return uint16_t(a - b); });
 }
 Literal Literal::subSaturateSI16x8(const Literal& other) const {
   return binary<8, &Literal::getLanesUI16x8, &Literal::subSatSI16>(*this,
@@ -2149,7 +2234,11 @@ Literal Literal::subSaturateUI16x8(const Literal& other) const {
                                                                    other);
 }
 Literal Literal::mulI16x8(const Literal& other) const {
-  return binary<8, &Literal::getLanesUI16x8, &Literal::mul>(*this, other);
+  // Multiply in uint32_t, as uint16_t would promote to int, whose overflow
+  // is undefined.
+  return binaryRaw<uint16_t>(*this, other, [](uint16_t a, uint16_t b) {
+    return uint16_t(uint32_t(a) * uint32_t(b));
+  });
 }
 Literal Literal::minSI16x8(const Literal& other) const {
   return binary<8, &Literal::getLanesSI16x8, &Literal::minInt>(*this, other);
@@ -2171,13 +2260,16 @@ Literal Literal::q15MulrSatSI16x8(const Literal& other) const {
                                                                        other);
 }
 Literal Literal::addI32x4(const Literal& other) const {
-  return binary<4, &Literal::getLanesI32x4, &Literal::add>(*this, other);
+  return binaryRaw<uint32_t>(
+    *this, other, [](uint32_t a, uint32_t b) { return a + b; });
 }
 Literal Literal::subI32x4(const Literal& other) const {
-  return binary<4, &Literal::getLanesI32x4, &Literal::sub>(*this, other);
+  return binaryRaw<uint32_t>(
+    *this, other, [](uint32_t a, uint32_t b) { return a - b; });
 }
 Literal Literal::mulI32x4(const Literal& other) const {
-  return binary<4, &Literal::getLanesI32x4, &Literal::mul>(*this, other);
+  return binaryRaw<uint32_t>(
+    *this, other, [](uint32_t a, uint32_t b) { return a * b; });
 }
 Literal Literal::minSI32x4(const Literal& other) const {
   return binary<4, &Literal::getLanesI32x4, &Literal::minInt>(*this, other);
@@ -2192,13 +2284,16 @@ Literal Literal::maxUI32x4(const Literal& other) const {
   return binary<4, &Literal::getLanesI32x4, &Literal::maxUInt>(*this, other);
 }
 Literal Literal::addI64x2(const Literal& other) const {
-  return binary<2, &Literal::getLanesI64x2, &Literal::add>(*this, other);
+  return binaryRaw<uint64_t>(
+    *this, other, [](uint64_t a, uint64_t b) { return a + b; });
 }
 Literal Literal::subI64x2(const Literal& other) const {
-  return binary<2, &Literal::getLanesI64x2, &Literal::sub>(*this, other);
+  return binaryRaw<uint64_t>(
+    *this, other, [](uint64_t a, uint64_t b) { return a - b; });
 }
 Literal Literal::mulI64x2(const Literal& other) const {
-  return binary<2, &Literal::getLanesI64x2, &Literal::mul>(*this, other);
+  return binaryRaw<uint64_t>(
+    *this, other, [](uint64_t a, uint64_t b) { return a * b; });
 }
 Literal Literal::addF32x4(const Literal& other) const {
   return binary<4, &Literal::getLanesF32x4, &Literal::add>(*this, other);
@@ -15,14 +15,20 @@
  */
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <fstream>
 
 #include "ir/eh-utils.h"
+#include "ir/find_all.h"
+#include "ir/manipulation.h"
 #include "ir/module-utils.h"
 #include "ir/table-utils.h"
 #include "ir/type-updating.h"
 #include "support/bits.h"
 #include "support/debug.h"
+#include "support/hash.h"
+#include "support/threads.h"
 #include "wasm-binary.h"
 #include "wasm-debug.h"
 #include "wasm-stack.h"
@@ -33,12 +39,33 @@ namespace wasm {
 
 void WasmBinaryWriter::prepare() {
   // Collect function types and their frequencies. Collect information in each
-  // function in parallel, then merge.
-  indexedTypes = ModuleUtils::getOptimizedIndexedHeapTypes(*wasm);
+  // function in parallel, then merge. In fast mode skip the frequency
+  // sorting, which gives up a little code size on the LEB-encoded type
+  // indices to avoid the sort.
+  indexedTypes = fast ? ModuleUtils::getIndexedHeapTypes(*wasm)
+                      : ModuleUtils::getOptimizedIndexedHeapTypes(*wasm);
   importInfo = wasm::make_unique<ImportInfo>(*wasm);
 }
 
 void WasmBinaryWriter::write() {
+  // Writing a source map records absolute buffer offsets, which streaming
+  // would invalidate, so do not stream in that case.
+  if (sourceMap) {
+    sink = nullptr;
+  }
+  if (sink) {
+    // A seekable sink lets us backpatch the code section size at the end, and
+    // hence stream out each function body as it is finished.
+    sinkSeekable = sink->tellp() != std::streampos(-1);
+  }
+
+  if (emitChecksums) {
+    // Each section's payload must still be in the buffer when the section
+    // finishes, so that it can be hashed there; that rules out streaming
+    // function bodies out mid-section.
+    sinkSeekable = false;
+  }
+
   writeHeader();
 
   writeDylinkSection();
@@ -62,6 +89,7 @@ void WasmBinaryWriter::write() {
   writeStart();
   writeElementSegments();
   writeDataCount();
+  writeBranchHints();
   writeFunctions();
   writeDataSegments();
   if (debugInfo || emitModuleName) {
@@ -88,6 +116,13 @@ void WasmBinaryWriter::write() {
 
   writeLateUserSections();
   writeFeaturesSection();
+  if (emitChecksums) {
+    writeChecksumsSection();
+  }
+
+  // Flush anything that remains (the header alone, in a module with no
+  // sections at all).
+  flushToSink();
 }
 
 void WasmBinaryWriter::writeHeader() {
@@ -131,9 +166,43 @@ template<typename T> int32_t WasmBinaryWriter::startSection(T code) {
   return writeU32LEBPlaceholder(); // section size to be filled in later
 }
 
+void WasmBinaryWriter::flushToSink() {
+  if (!sink || o.empty()) {
+    return;
+  }
+  sink->write(reinterpret_cast<const char*>(o.data()), o.size());
+  flushedBytes += o.size();
+  o.clear();
+}
+
 void WasmBinaryWriter::finishSection(int32_t start) {
+  patchSectionSize(start);
+  if (emitChecksums) {
+    // The payload is final now; hash it while it is still in the buffer.
+    // Skip the (already shrunk) size LEB to find where it begins.
+    size_t payload = start;
+    while (o[payload] & 0x80) {
+      payload++;
+    }
+    payload++;
+    sectionChecksums.emplace_back(
+      o[start - 1], fastHash(o.data() + payload, o.size() - payload));
+  }
+  // The section is complete and will not be touched again, so it can go out
+  // to the sink, if we are streaming.
+  flushToSink();
+}
+
+void WasmBinaryWriter::patchSectionSize(int32_t start) {
   // section size does not include the reserved bytes of the size field itself
   int32_t size = o.size() - start - MaxLEB32Bytes;
+  if (fast && !sourceMap &&
+      binaryLocationsSizeAtSectionStart == binaryLocations.expressions.size()) {
+    // In fast mode leave the size LEB at its full reserved width, so that
+    // nothing after it has to move.
+    o.writeAtFullFixedSize(start, U32LEB(size));
+    return;
+  }
   auto sizeFieldSize = o.writeAt(start, U32LEB(size));
   // We can move things back if the actual LEB for the size doesn't use the
   // maximum 5 bytes. In that case we need to adjust offsets after we move
@@ -191,7 +260,11 @@ WasmBinaryWriter::startSubsection(BinaryConsts::UserSections::Subsection code) {
   return startSection(code);
 }
 
-void WasmBinaryWriter::finishSubsection(int32_t start) { finishSection(start); }
+void WasmBinaryWriter::finishSubsection(int32_t start) {
+  // Note that we do not flush to the sink here, as the enclosing section is
+  // still in progress.
+  patchSectionSize(start);
+}
 
 void WasmBinaryWriter::writeStart() {
   if (!wasm->start.is()) {
@@ -375,83 +448,320 @@ void WasmBinaryWriter::writeExpression(Expression* curr) {
   BinaryenIRToBinaryWriter(*this, o).visit(curr);
 }
 
+void WasmBinaryWriter::writeBranchHints() {
+  // Collect the hinted functions. Only hints whose expressions are actually
+  // present in the function body count: a pass may have dropped a hinted
+  // expression without clearing its entry, and such stale entries must not
+  // produce section records, as every record emitted here is backpatched by
+  // an instruction write later; see noteBranchHint.
+  std::vector<Function*> funcs;
+  ModuleUtils::iterDefinedFunctions(*wasm, [&](Function* func) {
+    if (func->branchHints.empty()) {
+      return;
+    }
+    auto& slots = branchHintSlots[func];
+    FindAllOf<If, Break, BrOn> found(func->body);
+    auto note = [&](Expression* curr) {
+      if (func->branchHints.count(curr)) {
+        slots.expressions.insert(curr);
+      }
+    };
+    for (auto* curr : found.list<If>()) {
+      note(curr);
+    }
+    for (auto* curr : found.list<Break>()) {
+      if (curr->condition) {
+        note(curr);
+      }
+    }
+    for (auto* curr : found.list<BrOn>()) {
+      note(curr);
+    }
+    if (slots.expressions.empty()) {
+      branchHintSlots.erase(func);
+      return;
+    }
+    funcs.push_back(func);
+  });
+  if (funcs.empty()) {
+    return;
+  }
+  // The section must precede the code section, whose offsets it refers to,
+  // so emit fixed-width placeholders for each offset and hint value and
+  // backpatch them as the hinted instructions are written out.
+  auto start = startSection(BinaryConsts::Section::User);
+  writeInlineString(BinaryConsts::UserSections::BranchHint);
+  o << U32LEB(funcs.size());
+  for (auto* func : funcs) {
+    auto& slots = branchHintSlots[func];
+    o << U32LEB(getFunctionIndex(func->name));
+    o << U32LEB(slots.expressions.size());
+    for (size_t i = 0; i < slots.expressions.size(); i++) {
+      slots.offsetPositions.push_back(writeU32LEBPlaceholder());
+      // The size of the hint contents, then the (placeholder) hint value.
+      o << U32LEB(1);
+      slots.valuePositions.push_back(o.size());
+      o << int8_t(0);
+    }
+  }
+  // Finishing the section may shrink its size LEB, moving the payload (and
+  // our recorded placeholder positions) backwards.
+  auto sizeBefore = o.size();
+  finishSection(start);
+  if (auto adjustment = sizeBefore - o.size()) {
+    for (auto& [_, slots] : branchHintSlots) {
+      for (auto& pos : slots.offsetPositions) {
+        pos -= adjustment;
+      }
+      for (auto& pos : slots.valuePositions) {
+        pos -= adjustment;
+      }
+    }
+  }
+}
+
+void WasmBinaryWriter::noteBranchHint(Function* func,
+                                      Expression* curr,
+                                      size_t codePos) {
+  if (branchHintSlots.empty()) {
+    return;
+  }
+  auto iter = branchHintSlots.find(func);
+  if (iter == branchHintSlots.end()) {
+    return;
+  }
+  auto& slots = iter->second;
+  if (!slots.expressions.count(curr)) {
+    return;
+  }
+  // Instructions are emitted in offset order, so consuming the placeholders
+  // in emission order keeps the section's hints sorted, as required.
+  assert(slots.used < slots.offsetPositions.size());
+  o.writeAtFullFixedSize(slots.offsetPositions[slots.used],
+                         U32LEB(uint32_t(codePos - currFunctionBodyStart)));
+  o[slots.valuePositions[slots.used]] = func->branchHints[curr] ? 1 : 0;
+  slots.used++;
+}
+
 void WasmBinaryWriter::writeFunctions() {
   if (importInfo->getNumDefinedFunctions() == 0) {
     return;
   }
   BYN_TRACE("== writeFunctions\n");
-  auto sectionStart = startSection(BinaryConsts::Section::Code);
-  o << U32LEB(importInfo->getNumDefinedFunctions());
   bool DWARF = Debug::hasDWARFSections(*getModule());
-  ModuleUtils::iterDefinedFunctions(*wasm, [&](Function* func) {
-    assert(binaryLocationTrackedExpressionsForFunc.empty());
-    size_t sourceMapLocationsSizeAtFunctionStart = sourceMapLocations.size();
-    BYN_TRACE("write one at" << o.size() << std::endl);
-    size_t sizePos = writeU32LEBPlaceholder();
-    size_t start = o.size();
-    BYN_TRACE("writing" << func->name << std::endl);
-    // Emit Stack IR if present, and if we can
-    if (func->stackIR && !sourceMap && !DWARF) {
-      BYN_TRACE("write Stack IR\n");
-      StackIRToBinaryWriter writer(*this, o, func);
-      writer.write();
-      if (debugInfo) {
-        funcMappedLocals[func->name] = std::move(writer.getMappedLocals());
-      }
-    } else {
-      BYN_TRACE("write Binaryen IR\n");
-      BinaryenIRToBinaryWriter writer(*this, o, func, sourceMap, DWARF);
-      writer.write();
-      if (debugInfo) {
-        funcMappedLocals[func->name] = std::move(writer.getMappedLocals());
+  // With a seekable sink we can stream each function body out as it is
+  // finished: the code section's size is not known until the end, so emit a
+  // full-width (padded) size LEB and backpatch it through a seek. That padded
+  // LEB makes the output slightly larger and non-canonical, so only do it in
+  // fast mode, which already trades a few bytes for speed (the default path
+  // still streams, but a whole section at a time, with identical output).
+  // DWARF tracks buffer-relative locations that the section-end fixup
+  // adjusts, so it requires the buffered path.
+  // Branch hints are backpatched into the already-emitted hint section while
+  // the bodies are written, so both streaming and parallel encoding require
+  // that there are none; see writeBranchHints.
+  bool stream = sink && sinkSeekable && fast && !sourceMap && !DWARF &&
+                branchHintSlots.empty();
+  int32_t sectionStart = 0;
+  size_t sizeFieldOffsetInFile = 0;
+  if (stream) {
+    flushToSink();
+    o << uint8_t(BinaryConsts::Section::Code);
+    sizeFieldOffsetInFile = flushedBytes + o.size();
+    writeU32LEBPlaceholder();
+  } else {
+    sectionStart = startSection(BinaryConsts::Section::Code);
+  }
+  o << U32LEB(importInfo->getNumDefinedFunctions());
+  // Encoding on the thread pool is worthwhile when there are enough bodies to
+  // keep the threads busy, and possible when nothing tracks offsets in the
+  // single output buffer.
+  if (parallelBodies && !sourceMap && !DWARF && branchHintSlots.empty() &&
+      importInfo->getNumDefinedFunctions() > 1 &&
+      ThreadPool::get()->size() > 1) {
+    writeFunctionsParallel(stream);
+  } else {
+    ModuleUtils::iterDefinedFunctions(*wasm, [&](Function* func) {
+      auto entry = writeFunction(func, DWARF);
+      tableOfContents.functionBodies.emplace_back(
+        func->name, flushedBytes + entry.contentsOffset, entry.size);
+      if (stream) {
+        // This body is final; it can go out to the sink.
+        flushToSink();
       }
+    });
+  }
+  if (stream) {
+    flushToSink();
+    // Backpatch the section size, now that we know it. Keep the padded
+    // full-width encoding, as the bytes after it have already been emitted.
+    size_t sectionSize =
+      flushedBytes - sizeFieldOffsetInFile - size_t(MaxLEB32Bytes);
+    uint8_t padded[MaxLEB32Bytes];
+    uint32_t value = uint32_t(sectionSize);
+    for (size_t i = 0; i < MaxLEB32Bytes; i++) {
+      padded[i] = value & 0x7f;
+      value >>= 7;
+      if (i + 1 < MaxLEB32Bytes) {
+        padded[i] |= 0x80;
+      }
+    }
+    auto here = sink->tellp();
+    sink->seekp(sizeFieldOffsetInFile);
+    sink->write(reinterpret_cast<const char*>(padded), MaxLEB32Bytes);
+    sink->seekp(here);
+  } else {
+    finishSection(sectionStart);
+  }
+}
+
+WasmBinaryWriter::CodeEntry WasmBinaryWriter::writeFunction(Function* func,
+                                                            bool DWARF) {
+  assert(binaryLocationTrackedExpressionsForFunc.empty());
+  size_t sourceMapLocationsSizeAtFunctionStart = sourceMapLocations.size();
+  BYN_TRACE("write one at" << o.size() << std::endl);
+  size_t sizePos = writeU32LEBPlaceholder();
+  size_t start = o.size();
+  // Hint offsets are relative to the body start; moving the body backwards
+  // when the size LEB shrinks keeps them valid, as both move together.
+  currFunctionBodyStart = start;
+  BYN_TRACE("writing" << func->name << std::endl);
+  // Emit Stack IR if present, and if we can
+  if (func->stackIR && !sourceMap && !DWARF) {
+    BYN_TRACE("write Stack IR\n");
+    StackIRToBinaryWriter writer(*this, o, func);
+    writer.write();
+    if (debugInfo) {
+      funcMappedLocals[func->name] = std::move(writer.getMappedLocals());
     }
-    size_t size = o.size() - start;
-    assert(size <= std::numeric_limits<uint32_t>::max());
-    BYN_TRACE("body size: " << size << ", writing at " << sizePos
-                            << ", next starts at " << o.size() << "\n");
-    auto sizeFieldSize = o.writeAt(sizePos, U32LEB(size));
-    // We can move things back if the actual LEB for the size doesn't use the
-    // maximum 5 bytes. In that case we need to adjust offsets after we move
-    // things backwards.
-    auto adjustmentForLEBShrinking = MaxLEB32Bytes - sizeFieldSize;
-    if (adjustmentForLEBShrinking) {
-      // we can save some room, nice
-      assert(sizeFieldSize < MaxLEB32Bytes);
-      std::move(&o[start], &o[start] + size, &o[sizePos] + sizeFieldSize);
-      o.resize(o.size() - adjustmentForLEBShrinking);
-      if (sourceMap) {
-        for (auto i = sourceMapLocationsSizeAtFunctionStart;
-             i < sourceMapLocations.size();
-             ++i) {
-          sourceMapLocations[i].first -= adjustmentForLEBShrinking;
-        }
+  } else {
+    BYN_TRACE("write Binaryen IR\n");
+    BinaryenIRToBinaryWriter writer(*this, o, func, sourceMap, DWARF);
+    writer.write();
+    if (debugInfo) {
+      funcMappedLocals[func->name] = std::move(writer.getMappedLocals());
+    }
+  }
+  size_t size = o.size() - start;
+  assert(size <= std::numeric_limits<uint32_t>::max());
+  BYN_TRACE("body size: " << size << ", writing at " << sizePos
+                          << ", next starts at " << o.size() << "\n");
+  if (fast && !sourceMap && !DWARF) {
+    // See patchSectionSize: keep the full-width size LEB rather than moving
+    // the body backwards over the saved bytes.
+    o.writeAtFullFixedSize(sizePos, U32LEB(size));
+    return CodeEntry{sizePos, sizePos + MaxLEB32Bytes, size};
+  }
+  auto sizeFieldSize = o.writeAt(sizePos, U32LEB(size));
+  // We can move things back if the actual LEB for the size doesn't use the
+  // maximum 5 bytes. In that case we need to adjust offsets after we move
+  // things backwards.
+  auto adjustmentForLEBShrinking = MaxLEB32Bytes - sizeFieldSize;
+  if (adjustmentForLEBShrinking) {
+    // we can save some room, nice
+    assert(sizeFieldSize < MaxLEB32Bytes);
+    std::move(&o[start], &o[start] + size, &o[sizePos] + sizeFieldSize);
+    o.resize(o.size() - adjustmentForLEBShrinking);
+    if (sourceMap) {
+      for (auto i = sourceMapLocationsSizeAtFunctionStart;
+           i < sourceMapLocations.size();
+           ++i) {
+        sourceMapLocations[i].first -= adjustmentForLEBShrinking;
       }
-      for (auto* curr : binaryLocationTrackedExpressionsForFunc) {
-        // We added the binary locations, adjust them: they must be relative
-        // to the code section.
-        auto& span = binaryLocations.expressions[curr];
-        span.start -= adjustmentForLEBShrinking;
-        span.end -= adjustmentForLEBShrinking;
-        auto iter = binaryLocations.delimiters.find(curr);
-        if (iter != binaryLocations.delimiters.end()) {
-          for (auto& item : iter->second) {
-            item -= adjustmentForLEBShrinking;
-          }
+    }
+    for (auto* curr : binaryLocationTrackedExpressionsForFunc) {
+      // We added the binary locations, adjust them: they must be relative
+      // to the code section.
+      auto& span = binaryLocations.expressions[curr];
+      span.start -= adjustmentForLEBShrinking;
+      span.end -= adjustmentForLEBShrinking;
+      auto iter = binaryLocations.delimiters.find(curr);
+      if (iter != binaryLocations.delimiters.end()) {
+        for (auto& item : iter->second) {
+          item -= adjustmentForLEBShrinking;
         }
       }
     }
-    if (!binaryLocationTrackedExpressionsForFunc.empty()) {
-      binaryLocations.functions[func] = BinaryLocations::FunctionLocations{
-        BinaryLocation(sizePos),
-        BinaryLocation(start - adjustmentForLEBShrinking),
-        BinaryLocation(o.size())};
-    }
+  }
+  if (!binaryLocationTrackedExpressionsForFunc.empty()) {
+    binaryLocations.functions[func] = BinaryLocations::FunctionLocations{
+      BinaryLocation(sizePos),
+      BinaryLocation(start - adjustmentForLEBShrinking),
+      BinaryLocation(o.size())};
+  }
+  binaryLocationTrackedExpressionsForFunc.clear();
+  return CodeEntry{sizePos, sizePos + sizeFieldSize, size};
+}
+
+void WasmBinaryWriter::writeFunctionsParallel(bool stream) {
+  BYN_TRACE("== writeFunctionsParallel\n");
+  std::vector<Function*> funcs;
+  ModuleUtils::iterDefinedFunctions(*wasm,
+                                    [&](Function* func) { funcs.push_back(func); });
+  auto numFunctions = funcs.size();
+  // Each worker encodes into a buffer of its own, with a writer of its own,
+  // so that nothing (local mappings, LEB backpatching) is shared. Where each
+  // function landed is recorded so the slices can be concatenated in function
+  // order afterward, making the bytes identical to a sequential write.
+  struct Slice {
+    size_t worker;
+    size_t start;
+    size_t size;
+    CodeEntry entry;
+  };
+  std::vector<Slice> slices(numFunctions);
+  auto numWorkers = ThreadPool::get()->size();
+  std::vector<std::unique_ptr<BufferWithRandomAccess>> buffers;
+  std::vector<std::unique_ptr<WasmBinaryWriter>> writers;
+  for (size_t i = 0; i < numWorkers; i++) {
+    buffers.push_back(std::make_unique<BufferWithRandomAccess>());
+    writers.push_back(std::unique_ptr<WasmBinaryWriter>(
+      new WasmBinaryWriter(wasm, *buffers.back(), *this)));
+  }
+  std::atomic<size_t> nextFunction{0};
+  std::vector<std::function<ThreadWorkState()>> doWorkers;
+  for (size_t worker = 0; worker < numWorkers; worker++) {
+    auto* writer = writers[worker].get();
+    auto* buffer = buffers[worker].get();
+    doWorkers.push_back([&, worker, writer, buffer]() {
+      auto index = nextFunction.fetch_add(1);
+      if (index >= numFunctions) {
+        return ThreadWorkState::Finished;
+      }
+      auto start = buffer->size();
+      auto entry = writer->writeFunction(funcs[index], false);
+      slices[index] = {worker, start, buffer->size() - start, entry};
+      if (index + 1 == numFunctions) {
+        return ThreadWorkState::Finished;
+      }
+      return ThreadWorkState::More;
+    });
+  }
+  ThreadPool::get()->work(doWorkers);
+  // Concatenate in function order.
+  for (size_t i = 0; i < numFunctions; i++) {
+    auto& slice = slices[i];
+    auto& buffer = *buffers[slice.worker];
+    auto base = o.size();
+    o.insert(o.end(),
+             buffer.begin() + slice.start,
+             buffer.begin() + slice.start + slice.size);
     tableOfContents.functionBodies.emplace_back(
-      func->name, sizePos + sizeFieldSize, size);
-    binaryLocationTrackedExpressionsForFunc.clear();
-  });
-  finishSection(sectionStart);
+      funcs[i]->name,
+      flushedBytes + base + (slice.entry.contentsOffset - slice.start),
+      slice.entry.size);
+    if (stream) {
+      flushToSink();
+    }
+  }
+  // Merge the local mappings the workers gathered, for the names section.
+  if (debugInfo) {
+    for (auto& writer : writers) {
+      for (auto& [name, locals] : writer->funcMappedLocals) {
+        funcMappedLocals[name] = std::move(locals);
+      }
+    }
+  }
 }
 
 void WasmBinaryWriter::writeStrings() {
@@ -822,18 +1132,34 @@ void WasmBinaryWriter::writeNames() {
 
   // local names
   {
-    // Find all functions with at least one local name and only emit the
-    // subsection if there is at least one.
-    std::vector<std::pair<Index, Function*>> functionsWithLocalNames;
+    // Find all functions with at least one local name, collecting the named
+    // locals in the same pass (localNames has an entry per named local, so
+    // there is no need to scan all the locals; we just need to sort the
+    // entries back into index order). Only emit the subsection if there is at
+    // least one.
+    struct FuncLocalNames {
+      Index funcIndex;
+      Function* func;
+      // Pairs of (local index in IR, name).
+      std::vector<std::pair<Index, Name>> locals;
+    };
+    std::vector<FuncLocalNames> functionsWithLocalNames;
     Index checked = 0;
     auto check = [&](Function* curr) {
+      std::vector<std::pair<Index, Name>> localsWithNames;
       auto numLocals = curr->getNumLocals();
-      for (Index i = 0; i < numLocals; ++i) {
-        if (curr->hasLocalName(i)) {
-          functionsWithLocalNames.push_back({checked, curr});
-          break;
+      for (auto& [i, name] : curr->localNames) {
+        if (i < numLocals) {
+          localsWithNames.push_back({i, name});
         }
       }
+      if (!localsWithNames.empty()) {
+        std::sort(localsWithNames.begin(),
+                  localsWithNames.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+        functionsWithLocalNames.push_back(
+          {checked, curr, std::move(localsWithNames)});
+      }
       checked++;
     };
     ModuleUtils::iterImportedFunctions(*wasm, check);
@@ -845,32 +1171,25 @@ void WasmBinaryWriter::writeNames() {
         startSubsection(BinaryConsts::UserSections::Subsection::NameLocal);
       o << U32LEB(functionsWithLocalNames.size());
       Index emitted = 0;
-      for (auto& [index, func] : functionsWithLocalNames) {
-        // Pairs of (local index in IR, name).
-        std::vector<std::pair<Index, Name>> localsWithNames;
-        auto numLocals = func->getNumLocals();
-        for (Index i = 0; i < numLocals; ++i) {
-          if (func->hasLocalName(i)) {
-            localsWithNames.push_back({i, func->getLocalName(i)});
-          }
-        }
+      for (auto& [index, func, localsWithNames] : functionsWithLocalNames) {
         assert(localsWithNames.size());
         o << U32LEB(index);
         o << U32LEB(localsWithNames.size());
+        // Find the function's local mapping once, not once per local.
+        auto iter = funcMappedLocals.find(func->name);
+        auto* mappedLocals = iter != funcMappedLocals.end() ? &iter->second
+                                                            : nullptr;
+        if (!mappedLocals) {
+          // No data on funcMappedLocals. That is only possible if we are an
+          // imported function, where there are no locals to map, and in that
+          // case the index is unchanged anyhow: parameters always have the
+          // same index, they are not mapped in any way.
+          assert(func->imported());
+        }
         for (auto& [indexInFunc, name] : localsWithNames) {
           // TODO: handle multivalue
-          Index indexInBinary;
-          auto iter = funcMappedLocals.find(func->name);
-          if (iter != funcMappedLocals.end()) {
-            indexInBinary = iter->second[{indexInFunc, 0}];
-          } else {
-            // No data on funcMappedLocals. That is only possible if we are an
-            // imported function, where there are no locals to map, and in that
-            // case the index is unchanged anyhow: parameters always have the
-            // same index, they are not mapped in any way.
-            assert(func->imported());
-            indexInBinary = indexInFunc;
-          }
+          Index indexInBinary =
+            mappedLocals ? (*mappedLocals)[{indexInFunc, 0}] : indexInFunc;
           o << U32LEB(indexInBinary);
           writeEscapedName(name.str);
         }
@@ -1081,39 +1400,73 @@ void WasmBinaryWriter::writeSourceMapProlog() {
   *sourceMap << "],\"names\":[],\"mappings\":\"";
 }
 
-static void writeBase64VLQ(std::ostream& out, int32_t n) {
+static void writeBase64VLQ(std::string& out, int32_t n) {
   uint32_t value = n >= 0 ? n << 1 : ((-n) << 1) | 1;
   while (1) {
     uint32_t digit = value & 0x1F;
     value >>= 5;
     if (!value) {
       // last VLQ digit -- base64 codes 'A'..'Z', 'a'..'f'
-      out << char(digit < 26 ? 'A' + digit : 'a' + digit - 26);
+      out += char(digit < 26 ? 'A' + digit : 'a' + digit - 26);
       break;
     }
     // more VLG digit will follow -- add continuation bit (0x20),
     // base64 codes 'g'..'z', '0'..'9', '+', '/'
-    out << char(digit < 20
+    out += char(digit < 20
                   ? 'g' + digit
                   : digit < 30 ? '0' + digit - 20 : digit == 30 ? '+' : '/');
   }
 }
 
 void WasmBinaryWriter::writeSourceMapEpilog() {
-  // write source map entries
-  size_t lastOffset = 0;
-  Function::DebugLocation lastLoc = {0, /* lineNumber = */ 1, 0};
-  for (const auto& [offset, loc] : sourceMapLocations) {
-    if (lastOffset > 0) {
-      *sourceMap << ",";
+  // Write the source map entries. Each is delta-encoded against the previous
+  // one, but the previous entry's absolute values are right there in the
+  // vector, so chunks of entries can be encoded independently, in parallel,
+  // and then simply concatenated. That also batches up the stream I/O into
+  // one write per chunk, instead of one per character.
+  auto& locations = sourceMapLocations;
+  const size_t ChunkSize = 10000;
+  size_t numChunks = (locations.size() + ChunkSize - 1) / ChunkSize;
+  std::vector<std::string> chunks(numChunks);
+  auto encodeChunk = [&](size_t chunkIndex) {
+    auto& out = chunks[chunkIndex];
+    size_t begin = chunkIndex * ChunkSize;
+    size_t end = std::min(begin + ChunkSize, locations.size());
+    size_t lastOffset = 0;
+    Function::DebugLocation lastLoc = {0, /* lineNumber = */ 1, 0};
+    if (begin > 0) {
+      lastOffset = locations[begin - 1].first;
+      lastLoc = *locations[begin - 1].second;
+    }
+    for (size_t i = begin; i < end; i++) {
+      const auto& [offset, loc] = locations[i];
+      if (lastOffset > 0) {
+        out += ',';
+      }
+      writeBase64VLQ(out, int32_t(offset - lastOffset));
+      writeBase64VLQ(out, int32_t(loc->fileIndex - lastLoc.fileIndex));
+      writeBase64VLQ(out, int32_t(loc->lineNumber - lastLoc.lineNumber));
+      writeBase64VLQ(out, int32_t(loc->columnNumber - lastLoc.columnNumber));
+      lastLoc = *loc;
+      lastOffset = offset;
     }
-    writeBase64VLQ(*sourceMap, int32_t(offset - lastOffset));
-    writeBase64VLQ(*sourceMap, int32_t(loc->fileIndex - lastLoc.fileIndex));
-    writeBase64VLQ(*sourceMap, int32_t(loc->lineNumber - lastLoc.lineNumber));
-    writeBase64VLQ(*sourceMap,
-                   int32_t(loc->columnNumber - lastLoc.columnNumber));
-    lastLoc = *loc;
-    lastOffset = offset;
+  };
+  std::atomic<size_t> nextChunk{0};
+  auto numWorkers = ThreadPool::get()->size();
+  std::vector<std::function<ThreadWorkState()>> doWorkers;
+  for (size_t i = 0; i < numWorkers; i++) {
+    doWorkers.push_back([&]() {
+      auto chunkIndex = nextChunk.fetch_add(1);
+      if (chunkIndex >= numChunks) {
+        return ThreadWorkState::Finished;
+      }
+      encodeChunk(chunkIndex);
+      return ThreadWorkState::More;
+    });
+  }
+  ThreadPool::get()->work(doWorkers);
+  for (auto& chunk : chunks) {
+    *sourceMap << chunk;
   }
   *sourceMap << "\"}";
 }
@@ -1127,10 +1480,33 @@ void WasmBinaryWriter::writeLateUserSections() {
 }
 
 void WasmBinaryWriter::writeUserSection(const UserSection& section) {
+  if (sink && !emitChecksums && section.view.data()) {
+    // The payload is a view into the input binary and we have a sink, so it
+    // can go straight from the mapping to the output, without staging it in
+    // the buffer. The section size is fully known up front here, so no
+    // placeholder is needed.
+    auto lebSize = [](uint32_t x) {
+      size_t size = 0;
+      do {
+        size++;
+        x >>= 7;
+      } while (x);
+      return size;
+    };
+    auto nameLen = strlen(section.name.c_str());
+    flushToSink();
+    o << uint8_t(BinaryConsts::User);
+    o << U32LEB(lebSize(nameLen) + nameLen + section.view.size());
+    writeInlineString(section.name.c_str());
+    flushToSink();
+    sink->write(section.view.data(), section.view.size());
+    flushedBytes += section.view.size();
+    return;
+  }
   auto start = startSection(BinaryConsts::User);
   writeInlineString(section.name.c_str());
-  for (size_t i = 0; i < section.data.size(); i++) {
-    o << uint8_t(section.data[i]);
+  for (size_t i = 0; i < section.getSize(); i++) {
+    o << uint8_t(section.getData()[i]);
   }
   finishSection(start);
 }
@@ -1195,6 +1571,21 @@ void WasmBinaryWriter::writeFeaturesSection() {
   finishSection(start);
 }
 
+void WasmBinaryWriter::writeChecksumsSection() {
+  BYN_TRACE("== writeChecksumsSection\n");
+  auto start = startSection(BinaryConsts::User);
+  writeInlineString(BinaryConsts::UserSections::Checksums);
+  o << U32LEB(sectionChecksums.size());
+  for (auto& [id, digest] : sectionChecksums) {
+    o << uint8_t(id);
+    o << uint64_t(digest);
+  }
+  // Do not finishSection() here: that would try to add the manifest's own
+  // digest, which it cannot contain.
+  patchSectionSize(start);
+  flushToSink();
+}
+
 void WasmBinaryWriter::writeLegacyDylinkSection() {
   if (!wasm->dylinkSection) {
     return;
@@ -1476,7 +1867,7 @@ void WasmBinaryWriter::writeField(const Field& field) {
 
 WasmBinaryBuilder::WasmBinaryBuilder(Module& wasm,
                                      FeatureSet features,
-                                     const std::vector<char>& input)
+                                     BufferView input)
   : wasm(wasm), allocator(wasm.allocator), input(input), sourceMap(nullptr),
     nextDebugLocation(0, {0, 0, 0}), debugLocation() {
   wasm.features = features;
@@ -1532,6 +1923,13 @@ void WasmBinaryBuilder::read() {
 
     auto oldPos = pos;
 
+    // If we were asked for only some of the sections, seek past the others.
+    if (onlySections &&
+        !onlySections->count(BinaryConsts::Section(sectionCode))) {
+      pos = oldPos + payloadLen;
+      continue;
+    }
+
     // note the section in the list of seen sections, as almost no sections can
     // appear more than once, and verify those that shouldn't do not.
     if (sectionCode != BinaryConsts::Section::User &&
@@ -1610,6 +2008,7 @@ void WasmBinaryBuilder::read() {
 
   validateBinary();
   processNames();
+  splitSharedBodies();
 }
 
 void WasmBinaryBuilder::readUserSection(size_t payloadLen) {
@@ -1633,6 +2032,8 @@ void WasmBinaryBuilder::readUserSection(size_t payloadLen) {
     readDylink(payloadLen);
   } else if (sectionName.equals(BinaryConsts::UserSections::Dylink0)) {
     readDylink0(payloadLen);
+  } else if (sectionName.equals(BinaryConsts::UserSections::BranchHint)) {
+    readBranchHints(payloadLen);
   } else {
     // an unfamiliar custom section
     if (sectionName.equals(BinaryConsts::UserSections::Linking)) {
@@ -1644,7 +2045,14 @@ void WasmBinaryBuilder::readUserSection(size_t payloadLen) {
     auto& section = wasm.userSections.back();
     section.name = sectionName.str;
     auto data = getByteView(payloadLen);
-    section.data = {data.first, data.second};
+    if (wasm.inputBinary && !Debug::isDWARFSection(sectionName)) {
+      // The module retains the input binary, so this opaque payload can stay
+      // a view into it, uncopied, all the way through to the writer. DWARF
+      // sections are excluded as wasm-debug.cpp rewrites their bytes.
+      section.view = BufferView(data.first, data.second - data.first);
+    } else {
+      section.data = {data.first, data.second};
+    }
   }
 }
 
@@ -1731,34 +2139,64 @@ Literal WasmBinaryBuilder::getVec128Literal() {
 
 uint32_t WasmBinaryBuilder::getU32LEB() {
   BYN_TRACE("<==\n");
-  U32LEB ret;
-  ret.read([&]() { return getInt8(); });
-  BYN_TRACE("getU32LEB: " << ret.value << " ==>\n");
-  return ret.value;
+  uint32_t ret;
+  // Fast path: a 1-byte LEB, the overwhelmingly common case.
+  if (pos < input.size() && !(uint8_t(input[pos]) & 128)) {
+    ret = uint8_t(input[pos++]);
+  } else {
+    U32LEB leb;
+    leb.read([&]() { return getInt8(); });
+    ret = leb.value;
+  }
+  BYN_TRACE("getU32LEB: " << ret << " ==>\n");
+  return ret;
 }
 
 uint64_t WasmBinaryBuilder::getU64LEB() {
   BYN_TRACE("<==\n");
-  U64LEB ret;
-  ret.read([&]() { return getInt8(); });
-  BYN_TRACE("getU64LEB: " << ret.value << " ==>\n");
-  return ret.value;
+  uint64_t ret;
+  // Fast path: a 1-byte LEB, the overwhelmingly common case.
+  if (pos < input.size() && !(uint8_t(input[pos]) & 128)) {
+    ret = uint8_t(input[pos++]);
+  } else {
+    U64LEB leb;
+    leb.read([&]() { return getInt8(); });
+    ret = leb.value;
+  }
+  BYN_TRACE("getU64LEB: " << ret << " ==>\n");
+  return ret;
 }
 
 int32_t WasmBinaryBuilder::getS32LEB() {
   BYN_TRACE("<==\n");
-  S32LEB ret;
-  ret.read([&]() { return (int8_t)getInt8(); });
-  BYN_TRACE("getS32LEB: " << ret.value << " ==>\n");
-  return ret.value;
+  int32_t ret;
+  // Fast path: a 1-byte LEB, the overwhelmingly common case. Sign-extend
+  // from bit 6.
+  if (pos < input.size() && !(uint8_t(input[pos]) & 128)) {
+    ret = int32_t(int8_t(uint8_t(input[pos++]) << 1)) >> 1;
+  } else {
+    S32LEB leb;
+    leb.read([&]() { return (int8_t)getInt8(); });
+    ret = leb.value;
+  }
+  BYN_TRACE("getS32LEB: " << ret << " ==>\n");
+  return ret;
 }
 
 int64_t WasmBinaryBuilder::getS64LEB() {
   BYN_TRACE("<==\n");
-  S64LEB ret;
-  ret.read([&]() { return (int8_t)getInt8(); });
-  BYN_TRACE("getS64LEB: " << ret.value << " ==>\n");
-  return ret.value;
+  int64_t ret;
+  // Fast path: a 1-byte LEB, the overwhelmingly common case. Sign-extend
+  // from bit 6.
+  if (pos < input.size() && !(uint8_t(input[pos]) & 128)) {
+    ret = int64_t(int8_t(uint8_t(input[pos++]) << 1)) >> 1;
+  } else {
+    S64LEB leb;
+    leb.read([&]() { return (int8_t)getInt8(); });
+    ret = leb.value;
+  }
+  BYN_TRACE("getS64LEB: " << ret << " ==>\n");
+  return ret;
 }
 
 uint64_t WasmBinaryBuilder::getUPtrLEB() {
@@ -1908,7 +2346,7 @@ Type WasmBinaryBuilder::getConcreteType() {
   return type;
 }
 
-Name WasmBinaryBuilder::getInlineString() {
+std::string WasmBinaryBuilder::getInlineStringContents() {
   BYN_TRACE("<==\n");
   auto len = getU32LEB();
 
@@ -1921,7 +2359,11 @@ Name WasmBinaryBuilder::getInlineString() {
       "but you shouldn't do it, and it's not supported in binaryen");
   }
   BYN_TRACE("getInlineString: " << str << " ==>\n");
-  return Name(str);
+  return str;
+}
+
+Name WasmBinaryBuilder::getInlineString() {
+  return Name(getInlineStringContents());
 }
 
 void WasmBinaryBuilder::verifyInt8(int8_t x) {
@@ -2374,88 +2816,297 @@ void WasmBinaryBuilder::readFunctions() {
   if (total != functionTypes.size() - functionImports.size()) {
     throwError("invalid function section size, must equal types");
   }
-  for (size_t i = 0; i < total; i++) {
-    BYN_TRACE("read one at " << pos << std::endl);
-    auto sizePos = pos;
-    size_t size = getU32LEB();
-    if (size == 0) {
-      throwError("empty function size");
-    }
-    endOfFunction = pos + size;
-
-    auto* func = new Function;
-    func->name = Name::fromInt(i);
-    func->type = getTypeByFunctionIndex(functionImports.size() + i);
-    currFunction = func;
-
-    if (DWARF) {
-      func->funcLocation = BinaryLocations::FunctionLocations{
-        BinaryLocation(sizePos - codeSectionLocation),
-        BinaryLocation(pos - codeSectionLocation),
-        BinaryLocation(pos - codeSectionLocation + size)};
-    }
-
-    readNextDebugLocation();
-
-    BYN_TRACE("reading " << i << std::endl);
-
-    readVars();
-
-    std::swap(func->prologLocation, debugLocation);
-    {
-      // process the function body
-      BYN_TRACE("processing function: " << i << std::endl);
-      nextLabel = 0;
-      debugLocation.clear();
-      willBeIgnored = false;
-      // process body
-      assert(breakStack.empty());
-      assert(breakTargetNames.empty());
-      assert(exceptionTargetNames.empty());
-      assert(expressionStack.empty());
-      assert(controlFlowStack.empty());
-      assert(depth == 0);
-      // Even if we are skipping function bodies we need to not skip the start
-      // function. That contains important code for wasm-emscripten-finalize in
-      // the form of pthread-related segment initializations. As this is just
-      // one function, it doesn't add significant time, so the optimization of
-      // skipping bodies is still very useful.
-      auto currFunctionIndex = functionImports.size() + functions.size();
-      bool isStart = startIndex == currFunctionIndex;
-      if (!skipFunctionBodies || isStart) {
-        func->body = getBlockOrSingleton(func->getResults());
-      } else {
-        // When skipping the function body we need to put something valid in
-        // their place so we validate. An unreachable is always acceptable
-        // there.
-        func->body = Builder(wasm).makeUnreachable();
-
-        // Skip reading the contents.
-        pos = endOfFunction;
-      }
-      assert(depth == 0);
-      assert(breakStack.empty());
-      assert(breakTargetNames.empty());
-      assert(exceptionTargetNames.empty());
-      if (!expressionStack.empty()) {
-        throwError("stack not empty on function exit");
+  // Scan the code section to find the byte range of each function body. The
+  // size recorded before each body lets us do this without decoding anything.
+  std::vector<FunctionBodyRange> ranges;
+  if (binaryIndex && binaryIndex->ranges.size() == total) {
+    // A validated sidecar index gives us the ranges up front, so we can seek
+    // straight past the section instead of scanning it.
+    ranges = binaryIndex->ranges;
+    if (total > 0) {
+      pos = ranges.back().bodyPos + ranges.back().size;
+    }
+  } else {
+    ranges.reserve(total);
+    for (size_t i = 0; i < total; i++) {
+      auto sizePos = pos;
+      size_t size = getU32LEB();
+      if (size == 0) {
+        throwError("empty function size");
+      }
+      ranges.push_back(FunctionBodyRange{sizePos, pos, size});
+      pos += size;
+      if (pos > input.size()) {
+        throwError("function body goes past the end of the input");
+      }
+    }
+  }
+  // In lazy mode, create the functions with their final types, but leave the
+  // bodies unparsed: record each one's byte range so that it can be built on
+  // demand later, after the module skeleton exists. Like parallel decoding,
+  // this is not possible when reading DWARF or a source map.
+  if (lazyBodies && !DWARF && !sourceMap && !skipFunctionBodies) {
+    for (size_t i = 0; i < total; i++) {
+      auto* func = new Function;
+      func->name = Name::fromInt(i);
+      func->type = getTypeByFunctionIndex(functionImports.size() + i);
+      lazyBodies->ranges[func] = {ranges[i], Index(i)};
+      functions.push_back(func);
+    }
+    return;
+  }
+  // Byte-identical bodies of the same type decode to identical IR, which is
+  // common in template-heavy or multiply-linked modules, so find duplicates
+  // up front and decode one representative per group; the duplicates share
+  // its body until names are backpatched, and then get copies of it (see
+  // splitSharedBodies). Identical bytes can decode differently when
+  // per-function sidecar data applies (branch hints) or when per-function
+  // binary locations matter (DWARF, source maps), so skip this then.
+  std::vector<Index> duplicateOf(total, NoDuplicateBody);
+  if (!DWARF && !sourceMap && !skipFunctionBodies && branchHints.empty() &&
+      total > 1) {
+    std::unordered_map<uint64_t, std::vector<Index>> seen;
+    for (Index i = 0; i < total; i++) {
+      auto type = getTypeByFunctionIndex(functionImports.size() + i);
+      auto digest = fastHash(
+        input.data() + ranges[i].bodyPos, ranges[i].size, type.getID());
+      auto& candidates = seen[digest];
+      for (auto j : candidates) {
+        if (ranges[j].size == ranges[i].size &&
+            getTypeByFunctionIndex(functionImports.size() + j) == type &&
+            memcmp(input.data() + ranges[j].bodyPos,
+                   input.data() + ranges[i].bodyPos,
+                   ranges[i].size) == 0) {
+          duplicateOf[i] = j;
+          break;
+        }
       }
-      assert(controlFlowStack.empty());
-      if (pos != endOfFunction) {
-        throwError("binary offset at function exit not at expected location");
+      if (duplicateOf[i] == NoDuplicateBody) {
+        candidates.push_back(i);
       }
     }
-
-    if (!wasm.features.hasGCNNLocals()) {
-      TypeUpdating::handleNonDefaultableLocals(func, wasm);
+  }
+  // Decoding in parallel is worthwhile when there are enough bodies to keep
+  // the threads busy. It is not possible when reading DWARF or a source map,
+  // as those interleave sequential state with the decoding.
+  if (parallelBodies && !DWARF && !sourceMap && total > 1 &&
+      ThreadPool::get()->size() > 1) {
+    readFunctionsParallel(ranges, duplicateOf);
+    return;
+  }
+  for (size_t i = 0; i < total; i++) {
+    if (duplicateOf[i] != NoDuplicateBody) {
+      functions.push_back(
+        makeSharedBodyDuplicate(i, functions[duplicateOf[i]]));
+      continue;
     }
+    BYN_TRACE("read one at " << ranges[i].bodyPos << std::endl);
+    pos = ranges[i].bodyPos;
+    functions.push_back(
+      readFunctionDefinition(i, ranges[i].sizePos, ranges[i].size));
+  }
+  // Decoding moved |pos| to the end of the last body we actually decoded,
+  // which is not the end of the section if trailing bodies were duplicates;
+  // move past the entire section.
+  if (total > 0) {
+    pos = ranges.back().bodyPos + ranges.back().size;
+  }
+  BYN_TRACE(" end function bodies\n");
+}
+
+Function* WasmBinaryBuilder::makeSharedBodyDuplicate(Index index,
+                                                     Function* rep) {
+  auto* func = new Function;
+  func->name = Name::fromInt(index);
+  func->type = getTypeByFunctionIndex(functionImports.size() + index);
+  // Identical bytes mean identical locals.
+  func->vars = rep->vars;
+  func->body = rep->body;
+  sharedBodyFunctions.push_back({func, rep});
+  return func;
+}
 
-    std::swap(func->epilogLocation, debugLocation);
-    currFunction = nullptr;
+void WasmBinaryBuilder::splitSharedBodies() {
+  // The duplicates all point at their representative's tree, whose calls and
+  // other by-index references have now been resolved to names; give each its
+  // own copy, as nothing outside the reader expects functions to share IR.
+  for (auto& [dup, rep] : sharedBodyFunctions) {
+    dup->body = ExpressionManipulator::copy(rep->body, wasm);
+  }
+  sharedBodyFunctions.clear();
+}
+
+Function* WasmBinaryBuilder::readFunctionDefinition(Index index,
+                                                    size_t sizePos,
+                                                    size_t size) {
+  auto* func = new Function;
+  func->name = Name::fromInt(index);
+  func->type = getTypeByFunctionIndex(functionImports.size() + index);
+
+  if (DWARF) {
+    func->funcLocation = BinaryLocations::FunctionLocations{
+      BinaryLocation(sizePos - codeSectionLocation),
+      BinaryLocation(pos - codeSectionLocation),
+      BinaryLocation(pos - codeSectionLocation + size)};
+  }
+
+  readFunctionBody(func, index, size);
+  return func;
+}
+
+void WasmBinaryBuilder::readFunctionBody(Function* func,
+                                         Index index,
+                                         size_t size) {
+  endOfFunction = pos + size;
+  currFunction = func;
+  currBodyStart = pos;
+  auto hintsIter = branchHints.find(Index(functionImports.size() + index));
+  currBranchHints =
+    hintsIter != branchHints.end() ? &hintsIter->second : nullptr;
+
+  readNextDebugLocation();
+
+  BYN_TRACE("reading " << index << std::endl);
+
+  readVars();
+
+  std::swap(func->prologLocation, debugLocation);
+  {
+    // process the function body
+    BYN_TRACE("processing function: " << index << std::endl);
+    nextLabel = 0;
     debugLocation.clear();
-    functions.push_back(func);
+    willBeIgnored = false;
+    // process body
+    assert(breakStack.empty());
+    assert(breakTargetNames.empty());
+    assert(exceptionTargetNames.empty());
+    assert(expressionStack.empty());
+    assert(controlFlowStack.empty());
+    assert(depth == 0);
+    // Even if we are skipping function bodies we need to not skip the start
+    // function. That contains important code for wasm-emscripten-finalize in
+    // the form of pthread-related segment initializations. As this is just
+    // one function, it doesn't add significant time, so the optimization of
+    // skipping bodies is still very useful.
+    auto currFunctionIndex = functionImports.size() + index;
+    bool isStart = startIndex == currFunctionIndex;
+    if (!skipFunctionBodies || isStart) {
+      func->body = getBlockOrSingleton(func->getResults());
+    } else {
+      // When skipping the function body we need to put something valid in
+      // their place so we validate. An unreachable is always acceptable
+      // there.
+      func->body = Builder(wasm).makeUnreachable();
+
+      // Skip reading the contents.
+      pos = endOfFunction;
+    }
+    assert(depth == 0);
+    assert(breakStack.empty());
+    assert(breakTargetNames.empty());
+    assert(exceptionTargetNames.empty());
+    if (!expressionStack.empty()) {
+      throwError("stack not empty on function exit");
+    }
+    assert(controlFlowStack.empty());
+    if (pos != endOfFunction) {
+      throwError("binary offset at function exit not at expected location");
+    }
+  }
+
+  if (!wasm.features.hasGCNNLocals()) {
+    TypeUpdating::handleNonDefaultableLocals(func, wasm);
+  }
+
+  std::swap(func->epilogLocation, debugLocation);
+  currFunction = nullptr;
+  currBranchHints = nullptr;
+  debugLocation.clear();
+}
+
+void WasmBinaryBuilder::readFunctionsParallel(
+  std::vector<FunctionBodyRange>& ranges,
+  const std::vector<Index>& duplicateOf) {
+  BYN_TRACE("== readFunctionsParallel\n");
+  auto numFunctions = ranges.size();
+  std::vector<Function*> results(numFunctions);
+  // Each worker decodes with a builder of its own, so that the per-function
+  // decoding state (the expression stack, break targets, and so forth) is not
+  // shared. The builders read from the same input and allocate into the same
+  // arena, which is thread-safe (see mixed_arena.h).
+  auto numWorkers = ThreadPool::get()->size();
+  std::vector<std::unique_ptr<WasmBinaryBuilder>> builders;
+  for (size_t i = 0; i < numWorkers; i++) {
+    auto builder =
+      std::make_unique<WasmBinaryBuilder>(wasm, wasm.features, input);
+    builder->types = types;
+    builder->functionTypes = functionTypes;
+    builder->functionImports = functionImports;
+    builder->startIndex = startIndex;
+    builder->skipFunctionBodies = skipFunctionBodies;
+    builder->debugInfo = debugInfo;
+    builder->codeSectionLocation = codeSectionLocation;
+    builder->branchHints = branchHints;
+    builders.push_back(std::move(builder));
+  }
+  // Errors must be rethrown on the main thread, afterwards.
+  std::mutex errorMutex;
+  std::unique_ptr<ParseException> error;
+  std::atomic<size_t> nextFunction{0};
+  std::vector<std::function<ThreadWorkState()>> doWorkers;
+  for (size_t worker = 0; worker < numWorkers; worker++) {
+    auto* builder = builders[worker].get();
+    doWorkers.push_back([&, builder]() {
+      auto index = nextFunction.fetch_add(1);
+      if (index >= numFunctions) {
+        return ThreadWorkState::Finished;
+      }
+      try {
+        if (duplicateOf[index] == NoDuplicateBody) {
+          builder->pos = ranges[index].bodyPos;
+          results[index] = builder->readFunctionDefinition(
+            index, ranges[index].sizePos, ranges[index].size);
+        }
+      } catch (ParseException& e) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!error) {
+          error = std::make_unique<ParseException>(e);
+        }
+        return ThreadWorkState::Finished;
+      }
+      if (index + 1 == numFunctions) {
+        return ThreadWorkState::Finished;
+      }
+      return ThreadWorkState::More;
+    });
+  }
+  ThreadPool::get()->work(doWorkers);
+  if (error) {
+    throw *error;
+  }
+  for (Index i = 0; i < numFunctions; i++) {
+    if (!results[i]) {
+      results[i] = makeSharedBodyDuplicate(i, results[duplicateOf[i]]);
+    }
+    functions.push_back(results[i]);
+  }
+  // The workers accumulated references to module elements whose names are not
+  // yet known; merge them so they are backpatched in processNames() as usual.
+  for (auto& builder : builders) {
+    for (auto& [index, refs] : builder->functionRefs) {
+      auto& ours = functionRefs[index];
+      ours.insert(ours.end(), refs.begin(), refs.end());
+    }
+    for (auto& [index, refs] : builder->tableRefs) {
+      auto& ours = tableRefs[index];
+      ours.insert(ours.end(), refs.begin(), refs.end());
+    }
+    for (auto& [index, refs] : builder->globalRefs) {
+      auto& ours = globalRefs[index];
+      ours.insert(ours.end(), refs.begin(), refs.end());
+    }
   }
-  BYN_TRACE(" end function bodies\n");
 }
 
 void WasmBinaryBuilder::readVars() {
@@ -2489,11 +3140,26 @@ void WasmBinaryBuilder::readExports() {
   }
 }
 
-static int32_t readBase64VLQ(std::istream& in) {
+int WasmBinaryBuilder::peekSourceMapChar() {
+  if (sourceMapPos >= sourceMapContents.size()) {
+    return EOF;
+  }
+  return (unsigned char)sourceMapContents[sourceMapPos];
+}
+
+int WasmBinaryBuilder::getSourceMapChar() {
+  auto ch = peekSourceMapChar();
+  if (ch != EOF) {
+    sourceMapPos++;
+  }
+  return ch;
+}
+
+int32_t WasmBinaryBuilder::readBase64VLQ() {
   uint32_t value = 0;
   uint32_t shift = 0;
   while (1) {
-    auto ch = in.get();
+    auto ch = getSourceMapChar();
     if (ch == EOF) {
       throw MapParseException("unexpected EOF in the middle of VLQ");
     }
@@ -2520,22 +3186,28 @@ void WasmBinaryBuilder::readSourceMapHeader() {
     return;
   }
 
+  // Read the entire map into memory in one go; everything below scans it
+  // directly, avoiding a stream operation per character.
+  sourceMapContents.assign(std::istreambuf_iterator<char>(*sourceMap),
+                           std::istreambuf_iterator<char>());
+  sourceMapPos = 0;
+
   auto skipWhitespace = [&]() {
-    while (sourceMap->peek() == ' ' || sourceMap->peek() == '\n') {
-      sourceMap->get();
+    while (peekSourceMapChar() == ' ' || peekSourceMapChar() == '\n') {
+      getSourceMapChar();
     }
   };
 
   auto maybeReadChar = [&](char expected) {
-    if (sourceMap->peek() != expected) {
+    if (peekSourceMapChar() != expected) {
       return false;
     }
-    sourceMap->get();
+    getSourceMapChar();
     return true;
   };
 
   auto mustReadChar = [&](char expected) {
-    char c = sourceMap->get();
+    char c = getSourceMapChar();
     if (c != expected) {
       throw MapParseException(std::string("Unexpected char: expected '") +
                               expected + "' got '" + c + "'");
@@ -2547,7 +3219,7 @@ void WasmBinaryBuilder::readSourceMapHeader() {
     size_t len = strlen(name);
     size_t pos;
     while (1) {
-      int ch = sourceMap->get();
+      int ch = getSourceMapChar();
       if (ch == EOF) {
         return false;
       }
@@ -2580,7 +3252,7 @@ void WasmBinaryBuilder::readSourceMapHeader() {
     mustReadChar('\"');
     if (!maybeReadChar('\"')) {
       while (1) {
-        int ch = sourceMap->get();
+        int ch = getSourceMapChar();
         if (ch == EOF) {
           throw MapParseException("unexpected EOF in the middle of string");
         }
@@ -2621,11 +3293,10 @@ void WasmBinaryBuilder::readSourceMapHeader() {
     return;
   }
   // read first debug location
-  uint32_t position = readBase64VLQ(*sourceMap);
-  uint32_t fileIndex = readBase64VLQ(*sourceMap);
-  uint32_t lineNumber =
-    readBase64VLQ(*sourceMap) + 1; // adjust zero-based line number
-  uint32_t columnNumber = readBase64VLQ(*sourceMap);
+  uint32_t position = readBase64VLQ();
+  uint32_t fileIndex = readBase64VLQ();
+  uint32_t lineNumber = readBase64VLQ() + 1; // adjust zero-based line number
+  uint32_t columnNumber = readBase64VLQ();
   nextDebugLocation = {position, {fileIndex, lineNumber, columnNumber}};
 }
 
@@ -2641,8 +3312,10 @@ void WasmBinaryBuilder::readNextDebugLocation() {
       debugLocation.insert(nextDebugLocation.second);
     }
 
-    char ch;
-    *sourceMap >> ch;
+    // Skip whitespace, as the stream extraction we used to use here did.
+    int ch;
+    while ((ch = getSourceMapChar()) != EOF && isspace(ch)) {
+    }
     if (ch == '\"') { // end of records
       nextDebugLocation.first = 0;
       break;
@@ -2651,13 +3324,13 @@ void WasmBinaryBuilder::readNextDebugLocation() {
       throw MapParseException("Unexpected delimiter");
     }
 
-    int32_t positionDelta = readBase64VLQ(*sourceMap);
+    int32_t positionDelta = readBase64VLQ();
     uint32_t position = nextDebugLocation.first + positionDelta;
-    int32_t fileIndexDelta = readBase64VLQ(*sourceMap);
+    int32_t fileIndexDelta = readBase64VLQ();
     uint32_t fileIndex = nextDebugLocation.second.fileIndex + fileIndexDelta;
-    int32_t lineNumberDelta = readBase64VLQ(*sourceMap);
+    int32_t lineNumberDelta = readBase64VLQ();
     uint32_t lineNumber = nextDebugLocation.second.lineNumber + lineNumberDelta;
-    int32_t columnNumberDelta = readBase64VLQ(*sourceMap);
+    int32_t columnNumberDelta = readBase64VLQ();
     uint32_t columnNumber =
       nextDebugLocation.second.columnNumber + columnNumberDelta;
 
@@ -3214,9 +3887,18 @@ void WasmBinaryBuilder::readNames(size_t payloadLen) {
                BinaryConsts::UserSections::Subsection::NameFunction) {
       auto num = getU32LEB();
       NameProcessor processor;
+      // Read all the entries first, so that the names can be interned as a
+      // single batch.
+      std::vector<Index> indexes(num);
+      std::vector<std::string> rawNameStrings(num);
       for (size_t i = 0; i < num; i++) {
-        auto index = getU32LEB();
-        auto rawName = getInlineString();
+        indexes[i] = getU32LEB();
+        rawNameStrings[i] = getInlineStringContents();
+      }
+      auto rawNames = Name::internBatch(rawNameStrings);
+      for (size_t i = 0; i < num; i++) {
+        auto index = indexes[i];
+        Name rawName = rawNames[i];
         auto name = processor.process(rawName);
         auto numFunctionImports = functionImports.size();
         if (index < numFunctionImports) {
@@ -3233,6 +3915,16 @@ void WasmBinaryBuilder::readNames(size_t payloadLen) {
     } else if (nameType == BinaryConsts::UserSections::Subsection::NameLocal) {
       auto numFuncs = getU32LEB();
       auto numFunctionImports = functionImports.size();
+      // Read everything first, so that all the local names in the subsection
+      // can be interned as a single batch.
+      struct FuncLocalNames {
+        Function* func;
+        std::vector<Index> localIndexes;
+        // The index in rawNameStrings of this function's first local name.
+        size_t firstName;
+      };
+      std::vector<FuncLocalNames> funcLocals(numFuncs);
+      std::vector<std::string> rawNameStrings;
       for (size_t i = 0; i < numFuncs; i++) {
         auto funcIndex = getU32LEB();
         Function* func = nullptr;
@@ -3247,10 +3939,20 @@ void WasmBinaryBuilder::readNames(size_t payloadLen) {
             << std::to_string(funcIndex) << std::endl;
         }
         auto numLocals = getU32LEB();
-        NameProcessor processor;
+        funcLocals[i].func = func;
+        funcLocals[i].firstName = rawNameStrings.size();
         for (size_t j = 0; j < numLocals; j++) {
-          auto localIndex = getU32LEB();
-          auto rawLocalName = getInlineString();
+          funcLocals[i].localIndexes.push_back(getU32LEB());
+          rawNameStrings.push_back(getInlineStringContents());
+        }
+      }
+      auto rawNames = Name::internBatch(rawNameStrings);
+      for (auto& curr : funcLocals) {
+        auto* func = curr.func;
+        NameProcessor processor;
+        for (size_t j = 0; j < curr.localIndexes.size(); j++) {
+          auto localIndex = curr.localIndexes[j];
+          Name rawLocalName = rawNames[curr.firstName + j];
           if (!func) {
             continue; // read and discard in case of prior error
           }
@@ -3273,9 +3975,17 @@ void WasmBinaryBuilder::readNames(size_t payloadLen) {
     } else if (nameType == BinaryConsts::UserSections::Subsection::NameType) {
       auto num = getU32LEB();
       NameProcessor processor;
+      // As with function names, read first and intern as a batch.
+      std::vector<Index> indexes(num);
+      std::vector<std::string> rawNameStrings(num);
       for (size_t i = 0; i < num; i++) {
-        auto index = getU32LEB();
-        auto rawName = getInlineString();
+        indexes[i] = getU32LEB();
+        rawNameStrings[i] = getInlineStringContents();
+      }
+      auto rawNames = Name::internBatch(rawNameStrings);
+      for (size_t i = 0; i < num; i++) {
+        auto index = indexes[i];
+        Name rawName = rawNames[i];
         auto name = processor.process(rawName);
         if (index < types.size()) {
           wasm.typeNames[types[index]].name = name;
@@ -3353,7 +4063,7 @@ void WasmBinaryBuilder::readNames(size_t payloadLen) {
         auto rawName = getInlineString();
         auto name = processor.process(rawName);
         if (index < dataSegments.size()) {
-          dataSegments[i]->setExplicitName(name);
+          dataSegments[index]->setExplicitName(name);
         } else {
           std::cerr << "warning: data index out of bounds in name section, "
                        "data subsection: "
@@ -3554,6 +4264,327 @@ void WasmBinaryBuilder::readDylink0(size_t payloadLen) {
   }
 }
 
+void WasmBinaryBuilder::readBranchHints(size_t payloadLen) {
+  BYN_TRACE("== readBranchHints\n");
+  auto sectionPos = pos;
+  auto numFuncs = getU32LEB();
+  for (size_t i = 0; i < numFuncs; i++) {
+    auto funcIndex = getU32LEB();
+    auto& hints = branchHints[funcIndex];
+    auto numHints = getU32LEB();
+    for (size_t j = 0; j < numHints; j++) {
+      auto offset = getU32LEB();
+      auto size = getU32LEB();
+      if (size != 1) {
+        throwError("bad branch hint size");
+      }
+      auto value = getInt8();
+      if (value > 1) {
+        throwError("bad branch hint value");
+      }
+      hints[offset] = value == 1;
+    }
+  }
+  if (pos != sectionPos + payloadLen) {
+    throwError("bad branch hints section size");
+  }
+}
+
+// Dispatch tables for the prefixed opcode spaces. Each maps an opcode to the
+// maybeVisit* method that decodes it, so that reading a prefixed instruction
+// costs a single table lookup rather than trying each method in turn, which
+// branch-mispredicts heavily on large inputs. Each table is built once, on
+// first use; opcodes without a decoder map to null, and a stray opcode is
+// reported by the caller as before.
+
+bool WasmBinaryBuilder::dispatchMisc(Expression*& out, uint32_t code) {
+  static const auto table = [] {
+    std::array<PrefixedVisitor, BinaryConsts::TableSize + 1> table{};
+    auto fill = [&](PrefixedVisitor visitor,
+                    std::initializer_list<uint32_t> codes) {
+      for (auto code : codes) {
+        table[code] = visitor;
+      }
+    };
+    fill(&WasmBinaryBuilder::maybeVisitTruncSat,
+         {BinaryConsts::I32STruncSatF32, BinaryConsts::I32UTruncSatF32,
+          BinaryConsts::I32STruncSatF64, BinaryConsts::I32UTruncSatF64,
+          BinaryConsts::I64STruncSatF32, BinaryConsts::I64UTruncSatF32,
+          BinaryConsts::I64STruncSatF64, BinaryConsts::I64UTruncSatF64});
+    fill(&WasmBinaryBuilder::maybeVisitMemoryInit,
+         {BinaryConsts::MemoryInit});
+    fill(&WasmBinaryBuilder::maybeVisitDataDrop,
+         {BinaryConsts::DataDrop});
+    fill(&WasmBinaryBuilder::maybeVisitMemoryCopy,
+         {BinaryConsts::MemoryCopy});
+    fill(&WasmBinaryBuilder::maybeVisitMemoryFill,
+         {BinaryConsts::MemoryFill});
+    fill(&WasmBinaryBuilder::maybeVisitTableSize,
+         {BinaryConsts::TableSize});
+    fill(&WasmBinaryBuilder::maybeVisitTableGrow,
+         {BinaryConsts::TableGrow});
+    return table;
+  }();
+  if (code >= table.size() || !table[code]) {
+    return false;
+  }
+  return (this->*table[code])(out, code);
+}
+
+bool WasmBinaryBuilder::dispatchSIMD(Expression*& out, uint32_t code) {
+  static const auto table = [] {
+    std::array<PrefixedVisitor, BinaryConsts::I32x4DotI8x16I7x16AddS + 1>
+      table{};
+    auto fill = [&](PrefixedVisitor visitor,
+                    std::initializer_list<uint32_t> codes) {
+      for (auto code : codes) {
+        table[code] = visitor;
+      }
+    };
+    fill(&WasmBinaryBuilder::maybeVisitSIMDBinary,
+         {BinaryConsts::I8x16Eq, BinaryConsts::I8x16Ne, BinaryConsts::I8x16LtS,
+          BinaryConsts::I8x16LtU, BinaryConsts::I8x16GtS,
+          BinaryConsts::I8x16GtU, BinaryConsts::I8x16LeS,
+          BinaryConsts::I8x16LeU, BinaryConsts::I8x16GeS,
+          BinaryConsts::I8x16GeU, BinaryConsts::I16x8Eq, BinaryConsts::I16x8Ne,
+          BinaryConsts::I16x8LtS, BinaryConsts::I16x8LtU,
+          BinaryConsts::I16x8GtS, BinaryConsts::I16x8GtU,
+          BinaryConsts::I16x8LeS, BinaryConsts::I16x8LeU,
+          BinaryConsts::I16x8GeS, BinaryConsts::I16x8GeU, BinaryConsts::I32x4Eq,
+          BinaryConsts::I32x4Ne, BinaryConsts::I32x4LtS, BinaryConsts::I32x4LtU,
+          BinaryConsts::I32x4GtS, BinaryConsts::I32x4GtU,
+          BinaryConsts::I32x4LeS, BinaryConsts::I32x4LeU,
+          BinaryConsts::I32x4GeS, BinaryConsts::I32x4GeU, BinaryConsts::I64x2Eq,
+          BinaryConsts::I64x2Ne, BinaryConsts::I64x2LtS, BinaryConsts::I64x2GtS,
+          BinaryConsts::I64x2LeS, BinaryConsts::I64x2GeS, BinaryConsts::F32x4Eq,
+          BinaryConsts::F32x4Ne, BinaryConsts::F32x4Lt, BinaryConsts::F32x4Gt,
+          BinaryConsts::F32x4Le, BinaryConsts::F32x4Ge, BinaryConsts::F64x2Eq,
+          BinaryConsts::F64x2Ne, BinaryConsts::F64x2Lt, BinaryConsts::F64x2Gt,
+          BinaryConsts::F64x2Le, BinaryConsts::F64x2Ge, BinaryConsts::V128And,
+          BinaryConsts::V128Or, BinaryConsts::V128Xor, BinaryConsts::V128Andnot,
+          BinaryConsts::I8x16Add, BinaryConsts::I8x16AddSatS,
+          BinaryConsts::I8x16AddSatU, BinaryConsts::I8x16Sub,
+          BinaryConsts::I8x16SubSatS, BinaryConsts::I8x16SubSatU,
+          BinaryConsts::I8x16MinS, BinaryConsts::I8x16MinU,
+          BinaryConsts::I8x16MaxS, BinaryConsts::I8x16MaxU,
+          BinaryConsts::I8x16AvgrU, BinaryConsts::I16x8Add,
+          BinaryConsts::I16x8AddSatS, BinaryConsts::I16x8AddSatU,
+          BinaryConsts::I16x8Sub, BinaryConsts::I16x8SubSatS,
+          BinaryConsts::I16x8SubSatU, BinaryConsts::I16x8Mul,
+          BinaryConsts::I16x8MinS, BinaryConsts::I16x8MinU,
+          BinaryConsts::I16x8MaxS, BinaryConsts::I16x8MaxU,
+          BinaryConsts::I16x8AvgrU, BinaryConsts::I16x8Q15MulrSatS,
+          BinaryConsts::I16x8ExtmulLowI8x16S,
+          BinaryConsts::I16x8ExtmulHighI8x16S,
+          BinaryConsts::I16x8ExtmulLowI8x16U,
+          BinaryConsts::I16x8ExtmulHighI8x16U, BinaryConsts::I32x4Add,
+          BinaryConsts::I32x4Sub, BinaryConsts::I32x4Mul,
+          BinaryConsts::I32x4MinS, BinaryConsts::I32x4MinU,
+          BinaryConsts::I32x4MaxS, BinaryConsts::I32x4MaxU,
+          BinaryConsts::I32x4DotI16x8S, BinaryConsts::I32x4ExtmulLowI16x8S,
+          BinaryConsts::I32x4ExtmulHighI16x8S,
+          BinaryConsts::I32x4ExtmulLowI16x8U,
+          BinaryConsts::I32x4ExtmulHighI16x8U, BinaryConsts::I64x2Add,
+          BinaryConsts::I64x2Sub, BinaryConsts::I64x2Mul,
+          BinaryConsts::I64x2ExtmulLowI32x4S,
+          BinaryConsts::I64x2ExtmulHighI32x4S,
+          BinaryConsts::I64x2ExtmulLowI32x4U,
+          BinaryConsts::I64x2ExtmulHighI32x4U, BinaryConsts::F32x4Add,
+          BinaryConsts::F32x4Sub, BinaryConsts::F32x4Mul,
+          BinaryConsts::F32x4Div, BinaryConsts::F32x4Min,
+          BinaryConsts::F32x4Max, BinaryConsts::F32x4Pmin,
+          BinaryConsts::F32x4Pmax, BinaryConsts::F64x2Add,
+          BinaryConsts::F64x2Sub, BinaryConsts::F64x2Mul,
+          BinaryConsts::F64x2Div, BinaryConsts::F64x2Min,
+          BinaryConsts::F64x2Max, BinaryConsts::F64x2Pmin,
+          BinaryConsts::F64x2Pmax, BinaryConsts::I8x16NarrowI16x8S,
+          BinaryConsts::I8x16NarrowI16x8U, BinaryConsts::I16x8NarrowI32x4S,
+          BinaryConsts::I16x8NarrowI32x4U, BinaryConsts::I8x16Swizzle,
+          BinaryConsts::I8x16RelaxedSwizzle, BinaryConsts::F32x4RelaxedMin,
+          BinaryConsts::F32x4RelaxedMax, BinaryConsts::F64x2RelaxedMin,
+          BinaryConsts::F64x2RelaxedMax, BinaryConsts::I16x8RelaxedQ15MulrS,
+          BinaryConsts::I16x8DotI8x16I7x16S});
+    fill(&WasmBinaryBuilder::maybeVisitSIMDUnary,
+         {BinaryConsts::I8x16Splat, BinaryConsts::I16x8Splat,
+          BinaryConsts::I32x4Splat, BinaryConsts::I64x2Splat,
+          BinaryConsts::F32x4Splat, BinaryConsts::F64x2Splat,
+          BinaryConsts::V128Not, BinaryConsts::V128AnyTrue,
+          BinaryConsts::I8x16Popcnt, BinaryConsts::I8x16Abs,
+          BinaryConsts::I8x16Neg, BinaryConsts::I8x16AllTrue,
+          BinaryConsts::I8x16Bitmask, BinaryConsts::I16x8Abs,
+          BinaryConsts::I16x8Neg, BinaryConsts::I16x8AllTrue,
+          BinaryConsts::I16x8Bitmask, BinaryConsts::I32x4Abs,
+          BinaryConsts::I32x4Neg, BinaryConsts::I32x4AllTrue,
+          BinaryConsts::I32x4Bitmask, BinaryConsts::I64x2Abs,
+          BinaryConsts::I64x2Neg, BinaryConsts::I64x2AllTrue,
+          BinaryConsts::I64x2Bitmask, BinaryConsts::F32x4Abs,
+          BinaryConsts::F32x4Neg, BinaryConsts::F32x4Sqrt,
+          BinaryConsts::F32x4Ceil, BinaryConsts::F32x4Floor,
+          BinaryConsts::F32x4Trunc, BinaryConsts::F32x4Nearest,
+          BinaryConsts::F64x2Abs, BinaryConsts::F64x2Neg,
+          BinaryConsts::F64x2Sqrt, BinaryConsts::F64x2Ceil,
+          BinaryConsts::F64x2Floor, BinaryConsts::F64x2Trunc,
+          BinaryConsts::F64x2Nearest, BinaryConsts::I16x8ExtaddPairwiseI8x16S,
+          BinaryConsts::I16x8ExtaddPairwiseI8x16U,
+          BinaryConsts::I32x4ExtaddPairwiseI16x8S,
+          BinaryConsts::I32x4ExtaddPairwiseI16x8U,
+          BinaryConsts::I32x4TruncSatF32x4S, BinaryConsts::I32x4TruncSatF32x4U,
+          BinaryConsts::F32x4ConvertI32x4S, BinaryConsts::F32x4ConvertI32x4U,
+          BinaryConsts::I16x8ExtendLowI8x16S,
+          BinaryConsts::I16x8ExtendHighI8x16S,
+          BinaryConsts::I16x8ExtendLowI8x16U,
+          BinaryConsts::I16x8ExtendHighI8x16U,
+          BinaryConsts::I32x4ExtendLowI16x8S,
+          BinaryConsts::I32x4ExtendHighI16x8S,
+          BinaryConsts::I32x4ExtendLowI16x8U,
+          BinaryConsts::I32x4ExtendHighI16x8U,
+          BinaryConsts::I64x2ExtendLowI32x4S,
+          BinaryConsts::I64x2ExtendHighI32x4S,
+          BinaryConsts::I64x2ExtendLowI32x4U,
+          BinaryConsts::I64x2ExtendHighI32x4U,
+          BinaryConsts::F64x2ConvertLowI32x4S,
+          BinaryConsts::F64x2ConvertLowI32x4U,
+          BinaryConsts::I32x4TruncSatF64x2SZero,
+          BinaryConsts::I32x4TruncSatF64x2UZero,
+          BinaryConsts::F32x4DemoteF64x2Zero,
+          BinaryConsts::F64x2PromoteLowF32x4,
+          BinaryConsts::I32x4RelaxedTruncF32x4S,
+          BinaryConsts::I32x4RelaxedTruncF32x4U,
+          BinaryConsts::I32x4RelaxedTruncF64x2SZero,
+          BinaryConsts::I32x4RelaxedTruncF64x2UZero});
+    fill(&WasmBinaryBuilder::maybeVisitSIMDConst,
+         {BinaryConsts::V128Const});
+    fill(&WasmBinaryBuilder::maybeVisitSIMDStore,
+         {BinaryConsts::V128Store});
+    fill(&WasmBinaryBuilder::maybeVisitSIMDExtract,
+         {BinaryConsts::I8x16ExtractLaneS, BinaryConsts::I8x16ExtractLaneU,
+          BinaryConsts::I16x8ExtractLaneS, BinaryConsts::I16x8ExtractLaneU,
+          BinaryConsts::I32x4ExtractLane, BinaryConsts::I64x2ExtractLane,
+          BinaryConsts::F32x4ExtractLane, BinaryConsts::F64x2ExtractLane});
+    fill(&WasmBinaryBuilder::maybeVisitSIMDReplace,
+         {BinaryConsts::I8x16ReplaceLane, BinaryConsts::I16x8ReplaceLane,
+          BinaryConsts::I32x4ReplaceLane, BinaryConsts::I64x2ReplaceLane,
+          BinaryConsts::F32x4ReplaceLane, BinaryConsts::F64x2ReplaceLane});
+    fill(&WasmBinaryBuilder::maybeVisitSIMDShuffle,
+         {BinaryConsts::I8x16Shuffle});
+    fill(&WasmBinaryBuilder::maybeVisitSIMDTernary,
+         {BinaryConsts::V128Bitselect, BinaryConsts::I8x16Laneselect,
+          BinaryConsts::I16x8Laneselect, BinaryConsts::I32x4Laneselect,
+          BinaryConsts::I64x2Laneselect, BinaryConsts::F32x4RelaxedFma,
+          BinaryConsts::F32x4RelaxedFms, BinaryConsts::F64x2RelaxedFma,
+          BinaryConsts::F64x2RelaxedFms, BinaryConsts::I32x4DotI8x16I7x16AddS});
+    fill(&WasmBinaryBuilder::maybeVisitSIMDShift,
+         {BinaryConsts::I8x16Shl, BinaryConsts::I8x16ShrS,
+          BinaryConsts::I8x16ShrU, BinaryConsts::I16x8Shl,
+          BinaryConsts::I16x8ShrS, BinaryConsts::I16x8ShrU,
+          BinaryConsts::I32x4Shl, BinaryConsts::I32x4ShrS,
+          BinaryConsts::I32x4ShrU, BinaryConsts::I64x2Shl,
+          BinaryConsts::I64x2ShrS, BinaryConsts::I64x2ShrU});
+    fill(&WasmBinaryBuilder::maybeVisitSIMDLoad,
+         {BinaryConsts::V128Load, BinaryConsts::V128Load8Splat,
+          BinaryConsts::V128Load16Splat, BinaryConsts::V128Load32Splat,
+          BinaryConsts::V128Load64Splat, BinaryConsts::V128Load8x8S,
+          BinaryConsts::V128Load8x8U, BinaryConsts::V128Load16x4S,
+          BinaryConsts::V128Load16x4U, BinaryConsts::V128Load32x2S,
+          BinaryConsts::V128Load32x2U, BinaryConsts::V128Load32Zero,
+          BinaryConsts::V128Load64Zero});
+    fill(&WasmBinaryBuilder::maybeVisitSIMDLoadStoreLane,
+         {BinaryConsts::V128Load8Lane, BinaryConsts::V128Load16Lane,
+          BinaryConsts::V128Load32Lane, BinaryConsts::V128Load64Lane,
+          BinaryConsts::V128Store8Lane, BinaryConsts::V128Store16Lane,
+          BinaryConsts::V128Store32Lane, BinaryConsts::V128Store64Lane});
+    return table;
+  }();
+  if (code >= table.size() || !table[code]) {
+    return false;
+  }
+  return (this->*table[code])(out, code);
+}
+
+bool WasmBinaryBuilder::dispatchGC(Expression*& out, uint32_t code) {
+  static const auto table = [] {
+    std::array<PrefixedVisitor, BinaryConsts::BrOnNonNull + 1> table{};
+    auto fill = [&](PrefixedVisitor visitor,
+                    std::initializer_list<uint32_t> codes) {
+      for (auto code : codes) {
+        table[code] = visitor;
+      }
+    };
+    fill(&WasmBinaryBuilder::maybeVisitI31New,
+         {BinaryConsts::I31New});
+    fill(&WasmBinaryBuilder::maybeVisitI31Get,
+         {BinaryConsts::I31GetS, BinaryConsts::I31GetU});
+    fill(&WasmBinaryBuilder::maybeVisitRefTest,
+         {BinaryConsts::RefTestStatic});
+    fill(&WasmBinaryBuilder::maybeVisitRefCast,
+         {BinaryConsts::RefCastStatic, BinaryConsts::RefCastNopStatic});
+    fill(&WasmBinaryBuilder::maybeVisitBrOn,
+         {BinaryConsts::BrOnNull, BinaryConsts::BrOnNonNull,
+          BinaryConsts::BrOnCastStatic, BinaryConsts::BrOnCastStaticFail,
+          BinaryConsts::BrOnFunc, BinaryConsts::BrOnNonFunc,
+          BinaryConsts::BrOnData, BinaryConsts::BrOnNonData,
+          BinaryConsts::BrOnI31, BinaryConsts::BrOnNonI31});
+    fill(&WasmBinaryBuilder::maybeVisitStructNew,
+         {BinaryConsts::StructNew, BinaryConsts::StructNewDefault});
+    fill(&WasmBinaryBuilder::maybeVisitStructGet,
+         {BinaryConsts::StructGet, BinaryConsts::StructGetS,
+          BinaryConsts::StructGetU});
+    fill(&WasmBinaryBuilder::maybeVisitStructSet,
+         {BinaryConsts::StructSet});
+    fill(&WasmBinaryBuilder::maybeVisitArrayNew,
+         {BinaryConsts::ArrayNew, BinaryConsts::ArrayNewDefault});
+    fill(&WasmBinaryBuilder::maybeVisitArrayInit,
+         {BinaryConsts::ArrayInitStatic});
+    fill(&WasmBinaryBuilder::maybeVisitArrayGet,
+         {BinaryConsts::ArrayGet, BinaryConsts::ArrayGetU,
+          BinaryConsts::ArrayGetS});
+    fill(&WasmBinaryBuilder::maybeVisitArraySet,
+         {BinaryConsts::ArraySet});
+    fill(&WasmBinaryBuilder::maybeVisitArrayLen,
+         {BinaryConsts::ArrayLen});
+    fill(&WasmBinaryBuilder::maybeVisitArrayCopy,
+         {BinaryConsts::ArrayCopy});
+    fill(&WasmBinaryBuilder::maybeVisitStringNew,
+         {BinaryConsts::StringNewWTF8, BinaryConsts::StringNewWTF16,
+          BinaryConsts::StringNewWTF8Array, BinaryConsts::StringNewWTF16Array});
+    fill(&WasmBinaryBuilder::maybeVisitStringConst,
+         {BinaryConsts::StringConst});
+    fill(&WasmBinaryBuilder::maybeVisitStringMeasure,
+         {BinaryConsts::StringMeasureWTF8, BinaryConsts::StringMeasureWTF16,
+          BinaryConsts::StringIsUSV, BinaryConsts::StringViewWTF16Length});
+    fill(&WasmBinaryBuilder::maybeVisitStringEncode,
+         {BinaryConsts::StringEncodeWTF8, BinaryConsts::StringEncodeWTF16,
+          BinaryConsts::StringEncodeWTF8Array,
+          BinaryConsts::StringEncodeWTF16Array});
+    fill(&WasmBinaryBuilder::maybeVisitStringConcat,
+         {BinaryConsts::StringConcat});
+    fill(&WasmBinaryBuilder::maybeVisitStringEq,
+         {BinaryConsts::StringEq});
+    fill(&WasmBinaryBuilder::maybeVisitStringAs,
+         {BinaryConsts::StringAsWTF8, BinaryConsts::StringAsWTF16,
+          BinaryConsts::StringAsIter});
+    fill(&WasmBinaryBuilder::maybeVisitStringWTF8Advance,
+         {BinaryConsts::StringViewWTF8Advance});
+    fill(&WasmBinaryBuilder::maybeVisitStringWTF16Get,
+         {BinaryConsts::StringViewWTF16GetCodePoint});
+    fill(&WasmBinaryBuilder::maybeVisitStringIterNext,
+         {BinaryConsts::StringViewIterNext});
+    fill(&WasmBinaryBuilder::maybeVisitStringIterMove,
+         {BinaryConsts::StringViewIterAdvance,
+          BinaryConsts::StringViewIterRewind});
+    fill(&WasmBinaryBuilder::maybeVisitStringSliceWTF,
+         {BinaryConsts::StringViewWTF8Slice,
+          BinaryConsts::StringViewWTF16Slice});
+    fill(&WasmBinaryBuilder::maybeVisitStringSliceIter,
+         {BinaryConsts::StringViewIterSlice});
+    return table;
+  }();
+  if (code >= table.size() || !table[code]) {
+    return false;
+  }
+  return (this->*table[code])(out, code);
+}
+
 BinaryConsts::ASTNodes WasmBinaryBuilder::readExpression(Expression*& curr) {
   if (pos == endOfFunction) {
     throwError("Reached function end without seeing End opcode");
@@ -3741,175 +4772,51 @@ BinaryConsts::ASTNodes WasmBinaryBuilder::readExpression(Expression*& curr) {
     }
     case BinaryConsts::AtomicPrefix: {
       code = static_cast<uint8_t>(getU32LEB());
-      if (maybeVisitLoad(curr, code, /*isAtomic=*/true)) {
-        break;
-      }
-      if (maybeVisitStore(curr, code, /*isAtomic=*/true)) {
-        break;
-      }
-      if (maybeVisitAtomicRMW(curr, code)) {
-        break;
-      }
-      if (maybeVisitAtomicCmpxchg(curr, code)) {
-        break;
-      }
-      if (maybeVisitAtomicWait(curr, code)) {
-        break;
-      }
-      if (maybeVisitAtomicNotify(curr, code)) {
-        break;
+      // The atomic opcode space is laid out in contiguous ranges per
+      // operation, so we can pick the decoder directly.
+      bool handled = false;
+      if (code >= BinaryConsts::I32AtomicLoad) {
+        if (code <= BinaryConsts::I64AtomicLoad32U) {
+          handled = maybeVisitLoad(curr, code, /*isAtomic=*/true);
+        } else if (code <= BinaryConsts::I64AtomicStore32) {
+          handled = maybeVisitStore(curr, code, /*isAtomic=*/true);
+        } else if (code <= BinaryConsts::AtomicRMWOps_End) {
+          handled = maybeVisitAtomicRMW(curr, code);
+        } else if (code <= BinaryConsts::AtomicCmpxchgOps_End) {
+          handled = maybeVisitAtomicCmpxchg(curr, code);
+        }
+      } else if (code == BinaryConsts::AtomicNotify) {
+        handled = maybeVisitAtomicNotify(curr, code);
+      } else if (code == BinaryConsts::AtomicFence) {
+        handled = maybeVisitAtomicFence(curr, code);
+      } else {
+        handled = maybeVisitAtomicWait(curr, code);
       }
-      if (maybeVisitAtomicFence(curr, code)) {
-        break;
+      if (!handled) {
+        throwError("invalid code after atomic prefix: " +
+                   std::to_string(code));
       }
-      throwError("invalid code after atomic prefix: " + std::to_string(code));
       break;
     }
     case BinaryConsts::MiscPrefix: {
       auto opcode = getU32LEB();
-      if (maybeVisitTruncSat(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitMemoryInit(curr, opcode)) {
-        break;
+      if (!dispatchMisc(curr, opcode)) {
+        throwError("invalid code after misc prefix: " +
+                   std::to_string(opcode));
       }
-      if (maybeVisitDataDrop(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitMemoryCopy(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitMemoryFill(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitTableSize(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitTableGrow(curr, opcode)) {
-        break;
-      }
-      throwError("invalid code after misc prefix: " + std::to_string(opcode));
       break;
     }
     case BinaryConsts::SIMDPrefix: {
       auto opcode = getU32LEB();
-      if (maybeVisitSIMDBinary(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitSIMDUnary(curr, opcode)) {
-        break;
+      if (!dispatchSIMD(curr, opcode)) {
+        throwError("invalid code after SIMD prefix: " +
+                   std::to_string(opcode));
       }
-      if (maybeVisitSIMDConst(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitSIMDStore(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitSIMDExtract(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitSIMDReplace(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitSIMDShuffle(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitSIMDTernary(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitSIMDShift(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitSIMDLoad(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitSIMDLoadStoreLane(curr, opcode)) {
-        break;
-      }
-      throwError("invalid code after SIMD prefix: " + std::to_string(opcode));
       break;
     }
     case BinaryConsts::GCPrefix: {
       uint8_t opcode = getInt8();
-      if (maybeVisitI31New(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitI31Get(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitRefTest(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitRefCast(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitBrOn(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStructNew(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStructGet(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStructSet(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitArrayNew(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitArrayInit(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitArrayGet(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitArraySet(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitArrayLen(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitArrayCopy(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStringNew(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStringConst(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStringMeasure(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStringEncode(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStringConcat(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStringEq(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStringAs(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStringWTF8Advance(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStringWTF16Get(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStringIterNext(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStringIterMove(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStringSliceWTF(curr, opcode)) {
-        break;
-      }
-      if (maybeVisitStringSliceIter(curr, opcode)) {
+      if (dispatchGC(curr, opcode)) {
         break;
       }
       if (opcode == BinaryConsts::RefIsFunc ||
@@ -3928,21 +4835,31 @@ BinaryConsts::ASTNodes WasmBinaryBuilder::readExpression(Expression*& curr) {
       break;
     }
     default: {
-      // otherwise, the code is a subcode TODO: optimize
-      if (maybeVisitBinary(curr, code)) {
-        break;
-      }
-      if (maybeVisitUnary(curr, code)) {
-        break;
-      }
-      if (maybeVisitConst(curr, code)) {
-        break;
-      }
-      if (maybeVisitLoad(curr, code, /*isAtomic=*/false)) {
-        break;
-      }
-      if (maybeVisitStore(curr, code, /*isAtomic=*/false)) {
-        break;
+      // The remaining single-byte opcodes are consts, loads, stores, and
+      // unary and binary operations. The first three occupy contiguous
+      // ranges, so we can pick their decoder directly; unary and binary
+      // encodings are interleaved, and we try those two in turn.
+      if (code >= BinaryConsts::I32Const && code <= BinaryConsts::F64Const) {
+        if (maybeVisitConst(curr, code)) {
+          break;
+        }
+      } else if (code >= BinaryConsts::I32LoadMem &&
+                 code <= BinaryConsts::I64LoadMem32U) {
+        if (maybeVisitLoad(curr, code, /*isAtomic=*/false)) {
+          break;
+        }
+      } else if (code >= BinaryConsts::I32StoreMem &&
+                 code <= BinaryConsts::I64StoreMem32) {
+        if (maybeVisitStore(curr, code, /*isAtomic=*/false)) {
+          break;
+        }
+      } else {
+        if (maybeVisitBinary(curr, code)) {
+          break;
+        }
+        if (maybeVisitUnary(curr, code)) {
+          break;
+        }
       }
       throwError("bad node code " + std::to_string(code));
       break;
@@ -3958,6 +4875,14 @@ BinaryConsts::ASTNodes WasmBinaryBuilder::readExpression(Expression*& curr) {
         BinaryLocations::Span{BinaryLocation(startPos - codeSectionLocation),
                               BinaryLocation(pos - codeSectionLocation)};
     }
+    if (currBranchHints &&
+        (curr->is<If>() || curr->is<BrOn>() ||
+         (curr->is<Break>() && curr->cast<Break>()->condition))) {
+      auto iter = currBranchHints->find(startPos - currBodyStart);
+      if (iter != currBranchHints->end()) {
+        currFunction->branchHints[curr] = iter->second;
+      }
+    }
   }
   BYN_TRACE("zz recurse from " << depth-- << " at " << pos << std::endl);
   return BinaryConsts::ASTNodes(code);
@@ -7273,4 +8198,256 @@ void WasmBinaryBuilder::validateHeapTypeUsingChild(Expression* child,
   }
 }
 
+LazyFunctionBodies::LazyFunctionBodies(Module& wasm, std::vector<char>&& input)
+  : wasm(wasm), ownedInput(std::move(input)), input(ownedInput) {}
+
+LazyFunctionBodies::LazyFunctionBodies(Module& wasm,
+                                       std::shared_ptr<MappedFile> input_)
+  : wasm(wasm), mappedInput(std::move(input_)), input(mappedInput->get()) {}
+
+LazyFunctionBodies::~LazyFunctionBodies() {}
+
+void LazyFunctionBodies::finishReading(WasmBinaryBuilder& parser) {
+  // Make a builder of our own, with the context needed to decode bodies. The
+  // module is complete (aside from the lazy bodies) by the time we decode
+  // anything, so references to functions, tables, and globals can be resolved
+  // by index immediately rather than being backpatched in processNames().
+  builder = std::make_unique<WasmBinaryBuilder>(wasm, wasm.features, input);
+  builder->types = parser.types;
+  builder->functionTypes = parser.functionTypes;
+  builder->functionImports = parser.functionImports;
+  builder->debugInfo = parser.debugInfo;
+  builder->codeSectionLocation = parser.codeSectionLocation;
+  builder->branchHints = parser.branchHints;
+}
+
+bool LazyFunctionBodies::isLazy(Function* func) {
+  std::lock_guard<std::mutex> lock(mutex);
+  return ranges.find(func) != ranges.end();
+}
+
+void LazyFunctionBodies::materialize(Function* func) {
+  std::lock_guard<std::mutex> lock(mutex);
+  materializeLocked(func);
+}
+
+void LazyFunctionBodies::materializeAll() {
+  std::lock_guard<std::mutex> lock(mutex);
+  // materializeLocked erases as it goes; iterate over a stable list.
+  std::vector<Function*> funcs;
+  funcs.reserve(ranges.size());
+  for (auto& [func, range] : ranges) {
+    funcs.push_back(func);
+  }
+  for (auto* func : funcs) {
+    materializeLocked(func);
+  }
+}
+
+void LazyFunctionBodies::materializeLocked(Function* func) {
+  auto iter = ranges.find(func);
+  if (iter == ranges.end()) {
+    return;
+  }
+  auto body = iter->second;
+  ranges.erase(iter);
+  builder->pos = body.range.bodyPos;
+  builder->readFunctionBody(func, body.index, body.range.size);
+  // Resolve the references this body makes, by index, as everything already
+  // has its final name.
+  for (auto& [idx, refs] : builder->functionRefs) {
+    for (auto* ref : refs) {
+      *ref = builder->getFunctionName(idx);
+    }
+  }
+  builder->functionRefs.clear();
+  for (auto& [idx, refs] : builder->tableRefs) {
+    for (auto* ref : refs) {
+      *ref = builder->getTableName(idx);
+    }
+  }
+  builder->tableRefs.clear();
+  for (auto& [idx, refs] : builder->globalRefs) {
+    for (auto* ref : refs) {
+      *ref = builder->getGlobalName(idx);
+    }
+  }
+  builder->globalRefs.clear();
+}
+
+namespace {
+
+// Minimal byte and LEB reading over a raw buffer, for scanning a module's
+// section structure (and parsing index files) without a full
+// WasmBinaryBuilder.
+struct RawReader {
+  BufferView data;
+  size_t pos = 0;
+
+  uint8_t getInt8() {
+    if (pos >= data.size()) {
+      throw ParseException("unexpected end of input");
+    }
+    return data[pos++];
+  }
+  uint32_t getInt32() {
+    uint32_t ret = 0;
+    for (int i = 0; i < 4; i++) {
+      ret |= uint32_t(getInt8()) << (8 * i);
+    }
+    return ret;
+  }
+  uint64_t getInt64() {
+    uint64_t ret = 0;
+    for (int i = 0; i < 8; i++) {
+      ret |= uint64_t(getInt8()) << (8 * i);
+    }
+    return ret;
+  }
+  uint32_t getU32LEB() {
+    U32LEB leb;
+    leb.read([&]() { return getInt8(); });
+    return leb.value;
+  }
+};
+
+// The header of the sidecar index format; see BinaryIndex.
+const uint32_t BinaryIndexMagic = 0x78646e69; // "indx"
+const uint32_t BinaryIndexVersion = 1;
+
+// FNV-1a over a byte range, folded into an existing digest.
+uint64_t hashBytes(uint64_t digest, const char* data, size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    digest ^= uint8_t(data[i]);
+    digest *= 1099511628211ULL;
+  }
+  return digest;
+}
+
+} // anonymous namespace
+
+BinaryIndex BinaryIndex::build(BufferView module) {
+  RawReader in{module};
+  BinaryIndex index;
+  index.moduleSize = module.size();
+  if (in.getInt32() != BinaryConsts::Magic ||
+      in.getInt32() != BinaryConsts::Version) {
+    throw ParseException("invalid module header");
+  }
+  while (in.pos < module.size()) {
+    uint8_t sectionCode = in.getInt8();
+    uint32_t payloadLen = in.getU32LEB();
+    if (uint64_t(in.pos) + uint64_t(payloadLen) > module.size()) {
+      throw ParseException("section extends beyond end of input");
+    }
+    auto oldPos = in.pos;
+    if (sectionCode == BinaryConsts::Section::Code) {
+      index.codePos = in.pos;
+      index.codeSize = payloadLen;
+      size_t total = in.getU32LEB();
+      index.ranges.reserve(total);
+      for (size_t i = 0; i < total; i++) {
+        auto sizePos = in.pos;
+        size_t size = in.getU32LEB();
+        index.ranges.push_back(
+          WasmBinaryBuilder::FunctionBodyRange{sizePos, in.pos, size});
+        in.pos += size;
+        if (in.pos > module.size()) {
+          throw ParseException("function body goes past the end of the input");
+        }
+      }
+    }
+    in.pos = oldPos + payloadLen;
+  }
+  index.digest = computeDigest(module, index.codePos, index.codeSize);
+  return index;
+}
+
+uint64_t
+BinaryIndex::computeDigest(BufferView module, size_t codePos, size_t codeSize) {
+  // FNV-1a offset basis, then all the bytes outside the code section payload.
+  uint64_t digest = 14695981039346656037ULL;
+  digest = hashBytes(digest, module.data(), codePos);
+  auto codeEnd = codePos + codeSize;
+  digest = hashBytes(digest, module.data() + codeEnd, module.size() - codeEnd);
+  return digest;
+}
+
+bool BinaryIndex::matches(BufferView module) const {
+  if (module.size() != moduleSize) {
+    return false;
+  }
+  if (codePos > module.size() || codeSize > module.size() - codePos) {
+    return false;
+  }
+  auto codeEnd = codePos + codeSize;
+  for (auto& range : ranges) {
+    if (range.sizePos < codePos || range.bodyPos < range.sizePos ||
+        range.bodyPos > codeEnd || range.size > codeEnd - range.bodyPos) {
+      return false;
+    }
+  }
+  return digest == computeDigest(module, codePos, codeSize);
+}
+
+void BinaryIndex::write(const std::string& filename) const {
+  std::vector<char> buffer;
+  auto writeU32 = [&](uint32_t x) {
+    for (int i = 0; i < 4; i++) {
+      buffer.push_back(char(x & 0xff));
+      x >>= 8;
+    }
+  };
+  auto writeU64 = [&](uint64_t x) {
+    for (int i = 0; i < 8; i++) {
+      buffer.push_back(char(x & 0xff));
+      x >>= 8;
+    }
+  };
+  writeU32(BinaryIndexMagic);
+  writeU32(BinaryIndexVersion);
+  writeU64(moduleSize);
+  writeU64(codePos);
+  writeU64(codeSize);
+  writeU64(digest);
+  writeU64(ranges.size());
+  for (auto& range : ranges) {
+    writeU64(range.sizePos);
+    writeU64(range.bodyPos);
+    writeU64(range.size);
+  }
+  Output output(filename, Flags::Binary);
+  output.write(buffer.data(), buffer.size());
+}
+
+BinaryIndex BinaryIndex::read(const std::string& filename) {
+  auto buffer = read_file<std::vector<char>>(filename, Flags::Binary);
+  RawReader in{BufferView(buffer)};
+  if (in.getInt32() != BinaryIndexMagic) {
+    throw ParseException("invalid binary index file");
+  }
+  if (in.getInt32() != BinaryIndexVersion) {
+    throw ParseException("unsupported binary index version");
+  }
+  BinaryIndex index;
+  index.moduleSize = in.getInt64();
+  index.codePos = in.getInt64();
+  index.codeSize = in.getInt64();
+  index.digest = in.getInt64();
+  uint64_t numRanges = in.getInt64();
+  auto remaining = buffer.size() - in.pos;
+  if (remaining / 24 != numRanges || remaining % 24 != 0) {
+    throw ParseException("truncated binary index file");
+  }
+  index.ranges.reserve(numRanges);
+  for (uint64_t i = 0; i < numRanges; i++) {
+    auto sizePos = size_t(in.getInt64());
+    auto bodyPos = size_t(in.getInt64());
+    auto size = size_t(in.getInt64());
+    index.ranges.push_back(
+      WasmBinaryBuilder::FunctionBodyRange{sizePos, bodyPos, size});
+  }
+  return index;
+}
+
 } // namespace wasm
@@ -25,6 +25,9 @@
 std::error_code dwarf2yaml(llvm::DWARFContext& DCtx, llvm::DWARFYAML::Data& Y);
 #endif
 
+#include <atomic>
+
+#include "support/threads.h"
 #include "wasm-binary.h"
 #include "wasm-debug.h"
 #include "wasm.h"
@@ -656,7 +659,10 @@ static bool isTombstone(uint32_t x) {
 // changes so we can update offsets into the debug line section.
 static void updateDebugLines(llvm::DWARFYAML::Data& data,
                              LocationUpdater& locationUpdater) {
-  for (auto& table : data.DebugLines) {
+  // Process the line tables in parallel: this is where most of the update
+  // time goes, each table is independent of the others, and in this phase the
+  // location updater is only queried, never modified.
+  auto updateTable = [&](llvm::DWARFYAML::LineTable& table) {
     uint32_t sequenceId = 0;
     // Parse the original opcodes and emit new ones.
     LineState state(table, sequenceId);
@@ -751,7 +757,21 @@ static void updateDebugLines(llvm::DWARFYAML::Data& data,
       }
       table.Opcodes.swap(newOpcodes);
     }
+  };
+  std::atomic<size_t> nextTable{0};
+  size_t numWorkers = ThreadPool::get()->size();
+  std::vector<std::function<ThreadWorkState()>> doWorkers;
+  for (size_t i = 0; i < numWorkers; i++) {
+    doWorkers.push_back([&]() {
+      auto index = nextTable.fetch_add(1);
+      if (index >= data.DebugLines.size()) {
+        return ThreadWorkState::Finished;
+      }
+      updateTable(data.DebugLines[index]);
+      return ThreadWorkState::More;
+    });
   }
+  ThreadPool::get()->work(doWorkers);
   // After updating the contents, run the emitter in order to update the
   // lengths of each section. We will use that to update offsets into the
   // debug_line section.
@@ -781,13 +801,22 @@ static void iterContextAndYAML(const T& contextList, U& yamlList, W func) {
   assert(yamlValue == yamlList.end());
 }
 
-// Updates a YAML entry from a DWARF DIE. Also updates LocationUpdater
-// associating each .debug_loc entry with the base address of its corresponding
-// compilation unit.
+// The updates to a LocationUpdater's maps that processing a compile unit's
+// DIEs produces. Compile units are processed in parallel, so each collects
+// its updates here, and they are applied to the location updater afterwards.
+struct DIEUpdates {
+  std::unordered_map<size_t, LocationUpdater::OldToNew> compileUnitBases;
+  std::unordered_map<BinaryLocation, size_t> locToUnitMap;
+};
+
+// Updates a YAML entry from a DWARF DIE. Also records in |updates| the
+// association of each .debug_loc entry with the base address of its
+// corresponding compilation unit.
 static void updateDIE(const llvm::DWARFDebugInfoEntry& DIE,
                       llvm::DWARFYAML::Entry& yamlEntry,
                       const llvm::DWARFAbbreviationDeclaration* abbrevDecl,
-                      LocationUpdater& locationUpdater,
+                      const LocationUpdater& locationUpdater,
+                      DIEUpdates& updates,
                       size_t compileUnitIndex) {
   auto tag = DIE.getTag();
   // Pairs of low/high_pc require some special handling, as the high
@@ -812,7 +841,7 @@ static void updateDIE(const llvm::DWARFDebugInfoEntry& DIE,
           newValue = locationUpdater.getNewFuncStart(oldValue);
           // Per the DWARF spec, "The base address of a compile unit is
           // defined as the value of the DW_AT_low_pc attribute, if present."
-          locationUpdater.compileUnitBases[compileUnitIndex] =
+          updates.compileUnitBases[compileUnitIndex] =
             LocationUpdater::OldToNew{oldValue, newValue};
         } else if (tag == llvm::dwarf::DW_TAG_subprogram) {
           newValue = locationUpdater.getNewFuncStart(oldValue);
@@ -830,7 +859,7 @@ static void updateDIE(const llvm::DWARFDebugInfoEntry& DIE,
       } else if (attr == llvm::dwarf::DW_AT_location &&
                  attrSpec.Form == llvm::dwarf::DW_FORM_sec_offset) {
         BinaryLocation locOffset = yamlValue.Value;
-        locationUpdater.locToUnitMap[locOffset] = compileUnitIndex;
+        updates.locToUnitMap[locOffset] = compileUnitIndex;
       }
     });
   // Next, process the high_pcs.
@@ -874,37 +903,77 @@ static void updateCompileUnits(const BinaryenDWARFInfo& info,
                                LocationUpdater& locationUpdater,
                                bool is64) {
   // The context has the high-level information we need, and the YAML is where
-  // we write changes. First, iterate over the compile units.
-  size_t compileUnitIndex = 0;
+  // we write changes. First, pair up the compile units, so that we can then
+  // process them in parallel. That is safe as the units are independent, and
+  // all of the lazy parsing in the context (the DIEs and the abbreviations)
+  // was already forced when the YAML was built from it.
+  struct UnitWork {
+    llvm::DWARFUnit* CU;
+    llvm::DWARFYAML::Unit* yamlUnit;
+    size_t index;
+  };
+  std::vector<UnitWork> units;
   iterContextAndYAML(
     info.context->compile_units(),
     yaml.CompileUnits,
     [&](const std::unique_ptr<llvm::DWARFUnit>& CU,
         llvm::DWARFYAML::Unit& yamlUnit) {
-      // Our Memory64Lowering pass may change the "architecture" of the DWARF
-      // data. AddrSize will cause all DW_AT_low_pc to be written as 32/64-bit.
-      auto NewAddrSize = is64 ? 8 : 4;
-      if (NewAddrSize != yamlUnit.AddrSize) {
-        yamlUnit.AddrSize = NewAddrSize;
-        yamlUnit.AddrSizeChanged = true;
+      units.push_back({CU.get(), &yamlUnit, units.size()});
+    });
+  // Each unit collects its location updater changes separately, so that the
+  // workers never write to shared state; we apply them below.
+  std::vector<DIEUpdates> updates(units.size());
+  auto updateUnit = [&](const UnitWork& work) {
+    auto& yamlUnit = *work.yamlUnit;
+    // Our Memory64Lowering pass may change the "architecture" of the DWARF
+    // data. AddrSize will cause all DW_AT_low_pc to be written as 32/64-bit.
+    auto NewAddrSize = is64 ? 8 : 4;
+    if (NewAddrSize != yamlUnit.AddrSize) {
+      yamlUnit.AddrSize = NewAddrSize;
+      yamlUnit.AddrSizeChanged = true;
+    }
+    // Process the DIEs in each compile unit.
+    iterContextAndYAML(
+      work.CU->dies(),
+      yamlUnit.Entries,
+      [&](const llvm::DWARFDebugInfoEntry& DIE,
+          llvm::DWARFYAML::Entry& yamlEntry) {
+        // Process the entries in each relevant DIE, looking for attributes to
+        // change.
+        auto abbrevDecl = DIE.getAbbreviationDeclarationPtr();
+        if (abbrevDecl) {
+          // This is relevant; look for things to update.
+          updateDIE(DIE,
+                    yamlEntry,
+                    abbrevDecl,
+                    locationUpdater,
+                    updates[work.index],
+                    work.index);
+        }
+      });
+  };
+  std::atomic<size_t> nextUnit{0};
+  size_t numWorkers = ThreadPool::get()->size();
+  std::vector<std::function<ThreadWorkState()>> doWorkers;
+  for (size_t i = 0; i < numWorkers; i++) {
+    doWorkers.push_back([&]() {
+      auto index = nextUnit.fetch_add(1);
+      if (index >= units.size()) {
+        return ThreadWorkState::Finished;
       }
-      // Process the DIEs in each compile unit.
-      iterContextAndYAML(
-        CU->dies(),
-        yamlUnit.Entries,
-        [&](const llvm::DWARFDebugInfoEntry& DIE,
-            llvm::DWARFYAML::Entry& yamlEntry) {
-          // Process the entries in each relevant DIE, looking for attributes to
-          // change.
-          auto abbrevDecl = DIE.getAbbreviationDeclarationPtr();
-          if (abbrevDecl) {
-            // This is relevant; look for things to update.
-            updateDIE(
-              DIE, yamlEntry, abbrevDecl, locationUpdater, compileUnitIndex);
-          }
-        });
-      compileUnitIndex++;
+      updateUnit(units[index]);
+      return ThreadWorkState::More;
     });
+  }
+  ThreadPool::get()->work(doWorkers);
+  for (auto& currUpdates : updates) {
+    for (auto& [index, bases] : currUpdates.compileUnitBases) {
+      locationUpdater.compileUnitBases[index] = bases;
+    }
+    for (auto& [offset, index] : currUpdates.locToUnitMap) {
+      locationUpdater.locToUnitMap[offset] = index;
+    }
+  }
 }
 
 static void updateRanges(llvm::DWARFYAML::Data& yaml,
@@ -37,6 +37,14 @@ bool useNewWATParser = false;
 
 #define DEBUG_TYPE "writer"
 
+ModuleReader::ModuleReader() { setDebugInfo(true); }
+
+ModuleReader::~ModuleReader() {}
+
+std::unique_ptr<LazyFunctionBodies> ModuleReader::takeLazyFunctionBodies() {
+  return std::move(lazyBodies);
+}
+
 static void readTextData(std::string& input, Module& wasm, IRProfile profile) {
   if (useNewWATParser) {
     std::string_view in(input.c_str());
@@ -57,33 +65,84 @@ void ModuleReader::readText(std::string filename, Module& wasm) {
   readTextData(input, wasm, profile);
 }
 
-void ModuleReader::readBinaryData(std::vector<char>& input,
+bool ModuleReader::useLazyBodies(const std::string& sourceMapFilename) const {
+  return lazyFunctionBodies && sourceMapFilename.empty() && !DWARF &&
+         !skipFunctionBodies;
+}
+
+void ModuleReader::readBinaryView(BufferView data,
                                   Module& wasm,
                                   std::string sourceMapFilename) {
   std::unique_ptr<std::ifstream> sourceMapStream;
   // Assume that the wasm has had its initial features applied, and use those
   // while parsing.
-  WasmBinaryBuilder parser(wasm, wasm.features, input);
+  WasmBinaryBuilder parser(wasm, wasm.features, data);
   parser.setDebugInfo(debugInfo);
   parser.setDWARF(DWARF);
   parser.setSkipFunctionBodies(skipFunctionBodies);
+  parser.setParallelBodies(parallelBodies);
+  if (lazyBodies) {
+    parser.setLazyBodies(lazyBodies.get());
+  }
+  if (onlySections) {
+    parser.setOnlySections(*onlySections);
+  }
+  std::optional<BinaryIndex> binaryIndex;
+  if (binaryIndexFile.size()) {
+    binaryIndex = BinaryIndex::read(binaryIndexFile);
+    if (binaryIndex->matches(data)) {
+      parser.setBinaryIndex(&*binaryIndex);
+    } else {
+      std::cerr << "warning: binary index " << binaryIndexFile
+                << " does not match the module, ignoring it\n";
+    }
+  }
   if (sourceMapFilename.size()) {
     sourceMapStream = make_unique<std::ifstream>();
     sourceMapStream->open(sourceMapFilename);
     parser.setDebugLocations(sourceMapStream.get());
   }
   parser.read();
+  if (lazyBodies) {
+    lazyBodies->finishReading(parser);
+  }
   if (sourceMapStream) {
     sourceMapStream->close();
   }
 }
 
+void ModuleReader::readBinaryData(std::vector<char>& input,
+                                  Module& wasm,
+                                  std::string sourceMapFilename) {
+  if (useLazyBodies(sourceMapFilename)) {
+    // In lazy mode the input must outlive this read, so hand it over to the
+    // LazyFunctionBodies object, which also materializes bodies later.
+    lazyBodies = std::make_unique<LazyFunctionBodies>(wasm, std::move(input));
+    readBinaryView(lazyBodies->getInput(), wasm, sourceMapFilename);
+  } else {
+    lazyBodies.reset();
+    readBinaryView(BufferView(input), wasm, sourceMapFilename);
+  }
+}
+
 void ModuleReader::readBinary(std::string filename,
                               Module& wasm,
                               std::string sourceMapFilename) {
   BYN_TRACE("reading binary from " << filename << "\n");
-  auto input(read_file<std::vector<char>>(filename, Flags::Binary));
-  readBinaryData(input, wasm, sourceMapFilename);
+  // Map the file rather than copying it into memory; the reader consumes the
+  // mapping zero-copy, and the OS can share and evict the pages. This matters
+  // for very large inputs, where a full copy doubles peak memory.
+  auto mapped = std::make_shared<MappedFile>(filename);
+  // The module shares ownership of the mapping, so that unrecognized custom
+  // sections can stay views into it rather than being copied out.
+  wasm.inputBinary = mapped;
+  if (useLazyBodies(sourceMapFilename)) {
+    lazyBodies = std::make_unique<LazyFunctionBodies>(wasm, mapped);
+    readBinaryView(lazyBodies->getInput(), wasm, sourceMapFilename);
+  } else {
+    lazyBodies.reset();
+    readBinaryView(mapped->get(), wasm, sourceMapFilename);
+  }
 }
 
 bool ModuleReader::isBinaryFile(std::string filename) {
@@ -163,7 +222,14 @@ void ModuleWriter::writeBinary(Module& wasm, Output& output) {
   if (symbolMap.size() > 0) {
     writer.setSymbolMap(symbolMap);
   }
+  writer.setParallelBodies(parallelBodies);
+  writer.setFast(fast);
+  // Stream sections out as they are finished, rather than building the whole
+  // module in memory first. (The writer ignores this if it must buffer, e.g.
+  // for a source map.)
+  writer.setSink(&output.getStream());
   writer.write();
+  // Write anything the writer did not stream (everything, with a source map).
   buffer.writeTo(output);
   if (sourceMapStream) {
     sourceMapStream->close();
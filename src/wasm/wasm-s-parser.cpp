@@ -18,6 +18,7 @@
 
 #include <cctype>
 #include <cmath>
+#include <cstring>
 #include <limits>
 
 #include "ir/branch-utils.h"
@@ -282,38 +283,38 @@ Element* SExpressionParser::parseString() {
   char* start = input;
   if (input[0] == '"') {
     // parse escaping \", but leave code escaped - we'll handle escaping in
-    // memory segments specifically
+    // memory segments specifically. that means the payload is exactly the
+    // input slice between the quotes, so we only need to find the closing
+    // quote, skipping over escapes in bulk.
     input++;
-    std::string str;
+    char* end = input;
     while (1) {
-      if (input[0] == 0) {
+      end += strcspn(end, "\"\\");
+      if (end[0] == 0) {
         throw ParseException("unterminated string", line, start - lineStart);
       }
-      if (input[0] == '"') {
+      if (end[0] == '"') {
         break;
       }
-      if (input[0] == '\\') {
-        str += input[0];
-        if (input[1] == 0) {
-          throw ParseException(
-            "unterminated string escape", line, start - lineStart);
-        }
-        str += input[1];
-        input += 2;
-        continue;
+      // an escape; skip both its characters
+      if (end[1] == 0) {
+        throw ParseException(
+          "unterminated string escape", line, start - lineStart);
       }
-      str += input[0];
-      input++;
-    }
-    input++;
-    return allocator.alloc<Element>()
-      ->setString(IString(str.c_str(), false), dollared, true)
-      ->setMetadata(line, start - lineStart, loc);
-  }
-  while (input[0] && !isspace(input[0]) && input[0] != ')' && input[0] != '(' &&
-         input[0] != ';') {
-    input++;
+      end += 2;
+    }
+    // temporarily terminate at the closing quote, so we can intern the slice
+    // directly rather than copying it out first
+    end[0] = 0;
+    auto ret = allocator.alloc<Element>()
+                 ->setString(IString(input, false), dollared, true)
+                 ->setMetadata(line, start - lineStart, loc);
+    end[0] = '"';
+    input = end + 1;
+    return ret;
   }
+  // the token runs until whitespace (the C locale space set) or punctuation
+  input += strcspn(input, " \t\n\v\f\r();");
   if (start == input) {
     throw ParseException("expected string", line, input - lineStart);
   }
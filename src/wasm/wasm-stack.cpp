@@ -39,6 +39,9 @@ void BinaryInstWriter::visitBlock(Block* curr) {
 }
 
 void BinaryInstWriter::visitIf(If* curr) {
+  if (func) {
+    parent.noteBranchHint(func, curr, o.size());
+  }
   // the binary format requires this; we have a block if we need one
   // TODO: optimize this in Stack IR (if child is a block, we may break to this
   // instead)
@@ -61,6 +64,9 @@ void BinaryInstWriter::visitLoop(Loop* curr) {
 }
 
 void BinaryInstWriter::visitBreak(Break* curr) {
+  if (func && curr->condition) {
+    parent.noteBranchHint(func, curr, o.size());
+  }
   o << int8_t(curr->condition ? BinaryConsts::BrIf : BinaryConsts::Br)
     << U32LEB(getBreakIndex(curr->name));
 }
@@ -2031,6 +2037,9 @@ void BinaryInstWriter::visitRefCast(RefCast* curr) {
 }
 
 void BinaryInstWriter::visitBrOn(BrOn* curr) {
+  if (func) {
+    parent.noteBranchHint(func, curr, o.size());
+  }
   switch (curr->op) {
     case BrOnNull:
       o << int8_t(BinaryConsts::BrOnNull);
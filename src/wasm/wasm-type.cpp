@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <map>
 #include <shared_mutex>
@@ -107,6 +108,12 @@ struct HeapTypeInfo {
   // In nominal or isorecursive mode, the supertype of this HeapType, if it
   // exists.
   HeapTypeInfo* supertype = nullptr;
+  // A lazily built table of the supertype chain, from the root supertype
+  // (index 0) down to this type itself, giving constant-time subtype checks
+  // by depth comparison. Only built for canonical types, whose supertypes can
+  // no longer change; atomic because concurrent subtype queries may race to
+  // build it. Not copied: a copy has its own identity and supertype.
+  std::atomic<std::vector<HeapTypeInfo*>*> ancestors{nullptr};
   // In isorecursive mode, the recursion group of this type or null if the
   // recursion group is trivial (i.e. contains only this type).
   RecGroupInfo* recGroup = nullptr;
@@ -333,8 +340,21 @@ struct RecGroupEquator {
 // wrapped group itself.
 struct RecGroupStructure {
   RecGroup group;
+
+  // The group's structural fingerprint. Computing it walks the whole group,
+  // so do that once up front; comparisons can then dismiss groups with
+  // different fingerprints without the deep structural walk, and rehashing
+  // the canonical set never re-walks the stored groups. This matters when a
+  // pipeline rebuilds thousands of identical groups, each of which hits the
+  // canonical set and returns the existing group.
+  size_t fingerprint;
+
+  RecGroupStructure(RecGroup group)
+    : group(group), fingerprint(RecGroupHasher{group}()) {}
+
   bool operator==(const RecGroupStructure& other) const {
-    return RecGroupEquator{group, other.group}();
+    return fingerprint == other.fingerprint &&
+           RecGroupEquator{group, other.group}();
   }
 };
 
@@ -346,7 +366,7 @@ namespace std {
 template<> class hash<wasm::RecGroupStructure> {
 public:
   size_t operator()(const wasm::RecGroupStructure& structure) const {
-    return wasm::RecGroupHasher{structure.group}();
+    return structure.fingerprint;
   }
 };
 
@@ -679,6 +699,7 @@ HeapTypeInfo::HeapTypeInfo(const HeapTypeInfo& other) {
 }
 
 HeapTypeInfo::~HeapTypeInfo() {
+  delete ancestors.load();
   switch (kind) {
     case BasicKind:
       return;
@@ -715,13 +736,23 @@ bool HeapTypeInfo::operator==(const HeapTypeInfo& other) const {
 }
 
 template<typename Info> struct Store {
-  std::recursive_mutex mutex;
+  // The store is sharded by the hash of the type structure, so that threads
+  // canonicalizing unrelated types take different locks. A given Info always
+  // maps to the same shard, so a lookup there observes every prior insertion
+  // of that structure.
+  static constexpr size_t NumShards = 16;
+
+  struct Shard {
+    std::recursive_mutex mutex;
+
+    // Track unique_ptrs for constructed types to avoid leaks.
+    std::vector<std::unique_ptr<Info>> constructedTypes;
 
-  // Track unique_ptrs for constructed types to avoid leaks.
-  std::vector<std::unique_ptr<Info>> constructedTypes;
+    // Maps from constructed types to their canonical Type IDs.
+    std::unordered_map<std::reference_wrapper<const Info>, uintptr_t> typeIDs;
+  };
 
-  // Maps from constructed types to their canonical Type IDs.
-  std::unordered_map<std::reference_wrapper<const Info>, uintptr_t> typeIDs;
+  std::array<Shard, NumShards> shards;
 
 #ifndef NDEBUG
   bool isGlobalStore();
@@ -733,9 +764,40 @@ template<typename Info> struct Store {
   }
   bool hasCanonical(const Info& info, typename Info::type_t& canonical);
 
+  // Acquire every shard's lock, for callers that must keep the whole store
+  // unobservable while they insert a batch of types; see TypeBuilder
+  // canonicalization. Inserting while the locks are held is fine, as the
+  // mutexes are recursive.
+  std::vector<std::unique_lock<std::recursive_mutex>> lockAll() {
+    std::vector<std::unique_lock<std::recursive_mutex>> locks;
+    locks.reserve(NumShards);
+    for (auto& shard : shards) {
+      locks.emplace_back(shard.mutex);
+    }
+    return locks;
+  }
+
   void clear() {
-    typeIDs.clear();
-    constructedTypes.clear();
+    for (auto& shard : shards) {
+      shard.typeIDs.clear();
+      shard.constructedTypes.clear();
+    }
+  }
+
+  // The number of canonical types in the store and an estimate of the bytes
+  // they retain, for memory reports. Takes each shard's lock.
+  std::pair<size_t, size_t> getMemory() {
+    size_t count = 0;
+    size_t bytes = 0;
+    using Entry = std::pair<std::reference_wrapper<const Info>, uintptr_t>;
+    for (auto& shard : shards) {
+      std::lock_guard<std::recursive_mutex> lock(shard.mutex);
+      count += shard.constructedTypes.size();
+      bytes += shard.constructedTypes.size() *
+               (sizeof(Info) + sizeof(std::unique_ptr<Info>));
+      bytes += shard.typeIDs.size() * (sizeof(Entry) + sizeof(void*));
+    }
+    return {count, bytes};
   }
 
 private:
@@ -757,21 +819,24 @@ private:
       }
     };
 
+    // Turn e.g. (ref null any) into anyref.
+    if (auto canonical = info.getCanonical()) {
+      return *canonical;
+    }
+
+    auto& shard = shards[std::hash<Info>{}(info) % NumShards];
+
     auto insertNew = [&]() {
       assert((!isGlobalStore() || !info.isTemp) && "Leaking temporary type!");
       auto ptr = getPtr();
       TypeID id = uintptr_t(ptr.get());
       assert(id > Info::type_t::_last_basic_type);
-      typeIDs.insert({*ptr, id});
-      constructedTypes.emplace_back(std::move(ptr));
+      shard.typeIDs.insert({*ptr, id});
+      shard.constructedTypes.emplace_back(std::move(ptr));
       return typename Info::type_t(id);
     };
 
-    // Turn e.g. (ref null any) into anyref.
-    if (auto canonical = info.getCanonical()) {
-      return *canonical;
-    }
-    std::lock_guard<std::recursive_mutex> lock(mutex);
+    std::lock_guard<std::recursive_mutex> lock(shard.mutex);
     // Nominal HeapTypes are always unique, so don't bother deduplicating them.
     if constexpr (std::is_same_v<Info, HeapTypeInfo>) {
       if (typeSystem == TypeSystem::Nominal) {
@@ -779,8 +844,8 @@ private:
       }
     }
     // Check whether we already have a type for this structural Info.
-    auto indexIt = typeIDs.find(std::cref(info));
-    if (indexIt != typeIDs.end()) {
+    auto indexIt = shard.typeIDs.find(std::cref(info));
+    if (indexIt != shard.typeIDs.end()) {
       return typename Info::type_t(indexIt->second);
     }
     // We do not have a type for this Info already. Create one.
@@ -903,6 +968,14 @@ void destroyAllTypesForTestingPurposesOnly() {
   globalRecGroupStore.clear();
 }
 
+TypeSystemMemory getTypeSystemMemory() {
+  TypeSystemMemory ret;
+  std::tie(ret.types, ret.typeBytes) = globalTypeStore.getMemory();
+  std::tie(ret.heapTypes, ret.heapTypeBytes) =
+    globalHeapTypeStore.getMemory();
+  return ret;
+}
+
 Type::Type(std::initializer_list<Type> types) : Type(Tuple(types)) {}
 
 Type::Type(const Tuple& tuple) {
@@ -1389,6 +1462,29 @@ size_t HeapType::getDepth() const {
   return depth;
 }
 
+// Get the lazily built ancestor table for a canonical type: the supertype
+// chain from the root supertype (index 0) down to the type itself. The
+// supertype's table is a prefix of this one, so build it by extending the
+// supertype's. Threads may race to build a table; the loser's copy is
+// discarded.
+static const std::vector<HeapTypeInfo*>& getAncestorTable(HeapTypeInfo* info) {
+  assert(!info->isTemp);
+  if (auto* table = info->ancestors.load(std::memory_order_acquire)) {
+    return *table;
+  }
+  auto table = std::make_unique<std::vector<HeapTypeInfo*>>();
+  if (info->supertype) {
+    *table = getAncestorTable(info->supertype);
+  }
+  table->push_back(info);
+  std::vector<HeapTypeInfo*>* expected = nullptr;
+  if (info->ancestors.compare_exchange_strong(
+        expected, table.get(), std::memory_order_acq_rel)) {
+    return *table.release();
+  }
+  return *expected;
+}
+
 bool HeapType::isSubType(HeapType left, HeapType right) {
   // As an optimization, in the common case do not even construct a SubTyper.
   if (left == right) {
@@ -1431,6 +1527,23 @@ HeapType HeapType::getLeastUpperBound(HeapType a, HeapType b) {
                                getBasicHeapSupertype(b));
   }
 
+  if (!infoA->isTemp && !infoB->isTemp) {
+    // Canonical types have fixed supertype chains, so use the ancestor
+    // tables: the LUB is the deepest entry the two chains share.
+    auto& ancestorsA = getAncestorTable(infoA);
+    auto& ancestorsB = getAncestorTable(infoB);
+    auto depth = std::min(ancestorsA.size(), ancestorsB.size());
+    while (depth > 0 && ancestorsA[depth - 1] != ancestorsB[depth - 1]) {
+      --depth;
+    }
+    if (depth == 0) {
+      // Did not find a LUB in the subtype tree.
+      return getBasicHeapTypeLUB(getBasicHeapSupertype(a),
+                                 getBasicHeapSupertype(b));
+    }
+    return HeapType(uintptr_t(ancestorsA[depth - 1]));
+  }
+
   // Walk up the subtype tree to find the LUB. Ascend the tree from both `a`
   // and `b` in lockstep. The first type we see for a second time must be the
   // LUB because there are no cycles and the only way to encounter a type
@@ -1640,11 +1753,23 @@ bool SubTyper::isSubType(HeapType a, HeapType b) {
   if (typeSystem == TypeSystem::Nominal ||
       typeSystem == TypeSystem::Isorecursive) {
     // Subtyping must be declared in a nominal system, not derived from
-    // structure, so we will not recurse. TODO: optimize this search with some
-    // form of caching.
-    HeapTypeInfo* curr = getHeapTypeInfo(a);
+    // structure, so we will not recurse.
+    HeapTypeInfo* aInfo = getHeapTypeInfo(a);
+    HeapTypeInfo* bInfo = getHeapTypeInfo(b);
+    if (!aInfo->isTemp && !bInfo->isTemp) {
+      // Canonical types have fixed supertype chains, so use the ancestor
+      // tables: a is a (strict) subtype of b iff b appears in a's chain at
+      // b's own depth.
+      auto& aAncestors = getAncestorTable(aInfo);
+      auto& bAncestors = getAncestorTable(bInfo);
+      auto bDepth = bAncestors.size() - 1;
+      return bDepth < aAncestors.size() - 1 && aAncestors[bDepth] == bInfo;
+    }
+    // Types still being built may have their supertypes changed, so walk the
+    // chain.
+    HeapTypeInfo* curr = aInfo;
     while ((curr = curr->supertype)) {
-      if (curr == getHeapTypeInfo(b)) {
+      if (curr == bInfo) {
         return true;
       }
     }
@@ -3463,7 +3588,7 @@ void globallyCanonicalize(CanonicalizationState& state) {
   // same shape as one being canonicalized here. This cannot happen with Types
   // because they are hashed in the global store by pointer identity, which has
   // not yet escaped the builder, rather than shape.
-  std::lock_guard<std::recursive_mutex> lock(globalHeapTypeStore.mutex);
+  auto storeLocks = globalHeapTypeStore.lockAll();
   std::unordered_map<HeapType, HeapType> canonicalHeapTypes;
   for (auto& info : state.newInfos) {
     HeapType original = asHeapType(info);
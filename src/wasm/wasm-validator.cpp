@@ -65,19 +65,37 @@ struct ValidationInfo {
 
   // a stream of error test for each function. we print in the right order at
   // the end, for deterministic output
-  // note errors are rare/unexpected, so it's ok to use a slow mutex here
-  std::mutex mutex;
+  // this map is pre-populated for every function in the module (plus nullptr
+  // for module-level errors) and is immutable afterwards, so the parallel
+  // function validators can look up their streams without a lock. a stream
+  // for anything else - like a function not in the module - goes in
+  // extraOutputs, under the lock; such streams are rare.
   std::unordered_map<Function*, std::unique_ptr<std::ostringstream>> outputs;
+  std::mutex mutex;
+  std::unordered_map<Function*, std::unique_ptr<std::ostringstream>>
+    extraOutputs;
 
-  ValidationInfo(Module& wasm) : wasm(wasm) { valid.store(true); }
+  ValidationInfo(Module& wasm) : wasm(wasm) {
+    valid.store(true);
+    for (auto& func : wasm.functions) {
+      outputs[func.get()] = make_unique<std::ostringstream>();
+    }
+    outputs[nullptr] = make_unique<std::ostringstream>();
+  }
 
   std::ostringstream& getStream(Function* func) {
-    std::unique_lock<std::mutex> lock(mutex);
+    // the common case: a function in the module, or module-level (nullptr).
+    // outputs is immutable after construction, so no lock is needed.
     auto iter = outputs.find(func);
     if (iter != outputs.end()) {
       return *(iter->second.get());
     }
-    auto& ret = outputs[func] = make_unique<std::ostringstream>();
+    std::unique_lock<std::mutex> lock(mutex);
+    auto extraIter = extraOutputs.find(func);
+    if (extraIter != extraOutputs.end()) {
+      return *(extraIter->second.get());
+    }
+    auto& ret = extraOutputs[func] = make_unique<std::ostringstream>();
     return *ret.get();
   }
 
@@ -213,13 +231,24 @@ struct FunctionValidator : public WalkerPass<PostWalker<FunctionValidator>> {
 
   ValidationInfo& info;
 
-  FunctionValidator(Module& wasm, ValidationInfo* info) : info(*info) {
+  // The module's feature set, cached here so that the many per-node feature
+  // checks below read a member instead of chasing through getModule(). (A
+  // compile-time FeatureSet, like a template parameter, is not possible: the
+  // set is a runtime bitmask, and instantiating per combination would not
+  // scale.)
+  FeatureSet features;
+
+  FunctionValidator(Module& wasm, ValidationInfo* info)
+    : info(*info), features(wasm.features) {
     setModule(&wasm);
   }
 
   // Validate the entire module.
   void validate(PassRunner* runner) { run(runner, getModule()); }
 
+  // Validate a specific function.
+  void validate(Function* func) { walkFunctionInModule(func, getModule()); }
+
   // Validate a specific expression.
   void validate(Expression* curr) { walk(curr); }
 
@@ -438,7 +467,7 @@ private:
   void validateMemBytes(uint8_t bytes, Type type, Expression* curr);
 
   template<typename T> void validateReturnCall(T* curr) {
-    shouldBeTrue(!curr->isReturn || getModule()->features.hasTailCall(),
+    shouldBeTrue(!curr->isReturn || features.hasTailCall(),
                  curr,
                  "return_call* requires tail calls to be enabled");
   }
@@ -533,7 +562,7 @@ void FunctionValidator::validatePoppyExpression(Expression* curr) {
 }
 
 void FunctionValidator::visitBlock(Block* curr) {
-  if (!getModule()->features.hasMultivalue()) {
+  if (!features.hasMultivalue()) {
     shouldBeTrue(!curr->type.isTuple(),
                  curr,
                  "Multivalue block type (multivalue is not enabled)");
@@ -819,7 +848,7 @@ void FunctionValidator::visitCallIndirect(CallIndirect* curr) {
 }
 
 void FunctionValidator::visitConst(Const* curr) {
-  shouldBeTrue(curr->type.getFeatures() <= getModule()->features,
+  shouldBeTrue(curr->type.getFeatures() <= features,
                curr,
                "all used features should be allowed");
 }
@@ -887,7 +916,7 @@ void FunctionValidator::visitLoad(Load* curr) {
   shouldBeTrue(
     getModule()->memory.exists, curr, "Memory operations require a memory");
   if (curr->isAtomic) {
-    shouldBeTrue(getModule()->features.hasAtomics(),
+    shouldBeTrue(features.hasAtomics(),
                  curr,
                  "Atomic operation (atomics are disabled)");
     shouldBeTrue(curr->type == Type::i32 || curr->type == Type::i64 ||
@@ -896,7 +925,7 @@ void FunctionValidator::visitLoad(Load* curr) {
                  "Atomic load should be i32 or i64");
   }
   if (curr->type == Type::v128) {
-    shouldBeTrue(getModule()->features.hasSIMD(),
+    shouldBeTrue(features.hasSIMD(),
                  curr,
                  "SIMD operation (SIMD is disabled)");
   }
@@ -918,7 +947,7 @@ void FunctionValidator::visitStore(Store* curr) {
   shouldBeTrue(
     getModule()->memory.exists, curr, "Memory operations require a memory");
   if (curr->isAtomic) {
-    shouldBeTrue(getModule()->features.hasAtomics(),
+    shouldBeTrue(features.hasAtomics(),
                  curr,
                  "Atomic operation (atomics are disabled)");
     shouldBeTrue(curr->valueType == Type::i32 || curr->valueType == Type::i64 ||
@@ -927,7 +956,7 @@ void FunctionValidator::visitStore(Store* curr) {
                  "Atomic store should be i32 or i64");
   }
   if (curr->valueType == Type::v128) {
-    shouldBeTrue(getModule()->features.hasSIMD(),
+    shouldBeTrue(features.hasSIMD(),
                  curr,
                  "SIMD operation (SIMD is disabled)");
   }
@@ -954,7 +983,7 @@ void FunctionValidator::visitStore(Store* curr) {
 void FunctionValidator::visitAtomicRMW(AtomicRMW* curr) {
   shouldBeTrue(
     getModule()->memory.exists, curr, "Memory operations require a memory");
-  shouldBeTrue(getModule()->features.hasAtomics(),
+  shouldBeTrue(features.hasAtomics(),
                curr,
                "Atomic operation (atomics are disabled)");
   validateMemBytes(curr->bytes, curr->type, curr);
@@ -974,7 +1003,7 @@ void FunctionValidator::visitAtomicRMW(AtomicRMW* curr) {
 void FunctionValidator::visitAtomicCmpxchg(AtomicCmpxchg* curr) {
   shouldBeTrue(
     getModule()->memory.exists, curr, "Memory operations require a memory");
-  shouldBeTrue(getModule()->features.hasAtomics(),
+  shouldBeTrue(features.hasAtomics(),
                curr,
                "Atomic operation (atomics are disabled)");
   validateMemBytes(curr->bytes, curr->type, curr);
@@ -1007,7 +1036,7 @@ void FunctionValidator::visitAtomicCmpxchg(AtomicCmpxchg* curr) {
 void FunctionValidator::visitAtomicWait(AtomicWait* curr) {
   shouldBeTrue(
     getModule()->memory.exists, curr, "Memory operations require a memory");
-  shouldBeTrue(getModule()->features.hasAtomics(),
+  shouldBeTrue(features.hasAtomics(),
                curr,
                "Atomic operation (atomics are disabled)");
   shouldBeEqualOrFirstIsUnreachable(
@@ -1033,7 +1062,7 @@ void FunctionValidator::visitAtomicWait(AtomicWait* curr) {
 void FunctionValidator::visitAtomicNotify(AtomicNotify* curr) {
   shouldBeTrue(
     getModule()->memory.exists, curr, "Memory operations require a memory");
-  shouldBeTrue(getModule()->features.hasAtomics(),
+  shouldBeTrue(features.hasAtomics(),
                curr,
                "Atomic operation (atomics are disabled)");
   shouldBeEqualOrFirstIsUnreachable(
@@ -1053,7 +1082,7 @@ void FunctionValidator::visitAtomicNotify(AtomicNotify* curr) {
 void FunctionValidator::visitAtomicFence(AtomicFence* curr) {
   shouldBeTrue(
     getModule()->memory.exists, curr, "Memory operations require a memory");
-  shouldBeTrue(getModule()->features.hasAtomics(),
+  shouldBeTrue(features.hasAtomics(),
                curr,
                "Atomic operation (atomics are disabled)");
   shouldBeTrue(curr->order == 0,
@@ -1064,7 +1093,7 @@ void FunctionValidator::visitAtomicFence(AtomicFence* curr) {
 
 void FunctionValidator::visitSIMDExtract(SIMDExtract* curr) {
   shouldBeTrue(
-    getModule()->features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
+    features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
   shouldBeEqualOrFirstIsUnreachable(curr->vec->type,
                                     Type(Type::v128),
                                     curr,
@@ -1109,7 +1138,7 @@ void FunctionValidator::visitSIMDExtract(SIMDExtract* curr) {
 
 void FunctionValidator::visitSIMDReplace(SIMDReplace* curr) {
   shouldBeTrue(
-    getModule()->features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
+    features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
   shouldBeEqualOrFirstIsUnreachable(
     curr->type, Type(Type::v128), curr, "replace_lane must have type v128");
   shouldBeEqualOrFirstIsUnreachable(curr->vec->type,
@@ -1151,7 +1180,7 @@ void FunctionValidator::visitSIMDReplace(SIMDReplace* curr) {
 
 void FunctionValidator::visitSIMDShuffle(SIMDShuffle* curr) {
   shouldBeTrue(
-    getModule()->features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
+    features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
   shouldBeEqualOrFirstIsUnreachable(
     curr->type, Type(Type::v128), curr, "i8x16.shuffle must have type v128");
   shouldBeEqualOrFirstIsUnreachable(
@@ -1165,7 +1194,7 @@ void FunctionValidator::visitSIMDShuffle(SIMDShuffle* curr) {
 
 void FunctionValidator::visitSIMDTernary(SIMDTernary* curr) {
   shouldBeTrue(
-    getModule()->features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
+    features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
   shouldBeEqualOrFirstIsUnreachable(
     curr->type, Type(Type::v128), curr, "SIMD ternary must have type v128");
   shouldBeEqualOrFirstIsUnreachable(
@@ -1178,7 +1207,7 @@ void FunctionValidator::visitSIMDTernary(SIMDTernary* curr) {
 
 void FunctionValidator::visitSIMDShift(SIMDShift* curr) {
   shouldBeTrue(
-    getModule()->features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
+    features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
   shouldBeEqualOrFirstIsUnreachable(
     curr->type, Type(Type::v128), curr, "vector shift must have type v128");
   shouldBeEqualOrFirstIsUnreachable(
@@ -1193,7 +1222,7 @@ void FunctionValidator::visitSIMDLoad(SIMDLoad* curr) {
   shouldBeTrue(
     getModule()->memory.exists, curr, "Memory operations require a memory");
   shouldBeTrue(
-    getModule()->features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
+    features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
   shouldBeEqualOrFirstIsUnreachable(
     curr->type, Type(Type::v128), curr, "load_splat must have type v128");
   shouldBeEqualOrFirstIsUnreachable(
@@ -1228,7 +1257,7 @@ void FunctionValidator::visitSIMDLoadStoreLane(SIMDLoadStoreLane* curr) {
   shouldBeTrue(
     getModule()->memory.exists, curr, "Memory operations require a memory");
   shouldBeTrue(
-    getModule()->features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
+    features.hasSIMD(), curr, "SIMD operation (SIMD is disabled)");
   if (curr->isLoad()) {
     shouldBeEqualOrFirstIsUnreachable(
       curr->type, Type(Type::v128), curr, "loadX_lane must have type v128");
@@ -1278,7 +1307,7 @@ void FunctionValidator::visitSIMDLoadStoreLane(SIMDLoadStoreLane* curr) {
 }
 
 void FunctionValidator::visitMemoryInit(MemoryInit* curr) {
-  shouldBeTrue(getModule()->features.hasBulkMemory(),
+  shouldBeTrue(features.hasBulkMemory(),
                curr,
                "Bulk memory operation (bulk memory is disabled)");
   shouldBeEqualOrFirstIsUnreachable(
@@ -1305,7 +1334,7 @@ void FunctionValidator::visitMemoryInit(MemoryInit* curr) {
 }
 
 void FunctionValidator::visitDataDrop(DataDrop* curr) {
-  shouldBeTrue(getModule()->features.hasBulkMemory(),
+  shouldBeTrue(features.hasBulkMemory(),
                curr,
                "Bulk memory operation (bulk memory is disabled)");
   shouldBeEqualOrFirstIsUnreachable(
@@ -1321,7 +1350,7 @@ void FunctionValidator::visitDataDrop(DataDrop* curr) {
 }
 
 void FunctionValidator::visitMemoryCopy(MemoryCopy* curr) {
-  shouldBeTrue(getModule()->features.hasBulkMemory(),
+  shouldBeTrue(features.hasBulkMemory(),
                curr,
                "Bulk memory operation (bulk memory is disabled)");
   shouldBeEqualOrFirstIsUnreachable(
@@ -1346,7 +1375,7 @@ void FunctionValidator::visitMemoryCopy(MemoryCopy* curr) {
 }
 
 void FunctionValidator::visitMemoryFill(MemoryFill* curr) {
-  shouldBeTrue(getModule()->features.hasBulkMemory(),
+  shouldBeTrue(features.hasBulkMemory(),
                curr,
                "Bulk memory operation (bulk memory is disabled)");
   shouldBeEqualOrFirstIsUnreachable(
@@ -1639,7 +1668,7 @@ void FunctionValidator::visitBinary(Binary* curr) {
     case InvalidBinary:
       WASM_UNREACHABLE("invliad binary op");
   }
-  shouldBeTrue(Features::get(curr->op) <= getModule()->features,
+  shouldBeTrue(Features::get(curr->op) <= features,
                curr,
                "all used features should be allowed");
 }
@@ -1926,7 +1955,7 @@ void FunctionValidator::visitUnary(Unary* curr) {
     case InvalidUnary:
       WASM_UNREACHABLE("invalid unary op");
   }
-  shouldBeTrue(Features::get(curr->op) <= getModule()->features,
+  shouldBeTrue(Features::get(curr->op) <= features,
                curr,
                "all used features should be allowed");
 }
@@ -1987,20 +2016,20 @@ void FunctionValidator::visitRefNull(RefNull* curr) {
   // If we are not in a function, this is a global location like a table. We
   // allow RefNull there as we represent tables that way regardless of what
   // features are enabled.
-  shouldBeTrue(!getFunction() || getModule()->features.hasReferenceTypes(),
+  shouldBeTrue(!getFunction() || features.hasReferenceTypes(),
                curr,
                "ref.null requires reference-types to be enabled");
   shouldBeTrue(
     curr->type.isNullable(), curr, "ref.null types must be nullable");
 
   // The type of the null must also be valid for the features.
-  shouldBeTrue(curr->type.getFeatures() <= getModule()->features,
+  shouldBeTrue(curr->type.getFeatures() <= features,
                curr->type,
                "ref.null type should be allowed");
 }
 
 void FunctionValidator::visitRefIs(RefIs* curr) {
-  shouldBeTrue(getModule()->features.hasReferenceTypes(),
+  shouldBeTrue(features.hasReferenceTypes(),
                curr,
                "ref.is_* requires reference-types to be enabled");
   shouldBeTrue(curr->value->type == Type::unreachable ||
@@ -2013,7 +2042,7 @@ void FunctionValidator::visitRefFunc(RefFunc* curr) {
   // If we are not in a function, this is a global location like a table. We
   // allow RefFunc there as we represent tables that way regardless of what
   // features are enabled.
-  shouldBeTrue(!getFunction() || getModule()->features.hasReferenceTypes(),
+  shouldBeTrue(!getFunction() || features.hasReferenceTypes(),
                curr,
                "ref.func requires reference-types to be enabled");
   if (!info.validateGlobally) {
@@ -2039,7 +2068,7 @@ void FunctionValidator::visitRefFunc(RefFunc* curr) {
 void FunctionValidator::visitRefEq(RefEq* curr) {
   Type eqref = Type(HeapType::eq, Nullable);
   shouldBeTrue(
-    getModule()->features.hasGC(), curr, "ref.eq requires gc to be enabled");
+    features.hasGC(), curr, "ref.eq requires gc to be enabled");
   shouldBeSubType(curr->left->type,
                   eqref,
                   curr->left,
@@ -2051,7 +2080,7 @@ void FunctionValidator::visitRefEq(RefEq* curr) {
 }
 
 void FunctionValidator::visitTableGet(TableGet* curr) {
-  shouldBeTrue(getModule()->features.hasReferenceTypes(),
+  shouldBeTrue(features.hasReferenceTypes(),
                curr,
                "table.get requires reference types to be enabled");
   shouldBeEqualOrFirstIsUnreachable(
@@ -2065,7 +2094,7 @@ void FunctionValidator::visitTableGet(TableGet* curr) {
 }
 
 void FunctionValidator::visitTableSet(TableSet* curr) {
-  shouldBeTrue(getModule()->features.hasReferenceTypes(),
+  shouldBeTrue(features.hasReferenceTypes(),
                curr,
                "table.set requires reference types to be enabled");
   shouldBeEqualOrFirstIsUnreachable(
@@ -2081,7 +2110,7 @@ void FunctionValidator::visitTableSet(TableSet* curr) {
 }
 
 void FunctionValidator::visitTableSize(TableSize* curr) {
-  shouldBeTrue(getModule()->features.hasReferenceTypes(),
+  shouldBeTrue(features.hasReferenceTypes(),
                curr,
                "table.size requires reference types to be enabled");
   auto* table = getModule()->getTableOrNull(curr->table);
@@ -2089,7 +2118,7 @@ void FunctionValidator::visitTableSize(TableSize* curr) {
 }
 
 void FunctionValidator::visitTableGrow(TableGrow* curr) {
-  shouldBeTrue(getModule()->features.hasReferenceTypes(),
+  shouldBeTrue(features.hasReferenceTypes(),
                curr,
                "table.grow requires reference types to be enabled");
   auto* table = getModule()->getTableOrNull(curr->table);
@@ -2121,7 +2150,7 @@ void FunctionValidator::noteRethrow(Name name, Expression* curr) {
 }
 
 void FunctionValidator::visitTry(Try* curr) {
-  shouldBeTrue(getModule()->features.hasExceptionHandling(),
+  shouldBeTrue(features.hasExceptionHandling(),
                curr,
                "try requires exception-handling to be enabled");
   if (curr->name.is()) {
@@ -2208,7 +2237,7 @@ void FunctionValidator::visitTry(Try* curr) {
 }
 
 void FunctionValidator::visitThrow(Throw* curr) {
-  shouldBeTrue(getModule()->features.hasExceptionHandling(),
+  shouldBeTrue(features.hasExceptionHandling(),
                curr,
                "throw requires exception-handling to be enabled");
   shouldBeEqual(curr->type,
@@ -2241,7 +2270,7 @@ void FunctionValidator::visitThrow(Throw* curr) {
 }
 
 void FunctionValidator::visitRethrow(Rethrow* curr) {
-  shouldBeTrue(getModule()->features.hasExceptionHandling(),
+  shouldBeTrue(features.hasExceptionHandling(),
                curr,
                "rethrow requires exception-handling to be enabled");
   shouldBeEqual(curr->type,
@@ -2252,7 +2281,7 @@ void FunctionValidator::visitRethrow(Rethrow* curr) {
 }
 
 void FunctionValidator::visitTupleMake(TupleMake* curr) {
-  shouldBeTrue(getModule()->features.hasMultivalue(),
+  shouldBeTrue(features.hasMultivalue(),
                curr,
                "Tuples are not allowed unless multivalue is enabled");
   shouldBeTrue(
@@ -2275,7 +2304,7 @@ void FunctionValidator::visitTupleMake(TupleMake* curr) {
 }
 
 void FunctionValidator::visitTupleExtract(TupleExtract* curr) {
-  shouldBeTrue(getModule()->features.hasMultivalue(),
+  shouldBeTrue(features.hasMultivalue(),
                curr,
                "Tuples are not allowed unless multivalue is enabled");
   if (curr->tuple->type == Type::unreachable) {
@@ -2298,7 +2327,7 @@ void FunctionValidator::visitTupleExtract(TupleExtract* curr) {
 
 void FunctionValidator::visitCallRef(CallRef* curr) {
   validateReturnCall(curr);
-  shouldBeTrue(getModule()->features.hasTypedFunctionReferences(),
+  shouldBeTrue(features.hasTypedFunctionReferences(),
                curr,
                "call_ref requires typed-function-references to be enabled");
   if (curr->target->type != Type::unreachable) {
@@ -2312,7 +2341,7 @@ void FunctionValidator::visitCallRef(CallRef* curr) {
 
 void FunctionValidator::visitI31New(I31New* curr) {
   shouldBeTrue(
-    getModule()->features.hasGC(), curr, "i31.new requires gc to be enabled");
+    features.hasGC(), curr, "i31.new requires gc to be enabled");
   shouldBeSubType(curr->value->type,
                   Type::i32,
                   curr->value,
@@ -2320,7 +2349,7 @@ void FunctionValidator::visitI31New(I31New* curr) {
 }
 
 void FunctionValidator::visitI31Get(I31Get* curr) {
-  shouldBeTrue(getModule()->features.hasGC(),
+  shouldBeTrue(features.hasGC(),
                curr,
                "i31.get_s/u requires gc to be enabled");
   shouldBeSubType(curr->i31->type,
@@ -2331,7 +2360,7 @@ void FunctionValidator::visitI31Get(I31Get* curr) {
 
 void FunctionValidator::visitRefTest(RefTest* curr) {
   shouldBeTrue(
-    getModule()->features.hasGC(), curr, "ref.test requires gc to be enabled");
+    features.hasGC(), curr, "ref.test requires gc to be enabled");
   if (curr->ref->type != Type::unreachable) {
     shouldBeTrue(
       curr->ref->type.isRef(), curr, "ref.test ref must have ref type");
@@ -2346,7 +2375,7 @@ void FunctionValidator::visitRefTest(RefTest* curr) {
 
 void FunctionValidator::visitRefCast(RefCast* curr) {
   shouldBeTrue(
-    getModule()->features.hasGC(), curr, "ref.cast requires gc to be enabled");
+    features.hasGC(), curr, "ref.cast requires gc to be enabled");
   if (curr->ref->type != Type::unreachable) {
     shouldBeTrue(
       curr->ref->type.isRef(), curr, "ref.cast ref must have ref type");
@@ -2360,7 +2389,7 @@ void FunctionValidator::visitRefCast(RefCast* curr) {
 }
 
 void FunctionValidator::visitBrOn(BrOn* curr) {
-  shouldBeTrue(getModule()->features.hasGC(),
+  shouldBeTrue(features.hasGC(),
                curr,
                "br_on_cast requires gc to be enabled");
   if (curr->ref->type != Type::unreachable) {
@@ -2385,7 +2414,7 @@ void FunctionValidator::visitBrOn(BrOn* curr) {
 }
 
 void FunctionValidator::visitStructNew(StructNew* curr) {
-  shouldBeTrue(getModule()->features.hasGC(),
+  shouldBeTrue(features.hasGC(),
                curr,
                "struct.new requires gc to be enabled");
   if (curr->type == Type::unreachable) {
@@ -2424,7 +2453,7 @@ void FunctionValidator::visitStructNew(StructNew* curr) {
 }
 
 void FunctionValidator::visitStructGet(StructGet* curr) {
-  shouldBeTrue(getModule()->features.hasGC(),
+  shouldBeTrue(features.hasGC(),
                curr,
                "struct.get requires gc to be enabled");
   if (curr->ref->type == Type::unreachable) {
@@ -2451,7 +2480,7 @@ void FunctionValidator::visitStructGet(StructGet* curr) {
 }
 
 void FunctionValidator::visitStructSet(StructSet* curr) {
-  shouldBeTrue(getModule()->features.hasGC(),
+  shouldBeTrue(features.hasGC(),
                curr,
                "struct.set requires gc to be enabled");
   if (curr->ref->type == Type::unreachable) {
@@ -2477,7 +2506,7 @@ void FunctionValidator::visitStructSet(StructSet* curr) {
 
 void FunctionValidator::visitArrayNew(ArrayNew* curr) {
   shouldBeTrue(
-    getModule()->features.hasGC(), curr, "array.new requires gc to be enabled");
+    features.hasGC(), curr, "array.new requires gc to be enabled");
   shouldBeEqualOrFirstIsUnreachable(
     curr->size->type, Type(Type::i32), curr, "array.new size must be an i32");
   if (curr->type == Type::unreachable) {
@@ -2507,7 +2536,7 @@ void FunctionValidator::visitArrayNew(ArrayNew* curr) {
 }
 
 void FunctionValidator::visitArrayInit(ArrayInit* curr) {
-  shouldBeTrue(getModule()->features.hasGC(),
+  shouldBeTrue(features.hasGC(),
                curr,
                "array.init requires gc to be enabled");
   if (curr->type == Type::unreachable) {
@@ -2529,7 +2558,7 @@ void FunctionValidator::visitArrayInit(ArrayInit* curr) {
 
 void FunctionValidator::visitArrayGet(ArrayGet* curr) {
   shouldBeTrue(
-    getModule()->features.hasGC(), curr, "array.get requires gc to be enabled");
+    features.hasGC(), curr, "array.get requires gc to be enabled");
   shouldBeEqualOrFirstIsUnreachable(
     curr->index->type, Type(Type::i32), curr, "array.get index must be an i32");
   if (curr->type == Type::unreachable) {
@@ -2547,7 +2576,7 @@ void FunctionValidator::visitArrayGet(ArrayGet* curr) {
 
 void FunctionValidator::visitArraySet(ArraySet* curr) {
   shouldBeTrue(
-    getModule()->features.hasGC(), curr, "array.set requires gc to be enabled");
+    features.hasGC(), curr, "array.set requires gc to be enabled");
   shouldBeEqualOrFirstIsUnreachable(
     curr->index->type, Type(Type::i32), curr, "array.set index must be an i32");
   if (curr->type == Type::unreachable) {
@@ -2563,13 +2592,13 @@ void FunctionValidator::visitArraySet(ArraySet* curr) {
 
 void FunctionValidator::visitArrayLen(ArrayLen* curr) {
   shouldBeTrue(
-    getModule()->features.hasGC(), curr, "array.len requires gc to be enabled");
+    features.hasGC(), curr, "array.len requires gc to be enabled");
   shouldBeEqualOrFirstIsUnreachable(
     curr->type, Type(Type::i32), curr, "array.len result must be an i32");
 }
 
 void FunctionValidator::visitArrayCopy(ArrayCopy* curr) {
-  shouldBeTrue(getModule()->features.hasGC(),
+  shouldBeTrue(features.hasGC(),
                curr,
                "array.copy requires gc to be enabled");
   shouldBeEqualOrFirstIsUnreachable(curr->srcIndex->type,
@@ -2595,25 +2624,25 @@ void FunctionValidator::visitArrayCopy(ArrayCopy* curr) {
 
 void FunctionValidator::visitFunction(Function* curr) {
   if (curr->getResults().isTuple()) {
-    shouldBeTrue(getModule()->features.hasMultivalue(),
+    shouldBeTrue(features.hasMultivalue(),
                  curr->body,
                  "Multivalue function results (multivalue is not enabled)");
   }
-  FeatureSet features;
+  FeatureSet usedFeatures;
   for (const auto& param : curr->getParams()) {
-    features |= param.getFeatures();
+    usedFeatures |= param.getFeatures();
     shouldBeTrue(param.isConcrete(), curr, "params must be concretely typed");
   }
   for (const auto& result : curr->getResults()) {
-    features |= result.getFeatures();
+    usedFeatures |= result.getFeatures();
     shouldBeTrue(result.isConcrete(), curr, "results must be concretely typed");
   }
   for (const auto& var : curr->vars) {
-    features |= var.getFeatures();
-    bool valid = getModule()->features.hasGCNNLocals() || var.isDefaultable();
+    usedFeatures |= var.getFeatures();
+    bool valid = features.hasGCNNLocals() || var.isDefaultable();
     shouldBeTrue(valid, var, "vars must be defaultable");
   }
-  shouldBeTrue(features <= getModule()->features,
+  shouldBeTrue(usedFeatures <= features,
                curr->name,
                "all used types should be allowed");
   if (curr->profile == IRProfile::Poppy) {
@@ -2645,7 +2674,7 @@ void FunctionValidator::visitFunction(Function* curr) {
     shouldBeTrue(seen.insert(name).second, name, "local names must be unique");
   }
 
-  if (getModule()->features.hasGCNNLocals()) {
+  if (features.hasGCNNLocals()) {
     // If we have non-nullable locals, verify that no local.get can read a null
     // default value.
     // TODO: this can be fairly slow due to the LocalGraph. writing more code to
@@ -3215,4 +3244,17 @@ bool WasmValidator::validate(Module& module, Flags flags) {
   return info.valid.load();
 }
 
+bool WasmValidator::validate(Function* func, Module& module, Flags flags) {
+  ValidationInfo info(module);
+  info.validateWeb = (flags & Web) != 0;
+  info.validateGlobally = (flags & Globally) != 0;
+  info.quiet = (flags & Quiet) != 0;
+  FunctionValidator(module, &info).validate(func);
+  // print all the data
+  if (!info.valid.load() && !info.quiet) {
+    std::cerr << info.getStream(func).str();
+  }
+  return info.valid.load();
+}
+
 } // namespace wasm
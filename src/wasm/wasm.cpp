@@ -35,6 +35,8 @@ const char* Dylink0 = "dylink.0";
 const char* Linking = "linking";
 const char* Producers = "producers";
 const char* TargetFeatures = "target_features";
+const char* BranchHint = "metadata.code.branch_hint";
+const char* Checksums = "checksums";
 const char* AtomicsFeature = "atomics";
 const char* BulkMemoryFeature = "bulk-memory";
 const char* ExceptionHandlingFeature = "exception-handling";
@@ -120,6 +122,19 @@ const char* getExpressionName(Expression* curr) {
   }
 }
 
+// Off by default: the producer must opt in to the relaxed fast path. Atomic
+// only so that racy reads from parallel passes are well-defined; the value is
+// never toggled while passes run.
+static std::atomic<bool> trustDeclaredTypes(false);
+
+void setTrustDeclaredTypes(bool trust) {
+  trustDeclaredTypes.store(trust, std::memory_order_relaxed);
+}
+
+bool getTrustDeclaredTypes() {
+  return trustDeclaredTypes.load(std::memory_order_relaxed);
+}
+
 Literal getLiteralFromConstExpression(Expression* curr) {
   // TODO: Do we need this function given that Properties::getLiteral
   // (currently) does the same?
@@ -210,14 +225,14 @@ void Block::finalize() {
 
 void Block::finalize(Type type_) {
   type = type_;
-  if (type == Type::none && list.size() > 0) {
+  if (type == Type::none && list.size() > 0 && !getTrustDeclaredTypes()) {
     handleUnreachable(this);
   }
 }
 
 void Block::finalize(Type type_, Breakability breakability) {
   type = type_;
-  if (type == Type::none && list.size() > 0) {
+  if (type == Type::none && list.size() > 0 && !getTrustDeclaredTypes()) {
     handleUnreachable(this, breakability);
   }
 }
@@ -1389,7 +1404,9 @@ Tag* Module::getTagOrNull(Name name) {
 
 // TODO(@warchant): refactor all usages to use variant with unique_ptr
 template<typename Vector, typename Map, typename Elem>
-Elem* addModuleElement(Vector& v, Map& m, Elem* curr, std::string funcName) {
+Elem* addModuleElement(
+  Module& wasm, Vector& v, Map& m, Elem* curr, std::string funcName) {
+  assert(!wasm.isFrozen());
   if (!curr->name.is()) {
     Fatal() << "Module::" << funcName << ": empty name";
   }
@@ -1403,10 +1420,12 @@ Elem* addModuleElement(Vector& v, Map& m, Elem* curr, std::string funcName) {
 }
 
 template<typename Vector, typename Map, typename Elem>
-Elem* addModuleElement(Vector& v,
+Elem* addModuleElement(Module& wasm,
+                       Vector& v,
                        Map& m,
                        std::unique_ptr<Elem> curr,
                        std::string funcName) {
+  assert(!wasm.isFrozen());
   if (!curr->name.is()) {
     Fatal() << "Module::" << funcName << ": empty name";
   }
@@ -1420,57 +1439,64 @@ Elem* addModuleElement(Vector& v,
 }
 
 Export* Module::addExport(Export* curr) {
-  return addModuleElement(exports, exportsMap, curr, "addExport");
+  return addModuleElement(*this, exports, exportsMap, curr, "addExport");
 }
 
 Function* Module::addFunction(Function* curr) {
-  return addModuleElement(functions, functionsMap, curr, "addFunction");
+  return addModuleElement(*this, functions, functionsMap, curr, "addFunction");
 }
 
 Global* Module::addGlobal(Global* curr) {
-  return addModuleElement(globals, globalsMap, curr, "addGlobal");
+  return addModuleElement(*this, globals, globalsMap, curr, "addGlobal");
 }
 
 Tag* Module::addTag(Tag* curr) {
-  return addModuleElement(tags, tagsMap, curr, "addTag");
+  return addModuleElement(*this, tags, tagsMap, curr, "addTag");
 }
 
 Export* Module::addExport(std::unique_ptr<Export>&& curr) {
-  return addModuleElement(exports, exportsMap, std::move(curr), "addExport");
+  return addModuleElement(
+    *this, exports, exportsMap, std::move(curr), "addExport");
 }
 
 Function* Module::addFunction(std::unique_ptr<Function>&& curr) {
   return addModuleElement(
-    functions, functionsMap, std::move(curr), "addFunction");
+    *this, functions, functionsMap, std::move(curr), "addFunction");
 }
 
 Table* Module::addTable(std::unique_ptr<Table>&& curr) {
-  return addModuleElement(tables, tablesMap, std::move(curr), "addTable");
+  return addModuleElement(
+    *this, tables, tablesMap, std::move(curr), "addTable");
 }
 
 ElementSegment*
 Module::addElementSegment(std::unique_ptr<ElementSegment>&& curr) {
-  return addModuleElement(
-    elementSegments, elementSegmentsMap, std::move(curr), "addElementSegment");
+  return addModuleElement(*this,
+                          elementSegments,
+                          elementSegmentsMap,
+                          std::move(curr),
+                          "addElementSegment");
 }
 
 DataSegment* Module::addDataSegment(std::unique_ptr<DataSegment>&& curr) {
   return addModuleElement(
-    dataSegments, dataSegmentsMap, std::move(curr), "addDataSegment");
+    *this, dataSegments, dataSegmentsMap, std::move(curr), "addDataSegment");
 }
 
 Global* Module::addGlobal(std::unique_ptr<Global>&& curr) {
-  return addModuleElement(globals, globalsMap, std::move(curr), "addGlobal");
+  return addModuleElement(
+    *this, globals, globalsMap, std::move(curr), "addGlobal");
 }
 
 Tag* Module::addTag(std::unique_ptr<Tag>&& curr) {
-  return addModuleElement(tags, tagsMap, std::move(curr), "addTag");
+  return addModuleElement(*this, tags, tagsMap, std::move(curr), "addTag");
 }
 
 void Module::addStart(const Name& s) { start = s; }
 
 template<typename Vector, typename Map>
-void removeModuleElement(Vector& v, Map& m, Name name) {
+void removeModuleElement(Module& wasm, Vector& v, Map& m, Name name) {
+  assert(!wasm.isFrozen());
   m.erase(name);
   for (size_t i = 0; i < v.size(); i++) {
     if (v[i]->name == name) {
@@ -1481,29 +1507,33 @@ void removeModuleElement(Vector& v, Map& m, Name name) {
 }
 
 void Module::removeExport(Name name) {
-  removeModuleElement(exports, exportsMap, name);
+  removeModuleElement(*this, exports, exportsMap, name);
 }
 void Module::removeFunction(Name name) {
-  removeModuleElement(functions, functionsMap, name);
+  removeModuleElement(*this, functions, functionsMap, name);
 }
 void Module::removeTable(Name name) {
-  removeModuleElement(tables, tablesMap, name);
+  removeModuleElement(*this, tables, tablesMap, name);
 }
 void Module::removeElementSegment(Name name) {
-  removeModuleElement(elementSegments, elementSegmentsMap, name);
+  removeModuleElement(*this, elementSegments, elementSegmentsMap, name);
 }
 void Module::removeDataSegment(Name name) {
-  removeModuleElement(dataSegments, dataSegmentsMap, name);
+  removeModuleElement(*this, dataSegments, dataSegmentsMap, name);
 }
 void Module::removeGlobal(Name name) {
-  removeModuleElement(globals, globalsMap, name);
+  removeModuleElement(*this, globals, globalsMap, name);
+}
+void Module::removeTag(Name name) {
+  removeModuleElement(*this, tags, tagsMap, name);
 }
-void Module::removeTag(Name name) { removeModuleElement(tags, tagsMap, name); }
 
 template<typename Vector, typename Map, typename Elem>
-void removeModuleElements(Vector& v,
+void removeModuleElements(Module& wasm,
+                          Vector& v,
                           Map& m,
                           std::function<bool(Elem* elem)> pred) {
+  assert(!wasm.isFrozen());
   for (auto it = m.begin(); it != m.end();) {
     if (pred(it->second)) {
       it = m.erase(it);
@@ -1517,25 +1547,25 @@ void removeModuleElements(Vector& v,
 }
 
 void Module::removeExports(std::function<bool(Export*)> pred) {
-  removeModuleElements(exports, exportsMap, pred);
+  removeModuleElements(*this, exports, exportsMap, pred);
 }
 void Module::removeFunctions(std::function<bool(Function*)> pred) {
-  removeModuleElements(functions, functionsMap, pred);
+  removeModuleElements(*this, functions, functionsMap, pred);
 }
 void Module::removeTables(std::function<bool(Table*)> pred) {
-  removeModuleElements(tables, tablesMap, pred);
+  removeModuleElements(*this, tables, tablesMap, pred);
 }
 void Module::removeElementSegments(std::function<bool(ElementSegment*)> pred) {
-  removeModuleElements(elementSegments, elementSegmentsMap, pred);
+  removeModuleElements(*this, elementSegments, elementSegmentsMap, pred);
 }
 void Module::removeDataSegments(std::function<bool(DataSegment*)> pred) {
-  removeModuleElements(dataSegments, dataSegmentsMap, pred);
+  removeModuleElements(*this, dataSegments, dataSegmentsMap, pred);
 }
 void Module::removeGlobals(std::function<bool(Global*)> pred) {
-  removeModuleElements(globals, globalsMap, pred);
+  removeModuleElements(*this, globals, globalsMap, pred);
 }
 void Module::removeTags(std::function<bool(Tag*)> pred) {
-  removeModuleElements(tags, tagsMap, pred);
+  removeModuleElements(*this, tags, tagsMap, pred);
 }
 
 void Module::updateMaps() {
@@ -1569,6 +1599,15 @@ void Module::updateMaps() {
   }
 }
 
+void Module::freeze() {
+  // Rebuild the maps so that they are guaranteed to be in sync with the
+  // module's contents, and so that all lookups afterwards are pure reads.
+  updateMaps();
+  frozen = true;
+}
+
+void Module::unfreeze() { frozen = false; }
+
 void Module::clearDebugInfo() { debugInfoFileNames.clear(); }
 
 } // namespace wasm
@@ -280,11 +280,11 @@ public:
     return {};
   }
 
-  void takeChar() {
+  void takeChars(size_t n) {
     if (escapeBuilder) {
-      *escapeBuilder << peek();
+      *escapeBuilder << next().substr(0, n);
     }
-    LexCtx::take(1);
+    LexCtx::take(n);
   }
 
   void ensureBuildingEscaped() {
@@ -370,7 +370,14 @@ std::optional<LexResult> comment(std::string_view in) {
       } else if (ctx.takePrefix(";)"sv)) {
         --depth;
       } else {
-        ctx.take(1);
+        // The current character does not open or close a comment; skip ahead
+        // to the next character that might.
+        if (auto size = ctx.next().find_first_of("(;"sv, 1);
+            size != ""sv.npos) {
+          ctx.take(size);
+        } else {
+          ctx.takeAll();
+        }
       }
     }
     if (depth > 0) {
@@ -395,8 +402,13 @@ std::optional<LexResult> spacechar(std::string_view in) {
 std::optional<LexResult> space(std::string_view in) {
   LexCtx ctx(in);
   while (ctx.size()) {
-    if (auto lexed = spacechar(ctx.next())) {
-      ctx.take(*lexed);
+    // Take whole runs of space characters at once.
+    if (auto size = ctx.next().find_first_not_of(" \n\r\t"sv); size > 0) {
+      if (size == ""sv.npos) {
+        ctx.takeAll();
+        break;
+      }
+      ctx.take(size);
     } else if (auto lexed = comment(ctx.next())) {
       ctx.take(*lexed);
     } else {
@@ -603,44 +615,17 @@ std::optional<LexFloatResult> float_(std::string_view in) {
 //          | '!' | '#' | '$' | '%' | '&' | ''' | '*' | '+'
 //          | '-' | '.' | '/' | ':' | '<' | '=' | '>' | '?'
 //          | '@' | '\' | '^' | '_' | '`' | '|' | '~'
-std::optional<LexResult> idchar(std::string_view in) {
-  LexCtx ctx(in);
-  if (ctx.empty()) {
-    return {};
-  }
-  uint8_t c = ctx.peek();
-  if (('0' <= c && c <= '9') || ('A' <= c && c <= 'Z') ||
-      ('a' <= c && c <= 'z')) {
-    ctx.take(1);
-  } else {
-    switch (c) {
-      case '!':
-      case '#':
-      case '$':
-      case '%':
-      case '&':
-      case '\'':
-      case '*':
-      case '+':
-      case '-':
-      case '.':
-      case '/':
-      case ':':
-      case '<':
-      case '=':
-      case '>':
-      case '?':
-      case '@':
-      case '\\':
-      case '^':
-      case '_':
-      case '`':
-      case '|':
-      case '~':
-        ctx.take(1);
-    }
-  }
-  return ctx.lexed();
+// Returns the length of the whole run of idchars at the start of the input.
+// Scanning the run in a single find_first_not_of lets the standard library use
+// its optimized byte scanning rather than advancing a character at a time.
+size_t idcharRun(std::string_view in) {
+  constexpr std::string_view idchars =
+    "0123456789"
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz"
+    "!#$%&'*+-./:<=>?@\\^_`|~";
+  auto run = in.find_first_not_of(idchars);
+  return run == ""sv.npos ? in.size() : run;
 }
 
 // id ::= '$' idchar+
@@ -649,14 +634,11 @@ std::optional<LexResult> ident(std::string_view in) {
   if (!ctx.takePrefix("$"sv)) {
     return {};
   }
-  if (auto lexed = idchar(ctx.next())) {
-    ctx.take(*lexed);
-  } else {
+  auto run = idcharRun(ctx.next());
+  if (run == 0) {
     return {};
   }
-  while (auto lexed = idchar(ctx.next())) {
-    ctx.take(*lexed);
-  }
+  ctx.take(run);
   if (ctx.canFinish()) {
     return ctx.lexed();
   }
@@ -725,13 +707,20 @@ std::optional<LexStrResult> str(std::string_view in) {
         ctx.appendEscaped(char(lexed.n));
       }
     } else {
-      // Normal characters
-      if (uint8_t c = ctx.peek(); c >= 0x20 && c != 0x7F) {
-        ctx.takeChar();
-      } else {
-        // TODO: Add error production for unescaped control characters.
-        return {};
+      // Normal characters: take the whole run up to the next quote or escape
+      // at once.
+      auto chars = ctx.next();
+      auto run = chars.find_first_of("\"\\"sv);
+      if (run == ""sv.npos) {
+        run = chars.size();
+      }
+      for (size_t i = 0; i < run; ++i) {
+        if (uint8_t c = chars[i]; c < 0x20 || c == 0x7F) {
+          // TODO: Add error production for unescaped control characters.
+          return {};
+        }
       }
+      ctx.takeChars(run);
     }
   }
   return ctx.lexed();
@@ -755,9 +744,7 @@ std::optional<LexResult> keyword(std::string_view in) {
   } else {
     return {};
   }
-  while (auto lexed = idchar(ctx.next())) {
-    ctx.take(*lexed);
-  }
+  ctx.take(idcharRun(ctx.next()));
   return ctx.lexed();
 }
 
@@ -14,9 +14,12 @@
  * limitations under the License.
  */
 
+#include <atomic>
+
 #include "wat-parser.h"
 #include "ir/names.h"
 #include "support/name.h"
+#include "support/threads.h"
 #include "wasm-builder.h"
 #include "wasm-type.h"
 #include "wasm.h"
@@ -349,6 +352,59 @@ Result<> parseDefs(Ctx& ctx,
   return Ok{};
 }
 
+// As parseDefs, but parses the definitions in parallel across the thread
+// pool. Once the declarations and types are known, each definition is
+// independent: a context only writes to its own definition's module slot, and
+// expression allocation in the module arena is thread-safe. Each worker gets
+// its own context, created by makeCtx. Definitions are handed out by an
+// atomic counter, and since a worker must not stop while others still have
+// errors to report, each records its error in its definition's slot and we
+// report the first one in definition order at the end.
+template<typename Ctx, typename MakeCtx>
+Result<> parseDefsParallel(MakeCtx makeCtx,
+                           std::string_view input,
+                           const std::vector<DefPos>& defs,
+                           MaybeResult<> (*parser)(Ctx&, ParseInput&)) {
+  auto numWorkers = ThreadPool::get()->size();
+  if (numWorkers == 1 || defs.size() <= 1) {
+    auto ctx = makeCtx();
+    return parseDefs(ctx, input, defs, parser);
+  }
+  std::vector<Ctx> ctxs;
+  for (size_t i = 0; i < numWorkers; ++i) {
+    ctxs.push_back(makeCtx());
+  }
+  std::vector<std::optional<Err>> errs(defs.size());
+  std::atomic<size_t> nextDef{0};
+  std::vector<std::function<ThreadWorkState()>> doWorkers;
+  for (size_t worker = 0; worker < numWorkers; ++worker) {
+    auto* ctx = &ctxs[worker];
+    doWorkers.push_back([&, ctx]() {
+      auto i = nextDef.fetch_add(1);
+      if (i >= defs.size()) {
+        return ThreadWorkState::Finished;
+      }
+      ctx->index = i;
+      ParseInput in(input, defs[i].pos);
+      auto parsed = parser(*ctx, in);
+      if (auto* err = parsed.getErr()) {
+        errs[i] = *err;
+      }
+      if (i + 1 == defs.size()) {
+        return ThreadWorkState::Finished;
+      }
+      return ThreadWorkState::More;
+    });
+  }
+  ThreadPool::get()->work(doWorkers);
+  for (auto& err : errs) {
+    if (err) {
+      return Err{*err};
+    }
+  }
+  return Ok{};
+}
+
 // ===============
 // Parser Contexts
 // ===============
@@ -2177,10 +2233,11 @@ Result<> parseModule(Module& wasm, std::string_view input) {
     // TODO: Parse types of other module elements.
   }
   {
-    // Parse definitions.
-    // TODO: Parallelize this.
-    ParseDefsCtx ctx(wasm, types, *typeIndices);
-    CHECK_ERR(parseDefs(ctx, input, decls.globalDefs, global));
+    // Parse definitions, in parallel. Each definition only fills in its own
+    // module element, so all of them are independent at this point.
+    auto makeCtx = [&]() { return ParseDefsCtx(wasm, types, *typeIndices); };
+    CHECK_ERR(parseDefsParallel<ParseDefsCtx>(
+      makeCtx, input, decls.globalDefs, global));
   }
 
   return Ok{};
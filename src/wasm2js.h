@@ -283,10 +283,13 @@ private:
   Flags flags;
   PassOptions options;
 
-  // How many temp vars we need
-  std::vector<size_t> temps; // type => num temps
+  // How many temp vars we need. This is scratch state used while converting a
+  // single function, and functions are converted in parallel, so it is
+  // per-thread.
+  static inline thread_local std::vector<size_t> temps; // type => num temps
   // Which are currently free to use
-  std::vector<std::vector<IString>> frees; // type => list of free names
+  static inline thread_local std::vector<std::vector<IString>>
+    frees; // type => list of free names
 
   // Mangled names cache by interned names.
   // Utilizes the usually reused underlying cstring's pointer as the key.
@@ -493,9 +496,45 @@ Ref Wasm2JSBuilder::processWasm(Module* wasm, Name funcName) {
     asmFunc[3]->push_back(
       ValueBuilder::makeName("// EMSCRIPTEN_START_FUNCS\n"));
   }
-  // functions
+  // Mangle the names used in each function ahead of time. Name mangling
+  // mutates shared caches, and the identifier a name receives depends on the
+  // order in which names are first seen (see fromName), so we must do this
+  // serially, in a fixed order, before converting the functions in parallel
+  // below. After this the conversions only perform read-only cache lookups.
   ModuleUtils::iterDefinedFunctions(*wasm, [&](Function* func) {
-    asmFunc[3]->push_back(processFunction(wasm, func));
+    // We will be symbolically referring to all variables in the function, so
+    // make sure that everything has a name and it's unique.
+    Names::ensureNames(func);
+    for (Index i = 0; i < func->getNumLocals(); i++) {
+      fromName(func->getLocalNameOrGeneric(i), NameScope::Local);
+    }
+    struct LabelNoter : public PostWalker<LabelNoter> {
+      Wasm2JSBuilder* parent;
+      void visitBlock(Block* curr) {
+        if (curr->name.is()) {
+          parent->fromName(curr->name, NameScope::Label);
+        }
+      }
+      void visitLoop(Loop* curr) {
+        if (curr->name.is()) {
+          parent->fromName(curr->name, NameScope::Label);
+        }
+      }
+    } noter;
+    noter.parent = this;
+    noter.walk(func->body);
+  });
+  // Convert the functions in parallel: each conversion is independent now
+  // that all names are mangled (and the JS AST arena is thread-safe). Then
+  // emit them in the original module order, so the output is deterministic.
+  ModuleUtils::ParallelFunctionAnalysis<Ref, Mutable> conversion(
+    *wasm, [&](Function* func, Ref& converted) {
+      if (!func->imported()) {
+        converted = processFunction(wasm, func);
+      }
+    });
+  ModuleUtils::iterDefinedFunctions(*wasm, [&](Function* func) {
+    asmFunc[3]->push_back(conversion.map[func]);
   });
   if (generateFetchHighBits) {
     Builder builder(*wasm);
@@ -151,6 +151,20 @@ template<typename T> void testAPI() {
     assert(t == u);
     assert(u == t);
   }
+  {
+    T t, u;
+    // range insertion and swapping
+    std::vector<int> items = {1, 2, 2, 3};
+    t.insert(items.begin(), items.end());
+    assertContents(t, {1, 2, 3});
+    u.swap(t);
+    assertContents(u, {1, 2, 3});
+    assert(t.empty());
+    u.insert(4);
+    t.swap(u);
+    assertContents(t, {1, 2, 3, 4});
+    assert(u.empty());
+  }
   {
     T t, u;
     // as above, but for size 2, and don't erase the last item added
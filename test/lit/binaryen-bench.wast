@@ -0,0 +1,35 @@
+;; Check that every microbenchmark runs over a text input and reports its
+;; timings and checksum. The timings vary, so only the shape is checked.
+
+;; RUN: binaryen-bench %s --reps 1 | filecheck %s
+
+;; CHECK: leb-encode: {{.*}} ms total, {{.*}} ms/rep over 1 reps [checksum {{[0-9]+}}]
+;; CHECK: leb-decode: {{.*}} ms total, {{.*}} ms/rep over 1 reps [checksum {{[0-9]+}}]
+;; CHECK: type-interning: {{.*}} ms total, {{.*}} ms/rep over 1 reps [checksum {{[0-9]+}}]
+;; CHECK: effect-analyzer: {{.*}} ms total, {{.*}} ms/rep over 1 reps [checksum {{[0-9]+}}]
+;; CHECK: local-graph: {{.*}} ms total, {{.*}} ms/rep over 1 reps [checksum {{[0-9]+}}]
+;; CHECK: walker: {{.*}} ms total, {{.*}} ms/rep over 1 reps [checksum {{[0-9]+}}]
+
+(module
+  (memory 1)
+  (func $work (param $x i32) (result i32)
+    (local $i i32)
+    (loop $l
+      (local.set $i
+        (i32.add
+          (local.get $i)
+          (i32.const 1)
+        )
+      )
+      (br_if $l
+        (i32.lt_u
+          (local.get $i)
+          (local.get $x)
+        )
+      )
+    )
+    (i32.load
+      (local.get $i)
+    )
+  )
+)
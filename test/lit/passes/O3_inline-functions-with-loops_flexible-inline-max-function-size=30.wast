@@ -156,8 +156,15 @@
     )
   )
   ;; CHECK:      (func $t2 (; has Stack IR ;) (param $0 i32) (result i32)
-  ;; CHECK-NEXT:  (call $fib
+  ;; CHECK-NEXT:  (if (result i32)
+  ;; CHECK-NEXT:   (i32.le_s
+  ;; CHECK-NEXT:    (local.get $0)
+  ;; CHECK-NEXT:    (i32.const 2)
+  ;; CHECK-NEXT:   )
   ;; CHECK-NEXT:   (local.get $0)
+  ;; CHECK-NEXT:   (call $byn-split-outlined-C$fib
+  ;; CHECK-NEXT:    (local.get $0)
+  ;; CHECK-NEXT:   )
   ;; CHECK-NEXT:  )
   ;; CHECK-NEXT: )
   (func $t2 (export "t2") (type $t0) (param $p0 i32) (result i32)
@@ -167,10 +174,23 @@
   )
 
   ;; CHECK:      (func $t3 (; has Stack IR ;) (param $0 i32) (result i32)
-  ;; CHECK-NEXT:  (call $fib
-  ;; CHECK-NEXT:   (i32.add
+  ;; CHECK-NEXT:  (block $__inlined_func$byn-split-inlineable-C$fib (result i32)
+  ;; CHECK-NEXT:   (drop
+  ;; CHECK-NEXT:    (br_if $__inlined_func$byn-split-inlineable-C$fib
+  ;; CHECK-NEXT:     (local.tee $0
+  ;; CHECK-NEXT:      (i32.add
+  ;; CHECK-NEXT:       (local.get $0)
+  ;; CHECK-NEXT:       (i32.const 1)
+  ;; CHECK-NEXT:      )
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:     (i32.le_s
+  ;; CHECK-NEXT:      (local.get $0)
+  ;; CHECK-NEXT:      (i32.const 2)
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:   (call $byn-split-outlined-C$fib
   ;; CHECK-NEXT:    (local.get $0)
-  ;; CHECK-NEXT:    (i32.const 1)
   ;; CHECK-NEXT:   )
   ;; CHECK-NEXT:  )
   ;; CHECK-NEXT: )
@@ -184,3 +204,195 @@
   )
   (memory $memory (export "memory") 0)
 )
+;; CHECK:      (func $byn-split-outlined-C$fib (; has Stack IR ;) (param $0 i32) (result i32)
+;; CHECK-NEXT:  (local $1 i32)
+;; CHECK-NEXT:  (i32.add
+;; CHECK-NEXT:   (block $__inlined_func$byn-split-inlineable-C$fib (result i32)
+;; CHECK-NEXT:    (drop
+;; CHECK-NEXT:     (br_if $__inlined_func$byn-split-inlineable-C$fib
+;; CHECK-NEXT:      (local.tee $1
+;; CHECK-NEXT:       (i32.sub
+;; CHECK-NEXT:        (local.get $0)
+;; CHECK-NEXT:        (i32.const 1)
+;; CHECK-NEXT:       )
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:      (i32.le_s
+;; CHECK-NEXT:       (local.get $1)
+;; CHECK-NEXT:       (i32.const 2)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:    (call $byn-split-outlined-C$fib_0
+;; CHECK-NEXT:     (local.get $1)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:   (block $__inlined_func$byn-split-inlineable-C$fib0 (result i32)
+;; CHECK-NEXT:    (drop
+;; CHECK-NEXT:     (br_if $__inlined_func$byn-split-inlineable-C$fib0
+;; CHECK-NEXT:      (local.tee $0
+;; CHECK-NEXT:       (i32.sub
+;; CHECK-NEXT:        (local.get $0)
+;; CHECK-NEXT:        (i32.const 2)
+;; CHECK-NEXT:       )
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:      (i32.le_s
+;; CHECK-NEXT:       (local.get $0)
+;; CHECK-NEXT:       (i32.const 2)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:    (call $byn-split-outlined-C$fib_0
+;; CHECK-NEXT:     (local.get $0)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:  )
+;; CHECK-NEXT: )
+
+;; CHECK:      (func $byn-split-outlined-C$fib_0 (; has Stack IR ;) (param $0 i32) (result i32)
+;; CHECK-NEXT:  (local $1 i32)
+;; CHECK-NEXT:  (i32.add
+;; CHECK-NEXT:   (block $__inlined_func$byn-split-inlineable-C$fib (result i32)
+;; CHECK-NEXT:    (drop
+;; CHECK-NEXT:     (br_if $__inlined_func$byn-split-inlineable-C$fib
+;; CHECK-NEXT:      (local.tee $1
+;; CHECK-NEXT:       (i32.sub
+;; CHECK-NEXT:        (local.get $0)
+;; CHECK-NEXT:        (i32.const 1)
+;; CHECK-NEXT:       )
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:      (i32.le_s
+;; CHECK-NEXT:       (local.get $1)
+;; CHECK-NEXT:       (i32.const 2)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:    (call $byn-split-outlined-C$fib_1
+;; CHECK-NEXT:     (local.get $1)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:   (block $__inlined_func$byn-split-inlineable-C$fib0 (result i32)
+;; CHECK-NEXT:    (drop
+;; CHECK-NEXT:     (br_if $__inlined_func$byn-split-inlineable-C$fib0
+;; CHECK-NEXT:      (local.tee $0
+;; CHECK-NEXT:       (i32.sub
+;; CHECK-NEXT:        (local.get $0)
+;; CHECK-NEXT:        (i32.const 2)
+;; CHECK-NEXT:       )
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:      (i32.le_s
+;; CHECK-NEXT:       (local.get $0)
+;; CHECK-NEXT:       (i32.const 2)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:    (call $byn-split-outlined-C$fib_1
+;; CHECK-NEXT:     (local.get $0)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:  )
+;; CHECK-NEXT: )
+
+;; CHECK:      (func $byn-split-outlined-C$fib_1 (; has Stack IR ;) (param $0 i32) (result i32)
+;; CHECK-NEXT:  (local $1 i32)
+;; CHECK-NEXT:  (i32.add
+;; CHECK-NEXT:   (block $__inlined_func$byn-split-inlineable-C$fib (result i32)
+;; CHECK-NEXT:    (drop
+;; CHECK-NEXT:     (br_if $__inlined_func$byn-split-inlineable-C$fib
+;; CHECK-NEXT:      (local.tee $1
+;; CHECK-NEXT:       (i32.sub
+;; CHECK-NEXT:        (local.get $0)
+;; CHECK-NEXT:        (i32.const 1)
+;; CHECK-NEXT:       )
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:      (i32.le_s
+;; CHECK-NEXT:       (local.get $1)
+;; CHECK-NEXT:       (i32.const 2)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:    (call $byn-split-outlined-C$fib_2
+;; CHECK-NEXT:     (local.get $1)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:   (block $__inlined_func$byn-split-inlineable-C$fib0 (result i32)
+;; CHECK-NEXT:    (drop
+;; CHECK-NEXT:     (br_if $__inlined_func$byn-split-inlineable-C$fib0
+;; CHECK-NEXT:      (local.tee $0
+;; CHECK-NEXT:       (i32.sub
+;; CHECK-NEXT:        (local.get $0)
+;; CHECK-NEXT:        (i32.const 2)
+;; CHECK-NEXT:       )
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:      (i32.le_s
+;; CHECK-NEXT:       (local.get $0)
+;; CHECK-NEXT:       (i32.const 2)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:    (call $byn-split-outlined-C$fib_2
+;; CHECK-NEXT:     (local.get $0)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:  )
+;; CHECK-NEXT: )
+
+;; CHECK:      (func $byn-split-outlined-C$fib_2 (; has Stack IR ;) (param $0 i32) (result i32)
+;; CHECK-NEXT:  (local $1 i32)
+;; CHECK-NEXT:  (i32.add
+;; CHECK-NEXT:   (block $__inlined_func$byn-split-inlineable-C$fib (result i32)
+;; CHECK-NEXT:    (drop
+;; CHECK-NEXT:     (br_if $__inlined_func$byn-split-inlineable-C$fib
+;; CHECK-NEXT:      (local.tee $1
+;; CHECK-NEXT:       (i32.sub
+;; CHECK-NEXT:        (local.get $0)
+;; CHECK-NEXT:        (i32.const 1)
+;; CHECK-NEXT:       )
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:      (i32.le_s
+;; CHECK-NEXT:       (local.get $1)
+;; CHECK-NEXT:       (i32.const 2)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:    (call $byn-split-outlined-C$fib_3
+;; CHECK-NEXT:     (local.get $1)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:   (block $__inlined_func$byn-split-inlineable-C$fib0 (result i32)
+;; CHECK-NEXT:    (drop
+;; CHECK-NEXT:     (br_if $__inlined_func$byn-split-inlineable-C$fib0
+;; CHECK-NEXT:      (local.tee $0
+;; CHECK-NEXT:       (i32.sub
+;; CHECK-NEXT:        (local.get $0)
+;; CHECK-NEXT:        (i32.const 2)
+;; CHECK-NEXT:       )
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:      (i32.le_s
+;; CHECK-NEXT:       (local.get $0)
+;; CHECK-NEXT:       (i32.const 2)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:    (call $byn-split-outlined-C$fib_3
+;; CHECK-NEXT:     (local.get $0)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:  )
+;; CHECK-NEXT: )
+
+;; CHECK:      (func $byn-split-outlined-C$fib_3 (; has Stack IR ;) (param $0 i32) (result i32)
+;; CHECK-NEXT:  (i32.add
+;; CHECK-NEXT:   (call $fib
+;; CHECK-NEXT:    (i32.sub
+;; CHECK-NEXT:     (local.get $0)
+;; CHECK-NEXT:     (i32.const 1)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:   (call $fib
+;; CHECK-NEXT:    (i32.sub
+;; CHECK-NEXT:     (local.get $0)
+;; CHECK-NEXT:     (i32.const 2)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:  )
+;; CHECK-NEXT: )
@@ -218,91 +218,6 @@
   )
   (local.get $0)
  )
- ;; CHECK:      (func $~lib/allocator/arena/__memory_allocate (; has Stack IR ;) (param $0 i32) (result i32)
- ;; CHECK-NEXT:  (local $1 i32)
- ;; CHECK-NEXT:  (local $2 i32)
- ;; CHECK-NEXT:  (local $3 i32)
- ;; CHECK-NEXT:  (if
- ;; CHECK-NEXT:   (i32.gt_u
- ;; CHECK-NEXT:    (local.get $0)
- ;; CHECK-NEXT:    (i32.const 1073741824)
- ;; CHECK-NEXT:   )
- ;; CHECK-NEXT:   (unreachable)
- ;; CHECK-NEXT:  )
- ;; CHECK-NEXT:  (if
- ;; CHECK-NEXT:   (i32.gt_u
- ;; CHECK-NEXT:    (local.tee $2
- ;; CHECK-NEXT:     (i32.and
- ;; CHECK-NEXT:      (i32.add
- ;; CHECK-NEXT:       (i32.add
- ;; CHECK-NEXT:        (select
- ;; CHECK-NEXT:         (local.get $0)
- ;; CHECK-NEXT:         (i32.const 1)
- ;; CHECK-NEXT:         (i32.gt_u
- ;; CHECK-NEXT:          (local.get $0)
- ;; CHECK-NEXT:          (i32.const 1)
- ;; CHECK-NEXT:         )
- ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:        (local.tee $0
- ;; CHECK-NEXT:         (global.get $global$1)
- ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:       )
- ;; CHECK-NEXT:       (i32.const 7)
- ;; CHECK-NEXT:      )
- ;; CHECK-NEXT:      (i32.const -8)
- ;; CHECK-NEXT:     )
- ;; CHECK-NEXT:    )
- ;; CHECK-NEXT:    (i32.shl
- ;; CHECK-NEXT:     (local.tee $1
- ;; CHECK-NEXT:      (memory.size)
- ;; CHECK-NEXT:     )
- ;; CHECK-NEXT:     (i32.const 16)
- ;; CHECK-NEXT:    )
- ;; CHECK-NEXT:   )
- ;; CHECK-NEXT:   (if
- ;; CHECK-NEXT:    (i32.lt_s
- ;; CHECK-NEXT:     (memory.grow
- ;; CHECK-NEXT:      (select
- ;; CHECK-NEXT:       (local.get $1)
- ;; CHECK-NEXT:       (local.tee $3
- ;; CHECK-NEXT:        (i32.shr_u
- ;; CHECK-NEXT:         (i32.and
- ;; CHECK-NEXT:          (i32.add
- ;; CHECK-NEXT:           (i32.sub
- ;; CHECK-NEXT:            (local.get $2)
- ;; CHECK-NEXT:            (local.get $0)
- ;; CHECK-NEXT:           )
- ;; CHECK-NEXT:           (i32.const 65535)
- ;; CHECK-NEXT:          )
- ;; CHECK-NEXT:          (i32.const -65536)
- ;; CHECK-NEXT:         )
- ;; CHECK-NEXT:         (i32.const 16)
- ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:       )
- ;; CHECK-NEXT:       (i32.gt_s
- ;; CHECK-NEXT:        (local.get $1)
- ;; CHECK-NEXT:        (local.get $3)
- ;; CHECK-NEXT:       )
- ;; CHECK-NEXT:      )
- ;; CHECK-NEXT:     )
- ;; CHECK-NEXT:     (i32.const 0)
- ;; CHECK-NEXT:    )
- ;; CHECK-NEXT:    (if
- ;; CHECK-NEXT:     (i32.lt_s
- ;; CHECK-NEXT:      (memory.grow
- ;; CHECK-NEXT:       (local.get $3)
- ;; CHECK-NEXT:      )
- ;; CHECK-NEXT:      (i32.const 0)
- ;; CHECK-NEXT:     )
- ;; CHECK-NEXT:     (unreachable)
- ;; CHECK-NEXT:    )
- ;; CHECK-NEXT:   )
- ;; CHECK-NEXT:  )
- ;; CHECK-NEXT:  (global.set $global$1
- ;; CHECK-NEXT:   (local.get $2)
- ;; CHECK-NEXT:  )
- ;; CHECK-NEXT:  (local.get $0)
- ;; CHECK-NEXT: )
  (func $~lib/allocator/arena/__memory_allocate (; 6 ;) (type $3) (param $0 i32) (result i32)
   (local $1 i32)
   (local $2 i32)
@@ -547,7 +462,7 @@
  ;; CHECK-NEXT:  (local $7 i32)
  ;; CHECK-NEXT:  (f64.store
  ;; CHECK-NEXT:   (local.tee $7
- ;; CHECK-NEXT:    (call $~lib/allocator/arena/__memory_allocate
+ ;; CHECK-NEXT:    (call $byn-split-outlined-C$~lib/memory/memory.allocate
  ;; CHECK-NEXT:     (i32.const 56)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:   )
@@ -1262,30 +1177,30 @@
  ;; CHECK-NEXT:  (local $7 f64)
  ;; CHECK-NEXT:  (i32.store
  ;; CHECK-NEXT:   (local.tee $0
- ;; CHECK-NEXT:    (call $~lib/allocator/arena/__memory_allocate
+ ;; CHECK-NEXT:    (call $byn-split-outlined-C$~lib/allocator/arena/__memory_allocate
  ;; CHECK-NEXT:     (i32.const 32)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (i32.const 20)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (i32.store
- ;; CHECK-NEXT:   (local.tee $2
- ;; CHECK-NEXT:    (call $~lib/allocator/arena/__memory_allocate
+ ;; CHECK-NEXT:   (local.tee $3
+ ;; CHECK-NEXT:    (call $byn-split-outlined-C$~lib/memory/memory.allocate
  ;; CHECK-NEXT:     (i32.const 8)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (i32.const 0)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (i32.store offset=4
- ;; CHECK-NEXT:   (local.get $2)
+ ;; CHECK-NEXT:   (local.get $3)
  ;; CHECK-NEXT:   (i32.const 0)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (i32.store
- ;; CHECK-NEXT:   (local.get $2)
+ ;; CHECK-NEXT:   (local.get $3)
  ;; CHECK-NEXT:   (local.get $0)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (i32.store offset=4
- ;; CHECK-NEXT:   (local.get $2)
+ ;; CHECK-NEXT:   (local.get $3)
  ;; CHECK-NEXT:   (i32.const 5)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (i32.store8
@@ -1409,7 +1324,7 @@
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (i32.store
  ;; CHECK-NEXT:    (i32.sub
- ;; CHECK-NEXT:     (local.tee $3
+ ;; CHECK-NEXT:     (local.tee $2
  ;; CHECK-NEXT:      (i32.add
  ;; CHECK-NEXT:       (local.get $0)
  ;; CHECK-NEXT:       (local.get $1)
@@ -1421,7 +1336,7 @@
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (i32.store
  ;; CHECK-NEXT:    (i32.sub
- ;; CHECK-NEXT:     (local.get $3)
+ ;; CHECK-NEXT:     (local.get $2)
  ;; CHECK-NEXT:     (i32.const 8)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:    (i32.const 0)
@@ -1462,7 +1377,7 @@
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (i32.store
  ;; CHECK-NEXT:    (i32.sub
- ;; CHECK-NEXT:     (local.tee $3
+ ;; CHECK-NEXT:     (local.tee $2
  ;; CHECK-NEXT:      (i32.add
  ;; CHECK-NEXT:       (local.get $0)
  ;; CHECK-NEXT:       (local.get $1)
@@ -1474,28 +1389,28 @@
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (i32.store
  ;; CHECK-NEXT:    (i32.sub
- ;; CHECK-NEXT:     (local.get $3)
+ ;; CHECK-NEXT:     (local.get $2)
  ;; CHECK-NEXT:     (i32.const 24)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:    (i32.const 0)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (i32.store
  ;; CHECK-NEXT:    (i32.sub
- ;; CHECK-NEXT:     (local.get $3)
+ ;; CHECK-NEXT:     (local.get $2)
  ;; CHECK-NEXT:     (i32.const 20)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:    (i32.const 0)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (i32.store
  ;; CHECK-NEXT:    (i32.sub
- ;; CHECK-NEXT:     (local.get $3)
+ ;; CHECK-NEXT:     (local.get $2)
  ;; CHECK-NEXT:     (i32.const 16)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:    (i32.const 0)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (local.set $0
  ;; CHECK-NEXT:    (i32.add
- ;; CHECK-NEXT:     (local.tee $3
+ ;; CHECK-NEXT:     (local.tee $2
  ;; CHECK-NEXT:      (i32.add
  ;; CHECK-NEXT:       (i32.and
  ;; CHECK-NEXT:        (local.get $0)
@@ -1510,7 +1425,7 @@
  ;; CHECK-NEXT:   (local.set $1
  ;; CHECK-NEXT:    (i32.sub
  ;; CHECK-NEXT:     (local.get $1)
- ;; CHECK-NEXT:     (local.get $3)
+ ;; CHECK-NEXT:     (local.get $2)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (loop $label$8
@@ -1563,6 +1478,9 @@
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (local.set $0
+ ;; CHECK-NEXT:   (local.get $3)
+ ;; CHECK-NEXT:  )
+ ;; CHECK-NEXT:  (local.set $1
  ;; CHECK-NEXT:   (call $assembly/index/Body#constructor
  ;; CHECK-NEXT:    (f64.const 0)
  ;; CHECK-NEXT:    (f64.const 0)
@@ -1575,11 +1493,11 @@
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (i32.store offset=8
  ;; CHECK-NEXT:   (i32.load
- ;; CHECK-NEXT:    (local.get $2)
+ ;; CHECK-NEXT:    (local.get $0)
  ;; CHECK-NEXT:   )
- ;; CHECK-NEXT:   (local.get $0)
+ ;; CHECK-NEXT:   (local.get $1)
  ;; CHECK-NEXT:  )
- ;; CHECK-NEXT:  (local.set $0
+ ;; CHECK-NEXT:  (local.set $1
  ;; CHECK-NEXT:   (call $assembly/index/Body#constructor
  ;; CHECK-NEXT:    (f64.const 4.841431442464721)
  ;; CHECK-NEXT:    (f64.const -1.1603200440274284)
@@ -1593,13 +1511,13 @@
  ;; CHECK-NEXT:  (i32.store offset=8
  ;; CHECK-NEXT:   (i32.add
  ;; CHECK-NEXT:    (i32.load
- ;; CHECK-NEXT:     (local.get $2)
+ ;; CHECK-NEXT:     (local.get $0)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:    (i32.const 4)
  ;; CHECK-NEXT:   )
- ;; CHECK-NEXT:   (local.get $0)
+ ;; CHECK-NEXT:   (local.get $1)
  ;; CHECK-NEXT:  )
- ;; CHECK-NEXT:  (local.set $0
+ ;; CHECK-NEXT:  (local.set $1
  ;; CHECK-NEXT:   (call $assembly/index/Body#constructor
  ;; CHECK-NEXT:    (f64.const 8.34336671824458)
  ;; CHECK-NEXT:    (f64.const 4.124798564124305)
@@ -1613,13 +1531,13 @@
  ;; CHECK-NEXT:  (i32.store offset=8
  ;; CHECK-NEXT:   (i32.add
  ;; CHECK-NEXT:    (i32.load
- ;; CHECK-NEXT:     (local.get $2)
+ ;; CHECK-NEXT:     (local.get $0)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:    (i32.const 8)
  ;; CHECK-NEXT:   )
- ;; CHECK-NEXT:   (local.get $0)
+ ;; CHECK-NEXT:   (local.get $1)
  ;; CHECK-NEXT:  )
- ;; CHECK-NEXT:  (local.set $0
+ ;; CHECK-NEXT:  (local.set $1
  ;; CHECK-NEXT:   (call $assembly/index/Body#constructor
  ;; CHECK-NEXT:    (f64.const 12.894369562139131)
  ;; CHECK-NEXT:    (f64.const -15.111151401698631)
@@ -1633,13 +1551,13 @@
  ;; CHECK-NEXT:  (i32.store offset=8
  ;; CHECK-NEXT:   (i32.add
  ;; CHECK-NEXT:    (i32.load
- ;; CHECK-NEXT:     (local.get $2)
+ ;; CHECK-NEXT:     (local.get $0)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:    (i32.const 12)
  ;; CHECK-NEXT:   )
- ;; CHECK-NEXT:   (local.get $0)
+ ;; CHECK-NEXT:   (local.get $1)
  ;; CHECK-NEXT:  )
- ;; CHECK-NEXT:  (local.set $0
+ ;; CHECK-NEXT:  (local.set $1
  ;; CHECK-NEXT:   (call $assembly/index/Body#constructor
  ;; CHECK-NEXT:    (f64.const 15.379697114850917)
  ;; CHECK-NEXT:    (f64.const -25.919314609987964)
@@ -1653,37 +1571,46 @@
  ;; CHECK-NEXT:  (i32.store offset=8
  ;; CHECK-NEXT:   (i32.add
  ;; CHECK-NEXT:    (i32.load
- ;; CHECK-NEXT:     (local.get $2)
+ ;; CHECK-NEXT:     (local.get $0)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:    (i32.const 16)
  ;; CHECK-NEXT:   )
- ;; CHECK-NEXT:   (local.get $0)
+ ;; CHECK-NEXT:   (local.get $1)
  ;; CHECK-NEXT:  )
- ;; CHECK-NEXT:  (local.set $0
+ ;; CHECK-NEXT:  (local.set $1
  ;; CHECK-NEXT:   (i32.const 0)
  ;; CHECK-NEXT:  )
+ ;; CHECK-NEXT:  (local.set $4
+ ;; CHECK-NEXT:   (f64.const 0)
+ ;; CHECK-NEXT:  )
+ ;; CHECK-NEXT:  (local.set $5
+ ;; CHECK-NEXT:   (f64.const 0)
+ ;; CHECK-NEXT:  )
+ ;; CHECK-NEXT:  (local.set $6
+ ;; CHECK-NEXT:   (f64.const 0)
+ ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (local.set $3
  ;; CHECK-NEXT:   (i32.load offset=4
- ;; CHECK-NEXT:    (local.get $2)
+ ;; CHECK-NEXT:    (local.get $0)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (loop $label$3
  ;; CHECK-NEXT:   (if
  ;; CHECK-NEXT:    (i32.lt_s
- ;; CHECK-NEXT:     (local.get $0)
+ ;; CHECK-NEXT:     (local.get $1)
  ;; CHECK-NEXT:     (local.get $3)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:    (block
- ;; CHECK-NEXT:     (local.set $4
+ ;; CHECK-NEXT:     (local.set $7
  ;; CHECK-NEXT:      (f64.load offset=48
- ;; CHECK-NEXT:       (local.tee $1
+ ;; CHECK-NEXT:       (local.tee $2
  ;; CHECK-NEXT:        (i32.load offset=8
  ;; CHECK-NEXT:         (i32.add
  ;; CHECK-NEXT:          (i32.load
- ;; CHECK-NEXT:           (local.get $2)
+ ;; CHECK-NEXT:           (local.get $0)
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:          (i32.shl
- ;; CHECK-NEXT:           (local.get $0)
+ ;; CHECK-NEXT:           (local.get $1)
  ;; CHECK-NEXT:           (i32.const 2)
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:         )
@@ -1691,42 +1618,42 @@
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:     )
- ;; CHECK-NEXT:     (local.set $5
+ ;; CHECK-NEXT:     (local.set $4
  ;; CHECK-NEXT:      (f64.add
- ;; CHECK-NEXT:       (local.get $5)
+ ;; CHECK-NEXT:       (local.get $4)
  ;; CHECK-NEXT:       (f64.mul
  ;; CHECK-NEXT:        (f64.load offset=24
- ;; CHECK-NEXT:         (local.get $1)
+ ;; CHECK-NEXT:         (local.get $2)
  ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:        (local.get $4)
+ ;; CHECK-NEXT:        (local.get $7)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:     )
- ;; CHECK-NEXT:     (local.set $6
+ ;; CHECK-NEXT:     (local.set $5
  ;; CHECK-NEXT:      (f64.add
- ;; CHECK-NEXT:       (local.get $6)
+ ;; CHECK-NEXT:       (local.get $5)
  ;; CHECK-NEXT:       (f64.mul
  ;; CHECK-NEXT:        (f64.load offset=32
- ;; CHECK-NEXT:         (local.get $1)
+ ;; CHECK-NEXT:         (local.get $2)
  ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:        (local.get $4)
+ ;; CHECK-NEXT:        (local.get $7)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:     )
- ;; CHECK-NEXT:     (local.set $7
+ ;; CHECK-NEXT:     (local.set $6
  ;; CHECK-NEXT:      (f64.add
- ;; CHECK-NEXT:       (local.get $7)
+ ;; CHECK-NEXT:       (local.get $6)
  ;; CHECK-NEXT:       (f64.mul
  ;; CHECK-NEXT:        (f64.load offset=40
- ;; CHECK-NEXT:         (local.get $1)
+ ;; CHECK-NEXT:         (local.get $2)
  ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:        (local.get $4)
+ ;; CHECK-NEXT:        (local.get $7)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:     )
- ;; CHECK-NEXT:     (local.set $0
+ ;; CHECK-NEXT:     (local.set $1
  ;; CHECK-NEXT:      (i32.add
- ;; CHECK-NEXT:       (local.get $0)
+ ;; CHECK-NEXT:       (local.get $1)
  ;; CHECK-NEXT:       (i32.const 1)
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:     )
@@ -1735,53 +1662,53 @@
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (f64.store offset=24
- ;; CHECK-NEXT:   (local.tee $0
+ ;; CHECK-NEXT:   (local.tee $1
  ;; CHECK-NEXT:    (if (result i32)
  ;; CHECK-NEXT:     (i32.shr_u
  ;; CHECK-NEXT:      (i32.load
- ;; CHECK-NEXT:       (local.tee $0
+ ;; CHECK-NEXT:       (local.tee $1
  ;; CHECK-NEXT:        (i32.load
- ;; CHECK-NEXT:         (local.get $2)
+ ;; CHECK-NEXT:         (local.get $0)
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:      (i32.const 2)
  ;; CHECK-NEXT:     )
  ;; CHECK-NEXT:     (i32.load offset=8
- ;; CHECK-NEXT:      (local.get $0)
+ ;; CHECK-NEXT:      (local.get $1)
  ;; CHECK-NEXT:     )
  ;; CHECK-NEXT:     (unreachable)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (f64.div
- ;; CHECK-NEXT:    (local.get $5)
+ ;; CHECK-NEXT:    (local.get $4)
  ;; CHECK-NEXT:    (f64.const -39.47841760435743)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (f64.store offset=32
- ;; CHECK-NEXT:   (local.get $0)
+ ;; CHECK-NEXT:   (local.get $1)
  ;; CHECK-NEXT:   (f64.div
- ;; CHECK-NEXT:    (local.get $6)
+ ;; CHECK-NEXT:    (local.get $5)
  ;; CHECK-NEXT:    (f64.const -39.47841760435743)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (f64.store offset=40
- ;; CHECK-NEXT:   (local.get $0)
+ ;; CHECK-NEXT:   (local.get $1)
  ;; CHECK-NEXT:   (f64.div
- ;; CHECK-NEXT:    (local.get $7)
+ ;; CHECK-NEXT:    (local.get $6)
  ;; CHECK-NEXT:    (f64.const -39.47841760435743)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (i32.store
- ;; CHECK-NEXT:   (local.tee $0
- ;; CHECK-NEXT:    (call $~lib/allocator/arena/__memory_allocate
+ ;; CHECK-NEXT:   (local.tee $1
+ ;; CHECK-NEXT:    (call $byn-split-outlined-C$~lib/memory/memory.allocate
  ;; CHECK-NEXT:     (i32.const 4)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:   )
- ;; CHECK-NEXT:   (local.get $2)
+ ;; CHECK-NEXT:   (local.get $0)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (global.set $global$5
- ;; CHECK-NEXT:   (local.get $0)
+ ;; CHECK-NEXT:   (local.get $1)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT: )
  (func $assembly/index/init (; 20 ;) (type $0)
@@ -2691,6 +2618,12 @@
  ;; CHECK-NEXT:  (call $assembly/index/NBodySystem#advance
  ;; CHECK-NEXT:   (global.get $global$5)
  ;; CHECK-NEXT:  )
+ ;; CHECK-NEXT:  (local.set $0
+ ;; CHECK-NEXT:   (f64.const 0)
+ ;; CHECK-NEXT:  )
+ ;; CHECK-NEXT:  (local.set $2
+ ;; CHECK-NEXT:   (i32.const 0)
+ ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (local.set $5
  ;; CHECK-NEXT:   (i32.load offset=4
  ;; CHECK-NEXT:    (local.tee $4
@@ -3023,3 +2956,87 @@
  (func $null (; 27 ;) (type $0)
  )
 )
+;; CHECK:      (func $byn-split-outlined-C$~lib/allocator/arena/__memory_allocate (; has Stack IR ;) (param $0 i32) (result i32)
+;; CHECK-NEXT:  (local $1 i32)
+;; CHECK-NEXT:  (local $2 i32)
+;; CHECK-NEXT:  (local $3 i32)
+;; CHECK-NEXT:  (if
+;; CHECK-NEXT:   (i32.gt_u
+;; CHECK-NEXT:    (local.tee $2
+;; CHECK-NEXT:     (i32.and
+;; CHECK-NEXT:      (i32.add
+;; CHECK-NEXT:       (i32.add
+;; CHECK-NEXT:        (select
+;; CHECK-NEXT:         (local.get $0)
+;; CHECK-NEXT:         (i32.const 1)
+;; CHECK-NEXT:         (i32.gt_u
+;; CHECK-NEXT:          (local.get $0)
+;; CHECK-NEXT:          (i32.const 1)
+;; CHECK-NEXT:         )
+;; CHECK-NEXT:        )
+;; CHECK-NEXT:        (local.tee $0
+;; CHECK-NEXT:         (global.get $global$1)
+;; CHECK-NEXT:        )
+;; CHECK-NEXT:       )
+;; CHECK-NEXT:       (i32.const 7)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:      (i32.const -8)
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:    (i32.shl
+;; CHECK-NEXT:     (local.tee $1
+;; CHECK-NEXT:      (memory.size)
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:     (i32.const 16)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:   (if
+;; CHECK-NEXT:    (i32.lt_s
+;; CHECK-NEXT:     (memory.grow
+;; CHECK-NEXT:      (select
+;; CHECK-NEXT:       (local.get $1)
+;; CHECK-NEXT:       (local.tee $3
+;; CHECK-NEXT:        (i32.shr_u
+;; CHECK-NEXT:         (i32.and
+;; CHECK-NEXT:          (i32.add
+;; CHECK-NEXT:           (i32.sub
+;; CHECK-NEXT:            (local.get $2)
+;; CHECK-NEXT:            (local.get $0)
+;; CHECK-NEXT:           )
+;; CHECK-NEXT:           (i32.const 65535)
+;; CHECK-NEXT:          )
+;; CHECK-NEXT:          (i32.const -65536)
+;; CHECK-NEXT:         )
+;; CHECK-NEXT:         (i32.const 16)
+;; CHECK-NEXT:        )
+;; CHECK-NEXT:       )
+;; CHECK-NEXT:       (i32.gt_s
+;; CHECK-NEXT:        (local.get $1)
+;; CHECK-NEXT:        (local.get $3)
+;; CHECK-NEXT:       )
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:     (i32.const 0)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:    (if
+;; CHECK-NEXT:     (i32.lt_s
+;; CHECK-NEXT:      (memory.grow
+;; CHECK-NEXT:       (local.get $3)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:      (i32.const 0)
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:     (unreachable)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:  )
+;; CHECK-NEXT:  (global.set $global$1
+;; CHECK-NEXT:   (local.get $2)
+;; CHECK-NEXT:  )
+;; CHECK-NEXT:  (local.get $0)
+;; CHECK-NEXT: )
+
+;; CHECK:      (func $byn-split-outlined-C$~lib/memory/memory.allocate (; has Stack IR ;) (param $0 i32) (result i32)
+;; CHECK-NEXT:  (call $byn-split-outlined-C$~lib/allocator/arena/__memory_allocate
+;; CHECK-NEXT:   (local.get $0)
+;; CHECK-NEXT:  )
+;; CHECK-NEXT: )
@@ -0,0 +1,32 @@
+;; NOTE: Assertions have been generated by update_lit_checks.py and should not be edited.
+
+;; RUN: wasm-opt %s --cleanup -S -o - | filecheck %s
+
+;; The fused cleanup pass behaves as vacuum + merge-blocks: nops and other
+;; removable code disappear, and the blocks that remain are merged.
+
+(module
+  ;; CHECK:      (func $nops-and-nested-blocks (result i32)
+  ;; CHECK-NEXT:  (i32.const 2)
+  ;; CHECK-NEXT: )
+  (func $nops-and-nested-blocks (result i32)
+    (nop)
+    (block
+      (nop)
+      (block
+        (drop
+          (i32.const 0)
+        )
+        (nop)
+      )
+    )
+    (block $named (result i32)
+      (block
+        (drop
+          (i32.const 1)
+        )
+      )
+      (i32.const 2)
+    )
+  )
+)
@@ -0,0 +1,100 @@
+;; NOTE: Assertions have been generated by update_lit_checks.py --all-items and should not be edited.
+
+;; RUN: wasm-opt %s --count-execution -S -o - | filecheck %s
+
+;; Counters are placed after the one initial page, so they start at 65536;
+;; each function entry, loop header, and return gets one, in order, and the
+;; added "get_execution_count" export reads them back out.
+
+(module
+  (memory 1 1)
+
+  ;; CHECK:      (type $none_=>_none (func))
+
+  ;; CHECK:      (type $i32_=>_i32 (func (param i32) (result i32)))
+
+  ;; CHECK:      (type $i32_=>_i64 (func (param i32) (result i64)))
+
+  ;; CHECK:      (memory $0 2 2)
+
+  ;; CHECK:      (export "get_execution_count" (func $get_execution_count))
+
+  ;; CHECK:      (func $entry-only
+  ;; CHECK-NEXT:  (i64.store
+  ;; CHECK-NEXT:   (i32.const 65536)
+  ;; CHECK-NEXT:   (i64.add
+  ;; CHECK-NEXT:    (i64.load
+  ;; CHECK-NEXT:     (i32.const 65536)
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:    (i64.const 1)
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT:  (nop)
+  ;; CHECK-NEXT: )
+  (func $entry-only
+    (nop)
+  )
+
+  ;; CHECK:      (func $loop-and-return (param $x i32) (result i32)
+  ;; CHECK-NEXT:  (i64.store
+  ;; CHECK-NEXT:   (i32.const 65560)
+  ;; CHECK-NEXT:   (i64.add
+  ;; CHECK-NEXT:    (i64.load
+  ;; CHECK-NEXT:     (i32.const 65560)
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:    (i64.const 1)
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT:  (block (result i32)
+  ;; CHECK-NEXT:   (loop $l
+  ;; CHECK-NEXT:    (i64.store
+  ;; CHECK-NEXT:     (i32.const 65544)
+  ;; CHECK-NEXT:     (i64.add
+  ;; CHECK-NEXT:      (i64.load
+  ;; CHECK-NEXT:       (i32.const 65544)
+  ;; CHECK-NEXT:      )
+  ;; CHECK-NEXT:      (i64.const 1)
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:    (br_if $l
+  ;; CHECK-NEXT:     (local.get $x)
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:   (block
+  ;; CHECK-NEXT:    (i64.store
+  ;; CHECK-NEXT:     (i32.const 65552)
+  ;; CHECK-NEXT:     (i64.add
+  ;; CHECK-NEXT:      (i64.load
+  ;; CHECK-NEXT:       (i32.const 65552)
+  ;; CHECK-NEXT:      )
+  ;; CHECK-NEXT:      (i64.const 1)
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:    (return
+  ;; CHECK-NEXT:     (i32.const 1)
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  (func $loop-and-return (param $x i32) (result i32)
+    (loop $l
+      (br_if $l
+        (local.get $x)
+      )
+    )
+    (return
+      (i32.const 1)
+    )
+  )
+)
+;; CHECK:      (func $get_execution_count (param $0 i32) (result i64)
+;; CHECK-NEXT:  (i64.load
+;; CHECK-NEXT:   (i32.add
+;; CHECK-NEXT:    (i32.const 65536)
+;; CHECK-NEXT:    (i32.mul
+;; CHECK-NEXT:     (local.get $0)
+;; CHECK-NEXT:     (i32.const 8)
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:  )
+;; CHECK-NEXT: )
@@ -0,0 +1,119 @@
+;; NOTE: Assertions have been generated by update_lit_checks.py and should not be edited.
+
+;; RUN: wasm-opt %s --crp -S -o - | filecheck %s
+
+(module
+  ;; CHECK:      (import "env" "extern" (func $extern (result i32)))
+  (import "env" "extern" (func $extern (result i32)))
+
+  ;; Always returns the same constant: calls to it can use the constant.
+  ;; CHECK:      (func $constant (result i32)
+  ;; CHECK-NEXT:  (i32.const 42)
+  ;; CHECK-NEXT: )
+  (func $constant (result i32)
+    (i32.const 42)
+  )
+
+  ;; Returns the constant both by falling off the end and via an explicit
+  ;; return: still a single possible value.
+  ;; CHECK:      (func $constant-with-return (param $x i32) (result i32)
+  ;; CHECK-NEXT:  (if
+  ;; CHECK-NEXT:   (local.get $x)
+  ;; CHECK-NEXT:   (return
+  ;; CHECK-NEXT:    (i32.const 7)
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT:  (i32.const 7)
+  ;; CHECK-NEXT: )
+  (func $constant-with-return (param $x i32) (result i32)
+    (if
+      (local.get $x)
+      (return
+        (i32.const 7)
+      )
+    )
+    (i32.const 7)
+  )
+
+  ;; Different values on different paths: nothing can be propagated.
+  ;; CHECK:      (func $varying (param $x i32) (result i32)
+  ;; CHECK-NEXT:  (if
+  ;; CHECK-NEXT:   (local.get $x)
+  ;; CHECK-NEXT:   (return
+  ;; CHECK-NEXT:    (i32.const 1)
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT:  (i32.const 2)
+  ;; CHECK-NEXT: )
+  (func $varying (param $x i32) (result i32)
+    (if
+      (local.get $x)
+      (return
+        (i32.const 1)
+      )
+    )
+    (i32.const 2)
+  )
+
+  ;; Has a side effect, so calls must be kept, but the value is still known.
+  ;; CHECK:      (func $constant-with-effects (result i32)
+  ;; CHECK-NEXT:  (drop
+  ;; CHECK-NEXT:   (call $extern)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT:  (i32.const 42)
+  ;; CHECK-NEXT: )
+  (func $constant-with-effects (result i32)
+    (drop
+      (call $extern)
+    )
+    (i32.const 42)
+  )
+
+  ;; CHECK:      (func $caller (result i32)
+  ;; CHECK-NEXT:  (i32.add
+  ;; CHECK-NEXT:   (i32.add
+  ;; CHECK-NEXT:    (block (result i32)
+  ;; CHECK-NEXT:     (drop
+  ;; CHECK-NEXT:      (call $constant)
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:     (i32.const 42)
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:    (block (result i32)
+  ;; CHECK-NEXT:     (drop
+  ;; CHECK-NEXT:      (call $constant-with-return
+  ;; CHECK-NEXT:       (i32.const 0)
+  ;; CHECK-NEXT:      )
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:     (i32.const 7)
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:   (i32.add
+  ;; CHECK-NEXT:    (call $varying
+  ;; CHECK-NEXT:     (i32.const 0)
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:    (block (result i32)
+  ;; CHECK-NEXT:     (drop
+  ;; CHECK-NEXT:      (call $constant-with-effects)
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:     (i32.const 42)
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  (func $caller (result i32)
+    (i32.add
+      (i32.add
+        (call $constant)
+        (call $constant-with-return
+          (i32.const 0)
+        )
+      )
+      (i32.add
+        (call $varying
+          (i32.const 0)
+        )
+        (call $constant-with-effects)
+      )
+    )
+  )
+)
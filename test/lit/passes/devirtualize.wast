@@ -0,0 +1,122 @@
+;; NOTE: Assertions have been generated by update_lit_checks.py and should not be edited.
+
+;; RUN: wasm-opt %s -all --nominal --devirtualize -S -o - | filecheck %s
+
+(module
+  ;; CHECK:      (type $void (func_subtype func))
+  (type $void (func))
+  ;; CHECK:      (type $work (func_subtype (param i32) (result i32) func))
+  (type $work (func (param i32) (result i32)))
+
+  ;; CHECK:      (global $target (ref $void) (ref.func $a))
+  (global $target (ref $void) (ref.func $a))
+
+  ;; Referenced in the global above: the only referable function of type $void.
+  ;; CHECK:      (table $t 2 2 funcref)
+
+  ;; CHECK:      (elem (i32.const 0) $b $c)
+
+  ;; CHECK:      (func $a (type $void)
+  ;; CHECK-NEXT:  (nop)
+  ;; CHECK-NEXT: )
+  (func $a (type $void)
+    (nop)
+  )
+
+  ;; Both of these are referenced from the table, so calls through type $work
+  ;; have two possible targets and stay indirect.
+  ;; CHECK:      (func $b (type $work) (param $x i32) (result i32)
+  ;; CHECK-NEXT:  (local.get $x)
+  ;; CHECK-NEXT: )
+  (func $b (type $work) (param $x i32) (result i32)
+    (local.get $x)
+  )
+  ;; CHECK:      (func $c (type $work) (param $x i32) (result i32)
+  ;; CHECK-NEXT:  (i32.const 1)
+  ;; CHECK-NEXT: )
+  (func $c (type $work) (param $x i32) (result i32)
+    (i32.const 1)
+  )
+
+  (table $t 2 2 funcref)
+  (elem (i32.const 0) $b $c)
+
+  ;; A literal target devirtualizes to a direct call.
+  ;; CHECK:      (func $call-literal (type $void)
+  ;; CHECK-NEXT:  (drop
+  ;; CHECK-NEXT:   (ref.func $a)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT:  (call $a)
+  ;; CHECK-NEXT: )
+  (func $call-literal
+    (call_ref
+      (ref.func $a)
+    )
+  )
+
+  ;; An immutable global holding a function reference devirtualizes too.
+  ;; CHECK:      (func $call-global (type $void)
+  ;; CHECK-NEXT:  (drop
+  ;; CHECK-NEXT:   (global.get $target)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT:  (call $a)
+  ;; CHECK-NEXT: )
+  (func $call-global
+    (call_ref
+      (global.get $target)
+    )
+  )
+
+  ;; The param merges a function literal and a null, so all GUFA knows is its
+  ;; exact type - but $a is the only referable function of that type, so the
+  ;; call devirtualizes, with a ref.as_non_null keeping the trap on null.
+  ;; CHECK:      (func $call-only-function (type $ref?|$void|_=>_none) (param $f (ref null $void))
+  ;; CHECK-NEXT:  (drop
+  ;; CHECK-NEXT:   (ref.as_non_null
+  ;; CHECK-NEXT:    (local.get $f)
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT:  (call $a)
+  ;; CHECK-NEXT: )
+  (func $call-only-function (param $f (ref null $void))
+    (call_ref
+      (local.get $f)
+    )
+  )
+
+  ;; CHECK:      (func $send-ref (type $void)
+  ;; CHECK-NEXT:  (call $call-only-function
+  ;; CHECK-NEXT:   (ref.func $a)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  (func $send-ref
+    (call $call-only-function
+      (ref.func $a)
+    )
+  )
+
+  ;; CHECK:      (func $send-null (type $void)
+  ;; CHECK-NEXT:  (call $call-only-function
+  ;; CHECK-NEXT:   (ref.null $void)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  (func $send-null
+    (call $call-only-function
+      (ref.null $void)
+    )
+  )
+
+  ;; Two functions of type $work can be referenced, so this stays a call_ref.
+  ;; CHECK:      (func $call-ambiguous (type $ref|$work|_=>_i32) (param $f (ref $work)) (result i32)
+  ;; CHECK-NEXT:  (call_ref
+  ;; CHECK-NEXT:   (i32.const 5)
+  ;; CHECK-NEXT:   (local.get $f)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  (func $call-ambiguous (export "ambiguous") (param $f (ref $work)) (result i32)
+    (call_ref
+      (i32.const 5)
+      (local.get $f)
+    )
+  )
+)
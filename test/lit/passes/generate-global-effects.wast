@@ -0,0 +1,66 @@
+;; NOTE: Assertions have been generated by update_lit_checks.py and should not be edited.
+
+;; Without computed global effects, vacuum must assume any call can have side
+;; effects; with them, the dropped call to the effect-free helper vanishes.
+
+;; RUN: wasm-opt %s                          --vacuum -S -o - | filecheck %s --check-prefix WITHOUT
+;; RUN: wasm-opt %s --generate-global-effects --vacuum -S -o - | filecheck %s --check-prefix WITH
+
+(module
+  ;; WITHOUT:      (global $g (mut i32) (i32.const 0))
+  ;; WITH:      (global $g (mut i32) (i32.const 0))
+  (global $g (mut i32) (i32.const 0))
+
+  ;; No side effects at all.
+  ;; WITHOUT:      (func $pure (result i32)
+  ;; WITHOUT-NEXT:  (i32.const 42)
+  ;; WITHOUT-NEXT: )
+  ;; WITH:      (func $pure (result i32)
+  ;; WITH-NEXT:  (i32.const 42)
+  ;; WITH-NEXT: )
+  (func $pure (result i32)
+    (i32.const 42)
+  )
+
+  ;; Writes a global, so calls to it must be kept either way.
+  ;; WITHOUT:      (func $impure (result i32)
+  ;; WITHOUT-NEXT:  (global.set $g
+  ;; WITHOUT-NEXT:   (i32.const 1)
+  ;; WITHOUT-NEXT:  )
+  ;; WITHOUT-NEXT:  (i32.const 42)
+  ;; WITHOUT-NEXT: )
+  ;; WITH:      (func $impure (result i32)
+  ;; WITH-NEXT:  (global.set $g
+  ;; WITH-NEXT:   (i32.const 1)
+  ;; WITH-NEXT:  )
+  ;; WITH-NEXT:  (i32.const 42)
+  ;; WITH-NEXT: )
+  (func $impure (result i32)
+    (global.set $g
+      (i32.const 1)
+    )
+    (i32.const 42)
+  )
+
+  ;; WITHOUT:      (func $caller
+  ;; WITHOUT-NEXT:  (drop
+  ;; WITHOUT-NEXT:   (call $pure)
+  ;; WITHOUT-NEXT:  )
+  ;; WITHOUT-NEXT:  (drop
+  ;; WITHOUT-NEXT:   (call $impure)
+  ;; WITHOUT-NEXT:  )
+  ;; WITHOUT-NEXT: )
+  ;; WITH:      (func $caller
+  ;; WITH-NEXT:  (drop
+  ;; WITH-NEXT:   (call $impure)
+  ;; WITH-NEXT:  )
+  ;; WITH-NEXT: )
+  (func $caller
+    (drop
+      (call $pure)
+    )
+    (drop
+      (call $impure)
+    )
+  )
+)
@@ -298,14 +298,12 @@
  ;; CHECK-NEXT:  (local $11 i32)
  ;; CHECK-NEXT:  (local $12 i32)
  ;; CHECK-NEXT:  (local $13 i32)
- ;; CHECK-NEXT:  (local.set $8
- ;; CHECK-NEXT:   (local.tee $4
- ;; CHECK-NEXT:    (global.get $STACKTOP)
- ;; CHECK-NEXT:   )
+ ;; CHECK-NEXT:  (local.set $9
+ ;; CHECK-NEXT:   (global.get $STACKTOP)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (global.set $STACKTOP
  ;; CHECK-NEXT:   (i32.add
- ;; CHECK-NEXT:    (local.get $4)
+ ;; CHECK-NEXT:    (global.get $STACKTOP)
  ;; CHECK-NEXT:    (i32.const 16)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
@@ -316,11 +314,12 @@
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (call $abort)
  ;; CHECK-NEXT:  )
+ ;; CHECK-NEXT:  (local.set $5
+ ;; CHECK-NEXT:   (global.get $STACKTOP)
+ ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (global.set $STACKTOP
  ;; CHECK-NEXT:   (i32.add
- ;; CHECK-NEXT:    (local.tee $4
- ;; CHECK-NEXT:     (global.get $STACKTOP)
- ;; CHECK-NEXT:    )
+ ;; CHECK-NEXT:    (global.get $STACKTOP)
  ;; CHECK-NEXT:    (i32.const 16)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
@@ -332,19 +331,23 @@
  ;; CHECK-NEXT:   (call $abort)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (i32.store
- ;; CHECK-NEXT:   (local.get $4)
- ;; CHECK-NEXT:   (local.get $8)
+ ;; CHECK-NEXT:   (local.get $5)
+ ;; CHECK-NEXT:   (local.get $9)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (local.set $0
  ;; CHECK-NEXT:   (i32.load
  ;; CHECK-NEXT:    (i32.const 8)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
+ ;; CHECK-NEXT:  (local.set $6
+ ;; CHECK-NEXT:   (local.get $5)
+ ;; CHECK-NEXT:  )
+ ;; CHECK-NEXT:  (local.set $1
+ ;; CHECK-NEXT:   (global.get $STACKTOP)
+ ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (global.set $STACKTOP
  ;; CHECK-NEXT:   (i32.add
- ;; CHECK-NEXT:    (local.tee $1
- ;; CHECK-NEXT:     (global.get $STACKTOP)
- ;; CHECK-NEXT:    )
+ ;; CHECK-NEXT:    (global.get $STACKTOP)
  ;; CHECK-NEXT:    (i32.const 224)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
@@ -361,13 +364,13 @@
  ;; CHECK-NEXT:    (i32.const 120)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
- ;; CHECK-NEXT:  (local.set $5
+ ;; CHECK-NEXT:  (local.set $4
  ;; CHECK-NEXT:   (i32.add
  ;; CHECK-NEXT:    (local.get $1)
  ;; CHECK-NEXT:    (i32.const 136)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
- ;; CHECK-NEXT:  (local.set $6
+ ;; CHECK-NEXT:  (local.set $8
  ;; CHECK-NEXT:   (i32.add
  ;; CHECK-NEXT:    (local.tee $3
  ;; CHECK-NEXT:     (local.tee $7
@@ -393,14 +396,14 @@
  ;; CHECK-NEXT:       (i32.const 4)
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:     )
- ;; CHECK-NEXT:     (local.get $6)
+ ;; CHECK-NEXT:     (local.get $8)
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (i32.store
  ;; CHECK-NEXT:   (local.get $2)
  ;; CHECK-NEXT:   (i32.load
- ;; CHECK-NEXT:    (local.get $4)
+ ;; CHECK-NEXT:    (local.get $6)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (drop
@@ -422,7 +425,7 @@
  ;; CHECK-NEXT:       (local.get $0)
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:     )
- ;; CHECK-NEXT:     (local.set $3
+ ;; CHECK-NEXT:     (local.set $10
  ;; CHECK-NEXT:      (i32.load
  ;; CHECK-NEXT:       (local.get $0)
  ;; CHECK-NEXT:      )
@@ -437,14 +440,14 @@
  ;; CHECK-NEXT:      (i32.store
  ;; CHECK-NEXT:       (local.get $0)
  ;; CHECK-NEXT:       (i32.and
- ;; CHECK-NEXT:        (local.get $3)
+ ;; CHECK-NEXT:        (local.get $10)
  ;; CHECK-NEXT:        (i32.const -33)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:     )
  ;; CHECK-NEXT:     (if
  ;; CHECK-NEXT:      (i32.load
- ;; CHECK-NEXT:       (local.tee $6
+ ;; CHECK-NEXT:       (local.tee $11
  ;; CHECK-NEXT:        (i32.add
  ;; CHECK-NEXT:         (local.get $0)
  ;; CHECK-NEXT:         (i32.const 48)
@@ -461,9 +464,9 @@
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:      (block
- ;; CHECK-NEXT:       (local.set $10
+ ;; CHECK-NEXT:       (local.set $13
  ;; CHECK-NEXT:        (i32.load
- ;; CHECK-NEXT:         (local.tee $9
+ ;; CHECK-NEXT:         (local.tee $12
  ;; CHECK-NEXT:          (i32.add
  ;; CHECK-NEXT:           (local.get $0)
  ;; CHECK-NEXT:           (i32.const 44)
@@ -472,40 +475,40 @@
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:       (i32.store
- ;; CHECK-NEXT:        (local.get $9)
- ;; CHECK-NEXT:        (local.get $5)
+ ;; CHECK-NEXT:        (local.get $12)
+ ;; CHECK-NEXT:        (local.get $4)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:       (i32.store
- ;; CHECK-NEXT:        (local.tee $12
+ ;; CHECK-NEXT:        (local.tee $8
  ;; CHECK-NEXT:         (i32.add
  ;; CHECK-NEXT:          (local.get $0)
  ;; CHECK-NEXT:          (i32.const 28)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:        (local.get $5)
+ ;; CHECK-NEXT:        (local.get $4)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:       (i32.store
- ;; CHECK-NEXT:        (local.tee $11
+ ;; CHECK-NEXT:        (local.tee $3
  ;; CHECK-NEXT:         (i32.add
  ;; CHECK-NEXT:          (local.get $0)
  ;; CHECK-NEXT:          (i32.const 20)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:        (local.get $5)
+ ;; CHECK-NEXT:        (local.get $4)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:       (i32.store
- ;; CHECK-NEXT:        (local.get $6)
+ ;; CHECK-NEXT:        (local.get $11)
  ;; CHECK-NEXT:        (i32.const 80)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:       (i32.store
- ;; CHECK-NEXT:        (local.tee $13
+ ;; CHECK-NEXT:        (local.tee $6
  ;; CHECK-NEXT:         (i32.add
  ;; CHECK-NEXT:          (local.get $0)
  ;; CHECK-NEXT:          (i32.const 16)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:        (i32.add
- ;; CHECK-NEXT:         (local.get $5)
+ ;; CHECK-NEXT:         (local.get $4)
  ;; CHECK-NEXT:         (i32.const 80)
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:       )
@@ -519,7 +522,7 @@
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:       (if
- ;; CHECK-NEXT:        (local.get $10)
+ ;; CHECK-NEXT:        (local.get $13)
  ;; CHECK-NEXT:        (block
  ;; CHECK-NEXT:         (drop
  ;; CHECK-NEXT:          (call_indirect (type $FUNCSIG$iiii)
@@ -539,27 +542,27 @@
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (drop
  ;; CHECK-NEXT:          (i32.load
- ;; CHECK-NEXT:           (local.get $11)
+ ;; CHECK-NEXT:           (local.get $3)
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (i32.store
- ;; CHECK-NEXT:          (local.get $9)
- ;; CHECK-NEXT:          (local.get $10)
+ ;; CHECK-NEXT:          (local.get $12)
+ ;; CHECK-NEXT:          (local.get $13)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (i32.store
- ;; CHECK-NEXT:          (local.get $6)
+ ;; CHECK-NEXT:          (local.get $11)
  ;; CHECK-NEXT:          (i32.const 0)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (i32.store
- ;; CHECK-NEXT:          (local.get $13)
+ ;; CHECK-NEXT:          (local.get $6)
  ;; CHECK-NEXT:          (i32.const 0)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (i32.store
- ;; CHECK-NEXT:          (local.get $12)
+ ;; CHECK-NEXT:          (local.get $8)
  ;; CHECK-NEXT:          (i32.const 0)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (i32.store
- ;; CHECK-NEXT:          (local.get $11)
+ ;; CHECK-NEXT:          (local.get $3)
  ;; CHECK-NEXT:          (i32.const 0)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:        )
@@ -573,7 +576,7 @@
  ;; CHECK-NEXT:        (local.get $0)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:       (i32.and
- ;; CHECK-NEXT:        (local.get $3)
+ ;; CHECK-NEXT:        (local.get $10)
  ;; CHECK-NEXT:        (i32.const 32)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
@@ -586,10 +589,10 @@
  ;; CHECK-NEXT:   (local.get $1)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (global.set $STACKTOP
- ;; CHECK-NEXT:   (local.get $4)
+ ;; CHECK-NEXT:   (local.get $5)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (global.set $STACKTOP
- ;; CHECK-NEXT:   (local.get $8)
+ ;; CHECK-NEXT:   (local.get $9)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (i32.const 0)
  ;; CHECK-NEXT: )
@@ -1332,7 +1335,7 @@
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:     )
- ;; CHECK-NEXT:     (local.tee $0
+ ;; CHECK-NEXT:     (local.tee $1
  ;; CHECK-NEXT:      (call $___fflush_unlocked
  ;; CHECK-NEXT:       (local.get $0)
  ;; CHECK-NEXT:      )
@@ -2568,7 +2571,7 @@
  ;; CHECK-NEXT:    (br_if $__rjti$0
  ;; CHECK-NEXT:     (local.tee $3
  ;; CHECK-NEXT:      (i32.load
- ;; CHECK-NEXT:       (local.tee $5
+ ;; CHECK-NEXT:       (local.tee $4
  ;; CHECK-NEXT:        (i32.add
  ;; CHECK-NEXT:         (local.get $2)
  ;; CHECK-NEXT:         (i32.const 16)
@@ -2579,7 +2582,7 @@
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:    (local.set $3
  ;; CHECK-NEXT:     (i32.load8_s
- ;; CHECK-NEXT:      (local.tee $4
+ ;; CHECK-NEXT:      (local.tee $5
  ;; CHECK-NEXT:       (i32.add
  ;; CHECK-NEXT:        (local.get $2)
  ;; CHECK-NEXT:        (i32.const 74)
@@ -2588,7 +2591,7 @@
  ;; CHECK-NEXT:     )
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:    (i32.store8
- ;; CHECK-NEXT:     (local.get $4)
+ ;; CHECK-NEXT:     (local.get $5)
  ;; CHECK-NEXT:     (i32.or
  ;; CHECK-NEXT:      (i32.add
  ;; CHECK-NEXT:       (local.get $3)
@@ -2655,7 +2658,7 @@
  ;; CHECK-NEXT:      (block
  ;; CHECK-NEXT:       (local.set $3
  ;; CHECK-NEXT:        (i32.load
- ;; CHECK-NEXT:         (local.get $5)
+ ;; CHECK-NEXT:         (local.get $4)
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:       (br $__rjti$0)
@@ -2668,9 +2671,9 @@
  ;; CHECK-NEXT:    (i32.lt_u
  ;; CHECK-NEXT:     (i32.sub
  ;; CHECK-NEXT:      (local.get $3)
- ;; CHECK-NEXT:      (local.tee $6
+ ;; CHECK-NEXT:      (local.tee $4
  ;; CHECK-NEXT:       (i32.load
- ;; CHECK-NEXT:        (local.tee $4
+ ;; CHECK-NEXT:        (local.tee $6
  ;; CHECK-NEXT:         (i32.add
  ;; CHECK-NEXT:          (local.get $2)
  ;; CHECK-NEXT:          (i32.const 20)
@@ -2764,9 +2767,9 @@
  ;; CHECK-NEXT:        (local.get $3)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
- ;; CHECK-NEXT:      (local.set $6
+ ;; CHECK-NEXT:      (local.set $4
  ;; CHECK-NEXT:       (i32.load
- ;; CHECK-NEXT:        (local.get $4)
+ ;; CHECK-NEXT:        (local.get $6)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:      (local.set $1
@@ -2787,17 +2790,163 @@
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (drop
- ;; CHECK-NEXT:    (call $_memcpy
- ;; CHECK-NEXT:     (local.get $6)
- ;; CHECK-NEXT:     (local.get $0)
- ;; CHECK-NEXT:     (local.get $1)
+ ;; CHECK-NEXT:    (block $__inlined_func$byn-split-inlineable-C$_memcpy (result i32)
+ ;; CHECK-NEXT:     (if
+ ;; CHECK-NEXT:      (i32.ge_s
+ ;; CHECK-NEXT:       (local.get $1)
+ ;; CHECK-NEXT:       (i32.const 4096)
+ ;; CHECK-NEXT:      )
+ ;; CHECK-NEXT:      (br $__inlined_func$byn-split-inlineable-C$_memcpy
+ ;; CHECK-NEXT:       (call $_emscripten_memcpy_big
+ ;; CHECK-NEXT:        (local.get $4)
+ ;; CHECK-NEXT:        (local.get $0)
+ ;; CHECK-NEXT:        (local.get $1)
+ ;; CHECK-NEXT:       )
+ ;; CHECK-NEXT:      )
+ ;; CHECK-NEXT:     )
+ ;; CHECK-NEXT:     (block $__inlined_func$byn-split-outlined-C$_memcpy (result i32)
+ ;; CHECK-NEXT:      (local.set $3
+ ;; CHECK-NEXT:       (local.get $1)
+ ;; CHECK-NEXT:      )
+ ;; CHECK-NEXT:      (local.set $5
+ ;; CHECK-NEXT:       (local.get $4)
+ ;; CHECK-NEXT:      )
+ ;; CHECK-NEXT:      (if
+ ;; CHECK-NEXT:       (i32.eq
+ ;; CHECK-NEXT:        (i32.and
+ ;; CHECK-NEXT:         (local.get $4)
+ ;; CHECK-NEXT:         (i32.const 3)
+ ;; CHECK-NEXT:        )
+ ;; CHECK-NEXT:        (i32.and
+ ;; CHECK-NEXT:         (local.get $0)
+ ;; CHECK-NEXT:         (i32.const 3)
+ ;; CHECK-NEXT:        )
+ ;; CHECK-NEXT:       )
+ ;; CHECK-NEXT:       (block
+ ;; CHECK-NEXT:        (loop $while-in0
+ ;; CHECK-NEXT:         (if
+ ;; CHECK-NEXT:          (i32.and
+ ;; CHECK-NEXT:           (local.get $4)
+ ;; CHECK-NEXT:           (i32.const 3)
+ ;; CHECK-NEXT:          )
+ ;; CHECK-NEXT:          (block
+ ;; CHECK-NEXT:           (drop
+ ;; CHECK-NEXT:            (br_if $__inlined_func$byn-split-outlined-C$_memcpy
+ ;; CHECK-NEXT:             (local.get $5)
+ ;; CHECK-NEXT:             (i32.eqz
+ ;; CHECK-NEXT:              (local.get $3)
+ ;; CHECK-NEXT:             )
+ ;; CHECK-NEXT:            )
+ ;; CHECK-NEXT:           )
+ ;; CHECK-NEXT:           (i32.store8
+ ;; CHECK-NEXT:            (local.get $4)
+ ;; CHECK-NEXT:            (i32.load8_s
+ ;; CHECK-NEXT:             (local.get $0)
+ ;; CHECK-NEXT:            )
+ ;; CHECK-NEXT:           )
+ ;; CHECK-NEXT:           (local.set $4
+ ;; CHECK-NEXT:            (i32.add
+ ;; CHECK-NEXT:             (local.get $4)
+ ;; CHECK-NEXT:             (i32.const 1)
+ ;; CHECK-NEXT:            )
+ ;; CHECK-NEXT:           )
+ ;; CHECK-NEXT:           (local.set $0
+ ;; CHECK-NEXT:            (i32.add
+ ;; CHECK-NEXT:             (local.get $0)
+ ;; CHECK-NEXT:             (i32.const 1)
+ ;; CHECK-NEXT:            )
+ ;; CHECK-NEXT:           )
+ ;; CHECK-NEXT:           (local.set $3
+ ;; CHECK-NEXT:            (i32.sub
+ ;; CHECK-NEXT:             (local.get $3)
+ ;; CHECK-NEXT:             (i32.const 1)
+ ;; CHECK-NEXT:            )
+ ;; CHECK-NEXT:           )
+ ;; CHECK-NEXT:           (br $while-in0)
+ ;; CHECK-NEXT:          )
+ ;; CHECK-NEXT:         )
+ ;; CHECK-NEXT:        )
+ ;; CHECK-NEXT:        (loop $while-in1
+ ;; CHECK-NEXT:         (if
+ ;; CHECK-NEXT:          (i32.ge_s
+ ;; CHECK-NEXT:           (local.get $3)
+ ;; CHECK-NEXT:           (i32.const 4)
+ ;; CHECK-NEXT:          )
+ ;; CHECK-NEXT:          (block
+ ;; CHECK-NEXT:           (i32.store
+ ;; CHECK-NEXT:            (local.get $4)
+ ;; CHECK-NEXT:            (i32.load
+ ;; CHECK-NEXT:             (local.get $0)
+ ;; CHECK-NEXT:            )
+ ;; CHECK-NEXT:           )
+ ;; CHECK-NEXT:           (local.set $4
+ ;; CHECK-NEXT:            (i32.add
+ ;; CHECK-NEXT:             (local.get $4)
+ ;; CHECK-NEXT:             (i32.const 4)
+ ;; CHECK-NEXT:            )
+ ;; CHECK-NEXT:           )
+ ;; CHECK-NEXT:           (local.set $0
+ ;; CHECK-NEXT:            (i32.add
+ ;; CHECK-NEXT:             (local.get $0)
+ ;; CHECK-NEXT:             (i32.const 4)
+ ;; CHECK-NEXT:            )
+ ;; CHECK-NEXT:           )
+ ;; CHECK-NEXT:           (local.set $3
+ ;; CHECK-NEXT:            (i32.sub
+ ;; CHECK-NEXT:             (local.get $3)
+ ;; CHECK-NEXT:             (i32.const 4)
+ ;; CHECK-NEXT:            )
+ ;; CHECK-NEXT:           )
+ ;; CHECK-NEXT:           (br $while-in1)
+ ;; CHECK-NEXT:          )
+ ;; CHECK-NEXT:         )
+ ;; CHECK-NEXT:        )
+ ;; CHECK-NEXT:       )
+ ;; CHECK-NEXT:      )
+ ;; CHECK-NEXT:      (loop $while-in3
+ ;; CHECK-NEXT:       (if
+ ;; CHECK-NEXT:        (i32.gt_s
+ ;; CHECK-NEXT:         (local.get $3)
+ ;; CHECK-NEXT:         (i32.const 0)
+ ;; CHECK-NEXT:        )
+ ;; CHECK-NEXT:        (block
+ ;; CHECK-NEXT:         (i32.store8
+ ;; CHECK-NEXT:          (local.get $4)
+ ;; CHECK-NEXT:          (i32.load8_s
+ ;; CHECK-NEXT:           (local.get $0)
+ ;; CHECK-NEXT:          )
+ ;; CHECK-NEXT:         )
+ ;; CHECK-NEXT:         (local.set $4
+ ;; CHECK-NEXT:          (i32.add
+ ;; CHECK-NEXT:           (local.get $4)
+ ;; CHECK-NEXT:           (i32.const 1)
+ ;; CHECK-NEXT:          )
+ ;; CHECK-NEXT:         )
+ ;; CHECK-NEXT:         (local.set $0
+ ;; CHECK-NEXT:          (i32.add
+ ;; CHECK-NEXT:           (local.get $0)
+ ;; CHECK-NEXT:           (i32.const 1)
+ ;; CHECK-NEXT:          )
+ ;; CHECK-NEXT:         )
+ ;; CHECK-NEXT:         (local.set $3
+ ;; CHECK-NEXT:          (i32.sub
+ ;; CHECK-NEXT:           (local.get $3)
+ ;; CHECK-NEXT:           (i32.const 1)
+ ;; CHECK-NEXT:          )
+ ;; CHECK-NEXT:         )
+ ;; CHECK-NEXT:         (br $while-in3)
+ ;; CHECK-NEXT:        )
+ ;; CHECK-NEXT:       )
+ ;; CHECK-NEXT:      )
+ ;; CHECK-NEXT:      (i32.const 0)
+ ;; CHECK-NEXT:     )
  ;; CHECK-NEXT:    )
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:   (i32.store
- ;; CHECK-NEXT:    (local.get $4)
+ ;; CHECK-NEXT:    (local.get $6)
  ;; CHECK-NEXT:    (i32.add
  ;; CHECK-NEXT:     (i32.load
- ;; CHECK-NEXT:      (local.get $4)
+ ;; CHECK-NEXT:      (local.get $6)
  ;; CHECK-NEXT:     )
  ;; CHECK-NEXT:     (local.get $1)
  ;; CHECK-NEXT:    )
@@ -4079,14 +4228,13 @@
  ;; CHECK-NEXT:  (local $43 i32)
  ;; CHECK-NEXT:  (local $44 i32)
  ;; CHECK-NEXT:  (local $45 i32)
- ;; CHECK-NEXT:  (local.set $13
- ;; CHECK-NEXT:   (local.tee $5
- ;; CHECK-NEXT:    (global.get $STACKTOP)
- ;; CHECK-NEXT:   )
+ ;; CHECK-NEXT:  (local $46 i32)
+ ;; CHECK-NEXT:  (local.set $15
+ ;; CHECK-NEXT:   (global.get $STACKTOP)
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (global.set $STACKTOP
  ;; CHECK-NEXT:   (i32.add
- ;; CHECK-NEXT:    (local.get $5)
+ ;; CHECK-NEXT:    (global.get $STACKTOP)
  ;; CHECK-NEXT:    (i32.const 624)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
@@ -4099,13 +4247,13 @@
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (local.set $21
  ;; CHECK-NEXT:   (i32.add
- ;; CHECK-NEXT:    (local.get $13)
+ ;; CHECK-NEXT:    (local.get $15)
  ;; CHECK-NEXT:    (i32.const 16)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
- ;; CHECK-NEXT:  (local.set $33
+ ;; CHECK-NEXT:  (local.set $34
  ;; CHECK-NEXT:   (i32.add
- ;; CHECK-NEXT:    (local.get $13)
+ ;; CHECK-NEXT:    (local.get $15)
  ;; CHECK-NEXT:    (i32.const 528)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
@@ -4119,7 +4267,7 @@
  ;; CHECK-NEXT:   (i32.add
  ;; CHECK-NEXT:    (local.tee $5
  ;; CHECK-NEXT:     (i32.add
- ;; CHECK-NEXT:      (local.get $13)
+ ;; CHECK-NEXT:      (local.get $15)
  ;; CHECK-NEXT:      (i32.const 536)
  ;; CHECK-NEXT:     )
  ;; CHECK-NEXT:    )
@@ -4136,7 +4284,7 @@
  ;; CHECK-NEXT:   (i32.add
  ;; CHECK-NEXT:    (local.tee $37
  ;; CHECK-NEXT:     (i32.add
- ;; CHECK-NEXT:      (local.get $13)
+ ;; CHECK-NEXT:      (local.get $15)
  ;; CHECK-NEXT:      (i32.const 8)
  ;; CHECK-NEXT:     )
  ;; CHECK-NEXT:    )
@@ -4147,7 +4295,7 @@
  ;; CHECK-NEXT:   (i32.add
  ;; CHECK-NEXT:    (local.tee $5
  ;; CHECK-NEXT:     (i32.add
- ;; CHECK-NEXT:      (local.get $13)
+ ;; CHECK-NEXT:      (local.get $15)
  ;; CHECK-NEXT:      (i32.const 576)
  ;; CHECK-NEXT:     )
  ;; CHECK-NEXT:    )
@@ -4165,7 +4313,7 @@
  ;; CHECK-NEXT:    (local.get $24)
  ;; CHECK-NEXT:    (local.tee $22
  ;; CHECK-NEXT:     (i32.add
- ;; CHECK-NEXT:      (local.get $13)
+ ;; CHECK-NEXT:      (local.get $15)
  ;; CHECK-NEXT:      (i32.const 588)
  ;; CHECK-NEXT:     )
  ;; CHECK-NEXT:    )
@@ -4187,7 +4335,7 @@
  ;; CHECK-NEXT:   (i32.add
  ;; CHECK-NEXT:    (local.tee $43
  ;; CHECK-NEXT:     (i32.add
- ;; CHECK-NEXT:      (local.get $13)
+ ;; CHECK-NEXT:      (local.get $15)
  ;; CHECK-NEXT:      (i32.const 24)
  ;; CHECK-NEXT:     )
  ;; CHECK-NEXT:    )
@@ -4200,15 +4348,21 @@
  ;; CHECK-NEXT:    (i32.const 9)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
- ;; CHECK-NEXT:  (local.set $32
+ ;; CHECK-NEXT:  (local.set $33
  ;; CHECK-NEXT:   (i32.add
  ;; CHECK-NEXT:    (local.get $22)
  ;; CHECK-NEXT:    (i32.const 8)
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
+ ;; CHECK-NEXT:  (local.set $17
+ ;; CHECK-NEXT:   (i32.const 0)
+ ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (local.set $5
  ;; CHECK-NEXT:   (local.get $1)
  ;; CHECK-NEXT:  )
+ ;; CHECK-NEXT:  (local.set $11
+ ;; CHECK-NEXT:   (i32.const 0)
+ ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (local.set $1
  ;; CHECK-NEXT:   (i32.const 0)
  ;; CHECK-NEXT:  )
@@ -4218,16 +4372,16 @@
  ;; CHECK-NEXT:     (block $label$break$L1
  ;; CHECK-NEXT:      (if
  ;; CHECK-NEXT:       (i32.ge_s
- ;; CHECK-NEXT:        (local.get $18)
+ ;; CHECK-NEXT:        (local.get $17)
  ;; CHECK-NEXT:        (i32.const 0)
  ;; CHECK-NEXT:       )
- ;; CHECK-NEXT:       (local.set $18
+ ;; CHECK-NEXT:       (local.set $17
  ;; CHECK-NEXT:        (if (result i32)
  ;; CHECK-NEXT:         (i32.gt_s
- ;; CHECK-NEXT:          (local.get $10)
+ ;; CHECK-NEXT:          (local.get $11)
  ;; CHECK-NEXT:          (i32.sub
  ;; CHECK-NEXT:           (i32.const 2147483647)
- ;; CHECK-NEXT:           (local.get $18)
+ ;; CHECK-NEXT:           (local.get $17)
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (block (result i32)
@@ -4238,22 +4392,22 @@
  ;; CHECK-NEXT:          (i32.const -1)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (i32.add
- ;; CHECK-NEXT:          (local.get $10)
- ;; CHECK-NEXT:          (local.get $18)
+ ;; CHECK-NEXT:          (local.get $11)
+ ;; CHECK-NEXT:          (local.get $17)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:      (br_if $__rjti$9
  ;; CHECK-NEXT:       (i32.eqz
- ;; CHECK-NEXT:        (local.tee $7
+ ;; CHECK-NEXT:        (local.tee $6
  ;; CHECK-NEXT:         (i32.load8_s
  ;; CHECK-NEXT:          (local.get $5)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
- ;; CHECK-NEXT:      (local.set $10
+ ;; CHECK-NEXT:      (local.set $11
  ;; CHECK-NEXT:       (local.get $5)
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:      (block $label$break$L12
@@ -4266,28 +4420,28 @@
  ;; CHECK-NEXT:             (br_table $switch-case0 $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-default $switch-case $switch-default
  ;; CHECK-NEXT:              (i32.shr_s
  ;; CHECK-NEXT:               (i32.shl
- ;; CHECK-NEXT:                (local.get $7)
+ ;; CHECK-NEXT:                (local.get $6)
  ;; CHECK-NEXT:                (i32.const 24)
  ;; CHECK-NEXT:               )
  ;; CHECK-NEXT:               (i32.const 24)
  ;; CHECK-NEXT:              )
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:            )
- ;; CHECK-NEXT:            (local.set $6
- ;; CHECK-NEXT:             (local.get $10)
+ ;; CHECK-NEXT:            (local.set $7
+ ;; CHECK-NEXT:             (local.get $11)
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (br $__rjti$1)
  ;; CHECK-NEXT:           )
- ;; CHECK-NEXT:           (local.set $6
- ;; CHECK-NEXT:            (local.get $10)
+ ;; CHECK-NEXT:           (local.set $7
+ ;; CHECK-NEXT:            (local.get $11)
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:           (br $label$break$L9)
  ;; CHECK-NEXT:          )
- ;; CHECK-NEXT:          (local.set $7
+ ;; CHECK-NEXT:          (local.set $6
  ;; CHECK-NEXT:           (i32.load8_s
- ;; CHECK-NEXT:            (local.tee $10
+ ;; CHECK-NEXT:            (local.tee $11
  ;; CHECK-NEXT:             (i32.add
- ;; CHECK-NEXT:              (local.get $10)
+ ;; CHECK-NEXT:              (local.get $11)
  ;; CHECK-NEXT:              (i32.const 1)
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:            )
@@ -4302,23 +4456,23 @@
  ;; CHECK-NEXT:        (br_if $label$break$L12
  ;; CHECK-NEXT:         (i32.ne
  ;; CHECK-NEXT:          (i32.load8_s offset=1
- ;; CHECK-NEXT:           (local.get $6)
+ ;; CHECK-NEXT:           (local.get $7)
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:          (i32.const 37)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:        (local.set $10
+ ;; CHECK-NEXT:        (local.set $11
  ;; CHECK-NEXT:         (i32.add
- ;; CHECK-NEXT:          (local.get $10)
+ ;; CHECK-NEXT:          (local.get $11)
  ;; CHECK-NEXT:          (i32.const 1)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:        (br_if $while-in
  ;; CHECK-NEXT:         (i32.eq
  ;; CHECK-NEXT:          (i32.load8_s
- ;; CHECK-NEXT:           (local.tee $6
+ ;; CHECK-NEXT:           (local.tee $7
  ;; CHECK-NEXT:            (i32.add
- ;; CHECK-NEXT:             (local.get $6)
+ ;; CHECK-NEXT:             (local.get $7)
  ;; CHECK-NEXT:             (i32.const 2)
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:           )
@@ -4328,9 +4482,9 @@
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
- ;; CHECK-NEXT:      (local.set $7
+ ;; CHECK-NEXT:      (local.set $6
  ;; CHECK-NEXT:       (i32.sub
- ;; CHECK-NEXT:        (local.get $10)
+ ;; CHECK-NEXT:        (local.get $11)
  ;; CHECK-NEXT:        (local.get $5)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
@@ -4348,7 +4502,7 @@
  ;; CHECK-NEXT:        (drop
  ;; CHECK-NEXT:         (call $___fwritex
  ;; CHECK-NEXT:          (local.get $5)
- ;; CHECK-NEXT:          (local.get $7)
+ ;; CHECK-NEXT:          (local.get $6)
  ;; CHECK-NEXT:          (local.get $0)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:        )
@@ -4357,15 +4511,15 @@
  ;; CHECK-NEXT:      (if
  ;; CHECK-NEXT:       (i32.ne
  ;; CHECK-NEXT:        (local.get $5)
- ;; CHECK-NEXT:        (local.get $10)
+ ;; CHECK-NEXT:        (local.get $11)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:       (block
  ;; CHECK-NEXT:        (local.set $5
- ;; CHECK-NEXT:         (local.get $6)
- ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:        (local.set $10
  ;; CHECK-NEXT:         (local.get $7)
  ;; CHECK-NEXT:        )
+ ;; CHECK-NEXT:        (local.set $11
+ ;; CHECK-NEXT:         (local.get $6)
+ ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:        (br $label$continue$L1)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
@@ -4376,9 +4530,9 @@
  ;; CHECK-NEXT:          (i32.sub
  ;; CHECK-NEXT:           (local.tee $9
  ;; CHECK-NEXT:            (i32.load8_s
- ;; CHECK-NEXT:             (local.tee $10
+ ;; CHECK-NEXT:             (local.tee $11
  ;; CHECK-NEXT:              (i32.add
- ;; CHECK-NEXT:               (local.get $6)
+ ;; CHECK-NEXT:               (local.get $7)
  ;; CHECK-NEXT:               (i32.const 1)
  ;; CHECK-NEXT:              )
  ;; CHECK-NEXT:             )
@@ -4390,19 +4544,19 @@
  ;; CHECK-NEXT:         (i32.const 10)
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:        (block (result i32)
- ;; CHECK-NEXT:         (local.set $6
+ ;; CHECK-NEXT:         (local.set $7
  ;; CHECK-NEXT:          (i32.load8_s
- ;; CHECK-NEXT:           (local.tee $10
+ ;; CHECK-NEXT:           (local.tee $11
  ;; CHECK-NEXT:            (select
  ;; CHECK-NEXT:             (i32.add
- ;; CHECK-NEXT:              (local.get $6)
+ ;; CHECK-NEXT:              (local.get $7)
  ;; CHECK-NEXT:              (i32.const 3)
  ;; CHECK-NEXT:             )
- ;; CHECK-NEXT:             (local.get $10)
+ ;; CHECK-NEXT:             (local.get $11)
  ;; CHECK-NEXT:             (local.tee $9
  ;; CHECK-NEXT:              (i32.eq
  ;; CHECK-NEXT:               (i32.load8_s offset=2
- ;; CHECK-NEXT:                (local.get $6)
+ ;; CHECK-NEXT:                (local.get $7)
  ;; CHECK-NEXT:               )
  ;; CHECK-NEXT:               (i32.const 36)
  ;; CHECK-NEXT:              )
@@ -4411,7 +4565,7 @@
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:         )
- ;; CHECK-NEXT:         (local.set $19
+ ;; CHECK-NEXT:         (local.set $18
  ;; CHECK-NEXT:          (select
  ;; CHECK-NEXT:           (local.get $8)
  ;; CHECK-NEXT:           (i32.const -1)
@@ -4425,10 +4579,10 @@
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:        (block (result i32)
- ;; CHECK-NEXT:         (local.set $6
+ ;; CHECK-NEXT:         (local.set $7
  ;; CHECK-NEXT:          (local.get $9)
  ;; CHECK-NEXT:         )
- ;; CHECK-NEXT:         (local.set $19
+ ;; CHECK-NEXT:         (local.set $18
  ;; CHECK-NEXT:          (i32.const -1)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (local.get $1)
@@ -4442,7 +4596,7 @@
  ;; CHECK-NEXT:          (local.tee $9
  ;; CHECK-NEXT:           (i32.shr_s
  ;; CHECK-NEXT:            (i32.shl
- ;; CHECK-NEXT:             (local.get $6)
+ ;; CHECK-NEXT:             (local.get $7)
  ;; CHECK-NEXT:             (i32.const 24)
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (i32.const 24)
@@ -4454,9 +4608,9 @@
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:        (block $label$break$L25 (result i32)
  ;; CHECK-NEXT:         (local.set $1
- ;; CHECK-NEXT:          (local.get $6)
+ ;; CHECK-NEXT:          (local.get $7)
  ;; CHECK-NEXT:         )
- ;; CHECK-NEXT:         (local.set $6
+ ;; CHECK-NEXT:         (local.set $7
  ;; CHECK-NEXT:          (local.get $9)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (local.set $9
@@ -4469,7 +4623,7 @@
  ;; CHECK-NEXT:             (i32.shl
  ;; CHECK-NEXT:              (i32.const 1)
  ;; CHECK-NEXT:              (i32.sub
- ;; CHECK-NEXT:               (local.get $6)
+ ;; CHECK-NEXT:               (local.get $7)
  ;; CHECK-NEXT:               (i32.const 32)
  ;; CHECK-NEXT:              )
  ;; CHECK-NEXT:             )
@@ -4477,7 +4631,7 @@
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:           (block
- ;; CHECK-NEXT:            (local.set $6
+ ;; CHECK-NEXT:            (local.set $7
  ;; CHECK-NEXT:             (local.get $1)
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (br $label$break$L25
@@ -4506,12 +4660,12 @@
  ;; CHECK-NEXT:          (br_if $while-in4
  ;; CHECK-NEXT:           (i32.eq
  ;; CHECK-NEXT:            (i32.and
- ;; CHECK-NEXT:             (local.tee $6
+ ;; CHECK-NEXT:             (local.tee $7
  ;; CHECK-NEXT:              (local.tee $1
  ;; CHECK-NEXT:               (i32.load8_s
- ;; CHECK-NEXT:                (local.tee $10
+ ;; CHECK-NEXT:                (local.tee $11
  ;; CHECK-NEXT:                 (i32.add
- ;; CHECK-NEXT:                  (local.get $10)
+ ;; CHECK-NEXT:                  (local.get $11)
  ;; CHECK-NEXT:                  (i32.const 1)
  ;; CHECK-NEXT:                 )
  ;; CHECK-NEXT:                )
@@ -4523,7 +4677,7 @@
  ;; CHECK-NEXT:            (i32.const 32)
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:          )
- ;; CHECK-NEXT:          (local.set $6
+ ;; CHECK-NEXT:          (local.set $7
  ;; CHECK-NEXT:           (local.get $1)
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:          (local.get $9)
@@ -4536,13 +4690,13 @@
  ;; CHECK-NEXT:       (if (result i32)
  ;; CHECK-NEXT:        (i32.eq
  ;; CHECK-NEXT:         (i32.and
- ;; CHECK-NEXT:          (local.get $6)
+ ;; CHECK-NEXT:          (local.get $7)
  ;; CHECK-NEXT:          (i32.const 255)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (i32.const 42)
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:        (block $do-once5 (result i32)
- ;; CHECK-NEXT:         (local.set $10
+ ;; CHECK-NEXT:         (local.set $11
  ;; CHECK-NEXT:          (block $__rjto$0 (result i32)
  ;; CHECK-NEXT:           (block $__rjti$0
  ;; CHECK-NEXT:            (br_if $__rjti$0
@@ -4550,9 +4704,9 @@
  ;; CHECK-NEXT:              (local.tee $9
  ;; CHECK-NEXT:               (i32.sub
  ;; CHECK-NEXT:                (i32.load8_s
- ;; CHECK-NEXT:                 (local.tee $6
+ ;; CHECK-NEXT:                 (local.tee $7
  ;; CHECK-NEXT:                  (i32.add
- ;; CHECK-NEXT:                   (local.get $10)
+ ;; CHECK-NEXT:                   (local.get $11)
  ;; CHECK-NEXT:                   (i32.const 1)
  ;; CHECK-NEXT:                  )
  ;; CHECK-NEXT:                 )
@@ -4566,7 +4720,7 @@
  ;; CHECK-NEXT:            (br_if $__rjti$0
  ;; CHECK-NEXT:             (i32.ne
  ;; CHECK-NEXT:              (i32.load8_s offset=2
- ;; CHECK-NEXT:               (local.get $10)
+ ;; CHECK-NEXT:               (local.get $11)
  ;; CHECK-NEXT:              )
  ;; CHECK-NEXT:              (i32.const 36)
  ;; CHECK-NEXT:             )
@@ -4583,13 +4737,13 @@
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (drop
  ;; CHECK-NEXT:             (i32.load offset=4
- ;; CHECK-NEXT:              (local.tee $6
+ ;; CHECK-NEXT:              (local.tee $7
  ;; CHECK-NEXT:               (i32.add
  ;; CHECK-NEXT:                (local.get $3)
  ;; CHECK-NEXT:                (i32.shl
  ;; CHECK-NEXT:                 (i32.sub
  ;; CHECK-NEXT:                  (i32.load8_s
- ;; CHECK-NEXT:                   (local.get $6)
+ ;; CHECK-NEXT:                   (local.get $7)
  ;; CHECK-NEXT:                  )
  ;; CHECK-NEXT:                  (i32.const 48)
  ;; CHECK-NEXT:                 )
@@ -4604,12 +4758,12 @@
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (local.set $16
  ;; CHECK-NEXT:             (i32.load
- ;; CHECK-NEXT:              (local.get $6)
+ ;; CHECK-NEXT:              (local.get $7)
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (br $__rjto$0
  ;; CHECK-NEXT:             (i32.add
- ;; CHECK-NEXT:              (local.get $10)
+ ;; CHECK-NEXT:              (local.get $11)
  ;; CHECK-NEXT:              (i32.const 3)
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:            )
@@ -4617,7 +4771,7 @@
  ;; CHECK-NEXT:           (if
  ;; CHECK-NEXT:            (local.get $8)
  ;; CHECK-NEXT:            (block
- ;; CHECK-NEXT:             (local.set $18
+ ;; CHECK-NEXT:             (local.set $17
  ;; CHECK-NEXT:              (i32.const -1)
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:             (br $label$break$L1)
@@ -4631,8 +4785,8 @@
  ;; CHECK-NEXT:             (local.set $9
  ;; CHECK-NEXT:              (local.get $1)
  ;; CHECK-NEXT:             )
- ;; CHECK-NEXT:             (local.set $10
- ;; CHECK-NEXT:              (local.get $6)
+ ;; CHECK-NEXT:             (local.set $11
+ ;; CHECK-NEXT:              (local.get $7)
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:             (local.set $16
  ;; CHECK-NEXT:              (i32.const 0)
@@ -4644,7 +4798,7 @@
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:           (local.set $16
  ;; CHECK-NEXT:            (i32.load
- ;; CHECK-NEXT:             (local.tee $10
+ ;; CHECK-NEXT:             (local.tee $11
  ;; CHECK-NEXT:              (i32.and
  ;; CHECK-NEXT:               (i32.add
  ;; CHECK-NEXT:                (i32.load
@@ -4660,14 +4814,14 @@
  ;; CHECK-NEXT:           (i32.store
  ;; CHECK-NEXT:            (local.get $2)
  ;; CHECK-NEXT:            (i32.add
- ;; CHECK-NEXT:             (local.get $10)
+ ;; CHECK-NEXT:             (local.get $11)
  ;; CHECK-NEXT:             (i32.const 4)
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:           (local.set $8
  ;; CHECK-NEXT:            (i32.const 0)
  ;; CHECK-NEXT:           )
- ;; CHECK-NEXT:           (local.get $6)
+ ;; CHECK-NEXT:           (local.get $7)
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (local.set $9
@@ -4695,11 +4849,11 @@
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:        (if (result i32)
  ;; CHECK-NEXT:         (i32.lt_u
- ;; CHECK-NEXT:          (local.tee $6
+ ;; CHECK-NEXT:          (local.tee $7
  ;; CHECK-NEXT:           (i32.sub
  ;; CHECK-NEXT:            (i32.shr_s
  ;; CHECK-NEXT:             (i32.shl
- ;; CHECK-NEXT:              (local.get $6)
+ ;; CHECK-NEXT:              (local.get $7)
  ;; CHECK-NEXT:              (i32.const 24)
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:             (i32.const 24)
@@ -4714,23 +4868,23 @@
  ;; CHECK-NEXT:           (i32.const 0)
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:          (loop $while-in8
- ;; CHECK-NEXT:           (local.set $6
+ ;; CHECK-NEXT:           (local.set $7
  ;; CHECK-NEXT:            (i32.add
  ;; CHECK-NEXT:             (i32.mul
  ;; CHECK-NEXT:              (local.get $9)
  ;; CHECK-NEXT:              (i32.const 10)
  ;; CHECK-NEXT:             )
- ;; CHECK-NEXT:             (local.get $6)
+ ;; CHECK-NEXT:             (local.get $7)
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:           (if
  ;; CHECK-NEXT:            (i32.lt_u
- ;; CHECK-NEXT:             (local.tee $11
+ ;; CHECK-NEXT:             (local.tee $10
  ;; CHECK-NEXT:              (i32.sub
  ;; CHECK-NEXT:               (i32.load8_s
- ;; CHECK-NEXT:                (local.tee $10
+ ;; CHECK-NEXT:                (local.tee $11
  ;; CHECK-NEXT:                 (i32.add
- ;; CHECK-NEXT:                  (local.get $10)
+ ;; CHECK-NEXT:                  (local.get $11)
  ;; CHECK-NEXT:                  (i32.const 1)
  ;; CHECK-NEXT:                 )
  ;; CHECK-NEXT:                )
@@ -4742,10 +4896,10 @@
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (block
  ;; CHECK-NEXT:             (local.set $9
- ;; CHECK-NEXT:              (local.get $6)
+ ;; CHECK-NEXT:              (local.get $7)
  ;; CHECK-NEXT:             )
- ;; CHECK-NEXT:             (local.set $6
- ;; CHECK-NEXT:              (local.get $11)
+ ;; CHECK-NEXT:             (local.set $7
+ ;; CHECK-NEXT:              (local.get $10)
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:             (br $while-in8)
  ;; CHECK-NEXT:            )
@@ -4753,11 +4907,11 @@
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:          (if (result i32)
  ;; CHECK-NEXT:           (i32.lt_s
- ;; CHECK-NEXT:            (local.get $6)
+ ;; CHECK-NEXT:            (local.get $7)
  ;; CHECK-NEXT:            (i32.const 0)
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:           (block
- ;; CHECK-NEXT:            (local.set $18
+ ;; CHECK-NEXT:            (local.set $17
  ;; CHECK-NEXT:             (i32.const -1)
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (br $label$break$L1)
@@ -4767,7 +4921,7 @@
  ;; CHECK-NEXT:             (local.get $1)
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (local.set $16
- ;; CHECK-NEXT:             (local.get $6)
+ ;; CHECK-NEXT:             (local.get $7)
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (local.get $8)
  ;; CHECK-NEXT:           )
@@ -4785,11 +4939,11 @@
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
- ;; CHECK-NEXT:      (local.set $6
+ ;; CHECK-NEXT:      (local.set $7
  ;; CHECK-NEXT:       (if (result i32)
  ;; CHECK-NEXT:        (i32.eq
  ;; CHECK-NEXT:         (i32.load8_s
- ;; CHECK-NEXT:          (local.get $10)
+ ;; CHECK-NEXT:          (local.get $11)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (i32.const 46)
  ;; CHECK-NEXT:        )
@@ -4798,9 +4952,9 @@
  ;; CHECK-NEXT:          (i32.ne
  ;; CHECK-NEXT:           (local.tee $8
  ;; CHECK-NEXT:            (i32.load8_s
- ;; CHECK-NEXT:             (local.tee $6
+ ;; CHECK-NEXT:             (local.tee $7
  ;; CHECK-NEXT:              (i32.add
- ;; CHECK-NEXT:               (local.get $10)
+ ;; CHECK-NEXT:               (local.get $11)
  ;; CHECK-NEXT:               (i32.const 1)
  ;; CHECK-NEXT:              )
  ;; CHECK-NEXT:             )
@@ -4809,10 +4963,10 @@
  ;; CHECK-NEXT:           (i32.const 42)
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:          (block
- ;; CHECK-NEXT:           (local.set $6
+ ;; CHECK-NEXT:           (local.set $7
  ;; CHECK-NEXT:            (if (result i32)
  ;; CHECK-NEXT:             (i32.lt_u
- ;; CHECK-NEXT:              (local.tee $11
+ ;; CHECK-NEXT:              (local.tee $10
  ;; CHECK-NEXT:               (i32.sub
  ;; CHECK-NEXT:                (local.get $8)
  ;; CHECK-NEXT:                (i32.const 48)
@@ -4821,17 +4975,17 @@
  ;; CHECK-NEXT:              (i32.const 10)
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:             (block (result i32)
- ;; CHECK-NEXT:              (local.set $10
- ;; CHECK-NEXT:               (local.get $6)
+ ;; CHECK-NEXT:              (local.set $11
+ ;; CHECK-NEXT:               (local.get $7)
  ;; CHECK-NEXT:              )
  ;; CHECK-NEXT:              (local.set $8
  ;; CHECK-NEXT:               (i32.const 0)
  ;; CHECK-NEXT:              )
- ;; CHECK-NEXT:              (local.get $11)
+ ;; CHECK-NEXT:              (local.get $10)
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:             (block
- ;; CHECK-NEXT:              (local.set $10
- ;; CHECK-NEXT:               (local.get $6)
+ ;; CHECK-NEXT:              (local.set $11
+ ;; CHECK-NEXT:               (local.get $7)
  ;; CHECK-NEXT:              )
  ;; CHECK-NEXT:              (br $label$break$L46
  ;; CHECK-NEXT:               (i32.const 0)
@@ -4842,22 +4996,22 @@
  ;; CHECK-NEXT:           (loop $while-in11
  ;; CHECK-NEXT:            (drop
  ;; CHECK-NEXT:             (br_if $label$break$L46
- ;; CHECK-NEXT:              (local.tee $8
+ ;; CHECK-NEXT:              (local.tee $7
  ;; CHECK-NEXT:               (i32.add
  ;; CHECK-NEXT:                (i32.mul
  ;; CHECK-NEXT:                 (local.get $8)
  ;; CHECK-NEXT:                 (i32.const 10)
  ;; CHECK-NEXT:                )
- ;; CHECK-NEXT:                (local.get $6)
+ ;; CHECK-NEXT:                (local.get $7)
  ;; CHECK-NEXT:               )
  ;; CHECK-NEXT:              )
  ;; CHECK-NEXT:              (i32.ge_u
- ;; CHECK-NEXT:               (local.tee $6
+ ;; CHECK-NEXT:               (local.tee $10
  ;; CHECK-NEXT:                (i32.sub
  ;; CHECK-NEXT:                 (i32.load8_s
- ;; CHECK-NEXT:                  (local.tee $10
+ ;; CHECK-NEXT:                  (local.tee $11
  ;; CHECK-NEXT:                   (i32.add
- ;; CHECK-NEXT:                    (local.get $10)
+ ;; CHECK-NEXT:                    (local.get $11)
  ;; CHECK-NEXT:                    (i32.const 1)
  ;; CHECK-NEXT:                   )
  ;; CHECK-NEXT:                  )
@@ -4869,6 +5023,12 @@
  ;; CHECK-NEXT:              )
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:            )
+ ;; CHECK-NEXT:            (local.set $8
+ ;; CHECK-NEXT:             (local.get $7)
+ ;; CHECK-NEXT:            )
+ ;; CHECK-NEXT:            (local.set $7
+ ;; CHECK-NEXT:             (local.get $10)
+ ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (br $while-in11)
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:          )
@@ -4878,9 +5038,9 @@
  ;; CHECK-NEXT:           (local.tee $8
  ;; CHECK-NEXT:            (i32.sub
  ;; CHECK-NEXT:             (i32.load8_s
- ;; CHECK-NEXT:              (local.tee $6
+ ;; CHECK-NEXT:              (local.tee $7
  ;; CHECK-NEXT:               (i32.add
- ;; CHECK-NEXT:                (local.get $10)
+ ;; CHECK-NEXT:                (local.get $11)
  ;; CHECK-NEXT:                (i32.const 2)
  ;; CHECK-NEXT:               )
  ;; CHECK-NEXT:              )
@@ -4893,7 +5053,7 @@
  ;; CHECK-NEXT:          (if
  ;; CHECK-NEXT:           (i32.eq
  ;; CHECK-NEXT:            (i32.load8_s offset=3
- ;; CHECK-NEXT:             (local.get $10)
+ ;; CHECK-NEXT:             (local.get $11)
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (i32.const 36)
  ;; CHECK-NEXT:           )
@@ -4910,13 +5070,13 @@
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (drop
  ;; CHECK-NEXT:             (i32.load offset=4
- ;; CHECK-NEXT:              (local.tee $6
+ ;; CHECK-NEXT:              (local.tee $7
  ;; CHECK-NEXT:               (i32.add
  ;; CHECK-NEXT:                (local.get $3)
  ;; CHECK-NEXT:                (i32.shl
  ;; CHECK-NEXT:                 (i32.sub
  ;; CHECK-NEXT:                  (i32.load8_s
- ;; CHECK-NEXT:                   (local.get $6)
+ ;; CHECK-NEXT:                   (local.get $7)
  ;; CHECK-NEXT:                  )
  ;; CHECK-NEXT:                  (i32.const 48)
  ;; CHECK-NEXT:                 )
@@ -4926,15 +5086,15 @@
  ;; CHECK-NEXT:              )
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:            )
- ;; CHECK-NEXT:            (local.set $10
+ ;; CHECK-NEXT:            (local.set $11
  ;; CHECK-NEXT:             (i32.add
- ;; CHECK-NEXT:              (local.get $10)
+ ;; CHECK-NEXT:              (local.get $11)
  ;; CHECK-NEXT:              (i32.const 4)
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (br $label$break$L46
  ;; CHECK-NEXT:             (i32.load
- ;; CHECK-NEXT:              (local.get $6)
+ ;; CHECK-NEXT:              (local.get $7)
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:           )
@@ -4943,7 +5103,7 @@
  ;; CHECK-NEXT:         (if
  ;; CHECK-NEXT:          (local.get $1)
  ;; CHECK-NEXT:          (block
- ;; CHECK-NEXT:           (local.set $18
+ ;; CHECK-NEXT:           (local.set $17
  ;; CHECK-NEXT:            (i32.const -1)
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:           (br $label$break$L1)
@@ -4954,7 +5114,7 @@
  ;; CHECK-NEXT:          (block (result i32)
  ;; CHECK-NEXT:           (local.set $8
  ;; CHECK-NEXT:            (i32.load
- ;; CHECK-NEXT:             (local.tee $10
+ ;; CHECK-NEXT:             (local.tee $11
  ;; CHECK-NEXT:              (i32.and
  ;; CHECK-NEXT:               (i32.add
  ;; CHECK-NEXT:                (i32.load
@@ -4970,18 +5130,18 @@
  ;; CHECK-NEXT:           (i32.store
  ;; CHECK-NEXT:            (local.get $2)
  ;; CHECK-NEXT:            (i32.add
- ;; CHECK-NEXT:             (local.get $10)
+ ;; CHECK-NEXT:             (local.get $11)
  ;; CHECK-NEXT:             (i32.const 4)
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:           )
- ;; CHECK-NEXT:           (local.set $10
- ;; CHECK-NEXT:            (local.get $6)
+ ;; CHECK-NEXT:           (local.set $11
+ ;; CHECK-NEXT:            (local.get $7)
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:           (local.get $8)
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:          (block (result i32)
- ;; CHECK-NEXT:           (local.set $10
- ;; CHECK-NEXT:            (local.get $6)
+ ;; CHECK-NEXT:           (local.set $11
+ ;; CHECK-NEXT:            (local.get $7)
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:           (i32.const 0)
  ;; CHECK-NEXT:          )
@@ -4991,91 +5151,94 @@
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:      (local.set $8
- ;; CHECK-NEXT:       (local.get $10)
+ ;; CHECK-NEXT:       (local.get $11)
  ;; CHECK-NEXT:      )
- ;; CHECK-NEXT:      (local.set $11
+ ;; CHECK-NEXT:      (local.set $10
  ;; CHECK-NEXT:       (i32.const 0)
  ;; CHECK-NEXT:      )
- ;; CHECK-NEXT:      (loop $while-in13
- ;; CHECK-NEXT:       (if
- ;; CHECK-NEXT:        (i32.gt_u
- ;; CHECK-NEXT:         (local.tee $12
- ;; CHECK-NEXT:          (i32.sub
- ;; CHECK-NEXT:           (i32.load8_s
- ;; CHECK-NEXT:            (local.get $8)
+ ;; CHECK-NEXT:      (local.set $19
+ ;; CHECK-NEXT:       (loop $while-in13 (result i32)
+ ;; CHECK-NEXT:        (if
+ ;; CHECK-NEXT:         (i32.gt_u
+ ;; CHECK-NEXT:          (local.tee $12
+ ;; CHECK-NEXT:           (i32.sub
+ ;; CHECK-NEXT:            (i32.load8_s
+ ;; CHECK-NEXT:             (local.get $8)
+ ;; CHECK-NEXT:            )
+ ;; CHECK-NEXT:            (i32.const 65)
  ;; CHECK-NEXT:           )
- ;; CHECK-NEXT:           (i32.const 65)
  ;; CHECK-NEXT:          )
+ ;; CHECK-NEXT:          (i32.const 57)
  ;; CHECK-NEXT:         )
- ;; CHECK-NEXT:         (i32.const 57)
- ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:        (block
- ;; CHECK-NEXT:         (local.set $18
- ;; CHECK-NEXT:          (i32.const -1)
+ ;; CHECK-NEXT:         (block
+ ;; CHECK-NEXT:          (local.set $17
+ ;; CHECK-NEXT:           (i32.const -1)
+ ;; CHECK-NEXT:          )
+ ;; CHECK-NEXT:          (br $label$break$L1)
  ;; CHECK-NEXT:         )
- ;; CHECK-NEXT:         (br $label$break$L1)
  ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:       )
- ;; CHECK-NEXT:       (local.set $10
- ;; CHECK-NEXT:        (i32.add
- ;; CHECK-NEXT:         (local.get $8)
- ;; CHECK-NEXT:         (i32.const 1)
+ ;; CHECK-NEXT:        (local.set $11
+ ;; CHECK-NEXT:         (i32.add
+ ;; CHECK-NEXT:          (local.get $8)
+ ;; CHECK-NEXT:          (i32.const 1)
+ ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:       )
- ;; CHECK-NEXT:       (if
- ;; CHECK-NEXT:        (i32.lt_u
- ;; CHECK-NEXT:         (i32.sub
- ;; CHECK-NEXT:          (local.tee $12
- ;; CHECK-NEXT:           (i32.and
- ;; CHECK-NEXT:            (local.tee $15
- ;; CHECK-NEXT:             (i32.load8_s
- ;; CHECK-NEXT:              (i32.add
+ ;; CHECK-NEXT:        (if (result i32)
+ ;; CHECK-NEXT:         (i32.lt_u
+ ;; CHECK-NEXT:          (i32.sub
+ ;; CHECK-NEXT:           (local.tee $12
+ ;; CHECK-NEXT:            (i32.and
+ ;; CHECK-NEXT:             (local.tee $13
+ ;; CHECK-NEXT:              (i32.load8_s
  ;; CHECK-NEXT:               (i32.add
- ;; CHECK-NEXT:                (i32.mul
- ;; CHECK-NEXT:                 (local.get $11)
- ;; CHECK-NEXT:                 (i32.const 58)
+ ;; CHECK-NEXT:                (i32.add
+ ;; CHECK-NEXT:                 (i32.mul
+ ;; CHECK-NEXT:                  (local.get $10)
+ ;; CHECK-NEXT:                  (i32.const 58)
+ ;; CHECK-NEXT:                 )
+ ;; CHECK-NEXT:                 (i32.const 3611)
  ;; CHECK-NEXT:                )
- ;; CHECK-NEXT:                (i32.const 3611)
+ ;; CHECK-NEXT:                (local.get $12)
  ;; CHECK-NEXT:               )
- ;; CHECK-NEXT:               (local.get $12)
  ;; CHECK-NEXT:              )
  ;; CHECK-NEXT:             )
+ ;; CHECK-NEXT:             (i32.const 255)
  ;; CHECK-NEXT:            )
- ;; CHECK-NEXT:            (i32.const 255)
  ;; CHECK-NEXT:           )
+ ;; CHECK-NEXT:           (i32.const 1)
  ;; CHECK-NEXT:          )
- ;; CHECK-NEXT:          (i32.const 1)
- ;; CHECK-NEXT:         )
- ;; CHECK-NEXT:         (i32.const 8)
- ;; CHECK-NEXT:        )
- ;; CHECK-NEXT:        (block
- ;; CHECK-NEXT:         (local.set $8
- ;; CHECK-NEXT:          (local.get $10)
+ ;; CHECK-NEXT:          (i32.const 8)
  ;; CHECK-NEXT:         )
- ;; CHECK-NEXT:         (local.set $11
- ;; CHECK-NEXT:          (local.get $12)
+ ;; CHECK-NEXT:         (block
+ ;; CHECK-NEXT:          (local.set $8
+ ;; CHECK-NEXT:           (local.get $11)
+ ;; CHECK-NEXT:          )
+ ;; CHECK-NEXT:          (local.set $10
+ ;; CHECK-NEXT:           (local.get $12)
+ ;; CHECK-NEXT:          )
+ ;; CHECK-NEXT:          (br $while-in13)
  ;; CHECK-NEXT:         )
- ;; CHECK-NEXT:         (br $while-in13)
+ ;; CHECK-NEXT:         (local.get $8)
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:      (if
  ;; CHECK-NEXT:       (i32.eqz
  ;; CHECK-NEXT:        (i32.and
- ;; CHECK-NEXT:         (local.get $15)
+ ;; CHECK-NEXT:         (local.get $13)
  ;; CHECK-NEXT:         (i32.const 255)
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:       (block
- ;; CHECK-NEXT:        (local.set $18
+ ;; CHECK-NEXT:        (local.set $17
  ;; CHECK-NEXT:         (i32.const -1)
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:        (br $label$break$L1)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
- ;; CHECK-NEXT:      (local.set $17
+ ;; CHECK-NEXT:      (local.set $8
  ;; CHECK-NEXT:       (i32.ge_s
- ;; CHECK-NEXT:        (local.get $19)
+ ;; CHECK-NEXT:        (local.get $18)
  ;; CHECK-NEXT:        (i32.const 0)
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
@@ -5084,15 +5247,15 @@
  ;; CHECK-NEXT:        (if
  ;; CHECK-NEXT:         (i32.eq
  ;; CHECK-NEXT:          (i32.and
- ;; CHECK-NEXT:           (local.get $15)
+ ;; CHECK-NEXT:           (local.get $13)
  ;; CHECK-NEXT:           (i32.const 255)
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:          (i32.const 19)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (if
- ;; CHECK-NEXT:          (local.get $17)
+ ;; CHECK-NEXT:          (local.get $8)
  ;; CHECK-NEXT:          (block
- ;; CHECK-NEXT:           (local.set $18
+ ;; CHECK-NEXT:           (local.set $17
  ;; CHECK-NEXT:            (i32.const -1)
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:           (br $label$break$L1)
@@ -5101,25 +5264,25 @@
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (block
  ;; CHECK-NEXT:          (if
- ;; CHECK-NEXT:           (local.get $17)
+ ;; CHECK-NEXT:           (local.get $8)
  ;; CHECK-NEXT:           (block
  ;; CHECK-NEXT:            (i32.store
  ;; CHECK-NEXT:             (i32.add
  ;; CHECK-NEXT:              (local.get $4)
  ;; CHECK-NEXT:              (i32.shl
- ;; CHECK-NEXT:               (local.get $19)
+ ;; CHECK-NEXT:               (local.get $18)
  ;; CHECK-NEXT:               (i32.const 2)
  ;; CHECK-NEXT:              )
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:             (local.get $12)
  ;; CHECK-NEXT:            )
- ;; CHECK-NEXT:            (local.set $15
+ ;; CHECK-NEXT:            (local.set $13
  ;; CHECK-NEXT:             (i32.load offset=4
  ;; CHECK-NEXT:              (local.tee $12
  ;; CHECK-NEXT:               (i32.add
  ;; CHECK-NEXT:                (local.get $3)
  ;; CHECK-NEXT:                (i32.shl
- ;; CHECK-NEXT:                 (local.get $19)
+ ;; CHECK-NEXT:                 (local.get $18)
  ;; CHECK-NEXT:                 (i32.const 3)
  ;; CHECK-NEXT:                )
  ;; CHECK-NEXT:               )
@@ -5127,14 +5290,16 @@
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (i32.store
- ;; CHECK-NEXT:             (local.get $13)
+ ;; CHECK-NEXT:             (local.tee $8
+ ;; CHECK-NEXT:              (local.get $15)
+ ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:             (i32.load
  ;; CHECK-NEXT:              (local.get $12)
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (i32.store offset=4
+ ;; CHECK-NEXT:             (local.get $8)
  ;; CHECK-NEXT:             (local.get $13)
- ;; CHECK-NEXT:             (local.get $15)
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (br $__rjti$2)
  ;; CHECK-NEXT:           )
@@ -5144,14 +5309,14 @@
  ;; CHECK-NEXT:            (local.get $29)
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:           (block
- ;; CHECK-NEXT:            (local.set $18
+ ;; CHECK-NEXT:            (local.set $17
  ;; CHECK-NEXT:             (i32.const 0)
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:            (br $label$break$L1)
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:          (call $_pop_arg_336
- ;; CHECK-NEXT:           (local.get $13)
+ ;; CHECK-NEXT:           (local.get $15)
  ;; CHECK-NEXT:           (local.get $12)
  ;; CHECK-NEXT:           (local.get $2)
  ;; CHECK-NEXT:          )
@@ -5165,10 +5330,10 @@
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:        (block
  ;; CHECK-NEXT:         (local.set $5
- ;; CHECK-NEXT:          (local.get $10)
+ ;; CHECK-NEXT:          (local.get $11)
  ;; CHECK-NEXT:         )
- ;; CHECK-NEXT:         (local.set $10
- ;; CHECK-NEXT:          (local.get $7)
+ ;; CHECK-NEXT:         (local.set $11
+ ;; CHECK-NEXT:          (local.get $6)
  ;; CHECK-NEXT:         )
  ;; CHECK-NEXT:         (br $label$continue$L1)
  ;; CHECK-NEXT:        )
@@ -5176,7 +5341,7 @@
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:      (local.set $9
  ;; CHECK-NEXT:       (select
- ;; CHECK-NEXT:        (local.tee $12
+ ;; CHECK-NEXT:        (local.tee $8
  ;; CHECK-NEXT:         (i32.and
  ;; CHECK-NEXT:          (local.get $9)
  ;; CHECK-NEXT:          (i32.const -65537)
@@ -5192,13 +5357,13 @@
  ;; CHECK-NEXT:      (call $_pad
  ;; CHECK-NEXT:       (local.get $0)
  ;; CHECK-NEXT:       (i32.const 32)
- ;; CHECK-NEXT:       (local.tee $6
+ ;; CHECK-NEXT:       (local.tee $7
  ;; CHECK-NEXT:        (select
  ;; CHECK-NEXT:         (local.tee $5
  ;; CHECK-NEXT:          (i32.add
  ;; CHECK-NEXT:           (local.tee $12
  ;; CHECK-NEXT:            (select
- ;; CHECK-NEXT:             (local.tee $15
+ ;; CHECK-NEXT:             (local.tee $13
  ;; CHECK-NEXT:              (i32.sub
  ;; CHECK-NEXT:               (block $__rjto$8 (result i32)
  ;; CHECK-NEXT:                (block $__rjti$8
@@ -5206,7 +5371,7 @@
  ;; CHECK-NEXT:                  (local.get $0)
  ;; CHECK-NEXT:                  (i32.const 32)
  ;; CHECK-NEXT:                  (local.get $16)
- ;; CHECK-NEXT:                  (local.tee $7
+ ;; CHECK-NEXT:                  (local.tee $6
  ;; CHECK-NEXT:                   (block $__rjti$7 (result i32)
  ;; CHECK-NEXT:                    (block $__rjti$6
  ;; CHECK-NEXT:                     (block $__rjti$5
@@ -5227,27 +5392,27 @@
  ;; CHECK-NEXT:                                    (block $switch-case27
  ;; CHECK-NEXT:                                     (br_table $switch-case42 $switch-default120 $switch-case40 $switch-default120 $switch-case42 $switch-case42 $switch-case42 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-case41 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-case29 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-default120 $switch-case42 $switch-default120 $switch-case37 $switch-case34 $switch-case42 $switch-case42 $switch-case42 $switch-default120 $switch-case34 $switch-default120 $switch-default120 $switch-default120 $switch-case38 $switch-case27 $switch-case33 $switch-case28 $switch-default120 $switch-default120 $switch-case39 $switch-default120 $switch-case36 $switch-default120 $switch-default120 $switch-case29 $switch-default120
  ;; CHECK-NEXT:                                      (i32.sub
- ;; CHECK-NEXT:                                       (local.tee $15
+ ;; CHECK-NEXT:                                       (local.tee $19
  ;; CHECK-NEXT:                                        (select
  ;; CHECK-NEXT:                                         (i32.and
- ;; CHECK-NEXT:                                          (local.tee $8
+ ;; CHECK-NEXT:                                          (local.tee $12
  ;; CHECK-NEXT:                                           (i32.load8_s
- ;; CHECK-NEXT:                                            (local.get $8)
+ ;; CHECK-NEXT:                                            (local.get $19)
  ;; CHECK-NEXT:                                           )
  ;; CHECK-NEXT:                                          )
  ;; CHECK-NEXT:                                          (i32.const -33)
  ;; CHECK-NEXT:                                         )
- ;; CHECK-NEXT:                                         (local.get $8)
+ ;; CHECK-NEXT:                                         (local.get $12)
  ;; CHECK-NEXT:                                         (i32.and
  ;; CHECK-NEXT:                                          (i32.eq
  ;; CHECK-NEXT:                                           (i32.and
- ;; CHECK-NEXT:                                            (local.get $8)
+ ;; CHECK-NEXT:                                            (local.get $12)
  ;; CHECK-NEXT:                                            (i32.const 15)
  ;; CHECK-NEXT:                                           )
  ;; CHECK-NEXT:                                           (i32.const 3)
  ;; CHECK-NEXT:                                          )
  ;; CHECK-NEXT:                                          (i32.ne
- ;; CHECK-NEXT:                                           (local.get $11)
+ ;; CHECK-NEXT:                                           (local.get $10)
  ;; CHECK-NEXT:                                           (i32.const 0)
  ;; CHECK-NEXT:                                          )
  ;; CHECK-NEXT:                                         )
@@ -5266,51 +5431,51 @@
  ;; CHECK-NEXT:                                          (block $switch-case20
  ;; CHECK-NEXT:                                           (block $switch-case19
  ;; CHECK-NEXT:                                            (br_table $switch-case19 $switch-case20 $switch-case21 $switch-case22 $switch-case23 $switch-default26 $switch-case24 $switch-case25 $switch-default26
- ;; CHECK-NEXT:                                             (local.get $11)
+ ;; CHECK-NEXT:                                             (local.get $10)
  ;; CHECK-NEXT:                                            )
  ;; CHECK-NEXT:                                           )
  ;; CHECK-NEXT:                                           (i32.store
  ;; CHECK-NEXT:                                            (i32.load
- ;; CHECK-NEXT:                                             (local.get $13)
+ ;; CHECK-NEXT:                                             (local.get $15)
  ;; CHECK-NEXT:                                            )
- ;; CHECK-NEXT:                                            (local.get $18)
+ ;; CHECK-NEXT:                                            (local.get $17)
  ;; CHECK-NEXT:                                           )
  ;; CHECK-NEXT:                                           (local.set $5
- ;; CHECK-NEXT:                                            (local.get $10)
+ ;; CHECK-NEXT:                                            (local.get $11)
  ;; CHECK-NEXT:                                           )
- ;; CHECK-NEXT:                                           (local.set $10
- ;; CHECK-NEXT:                                            (local.get $7)
+ ;; CHECK-NEXT:                                           (local.set $11
+ ;; CHECK-NEXT:                                            (local.get $6)
  ;; CHECK-NEXT:                                           )
  ;; CHECK-NEXT:                                           (br $label$continue$L1)
  ;; CHECK-NEXT:                                          )
  ;; CHECK-NEXT:                                          (i32.store
  ;; CHECK-NEXT:                                           (i32.load
- ;; CHECK-NEXT:                                            (local.get $13)
+ ;; CHECK-NEXT:                                            (local.get $15)
  ;; CHECK-NEXT:                                           )
- ;; CHECK-NEXT:                                           (local.get $18)
+ ;; CHECK-NEXT:                                           (local.get $17)
  ;; CHECK-NEXT:                                          )
  ;; CHECK-NEXT:                                          (local.set $5
- ;; CHECK-NEXT:                                           (local.get $10)
+ ;; CHECK-NEXT:                                           (local.get $11)
  ;; CHECK-NEXT:                                          )
- ;; CHECK-NEXT:                                          (local.set $10
- ;; CHECK-NEXT:                                           (local.get $7)
+ ;; CHECK-NEXT:                                          (local.set $11
+ ;; CHECK-NEXT:                                           (local.get $6)
  ;; CHECK-NEXT:                                          )
  ;; CHECK-NEXT:                                          (br $label$continue$L1)
  ;; CHECK-NEXT:                                         )
  ;; CHECK-NEXT:                                         (i32.store
  ;; CHECK-NEXT:                                          (local.tee $5
  ;; CHECK-NEXT:                                           (i32.load
- ;; CHECK-NEXT:                                            (local.get $13)
+ ;; CHECK-NEXT:                                            (local.get $15)
  ;; CHECK-NEXT:                                           )
  ;; CHECK-NEXT:                                          )
- ;; CHECK-NEXT:                                          (local.get $18)
+ ;; CHECK-NEXT:                                          (local.get $17)
  ;; CHECK-NEXT:                                         )
  ;; CHECK-NEXT:                                         (i32.store offset=4
  ;; CHECK-NEXT:                                          (local.get $5)
  ;; CHECK-NEXT:                                          (i32.shr_s
  ;; CHECK-NEXT:                                           (i32.shl
  ;; CHECK-NEXT:                                            (i32.lt_s
- ;; CHECK-NEXT:                                             (local.get $18)
+ ;; CHECK-NEXT:                                             (local.get $17)
  ;; CHECK-NEXT:                                             (i32.const 0)
  ;; CHECK-NEXT:                                            )
  ;; CHECK-NEXT:                                            (i32.const 31)
@@ -5319,69 +5484,69 @@
  ;; CHECK-NEXT:                                          )
  ;; CHECK-NEXT:                                         )
  ;; CHECK-NEXT:                                         (local.set $5
- ;; CHECK-NEXT:                                          (local.get $10)
+ ;; CHECK-NEXT:                                          (local.get $11)
  ;; CHECK-NEXT:                                         )
- ;; CHECK-NEXT:                                         (local.set $10
- ;; CHECK-NEXT:                                          (local.get $7)
+ ;; CHECK-NEXT:                                         (local.set $11
+ ;; CHECK-NEXT:                                          (local.get $6)
  ;; CHECK-NEXT:                                         )
  ;; CHECK-NEXT:                                         (br $label$continue$L1)
  ;; CHECK-NEXT:                                        )
  ;; CHECK-NEXT:                                        (i32.store16
  ;; CHECK-NEXT:                                         (i32.load
- ;; CHECK-NEXT:                                          (local.get $13)
+ ;; CHECK-NEXT:                                          (local.get $15)
  ;; CHECK-NEXT:                                         )
- ;; CHECK-NEXT:                                         (local.get $18)
+ ;; CHECK-NEXT:                                         (local.get $17)
  ;; CHECK-NEXT:                                        )
  ;; CHECK-NEXT:                                        (local.set $5
- ;; CHECK-NEXT:                                         (local.get $10)
+ ;; CHECK-NEXT:                                         (local.get $11)
  ;; CHECK-NEXT:                                        )
- ;; CHECK-NEXT:                                        (local.set $10
- ;; CHECK-NEXT:                                         (local.get $7)
+ ;; CHECK-NEXT:                                        (local.set $11
+ ;; CHECK-NEXT:                                         (local.get $6)
  ;; CHECK-NEXT:                                        )
  ;; CHECK-NEXT:                                        (br $label$continue$L1)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                       (i32.store8
  ;; CHECK-NEXT:                                        (i32.load
- ;; CHECK-NEXT:                                         (local.get $13)
+ ;; CHECK-NEXT:                                         (local.get $15)
  ;; CHECK-NEXT:                                        )
- ;; CHECK-NEXT:                                        (local.get $18)
+ ;; CHECK-NEXT:                                        (local.get $17)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                       (local.set $5
- ;; CHECK-NEXT:                                        (local.get $10)
+ ;; CHECK-NEXT:                                        (local.get $11)
  ;; CHECK-NEXT:                                       )
- ;; CHECK-NEXT:                                       (local.set $10
- ;; CHECK-NEXT:                                        (local.get $7)
+ ;; CHECK-NEXT:                                       (local.set $11
+ ;; CHECK-NEXT:                                        (local.get $6)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                       (br $label$continue$L1)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                      (i32.store
  ;; CHECK-NEXT:                                       (i32.load
- ;; CHECK-NEXT:                                        (local.get $13)
+ ;; CHECK-NEXT:                                        (local.get $15)
  ;; CHECK-NEXT:                                       )
- ;; CHECK-NEXT:                                       (local.get $18)
+ ;; CHECK-NEXT:                                       (local.get $17)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                      (local.set $5
- ;; CHECK-NEXT:                                       (local.get $10)
+ ;; CHECK-NEXT:                                       (local.get $11)
  ;; CHECK-NEXT:                                      )
- ;; CHECK-NEXT:                                      (local.set $10
- ;; CHECK-NEXT:                                       (local.get $7)
+ ;; CHECK-NEXT:                                      (local.set $11
+ ;; CHECK-NEXT:                                       (local.get $6)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                      (br $label$continue$L1)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                     (i32.store
  ;; CHECK-NEXT:                                      (local.tee $5
  ;; CHECK-NEXT:                                       (i32.load
- ;; CHECK-NEXT:                                        (local.get $13)
+ ;; CHECK-NEXT:                                        (local.get $15)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                      )
- ;; CHECK-NEXT:                                      (local.get $18)
+ ;; CHECK-NEXT:                                      (local.get $17)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                     (i32.store offset=4
  ;; CHECK-NEXT:                                      (local.get $5)
  ;; CHECK-NEXT:                                      (i32.shr_s
  ;; CHECK-NEXT:                                       (i32.shl
  ;; CHECK-NEXT:                                        (i32.lt_s
- ;; CHECK-NEXT:                                         (local.get $18)
+ ;; CHECK-NEXT:                                         (local.get $17)
  ;; CHECK-NEXT:                                         (i32.const 0)
  ;; CHECK-NEXT:                                        )
  ;; CHECK-NEXT:                                        (i32.const 31)
@@ -5390,61 +5555,69 @@
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                     (local.set $5
- ;; CHECK-NEXT:                                      (local.get $10)
+ ;; CHECK-NEXT:                                      (local.get $11)
  ;; CHECK-NEXT:                                     )
- ;; CHECK-NEXT:                                     (local.set $10
- ;; CHECK-NEXT:                                      (local.get $7)
+ ;; CHECK-NEXT:                                     (local.set $11
+ ;; CHECK-NEXT:                                      (local.get $6)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                     (br $label$continue$L1)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (local.set $5
- ;; CHECK-NEXT:                                     (local.get $10)
+ ;; CHECK-NEXT:                                     (local.get $11)
  ;; CHECK-NEXT:                                    )
- ;; CHECK-NEXT:                                    (local.set $10
- ;; CHECK-NEXT:                                     (local.get $7)
+ ;; CHECK-NEXT:                                    (local.set $11
+ ;; CHECK-NEXT:                                     (local.get $6)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (br $label$continue$L1)
  ;; CHECK-NEXT:                                   )
- ;; CHECK-NEXT:                                   (local.set $7
+ ;; CHECK-NEXT:                                   (local.set $6
  ;; CHECK-NEXT:                                    (i32.or
  ;; CHECK-NEXT:                                     (local.get $9)
  ;; CHECK-NEXT:                                     (i32.const 8)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
- ;; CHECK-NEXT:                                   (local.set $6
+ ;; CHECK-NEXT:                                   (local.set $7
  ;; CHECK-NEXT:                                    (select
- ;; CHECK-NEXT:                                     (local.get $6)
+ ;; CHECK-NEXT:                                     (local.get $7)
  ;; CHECK-NEXT:                                     (i32.const 8)
  ;; CHECK-NEXT:                                     (i32.gt_u
- ;; CHECK-NEXT:                                      (local.get $6)
+ ;; CHECK-NEXT:                                      (local.get $7)
  ;; CHECK-NEXT:                                      (i32.const 8)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
- ;; CHECK-NEXT:                                   (local.set $15
+ ;; CHECK-NEXT:                                   (local.set $19
  ;; CHECK-NEXT:                                    (i32.const 120)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (br $__rjti$3)
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.set $7
+ ;; CHECK-NEXT:                                  (local.set $6
  ;; CHECK-NEXT:                                   (local.get $9)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (br $__rjti$3)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (if
  ;; CHECK-NEXT:                                  (i32.or
- ;; CHECK-NEXT:                                   (local.tee $5
+ ;; CHECK-NEXT:                                   (local.tee $6
  ;; CHECK-NEXT:                                    (i32.load
- ;; CHECK-NEXT:                                     (local.get $13)
+ ;; CHECK-NEXT:                                     (local.tee $5
+ ;; CHECK-NEXT:                                      (local.get $15)
+ ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
- ;; CHECK-NEXT:                                   (local.tee $7
+ ;; CHECK-NEXT:                                   (local.tee $8
  ;; CHECK-NEXT:                                    (i32.load offset=4
- ;; CHECK-NEXT:                                     (local.get $13)
+ ;; CHECK-NEXT:                                     (local.get $5)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (block
+ ;; CHECK-NEXT:                                   (local.set $5
+ ;; CHECK-NEXT:                                    (local.get $6)
+ ;; CHECK-NEXT:                                   )
+ ;; CHECK-NEXT:                                   (local.set $6
+ ;; CHECK-NEXT:                                    (local.get $8)
+ ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (local.set $8
  ;; CHECK-NEXT:                                    (local.get $23)
  ;; CHECK-NEXT:                                   )
@@ -5469,11 +5642,11 @@
  ;; CHECK-NEXT:                                      (local.tee $5
  ;; CHECK-NEXT:                                       (call $_bitshift64Lshr
  ;; CHECK-NEXT:                                        (local.get $5)
- ;; CHECK-NEXT:                                        (local.get $7)
+ ;; CHECK-NEXT:                                        (local.get $6)
  ;; CHECK-NEXT:                                        (i32.const 3)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                      )
- ;; CHECK-NEXT:                                      (local.tee $7
+ ;; CHECK-NEXT:                                      (local.tee $6
  ;; CHECK-NEXT:                                       (global.get $tempRet0)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                     )
@@ -5484,59 +5657,64 @@
  ;; CHECK-NEXT:                                   (local.get $23)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
- ;; CHECK-NEXT:                                 (if
- ;; CHECK-NEXT:                                  (i32.and
- ;; CHECK-NEXT:                                   (local.get $9)
- ;; CHECK-NEXT:                                   (i32.const 8)
- ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (block
- ;; CHECK-NEXT:                                   (local.set $7
+ ;; CHECK-NEXT:                                 (local.set $5
+ ;; CHECK-NEXT:                                  (if (result i32)
+ ;; CHECK-NEXT:                                   (i32.and
  ;; CHECK-NEXT:                                    (local.get $9)
+ ;; CHECK-NEXT:                                    (i32.const 8)
  ;; CHECK-NEXT:                                   )
- ;; CHECK-NEXT:                                   (local.set $6
- ;; CHECK-NEXT:                                    (select
- ;; CHECK-NEXT:                                     (local.tee $5
- ;; CHECK-NEXT:                                      (i32.add
- ;; CHECK-NEXT:                                       (i32.sub
- ;; CHECK-NEXT:                                        (local.get $23)
- ;; CHECK-NEXT:                                        (local.get $8)
+ ;; CHECK-NEXT:                                   (block (result i32)
+ ;; CHECK-NEXT:                                    (local.set $6
+ ;; CHECK-NEXT:                                     (local.get $9)
+ ;; CHECK-NEXT:                                    )
+ ;; CHECK-NEXT:                                    (local.set $7
+ ;; CHECK-NEXT:                                     (select
+ ;; CHECK-NEXT:                                      (local.tee $9
+ ;; CHECK-NEXT:                                       (i32.add
+ ;; CHECK-NEXT:                                        (i32.sub
+ ;; CHECK-NEXT:                                         (local.get $23)
+ ;; CHECK-NEXT:                                         (local.get $8)
+ ;; CHECK-NEXT:                                        )
+ ;; CHECK-NEXT:                                        (i32.const 1)
  ;; CHECK-NEXT:                                       )
- ;; CHECK-NEXT:                                       (i32.const 1)
  ;; CHECK-NEXT:                                      )
- ;; CHECK-NEXT:                                     )
- ;; CHECK-NEXT:                                     (local.get $6)
- ;; CHECK-NEXT:                                     (i32.gt_s
- ;; CHECK-NEXT:                                      (local.get $5)
- ;; CHECK-NEXT:                                      (local.get $6)
+ ;; CHECK-NEXT:                                      (local.get $7)
+ ;; CHECK-NEXT:                                      (i32.lt_s
+ ;; CHECK-NEXT:                                       (local.get $7)
+ ;; CHECK-NEXT:                                       (local.get $9)
+ ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
+ ;; CHECK-NEXT:                                    (local.get $8)
+ ;; CHECK-NEXT:                                   )
+ ;; CHECK-NEXT:                                   (block (result i32)
+ ;; CHECK-NEXT:                                    (local.set $6
+ ;; CHECK-NEXT:                                     (local.get $9)
+ ;; CHECK-NEXT:                                    )
+ ;; CHECK-NEXT:                                    (local.get $8)
  ;; CHECK-NEXT:                                   )
- ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.set $7
- ;; CHECK-NEXT:                                   (local.get $9)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
- ;; CHECK-NEXT:                                 (local.set $5
- ;; CHECK-NEXT:                                  (local.get $8)
- ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (local.set $8
  ;; CHECK-NEXT:                                  (i32.const 0)
  ;; CHECK-NEXT:                                 )
- ;; CHECK-NEXT:                                 (local.set $11
+ ;; CHECK-NEXT:                                 (local.set $10
  ;; CHECK-NEXT:                                  (i32.const 4091)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (br $__rjti$8)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                                (local.set $5
  ;; CHECK-NEXT:                                 (i32.load
- ;; CHECK-NEXT:                                  (local.get $13)
+ ;; CHECK-NEXT:                                  (local.tee $6
+ ;; CHECK-NEXT:                                   (local.get $15)
+ ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                                (if
  ;; CHECK-NEXT:                                 (i32.lt_s
- ;; CHECK-NEXT:                                  (local.tee $7
+ ;; CHECK-NEXT:                                  (local.tee $6
  ;; CHECK-NEXT:                                   (i32.load offset=4
- ;; CHECK-NEXT:                                    (local.get $13)
+ ;; CHECK-NEXT:                                    (local.get $6)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (i32.const 0)
@@ -5546,7 +5724,7 @@
  ;; CHECK-NEXT:                                   (i32.sub
  ;; CHECK-NEXT:                                    (i32.sub
  ;; CHECK-NEXT:                                     (i32.const 0)
- ;; CHECK-NEXT:                                     (local.get $7)
+ ;; CHECK-NEXT:                                     (local.get $6)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (i32.ne
  ;; CHECK-NEXT:                                     (local.get $5)
@@ -5555,7 +5733,9 @@
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (i32.store
- ;; CHECK-NEXT:                                   (local.get $13)
+ ;; CHECK-NEXT:                                   (local.tee $8
+ ;; CHECK-NEXT:                                    (local.get $15)
+ ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (local.tee $5
  ;; CHECK-NEXT:                                    (i32.sub
  ;; CHECK-NEXT:                                     (i32.const 0)
@@ -5564,21 +5744,21 @@
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (i32.store offset=4
- ;; CHECK-NEXT:                                   (local.get $13)
- ;; CHECK-NEXT:                                   (local.tee $7
+ ;; CHECK-NEXT:                                   (local.get $8)
+ ;; CHECK-NEXT:                                   (local.tee $6
  ;; CHECK-NEXT:                                    (global.get $tempRet0)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (local.set $8
  ;; CHECK-NEXT:                                   (i32.const 1)
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.set $11
+ ;; CHECK-NEXT:                                  (local.set $10
  ;; CHECK-NEXT:                                   (i32.const 4091)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (br $__rjti$4)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
- ;; CHECK-NEXT:                                (local.set $11
+ ;; CHECK-NEXT:                                (local.set $10
  ;; CHECK-NEXT:                                 (if (result i32)
  ;; CHECK-NEXT:                                  (i32.and
  ;; CHECK-NEXT:                                   (local.get $9)
@@ -5590,15 +5770,20 @@
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (i32.const 4092)
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (select
- ;; CHECK-NEXT:                                   (i32.const 4093)
- ;; CHECK-NEXT:                                   (i32.const 4091)
- ;; CHECK-NEXT:                                   (local.tee $8
- ;; CHECK-NEXT:                                    (i32.and
- ;; CHECK-NEXT:                                     (local.get $9)
- ;; CHECK-NEXT:                                     (i32.const 1)
+ ;; CHECK-NEXT:                                  (block (result i32)
+ ;; CHECK-NEXT:                                   (local.set $8
+ ;; CHECK-NEXT:                                    (local.tee $10
+ ;; CHECK-NEXT:                                     (i32.and
+ ;; CHECK-NEXT:                                      (local.get $9)
+ ;; CHECK-NEXT:                                      (i32.const 1)
+ ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
+ ;; CHECK-NEXT:                                   (select
+ ;; CHECK-NEXT:                                    (i32.const 4093)
+ ;; CHECK-NEXT:                                    (i32.const 4091)
+ ;; CHECK-NEXT:                                    (local.get $10)
+ ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
@@ -5606,38 +5791,42 @@
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (local.set $5
  ;; CHECK-NEXT:                                (i32.load
- ;; CHECK-NEXT:                                 (local.get $13)
+ ;; CHECK-NEXT:                                 (local.tee $6
+ ;; CHECK-NEXT:                                  (local.get $15)
+ ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
- ;; CHECK-NEXT:                               (local.set $7
+ ;; CHECK-NEXT:                               (local.set $6
  ;; CHECK-NEXT:                                (i32.load offset=4
- ;; CHECK-NEXT:                                 (local.get $13)
+ ;; CHECK-NEXT:                                 (local.get $6)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (local.set $8
  ;; CHECK-NEXT:                                (i32.const 0)
  ;; CHECK-NEXT:                               )
- ;; CHECK-NEXT:                               (local.set $11
+ ;; CHECK-NEXT:                               (local.set $10
  ;; CHECK-NEXT:                                (i32.const 4091)
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (br $__rjti$4)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (drop
  ;; CHECK-NEXT:                               (i32.load offset=4
- ;; CHECK-NEXT:                                (local.get $13)
+ ;; CHECK-NEXT:                                (local.tee $5
+ ;; CHECK-NEXT:                                 (local.get $15)
+ ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (i32.store8
  ;; CHECK-NEXT:                               (local.get $36)
  ;; CHECK-NEXT:                               (i32.load
- ;; CHECK-NEXT:                                (local.get $13)
+ ;; CHECK-NEXT:                                (local.get $5)
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
- ;; CHECK-NEXT:                              (local.set $7
+ ;; CHECK-NEXT:                              (local.set $6
  ;; CHECK-NEXT:                               (local.get $36)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (local.set $9
- ;; CHECK-NEXT:                               (local.get $12)
+ ;; CHECK-NEXT:                               (local.get $8)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (local.set $12
  ;; CHECK-NEXT:                               (i32.const 1)
@@ -5645,14 +5834,14 @@
  ;; CHECK-NEXT:                              (local.set $8
  ;; CHECK-NEXT:                               (i32.const 0)
  ;; CHECK-NEXT:                              )
- ;; CHECK-NEXT:                              (local.set $11
+ ;; CHECK-NEXT:                              (local.set $10
  ;; CHECK-NEXT:                               (i32.const 4091)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (br $__rjto$8
  ;; CHECK-NEXT:                               (local.get $23)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
- ;; CHECK-NEXT:                             (local.set $5
+ ;; CHECK-NEXT:                             (local.set $6
  ;; CHECK-NEXT:                              (i32.load
  ;; CHECK-NEXT:                               (call $___errno_location)
  ;; CHECK-NEXT:                              )
@@ -5665,7 +5854,7 @@
  ;; CHECK-NEXT:                               (loop $while-in2
  ;; CHECK-NEXT:                                (if
  ;; CHECK-NEXT:                                 (i32.ne
- ;; CHECK-NEXT:                                  (local.get $5)
+ ;; CHECK-NEXT:                                  (local.get $6)
  ;; CHECK-NEXT:                                  (i32.load8_u offset=687
  ;; CHECK-NEXT:                                   (local.get $9)
  ;; CHECK-NEXT:                                  )
@@ -5692,34 +5881,34 @@
  ;; CHECK-NEXT:                               (br_if $__rjti$10
  ;; CHECK-NEXT:                                (local.get $9)
  ;; CHECK-NEXT:                               )
- ;; CHECK-NEXT:                               (local.set $5
+ ;; CHECK-NEXT:                               (local.set $6
  ;; CHECK-NEXT:                                (i32.const 775)
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (br $__rjto$1)
  ;; CHECK-NEXT:                              )
- ;; CHECK-NEXT:                              (local.set $5
+ ;; CHECK-NEXT:                              (local.set $6
  ;; CHECK-NEXT:                               (i32.const 775)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (loop $while-in1
- ;; CHECK-NEXT:                               (local.set $5
+ ;; CHECK-NEXT:                               (local.set $6
  ;; CHECK-NEXT:                                (loop $while-in3 (result i32)
- ;; CHECK-NEXT:                                 (local.set $7
+ ;; CHECK-NEXT:                                 (local.set $5
  ;; CHECK-NEXT:                                  (i32.add
- ;; CHECK-NEXT:                                   (local.get $5)
+ ;; CHECK-NEXT:                                   (local.get $6)
  ;; CHECK-NEXT:                                   (i32.const 1)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (if (result i32)
  ;; CHECK-NEXT:                                  (i32.load8_s
- ;; CHECK-NEXT:                                   (local.get $5)
+ ;; CHECK-NEXT:                                   (local.get $6)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (block
- ;; CHECK-NEXT:                                   (local.set $5
- ;; CHECK-NEXT:                                    (local.get $7)
+ ;; CHECK-NEXT:                                   (local.set $6
+ ;; CHECK-NEXT:                                    (local.get $5)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (br $while-in3)
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.get $7)
+ ;; CHECK-NEXT:                                  (local.get $5)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
@@ -5733,13 +5922,16 @@
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
+ ;; CHECK-NEXT:                             (local.set $5
+ ;; CHECK-NEXT:                              (local.get $6)
+ ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                             (br $__rjti$5)
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (local.set $5
  ;; CHECK-NEXT:                             (select
  ;; CHECK-NEXT:                              (local.tee $5
  ;; CHECK-NEXT:                               (i32.load
- ;; CHECK-NEXT:                                (local.get $13)
+ ;; CHECK-NEXT:                                (local.get $15)
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (i32.const 4101)
@@ -5750,13 +5942,15 @@
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                           (drop
  ;; CHECK-NEXT:                            (i32.load offset=4
- ;; CHECK-NEXT:                             (local.get $13)
+ ;; CHECK-NEXT:                             (local.tee $5
+ ;; CHECK-NEXT:                              (local.get $15)
+ ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                           (i32.store
  ;; CHECK-NEXT:                            (local.get $37)
  ;; CHECK-NEXT:                            (i32.load
- ;; CHECK-NEXT:                             (local.get $13)
+ ;; CHECK-NEXT:                             (local.get $5)
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                           (i32.store
@@ -5764,7 +5958,7 @@
  ;; CHECK-NEXT:                            (i32.const 0)
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                           (i32.store
- ;; CHECK-NEXT:                            (local.get $13)
+ ;; CHECK-NEXT:                            (local.get $5)
  ;; CHECK-NEXT:                            (local.get $37)
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                           (local.set $8
@@ -5773,10 +5967,10 @@
  ;; CHECK-NEXT:                           (br $__rjti$6)
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                          (if
- ;; CHECK-NEXT:                           (local.get $6)
+ ;; CHECK-NEXT:                           (local.get $7)
  ;; CHECK-NEXT:                           (block
  ;; CHECK-NEXT:                            (local.set $8
- ;; CHECK-NEXT:                             (local.get $6)
+ ;; CHECK-NEXT:                             (local.get $7)
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (br $__rjti$6)
  ;; CHECK-NEXT:                           )
@@ -5796,7 +5990,7 @@
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (local.set $14
  ;; CHECK-NEXT:                          (f64.load
- ;; CHECK-NEXT:                           (local.get $13)
+ ;; CHECK-NEXT:                           (local.get $15)
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (i32.store
@@ -5804,21 +5998,19 @@
  ;; CHECK-NEXT:                          (i32.const 0)
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (f64.store
- ;; CHECK-NEXT:                          (local.tee $5
- ;; CHECK-NEXT:                           (global.get $tempDoublePtr)
- ;; CHECK-NEXT:                          )
+ ;; CHECK-NEXT:                          (global.get $tempDoublePtr)
  ;; CHECK-NEXT:                          (local.get $14)
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (drop
  ;; CHECK-NEXT:                          (i32.load
- ;; CHECK-NEXT:                           (local.get $5)
+ ;; CHECK-NEXT:                           (global.get $tempDoublePtr)
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (local.set $30
  ;; CHECK-NEXT:                          (if (result i32)
  ;; CHECK-NEXT:                           (i32.lt_s
  ;; CHECK-NEXT:                            (i32.load offset=4
- ;; CHECK-NEXT:                             (local.get $5)
+ ;; CHECK-NEXT:                             (global.get $tempDoublePtr)
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (i32.const 0)
  ;; CHECK-NEXT:                           )
@@ -5863,22 +6055,20 @@
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (f64.store
- ;; CHECK-NEXT:                          (local.tee $5
- ;; CHECK-NEXT:                           (global.get $tempDoublePtr)
- ;; CHECK-NEXT:                          )
+ ;; CHECK-NEXT:                          (global.get $tempDoublePtr)
  ;; CHECK-NEXT:                          (local.get $14)
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (drop
  ;; CHECK-NEXT:                          (i32.load
- ;; CHECK-NEXT:                           (local.get $5)
+ ;; CHECK-NEXT:                           (global.get $tempDoublePtr)
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                         )
- ;; CHECK-NEXT:                         (local.set $7
+ ;; CHECK-NEXT:                         (local.set $6
  ;; CHECK-NEXT:                          (if (result i32)
  ;; CHECK-NEXT:                           (i32.lt_u
  ;; CHECK-NEXT:                            (i32.and
  ;; CHECK-NEXT:                             (i32.load offset=4
- ;; CHECK-NEXT:                              (local.get $5)
+ ;; CHECK-NEXT:                              (global.get $tempDoublePtr)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                             (i32.const 2146435072)
  ;; CHECK-NEXT:                            )
@@ -5914,23 +6104,23 @@
  ;; CHECK-NEXT:                             (i32.eq
  ;; CHECK-NEXT:                              (local.tee $26
  ;; CHECK-NEXT:                               (i32.or
- ;; CHECK-NEXT:                                (local.get $15)
+ ;; CHECK-NEXT:                                (local.get $19)
  ;; CHECK-NEXT:                                (i32.const 32)
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (i32.const 97)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                             (block
- ;; CHECK-NEXT:                              (local.set $11
+ ;; CHECK-NEXT:                              (local.set $10
  ;; CHECK-NEXT:                               (select
  ;; CHECK-NEXT:                                (i32.add
  ;; CHECK-NEXT:                                 (local.get $30)
  ;; CHECK-NEXT:                                 (i32.const 9)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                                (local.get $30)
- ;; CHECK-NEXT:                                (local.tee $17
+ ;; CHECK-NEXT:                                (local.tee $13
  ;; CHECK-NEXT:                                 (i32.and
- ;; CHECK-NEXT:                                  (local.get $15)
+ ;; CHECK-NEXT:                                  (local.get $19)
  ;; CHECK-NEXT:                                  (i32.const 32)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
@@ -5943,12 +6133,12 @@
  ;; CHECK-NEXT:                                  (local.tee $5
  ;; CHECK-NEXT:                                   (i32.sub
  ;; CHECK-NEXT:                                    (i32.const 12)
- ;; CHECK-NEXT:                                    (local.get $6)
+ ;; CHECK-NEXT:                                    (local.get $7)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (i32.gt_u
- ;; CHECK-NEXT:                                  (local.get $6)
+ ;; CHECK-NEXT:                                  (local.get $7)
  ;; CHECK-NEXT:                                  (i32.const 11)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
@@ -5994,7 +6184,7 @@
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (i32.eq
  ;; CHECK-NEXT:                                   (i32.load8_s
- ;; CHECK-NEXT:                                    (local.get $11)
+ ;; CHECK-NEXT:                                    (local.get $10)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (i32.const 45)
  ;; CHECK-NEXT:                                  )
@@ -6016,15 +6206,15 @@
  ;; CHECK-NEXT:                                   (select
  ;; CHECK-NEXT:                                    (i32.sub
  ;; CHECK-NEXT:                                     (i32.const 0)
- ;; CHECK-NEXT:                                     (local.tee $7
+ ;; CHECK-NEXT:                                     (local.tee $6
  ;; CHECK-NEXT:                                      (i32.load
  ;; CHECK-NEXT:                                       (local.get $21)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
- ;; CHECK-NEXT:                                    (local.get $7)
+ ;; CHECK-NEXT:                                    (local.get $6)
  ;; CHECK-NEXT:                                    (i32.lt_s
- ;; CHECK-NEXT:                                     (local.get $7)
+ ;; CHECK-NEXT:                                     (local.get $6)
  ;; CHECK-NEXT:                                     (i32.const 0)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
@@ -6062,7 +6252,7 @@
  ;; CHECK-NEXT:                               (i32.add
  ;; CHECK-NEXT:                                (i32.and
  ;; CHECK-NEXT:                                 (i32.shr_s
- ;; CHECK-NEXT:                                  (local.get $7)
+ ;; CHECK-NEXT:                                  (local.get $6)
  ;; CHECK-NEXT:                                  (i32.const 31)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (i32.const 2)
@@ -6078,17 +6268,17 @@
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (i32.add
- ;; CHECK-NEXT:                                (local.get $15)
+ ;; CHECK-NEXT:                                (local.get $19)
  ;; CHECK-NEXT:                                (i32.const 15)
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
- ;; CHECK-NEXT:                              (local.set $15
+ ;; CHECK-NEXT:                              (local.set $19
  ;; CHECK-NEXT:                               (i32.le_s
- ;; CHECK-NEXT:                                (local.get $6)
+ ;; CHECK-NEXT:                                (local.get $7)
  ;; CHECK-NEXT:                                (i32.const 0)
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
- ;; CHECK-NEXT:                              (local.set $20
+ ;; CHECK-NEXT:                              (local.set $18
  ;; CHECK-NEXT:                               (i32.eqz
  ;; CHECK-NEXT:                                (i32.and
  ;; CHECK-NEXT:                                 (local.get $9)
@@ -6105,7 +6295,7 @@
  ;; CHECK-NEXT:                                (i32.or
  ;; CHECK-NEXT:                                 (i32.load8_u
  ;; CHECK-NEXT:                                  (i32.add
- ;; CHECK-NEXT:                                   (local.tee $7
+ ;; CHECK-NEXT:                                   (local.tee $6
  ;; CHECK-NEXT:                                    (if (result i32)
  ;; CHECK-NEXT:                                     (f64.ne
  ;; CHECK-NEXT:                                      (local.get $14)
@@ -6134,7 +6324,7 @@
  ;; CHECK-NEXT:                                   (i32.const 4075)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
- ;; CHECK-NEXT:                                 (local.get $17)
+ ;; CHECK-NEXT:                                 (local.get $13)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (local.set $14
@@ -6142,7 +6332,7 @@
  ;; CHECK-NEXT:                                 (f64.sub
  ;; CHECK-NEXT:                                  (local.get $14)
  ;; CHECK-NEXT:                                  (f64.convert_i32_s
- ;; CHECK-NEXT:                                   (local.get $7)
+ ;; CHECK-NEXT:                                   (local.get $6)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (f64.const 16)
@@ -6152,7 +6342,7 @@
  ;; CHECK-NEXT:                                (if (result i32)
  ;; CHECK-NEXT:                                 (i32.eq
  ;; CHECK-NEXT:                                  (i32.sub
- ;; CHECK-NEXT:                                   (local.tee $7
+ ;; CHECK-NEXT:                                   (local.tee $6
  ;; CHECK-NEXT:                                    (i32.add
  ;; CHECK-NEXT:                                     (local.get $5)
  ;; CHECK-NEXT:                                     (i32.const 1)
@@ -6164,19 +6354,19 @@
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (if (result i32)
  ;; CHECK-NEXT:                                  (i32.and
- ;; CHECK-NEXT:                                   (local.get $20)
+ ;; CHECK-NEXT:                                   (local.get $18)
  ;; CHECK-NEXT:                                   (i32.and
- ;; CHECK-NEXT:                                    (local.get $15)
+ ;; CHECK-NEXT:                                    (local.get $19)
  ;; CHECK-NEXT:                                    (f64.eq
  ;; CHECK-NEXT:                                     (local.get $14)
  ;; CHECK-NEXT:                                     (f64.const 0)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.get $7)
+ ;; CHECK-NEXT:                                  (local.get $6)
  ;; CHECK-NEXT:                                  (block (result i32)
  ;; CHECK-NEXT:                                   (i32.store8
- ;; CHECK-NEXT:                                    (local.get $7)
+ ;; CHECK-NEXT:                                    (local.get $6)
  ;; CHECK-NEXT:                                    (i32.const 46)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (i32.add
@@ -6185,7 +6375,7 @@
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
- ;; CHECK-NEXT:                                 (local.get $7)
+ ;; CHECK-NEXT:                                 (local.get $6)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (br_if $while-in56
@@ -6199,13 +6389,13 @@
  ;; CHECK-NEXT:                               (local.get $0)
  ;; CHECK-NEXT:                               (i32.const 32)
  ;; CHECK-NEXT:                               (local.get $16)
- ;; CHECK-NEXT:                               (local.tee $7
+ ;; CHECK-NEXT:                               (local.tee $6
  ;; CHECK-NEXT:                                (i32.add
- ;; CHECK-NEXT:                                 (local.tee $6
+ ;; CHECK-NEXT:                                 (local.tee $7
  ;; CHECK-NEXT:                                  (select
  ;; CHECK-NEXT:                                   (i32.sub
  ;; CHECK-NEXT:                                    (i32.add
- ;; CHECK-NEXT:                                     (local.get $6)
+ ;; CHECK-NEXT:                                     (local.get $7)
  ;; CHECK-NEXT:                                     (local.get $42)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (local.get $8)
@@ -6219,7 +6409,7 @@
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (i32.and
  ;; CHECK-NEXT:                                    (i32.ne
- ;; CHECK-NEXT:                                     (local.get $6)
+ ;; CHECK-NEXT:                                     (local.get $7)
  ;; CHECK-NEXT:                                     (i32.const 0)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (i32.lt_s
@@ -6227,7 +6417,7 @@
  ;; CHECK-NEXT:                                      (local.get $5)
  ;; CHECK-NEXT:                                      (local.get $41)
  ;; CHECK-NEXT:                                     )
- ;; CHECK-NEXT:                                     (local.get $6)
+ ;; CHECK-NEXT:                                     (local.get $7)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
@@ -6248,7 +6438,7 @@
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (drop
  ;; CHECK-NEXT:                                (call $___fwritex
- ;; CHECK-NEXT:                                 (local.get $11)
+ ;; CHECK-NEXT:                                 (local.get $10)
  ;; CHECK-NEXT:                                 (local.get $12)
  ;; CHECK-NEXT:                                 (local.get $0)
  ;; CHECK-NEXT:                                )
@@ -6258,7 +6448,7 @@
  ;; CHECK-NEXT:                               (local.get $0)
  ;; CHECK-NEXT:                               (i32.const 48)
  ;; CHECK-NEXT:                               (local.get $16)
- ;; CHECK-NEXT:                               (local.get $7)
+ ;; CHECK-NEXT:                               (local.get $6)
  ;; CHECK-NEXT:                               (i32.xor
  ;; CHECK-NEXT:                                (local.get $9)
  ;; CHECK-NEXT:                                (i32.const 65536)
@@ -6291,10 +6481,10 @@
  ;; CHECK-NEXT:                               (local.get $0)
  ;; CHECK-NEXT:                               (i32.const 48)
  ;; CHECK-NEXT:                               (i32.sub
- ;; CHECK-NEXT:                                (local.get $6)
+ ;; CHECK-NEXT:                                (local.get $7)
  ;; CHECK-NEXT:                                (i32.add
  ;; CHECK-NEXT:                                 (local.get $5)
- ;; CHECK-NEXT:                                 (local.tee $6
+ ;; CHECK-NEXT:                                 (local.tee $5
  ;; CHECK-NEXT:                                  (i32.sub
  ;; CHECK-NEXT:                                   (local.get $24)
  ;; CHECK-NEXT:                                   (local.get $8)
@@ -6317,7 +6507,7 @@
  ;; CHECK-NEXT:                               (drop
  ;; CHECK-NEXT:                                (call $___fwritex
  ;; CHECK-NEXT:                                 (local.get $8)
- ;; CHECK-NEXT:                                 (local.get $6)
+ ;; CHECK-NEXT:                                 (local.get $5)
  ;; CHECK-NEXT:                                 (local.get $0)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
@@ -6326,7 +6516,7 @@
  ;; CHECK-NEXT:                               (local.get $0)
  ;; CHECK-NEXT:                               (i32.const 32)
  ;; CHECK-NEXT:                               (local.get $16)
- ;; CHECK-NEXT:                               (local.get $7)
+ ;; CHECK-NEXT:                               (local.get $6)
  ;; CHECK-NEXT:                               (i32.xor
  ;; CHECK-NEXT:                                (local.get $9)
  ;; CHECK-NEXT:                                (i32.const 8192)
@@ -6335,9 +6525,9 @@
  ;; CHECK-NEXT:                              (br $do-once49
  ;; CHECK-NEXT:                               (select
  ;; CHECK-NEXT:                                (local.get $16)
- ;; CHECK-NEXT:                                (local.get $7)
+ ;; CHECK-NEXT:                                (local.get $6)
  ;; CHECK-NEXT:                                (i32.lt_s
- ;; CHECK-NEXT:                                 (local.get $7)
+ ;; CHECK-NEXT:                                 (local.get $6)
  ;; CHECK-NEXT:                                 (local.get $16)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
@@ -6374,7 +6564,7 @@
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
- ;; CHECK-NEXT:                            (local.set $7
+ ;; CHECK-NEXT:                            (local.set $6
  ;; CHECK-NEXT:                             (local.tee $8
  ;; CHECK-NEXT:                              (select
  ;; CHECK-NEXT:                               (local.get $43)
@@ -6388,7 +6578,7 @@
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (loop $while-in60
  ;; CHECK-NEXT:                             (i32.store
- ;; CHECK-NEXT:                              (local.get $7)
+ ;; CHECK-NEXT:                              (local.get $6)
  ;; CHECK-NEXT:                              (local.tee $5
  ;; CHECK-NEXT:                               (if (result i32)
  ;; CHECK-NEXT:                                (f64.ne
@@ -6416,9 +6606,9 @@
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
- ;; CHECK-NEXT:                             (local.set $7
+ ;; CHECK-NEXT:                             (local.set $6
  ;; CHECK-NEXT:                              (i32.add
- ;; CHECK-NEXT:                               (local.get $7)
+ ;; CHECK-NEXT:                               (local.get $6)
  ;; CHECK-NEXT:                               (i32.const 4)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
@@ -6441,7 +6631,7 @@
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (if
  ;; CHECK-NEXT:                             (i32.gt_s
- ;; CHECK-NEXT:                              (local.tee $11
+ ;; CHECK-NEXT:                              (local.tee $10
  ;; CHECK-NEXT:                               (i32.load
  ;; CHECK-NEXT:                                (local.get $21)
  ;; CHECK-NEXT:                               )
@@ -6453,21 +6643,21 @@
  ;; CHECK-NEXT:                               (local.get $8)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (loop $while-in62
- ;; CHECK-NEXT:                               (local.set $17
+ ;; CHECK-NEXT:                               (local.set $13
  ;; CHECK-NEXT:                                (select
  ;; CHECK-NEXT:                                 (i32.const 29)
- ;; CHECK-NEXT:                                 (local.get $11)
+ ;; CHECK-NEXT:                                 (local.get $10)
  ;; CHECK-NEXT:                                 (i32.gt_s
- ;; CHECK-NEXT:                                  (local.get $11)
+ ;; CHECK-NEXT:                                  (local.get $10)
  ;; CHECK-NEXT:                                  (i32.const 29)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (if
  ;; CHECK-NEXT:                                (i32.ge_u
- ;; CHECK-NEXT:                                 (local.tee $11
+ ;; CHECK-NEXT:                                 (local.tee $10
  ;; CHECK-NEXT:                                  (i32.sub
- ;; CHECK-NEXT:                                   (local.get $7)
+ ;; CHECK-NEXT:                                   (local.get $6)
  ;; CHECK-NEXT:                                   (i32.const 4)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
@@ -6484,10 +6674,10 @@
  ;; CHECK-NEXT:                                     (local.tee $20
  ;; CHECK-NEXT:                                      (call $_bitshift64Shl
  ;; CHECK-NEXT:                                       (i32.load
- ;; CHECK-NEXT:                                        (local.get $11)
+ ;; CHECK-NEXT:                                        (local.get $10)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                       (i32.const 0)
- ;; CHECK-NEXT:                                       (local.get $17)
+ ;; CHECK-NEXT:                                       (local.get $13)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                     (local.tee $12
@@ -6501,11 +6691,13 @@
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (i32.store
- ;; CHECK-NEXT:                                   (local.get $11)
+ ;; CHECK-NEXT:                                   (local.get $10)
  ;; CHECK-NEXT:                                   (call $___uremdi3
- ;; CHECK-NEXT:                                    (local.get $12)
- ;; CHECK-NEXT:                                    (local.tee $20
- ;; CHECK-NEXT:                                     (global.get $tempRet0)
+ ;; CHECK-NEXT:                                    (local.tee $12
+ ;; CHECK-NEXT:                                     (local.get $12)
+ ;; CHECK-NEXT:                                    )
+ ;; CHECK-NEXT:                                    (local.tee $18
+ ;; CHECK-NEXT:                                     (global.get $tempRet0)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (i32.const 1000000000)
  ;; CHECK-NEXT:                                    (i32.const 0)
@@ -6514,16 +6706,16 @@
  ;; CHECK-NEXT:                                  (local.set $12
  ;; CHECK-NEXT:                                   (call $___udivdi3
  ;; CHECK-NEXT:                                    (local.get $12)
- ;; CHECK-NEXT:                                    (local.get $20)
+ ;; CHECK-NEXT:                                    (local.get $18)
  ;; CHECK-NEXT:                                    (i32.const 1000000000)
  ;; CHECK-NEXT:                                    (i32.const 0)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (br_if $while-in66
  ;; CHECK-NEXT:                                   (i32.ge_u
- ;; CHECK-NEXT:                                    (local.tee $11
+ ;; CHECK-NEXT:                                    (local.tee $10
  ;; CHECK-NEXT:                                     (i32.sub
- ;; CHECK-NEXT:                                      (local.get $11)
+ ;; CHECK-NEXT:                                      (local.get $10)
  ;; CHECK-NEXT:                                      (i32.const 4)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
@@ -6551,22 +6743,22 @@
  ;; CHECK-NEXT:                                (if
  ;; CHECK-NEXT:                                 (i32.lt_u
  ;; CHECK-NEXT:                                  (local.get $5)
- ;; CHECK-NEXT:                                  (local.get $7)
+ ;; CHECK-NEXT:                                  (local.get $6)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (if
  ;; CHECK-NEXT:                                  (i32.eqz
  ;; CHECK-NEXT:                                   (i32.load
- ;; CHECK-NEXT:                                    (local.tee $11
+ ;; CHECK-NEXT:                                    (local.tee $10
  ;; CHECK-NEXT:                                     (i32.sub
- ;; CHECK-NEXT:                                      (local.get $7)
+ ;; CHECK-NEXT:                                      (local.get $6)
  ;; CHECK-NEXT:                                      (i32.const 4)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (block
- ;; CHECK-NEXT:                                   (local.set $7
- ;; CHECK-NEXT:                                    (local.get $11)
+ ;; CHECK-NEXT:                                   (local.set $6
+ ;; CHECK-NEXT:                                    (local.get $10)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (br $while-in68)
  ;; CHECK-NEXT:                                  )
@@ -6575,18 +6767,18 @@
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (i32.store
  ;; CHECK-NEXT:                                (local.get $21)
- ;; CHECK-NEXT:                                (local.tee $11
+ ;; CHECK-NEXT:                                (local.tee $10
  ;; CHECK-NEXT:                                 (i32.sub
  ;; CHECK-NEXT:                                  (i32.load
  ;; CHECK-NEXT:                                   (local.get $21)
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.get $17)
+ ;; CHECK-NEXT:                                  (local.get $13)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (br_if $while-in62
  ;; CHECK-NEXT:                                (i32.gt_s
- ;; CHECK-NEXT:                                 (local.get $11)
+ ;; CHECK-NEXT:                                 (local.get $10)
  ;; CHECK-NEXT:                                 (i32.const 0)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
@@ -6596,19 +6788,19 @@
  ;; CHECK-NEXT:                              (local.get $8)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
- ;; CHECK-NEXT:                            (local.set $19
+ ;; CHECK-NEXT:                            (local.set $18
  ;; CHECK-NEXT:                             (select
  ;; CHECK-NEXT:                              (i32.const 6)
- ;; CHECK-NEXT:                              (local.get $6)
+ ;; CHECK-NEXT:                              (local.get $7)
  ;; CHECK-NEXT:                              (i32.lt_s
- ;; CHECK-NEXT:                               (local.get $6)
+ ;; CHECK-NEXT:                               (local.get $7)
  ;; CHECK-NEXT:                               (i32.const 0)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (if
  ;; CHECK-NEXT:                             (i32.lt_s
- ;; CHECK-NEXT:                              (local.get $11)
+ ;; CHECK-NEXT:                              (local.get $10)
  ;; CHECK-NEXT:                              (i32.const 0)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                             (block
@@ -6616,7 +6808,7 @@
  ;; CHECK-NEXT:                               (i32.add
  ;; CHECK-NEXT:                                (i32.div_s
  ;; CHECK-NEXT:                                 (i32.add
- ;; CHECK-NEXT:                                  (local.get $19)
+ ;; CHECK-NEXT:                                  (local.get $18)
  ;; CHECK-NEXT:                                  (i32.const 25)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (i32.const 9)
@@ -6630,25 +6822,25 @@
  ;; CHECK-NEXT:                                (i32.const 102)
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
- ;; CHECK-NEXT:                              (local.set $6
+ ;; CHECK-NEXT:                              (local.set $7
  ;; CHECK-NEXT:                               (local.get $5)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (local.set $5
- ;; CHECK-NEXT:                               (local.get $7)
+ ;; CHECK-NEXT:                               (local.get $6)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (local.set $5
  ;; CHECK-NEXT:                               (loop $while-in70 (result i32)
- ;; CHECK-NEXT:                                (local.set $17
+ ;; CHECK-NEXT:                                (local.set $13
  ;; CHECK-NEXT:                                 (select
  ;; CHECK-NEXT:                                  (i32.const 9)
- ;; CHECK-NEXT:                                  (local.tee $7
+ ;; CHECK-NEXT:                                  (local.tee $6
  ;; CHECK-NEXT:                                   (i32.sub
  ;; CHECK-NEXT:                                    (i32.const 0)
- ;; CHECK-NEXT:                                    (local.get $11)
+ ;; CHECK-NEXT:                                    (local.get $10)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (i32.gt_s
- ;; CHECK-NEXT:                                   (local.get $7)
+ ;; CHECK-NEXT:                                   (local.get $6)
  ;; CHECK-NEXT:                                   (i32.const 9)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
@@ -6656,59 +6848,59 @@
  ;; CHECK-NEXT:                                (if
  ;; CHECK-NEXT:                                 (i32.gt_u
  ;; CHECK-NEXT:                                  (local.get $5)
- ;; CHECK-NEXT:                                  (local.get $6)
+ ;; CHECK-NEXT:                                  (local.get $7)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (block $do-once71
  ;; CHECK-NEXT:                                  (local.set $12
  ;; CHECK-NEXT:                                   (i32.sub
  ;; CHECK-NEXT:                                    (i32.shl
  ;; CHECK-NEXT:                                     (i32.const 1)
- ;; CHECK-NEXT:                                     (local.get $17)
+ ;; CHECK-NEXT:                                     (local.get $13)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (i32.const 1)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.set $34
+ ;; CHECK-NEXT:                                  (local.set $35
  ;; CHECK-NEXT:                                   (i32.shr_u
  ;; CHECK-NEXT:                                    (i32.const 1000000000)
- ;; CHECK-NEXT:                                    (local.get $17)
+ ;; CHECK-NEXT:                                    (local.get $13)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.set $11
+ ;; CHECK-NEXT:                                  (local.set $10
  ;; CHECK-NEXT:                                   (i32.const 0)
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.set $7
- ;; CHECK-NEXT:                                   (local.get $6)
+ ;; CHECK-NEXT:                                  (local.set $6
+ ;; CHECK-NEXT:                                   (local.get $7)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (loop $while-in74
  ;; CHECK-NEXT:                                   (i32.store
- ;; CHECK-NEXT:                                    (local.get $7)
+ ;; CHECK-NEXT:                                    (local.get $6)
  ;; CHECK-NEXT:                                    (i32.add
- ;; CHECK-NEXT:                                     (local.get $11)
  ;; CHECK-NEXT:                                     (i32.shr_u
- ;; CHECK-NEXT:                                      (local.tee $11
+ ;; CHECK-NEXT:                                      (local.tee $32
  ;; CHECK-NEXT:                                       (i32.load
- ;; CHECK-NEXT:                                        (local.get $7)
+ ;; CHECK-NEXT:                                        (local.get $6)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                      )
- ;; CHECK-NEXT:                                      (local.get $17)
+ ;; CHECK-NEXT:                                      (local.get $13)
  ;; CHECK-NEXT:                                     )
+ ;; CHECK-NEXT:                                     (local.get $10)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
- ;; CHECK-NEXT:                                   (local.set $11
+ ;; CHECK-NEXT:                                   (local.set $10
  ;; CHECK-NEXT:                                    (i32.mul
  ;; CHECK-NEXT:                                     (i32.and
- ;; CHECK-NEXT:                                      (local.get $11)
  ;; CHECK-NEXT:                                      (local.get $12)
+ ;; CHECK-NEXT:                                      (local.get $32)
  ;; CHECK-NEXT:                                     )
- ;; CHECK-NEXT:                                     (local.get $34)
+ ;; CHECK-NEXT:                                     (local.get $35)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (br_if $while-in74
  ;; CHECK-NEXT:                                    (i32.lt_u
- ;; CHECK-NEXT:                                     (local.tee $7
+ ;; CHECK-NEXT:                                     (local.tee $6
  ;; CHECK-NEXT:                                      (i32.add
- ;; CHECK-NEXT:                                       (local.get $7)
+ ;; CHECK-NEXT:                                       (local.get $6)
  ;; CHECK-NEXT:                                       (i32.const 4)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                     )
@@ -6716,26 +6908,26 @@
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.set $7
+ ;; CHECK-NEXT:                                  (local.set $6
  ;; CHECK-NEXT:                                   (select
- ;; CHECK-NEXT:                                    (local.get $6)
+ ;; CHECK-NEXT:                                    (local.get $7)
  ;; CHECK-NEXT:                                    (i32.add
- ;; CHECK-NEXT:                                     (local.get $6)
+ ;; CHECK-NEXT:                                     (local.get $7)
  ;; CHECK-NEXT:                                     (i32.const 4)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (i32.load
- ;; CHECK-NEXT:                                     (local.get $6)
+ ;; CHECK-NEXT:                                     (local.get $7)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (br_if $do-once71
  ;; CHECK-NEXT:                                   (i32.eqz
- ;; CHECK-NEXT:                                    (local.get $11)
+ ;; CHECK-NEXT:                                    (local.get $10)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (i32.store
  ;; CHECK-NEXT:                                   (local.get $5)
- ;; CHECK-NEXT:                                   (local.get $11)
+ ;; CHECK-NEXT:                                   (local.get $10)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (local.set $5
  ;; CHECK-NEXT:                                   (i32.add
@@ -6744,15 +6936,15 @@
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
- ;; CHECK-NEXT:                                 (local.set $7
+ ;; CHECK-NEXT:                                 (local.set $6
  ;; CHECK-NEXT:                                  (select
- ;; CHECK-NEXT:                                   (local.get $6)
+ ;; CHECK-NEXT:                                   (local.get $7)
  ;; CHECK-NEXT:                                   (i32.add
- ;; CHECK-NEXT:                                    (local.get $6)
+ ;; CHECK-NEXT:                                    (local.get $7)
  ;; CHECK-NEXT:                                    (i32.const 4)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (i32.load
- ;; CHECK-NEXT:                                    (local.get $6)
+ ;; CHECK-NEXT:                                    (local.get $7)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
@@ -6760,10 +6952,10 @@
  ;; CHECK-NEXT:                                (local.set $12
  ;; CHECK-NEXT:                                 (select
  ;; CHECK-NEXT:                                  (i32.add
- ;; CHECK-NEXT:                                   (local.tee $6
+ ;; CHECK-NEXT:                                   (local.tee $7
  ;; CHECK-NEXT:                                    (select
  ;; CHECK-NEXT:                                     (local.get $8)
- ;; CHECK-NEXT:                                     (local.get $7)
+ ;; CHECK-NEXT:                                     (local.get $6)
  ;; CHECK-NEXT:                                     (local.get $31)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
@@ -6777,7 +6969,7 @@
  ;; CHECK-NEXT:                                   (i32.shr_s
  ;; CHECK-NEXT:                                    (i32.sub
  ;; CHECK-NEXT:                                     (local.get $5)
- ;; CHECK-NEXT:                                     (local.get $6)
+ ;; CHECK-NEXT:                                     (local.get $7)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (i32.const 2)
  ;; CHECK-NEXT:                                   )
@@ -6787,23 +6979,23 @@
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                                (i32.store
  ;; CHECK-NEXT:                                 (local.get $21)
- ;; CHECK-NEXT:                                 (local.tee $11
+ ;; CHECK-NEXT:                                 (local.tee $10
  ;; CHECK-NEXT:                                  (i32.add
  ;; CHECK-NEXT:                                   (i32.load
  ;; CHECK-NEXT:                                    (local.get $21)
  ;; CHECK-NEXT:                                   )
- ;; CHECK-NEXT:                                   (local.get $17)
+ ;; CHECK-NEXT:                                   (local.get $13)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                                (if (result i32)
  ;; CHECK-NEXT:                                 (i32.lt_s
- ;; CHECK-NEXT:                                  (local.get $11)
+ ;; CHECK-NEXT:                                  (local.get $10)
  ;; CHECK-NEXT:                                  (i32.const 0)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (block
- ;; CHECK-NEXT:                                  (local.set $6
- ;; CHECK-NEXT:                                   (local.get $7)
+ ;; CHECK-NEXT:                                  (local.set $7
+ ;; CHECK-NEXT:                                   (local.get $6)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (local.set $5
  ;; CHECK-NEXT:                                   (local.get $12)
@@ -6811,17 +7003,17 @@
  ;; CHECK-NEXT:                                  (br $while-in70)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (block (result i32)
- ;; CHECK-NEXT:                                  (local.set $11
+ ;; CHECK-NEXT:                                  (local.set $10
  ;; CHECK-NEXT:                                   (local.get $12)
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.get $7)
+ ;; CHECK-NEXT:                                  (local.get $6)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
- ;; CHECK-NEXT:                             (local.set $11
- ;; CHECK-NEXT:                              (local.get $7)
+ ;; CHECK-NEXT:                             (local.set $10
+ ;; CHECK-NEXT:                              (local.get $6)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (local.set $20
@@ -6830,10 +7022,10 @@
  ;; CHECK-NEXT:                            (if
  ;; CHECK-NEXT:                             (i32.lt_u
  ;; CHECK-NEXT:                              (local.get $5)
- ;; CHECK-NEXT:                              (local.get $11)
+ ;; CHECK-NEXT:                              (local.get $10)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                             (block $do-once75
- ;; CHECK-NEXT:                              (local.set $7
+ ;; CHECK-NEXT:                              (local.set $6
  ;; CHECK-NEXT:                               (i32.mul
  ;; CHECK-NEXT:                                (i32.shr_s
  ;; CHECK-NEXT:                                 (i32.sub
@@ -6847,7 +7039,7 @@
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (br_if $do-once75
  ;; CHECK-NEXT:                               (i32.lt_u
- ;; CHECK-NEXT:                                (local.tee $8
+ ;; CHECK-NEXT:                                (local.tee $12
  ;; CHECK-NEXT:                                 (i32.load
  ;; CHECK-NEXT:                                  (local.get $5)
  ;; CHECK-NEXT:                                 )
@@ -6855,22 +7047,22 @@
  ;; CHECK-NEXT:                                (i32.const 10)
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
- ;; CHECK-NEXT:                              (local.set $6
+ ;; CHECK-NEXT:                              (local.set $7
  ;; CHECK-NEXT:                               (i32.const 10)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (loop $while-in78
- ;; CHECK-NEXT:                               (local.set $7
+ ;; CHECK-NEXT:                               (local.set $6
  ;; CHECK-NEXT:                                (i32.add
- ;; CHECK-NEXT:                                 (local.get $7)
+ ;; CHECK-NEXT:                                 (local.get $6)
  ;; CHECK-NEXT:                                 (i32.const 1)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (br_if $while-in78
  ;; CHECK-NEXT:                                (i32.ge_u
- ;; CHECK-NEXT:                                 (local.get $8)
- ;; CHECK-NEXT:                                 (local.tee $6
+ ;; CHECK-NEXT:                                 (local.get $12)
+ ;; CHECK-NEXT:                                 (local.tee $7
  ;; CHECK-NEXT:                                  (i32.mul
- ;; CHECK-NEXT:                                   (local.get $6)
+ ;; CHECK-NEXT:                                   (local.get $7)
  ;; CHECK-NEXT:                                   (i32.const 10)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
@@ -6878,19 +7070,19 @@
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
- ;; CHECK-NEXT:                             (local.set $7
+ ;; CHECK-NEXT:                             (local.set $6
  ;; CHECK-NEXT:                              (i32.const 0)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (local.set $5
  ;; CHECK-NEXT:                             (if (result i32)
  ;; CHECK-NEXT:                              (i32.lt_s
- ;; CHECK-NEXT:                               (local.tee $6
+ ;; CHECK-NEXT:                               (local.tee $7
  ;; CHECK-NEXT:                                (i32.add
  ;; CHECK-NEXT:                                 (i32.sub
- ;; CHECK-NEXT:                                  (local.get $19)
+ ;; CHECK-NEXT:                                  (local.get $18)
  ;; CHECK-NEXT:                                  (select
- ;; CHECK-NEXT:                                   (local.get $7)
+ ;; CHECK-NEXT:                                   (local.get $6)
  ;; CHECK-NEXT:                                   (i32.const 0)
  ;; CHECK-NEXT:                                   (i32.ne
  ;; CHECK-NEXT:                                    (local.get $26)
@@ -6903,11 +7095,11 @@
  ;; CHECK-NEXT:                                   (i32.and
  ;; CHECK-NEXT:                                    (local.tee $31
  ;; CHECK-NEXT:                                     (i32.ne
- ;; CHECK-NEXT:                                      (local.get $19)
+ ;; CHECK-NEXT:                                      (local.get $18)
  ;; CHECK-NEXT:                                      (i32.const 0)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
- ;; CHECK-NEXT:                                    (local.tee $34
+ ;; CHECK-NEXT:                                    (local.tee $35
  ;; CHECK-NEXT:                                     (i32.eq
  ;; CHECK-NEXT:                                      (local.get $26)
  ;; CHECK-NEXT:                                      (i32.const 103)
@@ -6924,7 +7116,7 @@
  ;; CHECK-NEXT:                                (i32.mul
  ;; CHECK-NEXT:                                 (i32.shr_s
  ;; CHECK-NEXT:                                  (i32.sub
- ;; CHECK-NEXT:                                   (local.get $11)
+ ;; CHECK-NEXT:                                   (local.get $10)
  ;; CHECK-NEXT:                                   (local.get $20)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (i32.const 2)
@@ -6935,11 +7127,11 @@
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (block (result i32)
- ;; CHECK-NEXT:                               (local.set $8
+ ;; CHECK-NEXT:                               (local.set $13
  ;; CHECK-NEXT:                                (i32.div_s
- ;; CHECK-NEXT:                                 (local.tee $6
+ ;; CHECK-NEXT:                                 (local.tee $7
  ;; CHECK-NEXT:                                  (i32.add
- ;; CHECK-NEXT:                                   (local.get $6)
+ ;; CHECK-NEXT:                                   (local.get $7)
  ;; CHECK-NEXT:                                   (i32.const 9216)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
@@ -6948,10 +7140,10 @@
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (if
  ;; CHECK-NEXT:                                (i32.lt_s
- ;; CHECK-NEXT:                                 (local.tee $6
+ ;; CHECK-NEXT:                                 (local.tee $7
  ;; CHECK-NEXT:                                  (i32.add
  ;; CHECK-NEXT:                                   (i32.rem_s
- ;; CHECK-NEXT:                                    (local.get $6)
+ ;; CHECK-NEXT:                                    (local.get $7)
  ;; CHECK-NEXT:                                    (i32.const 9)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (i32.const 1)
@@ -6972,9 +7164,9 @@
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (br_if $while-in80
  ;; CHECK-NEXT:                                   (i32.ne
- ;; CHECK-NEXT:                                    (local.tee $6
+ ;; CHECK-NEXT:                                    (local.tee $7
  ;; CHECK-NEXT:                                     (i32.add
- ;; CHECK-NEXT:                                      (local.get $6)
+ ;; CHECK-NEXT:                                      (local.get $7)
  ;; CHECK-NEXT:                                      (i32.const 1)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
@@ -6987,27 +7179,29 @@
  ;; CHECK-NEXT:                                 (i32.const 10)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
- ;; CHECK-NEXT:                               (local.set $8
- ;; CHECK-NEXT:                                (i32.load
- ;; CHECK-NEXT:                                 (local.tee $6
- ;; CHECK-NEXT:                                  (i32.sub
- ;; CHECK-NEXT:                                   (i32.add
- ;; CHECK-NEXT:                                    (local.get $20)
- ;; CHECK-NEXT:                                    (i32.shl
+ ;; CHECK-NEXT:                               (local.set $13
+ ;; CHECK-NEXT:                                (local.tee $26
+ ;; CHECK-NEXT:                                 (i32.load
+ ;; CHECK-NEXT:                                  (local.tee $7
+ ;; CHECK-NEXT:                                   (i32.sub
+ ;; CHECK-NEXT:                                    (i32.add
  ;; CHECK-NEXT:                                     (local.get $8)
- ;; CHECK-NEXT:                                     (i32.const 2)
+ ;; CHECK-NEXT:                                     (i32.shl
+ ;; CHECK-NEXT:                                      (local.get $13)
+ ;; CHECK-NEXT:                                      (i32.const 2)
+ ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
+ ;; CHECK-NEXT:                                    (i32.const 4092)
  ;; CHECK-NEXT:                                   )
- ;; CHECK-NEXT:                                   (i32.const 4092)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
- ;; CHECK-NEXT:                               (local.set $17
+ ;; CHECK-NEXT:                               (local.set $13
  ;; CHECK-NEXT:                                (if (result i32)
  ;; CHECK-NEXT:                                 (local.get $12)
  ;; CHECK-NEXT:                                 (i32.rem_u
- ;; CHECK-NEXT:                                  (local.get $8)
+ ;; CHECK-NEXT:                                  (local.get $13)
  ;; CHECK-NEXT:                                  (local.get $12)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (i32.const 0)
@@ -7016,26 +7210,26 @@
  ;; CHECK-NEXT:                               (if
  ;; CHECK-NEXT:                                (i32.eqz
  ;; CHECK-NEXT:                                 (i32.and
- ;; CHECK-NEXT:                                  (local.tee $26
+ ;; CHECK-NEXT:                                  (local.tee $32
  ;; CHECK-NEXT:                                   (i32.eq
  ;; CHECK-NEXT:                                    (i32.add
- ;; CHECK-NEXT:                                     (local.get $6)
+ ;; CHECK-NEXT:                                     (local.get $7)
  ;; CHECK-NEXT:                                     (i32.const 4)
  ;; CHECK-NEXT:                                    )
- ;; CHECK-NEXT:                                    (local.get $11)
+ ;; CHECK-NEXT:                                    (local.get $10)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (i32.eqz
- ;; CHECK-NEXT:                                   (local.get $17)
+ ;; CHECK-NEXT:                                   (local.get $13)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                                (block $do-once81
- ;; CHECK-NEXT:                                 (local.set $35
+ ;; CHECK-NEXT:                                 (local.set $45
  ;; CHECK-NEXT:                                  (if (result i32)
  ;; CHECK-NEXT:                                   (local.get $12)
  ;; CHECK-NEXT:                                   (i32.div_u
- ;; CHECK-NEXT:                                    (local.get $8)
+ ;; CHECK-NEXT:                                    (local.get $26)
  ;; CHECK-NEXT:                                    (local.get $12)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (i32.const 0)
@@ -7044,8 +7238,8 @@
  ;; CHECK-NEXT:                                 (local.set $14
  ;; CHECK-NEXT:                                  (if (result f64)
  ;; CHECK-NEXT:                                   (i32.lt_u
- ;; CHECK-NEXT:                                    (local.get $17)
- ;; CHECK-NEXT:                                    (local.tee $45
+ ;; CHECK-NEXT:                                    (local.get $13)
+ ;; CHECK-NEXT:                                    (local.tee $46
  ;; CHECK-NEXT:                                     (i32.div_s
  ;; CHECK-NEXT:                                      (local.get $12)
  ;; CHECK-NEXT:                                      (i32.const 2)
@@ -7057,10 +7251,10 @@
  ;; CHECK-NEXT:                                    (f64.const 1)
  ;; CHECK-NEXT:                                    (f64.const 1.5)
  ;; CHECK-NEXT:                                    (i32.and
- ;; CHECK-NEXT:                                     (local.get $26)
+ ;; CHECK-NEXT:                                     (local.get $32)
  ;; CHECK-NEXT:                                     (i32.eq
- ;; CHECK-NEXT:                                      (local.get $17)
- ;; CHECK-NEXT:                                      (local.get $45)
+ ;; CHECK-NEXT:                                      (local.get $13)
+ ;; CHECK-NEXT:                                      (local.get $46)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
@@ -7071,7 +7265,7 @@
  ;; CHECK-NEXT:                                   (f64.const 9007199254740994)
  ;; CHECK-NEXT:                                   (f64.const 9007199254740992)
  ;; CHECK-NEXT:                                   (i32.and
- ;; CHECK-NEXT:                                    (local.get $35)
+ ;; CHECK-NEXT:                                    (local.get $45)
  ;; CHECK-NEXT:                                    (i32.const 1)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
@@ -7100,11 +7294,11 @@
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (i32.store
- ;; CHECK-NEXT:                                  (local.get $6)
- ;; CHECK-NEXT:                                  (local.tee $8
+ ;; CHECK-NEXT:                                  (local.get $7)
+ ;; CHECK-NEXT:                                  (local.tee $13
  ;; CHECK-NEXT:                                   (i32.sub
- ;; CHECK-NEXT:                                    (local.get $8)
- ;; CHECK-NEXT:                                    (local.get $17)
+ ;; CHECK-NEXT:                                    (local.get $26)
+ ;; CHECK-NEXT:                                    (local.get $13)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
@@ -7118,29 +7312,29 @@
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (i32.store
- ;; CHECK-NEXT:                                  (local.get $6)
- ;; CHECK-NEXT:                                  (local.tee $7
+ ;; CHECK-NEXT:                                  (local.get $7)
+ ;; CHECK-NEXT:                                  (local.tee $6
  ;; CHECK-NEXT:                                   (i32.add
- ;; CHECK-NEXT:                                    (local.get $8)
  ;; CHECK-NEXT:                                    (local.get $12)
+ ;; CHECK-NEXT:                                    (local.get $13)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (if
  ;; CHECK-NEXT:                                  (i32.gt_u
- ;; CHECK-NEXT:                                   (local.get $7)
+ ;; CHECK-NEXT:                                   (local.get $6)
  ;; CHECK-NEXT:                                   (i32.const 999999999)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (loop $while-in86
  ;; CHECK-NEXT:                                   (i32.store
- ;; CHECK-NEXT:                                    (local.get $6)
+ ;; CHECK-NEXT:                                    (local.get $7)
  ;; CHECK-NEXT:                                    (i32.const 0)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (if
  ;; CHECK-NEXT:                                    (i32.lt_u
- ;; CHECK-NEXT:                                     (local.tee $6
+ ;; CHECK-NEXT:                                     (local.tee $7
  ;; CHECK-NEXT:                                      (i32.sub
- ;; CHECK-NEXT:                                       (local.get $6)
+ ;; CHECK-NEXT:                                       (local.get $7)
  ;; CHECK-NEXT:                                       (i32.const 4)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                     )
@@ -7157,11 +7351,11 @@
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (i32.store
- ;; CHECK-NEXT:                                    (local.get $6)
- ;; CHECK-NEXT:                                    (local.tee $7
+ ;; CHECK-NEXT:                                    (local.get $7)
+ ;; CHECK-NEXT:                                    (local.tee $6
  ;; CHECK-NEXT:                                     (i32.add
  ;; CHECK-NEXT:                                      (i32.load
- ;; CHECK-NEXT:                                       (local.get $6)
+ ;; CHECK-NEXT:                                       (local.get $7)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                      (i32.const 1)
  ;; CHECK-NEXT:                                     )
@@ -7169,13 +7363,13 @@
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (br_if $while-in86
  ;; CHECK-NEXT:                                    (i32.gt_u
- ;; CHECK-NEXT:                                     (local.get $7)
+ ;; CHECK-NEXT:                                     (local.get $6)
  ;; CHECK-NEXT:                                     (i32.const 999999999)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
- ;; CHECK-NEXT:                                 (local.set $7
+ ;; CHECK-NEXT:                                 (local.set $6
  ;; CHECK-NEXT:                                  (i32.mul
  ;; CHECK-NEXT:                                   (i32.shr_s
  ;; CHECK-NEXT:                                    (i32.sub
@@ -7189,7 +7383,7 @@
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (br_if $do-once81
  ;; CHECK-NEXT:                                  (i32.lt_u
- ;; CHECK-NEXT:                                   (local.tee $8
+ ;; CHECK-NEXT:                                   (local.tee $13
  ;; CHECK-NEXT:                                    (i32.load
  ;; CHECK-NEXT:                                     (local.get $5)
  ;; CHECK-NEXT:                                    )
@@ -7201,15 +7395,15 @@
  ;; CHECK-NEXT:                                  (i32.const 10)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (loop $while-in88
- ;; CHECK-NEXT:                                  (local.set $7
+ ;; CHECK-NEXT:                                  (local.set $6
  ;; CHECK-NEXT:                                   (i32.add
- ;; CHECK-NEXT:                                    (local.get $7)
+ ;; CHECK-NEXT:                                    (local.get $6)
  ;; CHECK-NEXT:                                    (i32.const 1)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (br_if $while-in88
  ;; CHECK-NEXT:                                   (i32.ge_u
- ;; CHECK-NEXT:                                    (local.get $8)
+ ;; CHECK-NEXT:                                    (local.get $13)
  ;; CHECK-NEXT:                                    (local.tee $12
  ;; CHECK-NEXT:                                     (i32.mul
  ;; CHECK-NEXT:                                      (local.get $12)
@@ -7224,20 +7418,20 @@
  ;; CHECK-NEXT:                               (local.set $12
  ;; CHECK-NEXT:                                (local.get $5)
  ;; CHECK-NEXT:                               )
- ;; CHECK-NEXT:                               (local.set $8
- ;; CHECK-NEXT:                                (local.get $7)
+ ;; CHECK-NEXT:                               (local.set $13
+ ;; CHECK-NEXT:                                (local.get $6)
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (select
  ;; CHECK-NEXT:                                (local.tee $5
  ;; CHECK-NEXT:                                 (i32.add
- ;; CHECK-NEXT:                                  (local.get $6)
+ ;; CHECK-NEXT:                                  (local.get $7)
  ;; CHECK-NEXT:                                  (i32.const 4)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
- ;; CHECK-NEXT:                                (local.get $11)
+ ;; CHECK-NEXT:                                (local.get $10)
  ;; CHECK-NEXT:                                (i32.lt_u
  ;; CHECK-NEXT:                                 (local.get $5)
- ;; CHECK-NEXT:                                 (local.get $11)
+ ;; CHECK-NEXT:                                 (local.get $10)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
@@ -7245,20 +7439,20 @@
  ;; CHECK-NEXT:                               (local.set $12
  ;; CHECK-NEXT:                                (local.get $5)
  ;; CHECK-NEXT:                               )
- ;; CHECK-NEXT:                               (local.set $8
- ;; CHECK-NEXT:                                (local.get $7)
+ ;; CHECK-NEXT:                               (local.set $13
+ ;; CHECK-NEXT:                                (local.get $6)
  ;; CHECK-NEXT:                               )
- ;; CHECK-NEXT:                               (local.get $11)
+ ;; CHECK-NEXT:                               (local.get $10)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
- ;; CHECK-NEXT:                            (local.set $35
+ ;; CHECK-NEXT:                            (local.set $32
  ;; CHECK-NEXT:                             (i32.sub
  ;; CHECK-NEXT:                              (i32.const 0)
- ;; CHECK-NEXT:                              (local.get $8)
+ ;; CHECK-NEXT:                              (local.get $13)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
- ;; CHECK-NEXT:                            (local.set $11
+ ;; CHECK-NEXT:                            (local.set $10
  ;; CHECK-NEXT:                             (loop $while-in90 (result i32)
  ;; CHECK-NEXT:                              (block $while-out89 (result i32)
  ;; CHECK-NEXT:                               (if
@@ -7277,7 +7471,7 @@
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (if (result i32)
  ;; CHECK-NEXT:                                (i32.load
- ;; CHECK-NEXT:                                 (local.tee $7
+ ;; CHECK-NEXT:                                 (local.tee $6
  ;; CHECK-NEXT:                                  (i32.sub
  ;; CHECK-NEXT:                                   (local.get $5)
  ;; CHECK-NEXT:                                   (i32.const 4)
@@ -7292,7 +7486,7 @@
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                                (block
  ;; CHECK-NEXT:                                 (local.set $5
- ;; CHECK-NEXT:                                  (local.get $7)
+ ;; CHECK-NEXT:                                  (local.get $6)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (br $while-in90)
  ;; CHECK-NEXT:                                )
@@ -7304,70 +7498,76 @@
  ;; CHECK-NEXT:                             (local.get $0)
  ;; CHECK-NEXT:                             (i32.const 32)
  ;; CHECK-NEXT:                             (local.get $16)
- ;; CHECK-NEXT:                             (local.tee $8
+ ;; CHECK-NEXT:                             (local.tee $13
  ;; CHECK-NEXT:                              (i32.add
  ;; CHECK-NEXT:                               (i32.add
  ;; CHECK-NEXT:                                (i32.add
  ;; CHECK-NEXT:                                 (local.tee $5
  ;; CHECK-NEXT:                                  (if (result i32)
- ;; CHECK-NEXT:                                   (local.get $34)
+ ;; CHECK-NEXT:                                   (local.get $35)
  ;; CHECK-NEXT:                                   (block $do-once91 (result i32)
- ;; CHECK-NEXT:                                    (local.set $7
+ ;; CHECK-NEXT:                                    (local.set $6
  ;; CHECK-NEXT:                                     (if (result i32)
  ;; CHECK-NEXT:                                      (i32.and
  ;; CHECK-NEXT:                                       (i32.gt_s
  ;; CHECK-NEXT:                                        (local.tee $5
  ;; CHECK-NEXT:                                         (i32.add
- ;; CHECK-NEXT:                                          (i32.eqz
+ ;; CHECK-NEXT:                                          (i32.xor
  ;; CHECK-NEXT:                                           (local.get $31)
+ ;; CHECK-NEXT:                                           (i32.const 1)
  ;; CHECK-NEXT:                                          )
- ;; CHECK-NEXT:                                          (local.get $19)
+ ;; CHECK-NEXT:                                          (local.get $18)
  ;; CHECK-NEXT:                                         )
  ;; CHECK-NEXT:                                        )
- ;; CHECK-NEXT:                                        (local.get $8)
+ ;; CHECK-NEXT:                                        (local.get $13)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                       (i32.gt_s
- ;; CHECK-NEXT:                                        (local.get $8)
+ ;; CHECK-NEXT:                                        (local.get $13)
  ;; CHECK-NEXT:                                        (i32.const -5)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                      (block (result i32)
- ;; CHECK-NEXT:                                       (local.set $19
+ ;; CHECK-NEXT:                                       (local.set $18
  ;; CHECK-NEXT:                                        (i32.sub
  ;; CHECK-NEXT:                                         (i32.sub
  ;; CHECK-NEXT:                                          (local.get $5)
  ;; CHECK-NEXT:                                          (i32.const 1)
  ;; CHECK-NEXT:                                         )
- ;; CHECK-NEXT:                                         (local.get $8)
+ ;; CHECK-NEXT:                                         (local.get $13)
  ;; CHECK-NEXT:                                        )
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                       (i32.sub
- ;; CHECK-NEXT:                                        (local.get $15)
+ ;; CHECK-NEXT:                                        (local.get $19)
  ;; CHECK-NEXT:                                        (i32.const 1)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                      (block (result i32)
- ;; CHECK-NEXT:                                       (local.set $19
+ ;; CHECK-NEXT:                                       (local.set $18
  ;; CHECK-NEXT:                                        (i32.sub
  ;; CHECK-NEXT:                                         (local.get $5)
  ;; CHECK-NEXT:                                         (i32.const 1)
  ;; CHECK-NEXT:                                        )
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                       (i32.sub
- ;; CHECK-NEXT:                                        (local.get $15)
+ ;; CHECK-NEXT:                                        (local.get $19)
  ;; CHECK-NEXT:                                        (i32.const 2)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
- ;; CHECK-NEXT:                                    (drop
- ;; CHECK-NEXT:                                     (br_if $do-once91
- ;; CHECK-NEXT:                                      (local.get $19)
- ;; CHECK-NEXT:                                      (local.tee $17
- ;; CHECK-NEXT:                                       (i32.and
- ;; CHECK-NEXT:                                        (local.get $9)
- ;; CHECK-NEXT:                                        (i32.const 8)
- ;; CHECK-NEXT:                                       )
+ ;; CHECK-NEXT:                                    (if
+ ;; CHECK-NEXT:                                     (local.tee $5
+ ;; CHECK-NEXT:                                      (i32.and
+ ;; CHECK-NEXT:                                       (local.get $9)
+ ;; CHECK-NEXT:                                       (i32.const 8)
+ ;; CHECK-NEXT:                                      )
+ ;; CHECK-NEXT:                                     )
+ ;; CHECK-NEXT:                                     (block
+ ;; CHECK-NEXT:                                      (local.set $20
+ ;; CHECK-NEXT:                                       (local.get $5)
+ ;; CHECK-NEXT:                                      )
+ ;; CHECK-NEXT:                                      (br $do-once91
+ ;; CHECK-NEXT:                                       (local.get $18)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
@@ -7376,10 +7576,10 @@
  ;; CHECK-NEXT:                                     (block $do-once93
  ;; CHECK-NEXT:                                      (if
  ;; CHECK-NEXT:                                       (i32.eqz
- ;; CHECK-NEXT:                                        (local.tee $15
+ ;; CHECK-NEXT:                                        (local.tee $19
  ;; CHECK-NEXT:                                         (i32.load
  ;; CHECK-NEXT:                                          (i32.sub
- ;; CHECK-NEXT:                                           (local.get $11)
+ ;; CHECK-NEXT:                                           (local.get $10)
  ;; CHECK-NEXT:                                           (i32.const 4)
  ;; CHECK-NEXT:                                          )
  ;; CHECK-NEXT:                                         )
@@ -7395,7 +7595,7 @@
  ;; CHECK-NEXT:                                      (local.set $5
  ;; CHECK-NEXT:                                       (if (result i32)
  ;; CHECK-NEXT:                                        (i32.rem_u
- ;; CHECK-NEXT:                                         (local.get $15)
+ ;; CHECK-NEXT:                                         (local.get $19)
  ;; CHECK-NEXT:                                         (i32.const 10)
  ;; CHECK-NEXT:                                        )
  ;; CHECK-NEXT:                                        (block
@@ -7405,7 +7605,7 @@
  ;; CHECK-NEXT:                                         (br $do-once93)
  ;; CHECK-NEXT:                                        )
  ;; CHECK-NEXT:                                        (block (result i32)
- ;; CHECK-NEXT:                                         (local.set $6
+ ;; CHECK-NEXT:                                         (local.set $7
  ;; CHECK-NEXT:                                          (i32.const 10)
  ;; CHECK-NEXT:                                         )
  ;; CHECK-NEXT:                                         (i32.const 0)
@@ -7422,15 +7622,15 @@
  ;; CHECK-NEXT:                                       (br_if $while-in96
  ;; CHECK-NEXT:                                        (i32.eqz
  ;; CHECK-NEXT:                                         (if (result i32)
- ;; CHECK-NEXT:                                          (local.tee $6
+ ;; CHECK-NEXT:                                          (local.tee $7
  ;; CHECK-NEXT:                                           (i32.mul
- ;; CHECK-NEXT:                                            (local.get $6)
+ ;; CHECK-NEXT:                                            (local.get $7)
  ;; CHECK-NEXT:                                            (i32.const 10)
  ;; CHECK-NEXT:                                           )
  ;; CHECK-NEXT:                                          )
  ;; CHECK-NEXT:                                          (i32.rem_u
- ;; CHECK-NEXT:                                           (local.get $15)
- ;; CHECK-NEXT:                                           (local.get $6)
+ ;; CHECK-NEXT:                                           (local.get $19)
+ ;; CHECK-NEXT:                                           (local.get $7)
  ;; CHECK-NEXT:                                          )
  ;; CHECK-NEXT:                                          (i32.const 0)
  ;; CHECK-NEXT:                                         )
@@ -7442,12 +7642,12 @@
  ;; CHECK-NEXT:                                      (i32.const 9)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
- ;; CHECK-NEXT:                                    (local.set $6
+ ;; CHECK-NEXT:                                    (local.set $7
  ;; CHECK-NEXT:                                     (i32.sub
  ;; CHECK-NEXT:                                      (i32.mul
  ;; CHECK-NEXT:                                       (i32.shr_s
  ;; CHECK-NEXT:                                        (i32.sub
- ;; CHECK-NEXT:                                         (local.get $11)
+ ;; CHECK-NEXT:                                         (local.get $10)
  ;; CHECK-NEXT:                                         (local.get $20)
  ;; CHECK-NEXT:                                        )
  ;; CHECK-NEXT:                                        (i32.const 2)
@@ -7460,23 +7660,23 @@
  ;; CHECK-NEXT:                                    (if (result i32)
  ;; CHECK-NEXT:                                     (i32.eq
  ;; CHECK-NEXT:                                      (i32.or
- ;; CHECK-NEXT:                                       (local.get $7)
+ ;; CHECK-NEXT:                                       (local.get $6)
  ;; CHECK-NEXT:                                       (i32.const 32)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                      (i32.const 102)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                     (block (result i32)
- ;; CHECK-NEXT:                                      (local.set $17
+ ;; CHECK-NEXT:                                      (local.set $20
  ;; CHECK-NEXT:                                       (i32.const 0)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                      (select
- ;; CHECK-NEXT:                                       (local.get $19)
+ ;; CHECK-NEXT:                                       (local.get $18)
  ;; CHECK-NEXT:                                       (local.tee $5
  ;; CHECK-NEXT:                                        (select
  ;; CHECK-NEXT:                                         (i32.const 0)
  ;; CHECK-NEXT:                                         (local.tee $5
  ;; CHECK-NEXT:                                          (i32.sub
- ;; CHECK-NEXT:                                           (local.get $6)
+ ;; CHECK-NEXT:                                           (local.get $7)
  ;; CHECK-NEXT:                                           (local.get $5)
  ;; CHECK-NEXT:                                          )
  ;; CHECK-NEXT:                                         )
@@ -7488,24 +7688,24 @@
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                       (i32.gt_s
  ;; CHECK-NEXT:                                        (local.get $5)
- ;; CHECK-NEXT:                                        (local.get $19)
+ ;; CHECK-NEXT:                                        (local.get $18)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                     (block (result i32)
- ;; CHECK-NEXT:                                      (local.set $17
+ ;; CHECK-NEXT:                                      (local.set $20
  ;; CHECK-NEXT:                                       (i32.const 0)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                      (select
- ;; CHECK-NEXT:                                       (local.get $19)
+ ;; CHECK-NEXT:                                       (local.get $18)
  ;; CHECK-NEXT:                                       (local.tee $5
  ;; CHECK-NEXT:                                        (select
  ;; CHECK-NEXT:                                         (i32.const 0)
  ;; CHECK-NEXT:                                         (local.tee $5
  ;; CHECK-NEXT:                                          (i32.sub
  ;; CHECK-NEXT:                                           (i32.add
- ;; CHECK-NEXT:                                            (local.get $6)
- ;; CHECK-NEXT:                                            (local.get $8)
+ ;; CHECK-NEXT:                                            (local.get $7)
+ ;; CHECK-NEXT:                                            (local.get $13)
  ;; CHECK-NEXT:                                           )
  ;; CHECK-NEXT:                                           (local.get $5)
  ;; CHECK-NEXT:                                          )
@@ -7518,23 +7718,23 @@
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                       (i32.gt_s
  ;; CHECK-NEXT:                                        (local.get $5)
- ;; CHECK-NEXT:                                        (local.get $19)
+ ;; CHECK-NEXT:                                        (local.get $18)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (block (result i32)
- ;; CHECK-NEXT:                                    (local.set $17
+ ;; CHECK-NEXT:                                    (local.set $20
  ;; CHECK-NEXT:                                     (i32.and
  ;; CHECK-NEXT:                                      (local.get $9)
  ;; CHECK-NEXT:                                      (i32.const 8)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
- ;; CHECK-NEXT:                                    (local.set $7
- ;; CHECK-NEXT:                                     (local.get $15)
+ ;; CHECK-NEXT:                                    (local.set $6
+ ;; CHECK-NEXT:                                     (local.get $19)
  ;; CHECK-NEXT:                                    )
- ;; CHECK-NEXT:                                    (local.get $19)
+ ;; CHECK-NEXT:                                    (local.get $18)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
@@ -7544,34 +7744,34 @@
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                                (i32.ne
- ;; CHECK-NEXT:                                 (local.tee $19
+ ;; CHECK-NEXT:                                 (local.tee $31
  ;; CHECK-NEXT:                                  (i32.or
  ;; CHECK-NEXT:                                   (local.get $5)
- ;; CHECK-NEXT:                                   (local.get $17)
+ ;; CHECK-NEXT:                                   (local.get $20)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (i32.const 0)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (if (result i32)
- ;; CHECK-NEXT:                                (local.tee $31
+ ;; CHECK-NEXT:                                (local.tee $18
  ;; CHECK-NEXT:                                 (i32.eq
  ;; CHECK-NEXT:                                  (i32.or
- ;; CHECK-NEXT:                                   (local.get $7)
+ ;; CHECK-NEXT:                                   (local.get $6)
  ;; CHECK-NEXT:                                   (i32.const 32)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (i32.const 102)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                                (block (result i32)
- ;; CHECK-NEXT:                                 (local.set $15
+ ;; CHECK-NEXT:                                 (local.set $19
  ;; CHECK-NEXT:                                  (i32.const 0)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (select
- ;; CHECK-NEXT:                                  (local.get $8)
+ ;; CHECK-NEXT:                                  (local.get $13)
  ;; CHECK-NEXT:                                  (i32.const 0)
  ;; CHECK-NEXT:                                  (i32.gt_s
- ;; CHECK-NEXT:                                   (local.get $8)
+ ;; CHECK-NEXT:                                   (local.get $13)
  ;; CHECK-NEXT:                                   (i32.const 0)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
@@ -7581,14 +7781,14 @@
  ;; CHECK-NEXT:                                  (i32.lt_s
  ;; CHECK-NEXT:                                   (i32.sub
  ;; CHECK-NEXT:                                    (local.get $24)
- ;; CHECK-NEXT:                                    (local.tee $6
+ ;; CHECK-NEXT:                                    (local.tee $7
  ;; CHECK-NEXT:                                     (call $_fmt_u
- ;; CHECK-NEXT:                                      (local.tee $6
+ ;; CHECK-NEXT:                                      (local.tee $7
  ;; CHECK-NEXT:                                       (select
- ;; CHECK-NEXT:                                        (local.get $35)
- ;; CHECK-NEXT:                                        (local.get $8)
+ ;; CHECK-NEXT:                                        (local.get $32)
+ ;; CHECK-NEXT:                                        (local.get $13)
  ;; CHECK-NEXT:                                        (i32.lt_s
- ;; CHECK-NEXT:                                         (local.get $8)
+ ;; CHECK-NEXT:                                         (local.get $13)
  ;; CHECK-NEXT:                                         (i32.const 0)
  ;; CHECK-NEXT:                                        )
  ;; CHECK-NEXT:                                       )
@@ -7596,7 +7796,7 @@
  ;; CHECK-NEXT:                                      (i32.shr_s
  ;; CHECK-NEXT:                                       (i32.shl
  ;; CHECK-NEXT:                                        (i32.lt_s
- ;; CHECK-NEXT:                                         (local.get $6)
+ ;; CHECK-NEXT:                                         (local.get $7)
  ;; CHECK-NEXT:                                         (i32.const 0)
  ;; CHECK-NEXT:                                        )
  ;; CHECK-NEXT:                                        (i32.const 31)
@@ -7611,9 +7811,9 @@
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (loop $while-in98
  ;; CHECK-NEXT:                                   (i32.store8
- ;; CHECK-NEXT:                                    (local.tee $6
+ ;; CHECK-NEXT:                                    (local.tee $7
  ;; CHECK-NEXT:                                     (i32.sub
- ;; CHECK-NEXT:                                      (local.get $6)
+ ;; CHECK-NEXT:                                      (local.get $7)
  ;; CHECK-NEXT:                                      (i32.const 1)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
@@ -7623,7 +7823,7 @@
  ;; CHECK-NEXT:                                    (i32.lt_s
  ;; CHECK-NEXT:                                     (i32.sub
  ;; CHECK-NEXT:                                      (local.get $24)
- ;; CHECK-NEXT:                                      (local.get $6)
+ ;; CHECK-NEXT:                                      (local.get $7)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                     (i32.const 2)
  ;; CHECK-NEXT:                                    )
@@ -7632,13 +7832,13 @@
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (i32.store8
  ;; CHECK-NEXT:                                  (i32.sub
- ;; CHECK-NEXT:                                   (local.get $6)
+ ;; CHECK-NEXT:                                   (local.get $7)
  ;; CHECK-NEXT:                                   (i32.const 1)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (i32.add
  ;; CHECK-NEXT:                                   (i32.and
  ;; CHECK-NEXT:                                    (i32.shr_s
- ;; CHECK-NEXT:                                     (local.get $8)
+ ;; CHECK-NEXT:                                     (local.get $13)
  ;; CHECK-NEXT:                                     (i32.const 31)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (i32.const 2)
@@ -7647,17 +7847,20 @@
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (i32.store8
- ;; CHECK-NEXT:                                  (local.tee $15
+ ;; CHECK-NEXT:                                  (local.tee $7
  ;; CHECK-NEXT:                                   (i32.sub
- ;; CHECK-NEXT:                                    (local.get $6)
+ ;; CHECK-NEXT:                                    (local.get $7)
  ;; CHECK-NEXT:                                    (i32.const 2)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
+ ;; CHECK-NEXT:                                  (local.get $6)
+ ;; CHECK-NEXT:                                 )
+ ;; CHECK-NEXT:                                 (local.set $19
  ;; CHECK-NEXT:                                  (local.get $7)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (i32.sub
  ;; CHECK-NEXT:                                  (local.get $24)
- ;; CHECK-NEXT:                                  (local.get $15)
+ ;; CHECK-NEXT:                                  (local.get $7)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
@@ -7686,32 +7889,32 @@
  ;; CHECK-NEXT:                             (local.get $0)
  ;; CHECK-NEXT:                             (i32.const 48)
  ;; CHECK-NEXT:                             (local.get $16)
- ;; CHECK-NEXT:                             (local.get $8)
+ ;; CHECK-NEXT:                             (local.get $13)
  ;; CHECK-NEXT:                             (i32.xor
  ;; CHECK-NEXT:                              (local.get $9)
  ;; CHECK-NEXT:                              (i32.const 65536)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (if
- ;; CHECK-NEXT:                             (local.get $31)
+ ;; CHECK-NEXT:                             (local.get $18)
  ;; CHECK-NEXT:                             (block
- ;; CHECK-NEXT:                              (local.set $6
+ ;; CHECK-NEXT:                              (local.set $7
  ;; CHECK-NEXT:                               (local.tee $12
  ;; CHECK-NEXT:                                (select
- ;; CHECK-NEXT:                                 (local.get $20)
+ ;; CHECK-NEXT:                                 (local.get $8)
  ;; CHECK-NEXT:                                 (local.get $12)
- ;; CHECK-NEXT:                                 (i32.gt_u
+ ;; CHECK-NEXT:                                 (i32.lt_u
+ ;; CHECK-NEXT:                                  (local.get $8)
  ;; CHECK-NEXT:                                  (local.get $12)
- ;; CHECK-NEXT:                                  (local.get $20)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (loop $while-in102
- ;; CHECK-NEXT:                               (local.set $7
+ ;; CHECK-NEXT:                               (local.set $6
  ;; CHECK-NEXT:                                (call $_fmt_u
  ;; CHECK-NEXT:                                 (i32.load
- ;; CHECK-NEXT:                                  (local.get $6)
+ ;; CHECK-NEXT:                                  (local.get $7)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (i32.const 0)
  ;; CHECK-NEXT:                                 (local.get $27)
@@ -7720,36 +7923,36 @@
  ;; CHECK-NEXT:                               (block $do-once103
  ;; CHECK-NEXT:                                (if
  ;; CHECK-NEXT:                                 (i32.eq
- ;; CHECK-NEXT:                                  (local.get $6)
+ ;; CHECK-NEXT:                                  (local.get $7)
  ;; CHECK-NEXT:                                  (local.get $12)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (block
  ;; CHECK-NEXT:                                  (br_if $do-once103
  ;; CHECK-NEXT:                                   (i32.ne
- ;; CHECK-NEXT:                                    (local.get $7)
+ ;; CHECK-NEXT:                                    (local.get $6)
  ;; CHECK-NEXT:                                    (local.get $27)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (i32.store8
- ;; CHECK-NEXT:                                   (local.get $32)
+ ;; CHECK-NEXT:                                   (local.get $33)
  ;; CHECK-NEXT:                                   (i32.const 48)
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.set $7
- ;; CHECK-NEXT:                                   (local.get $32)
+ ;; CHECK-NEXT:                                  (local.set $6
+ ;; CHECK-NEXT:                                   (local.get $33)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (block
  ;; CHECK-NEXT:                                  (br_if $do-once103
  ;; CHECK-NEXT:                                   (i32.le_u
- ;; CHECK-NEXT:                                    (local.get $7)
+ ;; CHECK-NEXT:                                    (local.get $6)
  ;; CHECK-NEXT:                                    (local.get $22)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (loop $while-in106
  ;; CHECK-NEXT:                                   (i32.store8
- ;; CHECK-NEXT:                                    (local.tee $7
+ ;; CHECK-NEXT:                                    (local.tee $6
  ;; CHECK-NEXT:                                     (i32.sub
- ;; CHECK-NEXT:                                      (local.get $7)
+ ;; CHECK-NEXT:                                      (local.get $6)
  ;; CHECK-NEXT:                                      (i32.const 1)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
@@ -7757,7 +7960,7 @@
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (br_if $while-in106
  ;; CHECK-NEXT:                                    (i32.gt_u
- ;; CHECK-NEXT:                                     (local.get $7)
+ ;; CHECK-NEXT:                                     (local.get $6)
  ;; CHECK-NEXT:                                     (local.get $22)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
@@ -7776,10 +7979,10 @@
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                                (drop
  ;; CHECK-NEXT:                                 (call $___fwritex
- ;; CHECK-NEXT:                                  (local.get $7)
+ ;; CHECK-NEXT:                                  (local.get $6)
  ;; CHECK-NEXT:                                  (i32.sub
  ;; CHECK-NEXT:                                   (local.get $27)
- ;; CHECK-NEXT:                                   (local.get $7)
+ ;; CHECK-NEXT:                                   (local.get $6)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (local.get $0)
  ;; CHECK-NEXT:                                 )
@@ -7787,24 +7990,24 @@
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (if
  ;; CHECK-NEXT:                                (i32.le_u
- ;; CHECK-NEXT:                                 (local.tee $7
+ ;; CHECK-NEXT:                                 (local.tee $6
  ;; CHECK-NEXT:                                  (i32.add
- ;; CHECK-NEXT:                                   (local.get $6)
+ ;; CHECK-NEXT:                                   (local.get $7)
  ;; CHECK-NEXT:                                   (i32.const 4)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
- ;; CHECK-NEXT:                                 (local.get $20)
+ ;; CHECK-NEXT:                                 (local.get $8)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                                (block
- ;; CHECK-NEXT:                                 (local.set $6
- ;; CHECK-NEXT:                                  (local.get $7)
+ ;; CHECK-NEXT:                                 (local.set $7
+ ;; CHECK-NEXT:                                  (local.get $6)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (br $while-in102)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (if
- ;; CHECK-NEXT:                               (local.get $19)
+ ;; CHECK-NEXT:                               (local.get $31)
  ;; CHECK-NEXT:                               (if
  ;; CHECK-NEXT:                                (i32.eqz
  ;; CHECK-NEXT:                                 (i32.and
@@ -7830,8 +8033,8 @@
  ;; CHECK-NEXT:                                (if (result i32)
  ;; CHECK-NEXT:                                 (i32.and
  ;; CHECK-NEXT:                                  (i32.lt_u
- ;; CHECK-NEXT:                                   (local.get $7)
- ;; CHECK-NEXT:                                   (local.get $11)
+ ;; CHECK-NEXT:                                   (local.get $6)
+ ;; CHECK-NEXT:                                   (local.get $10)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (i32.gt_s
  ;; CHECK-NEXT:                                   (local.get $5)
@@ -7841,10 +8044,10 @@
  ;; CHECK-NEXT:                                 (loop $while-in110 (result i32)
  ;; CHECK-NEXT:                                  (if
  ;; CHECK-NEXT:                                   (i32.gt_u
- ;; CHECK-NEXT:                                    (local.tee $6
+ ;; CHECK-NEXT:                                    (local.tee $7
  ;; CHECK-NEXT:                                     (call $_fmt_u
  ;; CHECK-NEXT:                                      (i32.load
- ;; CHECK-NEXT:                                       (local.get $7)
+ ;; CHECK-NEXT:                                       (local.get $6)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                      (i32.const 0)
  ;; CHECK-NEXT:                                      (local.get $27)
@@ -7854,9 +8057,9 @@
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (loop $while-in112
  ;; CHECK-NEXT:                                    (i32.store8
- ;; CHECK-NEXT:                                     (local.tee $6
+ ;; CHECK-NEXT:                                     (local.tee $7
  ;; CHECK-NEXT:                                      (i32.sub
- ;; CHECK-NEXT:                                       (local.get $6)
+ ;; CHECK-NEXT:                                       (local.get $7)
  ;; CHECK-NEXT:                                       (i32.const 1)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                     )
@@ -7864,7 +8067,7 @@
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (br_if $while-in112
  ;; CHECK-NEXT:                                     (i32.gt_u
- ;; CHECK-NEXT:                                      (local.get $6)
+ ;; CHECK-NEXT:                                      (local.get $7)
  ;; CHECK-NEXT:                                      (local.get $22)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
@@ -7881,7 +8084,7 @@
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (drop
  ;; CHECK-NEXT:                                    (call $___fwritex
- ;; CHECK-NEXT:                                     (local.get $6)
+ ;; CHECK-NEXT:                                     (local.get $7)
  ;; CHECK-NEXT:                                     (select
  ;; CHECK-NEXT:                                      (i32.const 9)
  ;; CHECK-NEXT:                                      (local.get $5)
@@ -7894,7 +8097,7 @@
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.set $6
+ ;; CHECK-NEXT:                                  (local.set $7
  ;; CHECK-NEXT:                                   (i32.sub
  ;; CHECK-NEXT:                                    (local.get $5)
  ;; CHECK-NEXT:                                    (i32.const 9)
@@ -7903,13 +8106,13 @@
  ;; CHECK-NEXT:                                  (if (result i32)
  ;; CHECK-NEXT:                                   (i32.and
  ;; CHECK-NEXT:                                    (i32.lt_u
- ;; CHECK-NEXT:                                     (local.tee $7
+ ;; CHECK-NEXT:                                     (local.tee $6
  ;; CHECK-NEXT:                                      (i32.add
- ;; CHECK-NEXT:                                       (local.get $7)
+ ;; CHECK-NEXT:                                       (local.get $6)
  ;; CHECK-NEXT:                                       (i32.const 4)
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                     )
- ;; CHECK-NEXT:                                     (local.get $11)
+ ;; CHECK-NEXT:                                     (local.get $10)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (i32.gt_s
  ;; CHECK-NEXT:                                     (local.get $5)
@@ -7918,11 +8121,11 @@
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (block
  ;; CHECK-NEXT:                                    (local.set $5
- ;; CHECK-NEXT:                                     (local.get $6)
+ ;; CHECK-NEXT:                                     (local.get $7)
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (br $while-in110)
  ;; CHECK-NEXT:                                   )
- ;; CHECK-NEXT:                                   (local.get $6)
+ ;; CHECK-NEXT:                                   (local.get $7)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (local.get $5)
@@ -7934,9 +8137,9 @@
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                             (block $do-once99
- ;; CHECK-NEXT:                              (local.set $20
+ ;; CHECK-NEXT:                              (local.set $10
  ;; CHECK-NEXT:                               (select
- ;; CHECK-NEXT:                                (local.get $11)
+ ;; CHECK-NEXT:                                (local.get $10)
  ;; CHECK-NEXT:                                (i32.add
  ;; CHECK-NEXT:                                 (local.get $12)
  ;; CHECK-NEXT:                                 (i32.const 4)
@@ -7954,15 +8157,15 @@
  ;; CHECK-NEXT:                                  (i32.const 0)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (block (result i32)
- ;; CHECK-NEXT:                                  (local.set $17
+ ;; CHECK-NEXT:                                  (local.set $18
  ;; CHECK-NEXT:                                   (i32.eqz
- ;; CHECK-NEXT:                                    (local.get $17)
+ ;; CHECK-NEXT:                                    (local.get $20)
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.set $6
+ ;; CHECK-NEXT:                                  (local.set $7
  ;; CHECK-NEXT:                                   (local.get $12)
  ;; CHECK-NEXT:                                  )
- ;; CHECK-NEXT:                                  (local.set $7
+ ;; CHECK-NEXT:                                  (local.set $6
  ;; CHECK-NEXT:                                   (local.get $5)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                  (loop $while-in114 (result i32)
@@ -7971,7 +8174,7 @@
  ;; CHECK-NEXT:                                     (local.tee $5
  ;; CHECK-NEXT:                                      (call $_fmt_u
  ;; CHECK-NEXT:                                       (i32.load
- ;; CHECK-NEXT:                                        (local.get $6)
+ ;; CHECK-NEXT:                                        (local.get $7)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                       (i32.const 0)
  ;; CHECK-NEXT:                                       (local.get $27)
@@ -7981,18 +8184,18 @@
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                    (block
  ;; CHECK-NEXT:                                     (i32.store8
- ;; CHECK-NEXT:                                      (local.get $32)
+ ;; CHECK-NEXT:                                      (local.get $33)
  ;; CHECK-NEXT:                                      (i32.const 48)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                     (local.set $5
- ;; CHECK-NEXT:                                      (local.get $32)
+ ;; CHECK-NEXT:                                      (local.get $33)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
  ;; CHECK-NEXT:                                   (block $do-once115
  ;; CHECK-NEXT:                                    (if
  ;; CHECK-NEXT:                                     (i32.eq
- ;; CHECK-NEXT:                                      (local.get $6)
+ ;; CHECK-NEXT:                                      (local.get $7)
  ;; CHECK-NEXT:                                      (local.get $12)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                     (block
@@ -8021,9 +8224,9 @@
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                      (br_if $do-once115
  ;; CHECK-NEXT:                                       (i32.and
- ;; CHECK-NEXT:                                        (local.get $17)
+ ;; CHECK-NEXT:                                        (local.get $18)
  ;; CHECK-NEXT:                                        (i32.le_s
- ;; CHECK-NEXT:                                         (local.get $7)
+ ;; CHECK-NEXT:                                         (local.get $6)
  ;; CHECK-NEXT:                                         (i32.const 0)
  ;; CHECK-NEXT:                                        )
  ;; CHECK-NEXT:                                       )
@@ -8071,7 +8274,7 @@
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
- ;; CHECK-NEXT:                                   (local.set $11
+ ;; CHECK-NEXT:                                   (local.set $8
  ;; CHECK-NEXT:                                    (i32.sub
  ;; CHECK-NEXT:                                     (local.get $27)
  ;; CHECK-NEXT:                                     (local.get $5)
@@ -8090,11 +8293,11 @@
  ;; CHECK-NEXT:                                     (call $___fwritex
  ;; CHECK-NEXT:                                      (local.get $5)
  ;; CHECK-NEXT:                                      (select
- ;; CHECK-NEXT:                                       (local.get $11)
- ;; CHECK-NEXT:                                       (local.get $7)
+ ;; CHECK-NEXT:                                       (local.get $8)
+ ;; CHECK-NEXT:                                       (local.get $6)
  ;; CHECK-NEXT:                                       (i32.gt_s
- ;; CHECK-NEXT:                                        (local.get $7)
- ;; CHECK-NEXT:                                        (local.get $11)
+ ;; CHECK-NEXT:                                        (local.get $6)
+ ;; CHECK-NEXT:                                        (local.get $8)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                      (local.get $0)
@@ -8104,26 +8307,26 @@
  ;; CHECK-NEXT:                                   (br_if $while-in114
  ;; CHECK-NEXT:                                    (i32.and
  ;; CHECK-NEXT:                                     (i32.lt_u
- ;; CHECK-NEXT:                                      (local.tee $6
+ ;; CHECK-NEXT:                                      (local.tee $7
  ;; CHECK-NEXT:                                       (i32.add
- ;; CHECK-NEXT:                                        (local.get $6)
+ ;; CHECK-NEXT:                                        (local.get $7)
  ;; CHECK-NEXT:                                        (i32.const 4)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                      )
- ;; CHECK-NEXT:                                      (local.get $20)
+ ;; CHECK-NEXT:                                      (local.get $10)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                     (i32.ge_s
- ;; CHECK-NEXT:                                      (local.tee $7
+ ;; CHECK-NEXT:                                      (local.tee $6
  ;; CHECK-NEXT:                                       (i32.sub
- ;; CHECK-NEXT:                                        (local.get $7)
- ;; CHECK-NEXT:                                        (local.get $11)
+ ;; CHECK-NEXT:                                        (local.get $6)
+ ;; CHECK-NEXT:                                        (local.get $8)
  ;; CHECK-NEXT:                                       )
  ;; CHECK-NEXT:                                      )
  ;; CHECK-NEXT:                                      (i32.const 0)
  ;; CHECK-NEXT:                                     )
  ;; CHECK-NEXT:                                    )
  ;; CHECK-NEXT:                                   )
- ;; CHECK-NEXT:                                   (local.get $7)
+ ;; CHECK-NEXT:                                   (local.get $6)
  ;; CHECK-NEXT:                                  )
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (local.get $5)
@@ -8143,10 +8346,10 @@
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (drop
  ;; CHECK-NEXT:                               (call $___fwritex
- ;; CHECK-NEXT:                                (local.get $15)
+ ;; CHECK-NEXT:                                (local.get $19)
  ;; CHECK-NEXT:                                (i32.sub
  ;; CHECK-NEXT:                                 (local.get $24)
- ;; CHECK-NEXT:                                 (local.get $15)
+ ;; CHECK-NEXT:                                 (local.get $19)
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                                (local.get $0)
  ;; CHECK-NEXT:                               )
@@ -8157,7 +8360,7 @@
  ;; CHECK-NEXT:                             (local.get $0)
  ;; CHECK-NEXT:                             (i32.const 32)
  ;; CHECK-NEXT:                             (local.get $16)
- ;; CHECK-NEXT:                             (local.get $8)
+ ;; CHECK-NEXT:                             (local.get $13)
  ;; CHECK-NEXT:                             (i32.xor
  ;; CHECK-NEXT:                              (local.get $9)
  ;; CHECK-NEXT:                              (i32.const 8192)
@@ -8165,9 +8368,9 @@
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (select
  ;; CHECK-NEXT:                             (local.get $16)
- ;; CHECK-NEXT:                             (local.get $8)
+ ;; CHECK-NEXT:                             (local.get $13)
  ;; CHECK-NEXT:                             (i32.lt_s
- ;; CHECK-NEXT:                              (local.get $8)
+ ;; CHECK-NEXT:                              (local.get $13)
  ;; CHECK-NEXT:                              (local.get $16)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
@@ -8177,13 +8380,13 @@
  ;; CHECK-NEXT:                             (local.get $0)
  ;; CHECK-NEXT:                             (i32.const 32)
  ;; CHECK-NEXT:                             (local.get $16)
- ;; CHECK-NEXT:                             (local.tee $7
+ ;; CHECK-NEXT:                             (local.tee $6
  ;; CHECK-NEXT:                              (i32.add
- ;; CHECK-NEXT:                               (local.tee $8
+ ;; CHECK-NEXT:                               (local.tee $10
  ;; CHECK-NEXT:                                (select
  ;; CHECK-NEXT:                                 (i32.const 0)
  ;; CHECK-NEXT:                                 (local.get $28)
- ;; CHECK-NEXT:                                 (local.tee $6
+ ;; CHECK-NEXT:                                 (local.tee $7
  ;; CHECK-NEXT:                                  (f64.ne
  ;; CHECK-NEXT:                                   (local.get $14)
  ;; CHECK-NEXT:                                   (local.get $14)
@@ -8194,35 +8397,9 @@
  ;; CHECK-NEXT:                               (i32.const 3)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
- ;; CHECK-NEXT:                             (local.get $12)
- ;; CHECK-NEXT:                            )
- ;; CHECK-NEXT:                            (if
- ;; CHECK-NEXT:                             (i32.eqz
- ;; CHECK-NEXT:                              (i32.and
- ;; CHECK-NEXT:                               (local.tee $5
- ;; CHECK-NEXT:                                (i32.load
- ;; CHECK-NEXT:                                 (local.get $0)
- ;; CHECK-NEXT:                                )
- ;; CHECK-NEXT:                               )
- ;; CHECK-NEXT:                               (i32.const 32)
- ;; CHECK-NEXT:                              )
- ;; CHECK-NEXT:                             )
- ;; CHECK-NEXT:                             (block
- ;; CHECK-NEXT:                              (drop
- ;; CHECK-NEXT:                               (call $___fwritex
- ;; CHECK-NEXT:                                (local.get $30)
- ;; CHECK-NEXT:                                (local.get $8)
- ;; CHECK-NEXT:                                (local.get $0)
- ;; CHECK-NEXT:                               )
- ;; CHECK-NEXT:                              )
- ;; CHECK-NEXT:                              (local.set $5
- ;; CHECK-NEXT:                               (i32.load
- ;; CHECK-NEXT:                                (local.get $0)
- ;; CHECK-NEXT:                               )
- ;; CHECK-NEXT:                              )
- ;; CHECK-NEXT:                             )
+ ;; CHECK-NEXT:                             (local.get $8)
  ;; CHECK-NEXT:                            )
- ;; CHECK-NEXT:                            (local.set $6
+ ;; CHECK-NEXT:                            (local.set $7
  ;; CHECK-NEXT:                             (select
  ;; CHECK-NEXT:                              (select
  ;; CHECK-NEXT:                               (i32.const 4135)
@@ -8230,7 +8407,7 @@
  ;; CHECK-NEXT:                               (local.tee $8
  ;; CHECK-NEXT:                                (i32.ne
  ;; CHECK-NEXT:                                 (i32.and
- ;; CHECK-NEXT:                                  (local.get $15)
+ ;; CHECK-NEXT:                                  (local.get $19)
  ;; CHECK-NEXT:                                  (i32.const 32)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                 (i32.const 0)
@@ -8242,19 +8419,41 @@
  ;; CHECK-NEXT:                               (i32.const 4131)
  ;; CHECK-NEXT:                               (local.get $8)
  ;; CHECK-NEXT:                              )
- ;; CHECK-NEXT:                              (local.get $6)
+ ;; CHECK-NEXT:                              (local.get $7)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (if
  ;; CHECK-NEXT:                             (i32.eqz
  ;; CHECK-NEXT:                              (i32.and
- ;; CHECK-NEXT:                               (local.get $5)
+ ;; CHECK-NEXT:                               (if (result i32)
+ ;; CHECK-NEXT:                                (i32.and
+ ;; CHECK-NEXT:                                 (local.tee $5
+ ;; CHECK-NEXT:                                  (i32.load
+ ;; CHECK-NEXT:                                   (local.get $0)
+ ;; CHECK-NEXT:                                  )
+ ;; CHECK-NEXT:                                 )
+ ;; CHECK-NEXT:                                 (i32.const 32)
+ ;; CHECK-NEXT:                                )
+ ;; CHECK-NEXT:                                (local.get $5)
+ ;; CHECK-NEXT:                                (block (result i32)
+ ;; CHECK-NEXT:                                 (drop
+ ;; CHECK-NEXT:                                  (call $___fwritex
+ ;; CHECK-NEXT:                                   (local.get $30)
+ ;; CHECK-NEXT:                                   (local.get $10)
+ ;; CHECK-NEXT:                                   (local.get $0)
+ ;; CHECK-NEXT:                                  )
+ ;; CHECK-NEXT:                                 )
+ ;; CHECK-NEXT:                                 (i32.load
+ ;; CHECK-NEXT:                                  (local.get $0)
+ ;; CHECK-NEXT:                                 )
+ ;; CHECK-NEXT:                                )
+ ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                               (i32.const 32)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                             (drop
  ;; CHECK-NEXT:                              (call $___fwritex
- ;; CHECK-NEXT:                               (local.get $6)
+ ;; CHECK-NEXT:                               (local.get $7)
  ;; CHECK-NEXT:                               (i32.const 3)
  ;; CHECK-NEXT:                               (local.get $0)
  ;; CHECK-NEXT:                              )
@@ -8264,7 +8463,7 @@
  ;; CHECK-NEXT:                             (local.get $0)
  ;; CHECK-NEXT:                             (i32.const 32)
  ;; CHECK-NEXT:                             (local.get $16)
- ;; CHECK-NEXT:                             (local.get $7)
+ ;; CHECK-NEXT:                             (local.get $6)
  ;; CHECK-NEXT:                             (i32.xor
  ;; CHECK-NEXT:                              (local.get $9)
  ;; CHECK-NEXT:                              (i32.const 8192)
@@ -8272,9 +8471,9 @@
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (select
  ;; CHECK-NEXT:                             (local.get $16)
- ;; CHECK-NEXT:                             (local.get $7)
+ ;; CHECK-NEXT:                             (local.get $6)
  ;; CHECK-NEXT:                             (i32.lt_s
- ;; CHECK-NEXT:                              (local.get $7)
+ ;; CHECK-NEXT:                              (local.get $6)
  ;; CHECK-NEXT:                              (local.get $16)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
@@ -8282,49 +8481,54 @@
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (local.set $5
- ;; CHECK-NEXT:                          (local.get $10)
+ ;; CHECK-NEXT:                          (local.get $11)
  ;; CHECK-NEXT:                         )
- ;; CHECK-NEXT:                         (local.set $10
- ;; CHECK-NEXT:                          (local.get $7)
+ ;; CHECK-NEXT:                         (local.set $11
+ ;; CHECK-NEXT:                          (local.get $6)
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (br $label$continue$L1)
  ;; CHECK-NEXT:                        )
- ;; CHECK-NEXT:                        (local.set $7
+ ;; CHECK-NEXT:                        (local.set $6
  ;; CHECK-NEXT:                         (local.get $5)
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                        (local.set $12
- ;; CHECK-NEXT:                         (local.get $6)
+ ;; CHECK-NEXT:                         (local.get $7)
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                        (local.set $8
  ;; CHECK-NEXT:                         (i32.const 0)
  ;; CHECK-NEXT:                        )
- ;; CHECK-NEXT:                        (local.set $11
+ ;; CHECK-NEXT:                        (local.set $10
  ;; CHECK-NEXT:                         (i32.const 4091)
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                        (br $__rjto$8
  ;; CHECK-NEXT:                         (local.get $23)
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                       )
- ;; CHECK-NEXT:                       (local.set $11
+ ;; CHECK-NEXT:                       (local.set $10
  ;; CHECK-NEXT:                        (i32.and
- ;; CHECK-NEXT:                         (local.get $15)
+ ;; CHECK-NEXT:                         (local.get $19)
  ;; CHECK-NEXT:                         (i32.const 32)
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                       )
  ;; CHECK-NEXT:                       (if
  ;; CHECK-NEXT:                        (i32.or
- ;; CHECK-NEXT:                         (local.tee $5
+ ;; CHECK-NEXT:                         (local.tee $8
  ;; CHECK-NEXT:                          (i32.load
- ;; CHECK-NEXT:                           (local.get $13)
+ ;; CHECK-NEXT:                           (local.tee $5
+ ;; CHECK-NEXT:                            (local.get $15)
+ ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (local.tee $9
  ;; CHECK-NEXT:                          (i32.load offset=4
- ;; CHECK-NEXT:                           (local.get $13)
+ ;; CHECK-NEXT:                           (local.get $5)
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                        (block
+ ;; CHECK-NEXT:                         (local.set $5
+ ;; CHECK-NEXT:                          (local.get $8)
+ ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (local.set $8
  ;; CHECK-NEXT:                          (local.get $23)
  ;; CHECK-NEXT:                         )
@@ -8347,7 +8551,7 @@
  ;; CHECK-NEXT:                               (i32.const 4075)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
- ;; CHECK-NEXT:                             (local.get $11)
+ ;; CHECK-NEXT:                             (local.get $10)
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                           (br_if $while-in123
@@ -8372,32 +8576,34 @@
  ;; CHECK-NEXT:                           (i32.or
  ;; CHECK-NEXT:                            (i32.eqz
  ;; CHECK-NEXT:                             (i32.and
- ;; CHECK-NEXT:                              (local.get $7)
+ ;; CHECK-NEXT:                              (local.get $6)
  ;; CHECK-NEXT:                              (i32.const 8)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (i32.eqz
  ;; CHECK-NEXT:                             (i32.or
  ;; CHECK-NEXT:                              (i32.load
- ;; CHECK-NEXT:                               (local.get $13)
+ ;; CHECK-NEXT:                               (local.tee $9
+ ;; CHECK-NEXT:                                (local.get $15)
+ ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (i32.load offset=4
- ;; CHECK-NEXT:                               (local.get $13)
+ ;; CHECK-NEXT:                               (local.get $9)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                           (block (result i32)
- ;; CHECK-NEXT:                            (local.set $11
+ ;; CHECK-NEXT:                            (local.set $10
  ;; CHECK-NEXT:                             (i32.const 4091)
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (i32.const 0)
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                           (block (result i32)
- ;; CHECK-NEXT:                            (local.set $11
+ ;; CHECK-NEXT:                            (local.set $10
  ;; CHECK-NEXT:                             (i32.add
  ;; CHECK-NEXT:                              (i32.shr_s
- ;; CHECK-NEXT:                               (local.get $15)
+ ;; CHECK-NEXT:                               (local.get $19)
  ;; CHECK-NEXT:                               (i32.const 4)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (i32.const 4091)
@@ -8407,6 +8613,7 @@
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                         )
+ ;; CHECK-NEXT:                         (br $__rjti$8)
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                        (block
  ;; CHECK-NEXT:                         (local.set $5
@@ -8415,21 +8622,21 @@
  ;; CHECK-NEXT:                         (local.set $8
  ;; CHECK-NEXT:                          (i32.const 0)
  ;; CHECK-NEXT:                         )
- ;; CHECK-NEXT:                         (local.set $11
+ ;; CHECK-NEXT:                         (local.set $10
  ;; CHECK-NEXT:                          (i32.const 4091)
  ;; CHECK-NEXT:                         )
+ ;; CHECK-NEXT:                         (br $__rjti$8)
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                       )
- ;; CHECK-NEXT:                       (br $__rjti$8)
  ;; CHECK-NEXT:                      )
  ;; CHECK-NEXT:                      (local.set $5
  ;; CHECK-NEXT:                       (call $_fmt_u
  ;; CHECK-NEXT:                        (local.get $5)
- ;; CHECK-NEXT:                        (local.get $7)
+ ;; CHECK-NEXT:                        (local.get $6)
  ;; CHECK-NEXT:                        (local.get $23)
  ;; CHECK-NEXT:                       )
  ;; CHECK-NEXT:                      )
- ;; CHECK-NEXT:                      (local.set $7
+ ;; CHECK-NEXT:                      (local.set $6
  ;; CHECK-NEXT:                       (local.get $9)
  ;; CHECK-NEXT:                      )
  ;; CHECK-NEXT:                      (br $__rjti$8)
@@ -8438,31 +8645,36 @@
  ;; CHECK-NEXT:                      (block $__rjti$29
  ;; CHECK-NEXT:                       (if
  ;; CHECK-NEXT:                        (i32.and
- ;; CHECK-NEXT:                         (local.tee $9
+ ;; CHECK-NEXT:                         (local.tee $10
  ;; CHECK-NEXT:                          (i32.ne
- ;; CHECK-NEXT:                           (local.tee $7
- ;; CHECK-NEXT:                            (local.get $6)
+ ;; CHECK-NEXT:                           (local.tee $6
+ ;; CHECK-NEXT:                            (local.get $7)
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                           (i32.const 0)
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (i32.ne
  ;; CHECK-NEXT:                          (i32.and
- ;; CHECK-NEXT:                           (local.get $5)
+ ;; CHECK-NEXT:                           (local.tee $9
+ ;; CHECK-NEXT:                            (local.get $5)
+ ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                           (i32.const 3)
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                          (i32.const 0)
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                        (block
- ;; CHECK-NEXT:                         (local.set $8
- ;; CHECK-NEXT:                          (local.get $5)
+ ;; CHECK-NEXT:                         (local.set $12
+ ;; CHECK-NEXT:                          (local.get $6)
+ ;; CHECK-NEXT:                         )
+ ;; CHECK-NEXT:                         (local.set $6
+ ;; CHECK-NEXT:                          (local.get $9)
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (loop $while-in12
  ;; CHECK-NEXT:                          (br_if $__rjti$29
  ;; CHECK-NEXT:                           (i32.eqz
  ;; CHECK-NEXT:                            (i32.load8_u
- ;; CHECK-NEXT:                             (local.get $8)
+ ;; CHECK-NEXT:                             (local.get $6)
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                          )
@@ -8470,9 +8682,9 @@
  ;; CHECK-NEXT:                           (i32.and
  ;; CHECK-NEXT:                            (local.tee $9
  ;; CHECK-NEXT:                             (i32.ne
- ;; CHECK-NEXT:                              (local.tee $7
+ ;; CHECK-NEXT:                              (local.tee $12
  ;; CHECK-NEXT:                               (i32.sub
- ;; CHECK-NEXT:                                (local.get $7)
+ ;; CHECK-NEXT:                                (local.get $12)
  ;; CHECK-NEXT:                                (i32.const 1)
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
@@ -8481,9 +8693,9 @@
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (i32.ne
  ;; CHECK-NEXT:                             (i32.and
- ;; CHECK-NEXT:                              (local.tee $8
+ ;; CHECK-NEXT:                              (local.tee $6
  ;; CHECK-NEXT:                               (i32.add
- ;; CHECK-NEXT:                                (local.get $8)
+ ;; CHECK-NEXT:                                (local.get $6)
  ;; CHECK-NEXT:                                (i32.const 1)
  ;; CHECK-NEXT:                               )
  ;; CHECK-NEXT:                              )
@@ -8495,8 +8707,16 @@
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                        )
- ;; CHECK-NEXT:                        (local.set $8
- ;; CHECK-NEXT:                         (local.get $5)
+ ;; CHECK-NEXT:                        (block
+ ;; CHECK-NEXT:                         (local.set $12
+ ;; CHECK-NEXT:                          (local.get $6)
+ ;; CHECK-NEXT:                         )
+ ;; CHECK-NEXT:                         (local.set $6
+ ;; CHECK-NEXT:                          (local.get $9)
+ ;; CHECK-NEXT:                         )
+ ;; CHECK-NEXT:                         (local.set $9
+ ;; CHECK-NEXT:                          (local.get $10)
+ ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                       )
  ;; CHECK-NEXT:                       (br_if $__rjti$29
@@ -8508,11 +8728,11 @@
  ;; CHECK-NEXT:                       (br $label$break$L8)
  ;; CHECK-NEXT:                      )
  ;; CHECK-NEXT:                      (local.set $9
- ;; CHECK-NEXT:                       (local.get $7)
+ ;; CHECK-NEXT:                       (local.get $12)
  ;; CHECK-NEXT:                      )
  ;; CHECK-NEXT:                      (if
  ;; CHECK-NEXT:                       (i32.load8_u
- ;; CHECK-NEXT:                        (local.get $8)
+ ;; CHECK-NEXT:                        (local.get $6)
  ;; CHECK-NEXT:                       )
  ;; CHECK-NEXT:                       (block
  ;; CHECK-NEXT:                        (block $__rjto$013
@@ -8529,9 +8749,9 @@
  ;; CHECK-NEXT:                             (i32.and
  ;; CHECK-NEXT:                              (i32.xor
  ;; CHECK-NEXT:                               (i32.and
- ;; CHECK-NEXT:                                (local.tee $7
+ ;; CHECK-NEXT:                                (local.tee $10
  ;; CHECK-NEXT:                                 (i32.load
- ;; CHECK-NEXT:                                  (local.get $8)
+ ;; CHECK-NEXT:                                  (local.get $6)
  ;; CHECK-NEXT:                                 )
  ;; CHECK-NEXT:                                )
  ;; CHECK-NEXT:                                (i32.const -2139062144)
@@ -8539,15 +8759,15 @@
  ;; CHECK-NEXT:                               (i32.const -2139062144)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                              (i32.sub
- ;; CHECK-NEXT:                               (local.get $7)
+ ;; CHECK-NEXT:                               (local.get $10)
  ;; CHECK-NEXT:                               (i32.const 16843009)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                            (block
- ;; CHECK-NEXT:                             (local.set $8
+ ;; CHECK-NEXT:                             (local.set $6
  ;; CHECK-NEXT:                              (i32.add
- ;; CHECK-NEXT:                               (local.get $8)
+ ;; CHECK-NEXT:                               (local.get $6)
  ;; CHECK-NEXT:                               (i32.const 4)
  ;; CHECK-NEXT:                              )
  ;; CHECK-NEXT:                             )
@@ -8585,13 +8805,13 @@
  ;; CHECK-NEXT:                          (br_if $label$break$L8
  ;; CHECK-NEXT:                           (i32.eqz
  ;; CHECK-NEXT:                            (i32.load8_u
- ;; CHECK-NEXT:                             (local.get $8)
+ ;; CHECK-NEXT:                             (local.get $6)
  ;; CHECK-NEXT:                            )
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                          )
- ;; CHECK-NEXT:                          (local.set $8
+ ;; CHECK-NEXT:                          (local.set $6
  ;; CHECK-NEXT:                           (i32.add
- ;; CHECK-NEXT:                            (local.get $8)
+ ;; CHECK-NEXT:                            (local.get $6)
  ;; CHECK-NEXT:                            (i32.const 1)
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                          )
@@ -8609,67 +8829,68 @@
  ;; CHECK-NEXT:                       )
  ;; CHECK-NEXT:                      )
  ;; CHECK-NEXT:                     )
- ;; CHECK-NEXT:                     (local.set $17
+ ;; CHECK-NEXT:                     (local.set $19
  ;; CHECK-NEXT:                      (i32.eqz
- ;; CHECK-NEXT:                       (local.tee $15
+ ;; CHECK-NEXT:                       (local.tee $13
  ;; CHECK-NEXT:                        (select
- ;; CHECK-NEXT:                         (local.get $8)
+ ;; CHECK-NEXT:                         (local.get $6)
  ;; CHECK-NEXT:                         (i32.const 0)
  ;; CHECK-NEXT:                         (local.get $9)
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                       )
  ;; CHECK-NEXT:                      )
  ;; CHECK-NEXT:                     )
+ ;; CHECK-NEXT:                     (local.set $6
+ ;; CHECK-NEXT:                      (local.get $5)
+ ;; CHECK-NEXT:                     )
  ;; CHECK-NEXT:                     (local.set $9
- ;; CHECK-NEXT:                      (local.get $12)
+ ;; CHECK-NEXT:                      (local.get $8)
  ;; CHECK-NEXT:                     )
  ;; CHECK-NEXT:                     (local.set $12
  ;; CHECK-NEXT:                      (select
- ;; CHECK-NEXT:                       (local.get $6)
+ ;; CHECK-NEXT:                       (local.get $7)
  ;; CHECK-NEXT:                       (i32.sub
- ;; CHECK-NEXT:                        (local.get $15)
- ;; CHECK-NEXT:                        (local.tee $7
- ;; CHECK-NEXT:                         (local.get $5)
- ;; CHECK-NEXT:                        )
+ ;; CHECK-NEXT:                        (local.get $13)
+ ;; CHECK-NEXT:                        (local.get $5)
  ;; CHECK-NEXT:                       )
- ;; CHECK-NEXT:                       (local.get $17)
+ ;; CHECK-NEXT:                       (local.get $19)
  ;; CHECK-NEXT:                      )
  ;; CHECK-NEXT:                     )
  ;; CHECK-NEXT:                     (local.set $8
  ;; CHECK-NEXT:                      (i32.const 0)
  ;; CHECK-NEXT:                     )
- ;; CHECK-NEXT:                     (local.set $11
+ ;; CHECK-NEXT:                     (local.set $10
  ;; CHECK-NEXT:                      (i32.const 4091)
  ;; CHECK-NEXT:                     )
  ;; CHECK-NEXT:                     (br $__rjto$8
  ;; CHECK-NEXT:                      (select
  ;; CHECK-NEXT:                       (i32.add
  ;; CHECK-NEXT:                        (local.get $5)
- ;; CHECK-NEXT:                        (local.get $6)
+ ;; CHECK-NEXT:                        (local.get $7)
  ;; CHECK-NEXT:                       )
- ;; CHECK-NEXT:                       (local.get $15)
- ;; CHECK-NEXT:                       (local.get $17)
+ ;; CHECK-NEXT:                       (local.get $13)
+ ;; CHECK-NEXT:                       (local.get $19)
  ;; CHECK-NEXT:                      )
  ;; CHECK-NEXT:                     )
  ;; CHECK-NEXT:                    )
  ;; CHECK-NEXT:                    (local.set $5
  ;; CHECK-NEXT:                     (i32.const 0)
  ;; CHECK-NEXT:                    )
- ;; CHECK-NEXT:                    (local.set $7
+ ;; CHECK-NEXT:                    (local.set $6
  ;; CHECK-NEXT:                     (i32.const 0)
  ;; CHECK-NEXT:                    )
- ;; CHECK-NEXT:                    (local.set $6
+ ;; CHECK-NEXT:                    (local.set $7
  ;; CHECK-NEXT:                     (i32.load
- ;; CHECK-NEXT:                      (local.get $13)
+ ;; CHECK-NEXT:                      (local.get $15)
  ;; CHECK-NEXT:                     )
  ;; CHECK-NEXT:                    )
  ;; CHECK-NEXT:                    (loop $while-in125
  ;; CHECK-NEXT:                     (block $while-out124
  ;; CHECK-NEXT:                      (br_if $while-out124
  ;; CHECK-NEXT:                       (i32.eqz
- ;; CHECK-NEXT:                        (local.tee $11
+ ;; CHECK-NEXT:                        (local.tee $10
  ;; CHECK-NEXT:                         (i32.load
- ;; CHECK-NEXT:                          (local.get $6)
+ ;; CHECK-NEXT:                          (local.get $7)
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                       )
@@ -8677,16 +8898,16 @@
  ;; CHECK-NEXT:                      (br_if $while-out124
  ;; CHECK-NEXT:                       (i32.or
  ;; CHECK-NEXT:                        (i32.lt_s
- ;; CHECK-NEXT:                         (local.tee $7
+ ;; CHECK-NEXT:                         (local.tee $6
  ;; CHECK-NEXT:                          (call $_wctomb
- ;; CHECK-NEXT:                           (local.get $33)
- ;; CHECK-NEXT:                           (local.get $11)
+ ;; CHECK-NEXT:                           (local.get $34)
+ ;; CHECK-NEXT:                           (local.get $10)
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                         (i32.const 0)
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                        (i32.gt_u
- ;; CHECK-NEXT:                         (local.get $7)
+ ;; CHECK-NEXT:                         (local.get $6)
  ;; CHECK-NEXT:                         (i32.sub
  ;; CHECK-NEXT:                          (local.get $8)
  ;; CHECK-NEXT:                          (local.get $5)
@@ -8694,9 +8915,9 @@
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                       )
  ;; CHECK-NEXT:                      )
- ;; CHECK-NEXT:                      (local.set $6
+ ;; CHECK-NEXT:                      (local.set $7
  ;; CHECK-NEXT:                       (i32.add
- ;; CHECK-NEXT:                        (local.get $6)
+ ;; CHECK-NEXT:                        (local.get $7)
  ;; CHECK-NEXT:                        (i32.const 4)
  ;; CHECK-NEXT:                       )
  ;; CHECK-NEXT:                      )
@@ -8706,7 +8927,7 @@
  ;; CHECK-NEXT:                        (local.tee $5
  ;; CHECK-NEXT:                         (i32.add
  ;; CHECK-NEXT:                          (local.get $5)
- ;; CHECK-NEXT:                          (local.get $7)
+ ;; CHECK-NEXT:                          (local.get $6)
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                       )
@@ -8715,11 +8936,11 @@
  ;; CHECK-NEXT:                    )
  ;; CHECK-NEXT:                    (if
  ;; CHECK-NEXT:                     (i32.lt_s
- ;; CHECK-NEXT:                      (local.get $7)
+ ;; CHECK-NEXT:                      (local.get $6)
  ;; CHECK-NEXT:                      (i32.const 0)
  ;; CHECK-NEXT:                     )
  ;; CHECK-NEXT:                     (block
- ;; CHECK-NEXT:                      (local.set $18
+ ;; CHECK-NEXT:                      (local.set $17
  ;; CHECK-NEXT:                       (i32.const -1)
  ;; CHECK-NEXT:                      )
  ;; CHECK-NEXT:                      (br $label$break$L1)
@@ -8735,12 +8956,12 @@
  ;; CHECK-NEXT:                    (if (result i32)
  ;; CHECK-NEXT:                     (local.get $5)
  ;; CHECK-NEXT:                     (block (result i32)
- ;; CHECK-NEXT:                      (local.set $6
+ ;; CHECK-NEXT:                      (local.set $7
  ;; CHECK-NEXT:                       (i32.const 0)
  ;; CHECK-NEXT:                      )
- ;; CHECK-NEXT:                      (local.set $7
+ ;; CHECK-NEXT:                      (local.set $6
  ;; CHECK-NEXT:                       (i32.load
- ;; CHECK-NEXT:                        (local.get $13)
+ ;; CHECK-NEXT:                        (local.get $15)
  ;; CHECK-NEXT:                       )
  ;; CHECK-NEXT:                      )
  ;; CHECK-NEXT:                      (loop $while-in127 (result i32)
@@ -8750,7 +8971,7 @@
  ;; CHECK-NEXT:                         (i32.eqz
  ;; CHECK-NEXT:                          (local.tee $8
  ;; CHECK-NEXT:                           (i32.load
- ;; CHECK-NEXT:                            (local.get $7)
+ ;; CHECK-NEXT:                            (local.get $6)
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                         )
@@ -8760,15 +8981,15 @@
  ;; CHECK-NEXT:                        (br_if $__rjti$7
  ;; CHECK-NEXT:                         (local.get $5)
  ;; CHECK-NEXT:                         (i32.gt_s
- ;; CHECK-NEXT:                          (local.tee $6
+ ;; CHECK-NEXT:                          (local.tee $7
  ;; CHECK-NEXT:                           (i32.add
  ;; CHECK-NEXT:                            (local.tee $8
  ;; CHECK-NEXT:                             (call $_wctomb
- ;; CHECK-NEXT:                              (local.get $33)
+ ;; CHECK-NEXT:                              (local.get $34)
  ;; CHECK-NEXT:                              (local.get $8)
  ;; CHECK-NEXT:                             )
  ;; CHECK-NEXT:                            )
- ;; CHECK-NEXT:                            (local.get $6)
+ ;; CHECK-NEXT:                            (local.get $7)
  ;; CHECK-NEXT:                           )
  ;; CHECK-NEXT:                          )
  ;; CHECK-NEXT:                          (local.get $5)
@@ -8786,22 +9007,22 @@
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                        (drop
  ;; CHECK-NEXT:                         (call $___fwritex
- ;; CHECK-NEXT:                          (local.get $33)
+ ;; CHECK-NEXT:                          (local.get $34)
  ;; CHECK-NEXT:                          (local.get $8)
  ;; CHECK-NEXT:                          (local.get $0)
  ;; CHECK-NEXT:                         )
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                       )
- ;; CHECK-NEXT:                       (local.set $7
+ ;; CHECK-NEXT:                       (local.set $6
  ;; CHECK-NEXT:                        (i32.add
- ;; CHECK-NEXT:                         (local.get $7)
+ ;; CHECK-NEXT:                         (local.get $6)
  ;; CHECK-NEXT:                         (i32.const 4)
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                       )
  ;; CHECK-NEXT:                       (br_if $while-in127
  ;; CHECK-NEXT:                        (i32.gt_u
  ;; CHECK-NEXT:                         (local.get $5)
- ;; CHECK-NEXT:                         (local.get $6)
+ ;; CHECK-NEXT:                         (local.get $7)
  ;; CHECK-NEXT:                        )
  ;; CHECK-NEXT:                       )
  ;; CHECK-NEXT:                       (local.get $5)
@@ -8817,14 +9038,14 @@
  ;; CHECK-NEXT:                  )
  ;; CHECK-NEXT:                 )
  ;; CHECK-NEXT:                 (local.set $5
- ;; CHECK-NEXT:                  (local.get $10)
+ ;; CHECK-NEXT:                  (local.get $11)
  ;; CHECK-NEXT:                 )
- ;; CHECK-NEXT:                 (local.set $10
+ ;; CHECK-NEXT:                 (local.set $11
  ;; CHECK-NEXT:                  (select
  ;; CHECK-NEXT:                   (local.get $16)
- ;; CHECK-NEXT:                   (local.get $7)
+ ;; CHECK-NEXT:                   (local.get $6)
  ;; CHECK-NEXT:                   (i32.lt_s
- ;; CHECK-NEXT:                    (local.get $7)
+ ;; CHECK-NEXT:                    (local.get $6)
  ;; CHECK-NEXT:                    (local.get $16)
  ;; CHECK-NEXT:                   )
  ;; CHECK-NEXT:                  )
@@ -8834,12 +9055,12 @@
  ;; CHECK-NEXT:                (local.set $9
  ;; CHECK-NEXT:                 (select
  ;; CHECK-NEXT:                  (i32.and
- ;; CHECK-NEXT:                   (local.get $7)
+ ;; CHECK-NEXT:                   (local.get $6)
  ;; CHECK-NEXT:                   (i32.const -65537)
  ;; CHECK-NEXT:                  )
- ;; CHECK-NEXT:                  (local.get $7)
+ ;; CHECK-NEXT:                  (local.get $6)
  ;; CHECK-NEXT:                  (i32.ge_s
- ;; CHECK-NEXT:                   (local.get $6)
+ ;; CHECK-NEXT:                   (local.get $7)
  ;; CHECK-NEXT:                   (i32.const 0)
  ;; CHECK-NEXT:                  )
  ;; CHECK-NEXT:                 )
@@ -8847,43 +9068,51 @@
  ;; CHECK-NEXT:                (local.set $12
  ;; CHECK-NEXT:                 (if (result i32)
  ;; CHECK-NEXT:                  (i32.or
- ;; CHECK-NEXT:                   (local.get $6)
+ ;; CHECK-NEXT:                   (local.get $7)
  ;; CHECK-NEXT:                   (local.tee $12
  ;; CHECK-NEXT:                    (i32.ne
  ;; CHECK-NEXT:                     (i32.or
  ;; CHECK-NEXT:                      (i32.load
- ;; CHECK-NEXT:                       (local.get $13)
+ ;; CHECK-NEXT:                       (local.tee $6
+ ;; CHECK-NEXT:                        (local.get $15)
+ ;; CHECK-NEXT:                       )
  ;; CHECK-NEXT:                      )
  ;; CHECK-NEXT:                      (i32.load offset=4
- ;; CHECK-NEXT:                       (local.get $13)
+ ;; CHECK-NEXT:                       (local.get $6)
  ;; CHECK-NEXT:                      )
  ;; CHECK-NEXT:                     )
  ;; CHECK-NEXT:                     (i32.const 0)
  ;; CHECK-NEXT:                    )
  ;; CHECK-NEXT:                   )
  ;; CHECK-NEXT:                  )
- ;; CHECK-NEXT:                  (select
- ;; CHECK-NEXT:                   (local.get $6)
- ;; CHECK-NEXT:                   (local.tee $5
- ;; CHECK-NEXT:                    (i32.add
- ;; CHECK-NEXT:                     (i32.eqz
- ;; CHECK-NEXT:                      (local.get $12)
- ;; CHECK-NEXT:                     )
- ;; CHECK-NEXT:                     (i32.sub
- ;; CHECK-NEXT:                      (local.get $23)
- ;; CHECK-NEXT:                      (local.tee $7
+ ;; CHECK-NEXT:                  (block (result i32)
+ ;; CHECK-NEXT:                   (local.set $6
+ ;; CHECK-NEXT:                    (local.get $5)
+ ;; CHECK-NEXT:                   )
+ ;; CHECK-NEXT:                   (select
+ ;; CHECK-NEXT:                    (local.get $7)
+ ;; CHECK-NEXT:                    (local.tee $5
+ ;; CHECK-NEXT:                     (i32.add
+ ;; CHECK-NEXT:                      (i32.eqz
+ ;; CHECK-NEXT:                       (i32.and
+ ;; CHECK-NEXT:                        (local.get $12)
+ ;; CHECK-NEXT:                        (i32.const 1)
+ ;; CHECK-NEXT:                       )
+ ;; CHECK-NEXT:                      )
+ ;; CHECK-NEXT:                      (i32.sub
+ ;; CHECK-NEXT:                       (local.get $23)
  ;; CHECK-NEXT:                       (local.get $5)
  ;; CHECK-NEXT:                      )
  ;; CHECK-NEXT:                     )
  ;; CHECK-NEXT:                    )
- ;; CHECK-NEXT:                   )
- ;; CHECK-NEXT:                   (i32.lt_s
- ;; CHECK-NEXT:                    (local.get $5)
- ;; CHECK-NEXT:                    (local.get $6)
+ ;; CHECK-NEXT:                    (i32.lt_s
+ ;; CHECK-NEXT:                     (local.get $5)
+ ;; CHECK-NEXT:                     (local.get $7)
+ ;; CHECK-NEXT:                    )
  ;; CHECK-NEXT:                   )
  ;; CHECK-NEXT:                  )
  ;; CHECK-NEXT:                  (block (result i32)
- ;; CHECK-NEXT:                   (local.set $7
+ ;; CHECK-NEXT:                   (local.set $6
  ;; CHECK-NEXT:                    (local.get $23)
  ;; CHECK-NEXT:                   )
  ;; CHECK-NEXT:                   (i32.const 0)
@@ -8892,13 +9121,13 @@
  ;; CHECK-NEXT:                )
  ;; CHECK-NEXT:                (local.get $23)
  ;; CHECK-NEXT:               )
- ;; CHECK-NEXT:               (local.get $7)
+ ;; CHECK-NEXT:               (local.get $6)
  ;; CHECK-NEXT:              )
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:             (local.get $12)
  ;; CHECK-NEXT:             (i32.lt_s
  ;; CHECK-NEXT:              (local.get $12)
- ;; CHECK-NEXT:              (local.get $15)
+ ;; CHECK-NEXT:              (local.get $13)
  ;; CHECK-NEXT:             )
  ;; CHECK-NEXT:            )
  ;; CHECK-NEXT:           )
@@ -8926,7 +9155,7 @@
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:       (drop
  ;; CHECK-NEXT:        (call $___fwritex
- ;; CHECK-NEXT:         (local.get $11)
+ ;; CHECK-NEXT:         (local.get $10)
  ;; CHECK-NEXT:         (local.get $8)
  ;; CHECK-NEXT:         (local.get $0)
  ;; CHECK-NEXT:        )
@@ -8935,7 +9164,7 @@
  ;; CHECK-NEXT:      (call $_pad
  ;; CHECK-NEXT:       (local.get $0)
  ;; CHECK-NEXT:       (i32.const 48)
- ;; CHECK-NEXT:       (local.get $6)
+ ;; CHECK-NEXT:       (local.get $7)
  ;; CHECK-NEXT:       (local.get $5)
  ;; CHECK-NEXT:       (i32.xor
  ;; CHECK-NEXT:        (local.get $9)
@@ -8946,7 +9175,7 @@
  ;; CHECK-NEXT:       (local.get $0)
  ;; CHECK-NEXT:       (i32.const 48)
  ;; CHECK-NEXT:       (local.get $12)
- ;; CHECK-NEXT:       (local.get $15)
+ ;; CHECK-NEXT:       (local.get $13)
  ;; CHECK-NEXT:       (i32.const 0)
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:      (if
@@ -8960,8 +9189,8 @@
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:       (drop
  ;; CHECK-NEXT:        (call $___fwritex
- ;; CHECK-NEXT:         (local.get $7)
- ;; CHECK-NEXT:         (local.get $15)
+ ;; CHECK-NEXT:         (local.get $6)
+ ;; CHECK-NEXT:         (local.get $13)
  ;; CHECK-NEXT:         (local.get $0)
  ;; CHECK-NEXT:        )
  ;; CHECK-NEXT:       )
@@ -8969,7 +9198,7 @@
  ;; CHECK-NEXT:      (call $_pad
  ;; CHECK-NEXT:       (local.get $0)
  ;; CHECK-NEXT:       (i32.const 32)
- ;; CHECK-NEXT:       (local.get $6)
+ ;; CHECK-NEXT:       (local.get $7)
  ;; CHECK-NEXT:       (local.get $5)
  ;; CHECK-NEXT:       (i32.xor
  ;; CHECK-NEXT:        (local.get $9)
@@ -8977,10 +9206,10 @@
  ;; CHECK-NEXT:       )
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:      (local.set $5
- ;; CHECK-NEXT:       (local.get $10)
+ ;; CHECK-NEXT:       (local.get $11)
  ;; CHECK-NEXT:      )
- ;; CHECK-NEXT:      (local.set $10
- ;; CHECK-NEXT:       (local.get $6)
+ ;; CHECK-NEXT:      (local.set $11
+ ;; CHECK-NEXT:       (local.get $7)
  ;; CHECK-NEXT:      )
  ;; CHECK-NEXT:      (br $label$continue$L1)
  ;; CHECK-NEXT:     )
@@ -8991,7 +9220,7 @@
  ;; CHECK-NEXT:    (i32.eqz
  ;; CHECK-NEXT:     (local.get $0)
  ;; CHECK-NEXT:    )
- ;; CHECK-NEXT:    (local.set $18
+ ;; CHECK-NEXT:    (local.set $17
  ;; CHECK-NEXT:     (if (result i32)
  ;; CHECK-NEXT:      (local.get $1)
  ;; CHECK-NEXT:      (block (result i32)
@@ -9034,7 +9263,7 @@
  ;; CHECK-NEXT:            (i32.const 10)
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:          )
- ;; CHECK-NEXT:          (local.set $18
+ ;; CHECK-NEXT:          (local.set $17
  ;; CHECK-NEXT:           (i32.const 1)
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:          (br $label$break$L343)
@@ -9058,7 +9287,7 @@
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:          )
  ;; CHECK-NEXT:          (block
- ;; CHECK-NEXT:           (local.set $18
+ ;; CHECK-NEXT:           (local.set $17
  ;; CHECK-NEXT:            (i32.const -1)
  ;; CHECK-NEXT:           )
  ;; CHECK-NEXT:           (br $label$break$L343)
@@ -9086,9 +9315,9 @@
  ;; CHECK-NEXT:   )
  ;; CHECK-NEXT:  )
  ;; CHECK-NEXT:  (global.set $STACKTOP
- ;; CHECK-NEXT:   (local.get $13)
+ ;; CHECK-NEXT:   (local.get $15)
  ;; CHECK-NEXT:  )
- ;; CHECK-NEXT:  (local.get $18)
+ ;; CHECK-NEXT:  (local.get $17)
  ;; CHECK-NEXT: )
  (func $_printf_core (param $0 i32) (param $1 i32) (param $2 i32) (param $3 i32) (param $4 i32) (result i32)
   (local $5 i32)
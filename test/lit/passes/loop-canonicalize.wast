@@ -0,0 +1,136 @@
+;; NOTE: Assertions have been generated by update_lit_checks.py and should not be edited.
+
+;; RUN: wasm-opt %s --loop-canonicalize -S -o - | filecheck %s
+
+(module
+  ;; CHECK:      (global $g (mut i32) (i32.const 0))
+  (global $g (mut i32) (i32.const 0))
+
+  ;; A while-shaped loop: the top-of-loop exit check is rotated to the bottom,
+  ;; with a copy guarding entry into the loop.
+  ;; CHECK:      (func $while-shape (param $i i32)
+  ;; CHECK-NEXT:  (block $out
+  ;; CHECK-NEXT:   (block
+  ;; CHECK-NEXT:    (br_if $out
+  ;; CHECK-NEXT:     (i32.ge_u
+  ;; CHECK-NEXT:      (local.get $i)
+  ;; CHECK-NEXT:      (i32.const 10)
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:    (loop $in
+  ;; CHECK-NEXT:     (global.set $g
+  ;; CHECK-NEXT:      (local.get $i)
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:     (local.set $i
+  ;; CHECK-NEXT:      (i32.add
+  ;; CHECK-NEXT:       (local.get $i)
+  ;; CHECK-NEXT:       (i32.const 1)
+  ;; CHECK-NEXT:      )
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:     (br_if $out
+  ;; CHECK-NEXT:      (i32.ge_u
+  ;; CHECK-NEXT:       (local.get $i)
+  ;; CHECK-NEXT:       (i32.const 10)
+  ;; CHECK-NEXT:      )
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:     (br $in)
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  (func $while-shape (param $i i32)
+    (block $out
+      (loop $in
+        (br_if $out
+          (i32.ge_u
+            (local.get $i)
+            (i32.const 10)
+          )
+        )
+        (global.set $g
+          (local.get $i)
+        )
+        (local.set $i
+          (i32.add
+            (local.get $i)
+            (i32.const 1)
+          )
+        )
+        (br $in)
+      )
+    )
+  )
+
+  ;; Already bottom-tested: nothing to do.
+  ;; CHECK:      (func $do-while-shape (param $i i32)
+  ;; CHECK-NEXT:  (block $out
+  ;; CHECK-NEXT:   (loop $in
+  ;; CHECK-NEXT:    (global.set $g
+  ;; CHECK-NEXT:     (local.get $i)
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:    (local.set $i
+  ;; CHECK-NEXT:     (i32.add
+  ;; CHECK-NEXT:      (local.get $i)
+  ;; CHECK-NEXT:      (i32.const 1)
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:    (br_if $in
+  ;; CHECK-NEXT:     (i32.lt_u
+  ;; CHECK-NEXT:      (local.get $i)
+  ;; CHECK-NEXT:      (i32.const 10)
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  (func $do-while-shape (param $i i32)
+    (block $out
+      (loop $in
+        (global.set $g
+          (local.get $i)
+        )
+        (local.set $i
+          (i32.add
+            (local.get $i)
+            (i32.const 1)
+          )
+        )
+        (br_if $in
+          (i32.lt_u
+            (local.get $i)
+            (i32.const 10)
+          )
+        )
+      )
+    )
+  )
+
+  ;; The top check continues the loop rather than exiting it: not a while
+  ;; shape, so it is left alone.
+  ;; CHECK:      (func $check-continues (param $i i32)
+  ;; CHECK-NEXT:  (block $out
+  ;; CHECK-NEXT:   (loop $in
+  ;; CHECK-NEXT:    (br_if $in
+  ;; CHECK-NEXT:     (local.get $i)
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:    (global.set $g
+  ;; CHECK-NEXT:     (i32.const 1)
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:    (br $in)
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  (func $check-continues (param $i i32)
+    (block $out
+      (loop $in
+        (br_if $in
+          (local.get $i)
+        )
+        (global.set $g
+          (i32.const 1)
+        )
+        (br $in)
+      )
+    )
+  )
+)
@@ -0,0 +1,134 @@
+;; NOTE: Assertions have been generated by update_lit_checks.py --all-items and should not be edited.
+
+;; RUN: wasm-opt %s --monomorphize -S -o - | filecheck %s
+
+;; With a tiny budget no clone fits, and the module is unchanged.
+;; RUN: wasm-opt %s --monomorphize --pass-arg=monomorphize-budget@1 -S -o - \
+;; RUN:   | filecheck %s --check-prefix BUDGET
+
+(module
+  ;; CHECK:      (type $i32_i32_=>_i32 (func (param i32 i32) (result i32)))
+
+  ;; CHECK:      (type $i32_=>_i32 (func (param i32) (result i32)))
+
+  ;; CHECK:      (func $add (param $x i32) (param $y i32) (result i32)
+  ;; CHECK-NEXT:  (i32.add
+  ;; CHECK-NEXT:   (local.get $x)
+  ;; CHECK-NEXT:   (local.get $y)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  ;; BUDGET:      (type $i32_=>_i32 (func (param i32) (result i32)))
+
+  ;; BUDGET:      (type $i32_i32_=>_i32 (func (param i32 i32) (result i32)))
+
+  ;; BUDGET:      (func $add (param $x i32) (param $y i32) (result i32)
+  ;; BUDGET-NEXT:  (i32.add
+  ;; BUDGET-NEXT:   (local.get $x)
+  ;; BUDGET-NEXT:   (local.get $y)
+  ;; BUDGET-NEXT:  )
+  ;; BUDGET-NEXT: )
+  (func $add (param $x i32) (param $y i32) (result i32)
+    (i32.add
+      (local.get $x)
+      (local.get $y)
+    )
+  )
+
+  ;; Both calls pass the constant 7 for $x: they share one clone, which sets
+  ;; the constant at the top of its body for later passes to propagate.
+  ;; CHECK:      (func $call-const-twice (param $p i32) (result i32)
+  ;; CHECK-NEXT:  (i32.add
+  ;; CHECK-NEXT:   (call $byn-mono$add
+  ;; CHECK-NEXT:    (i32.const 7)
+  ;; CHECK-NEXT:    (local.get $p)
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:   (call $byn-mono$add
+  ;; CHECK-NEXT:    (i32.const 7)
+  ;; CHECK-NEXT:    (local.get $p)
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  ;; BUDGET:      (func $call-const-twice (param $p i32) (result i32)
+  ;; BUDGET-NEXT:  (i32.add
+  ;; BUDGET-NEXT:   (call $add
+  ;; BUDGET-NEXT:    (i32.const 7)
+  ;; BUDGET-NEXT:    (local.get $p)
+  ;; BUDGET-NEXT:   )
+  ;; BUDGET-NEXT:   (call $add
+  ;; BUDGET-NEXT:    (i32.const 7)
+  ;; BUDGET-NEXT:    (local.get $p)
+  ;; BUDGET-NEXT:   )
+  ;; BUDGET-NEXT:  )
+  ;; BUDGET-NEXT: )
+  (func $call-const-twice (param $p i32) (result i32)
+    (i32.add
+      (call $add
+        (i32.const 7)
+        (local.get $p)
+      )
+      (call $add
+        (i32.const 7)
+        (local.get $p)
+      )
+    )
+  )
+
+  ;; A different constant pattern gets a clone of its own.
+  ;; CHECK:      (func $call-other-const (param $p i32) (result i32)
+  ;; CHECK-NEXT:  (call $byn-mono$add_0
+  ;; CHECK-NEXT:   (i32.const 8)
+  ;; CHECK-NEXT:   (local.get $p)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  ;; BUDGET:      (func $call-other-const (param $p i32) (result i32)
+  ;; BUDGET-NEXT:  (call $add
+  ;; BUDGET-NEXT:   (i32.const 8)
+  ;; BUDGET-NEXT:   (local.get $p)
+  ;; BUDGET-NEXT:  )
+  ;; BUDGET-NEXT: )
+  (func $call-other-const (param $p i32) (result i32)
+    (call $add
+      (i32.const 8)
+      (local.get $p)
+    )
+  )
+
+  ;; No constant (or refined reference) arguments: nothing to monomorphize.
+  ;; CHECK:      (func $call-plain (param $p i32) (result i32)
+  ;; CHECK-NEXT:  (call $add
+  ;; CHECK-NEXT:   (local.get $p)
+  ;; CHECK-NEXT:   (local.get $p)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  ;; BUDGET:      (func $call-plain (param $p i32) (result i32)
+  ;; BUDGET-NEXT:  (call $add
+  ;; BUDGET-NEXT:   (local.get $p)
+  ;; BUDGET-NEXT:   (local.get $p)
+  ;; BUDGET-NEXT:  )
+  ;; BUDGET-NEXT: )
+  (func $call-plain (param $p i32) (result i32)
+    (call $add
+      (local.get $p)
+      (local.get $p)
+    )
+  )
+)
+;; CHECK:      (func $byn-mono$add (param $x i32) (param $y i32) (result i32)
+;; CHECK-NEXT:  (local.set $x
+;; CHECK-NEXT:   (i32.const 7)
+;; CHECK-NEXT:  )
+;; CHECK-NEXT:  (i32.add
+;; CHECK-NEXT:   (local.get $x)
+;; CHECK-NEXT:   (local.get $y)
+;; CHECK-NEXT:  )
+;; CHECK-NEXT: )
+
+;; CHECK:      (func $byn-mono$add_0 (param $x i32) (param $y i32) (result i32)
+;; CHECK-NEXT:  (local.set $x
+;; CHECK-NEXT:   (i32.const 8)
+;; CHECK-NEXT:  )
+;; CHECK-NEXT:  (i32.add
+;; CHECK-NEXT:   (local.get $x)
+;; CHECK-NEXT:   (local.get $y)
+;; CHECK-NEXT:  )
+;; CHECK-NEXT: )
@@ -0,0 +1,139 @@
+;; NOTE: Assertions have been generated by update_lit_checks.py --all-items and should not be edited.
+
+;; RUN: wasm-opt %s --outlining -S -o - | filecheck %s
+
+(module
+  ;; CHECK:      (type $i32_=>_i32 (func (param i32) (result i32)))
+
+  ;; CHECK:      (type $none_=>_none (func))
+
+  ;; CHECK:      (global $g (mut i32) (i32.const 0))
+  (global $g (mut i32) (i32.const 0))
+
+  ;; The large constant expression below appears in both functions, and is
+  ;; worth a call at each appearance: it is outlined into a shared function.
+  ;; The small duplicated global.set is below the profitability threshold and
+  ;; the duplicated local.get addition uses a local, so both stay as they are.
+  ;; CHECK:      (func $a (param $p i32) (result i32)
+  ;; CHECK-NEXT:  (call $outlined)
+  ;; CHECK-NEXT:  (global.set $g
+  ;; CHECK-NEXT:   (i32.const 10)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT:  (i32.add
+  ;; CHECK-NEXT:   (local.get $p)
+  ;; CHECK-NEXT:   (i32.const 11)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  (func $a (param $p i32) (result i32)
+    (global.set $g
+      (i32.mul
+        (i32.add
+          (i32.mul
+            (i32.add
+              (i32.const 1)
+              (i32.const 2)
+            )
+            (i32.add
+              (i32.const 3)
+              (i32.const 4)
+            )
+          )
+          (i32.mul
+            (i32.add
+              (i32.const 5)
+              (i32.const 6)
+            )
+            (i32.add
+              (i32.const 7)
+              (i32.const 8)
+            )
+          )
+        )
+        (i32.const 9)
+      )
+    )
+    (global.set $g
+      (i32.const 10)
+    )
+    (i32.add
+      (local.get $p)
+      (i32.const 11)
+    )
+  )
+
+  ;; CHECK:      (func $b (param $p i32) (result i32)
+  ;; CHECK-NEXT:  (call $outlined)
+  ;; CHECK-NEXT:  (global.set $g
+  ;; CHECK-NEXT:   (i32.const 10)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT:  (i32.add
+  ;; CHECK-NEXT:   (local.get $p)
+  ;; CHECK-NEXT:   (i32.const 11)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  (func $b (param $p i32) (result i32)
+    (global.set $g
+      (i32.mul
+        (i32.add
+          (i32.mul
+            (i32.add
+              (i32.const 1)
+              (i32.const 2)
+            )
+            (i32.add
+              (i32.const 3)
+              (i32.const 4)
+            )
+          )
+          (i32.mul
+            (i32.add
+              (i32.const 5)
+              (i32.const 6)
+            )
+            (i32.add
+              (i32.const 7)
+              (i32.const 8)
+            )
+          )
+        )
+        (i32.const 9)
+      )
+    )
+    (global.set $g
+      (i32.const 10)
+    )
+    (i32.add
+      (local.get $p)
+      (i32.const 11)
+    )
+  )
+)
+;; CHECK:      (func $outlined
+;; CHECK-NEXT:  (global.set $g
+;; CHECK-NEXT:   (i32.mul
+;; CHECK-NEXT:    (i32.add
+;; CHECK-NEXT:     (i32.mul
+;; CHECK-NEXT:      (i32.add
+;; CHECK-NEXT:       (i32.const 1)
+;; CHECK-NEXT:       (i32.const 2)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:      (i32.add
+;; CHECK-NEXT:       (i32.const 3)
+;; CHECK-NEXT:       (i32.const 4)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:     (i32.mul
+;; CHECK-NEXT:      (i32.add
+;; CHECK-NEXT:       (i32.const 5)
+;; CHECK-NEXT:       (i32.const 6)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:      (i32.add
+;; CHECK-NEXT:       (i32.const 7)
+;; CHECK-NEXT:       (i32.const 8)
+;; CHECK-NEXT:      )
+;; CHECK-NEXT:     )
+;; CHECK-NEXT:    )
+;; CHECK-NEXT:    (i32.const 9)
+;; CHECK-NEXT:   )
+;; CHECK-NEXT:  )
+;; CHECK-NEXT: )
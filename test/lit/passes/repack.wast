@@ -0,0 +1,53 @@
+;; NOTE: Assertions have been generated by update_lit_checks.py and should not be edited.
+
+;; RUN: wasm-opt %s --repack -S -o - | filecheck %s
+
+;; Repack copies each function body into fresh, contiguous storage without
+;; changing it at all: the output must be identical to the input.
+
+(module
+  ;; CHECK:      (func $identical (param $x i32) (result i32)
+  ;; CHECK-NEXT:  (local $y i32)
+  ;; CHECK-NEXT:  (local.set $y
+  ;; CHECK-NEXT:   (i32.add
+  ;; CHECK-NEXT:    (local.get $x)
+  ;; CHECK-NEXT:    (i32.const 1)
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT:  (if (result i32)
+  ;; CHECK-NEXT:   (local.get $y)
+  ;; CHECK-NEXT:   (block $b (result i32)
+  ;; CHECK-NEXT:    (drop
+  ;; CHECK-NEXT:     (br_if $b
+  ;; CHECK-NEXT:      (i32.const 2)
+  ;; CHECK-NEXT:      (local.get $x)
+  ;; CHECK-NEXT:     )
+  ;; CHECK-NEXT:    )
+  ;; CHECK-NEXT:    (local.get $y)
+  ;; CHECK-NEXT:   )
+  ;; CHECK-NEXT:   (i32.const 3)
+  ;; CHECK-NEXT:  )
+  ;; CHECK-NEXT: )
+  (func $identical (param $x i32) (result i32)
+    (local $y i32)
+    (local.set $y
+      (i32.add
+        (local.get $x)
+        (i32.const 1)
+      )
+    )
+    (if (result i32)
+      (local.get $y)
+      (block $b (result i32)
+        (drop
+          (br_if $b
+            (i32.const 2)
+            (local.get $x)
+          )
+        )
+        (local.get $y)
+      )
+      (i32.const 3)
+    )
+  )
+)
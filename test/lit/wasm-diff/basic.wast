@@ -0,0 +1,27 @@
+;; Comparing a module against itself prints a summary and exits with 0.
+
+;; RUN: wasm-diff %s %s | filecheck %s --check-prefix SAME
+
+;; SAME:      functions: 1 -> 1 (0 added, 0 removed, 0 changed)
+;; SAME-NEXT: code size: 1 -> 1 IR nodes (0)
+;; SAME-NEXT: data: 1 -> 1 segments, 5 -> 5 bytes (0)
+
+;; Comparing against a modified module reports the per-function changes and
+;; exits with 1.
+
+;; RUN: not wasm-diff %s %S/basic.second.txt | filecheck %s --check-prefix DIFF
+
+;; DIFF:      ~ changed function f (size 1 -> 1)
+;; DIFF-NEXT: + added function g
+;; DIFF-NEXT: functions: 1 -> 2 (1 added, 0 removed, 1 changed)
+;; DIFF-NEXT: code size: 1 -> 2 IR nodes (1)
+;; DIFF-NEXT: data: 1 -> 1 segments, 5 -> 11 bytes (6)
+
+(module
+ (memory 1)
+ (data (i32.const 0) "hello")
+ (func $f (result i32)
+  (i32.const 1)
+ )
+ (export "f" (func $f))
+)
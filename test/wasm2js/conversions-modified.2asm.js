@@ -263,330 +263,170 @@ function asmFunc(env) {
  
  function legalstub$0($0_1) {
   $0_1 = $0_1 | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $8_1 = 0, $1_1 = 0, $1$hi = 0, i64toi32_i32$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $1_1 = 0;
   i64toi32_i32$0 = $0($0_1 | 0) | 0;
   i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
   $1_1 = i64toi32_i32$0;
-  $1$hi = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = 0;
-   $8_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$0 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $8_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($8_1 | 0);
-  i64toi32_i32$0 = $1$hi;
+  setTempRet0(i64toi32_i32$1 | 0);
+  i64toi32_i32$0 = i64toi32_i32$1;
+  i64toi32_i32$0 = i64toi32_i32$1;
   return $1_1 | 0;
  }
  
  function legalstub$1($0_1) {
   $0_1 = $0_1 | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $8_1 = 0, $1_1 = 0, $1$hi = 0, i64toi32_i32$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $1_1 = 0;
   i64toi32_i32$0 = $1($0_1 | 0) | 0;
   i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
   $1_1 = i64toi32_i32$0;
-  $1$hi = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = 0;
-   $8_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$0 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $8_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($8_1 | 0);
-  i64toi32_i32$0 = $1$hi;
+  setTempRet0(i64toi32_i32$1 | 0);
+  i64toi32_i32$0 = i64toi32_i32$1;
+  i64toi32_i32$0 = i64toi32_i32$1;
   return $1_1 | 0;
  }
  
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $10_1 = 0, $3_1 = 0, $3$hi = 0, $6$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $3$hi = 0;
   i64toi32_i32$0 = 0;
-  $3_1 = $0_1;
   $3$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $10_1 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $10_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $6$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $3$hi;
-  i64toi32_i32$0 = $3_1;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$3 = $10_1;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  return $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0 | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $3$hi | i64toi32_i32$2 | 0;
+  return $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0 | 0;
  }
  
  function legalstub$7($0_1) {
   $0_1 = Math_fround($0_1);
-  var i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $8_1 = 0, $1_1 = 0, $1$hi = 0, i64toi32_i32$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $1_1 = 0;
   i64toi32_i32$0 = $7(Math_fround($0_1)) | 0;
   i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
   $1_1 = i64toi32_i32$0;
-  $1$hi = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = 0;
-   $8_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$0 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $8_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($8_1 | 0);
-  i64toi32_i32$0 = $1$hi;
+  setTempRet0(i64toi32_i32$1 | 0);
+  i64toi32_i32$0 = i64toi32_i32$1;
+  i64toi32_i32$0 = i64toi32_i32$1;
   return $1_1 | 0;
  }
  
  function legalstub$8($0_1) {
   $0_1 = Math_fround($0_1);
-  var i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $8_1 = 0, $1_1 = 0, $1$hi = 0, i64toi32_i32$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $1_1 = 0;
   i64toi32_i32$0 = $8(Math_fround($0_1)) | 0;
   i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
   $1_1 = i64toi32_i32$0;
-  $1$hi = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = 0;
-   $8_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$0 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $8_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($8_1 | 0);
-  i64toi32_i32$0 = $1$hi;
+  setTempRet0(i64toi32_i32$1 | 0);
+  i64toi32_i32$0 = i64toi32_i32$1;
+  i64toi32_i32$0 = i64toi32_i32$1;
   return $1_1 | 0;
  }
  
  function legalstub$9($0_1) {
   $0_1 = +$0_1;
-  var i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $8_1 = 0, $1_1 = 0, $1$hi = 0, i64toi32_i32$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $1_1 = 0;
   i64toi32_i32$0 = $9(+$0_1) | 0;
   i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
   $1_1 = i64toi32_i32$0;
-  $1$hi = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = 0;
-   $8_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$0 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $8_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($8_1 | 0);
-  i64toi32_i32$0 = $1$hi;
+  setTempRet0(i64toi32_i32$1 | 0);
+  i64toi32_i32$0 = i64toi32_i32$1;
+  i64toi32_i32$0 = i64toi32_i32$1;
   return $1_1 | 0;
  }
  
  function legalstub$10($0_1) {
   $0_1 = +$0_1;
-  var i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $8_1 = 0, $1_1 = 0, $1$hi = 0, i64toi32_i32$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $1_1 = 0;
   i64toi32_i32$0 = $10(+$0_1) | 0;
   i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
   $1_1 = i64toi32_i32$0;
-  $1$hi = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = 0;
-   $8_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$0 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $8_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($8_1 | 0);
-  i64toi32_i32$0 = $1$hi;
+  setTempRet0(i64toi32_i32$1 | 0);
+  i64toi32_i32$0 = i64toi32_i32$1;
+  i64toi32_i32$0 = i64toi32_i32$1;
   return $1_1 | 0;
  }
  
  function legalstub$12($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $10_1 = 0, $3_1 = 0, $3$hi = 0, $6$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $3$hi = 0;
   i64toi32_i32$0 = 0;
-  $3_1 = $0_1;
   $3$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $10_1 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $10_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $6$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $3$hi;
-  i64toi32_i32$0 = $3_1;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$3 = $10_1;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  return Math_fround(Math_fround($12(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0)));
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $3$hi | i64toi32_i32$2 | 0;
+  return Math_fround(Math_fround($12(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0)));
  }
  
  function legalstub$14($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $10_1 = 0, $3_1 = 0, $3$hi = 0, $6$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $3$hi = 0;
   i64toi32_i32$0 = 0;
-  $3_1 = $0_1;
   $3$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $10_1 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $10_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $6$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $3$hi;
-  i64toi32_i32$0 = $3_1;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$3 = $10_1;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  return +(+$14(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0));
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $3$hi | i64toi32_i32$2 | 0;
+  return +(+$14(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0));
  }
  
  function legalstub$16($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $10_1 = 0, $3_1 = 0, $3$hi = 0, $6$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $3$hi = 0;
   i64toi32_i32$0 = 0;
-  $3_1 = $0_1;
   $3$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $10_1 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $10_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $6$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $3$hi;
-  i64toi32_i32$0 = $3_1;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$3 = $10_1;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  return Math_fround(Math_fround($16(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0)));
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $3$hi | i64toi32_i32$2 | 0;
+  return Math_fround(Math_fround($16(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0)));
  }
  
  function legalstub$18($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $10_1 = 0, $3_1 = 0, $3$hi = 0, $6$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $3$hi = 0;
   i64toi32_i32$0 = 0;
-  $3_1 = $0_1;
   $3$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $10_1 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $10_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $6$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $3$hi;
-  i64toi32_i32$0 = $3_1;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$3 = $10_1;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  return +(+$18(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0));
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $3$hi | i64toi32_i32$2 | 0;
+  return +(+$18(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0));
  }
  
  function legalstub$22($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $10_1 = 0, $3_1 = 0, $3$hi = 0, $6$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $3$hi = 0;
   i64toi32_i32$0 = 0;
-  $3_1 = $0_1;
   $3$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $10_1 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $10_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $6$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $3$hi;
-  i64toi32_i32$0 = $3_1;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$3 = $10_1;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  return +(+$22(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0));
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $3$hi | i64toi32_i32$2 | 0;
+  return +(+$22(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0));
  }
  
  function legalstub$24($0_1) {
   $0_1 = +$0_1;
-  var i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $8_1 = 0, $1_1 = 0, $1$hi = 0, i64toi32_i32$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $1_1 = 0;
   i64toi32_i32$0 = $24(+$0_1) | 0;
   i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
   $1_1 = i64toi32_i32$0;
-  $1$hi = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = 0;
-   $8_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$0 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $8_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($8_1 | 0);
-  i64toi32_i32$0 = $1$hi;
+  setTempRet0(i64toi32_i32$1 | 0);
+  i64toi32_i32$0 = i64toi32_i32$1;
+  i64toi32_i32$0 = i64toi32_i32$1;
   return $1_1 | 0;
  }
  
@@ -344,113 +344,53 @@ function asmFunc(env) {
  function legalstub$43($0, $1_1) {
   $0 = $0 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $10_1 = 0, $3_1 = 0, $3$hi = 0, $6$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $3$hi = 0;
   i64toi32_i32$0 = 0;
-  $3_1 = $0;
   $3$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $10_1 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $10_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $6$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $3$hi;
-  i64toi32_i32$0 = $3_1;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$3 = $10_1;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  return Math_fround(Math_fround($43(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0)));
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$2 = $3$hi | i64toi32_i32$2 | 0;
+  return Math_fround(Math_fround($43(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0)));
  }
  
  function legalstub$44($0, $1_1) {
   $0 = $0 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $10_1 = 0, $3_1 = 0, $3$hi = 0, $6$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $3$hi = 0;
   i64toi32_i32$0 = 0;
-  $3_1 = $0;
   $3$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $10_1 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $10_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $6$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $3$hi;
-  i64toi32_i32$0 = $3_1;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$3 = $10_1;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  return +(+$44(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0));
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$2 = $3$hi | i64toi32_i32$2 | 0;
+  return +(+$44(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0));
  }
  
  function legalstub$45($0, $1_1) {
   $0 = $0 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $10_1 = 0, $3_1 = 0, $3$hi = 0, $6$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $3$hi = 0;
   i64toi32_i32$0 = 0;
-  $3_1 = $0;
   $3$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $10_1 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $10_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $6$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $3$hi;
-  i64toi32_i32$0 = $3_1;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$3 = $10_1;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  return Math_fround(Math_fround($45(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0)));
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$2 = $3$hi | i64toi32_i32$2 | 0;
+  return Math_fround(Math_fround($45(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0)));
  }
  
  function legalstub$46($0, $1_1) {
   $0 = $0 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $10_1 = 0, $3_1 = 0, $3$hi = 0, $6$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $3$hi = 0;
   i64toi32_i32$0 = 0;
-  $3_1 = $0;
   $3$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $10_1 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $10_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $6$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $3$hi;
-  i64toi32_i32$0 = $3_1;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$3 = $10_1;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  return +(+$46(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0));
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$2 = $3$hi | i64toi32_i32$2 | 0;
+  return +(+$46(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0));
  }
  
  return {
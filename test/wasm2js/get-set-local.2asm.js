@@ -30,30 +30,14 @@ function asmFunc(env) {
   $0 = $0 | 0;
   $1_1 = $1_1 | 0;
   $2 = $2 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $12 = 0, $3 = 0, $5 = 0, $5$hi = 0, $8$hi = 0;
-  $3 = $0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $5$hi = 0;
   i64toi32_i32$0 = 0;
-  $5 = $1_1;
   $5$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $2;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $8$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $5;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  return $1($3 | 0, i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0 | 0;
+  i64toi32_i32$0 = $1_1;
+  i64toi32_i32$2 = $5$hi | i64toi32_i32$2 | 0;
+  return $1($0 | 0, i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0 | 0;
  }
  
  return {
@@ -210,50 +210,26 @@ function asmFunc(env) {
   $1_1 = $1_1 | 0;
   $2_1 = $2_1 | 0;
   $3_1 = $3_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $19 = 0, $20 = 0, $5_1 = 0, $5$hi = 0, $8$hi = 0, $9_1 = 0, $9$hi = 0, $11 = 0, $11$hi = 0, $14$hi = 0, $15 = 0, $15$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $5$hi = 0, $9_1 = 0, $9$hi = 0, $11$hi = 0, $15 = 0, $15$hi = 0;
   i64toi32_i32$0 = 0;
-  $5_1 = $0;
   $5$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $19 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $8$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $5_1;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $19;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $9_1 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $9$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $11 = $2_1;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3_1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $20 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $14$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $11$hi;
-  i64toi32_i32$2 = $11;
-  i64toi32_i32$1 = $14$hi;
-  i64toi32_i32$3 = $20;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $15 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $15$hi = i64toi32_i32$1;
@@ -267,50 +243,26 @@ function asmFunc(env) {
   $1_1 = $1_1 | 0;
   $2_1 = $2_1 | 0;
   $3_1 = $3_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $19 = 0, $20 = 0, $5_1 = 0, $5$hi = 0, $8$hi = 0, $9_1 = 0, $9$hi = 0, $11 = 0, $11$hi = 0, $14$hi = 0, $15 = 0, $15$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $5$hi = 0, $9_1 = 0, $9$hi = 0, $11$hi = 0, $15 = 0, $15$hi = 0;
   i64toi32_i32$0 = 0;
-  $5_1 = $0;
   $5$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $19 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $8$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $5_1;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $19;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $9_1 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $9$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $11 = $2_1;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3_1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $20 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $14$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $11$hi;
-  i64toi32_i32$2 = $11;
-  i64toi32_i32$1 = $14$hi;
-  i64toi32_i32$3 = $20;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $15 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $15$hi = i64toi32_i32$1;
@@ -324,50 +276,26 @@ function asmFunc(env) {
   $1_1 = $1_1 | 0;
   $2_1 = $2_1 | 0;
   $3_1 = $3_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $19 = 0, $20 = 0, $5_1 = 0, $5$hi = 0, $8$hi = 0, $9_1 = 0, $9$hi = 0, $11 = 0, $11$hi = 0, $14$hi = 0, $15 = 0, $15$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $5$hi = 0, $9_1 = 0, $9$hi = 0, $11$hi = 0, $15 = 0, $15$hi = 0;
   i64toi32_i32$0 = 0;
-  $5_1 = $0;
   $5$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $19 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $8$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $5_1;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $19;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $9_1 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $9$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $11 = $2_1;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3_1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $20 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $14$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $11$hi;
-  i64toi32_i32$2 = $11;
-  i64toi32_i32$1 = $14$hi;
-  i64toi32_i32$3 = $20;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $15 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $15$hi = i64toi32_i32$1;
@@ -381,50 +309,26 @@ function asmFunc(env) {
   $1_1 = $1_1 | 0;
   $2_1 = $2_1 | 0;
   $3_1 = $3_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $19 = 0, $20 = 0, $5_1 = 0, $5$hi = 0, $8$hi = 0, $9_1 = 0, $9$hi = 0, $11 = 0, $11$hi = 0, $14$hi = 0, $15 = 0, $15$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $5$hi = 0, $9_1 = 0, $9$hi = 0, $11$hi = 0, $15 = 0, $15$hi = 0;
   i64toi32_i32$0 = 0;
-  $5_1 = $0;
   $5$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $19 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $8$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $5_1;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $19;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $9_1 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $9$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $11 = $2_1;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3_1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $20 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $14$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $11$hi;
-  i64toi32_i32$2 = $11;
-  i64toi32_i32$1 = $14$hi;
-  i64toi32_i32$3 = $20;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $15 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $15$hi = i64toi32_i32$1;
@@ -438,50 +342,26 @@ function asmFunc(env) {
   $1_1 = $1_1 | 0;
   $2_1 = $2_1 | 0;
   $3_1 = $3_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $19 = 0, $20 = 0, $5_1 = 0, $5$hi = 0, $8$hi = 0, $9_1 = 0, $9$hi = 0, $11 = 0, $11$hi = 0, $14$hi = 0, $15 = 0, $15$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $5$hi = 0, $9_1 = 0, $9$hi = 0, $11$hi = 0, $15 = 0, $15$hi = 0;
   i64toi32_i32$0 = 0;
-  $5_1 = $0;
   $5$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $19 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $8$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $5_1;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $19;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $9_1 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $9$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $11 = $2_1;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3_1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $20 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $14$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $11$hi;
-  i64toi32_i32$2 = $11;
-  i64toi32_i32$1 = $14$hi;
-  i64toi32_i32$3 = $20;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $15 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $15$hi = i64toi32_i32$1;
@@ -495,50 +375,26 @@ function asmFunc(env) {
   $1_1 = $1_1 | 0;
   $2_1 = $2_1 | 0;
   $3_1 = $3_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $19 = 0, $20 = 0, $5_1 = 0, $5$hi = 0, $8$hi = 0, $9_1 = 0, $9$hi = 0, $11 = 0, $11$hi = 0, $14$hi = 0, $15 = 0, $15$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $5$hi = 0, $9_1 = 0, $9$hi = 0, $11$hi = 0, $15 = 0, $15$hi = 0;
   i64toi32_i32$0 = 0;
-  $5_1 = $0;
   $5$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $19 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $8$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $5_1;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $19;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $9_1 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $9$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $11 = $2_1;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3_1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $20 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $14$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $11$hi;
-  i64toi32_i32$2 = $11;
-  i64toi32_i32$1 = $14$hi;
-  i64toi32_i32$3 = $20;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $15 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $15$hi = i64toi32_i32$1;
@@ -552,50 +408,26 @@ function asmFunc(env) {
   $1_1 = $1_1 | 0;
   $2_1 = $2_1 | 0;
   $3_1 = $3_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $19 = 0, $20 = 0, $5_1 = 0, $5$hi = 0, $8$hi = 0, $9_1 = 0, $9$hi = 0, $11 = 0, $11$hi = 0, $14$hi = 0, $15 = 0, $15$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $5$hi = 0, $9_1 = 0, $9$hi = 0, $11$hi = 0, $15 = 0, $15$hi = 0;
   i64toi32_i32$0 = 0;
-  $5_1 = $0;
   $5$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $19 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $8$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $5_1;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $19;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $9_1 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $9$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $11 = $2_1;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3_1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $20 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $14$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $11$hi;
-  i64toi32_i32$2 = $11;
-  i64toi32_i32$1 = $14$hi;
-  i64toi32_i32$3 = $20;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $15 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $15$hi = i64toi32_i32$1;
@@ -609,50 +441,26 @@ function asmFunc(env) {
   $1_1 = $1_1 | 0;
   $2_1 = $2_1 | 0;
   $3_1 = $3_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $19 = 0, $20 = 0, $5_1 = 0, $5$hi = 0, $8$hi = 0, $9_1 = 0, $9$hi = 0, $11 = 0, $11$hi = 0, $14$hi = 0, $15 = 0, $15$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $5$hi = 0, $9_1 = 0, $9$hi = 0, $11$hi = 0, $15 = 0, $15$hi = 0;
   i64toi32_i32$0 = 0;
-  $5_1 = $0;
   $5$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $19 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $8$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $5_1;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $19;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $9_1 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $9$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $11 = $2_1;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3_1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $20 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $14$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $11$hi;
-  i64toi32_i32$2 = $11;
-  i64toi32_i32$1 = $14$hi;
-  i64toi32_i32$3 = $20;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $15 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $15$hi = i64toi32_i32$1;
@@ -666,50 +474,26 @@ function asmFunc(env) {
   $1_1 = $1_1 | 0;
   $2_1 = $2_1 | 0;
   $3_1 = $3_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $19 = 0, $20 = 0, $5_1 = 0, $5$hi = 0, $8$hi = 0, $9_1 = 0, $9$hi = 0, $11 = 0, $11$hi = 0, $14$hi = 0, $15 = 0, $15$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $5$hi = 0, $9_1 = 0, $9$hi = 0, $11$hi = 0, $15 = 0, $15$hi = 0;
   i64toi32_i32$0 = 0;
-  $5_1 = $0;
   $5$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $19 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $8$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $5_1;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $19;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $9_1 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $9$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $11 = $2_1;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3_1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $20 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $14$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $11$hi;
-  i64toi32_i32$2 = $11;
-  i64toi32_i32$1 = $14$hi;
-  i64toi32_i32$3 = $20;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $15 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $15$hi = i64toi32_i32$1;
@@ -723,50 +507,26 @@ function asmFunc(env) {
   $1_1 = $1_1 | 0;
   $2_1 = $2_1 | 0;
   $3_1 = $3_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $19 = 0, $20 = 0, $5_1 = 0, $5$hi = 0, $8$hi = 0, $9_1 = 0, $9$hi = 0, $11 = 0, $11$hi = 0, $14$hi = 0, $15 = 0, $15$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $5$hi = 0, $9_1 = 0, $9$hi = 0, $11$hi = 0, $15 = 0, $15$hi = 0;
   i64toi32_i32$0 = 0;
-  $5_1 = $0;
   $5$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $19 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $8$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $5_1;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $19;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $9_1 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $9$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $11 = $2_1;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3_1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $20 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $14$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $11$hi;
-  i64toi32_i32$2 = $11;
-  i64toi32_i32$1 = $14$hi;
-  i64toi32_i32$3 = $20;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $15 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $15$hi = i64toi32_i32$1;
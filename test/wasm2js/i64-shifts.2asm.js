@@ -82,73 +82,37 @@ function asmFunc(env) {
   $3 = $3 | 0;
   $4 = $4 | 0;
   $5 = $5 | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $26 = 0, $27 = 0, $28 = 0, $7 = 0, $7$hi = 0, $10$hi = 0, $11 = 0, $11$hi = 0, $13 = 0, $13$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $19 = 0, $19$hi = 0, $22$hi = 0, $23 = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $7$hi = 0, $11 = 0, $11$hi = 0, $13$hi = 0, $17 = 0, $17$hi = 0, $19$hi = 0, $23 = 0, $23$hi = 0;
   i64toi32_i32$0 = 0;
-  $7 = $0;
   $7$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $26 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $26 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $10$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $7$hi;
-  i64toi32_i32$0 = $7;
-  i64toi32_i32$2 = $10$hi;
-  i64toi32_i32$3 = $26;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $11 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $13 = $2_1;
   $13$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $27 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $27 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $13$hi;
-  i64toi32_i32$2 = $13;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$3 = $27;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $17 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $17$hi = i64toi32_i32$1;
   i64toi32_i32$1 = 0;
-  $19 = $4;
   $19$hi = i64toi32_i32$1;
   i64toi32_i32$1 = 0;
   i64toi32_i32$0 = $5;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
-   $28 = 0;
-  } else {
-   i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$0 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-   $28 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
-  }
-  $22$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = i64toi32_i32$0;
   i64toi32_i32$2 = $19$hi;
-  i64toi32_i32$1 = $19;
-  i64toi32_i32$0 = $22$hi;
-  i64toi32_i32$3 = $28;
+  i64toi32_i32$1 = $4;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$0 = i64toi32_i32$2 | i64toi32_i32$0 | 0;
   $23 = i64toi32_i32$1 | i64toi32_i32$3 | 0;
   $23$hi = i64toi32_i32$0;
@@ -165,73 +129,37 @@ function asmFunc(env) {
   $3 = $3 | 0;
   $4 = $4 | 0;
   $5 = $5 | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $26 = 0, $27 = 0, $28 = 0, $7 = 0, $7$hi = 0, $10$hi = 0, $11 = 0, $11$hi = 0, $13 = 0, $13$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $19 = 0, $19$hi = 0, $22$hi = 0, $23 = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $7$hi = 0, $11 = 0, $11$hi = 0, $13$hi = 0, $17 = 0, $17$hi = 0, $19$hi = 0, $23 = 0, $23$hi = 0;
   i64toi32_i32$0 = 0;
-  $7 = $0;
   $7$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $26 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $26 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $10$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $7$hi;
-  i64toi32_i32$0 = $7;
-  i64toi32_i32$2 = $10$hi;
-  i64toi32_i32$3 = $26;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $11 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $13 = $2_1;
   $13$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $27 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $27 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $13$hi;
-  i64toi32_i32$2 = $13;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$3 = $27;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $17 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $17$hi = i64toi32_i32$1;
   i64toi32_i32$1 = 0;
-  $19 = $4;
   $19$hi = i64toi32_i32$1;
   i64toi32_i32$1 = 0;
   i64toi32_i32$0 = $5;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
-   $28 = 0;
-  } else {
-   i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$0 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-   $28 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
-  }
-  $22$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = i64toi32_i32$0;
   i64toi32_i32$2 = $19$hi;
-  i64toi32_i32$1 = $19;
-  i64toi32_i32$0 = $22$hi;
-  i64toi32_i32$3 = $28;
+  i64toi32_i32$1 = $4;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$0 = i64toi32_i32$2 | i64toi32_i32$0 | 0;
   $23 = i64toi32_i32$1 | i64toi32_i32$3 | 0;
   $23$hi = i64toi32_i32$0;
@@ -113,50 +113,26 @@ function asmFunc(env) {
   $1_1 = $1_1 | 0;
   $2_1 = $2_1 | 0;
   $3_1 = $3_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $19 = 0, $20 = 0, $5 = 0, $5$hi = 0, $8$hi = 0, $9 = 0, $9$hi = 0, $11 = 0, $11$hi = 0, $14$hi = 0, $15 = 0, $15$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $5$hi = 0, $9 = 0, $9$hi = 0, $11$hi = 0, $15 = 0, $15$hi = 0;
   i64toi32_i32$0 = 0;
-  $5 = $0_1;
   $5$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $19 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $8$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $5;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $19;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $9 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $9$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $11 = $2_1;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3_1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $20 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $14$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $11$hi;
-  i64toi32_i32$2 = $11;
-  i64toi32_i32$1 = $14$hi;
-  i64toi32_i32$3 = $20;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $15 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $15$hi = i64toi32_i32$1;
@@ -170,50 +146,26 @@ function asmFunc(env) {
   $1_1 = $1_1 | 0;
   $2_1 = $2_1 | 0;
   $3_1 = $3_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $19 = 0, $20 = 0, $5 = 0, $5$hi = 0, $8$hi = 0, $9 = 0, $9$hi = 0, $11 = 0, $11$hi = 0, $14$hi = 0, $15 = 0, $15$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $5$hi = 0, $9 = 0, $9$hi = 0, $11$hi = 0, $15 = 0, $15$hi = 0;
   i64toi32_i32$0 = 0;
-  $5 = $0_1;
   $5$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $19 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $8$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $5;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $19;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
   $9 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   $9$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  $11 = $2_1;
   $11$hi = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $3_1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $20 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $14$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = $11$hi;
-  i64toi32_i32$2 = $11;
-  i64toi32_i32$1 = $14$hi;
-  i64toi32_i32$3 = $20;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$3 = 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   $15 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
   $15$hi = i64toi32_i32$1;
@@ -268,45 +220,19 @@ function asmFunc(env) {
  function legalstub$0($0_1, $1) {
   $0_1 = $0_1 | 0;
   $1 = $1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $0(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $0(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2 | 0;
  }
  
@@ -350,45 +276,19 @@ function asmFunc(env) {
  function legalstub$0($0_1, $1) {
   $0_1 = $0_1 | 0;
   $1 = $1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $0(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $0(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2 | 0;
  }
  
@@ -432,31 +332,13 @@ function asmFunc(env) {
  function $2(x, x$hi) {
   x = x | 0;
   x$hi = x$hi | 0;
-  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $7 = 0, $8 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$2 = x;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 1;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $7 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $7 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  i64toi32_i32$0 = $7;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 1;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $8 = i64toi32_i32$1 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$4 | 0;
-   $8 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  i64toi32_i32$0 = $8;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$0 << 1 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 << 1 | 0;
+  i64toi32_i32$2 = i64toi32_i32$1 >> 1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 >>> 1 | 0 | (i64toi32_i32$1 << 31 | 0) | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
   return i64toi32_i32$0 | 0;
  }
@@ -464,31 +346,13 @@ function asmFunc(env) {
  function $3(x, x$hi) {
   x = x | 0;
   x$hi = x$hi | 0;
-  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $7 = 0, $8 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$2 = x;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 1;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $7 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $7 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  i64toi32_i32$0 = $7;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 1;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $8 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $8 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  i64toi32_i32$0 = $8;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$0 << 1 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 << 1 | 0;
+  i64toi32_i32$2 = i64toi32_i32$1 >>> 1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 >>> 1 | 0 | (i64toi32_i32$1 << 31 | 0) | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
   return i64toi32_i32$0 | 0;
  }
@@ -496,90 +360,38 @@ function asmFunc(env) {
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
  function legalstub$3($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $3(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $3(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
@@ -629,31 +441,13 @@ function asmFunc(env) {
  function $2(x, x$hi) {
   x = x | 0;
   x$hi = x$hi | 0;
-  var i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, $7 = 0, $8 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$2 = x;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 1;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $7 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $7 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  i64toi32_i32$0 = $7;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 1;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
-   $8 = 0;
-  } else {
-   i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$0 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-   $8 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
-  }
-  i64toi32_i32$0 = $8;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 >>> 1 | 0 | (i64toi32_i32$0 << 31 | 0) | 0;
+  i64toi32_i32$2 = i64toi32_i32$0 >>> 31 | 0 | (i64toi32_i32$1 << 1 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 << 1 | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
   return i64toi32_i32$0 | 0;
  }
@@ -661,31 +455,13 @@ function asmFunc(env) {
  function $3(x, x$hi) {
   x = x | 0;
   x$hi = x$hi | 0;
-  var i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, $7 = 0, $8 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$2 = x;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 1;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $7 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $7 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  i64toi32_i32$0 = $7;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 1;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
-   $8 = 0;
-  } else {
-   i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$0 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-   $8 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
-  }
-  i64toi32_i32$0 = $8;
+  i64toi32_i32$1 = i64toi32_i32$0 >>> 1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 >>> 1 | 0 | (i64toi32_i32$0 << 31 | 0) | 0;
+  i64toi32_i32$2 = i64toi32_i32$0 >>> 31 | 0 | (i64toi32_i32$1 << 1 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 << 1 | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
   return i64toi32_i32$0 | 0;
  }
@@ -693,90 +469,38 @@ function asmFunc(env) {
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
  function legalstub$3($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $3(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $3(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
@@ -860,90 +584,38 @@ function asmFunc(env) {
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
  function legalstub$3($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $3(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $3(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
@@ -952,40 +624,20 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, var$2 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, var$3 = 0, var$4 = 0, var$5 = 0, $21 = 0, $22 = 0, var$6 = 0, $24 = 0, $17 = 0, $18 = 0, $23 = 0, $29 = 0, $45 = 0, $56$hi = 0, $62$hi = 0;
+  var var$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, var$3 = 0, i64toi32_i32$2 = 0, var$4 = 0, var$5 = 0, var$6 = 0, $23 = 0, $29 = 0, $45 = 0, $62$hi = 0;
   i64toi32_i32$0 = var$1$hi;
   var$2 = var$1;
   var$4 = var$2 >>> 16 | 0;
   i64toi32_i32$0 = var$0$hi;
   var$3 = var$0;
   var$5 = var$3 >>> 16 | 0;
-  $17 = Math_imul(var$4, var$5);
-  $18 = var$2;
   i64toi32_i32$2 = var$3;
   i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $21 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  $23 = $17 + Math_imul($18, $21) | 0;
+  $23 = Math_imul(var$4, var$5) + Math_imul(var$2, i64toi32_i32$0) | 0;
   i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$0 = var$1;
+  i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $22 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $22 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  $29 = $23 + Math_imul($22, var$3) | 0;
+  $29 = $23 + Math_imul(i64toi32_i32$1, var$3) | 0;
   var$2 = var$2 & 65535 | 0;
   var$3 = var$3 & 65535 | 0;
   var$6 = Math_imul(var$2, var$3);
@@ -994,25 +646,14 @@ function asmFunc(env) {
   var$2 = (var$2 & 65535 | 0) + Math_imul(var$4, var$3) | 0;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $45 + (var$2 >>> 16 | 0) | 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $24 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $24 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $56$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = 0;
   $62$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $56$hi;
-  i64toi32_i32$2 = $24;
+  i64toi32_i32$0 = i64toi32_i32$1;
+  i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $62$hi;
-  i64toi32_i32$3 = var$2 << 16 | 0 | (var$6 & 65535 | 0) | 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$2 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
+  i64toi32_i32$2 = i64toi32_i32$2 | (var$2 << 16 | 0 | (var$6 & 65535 | 0) | 0) | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
   return i64toi32_i32$2 | 0;
  }
@@ -1022,22 +663,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $21;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -1057,19 +689,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$2 = i64toi32_i32$5 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$5 = var$2;
   i64toi32_i32$2 = var$1$hi;
@@ -1100,17 +723,8 @@ function asmFunc(env) {
   i64toi32_i32$3 = var$0;
   i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
-  }
-  var$0 = $23;
+  i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
+  var$0 = i64toi32_i32$1 >> 31 | 0;
   var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = $17$hi;
   i64toi32_i32$1 = $17;
@@ -1136,7 +750,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -1151,17 +765,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -1171,17 +776,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -1214,16 +810,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -1237,17 +824,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -1256,7 +834,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -1283,18 +861,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -1323,12 +893,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -1345,12 +915,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -1362,12 +932,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -1386,40 +956,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -1431,17 +982,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -1451,8 +993,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -1463,20 +1005,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -1506,20 +1039,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -1668,90 +1192,38 @@ function asmFunc(env) {
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
  function legalstub$3($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $3(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $3(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
@@ -1760,22 +1232,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $21;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -1795,19 +1258,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$2 = i64toi32_i32$5 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$5 = var$2;
   i64toi32_i32$2 = var$1$hi;
@@ -1838,17 +1292,8 @@ function asmFunc(env) {
   i64toi32_i32$3 = var$0;
   i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
-  }
-  var$0 = $23;
+  i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
+  var$0 = i64toi32_i32$1 >> 31 | 0;
   var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = $17$hi;
   i64toi32_i32$1 = $17;
@@ -1874,7 +1319,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -1889,17 +1334,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -1909,17 +1345,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -1952,16 +1379,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -1975,17 +1393,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -1994,7 +1403,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -2021,18 +1430,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -2061,12 +1462,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -2083,12 +1484,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -2100,12 +1501,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -2124,40 +1525,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -2169,17 +1551,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -2189,8 +1562,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -2201,20 +1574,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -2244,20 +1608,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -2390,90 +1745,38 @@ function asmFunc(env) {
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
  function legalstub$3($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $3(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $3(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
@@ -2482,22 +1785,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $20;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -2517,19 +1811,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$0 = $21;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$0 = i64toi32_i32$5 >> 31 | 0;
   var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$5 = var$0;
   i64toi32_i32$2 = var$1$hi;
@@ -2576,7 +1861,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -2591,17 +1876,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -2611,17 +1887,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -2654,16 +1921,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -2677,17 +1935,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -2696,7 +1945,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -2723,18 +1972,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -2763,12 +2004,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -2785,12 +2026,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -2802,12 +2043,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -2826,40 +2067,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -2871,17 +2093,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -2891,8 +2104,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -2903,20 +2116,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -2946,20 +2150,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -3102,90 +2297,38 @@ function asmFunc(env) {
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
  function legalstub$3($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $3(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $3(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
@@ -3194,40 +2337,20 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, var$2 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, var$3 = 0, var$4 = 0, var$5 = 0, $21 = 0, $22 = 0, var$6 = 0, $24 = 0, $17 = 0, $18 = 0, $23 = 0, $29 = 0, $45 = 0, $56$hi = 0, $62$hi = 0;
+  var var$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, var$3 = 0, i64toi32_i32$2 = 0, var$4 = 0, var$5 = 0, var$6 = 0, $23 = 0, $29 = 0, $45 = 0, $62$hi = 0;
   i64toi32_i32$0 = var$1$hi;
   var$2 = var$1;
   var$4 = var$2 >>> 16 | 0;
   i64toi32_i32$0 = var$0$hi;
   var$3 = var$0;
   var$5 = var$3 >>> 16 | 0;
-  $17 = Math_imul(var$4, var$5);
-  $18 = var$2;
   i64toi32_i32$2 = var$3;
   i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $21 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  $23 = $17 + Math_imul($18, $21) | 0;
+  $23 = Math_imul(var$4, var$5) + Math_imul(var$2, i64toi32_i32$0) | 0;
   i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$0 = var$1;
+  i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $22 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $22 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  $29 = $23 + Math_imul($22, var$3) | 0;
+  $29 = $23 + Math_imul(i64toi32_i32$1, var$3) | 0;
   var$2 = var$2 & 65535 | 0;
   var$3 = var$3 & 65535 | 0;
   var$6 = Math_imul(var$2, var$3);
@@ -3236,25 +2359,14 @@ function asmFunc(env) {
   var$2 = (var$2 & 65535 | 0) + Math_imul(var$4, var$3) | 0;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $45 + (var$2 >>> 16 | 0) | 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $24 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $24 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $56$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = 0;
   $62$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $56$hi;
-  i64toi32_i32$2 = $24;
+  i64toi32_i32$0 = i64toi32_i32$1;
+  i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $62$hi;
-  i64toi32_i32$3 = var$2 << 16 | 0 | (var$6 & 65535 | 0) | 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$2 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
+  i64toi32_i32$2 = i64toi32_i32$2 | (var$2 << 16 | 0 | (var$6 & 65535 | 0) | 0) | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
   return i64toi32_i32$2 | 0;
  }
@@ -3264,22 +2376,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $21;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -3299,19 +2402,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$2 = i64toi32_i32$5 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$5 = var$2;
   i64toi32_i32$2 = var$1$hi;
@@ -3342,17 +2436,8 @@ function asmFunc(env) {
   i64toi32_i32$3 = var$0;
   i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
-  }
-  var$0 = $23;
+  i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
+  var$0 = i64toi32_i32$1 >> 31 | 0;
   var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = $17$hi;
   i64toi32_i32$1 = $17;
@@ -3378,7 +2463,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -3393,17 +2478,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -3413,17 +2489,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -3456,16 +2523,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -3479,17 +2537,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -3498,7 +2547,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -3525,18 +2574,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -3565,12 +2606,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -3587,12 +2628,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -3604,12 +2645,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -3628,40 +2669,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -3673,17 +2695,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -3693,8 +2706,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -3705,20 +2718,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -3748,20 +2752,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -3893,45 +2888,19 @@ function asmFunc(env) {
  function legalstub$1($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $1(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $1(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2 | 0;
  }
  
@@ -3940,22 +2909,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $21;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -3975,19 +2935,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$2 = i64toi32_i32$5 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$5 = var$2;
   i64toi32_i32$2 = var$1$hi;
@@ -4018,17 +2969,8 @@ function asmFunc(env) {
   i64toi32_i32$3 = var$0;
   i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
-  }
-  var$0 = $23;
+  i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
+  var$0 = i64toi32_i32$1 >> 31 | 0;
   var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = $17$hi;
   i64toi32_i32$1 = $17;
@@ -4070,7 +3012,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -4085,17 +3027,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -4105,17 +3038,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -4148,16 +3072,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -4171,17 +3086,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -4190,7 +3096,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -4217,18 +3123,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -4257,12 +3155,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -4279,12 +3177,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -4296,12 +3194,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -4320,40 +3218,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -4365,17 +3244,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -4385,8 +3255,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -4397,20 +3267,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -4440,20 +3301,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -4549,45 +3401,19 @@ function asmFunc(env) {
  function legalstub$1($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $1(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $1(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2 | 0;
  }
  
@@ -4596,22 +3422,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $20;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -4631,19 +3448,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$0 = $21;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$0 = i64toi32_i32$5 >> 31 | 0;
   var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$5 = var$0;
   i64toi32_i32$2 = var$1$hi;
@@ -4706,7 +3514,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -4721,17 +3529,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -4741,17 +3540,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -4784,16 +3574,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -4807,17 +3588,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -4826,7 +3598,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -4853,18 +3625,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -4893,12 +3657,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -4915,12 +3679,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -4932,12 +3696,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -4956,40 +3720,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -5001,17 +3746,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -5021,8 +3757,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -5033,20 +3769,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -5076,20 +3803,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -5204,90 +3922,38 @@ function asmFunc(env) {
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
  function legalstub$3($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $3(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $3(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
@@ -5296,22 +3962,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $21;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -5331,19 +3988,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$2 = i64toi32_i32$5 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$5 = var$2;
   i64toi32_i32$2 = var$1$hi;
@@ -5374,17 +4022,8 @@ function asmFunc(env) {
   i64toi32_i32$3 = var$0;
   i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
-  }
-  var$0 = $23;
+  i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
+  var$0 = i64toi32_i32$1 >> 31 | 0;
   var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = $17$hi;
   i64toi32_i32$1 = $17;
@@ -5410,7 +4049,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -5425,17 +4064,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -5445,17 +4075,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -5488,16 +4109,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -5511,17 +4123,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -5530,7 +4133,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -5557,18 +4160,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -5597,12 +4192,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -5619,12 +4214,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -5636,12 +4231,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -5660,40 +4255,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -5705,17 +4281,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -5725,8 +4292,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -5737,20 +4304,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -5780,20 +4338,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -5926,90 +4475,38 @@ function asmFunc(env) {
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
  function legalstub$3($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $3(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $3(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
@@ -6018,22 +4515,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $21;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -6053,19 +4541,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$2 = i64toi32_i32$5 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$5 = var$2;
   i64toi32_i32$2 = var$1$hi;
@@ -6096,17 +4575,8 @@ function asmFunc(env) {
   i64toi32_i32$3 = var$0;
   i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
-  }
-  var$0 = $23;
+  i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
+  var$0 = i64toi32_i32$1 >> 31 | 0;
   var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = $17$hi;
   i64toi32_i32$1 = $17;
@@ -6132,7 +4602,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -6147,17 +4617,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -6167,17 +4628,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -6210,16 +4662,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -6233,17 +4676,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -6252,7 +4686,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -6279,18 +4713,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -6319,12 +4745,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -6341,12 +4767,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -6358,12 +4784,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -6382,40 +4808,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -6427,17 +4834,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -6447,8 +4845,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -6459,20 +4857,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -6502,20 +4891,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -6648,90 +5028,38 @@ function asmFunc(env) {
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
  function legalstub$3($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $3(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $3(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
@@ -6740,22 +5068,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $21;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -6775,19 +5094,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$2 = i64toi32_i32$5 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$5 = var$2;
   i64toi32_i32$2 = var$1$hi;
@@ -6818,17 +5128,8 @@ function asmFunc(env) {
   i64toi32_i32$3 = var$0;
   i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
-  }
-  var$0 = $23;
+  i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
+  var$0 = i64toi32_i32$1 >> 31 | 0;
   var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = $17$hi;
   i64toi32_i32$1 = $17;
@@ -6854,7 +5155,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -6869,17 +5170,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -6889,17 +5181,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -6932,16 +5215,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -6954,18 +5228,9 @@ function asmFunc(env) {
              break label$6
             }
             i64toi32_i32$1 = 0;
-            i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$2 = var$4 & var$2 | 0;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -6974,7 +5239,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -7001,18 +5266,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -7041,12 +5298,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -7063,12 +5320,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -7080,12 +5337,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -7104,40 +5361,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -7149,17 +5387,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -7169,8 +5398,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -7181,20 +5410,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -7224,20 +5444,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -7370,90 +5581,38 @@ function asmFunc(env) {
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
  function legalstub$3($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $3(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $3(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
@@ -7462,22 +5621,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $21;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -7497,19 +5647,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$2 = i64toi32_i32$5 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$5 = var$2;
   i64toi32_i32$2 = var$1$hi;
@@ -7540,17 +5681,8 @@ function asmFunc(env) {
   i64toi32_i32$3 = var$0;
   i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
-  }
-  var$0 = $23;
+  i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
+  var$0 = i64toi32_i32$1 >> 31 | 0;
   var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = $17$hi;
   i64toi32_i32$1 = $17;
@@ -7576,7 +5708,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -7591,17 +5723,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -7611,17 +5734,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -7654,16 +5768,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -7677,17 +5782,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -7696,7 +5792,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -7723,18 +5819,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -7763,12 +5851,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -7785,12 +5873,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -7802,12 +5890,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -7826,40 +5914,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -7871,17 +5940,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -7891,8 +5951,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -7903,20 +5963,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -7946,20 +5997,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -8092,90 +6134,38 @@ function asmFunc(env) {
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
  function legalstub$3($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $3(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $3(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
@@ -8184,22 +6174,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $20;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -8219,19 +6200,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$0 = $21;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$0 = i64toi32_i32$5 >> 31 | 0;
   var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$5 = var$0;
   i64toi32_i32$2 = var$1$hi;
@@ -8278,7 +6250,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -8293,17 +6265,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -8313,17 +6276,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -8356,16 +6310,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -8379,17 +6324,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -8398,7 +6334,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -8425,18 +6361,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -8465,12 +6393,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -8487,12 +6415,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -8504,12 +6432,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -8528,40 +6456,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -8573,17 +6482,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -8593,8 +6493,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -8605,20 +6505,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -8648,20 +6539,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -8796,90 +6678,38 @@ function asmFunc(env) {
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
  function legalstub$3($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $3(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $3(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
@@ -8888,22 +6718,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $20;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -8923,19 +6744,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$0 = $21;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$0 = i64toi32_i32$5 >> 31 | 0;
   var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$5 = var$0;
   i64toi32_i32$2 = var$1$hi;
@@ -8982,7 +6794,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -8997,17 +6809,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -9017,17 +6820,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -9060,16 +6854,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -9083,17 +6868,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -9102,7 +6878,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -9129,18 +6905,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -9169,12 +6937,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -9191,12 +6959,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -9208,12 +6976,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -9232,40 +7000,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -9277,17 +7026,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -9297,8 +7037,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -9309,20 +7049,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -9352,20 +7083,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -9500,90 +7222,38 @@ function asmFunc(env) {
  function legalstub$2($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $2(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $2(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
  function legalstub$3($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2_1 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2_1 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $3(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $3(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2_1 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2_1 | 0;
  }
  
@@ -9592,22 +7262,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $20;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -9627,19 +7288,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$0 = $21;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$0 = i64toi32_i32$5 >> 31 | 0;
   var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$5 = var$0;
   i64toi32_i32$2 = var$1$hi;
@@ -9686,7 +7338,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -9701,17 +7353,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -9721,17 +7364,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -9764,16 +7398,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -9787,17 +7412,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -9806,7 +7422,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -9833,18 +7449,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -9873,12 +7481,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -9895,12 +7503,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -9912,12 +7520,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -9936,40 +7544,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -9981,17 +7570,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -10001,8 +7581,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -10013,20 +7593,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -10056,20 +7627,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -10187,45 +7749,19 @@ function asmFunc(env) {
  function legalstub$1($0_1, $1_1) {
   $0_1 = $0_1 | 0;
   $1_1 = $1_1 | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $12 = 0, $13 = 0, $4 = 0, $4$hi = 0, $7$hi = 0, $2 = 0, $2$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $4$hi = 0, $2 = 0;
   i64toi32_i32$0 = 0;
-  $4 = $0_1;
   $4$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = $1_1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
-  $7$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $4$hi;
-  i64toi32_i32$0 = $4;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$3 = $12;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = $1(i64toi32_i32$0 | i64toi32_i32$3 | 0 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$0 = $0_1;
+  i64toi32_i32$2 = $4$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = $1(i64toi32_i32$0 | 0 | 0 | 0, i64toi32_i32$2 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   $2 = i64toi32_i32$2;
-  $2$hi = i64toi32_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $13 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $13 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  setTempRet0($13 | 0);
-  i64toi32_i32$2 = $2$hi;
+  setTempRet0(i64toi32_i32$0 | 0);
+  i64toi32_i32$2 = i64toi32_i32$0;
   return $2 | 0;
  }
  
@@ -10234,22 +7770,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $21;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -10269,19 +7796,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$2 = i64toi32_i32$5 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$5 = var$2;
   i64toi32_i32$2 = var$1$hi;
@@ -10312,17 +7830,8 @@ function asmFunc(env) {
   i64toi32_i32$3 = var$0;
   i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
-  }
-  var$0 = $23;
+  i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
+  var$0 = i64toi32_i32$1 >> 31 | 0;
   var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = $17$hi;
   i64toi32_i32$1 = $17;
@@ -10364,7 +7873,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36 = 0, $37 = 0, $38 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -10379,17 +7888,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -10399,17 +7899,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -10442,16 +7933,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -10465,17 +7947,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -10484,7 +7957,7 @@ function asmFunc(env) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -10511,18 +7984,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -10551,12 +8016,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $36;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -10573,12 +8038,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $37;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -10590,12 +8055,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $38 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $38;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -10614,40 +8079,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -10659,17 +8105,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -10679,8 +8116,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -10691,20 +8128,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -10734,20 +8162,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -1268,40 +1268,20 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, var$2 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, var$3 = 0, var$4 = 0, var$5 = 0, $21 = 0, $22 = 0, var$6 = 0, $24 = 0, $17 = 0, $18 = 0, $23 = 0, $29 = 0, $45_1 = 0, $56$hi = 0, $62$hi = 0;
+  var var$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, var$3 = 0, i64toi32_i32$2 = 0, var$4 = 0, var$5 = 0, var$6 = 0, $23 = 0, $29 = 0, $45_1 = 0, $62$hi = 0;
   i64toi32_i32$0 = var$1$hi;
   var$2 = var$1;
   var$4 = var$2 >>> 16 | 0;
   i64toi32_i32$0 = var$0$hi;
   var$3 = var$0;
   var$5 = var$3 >>> 16 | 0;
-  $17 = Math_imul(var$4, var$5);
-  $18 = var$2;
   i64toi32_i32$2 = var$3;
   i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $21 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  $23 = $17 + Math_imul($18, $21) | 0;
+  $23 = Math_imul(var$4, var$5) + Math_imul(var$2, i64toi32_i32$0) | 0;
   i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$0 = var$1;
+  i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $22 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $22 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  $29 = $23 + Math_imul($22, var$3) | 0;
+  $29 = $23 + Math_imul(i64toi32_i32$1, var$3) | 0;
   var$2 = var$2 & 65535 | 0;
   var$3 = var$3 & 65535 | 0;
   var$6 = Math_imul(var$2, var$3);
@@ -1310,25 +1290,14 @@ function asmFunc(env) {
   var$2 = (var$2 & 65535 | 0) + Math_imul(var$4, var$3) | 0;
   i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $45_1 + (var$2 >>> 16 | 0) | 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $24 = 0;
-  } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $24 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-  }
-  $56$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$0 = 0;
   $62$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $56$hi;
-  i64toi32_i32$2 = $24;
+  i64toi32_i32$0 = i64toi32_i32$1;
+  i64toi32_i32$2 = 0;
   i64toi32_i32$1 = $62$hi;
-  i64toi32_i32$3 = var$2 << 16 | 0 | (var$6 & 65535 | 0) | 0;
   i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$2 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
+  i64toi32_i32$2 = i64toi32_i32$2 | (var$2 << 16 | 0 | (var$6 & 65535 | 0) | 0) | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
   return i64toi32_i32$2 | 0;
  }
@@ -1338,22 +1307,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $21;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -1373,19 +1333,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$2 = i64toi32_i32$5 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$5 = var$2;
   i64toi32_i32$2 = var$1$hi;
@@ -1416,17 +1367,8 @@ function asmFunc(env) {
   i64toi32_i32$3 = var$0;
   i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
-  }
-  var$0 = $23;
+  i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
+  var$0 = i64toi32_i32$1 >> 31 | 0;
   var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = $17$hi;
   i64toi32_i32$1 = $17;
@@ -1452,22 +1394,13 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  var$2 = $20;
+  i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
+  var$2 = i64toi32_i32$0 >> 31 | 0;
   var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
+  i64toi32_i32$1 = i64toi32_i32$0;
   i64toi32_i32$1 = var$2$hi;
   i64toi32_i32$0 = var$2;
   i64toi32_i32$2 = var$0$hi;
@@ -1487,19 +1420,10 @@ function asmFunc(env) {
   $9$hi = i64toi32_i32$5;
   i64toi32_i32$5 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$0 = $21;
+  i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
+  var$0 = i64toi32_i32$5 >> 31 | 0;
   var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$1 = i64toi32_i32$5;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$5 = var$0;
   i64toi32_i32$2 = var$1$hi;
@@ -1546,7 +1470,7 @@ function asmFunc(env) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37_1 = 0, $38_1 = 0, $39_1 = 0, $40_1 = 0, $41_1 = 0, $42_1 = 0, $43_1 = 0, $44_1 = 0, var$8$hi = 0, $45_1 = 0, $46_1 = 0, $47_1 = 0, $48_1 = 0, var$7$hi = 0, $49_1 = 0, $63$hi = 0, $65_1 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, var$2 = 0, i64toi32_i32$4 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $36_1 = 0, $37_1 = 0, $38_1 = 0, var$8$hi = 0, var$7$hi = 0, $63$hi = 0, $65_1 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142 = 0, $142$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -1561,17 +1485,8 @@ function asmFunc(env) {
              i64toi32_i32$0 = var$0$hi;
              i64toi32_i32$2 = var$0;
              i64toi32_i32$1 = 0;
-             i64toi32_i32$3 = 32;
-             i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-             if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $37_1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-             } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-             }
-             var$2 = $37_1;
-             if (var$2) {
+             var$2 = i64toi32_i32$0;
+             if (i64toi32_i32$0) {
               block : {
                i64toi32_i32$1 = var$1$hi;
                var$3 = var$1;
@@ -1581,17 +1496,8 @@ function asmFunc(env) {
                i64toi32_i32$1 = var$1$hi;
                i64toi32_i32$0 = var$1;
                i64toi32_i32$2 = 0;
-               i64toi32_i32$3 = 32;
-               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-                i64toi32_i32$2 = 0;
-                $38_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               } else {
-                i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
-               }
-               var$4 = $38_1;
-               if (!var$4) {
+               var$4 = i64toi32_i32$1;
+               if (!i64toi32_i32$1) {
                 break label$9
                }
                var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
@@ -1624,16 +1530,7 @@ function asmFunc(env) {
             i64toi32_i32$2 = var$1$hi;
             i64toi32_i32$3 = var$1;
             i64toi32_i32$1 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $39_1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-            } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
-            }
-            var$3 = $39_1;
+            var$3 = i64toi32_i32$2;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -1647,17 +1544,8 @@ function asmFunc(env) {
             }
             i64toi32_i32$1 = 0;
             i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40_1 = 0;
-            } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-            }
-            $63$hi = i64toi32_i32$3;
+            i64toi32_i32$3 = i64toi32_i32$2;
+            $63$hi = i64toi32_i32$2;
             i64toi32_i32$3 = var$0$hi;
             i64toi32_i32$1 = var$0;
             i64toi32_i32$2 = 0;
@@ -1666,7 +1554,7 @@ function asmFunc(env) {
             $65_1 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40_1;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65_1;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -1693,18 +1581,10 @@ function asmFunc(env) {
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
         i64toi32_i32$3 = 0;
         i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41_1 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-        }
-        __wasm_intrinsics_temp_i64 = $41_1;
-        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        i64toi32_i32$1 = i64toi32_i32$2;
+        __wasm_intrinsics_temp_i64 = 0;
+        __wasm_intrinsics_temp_i64$hi = i64toi32_i32$2;
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -1733,12 +1613,12 @@ function asmFunc(env) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42_1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $36_1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $36_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42_1;
+      i64toi32_i32$3 = $36_1;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -1755,12 +1635,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43_1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $37_1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $37_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43_1;
+    var$5 = $37_1;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -1772,12 +1652,12 @@ function asmFunc(env) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44_1 = 0;
+     $38_1 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44_1 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $38_1 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44_1;
+    var$0 = $38_1;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -1796,40 +1676,21 @@ function asmFunc(env) {
        label$15 : while (1) {
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45_1 = 0;
-        } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45_1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        }
-        $140 = $45_1;
+        i64toi32_i32$1 = i64toi32_i32$2 >>> 31 | 0 | (i64toi32_i32$5 << 1 | 0) | 0;
+        $140 = i64toi32_i32$2 << 1 | 0;
         $140$hi = i64toi32_i32$1;
         i64toi32_i32$1 = var$0$hi;
         i64toi32_i32$5 = var$0;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46_1 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46_1 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
-        }
+        $142 = i64toi32_i32$1 >>> 31 | 0;
         $142$hi = i64toi32_i32$2;
         i64toi32_i32$2 = $140$hi;
         i64toi32_i32$1 = $140;
         i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46_1;
+        i64toi32_i32$0 = $142;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
         var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
         var$5$hi = i64toi32_i32$5;
-        $144 = var$5;
-        $144$hi = i64toi32_i32$5;
         i64toi32_i32$5 = var$8$hi;
         i64toi32_i32$5 = var$5$hi;
         i64toi32_i32$5 = var$8$hi;
@@ -1841,17 +1702,8 @@ function asmFunc(env) {
         i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
         i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
         i64toi32_i32$5 = i64toi32_i32$3;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47_1 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47_1 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
-        }
-        var$6 = $47_1;
+        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
+        var$6 = i64toi32_i32$4 >> 31 | 0;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
@@ -1861,8 +1713,8 @@ function asmFunc(env) {
         i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
         $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
         $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
-        i64toi32_i32$2 = $144;
+        i64toi32_i32$5 = i64toi32_i32$1;
+        i64toi32_i32$2 = var$5;
         i64toi32_i32$4 = $151$hi;
         i64toi32_i32$0 = $151;
         i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
@@ -1873,20 +1725,11 @@ function asmFunc(env) {
         var$5$hi = i64toi32_i32$3;
         i64toi32_i32$3 = var$0$hi;
         i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48_1 = 0;
-        } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48_1 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        }
+        i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
         $154$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$7$hi;
         i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48_1;
+        i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
         i64toi32_i32$5 = var$7$hi;
         i64toi32_i32$0 = var$7;
         i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
@@ -1916,20 +1759,11 @@ function asmFunc(env) {
     __wasm_intrinsics_temp_i64$hi = i64toi32_i32$3;
     i64toi32_i32$3 = var$0$hi;
     i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49_1 = 0;
-    } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49_1 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-    }
+    i64toi32_i32$2 = i64toi32_i32$5 >>> 31 | 0 | (i64toi32_i32$3 << 1 | 0) | 0;
     $165$hi = i64toi32_i32$2;
     i64toi32_i32$2 = var$6$hi;
     i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49_1;
+    i64toi32_i32$3 = i64toi32_i32$5 << 1 | 0;
     i64toi32_i32$5 = var$6$hi;
     i64toi32_i32$0 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;